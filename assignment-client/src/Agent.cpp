@@ -97,6 +97,8 @@ Agent::Agent(ReceivedMessage& message) :
     DependencyManager::set<recording::Deck>();
     DependencyManager::set<recording::Recorder>();
     DependencyManager::set<recording::ClipCache>();
+    // the agents of this host playing the same recordings share the pages of one copy of them
+    recording::NetworkClip::setSharedDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/recordings");
 
     DependencyManager::set<RecordingScriptingInterface>();
     DependencyManager::set<UsersScriptingInterface>();
@@ -27,6 +27,7 @@
 #include <LogUtils.h>
 #include <LimitedNodeList.h>
 #include <NodeList.h>
+#include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
 #include <ShutdownEventListener.h>
@@ -48,7 +49,11 @@ AssignmentClient::AssignmentClient(Assignment::Type requestAssignmentType, QStri
 {
     LogUtils::init();
 
-    DependencyManager::set<tracing::Tracer>();
+    // keep a rolling trace, so that the domain-server can ask for what we were doing during a spike after the fact
+    static const int64_t TRACE_WINDOW_USECS = 60 * USECS_PER_SECOND;
+    auto tracer = DependencyManager::set<tracing::Tracer>();
+    tracer->setRollingWindow(TRACE_WINDOW_USECS);
+    tracer->startTracing();
     DependencyManager::set<StatTracker>();
     DependencyManager::set<AccountManager>();
     DependencyManager::set<ResourceRequestObserver>();
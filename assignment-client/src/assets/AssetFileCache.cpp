@@ -0,0 +1,104 @@
+//
+//  AssetFileCache.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetFileCache.h"
+
+#include "AssetServerLogging.h"
+
+MappedAssetFilePointer MappedAssetFile::open(const QString& filePath) {
+    MappedAssetFilePointer mappedFile { new MappedAssetFile(filePath) };
+    if (!mappedFile->_file.open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+
+    // an empty file can't be mapped, but there is nothing to send from it anyway
+    mappedFile->_size = mappedFile->_file.size();
+    if (mappedFile->_size > 0) {
+        mappedFile->_data = mappedFile->_file.map(0, mappedFile->_size);
+        if (!mappedFile->_data) {
+            qCWarning(asset_server) << "Failed to map" << filePath << ":" << mappedFile->_file.errorString();
+            return nullptr;
+        }
+    }
+    return mappedFile;
+}
+
+const AssetUtils::AssetChunks& MappedAssetFile::getChunks() const {
+    std::call_once(_chunksFlag, [this] {
+        _chunks = AssetUtils::chunkData(getData(), _size);
+    });
+    return _chunks;
+}
+
+MappedAssetFile::~MappedAssetFile() {
+    if (_data) {
+        _file.unmap(_data);
+    }
+}
+
+MappedAssetFilePointer AssetFileCache::get(const AssetUtils::AssetHash& hash, const QString& filePath) {
+    {
+        QMutexLocker locker(&_mutex);
+        auto it = _entriesByHash.find(hash);
+        if (it != _entriesByHash.end()) {
+            _entries.splice(_entries.begin(), _entries, it.value());
+            ++_numHits;
+            return _entries.front().second;
+        }
+    }
+
+    // map the file without holding the lock, the other requests don't have to wait for the disk
+    ++_numMisses;
+    auto mappedFile = MappedAssetFile::open(filePath);
+    if (!mappedFile || mappedFile->getSize() > _maxSize) {
+        return mappedFile;
+    }
+
+    QMutexLocker locker(&_mutex);
+    auto it = _entriesByHash.find(hash);
+    if (it != _entriesByHash.end()) {
+        // another request mapped it meanwhile
+        return it.value()->second;
+    }
+    _entries.emplace_front(hash, mappedFile);
+    _entriesByHash.insert(hash, _entries.begin());
+    _size += mappedFile->getSize();
+    evict();
+    return mappedFile;
+}
+
+void AssetFileCache::remove(const AssetUtils::AssetHash& hash) {
+    QMutexLocker locker(&_mutex);
+    auto it = _entriesByHash.find(hash);
+    if (it != _entriesByHash.end()) {
+        _size -= it.value()->second->getSize();
+        _entries.erase(it.value());
+        _entriesByHash.erase(it);
+    }
+}
+
+qint64 AssetFileCache::getSize() const {
+    QMutexLocker locker(&_mutex);
+    return _size;
+}
+
+int AssetFileCache::getNumFiles() const {
+    QMutexLocker locker(&_mutex);
+    return _entriesByHash.size();
+}
+
+void AssetFileCache::evict() {
+    while (_size > _maxSize && !_entries.empty()) {
+        const auto& entry = _entries.back();
+        _size -= entry.second->getSize();
+        _entriesByHash.remove(entry.first);
+        _entries.pop_back();
+    }
+}
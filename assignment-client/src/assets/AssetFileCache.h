@@ -0,0 +1,85 @@
+//
+//  AssetFileCache.h
+//  assignment-client/src/assets
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetFileCache_h
+#define hifi_AssetFileCache_h
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+
+#include "AssetUtils.h"
+
+// An asset file mapped into memory, the packets of a reply are written straight from its pages.
+// It stays mapped until the last task that sends from it is done, even once the cache dropped it.
+class MappedAssetFile {
+public:
+    // nullptr when the file doesn't exist or can't be mapped
+    static std::shared_ptr<MappedAssetFile> open(const QString& filePath);
+
+    ~MappedAssetFile();
+
+    const char* getData() const { return reinterpret_cast<const char*>(_data); }
+    qint64 getSize() const { return _size; }
+
+    // the content defined chunks of the file, listed the first time they are asked for
+    const AssetUtils::AssetChunks& getChunks() const;
+
+private:
+    MappedAssetFile(const QString& filePath) : _file(filePath) {}
+
+    QFile _file;
+    uchar* _data { nullptr };
+    qint64 _size { 0 };
+
+    mutable std::once_flag _chunksFlag;
+    mutable AssetUtils::AssetChunks _chunks;
+};
+
+using MappedAssetFilePointer = std::shared_ptr<MappedAssetFile>;
+
+// The most recently requested asset files, mapped, up to a total size.  The files are content addressed
+// so what's in the cache can't go stale, it only has to drop the ones that are deleted.
+// It is shared by the transfer tasks, which can run on any thread.
+class AssetFileCache {
+public:
+    AssetFileCache(qint64 maxSize) : _maxSize(maxSize) {}
+
+    // the mapped file of an asset, which is mapped and added to the cache when it isn't in it
+    MappedAssetFilePointer get(const AssetUtils::AssetHash& hash, const QString& filePath);
+
+    void remove(const AssetUtils::AssetHash& hash);
+
+    qint64 getSize() const;
+    int getNumFiles() const;
+    uint64_t getNumHits() const { return _numHits; }
+    uint64_t getNumMisses() const { return _numMisses; }
+
+private:
+    using Entry = std::pair<AssetUtils::AssetHash, MappedAssetFilePointer>;
+
+    void evict();
+
+    mutable QMutex _mutex;
+    std::list<Entry> _entries; // most recently used first
+    QHash<AssetUtils::AssetHash, std::list<Entry>::iterator> _entriesByHash;
+    qint64 _size { 0 };
+    const qint64 _maxSize;
+
+    std::atomic<uint64_t> _numHits { 0 };
+    std::atomic<uint64_t> _numMisses { 0 };
+};
+
+#endif // hifi_AssetFileCache_h
@@ -22,9 +22,11 @@
 #include <QtCore/QDirIterator>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QSaveFile>
 #include <QtCore/QString>
+#include <QtCore/QThread>
 #include <QtGui/QImageReader>
 #include <QtCore/QVector>
 #include <QtCore/QUrlQuery>
@@ -34,9 +36,11 @@
 #include <SharedUtil.h>
 #include <PathUtils.h>
 #include <image/TextureProcessing.h>
+#include <udt/BBRCC.h>
 
 #include "AssetServerLogging.h"
 #include "BakeAssetTask.h"
+#include "SendAssetChunksTask.h"
 #include "SendAssetTask.h"
 #include "UploadAssetTask.h"
 
@@ -113,11 +117,31 @@ QString getBakeMapping(const AssetUtils::AssetHash& hash, const QString& relativ
 
 const QString ASSET_SERVER_LOGGING_TARGET_NAME = "asset-server";
 
+// the textures are the most numerous and the quickest to bake, and a requested asset goes before all of them
+static const int MODEL_BAKE_PRIORITY = 0;
+static const int SCRIPT_BAKE_PRIORITY = 1;
+static const int TEXTURE_BAKE_PRIORITY = 1;
+static const int REQUESTED_BAKE_PRIORITY = 2;
+
+static int bakePriorityForAssetType(BakedAssetType type) {
+    switch (type) {
+        case BakedAssetType::Texture:
+            return TEXTURE_BAKE_PRIORITY;
+        case BakedAssetType::Script:
+            return SCRIPT_BAKE_PRIORITY;
+        default:
+            return MODEL_BAKE_PRIORITY;
+    }
+}
+
+// how much memory an oven can take for a large model
+static const uint64_t BYTES_PER_OVEN = 1024 * 1024 * 1024;
+
 void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) {
     qDebug() << "Starting bake for: " << assetPath << assetHash;
     auto it = _pendingBakes.find(assetHash);
     if (it == _pendingBakes.end()) {
-        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath);
+        auto task = std::make_shared<BakeAssetTask>(assetHash, assetPath, filePath, _bakeFarmPath);
         task->setAutoDelete(false);
         _pendingBakes[assetHash] = task;
 
@@ -125,12 +149,42 @@ void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetU
         connect(task.get(), &BakeAssetTask::bakeFailed, this, &AssetServer::handleFailedBake);
         connect(task.get(), &BakeAssetTask::bakeAborted, this, &AssetServer::handleAbortedBake);
 
-        _bakingTaskPool.start(task.get());
+        _bakingTaskPool.start(task.get(), bakePriorityForAssetType(assetTypeForFilename(assetPath)));
     } else {
         qDebug() << "Already in queue";
     }
 }
 
+void AssetServer::setMaxConcurrentBakes(int maxConcurrentBakes) {
+    if (maxConcurrentBakes <= 0) {
+        // leave a core to the transfers, and don't start more ovens than the memory can hold
+        maxConcurrentBakes = std::max(QThread::idealThreadCount() - 1, 1);
+        MemoryInfo memoryInfo;
+        if (getMemoryInfo(memoryInfo)) {
+            maxConcurrentBakes = std::min(maxConcurrentBakes, std::max((int)(memoryInfo.totalMemoryBytes / BYTES_PER_OVEN), 1));
+        }
+    }
+    qCInfo(asset_server) << "Running up to" << maxConcurrentBakes << "bakes at once.";
+    _bakingTaskPool.setMaxThreadCount(maxConcurrentBakes);
+}
+
+void AssetServer::prioritizeBake(const AssetUtils::AssetHash& hash) {
+    auto it = _pendingBakes.find(hash);
+    // a task that was already started can't be taken back from the pool
+    if (it != _pendingBakes.end() && _bakingTaskPool.tryTake(it->get())) {
+        qDebug() << "Moving the bake of requested asset" << (*it)->getAssetPath() << "to the front of the queue";
+        _bakingTaskPool.start(it->get(), REQUESTED_BAKE_PRIORITY);
+    }
+}
+
+void AssetServer::recordBakeTime(const AssetUtils::AssetHash& hash) {
+    auto it = _pendingBakes.find(hash);
+    if (it != _pendingBakes.end() && (*it)->getBakeStartTime() > 0) {
+        _totalBakeTime += usecTimestampNow() - (*it)->getBakeStartTime();
+        _numCompletedBakes++;
+    }
+}
+
 QString AssetServer::getPathToAssetHash(const AssetUtils::AssetHash& assetHash) {
     return _filesDirectory.absoluteFilePath(assetHash);
 }
@@ -290,9 +344,12 @@ void updateConsumedCores() {
     setMaxCores(coreCount);
 }
 
+// when an event starts most of the clients fetch the same few baked assets
+static const qint64 MAX_CACHED_ASSET_FILES_SIZE = 512 * 1024 * 1024;
 
 AssetServer::AssetServer(ReceivedMessage& message) :
     ThreadedAssignment(message),
+    _fileCache(MAX_CACHED_ASSET_FILES_SIZE),
     _transferTaskPool(this),
     _bakingTaskPool(this),
     _filesizeLimit(AssetUtils::MAX_UPLOAD_SIZE)
@@ -304,11 +361,12 @@ AssetServer::AssetServer(ReceivedMessage& message) :
     // so the ideal is greater than the number of cores on the system.
     static const int TASK_POOL_THREAD_COUNT = 50;
     _transferTaskPool.setMaxThreadCount(TASK_POOL_THREAD_COUNT);
-    _bakingTaskPool.setMaxThreadCount(1);
+    _bakingTaskPool.setMaxThreadCount(1);  // until the settings are known
 
     // Queue all requests until the Asset Server is fully setup
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
-    packetReceiver.registerListenerForTypes({ PacketType::AssetGet, PacketType::AssetGetInfo, PacketType::AssetUpload, PacketType::AssetMappingOperation }, this, "queueRequests");
+    packetReceiver.registerListenerForTypes({ PacketType::AssetGet, PacketType::AssetGetInfo, PacketType::AssetGetChunks,
+                                                PacketType::AssetUpload, PacketType::AssetMappingOperation }, this, "queueRequests");
 
 #ifdef Q_OS_WIN
     updateConsumedCores();
@@ -348,6 +406,10 @@ void AssetServer::aboutToFinish() {
     while (_pendingBakes.size() > 0) {
         QCoreApplication::processEvents();
     }
+
+    if (_numJournaledMappingChanges > 0) {
+        compactMappings();
+    }
 }
 
 void AssetServer::run() {
@@ -392,6 +454,14 @@ void AssetServer::completeSetup() {
                     " (" << maxBandwidth << "bits/s)";
     }
 
+    static const QString CONGESTION_CONTROL_OPTION = "congestion_control";
+    static const QString BBR_CONGESTION_CONTROL = "bbr";
+    if (assetServerObject[CONGESTION_CONTROL_OPTION].toString() == BBR_CONGESTION_CONTROL) {
+        nodeList->setCongestionControlFactory(std::unique_ptr<udt::CongestionControlVirtualFactory>(
+            new udt::CongestionControlFactory<udt::BBRCC>()));
+        qCInfo(asset_server) << "Using BBR congestion control for new connections.";
+    }
+
     // get the path to the asset folder from the domain server settings
     static const QString ASSETS_PATH_OPTION = "assets_path";
     auto assetsJSONValue = assetServerObject[ASSETS_PATH_OPTION];
@@ -424,6 +494,12 @@ void AssetServer::completeSetup() {
         return;
     }
 
+    static const QString MAX_CONCURRENT_BAKES_OPTION = "max_concurrent_bakes";
+    setMaxConcurrentBakes(assetServerObject[MAX_CONCURRENT_BAKES_OPTION].toInt(0));
+
+    static const QString BAKE_FARM_PATH_OPTION = "bake_farm_path";
+    _bakeFarmPath = assetServerObject[BAKE_FARM_PATH_OPTION].toString();
+
     // load whatever mappings we currently have from the local file
     if (loadMappingsFromFile()) {
         qCInfo(asset_server) << "Serving files from: " << _filesDirectory.path();
@@ -466,6 +542,7 @@ void AssetServer::completeSetup() {
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
     packetReceiver.registerListener(PacketType::AssetGet, this, "handleAssetGet");
     packetReceiver.registerListener(PacketType::AssetGetInfo, this, "handleAssetGetInfo");
+    packetReceiver.registerListener(PacketType::AssetGetChunks, this, "handleAssetGetChunks");
     packetReceiver.registerListener(PacketType::AssetUpload, this, "handleAssetUpload");
     packetReceiver.registerListener(PacketType::AssetMappingOperation, this, "handleAssetMappingOperation");
 
@@ -504,6 +581,9 @@ void AssetServer::replayRequests() {
             case PacketType::AssetGetInfo:
                 handleAssetGetInfo(request.first, request.second);
                 break;
+            case PacketType::AssetGetChunks:
+                handleAssetGetChunks(request.first, request.second);
+                break;
             case PacketType::AssetUpload:
                 handleAssetUpload(request.first, request.second);
                 break;
@@ -538,6 +618,8 @@ void AssetServer::cleanupUnmappedFiles() {
                 // remove the unmapped file
                 QFile removeableFile { fileInfo.absoluteFilePath() };
 
+                // the cache keeps the file open, which would stop its removal on Windows
+                _fileCache.remove(filename);
                 if (removeableFile.remove()) {
                     qCDebug(asset_server) << "\tDeleted" << filename << "from asset files directory since it is unmapped.";
 
@@ -604,7 +686,7 @@ void AssetServer::handleAssetMappingOperation(QSharedPointer<ReceivedMessage> me
             handleGetMappingOperation(*message, *replyPacket);
             break;
         case AssetMappingOperationType::GetAll:
-            handleGetAllMappingOperation(*replyPacket);
+            handleGetAllMappingOperation(*message, *replyPacket);
             break;
         case AssetMappingOperationType::Set:
             handleSetMappingOperation(*message, canWriteToAssetServer, *replyPacket);
@@ -640,6 +722,9 @@ void AssetServer::handleGetMappingOperation(ReceivedMessage& message, NLPacketLi
         // check if we should re-direct to a baked asset
         auto originalAssetHash = it->second;
         QString redirectedAssetHash;
+
+        // a client is waiting for this asset, don't let it wait for the bake of the whole domain first
+        prioritizeBake(originalAssetHash);
         quint8 wasRedirected = false;
         bool bakingDisabled = false;
 
@@ -701,14 +786,25 @@ void AssetServer::handleGetMappingOperation(ReceivedMessage& message, NLPacketLi
     }
 }
 
-void AssetServer::handleGetAllMappingOperation(NLPacketList& replyPacket) {
-    replyPacket.writePrimitive(AssetUtils::AssetServerError::NoError);
+void AssetServer::handleGetAllMappingOperation(ReceivedMessage& message, NLPacketList& replyPacket) {
+    // a page of the mappings that follow the path of the last one of the previous page
+    AssetUtils::AssetPath startAfterPath = message.readString();
+    uint32_t maxCount { 0 };
+    message.readPrimitive(&maxCount);
 
-    uint32_t count = (uint32_t)_fileMappings.size();
+    AssetUtils::Mappings::const_iterator begin = startAfterPath.isEmpty() ? _fileMappings.cbegin()
+                                                                          : _fileMappings.upper_bound(startAfterPath);
+    auto end = begin;
+    uint32_t count = 0;
+    while (end != _fileMappings.cend() && count < maxCount) {
+        ++end;
+        ++count;
+    }
 
+    replyPacket.writePrimitive(AssetUtils::AssetServerError::NoError);
     replyPacket.writePrimitive(count);
 
-    for (auto it = _fileMappings.cbegin(); it != _fileMappings.cend(); ++ it) {
+    for (auto it = begin; it != end; ++it) {
         auto mapping = it->first;
         auto hash = it->second;
         replyPacket.writeString(mapping);
@@ -722,6 +818,9 @@ void AssetServer::handleGetAllMappingOperation(NLPacketList& replyPacket) {
             replyPacket.writeString(lastBakeErrors);
         }
     }
+
+    quint8 hasMoreMappings = end != _fileMappings.cend();
+    replyPacket.writePrimitive(hasMoreMappings);
 }
 
 void AssetServer::handleSetMappingOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket) {
@@ -867,7 +966,17 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
     }
 
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, _fileCache);
+    _transferTaskPool.start(task);
+}
+
+void AssetServer::handleAssetGetChunks(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
+    if (message->getSize() < qint64(sizeof(MessageID) + AssetUtils::SHA256_HASH_LENGTH)) {
+        qCDebug(asset_server) << "ERROR bad file request";
+        return;
+    }
+
+    auto task = new SendAssetChunksTask(message, senderNode, _filesDirectory, _fileCache);
     _transferTaskPool.start(task);
 }
 
@@ -881,7 +990,7 @@ void AssetServer::handleAssetUpload(QSharedPointer<ReceivedMessage> message, Sha
     if (canWriteToAssetServer) {
         qCDebug(asset_server) << "Starting an UploadAssetTask for upload from" << message->getSourceID();
 
-        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit);
+        auto task = new UploadAssetTask(message, senderNode, _filesDirectory, _filesizeLimit, _fileCache);
         _transferTaskPool.start(task);
     } else {
         // this is a node the domain told us is not allowed to rez entities
@@ -942,6 +1051,8 @@ void AssetServer::sendStatsPacket() {
         upstreamStats["3. Recvd ACK"] = events[Events::ReceivedACK];
         upstreamStats["4. Procd ACK"] = events[Events::ProcessedACK];
         upstreamStats["5. Retransmitted"] = (int)stats.retransmittedPackets;
+        upstreamStats["6. Fast Retransmits"] = (int)stats.fastRetransmitPackets;
+        upstreamStats["7. Timeout Retransmits"] = (int)stats.timeoutRetransmitPackets;
         nodeStats["Upstream Stats"] = upstreamStats;
 
         QJsonObject downstreamStats;
@@ -957,12 +1068,45 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    QJsonObject cacheStats;
+    auto numHits = _fileCache.getNumHits();
+    auto numRequests = numHits + _fileCache.getNumMisses();
+    cacheStats["1. Hit Ratio"] = numRequests > 0 ? (double)numHits / (double)numRequests : 0.0;
+    cacheStats["2. Hits"] = (double)numHits;
+    cacheStats["3. Requests"] = (double)numRequests;
+    cacheStats["4. Files"] = _fileCache.getNumFiles();
+    cacheStats["5. Size (MB)"] = (double)_fileCache.getSize() / (1024.0 * 1024.0);
+    serverStats["File Cache"] = cacheStats;
+
+    QJsonObject bakeStats;
+    int numBaking = 0;
+    for (const auto& task : _pendingBakes) {
+        if (task->isBaking()) {
+            numBaking++;
+        }
+    }
+    int numQueued = _pendingBakes.size() - numBaking;
+    int maxConcurrentBakes = std::max(_bakingTaskPool.maxThreadCount(), 1);
+    static const double USECS_PER_SECOND = 1000000.0;
+    double averageBakeTime = _numCompletedBakes > 0 ? (double)_totalBakeTime / (double)_numCompletedBakes / USECS_PER_SECOND : 0.0;
+    bakeStats["1. Queued"] = numQueued;
+    bakeStats["2. Baking"] = numBaking;
+    bakeStats["3. Max Concurrent"] = maxConcurrentBakes;
+    bakeStats["4. Average Bake (s)"] = averageBakeTime;
+    bakeStats["5. ETA (s)"] = averageBakeTime * (double)_pendingBakes.size() / (double)maxConcurrentBakes;
+    serverStats["Bakes"] = bakeStats;
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
 
 static const QString MAP_FILE_NAME = "map.json";
 
+// The changes since the map file was written, one per line.  The map file is only rewritten when there are too
+// many of them, rather than at each change.
+static const QString MAP_JOURNAL_FILE_NAME = "map.journal";
+static const int MAX_JOURNALED_MAPPING_CHANGES = 10000;
+
 bool AssetServer::loadMappingsFromFile() {
 
     auto mapFilePath = _resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
@@ -1007,7 +1151,7 @@ bool AssetServer::loadMappingsFromFile() {
                 }
 
                 qCInfo(asset_server) << "Loaded" << _fileMappings.size() << "mappings from map file at" << mapFilePath;
-                return true;
+                return replayMappingsJournal();
             }
         }
 
@@ -1017,6 +1161,44 @@ bool AssetServer::loadMappingsFromFile() {
         qCInfo(asset_server) << "No existing mappings loaded from file since no file was found at" << mapFilePath;
     }
 
+    return replayMappingsJournal();
+}
+
+bool AssetServer::replayMappingsJournal() {
+    auto journalFilePath = _resourcesDirectory.absoluteFilePath(MAP_JOURNAL_FILE_NAME);
+
+    QFile journalFile { journalFilePath };
+    if (!journalFile.exists()) {
+        return true;
+    }
+    if (!journalFile.open(QIODevice::ReadOnly)) {
+        qCCritical(asset_server) << "Failed to read mappings journal at" << journalFilePath;
+        return false;
+    }
+
+    int numChanges = 0;
+    while (!journalFile.atEnd()) {
+        auto change = QJsonDocument::fromJson(journalFile.readLine()).array();
+        if (change.size() != 2 || !AssetUtils::isValidFilePath(change[0].toString())) {
+            // only the last change can be cut short, by a crash while it was written
+            qCWarning(asset_server) << "Skipping invalid change in mappings journal at" << journalFilePath;
+            continue;
+        }
+
+        auto path = change[0].toString();
+        auto hash = change[1].toString();
+        if (hash.isEmpty()) {
+            _fileMappings.erase(path);
+        } else if (AssetUtils::isValidHash(hash)) {
+            _fileMappings[path] = hash;
+        }
+        numChanges++;
+    }
+    journalFile.close();
+
+    qCInfo(asset_server) << "Replayed" << numChanges << "mapping changes from journal at" << journalFilePath;
+    _numJournaledMappingChanges = numChanges;
+    compactMappings();
     return true;
 }
 
@@ -1050,6 +1232,83 @@ bool AssetServer::writeMappingsToFile() {
     return false;
 }
 
+bool AssetServer::appendToMappingsJournal(const MappingChanges& changes) {
+    auto journalFilePath = _resourcesDirectory.absoluteFilePath(MAP_JOURNAL_FILE_NAME);
+
+    QByteArray lines;
+    for (const auto& change : changes) {
+        lines += QJsonDocument(QJsonArray { change.first, change.second }).toJson(QJsonDocument::Compact);
+        lines += '\n';
+    }
+
+    QFile journalFile { journalFilePath };
+    if (!journalFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(asset_server) << "Failed to open the mappings journal at" << journalFilePath;
+        return false;
+    }
+
+    auto sizeBefore = journalFile.size();
+    if (journalFile.write(lines) == lines.size() && journalFile.flush()) {
+        _numJournaledMappingChanges += (int)changes.size();
+        return true;
+    }
+
+    // don't leave changes that were written in part, they would be replayed at the next start
+    qCWarning(asset_server) << "Failed to append to the mappings journal at" << journalFilePath;
+    journalFile.resize(sizeBefore);
+    return false;
+}
+
+void AssetServer::compactMappings() {
+    // the journal is only emptied once the map file holds what it did
+    if (writeMappingsToFile()) {
+        QFile journalFile { _resourcesDirectory.absoluteFilePath(MAP_JOURNAL_FILE_NAME) };
+        if (!journalFile.exists() || journalFile.resize(0)) {
+            _numJournaledMappingChanges = 0;
+        }
+    }
+}
+
+bool AssetServer::applyMappingChanges(const MappingChanges& changes) {
+    // keep what each change replaced, to undo them if they can't be persisted
+    MappingChanges undoChanges;
+    undoChanges.reserve(changes.size());
+    for (const auto& change : changes) {
+        auto it = _fileMappings.find(change.first);
+        undoChanges.push_back({ change.first, it != _fileMappings.end() ? it->second : AssetUtils::AssetHash() });
+
+        if (change.second.isEmpty()) {
+            if (it != _fileMappings.end()) {
+                _fileMappings.erase(it);
+            }
+        } else {
+            _fileMappings[change.first] = change.second;
+        }
+    }
+
+    if (!appendToMappingsJournal(changes)) {
+        for (auto it = undoChanges.rbegin(); it != undoChanges.rend(); ++it) {
+            if (it->second.isEmpty()) {
+                _fileMappings.erase(it->first);
+            } else {
+                _fileMappings[it->first] = it->second;
+            }
+        }
+        return false;
+    }
+
+    if (_numJournaledMappingChanges > MAX_JOURNALED_MAPPING_CHANGES) {
+        compactMappings();
+    }
+    return true;
+}
+
+AssetUtils::Mappings::iterator AssetServer::findFirstMappingInFolder(const AssetUtils::AssetPath& folderPath) {
+    // the mappings of a folder all start with its path, so they follow each other in the map
+    auto it = _fileMappings.lower_bound(folderPath);
+    return it != _fileMappings.end() && it->first.startsWith(folderPath) ? it : _fileMappings.end();
+}
+
 bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash hash) {
     path = path.trimmed();
 
@@ -1063,27 +1322,12 @@ bool AssetServer::setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash h
         return false;
     }
 
-    // remember what the old mapping was in case persistence fails
-    auto it = _fileMappings.find(path);
-    auto oldMapping = it != _fileMappings.end() ? it->second : "";
-
-    // update the in memory QHash
-    _fileMappings[path] = hash;
-
-    // attempt to write to file
-    if (writeMappingsToFile()) {
+    if (applyMappingChanges({ { path, hash } })) {
         // persistence succeeded, we are good to go
         qCDebug(asset_server) << "Set mapping:" << path << "=>" << hash;
         maybeBake(path, hash);
         return true;
     } else {
-        // failed to persist this mapping to file - put back the old one in our in-memory representation
-        if (oldMapping.isEmpty()) {
-            _fileMappings.erase(_fileMappings.find(path));
-        } else {
-            _fileMappings[path] = oldMapping;
-        }
-
         qCWarning(asset_server) << "Failed to persist mapping:" << path << "=>" << hash;
 
         return false;
@@ -1107,9 +1351,7 @@ void AssetServer::removeBakedPathsForDeletedAsset(AssetUtils::AssetHash hash) {
 }
 
 bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
-    // take a copy of the current mappings in case persistence of these deletes fails
-    auto oldMappings = _fileMappings;
-
+    MappingChanges changes;
     QSet<QString> hashesToCheckForDeletion;
 
     // enumerate the paths to delete and remove them all
@@ -1118,24 +1360,17 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
 
         // figure out if this path will delete a file or folder
         if (pathIsFolder(path)) {
-            // enumerate the in memory file mappings and remove anything that matches
-            auto it = _fileMappings.begin();
-            auto sizeBefore = _fileMappings.size();
-
-            while (it != _fileMappings.end()) {
-                if (it->first.startsWith(path)) {
-                    // add this hash to the list we need to check for asset removal from the server
-                    hashesToCheckForDeletion << it->second;
-
-                    it = _fileMappings.erase(it);
-                } else {
-                    ++it;
-                }
+            // enumerate the in memory file mappings of the folder and remove them
+            int numDeleted = 0;
+            for (auto it = findFirstMappingInFolder(path); it != _fileMappings.end() && it->first.startsWith(path); ++it) {
+                // add this hash to the list we need to check for asset removal from the server
+                hashesToCheckForDeletion << it->second;
+                changes.push_back({ it->first, AssetUtils::AssetHash() });
+                numDeleted++;
             }
 
-            auto sizeNow = _fileMappings.size();
-            if (sizeBefore != sizeNow) {
-                qCDebug(asset_server) << "Deleted" << sizeBefore - sizeNow << "mappings in folder: " << path;
+            if (numDeleted > 0) {
+                qCDebug(asset_server) << "Deleted" << numDeleted << "mappings in folder: " << path;
             } else {
                 qCDebug(asset_server) << "Did not find any mappings to delete in folder:" << path;
             }
@@ -1147,16 +1382,16 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
                 hashesToCheckForDeletion << it->second;
 
                 qCDebug(asset_server) << "Deleted a mapping:" << path << "=>" << it->second;
-                
-                _fileMappings.erase(it);
+
+                changes.push_back({ path, AssetUtils::AssetHash() });
             } else {
                 qCDebug(asset_server) << "Unable to delete a mapping that was not found:" << path;
             }
         }
     }
 
-    // deleted the old mappings, attempt to persist to file
-    if (writeMappingsToFile()) {
+    // delete the old mappings, and persist that
+    if (applyMappingChanges(changes)) {
         // persistence succeeded we are good to go
 
         // TODO iterate through hashesToCheckForDeletion instead
@@ -1172,6 +1407,7 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
             // remove the unmapped file
             QFile removeableFile { _filesDirectory.absoluteFilePath(hash) };
 
+            _fileCache.remove(hash);
             if (removeableFile.remove()) {
                 qCDebug(asset_server) << "\tDeleted" << hash << "from asset files directory since it is now unmapped.";
 
@@ -1185,9 +1421,6 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
     } else {
         qCWarning(asset_server) << "Failed to persist deleted mappings, rolling back";
 
-        // we didn't delete the previous mapping, put it back in our in-memory representation
-        _fileMappings = oldMappings;
-
         return false;
     }
 }
@@ -1212,35 +1445,25 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
             return false;
         }
 
-        // take a copy of the old mappings
-        auto oldMappings = _fileMappings;
-
-        // iterate the current mappings and adjust any that matches the renamed folder
-        auto it = oldMappings.begin();
-
-        while (it != oldMappings.end()) {
-            auto& oldKey = it->first;
-            if (oldKey.startsWith(oldPath)) {
-                auto newKey = oldKey;
-                newKey.replace(0, oldPath.size(), newPath);
+        // remove all the mappings of the folder before adding them back under the new path,
+        // which can be inside of the old one
+        MappingChanges changes;
+        MappingChanges renamedMappings;
+        for (auto it = findFirstMappingInFolder(oldPath); it != _fileMappings.end() && it->first.startsWith(oldPath); ++it) {
+            auto newKey = it->first;
+            newKey.replace(0, oldPath.size(), newPath);
 
-                // remove the old version from the in memory file mappings
-                _fileMappings.erase(_fileMappings.find(oldKey));
-                _fileMappings[newKey] = it->second;
-            }
-
-            ++it;
+            changes.push_back({ it->first, AssetUtils::AssetHash() });
+            renamedMappings.push_back({ newKey, it->second });
         }
+        changes.insert(changes.end(), renamedMappings.begin(), renamedMappings.end());
 
-        if (writeMappingsToFile()) {
+        if (applyMappingChanges(changes)) {
             // persisted the changed mappings, return success
             qCDebug(asset_server) << "Renamed folder mapping:" << oldPath << "=>" << newPath;
 
             return true;
         } else {
-            // couldn't persist the renamed paths, rollback and return failure
-            _fileMappings = oldMappings;
-
             qCWarning(asset_server) << "Failed to persist renamed folder mapping:" << oldPath << "=>" << newPath;
 
             return false;
@@ -1253,40 +1476,21 @@ bool AssetServer::renameMapping(AssetUtils::AssetPath oldPath, AssetUtils::Asset
             return false;
         }
 
-        // take the old hash to remove the old mapping
         auto it = _fileMappings.find(oldPath);
-        auto oldSourceMapping = it->second;
-        _fileMappings.erase(it);
-
-        // in case we're overwriting, keep the current destination mapping for potential rollback
-        auto oldDestinationIt = _fileMappings.find(newPath);
-
-        if (!oldSourceMapping.isEmpty()) {
-            _fileMappings[newPath] = oldSourceMapping;
-
-            if (writeMappingsToFile()) {
-                // persisted the renamed mapping, return success
-                qCDebug(asset_server) << "Renamed mapping:" << oldPath << "=>" << newPath;
-
-                return true;
-            } else {
-                // we couldn't persist the renamed mapping, rollback and return failure
-                _fileMappings[oldPath] = oldSourceMapping;
-
-                if (oldDestinationIt != _fileMappings.end()) {
-                    // put back the overwritten mapping for the destination path
-                    _fileMappings[newPath] = oldDestinationIt->second;
-                } else {
-                    // clear the new mapping
-                    _fileMappings.erase(_fileMappings.find(newPath));
-                }
+        if (it == _fileMappings.end()) {
+            // failed to find a mapping that was to be renamed, return failure
+            return false;
+        }
 
-                qCDebug(asset_server) << "Failed to persist renamed mapping:" << oldPath << "=>" << newPath;
+        // this overwrites the destination mapping, if there is one
+        if (applyMappingChanges({ { oldPath, AssetUtils::AssetHash() }, { newPath, it->second } })) {
+            // persisted the renamed mapping, return success
+            qCDebug(asset_server) << "Renamed mapping:" << oldPath << "=>" << newPath;
 
-                return false;
-            }
+            return true;
         } else {
-            // failed to find a mapping that was to be renamed, return failure
+            qCDebug(asset_server) << "Failed to persist renamed mapping:" << oldPath << "=>" << newPath;
+
             return false;
         }
     }
@@ -1309,6 +1513,7 @@ void AssetServer::handleFailedBake(QString originalAssetHash, QString assetPath,
 
     writeMetaFile(originalAssetHash, meta);
 
+    recordBakeTime(originalAssetHash);
     _pendingBakes.remove(originalAssetHash);
 }
 
@@ -1332,6 +1537,7 @@ void AssetServer::handleCompletedBake(QString originalAssetHash, QString origina
 
         writeMetaFile(originalAssetHash, meta);
 
+        recordBakeTime(originalAssetHash);
         _pendingBakes.remove(originalAssetHash);
     };
 
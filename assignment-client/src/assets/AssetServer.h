@@ -12,12 +12,15 @@
 #ifndef hifi_AssetServer_h
 #define hifi_AssetServer_h
 
+#include <vector>
+
 #include <QtCore/QDir>
 #include <QtCore/QThreadPool>
 #include <QRunnable>
 
 #include <ThreadedAssignment.h>
 
+#include "AssetFileCache.h"
 #include "AssetUtils.h"
 #include "ReceivedMessage.h"
 
@@ -86,6 +89,7 @@ private slots:
     void queueRequests(QSharedPointer<ReceivedMessage> packet, SharedNodePointer senderNode);
     void handleAssetGetInfo(QSharedPointer<ReceivedMessage> packet, SharedNodePointer senderNode);
     void handleAssetGet(QSharedPointer<ReceivedMessage> packet, SharedNodePointer senderNode);
+    void handleAssetGetChunks(QSharedPointer<ReceivedMessage> packet, SharedNodePointer senderNode);
     void handleAssetUpload(QSharedPointer<ReceivedMessage> packetList, SharedNodePointer senderNode);
     void handleAssetMappingOperation(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
 
@@ -95,7 +99,7 @@ private:
     void replayRequests();
 
     void handleGetMappingOperation(ReceivedMessage& message, NLPacketList& replyPacket);
-    void handleGetAllMappingOperation(NLPacketList& replyPacket);
+    void handleGetAllMappingOperation(ReceivedMessage& message, NLPacketList& replyPacket);
     void handleSetMappingOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket);
     void handleDeleteMappingsOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket);
     void handleRenameMappingOperation(ReceivedMessage& message, bool hasWriteAccess, NLPacketList& replyPacket);
@@ -106,8 +110,23 @@ private:
 
     // Mapping file operations must be called from main assignment thread only
     bool loadMappingsFromFile();
+    bool replayMappingsJournal();
     bool writeMappingsToFile();
 
+    // a path and its new hash, or an empty hash when it was deleted
+    using MappingChange = std::pair<AssetUtils::AssetPath, AssetUtils::AssetHash>;
+    using MappingChanges = std::vector<MappingChange>;
+
+    /// Apply the changes in memory and append them to the journal.  They are undone if that fails.
+    bool applyMappingChanges(const MappingChanges& changes);
+    bool appendToMappingsJournal(const MappingChanges& changes);
+
+    /// Write the map file and empty the journal
+    void compactMappings();
+
+    /// The first mapping in the folder, or the end of the mappings when it is empty
+    AssetUtils::Mappings::iterator findFirstMappingInFolder(const AssetUtils::AssetPath& folderPath);
+
     /// Set the mapping for path to hash
     bool setMapping(AssetUtils::AssetPath path, AssetUtils::AssetHash hash);
 
@@ -130,6 +149,9 @@ private:
     std::pair<AssetUtils::BakingStatus, QString> getAssetStatus(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
 
     void bakeAssets();
+    void setMaxConcurrentBakes(int maxConcurrentBakes);
+    void prioritizeBake(const AssetUtils::AssetHash& hash);
+    void recordBakeTime(const AssetUtils::AssetHash& hash);
     void maybeBake(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& hash);
     void createEmptyMetaFile(const AssetUtils::AssetHash& hash);
     bool hasMetaFile(const AssetUtils::AssetHash& hash);
@@ -149,15 +171,22 @@ private:
     void removeBakedPathsForDeletedAsset(AssetUtils::AssetHash originalAssetHash);
 
     AssetUtils::Mappings _fileMappings;
+    int _numJournaledMappingChanges { 0 };
 
     QDir _resourcesDirectory;
     QDir _filesDirectory;
 
+    /// Hot asset files the downloads are sent from, it must outlive the task pool
+    AssetFileCache _fileCache;
+
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
 
     QHash<AssetUtils::AssetHash, std::shared_ptr<BakeAssetTask>> _pendingBakes;
     QThreadPool _bakingTaskPool;
+    QString _bakeFarmPath;
+    int _numCompletedBakes { 0 };
+    quint64 _totalBakeTime { 0 };
 
     QMutex _queuedRequestsMutex;
     bool _isQueueingRequests { true };
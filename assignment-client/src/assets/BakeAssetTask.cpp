@@ -17,17 +17,42 @@
 #include <QCoreApplication>
 
 #include <PathUtils.h>
+#include <SharedUtil.h>
 
 static const int OVEN_STATUS_CODE_SUCCESS { 0 };
 static const int OVEN_STATUS_CODE_FAIL { 1 };
 static const int OVEN_STATUS_CODE_ABORT { 2 };
 
+// the layout of the bake farm folders, see tools/oven/src/BakeFarm.h
+static const QString BAKE_FARM_STORE_SUBDIR = "store";
+static const QString BAKE_FARM_FAILED_SUBDIR = "failed";
+static const QString BAKE_FARM_ERRORS_EXTENSION = ".txt";
+
+// the farm is a shared folder, there is nothing to be notified by when a worker is done
+static const unsigned long BAKE_FARM_POLL_INTERVAL_MSECS = 1000;
+
 std::once_flag registerMetaTypesFlag;
 
-BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath) :
+static bool copyDirectory(const QDir& source, const QDir& destination) {
+    if (!destination.mkpath(".")) {
+        return false;
+    }
+    for (const auto& info : source.entryInfoList(QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot)) {
+        QString destinationPath = destination.filePath(info.fileName());
+        if (info.isDir() ? !copyDirectory(QDir(info.filePath()), QDir(destinationPath))
+                         : !QFile::copy(info.filePath(), destinationPath)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BakeAssetTask::BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                             const QString& bakeFarmPath) :
     _assetHash(assetHash),
     _assetPath(assetPath),
-    _filePath(filePath)
+    _filePath(filePath),
+    _bakeFarmPath(bakeFarmPath)
 {
 
     std::call_once(registerMetaTypesFlag, []() {
@@ -41,6 +66,7 @@ void BakeAssetTask::run() {
         qWarning() << "Tried to start bake asset task while already baking";
         return;
     }
+    _bakeStartTime = usecTimestampNow();
 
     // Make a new temporary directory for the Oven to work in
     QString tempOutputDir = PathUtils::generateTemporaryDir();
@@ -72,12 +98,37 @@ void BakeAssetTask::run() {
         "-t", extension,
     };
 
+    // the farm keys its bakes by the hash of their content and their type
+    QString farmKey = _assetHash + "-" + extension;
+    bool isFarmBake = !_bakeFarmPath.isEmpty();
+    if (isFarmBake) {
+        QDir farmStoreDir { QDir(_bakeFarmPath).filePath(BAKE_FARM_STORE_SUBDIR + "/" + farmKey) };
+        if (farmStoreDir.exists()) {
+            qDebug() << "Importing the bake of" << _assetPath << "from the bake farm";
+            if (copyDirectory(farmStoreDir, QDir(tempOutputDir))) {
+                emit bakeComplete(_assetHash, _assetPath, tempOutputDir);
+            } else {
+                PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+                emit bakeFailed(_assetHash, _assetPath, "Couldn't copy the bake from the bake farm");
+            }
+            return;
+        }
+
+        // the oven only queues the asset, a farm worker bakes it
+        args = QStringList {
+            "--farm", _bakeFarmPath,
+            "-i", tempAssetPath,
+            "-t", extension,
+        };
+    }
+    bool wasQueuedInFarm { false };
+
     _ovenProcess.reset(new QProcess());
 
     QEventLoop loop;
 
     connect(_ovenProcess.get(), static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
-            this, [&loop, this, tempOutputDir, tempAssetPath, tempOutputDirName](int exitCode, QProcess::ExitStatus exitStatus) {
+            this, [&loop, &wasQueuedInFarm, isFarmBake, this, tempOutputDir, tempAssetPath, tempOutputDirName](int exitCode, QProcess::ExitStatus exitStatus) {
         qDebug() << "Baking process finished: " << exitCode << exitStatus;
 
         if (exitStatus == QProcess::CrashExit) {
@@ -88,6 +139,8 @@ void BakeAssetTask::run() {
                 QString errors = "Fatal error occurred while baking";
                 emit bakeFailed(_assetHash, _assetPath, errors);
             }
+        } else if (exitCode == OVEN_STATUS_CODE_SUCCESS && isFarmBake) {
+            wasQueuedInFarm = true;
         } else if (exitCode == OVEN_STATUS_CODE_SUCCESS) {
             emit bakeComplete(_assetHash, _assetPath, tempOutputDir);
         } else if (exitStatus == QProcess::NormalExit && exitCode == OVEN_STATUS_CODE_ABORT) {
@@ -128,6 +181,46 @@ void BakeAssetTask::run() {
     _isBaking = true;
 
     loop.exec();
+
+    if (wasQueuedInFarm) {
+        QString errors;
+        if (waitForFarmBake(farmKey, tempOutputDir, errors)) {
+            emit bakeComplete(_assetHash, _assetPath, tempOutputDir);
+        } else if (_wasAborted) {
+            PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+            emit bakeAborted(_assetHash, _assetPath);
+        } else {
+            PathUtils::deleteMyTemporaryDir(tempOutputDirName);
+            emit bakeFailed(_assetHash, _assetPath, errors);
+        }
+    }
+}
+
+bool BakeAssetTask::waitForFarmBake(const QString& farmKey, const QString& tempOutputDir, QString& errorsOut) {
+    QDir farmDir { _bakeFarmPath };
+    QString storePath = farmDir.filePath(BAKE_FARM_STORE_SUBDIR + "/" + farmKey);
+    QString errorFilePath = farmDir.filePath(BAKE_FARM_FAILED_SUBDIR + "/" + farmKey + BAKE_FARM_ERRORS_EXTENSION);
+
+    qDebug() << "Waiting for the bake farm to bake" << _assetPath;
+    while (!_wasAborted) {
+        if (QDir(storePath).exists()) {
+            if (copyDirectory(QDir(storePath), QDir(tempOutputDir))) {
+                return true;
+            }
+            errorsOut = "Couldn't copy the bake from the bake farm";
+            return false;
+        }
+
+        QFile errorFile { errorFilePath };
+        if (errorFile.open(QIODevice::ReadOnly)) {
+            errorsOut = errorFile.readAll();
+            errorFile.close();
+            return false;
+        }
+
+        QThread::msleep(BAKE_FARM_POLL_INTERVAL_MSECS);
+    }
+    return false;
 }
 
 void BakeAssetTask::abort() {
@@ -140,5 +233,8 @@ void BakeAssetTask::abort() {
         qDebug() << "Teminating oven process for" << _assetHash;
         _wasAborted = true;
         _ovenProcess->terminate();
+    } else if (!_bakeFarmPath.isEmpty()) {
+        // stops waiting for the farm, the farm still bakes it for the next time
+        _wasAborted = true;
     }
 }
@@ -25,12 +25,19 @@
 class BakeAssetTask : public QObject, public QRunnable {
     Q_OBJECT
 public:
-    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
+    // with a bake farm folder the asset is queued in the farm and its baked output imported from the farm's store
+    BakeAssetTask(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath,
+                  const QString& bakeFarmPath = QString());
 
     // Thread-safe inspection methods
     bool isBaking() { return _isBaking.load(); }
     bool wasAborted() const { return _wasAborted.load(); }
 
+    const AssetUtils::AssetPath& getAssetPath() const { return _assetPath; }
+
+    // when the oven was started, 0 while the task is queued
+    quint64 getBakeStartTime() const { return _bakeStartTime.load(); }
+
     void run() override;
 
 public slots:
@@ -42,10 +49,16 @@ signals:
     void bakeAborted(QString assetHash, QString assetPath);
     
 private:
+    // waits for the farm to bake the asset, true once its output is in tempOutputDir
+    bool waitForFarmBake(const QString& farmKey, const QString& tempOutputDir, QString& errorsOut);
+
+
     std::atomic<bool> _isBaking { false };
+    std::atomic<quint64> _bakeStartTime { 0 };
     AssetUtils::AssetHash _assetHash;
     AssetUtils::AssetPath _assetPath;
     QString _filePath;
+    QString _bakeFarmPath;
     std::unique_ptr<QProcess> _ovenProcess { nullptr };
     std::atomic<bool> _wasAborted { false };
 };
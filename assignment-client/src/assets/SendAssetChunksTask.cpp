@@ -0,0 +1,55 @@
+//
+//  SendAssetChunksTask.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SendAssetChunksTask.h"
+
+#include <DependencyManager.h>
+#include <NLPacketList.h>
+#include <NodeList.h>
+
+#include "AssetServerLogging.h"
+#include "ClientServerUtils.h"
+
+SendAssetChunksTask::SendAssetChunksTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode,
+                                         const QDir& resourcesDir, AssetFileCache& fileCache) :
+    _message(message),
+    _senderNode(sendToNode),
+    _resourcesDir(resourcesDir),
+    _fileCache(fileCache)
+{
+}
+
+void SendAssetChunksTask::run() {
+    MessageID messageID;
+    _message->readPrimitive(&messageID);
+    QByteArray assetHash = _message->read(AssetUtils::SHA256_HASH_LENGTH);
+    QString hexHash = assetHash.toHex();
+
+    auto replyPacketList = NLPacketList::create(PacketType::AssetGetChunksReply, QByteArray(), true, true);
+    replyPacketList->writePrimitive(messageID);
+    replyPacketList->write(assetHash);
+
+    auto file = _fileCache.get(hexHash, _resourcesDir.filePath(hexHash));
+    if (file) {
+        const auto& chunks = file->getChunks();
+        replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
+        replyPacketList->writePrimitive((uint32_t)chunks.size());
+        for (const auto& chunk : chunks) {
+            replyPacketList->writePrimitive((uint32_t)chunk.size);
+            replyPacketList->write(chunk.hash);
+        }
+    } else {
+        qCDebug(asset_server) << "Asset not found: " << hexHash;
+        replyPacketList->writePrimitive(AssetUtils::AssetServerError::AssetNotFound);
+    }
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    nodeList->sendPacketList(std::move(replyPacketList), *_senderNode);
+}
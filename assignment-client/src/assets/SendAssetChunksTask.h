@@ -0,0 +1,38 @@
+//
+//  SendAssetChunksTask.h
+//  assignment-client/src/assets
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SendAssetChunksTask_h
+#define hifi_SendAssetChunksTask_h
+
+#include <QtCore/QDir>
+#include <QtCore/QRunnable>
+#include <QtCore/QSharedPointer>
+
+#include "AssetFileCache.h"
+#include "Node.h"
+#include "ReceivedMessage.h"
+
+// Replies with the content defined chunks of an asset, so that the client only requests the ranges of the
+// chunks it doesn't have.  Listing them hashes the whole file the first time, which is why it is a task.
+class SendAssetChunksTask : public QRunnable {
+public:
+    SendAssetChunksTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                        AssetFileCache& fileCache);
+
+    void run() override;
+
+private:
+    QSharedPointer<ReceivedMessage> _message;
+    SharedNodePointer _senderNode;
+    QDir _resourcesDir;
+    AssetFileCache& _fileCache;
+};
+
+#endif // hifi_SendAssetChunksTask_h
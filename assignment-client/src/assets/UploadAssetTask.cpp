@@ -11,8 +11,12 @@
 
 #include "UploadAssetTask.h"
 
+#include <algorithm>
+
 #include <QtCore/QBuffer>
-#include <QtCore/QFile>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
 
 #include <AssetUtils.h>
 #include <NodeList.h>
@@ -20,12 +24,16 @@
 
 #include "ClientServerUtils.h"
 
+static const uint64_t HASH_CHUNK_SIZE = 1024 * 1024;
+static const uint64_t WRITE_CHUNK_SIZE = 4 * 1024 * 1024;
+
 UploadAssetTask::UploadAssetTask(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode,
-                                 const QDir& resourcesDir, uint64_t filesizeLimit) :
+                                 const QDir& resourcesDir, uint64_t filesizeLimit, AssetFileCache& fileCache) :
     _receivedMessage(receivedMessage),
     _senderNode(senderNode),
     _resourcesDir(resourcesDir),
-    _filesizeLimit(filesizeLimit)
+    _filesizeLimit(filesizeLimit),
+    _fileCache(fileCache)
 {
     
 }
@@ -53,10 +61,18 @@ void UploadAssetTask::run() {
     
     if (fileSize > _filesizeLimit) {
         replyPacket->writePrimitive(AssetUtils::AssetServerError::AssetTooLarge);
+    } else if (buffer.bytesAvailable() < qint64(fileSize)) {
+        qWarning() << "Upload of" << fileSize << "bytes only has" << buffer.bytesAvailable() << "- upload failed.";
+        replyPacket->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
     } else {
-        QByteArray fileData = buffer.read(fileSize);
-        
-        auto hash = AssetUtils::hashData(fileData);
+        // hash and write the file straight from the message, in chunks, rather than from a copy of it
+        const char* fileData = data.constData() + buffer.pos();
+
+        QCryptographicHash hasher { QCryptographicHash::Sha256 };
+        for (uint64_t offset = 0; offset < fileSize; offset += HASH_CHUNK_SIZE) {
+            hasher.addData(fileData + offset, (int)std::min(HASH_CHUNK_SIZE, fileSize - offset));
+        }
+        auto hash = hasher.result();
         auto hexHash = hash.toHex();
 
         if (_senderNode) {
@@ -64,48 +80,44 @@ void UploadAssetTask::run() {
         } else {
             qDebug() << "Hash for uploaded file from" << _receivedMessage->getSenderSockAddr() << "is: (" << hexHash << ")";
         }
-        
-        QFile file { _resourcesDir.filePath(QString(hexHash)) };
 
-        bool existingCorrectFile = false;
-        
-        if (file.exists()) {
-            // check if the local file has the correct contents, otherwise we overwrite
-            if (file.open(QIODevice::ReadOnly) && AssetUtils::hashData(file.readAll()) == hash) {
-                qDebug() << "Not overwriting existing verified file: " << hexHash;
+        QString filePath = _resourcesDir.filePath(QString(hexHash));
+        QFileInfo existingFile { filePath };
 
-                existingCorrectFile = true;
+        // The files are only put in place once they are completely written, under the hash of their contents,
+        // so a file of that name and of the right size has the right contents and isn't hashed again.
+        if (existingFile.exists() && existingFile.size() == qint64(fileSize)) {
+            qDebug() << "Not overwriting existing file: " << hexHash;
 
-                replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
-                replyPacket->write(hash);
-            } else {
-                qDebug() << "Overwriting an existing file whose contents did not match the expected hash: " << hexHash;
-                file.close();
+            replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
+            replyPacket->write(hash);
+        } else {
+            if (existingFile.exists()) {
+                qDebug() << "Overwriting an existing file whose size did not match the upload: " << hexHash;
+            }
+
+            // written to a temporary file which then replaces the one of the hash, if any, at once
+            QSaveFile file { filePath };
+            bool written = file.open(QIODevice::WriteOnly);
+            for (uint64_t offset = 0; written && offset < fileSize; offset += WRITE_CHUNK_SIZE) {
+                qint64 chunkSize = (qint64)std::min(WRITE_CHUNK_SIZE, fileSize - offset);
+                written = file.write(fileData + offset, chunkSize) == chunkSize;
             }
-        }
 
-        if (!existingCorrectFile) {
-            if (file.open(QIODevice::WriteOnly) && file.write(fileData) == qint64(fileSize)) {
+            if (written && file.commit()) {
                 qDebug() << "Wrote file" << hexHash << "to disk. Upload complete";
-                file.close();
+                _fileCache.remove(hexHash);
 
                 replyPacket->writePrimitive(AssetUtils::AssetServerError::NoError);
                 replyPacket->write(hash);
             } else {
+                // the temporary file is removed when the upload fails, the previous file is left as it was
                 qWarning() << "Failed to upload or write to file" << hexHash << " - upload failed.";
+                file.cancelWriting();
 
-                // upload has failed - remove the file and return an error
-                auto removed = file.remove();
-
-                if (!removed) {
-                    qWarning() << "Removal of failed upload file" << hexHash << "failed.";
-                }
-                
                 replyPacket->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
             }
         }
-
-
     }
     
     auto nodeList = DependencyManager::get<NodeList>();
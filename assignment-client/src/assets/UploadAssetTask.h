@@ -19,6 +19,7 @@
 #include <QtCore/QRunnable>
 #include <QtCore/QSharedPointer>
 
+#include "AssetFileCache.h"
 #include "ReceivedMessage.h"
 
 class NLPacketList;
@@ -27,7 +28,7 @@ class Node;
 class UploadAssetTask : public QRunnable {
 public:
     UploadAssetTask(QSharedPointer<ReceivedMessage> message, QSharedPointer<Node> senderNode, 
-                    const QDir& resourcesDir, uint64_t filesizeLimit);
+                    const QDir& resourcesDir, uint64_t filesizeLimit, AssetFileCache& fileCache);
 
     void run() override;
 
@@ -36,6 +37,7 @@ private:
     QSharedPointer<Node> _senderNode;
     QDir _resourcesDir;
     uint64_t _filesizeLimit;
+    AssetFileCache& _fileCache;
 };
 
 #endif // hifi_UploadAssetTask_h
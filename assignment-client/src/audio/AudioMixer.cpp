@@ -26,6 +26,7 @@
 #include <OctreeConstants.h>
 #include <plugins/PluginManager.h>
 #include <plugins/CodecPlugin.h>
+#include <Profile.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
 #include <StDev.h>
@@ -51,6 +52,8 @@ static const QString AUDIO_THREADING_GROUP_KEY = "audio_threading";
 
 int AudioMixer::_numStaticJitterFrames{ DISABLE_STATIC_JITTER_FRAMES };
 float AudioMixer::_noiseMutingThreshold{ DEFAULT_NOISE_MUTING_THRESHOLD };
+bool AudioMixer::_enableHRTFClustering { false };
+int AudioMixer::_encodeBatchSize { 0 };
 float AudioMixer::_attenuationPerDoublingInDistance{ DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE };
 map<QString, shared_ptr<CodecPlugin>> AudioMixer::_availableCodecs{ };
 QStringList AudioMixer::_codecPreferenceOrder{};
@@ -281,6 +284,12 @@ void AudioMixer::sendStatsPacket() {
     statsObject["useDynamicJitterBuffers"] = _numStaticJitterFrames == DISABLE_STATIC_JITTER_FRAMES;
 
     statsObject["threads"] = _slavePool.numThreads();
+    statsObject["work_stealing"] = _slavePool.isWorkStealing();
+    if (_slavePool.isWorkStealing()) {
+        QJsonObject stealStats;
+        _slavePool.stealStats(stealStats);
+        statsObject["work_stealing_slaves"] = stealStats;
+    }
 
     statsObject["trailing_mix_ratio"] = _trailingMixRatio;
     statsObject["throttling_ratio"] = _throttlingRatio;
@@ -291,6 +300,9 @@ void AudioMixer::sendStatsPacket() {
 
     statsObject["silent_packets_per_frame"] = (float)_numSilentPackets / (float)_numStatFrames;
 
+    statsObject["forwarded_regions"] = _regionForwarder.getNumRegions();
+    statsObject["avg_forwarded_streams_per_frame"] = (float)_numForwardedStreams / (float)_numStatFrames;
+
     // timing stats
     QJsonObject timingStats;
 
@@ -322,14 +334,23 @@ void AudioMixer::sendStatsPacket() {
     mixStats["%_hrtf_mixes"] = percentageForMixStats(_stats.hrtfRenders);
     mixStats["%_manual_stereo_mixes"] = percentageForMixStats(_stats.manualStereoMixes);
     mixStats["%_manual_echo_mixes"] = percentageForMixStats(_stats.manualEchoMixes);
+    mixStats["%_ambient_premixed_mixes"] = percentageForMixStats(_stats.ambientPremixedSources);
 
     mixStats["1_hrtf_renders"] = (int)(_stats.hrtfRenders / (float)_numStatFrames);
     mixStats["1_hrtf_resets"] = (int)(_stats.hrtfResets / (float)_numStatFrames);
     mixStats["1_hrtf_updates"] = (int)(_stats.hrtfUpdates / (float)_numStatFrames);
+    mixStats["1_hrtf_clusters"] = (int)(_stats.hrtfClusters / (float)_numStatFrames);
+    mixStats["1_hrtf_clustered_sources"] = (int)(_stats.hrtfClusteredSources / (float)_numStatFrames);
+
+    mixStats["1_ambient_premixes"] = (int)(_stats.ambientPremixes / (float)_numStatFrames);
+    mixStats["1_ambient_premixed_sources"] = (int)(_stats.ambientPremixedSources / (float)_numStatFrames);
+    mixStats["1_manual_ambient_mixes"] = (int)(_stats.manualAmbientMixes / (float)_numStatFrames);
 
     mixStats["2_skipped_streams"] = (int)(_stats.skipped / (float)_numStatFrames);
     mixStats["2_inactive_streams"] = (int)(_stats.inactive / (float)_numStatFrames);
     mixStats["2_active_streams"] = (int)(_stats.active / (float)_numStatFrames);
+    mixStats["2_culled_streams"] = (int)(_stats.culled / (float)_numStatFrames);
+    mixStats["2_evaluated_streams"] = (int)((_stats.skipped + _stats.inactive + _stats.active) / (float)_numStatFrames);
 
     mixStats["3_skippped_to_active"] = (int)(_stats.skippedToActive / (float)_numStatFrames);
     mixStats["3_skippped_to_inactive"] = (int)(_stats.skippedToInactive / (float)_numStatFrames);
@@ -337,13 +358,23 @@ void AudioMixer::sendStatsPacket() {
     mixStats["3_inactive_to_active"] = (int)(_stats.inactiveToActive / (float)_numStatFrames);
     mixStats["3_active_to_skippped"] = (int)(_stats.activeToSkipped / (float)_numStatFrames);
     mixStats["3_active_to_inactive"] = (int)(_stats.activeToInactive / (float)_numStatFrames);
+    mixStats["3_culled_to_inactive"] = (int)(_stats.culledToInactive / (float)_numStatFrames);
+    mixStats["3_inactive_to_culled"] = (int)(_stats.inactiveToCulled / (float)_numStatFrames);
+    mixStats["3_active_to_culled"] = (int)(_stats.activeToCulled / (float)_numStatFrames);
+
+    mixStats["4_tasks_stolen"] = (int)(_stats.tasksStolen / (float)_numStatFrames);
+
+    mixStats["5_silent_mix_hits"] = (int)(_stats.silentMixHits / (float)_numStatFrames);
+    mixStats["5_limiter_skips"] = (int)(_stats.limiterSkips / (float)_numStatFrames);
+    mixStats["5_encode_batches"] = (int)(_stats.encodeBatches / (float)_numStatFrames);
+    mixStats["5_batched_encodes"] = (int)(_stats.batchedEncodes / (float)_numStatFrames);
 
     mixStats["total_mixes"] = _stats.totalMixes;
     mixStats["avg_mixes_per_block"] = _stats.totalMixes / _numStatFrames;
 
     statsObject["mix_stats"] = mixStats;
 
-    _numStatFrames = _numSilentPackets = 0;
+    _numStatFrames = _numSilentPackets = _numForwardedStreams = 0;
     _stats.reset();
 
     // add stats for each listerner
@@ -428,10 +459,12 @@ void AudioMixer::start() {
         }
 
         auto frameTimer = _frameTiming.timer();
+        PROFILE_RANGE(mixer, "AudioMixer::frame");
 
         // process (node-isolated) audio packets across slave threads
         {
             auto packetsTimer = _packetsTiming.timer();
+            PROFILE_RANGE(mixer, "processPackets");
 
             // first clear the concurrent vector of added streams that the slaves will add to when they process packets
             _workerSharedData.addedStreams.clear();
@@ -444,6 +477,7 @@ void AudioMixer::start() {
         // process queued events (networking, global audio packets, &c.)
         {
             auto eventsTimer = _eventsTiming.timer();
+            PROFILE_RANGE(mixer, "processEvents");
 
             // clear removed nodes and removed streams before we process events that will setup the new set
             _workerSharedData.removedNodes.clear();
@@ -461,9 +495,26 @@ void AudioMixer::start() {
         nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
             // mix across slave threads
             auto mixTimer = _mixTiming.timer();
+            PROFILE_RANGE(mixer, "mix");
+
+            // bucket all streams once, so each listener only evaluates those within its audible radius
+            _workerSharedData.streamGrid.rebuild(cbegin, cend);
+
+            // mix the ambient injectors once, for all the listeners of their zones
+            _workerSharedData.ambientPremix.rebuild(cbegin, cend);
+
             _slavePool.mix(cbegin, cend, frame, numToRetain);
         });
 
+        // send the downmix of the forwarded regions to the downstream mixers
+        if (_regionForwarder.isEnabled()) {
+            PROFILE_RANGE(mixer, "forwardRegions");
+            nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+                _regionForwarder.forward(cbegin, cend);
+            });
+            _numForwardedStreams += _regionForwarder.getNumForwardedStreams();
+        }
+
         // gather stats
         _slavePool.each([&](AudioMixerSlave& slave) {
             _stats.accumulate(slave.stats);
@@ -549,10 +600,14 @@ void AudioMixer::clearDomainSettings() {
     _numStaticJitterFrames = DISABLE_STATIC_JITTER_FRAMES;
     _attenuationPerDoublingInDistance = DEFAULT_ATTENUATION_PER_DOUBLING_IN_DISTANCE;
     _noiseMutingThreshold = DEFAULT_NOISE_MUTING_THRESHOLD;
+    _enableHRTFClustering = false;
+    _encodeBatchSize = 0;
+    _workerSharedData.streamGrid.setAudibleRadius(0.0f);
     _codecPreferenceOrder.clear();
     _audioZones.clear();
     _zoneSettings.clear();
     _zoneReverbSettings.clear();
+    _regionForwarder.clearRegions();
 }
 
 void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
@@ -571,6 +626,30 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
             }
         }
 
+        const QString WORK_STEALING = "work_stealing";
+        bool workStealing = audioThreadingGroupObject[WORK_STEALING].toBool();
+        _slavePool.setWorkStealing(workStealing);
+        qCDebug(audio) << "Work stealing:" << (workStealing ? "enabled" : "disabled");
+
+        const QString RECEIVE_WORKERS = "receive_workers";
+        if (audioThreadingGroupObject[RECEIVE_WORKERS].isString()) {
+            bool ok = false;
+            int numReceiveWorkers = audioThreadingGroupObject[RECEIVE_WORKERS].toString().toInt(&ok);
+            if (ok) {
+                DependencyManager::get<NodeList>()->setNumReceiveWorkers(numReceiveWorkers);
+            }
+        }
+
+        const QString ENCODE_BATCH_SIZE = "encode_batch_size";
+        if (audioThreadingGroupObject[ENCODE_BATCH_SIZE].isString()) {
+            bool ok = false;
+            int encodeBatchSize = audioThreadingGroupObject[ENCODE_BATCH_SIZE].toString().toInt(&ok);
+            if (ok) {
+                _encodeBatchSize = max(encodeBatchSize, 0);
+                qCDebug(audio) << "Encode batch size changed to" << _encodeBatchSize;
+            }
+        }
+
         const QString THROTTLE_START_KEY = "throttle_start";
         const QString THROTTLE_BACKOFF_KEY = "throttle_backoff";
 
@@ -684,6 +763,20 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
             }
         }
 
+        const QString HRTF_CLUSTERING = "hrtf_clustering";
+        _enableHRTFClustering = audioEnvGroupObject[HRTF_CLUSTERING].toBool();
+        qCDebug(audio) << "HRTF clustering:" << (_enableHRTFClustering ? "enabled" : "disabled");
+
+        const QString AUDIBLE_RADIUS = "audible_radius";
+        if (audioEnvGroupObject[AUDIBLE_RADIUS].isString()) {
+            bool ok = false;
+            float audibleRadius = audioEnvGroupObject[AUDIBLE_RADIUS].toString().toFloat(&ok);
+            if (ok) {
+                _workerSharedData.streamGrid.setAudibleRadius(audibleRadius);
+                qCDebug(audio) << "Audible radius changed to" << audibleRadius;
+            }
+        }
+
         const QString AUDIO_ZONES = "zones";
         if (audioEnvGroupObject[AUDIO_ZONES].isObject()) {
             const QJsonObject& zones = audioEnvGroupObject[AUDIO_ZONES].toObject();
@@ -804,6 +897,24 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
                 }
             }
         }
+
+        const QString REGION_FORWARDING = "region_forwarding";
+        if (audioEnvGroupObject[REGION_FORWARDING].isArray()) {
+            const QJsonArray& regions = audioEnvGroupObject[REGION_FORWARDING].toArray();
+
+            const QString ZONE = "zone";
+            for (int i = 0; i < regions.count(); ++i) {
+                QString zoneName = regions[i].toObject().value(ZONE).toString();
+                auto itZone = find_if(begin(_audioZones), end(_audioZones), [&](const ZoneDescription& description) {
+                    return description.name == zoneName;
+                });
+
+                if (itZone != end(_audioZones)) {
+                    _regionForwarder.addRegion(itZone->name, itZone->area);
+                    qCDebug(audio) << "Added Forwarded Region:" << itZone->name;
+                }
+            }
+        }
     }
 }
 
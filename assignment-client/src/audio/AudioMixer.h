@@ -20,6 +20,7 @@
 
 #include <plugins/Forward.h>
 
+#include "AudioMixerRegionForwarder.h"
 #include "AudioMixerStats.h"
 #include "AudioMixerSlavePool.h"
 
@@ -53,6 +54,8 @@ public:
     static int getStaticJitterFrames() { return _numStaticJitterFrames; }
     static bool shouldMute(float quietestFrame) { return quietestFrame > _noiseMutingThreshold; }
     static float getAttenuationPerDoublingInDistance() { return _attenuationPerDoublingInDistance; }
+    static bool shouldClusterHRTFs() { return _enableHRTFClustering; }
+    static int getEncodeBatchSize() { return _encodeBatchSize; }
     static const std::vector<ZoneDescription>& getAudioZones() { return _audioZones; }
     static const std::vector<ZoneSettings>& getZoneSettings() { return _zoneSettings; }
     static const std::vector<ReverbSettings>& getReverbSettings() { return _zoneReverbSettings; }
@@ -101,6 +104,7 @@ private:
     float _throttlingRatio { 0.0f };
 
     int _numSilentPackets { 0 };
+    int _numForwardedStreams { 0 };
 
     int _numStatFrames { 0 };
     AudioMixerStats _stats;
@@ -141,6 +145,8 @@ private:
     static int _numStaticJitterFrames; // -1 denotes dynamic jitter buffering
     static float _noiseMutingThreshold;
     static float _attenuationPerDoublingInDistance;
+    static bool _enableHRTFClustering;
+    static int _encodeBatchSize; // 0 encodes each mix as soon as it is ready
     static std::map<QString, CodecPluginPointer> _availableCodecs;
     static QStringList _codecPreferenceOrder;
 
@@ -152,6 +158,7 @@ private:
     float _throttleBackoffTarget = 0.44f;
 
     AudioMixerSlave::SharedData _workerSharedData;
+    AudioMixerRegionForwarder _regionForwarder;
 };
 
 #endif // hifi_AudioMixer_h
@@ -0,0 +1,89 @@
+//
+//  AudioMixerAmbientPremix.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerAmbientPremix.h"
+
+#include <algorithm>
+
+#include <InjectedAudioStream.h>
+
+#include "AudioMixer.h"
+#include "AudioMixerClientData.h"
+
+int AudioMixerAmbientPremix::findZone(const glm::vec3& position) {
+    auto& audioZones = AudioMixer::getAudioZones();
+    for (int i = 0; i < (int)audioZones.size(); ++i) {
+        if (audioZones[i].area.contains(position)) {
+            return i;
+        }
+    }
+    return NO_ZONE;
+}
+
+bool AudioMixerAmbientPremix::isPremixed(const PositionalAudioStream& stream) {
+    return stream.isAmbient() && stream.getType() == PositionalAudioStream::Injector &&
+           stream.lastPopSucceeded() && stream.getLastPopOutputLoudness() > 0.0f;
+}
+
+void AudioMixerAmbientPremix::rebuild(ConstIter begin, ConstIter end) {
+    _premixes.resize(AudioMixer::getAudioZones().size() + 1);
+    for (auto& premix : _premixes) {
+        premix.numStreams = 0;
+    }
+    _numStreams = 0;
+
+    int16_t streamSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        AudioMixerClientData* nodeData = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (!nodeData) {
+            return;
+        }
+
+        for (auto& stream : nodeData->getAudioStreams()) {
+            if (!isPremixed(*stream)) {
+                continue;
+            }
+
+            Premix& premix = _premixes[findZone(stream->getPosition()) + 1];
+            if (premix.numStreams == 0) {
+                memset(premix.samples, 0, sizeof(premix.samples));
+            }
+            ++premix.numStreams;
+            ++_numStreams;
+
+            // the same int16_t to float conversion as the HRTF mixes
+            float gain = static_cast<const InjectedAudioStream*>(stream.get())->getAttenuationRatio() * (1 / 32768.0f);
+            const int NUM_FRAMES = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+            AudioRingBuffer::ConstIterator streamPopOutput = stream->getLastPopOutput();
+            if (stream->isStereo()) {
+                streamPopOutput.readSamples(streamSamples, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
+                for (int i = 0; i < 2 * NUM_FRAMES; ++i) {
+                    premix.samples[i] += gain * (float)streamSamples[i];
+                }
+            } else {
+                streamPopOutput.readSamples(streamSamples, NUM_FRAMES);
+                for (int i = 0; i < NUM_FRAMES; ++i) {
+                    float sample = gain * (float)streamSamples[i];
+                    premix.samples[2 * i] += sample;
+                    premix.samples[2 * i + 1] += sample;
+                }
+            }
+        }
+    });
+}
+
+const AudioMixerAmbientPremix::Premix* AudioMixerAmbientPremix::getPremix(int zone) const {
+    int index = zone + 1;
+    if (index < 0 || index >= (int)_premixes.size() || _premixes[index].numStreams == 0) {
+        return nullptr;
+    }
+    return &_premixes[index];
+}
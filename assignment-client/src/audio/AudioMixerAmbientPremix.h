@@ -0,0 +1,59 @@
+//
+//  AudioMixerAmbientPremix.h
+//  assignment-client/src/audio
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerAmbientPremix_h
+#define hifi_AudioMixerAmbientPremix_h
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <AudioConstants.h>
+#include <NodeList.h>
+
+class PositionalAudioStream;
+
+// The ambient injectors of each audio zone, mixed once per mix frame.
+//   Ambient injectors are not spatialized nor attenuated with distance, so every listener of a zone hears the same
+//   mix of them, which it adds with its master injector gain instead of mixing each injector again.
+//   Injectors outside of every zone are heard by everyone, and are mixed in a premix of their own.
+//   The premixes are written by the mixer thread only while the slaves are idle, and are read-only during a mix.
+class AudioMixerAmbientPremix {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    static const int NO_ZONE = -1;
+
+    struct Premix {
+        float samples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+        int numStreams { 0 };
+    };
+
+    // the audio zone whose ambient injectors are heard at position, NO_ZONE if it is outside of all of them
+    static int findZone(const glm::vec3& position);
+
+    // whether the stream is in a premix this frame (silent streams are left out, they add nothing to it)
+    static bool isPremixed(const PositionalAudioStream& stream);
+
+    // mix the ambient injectors of the given nodes
+    void rebuild(ConstIter begin, ConstIter end);
+
+    // the premix of a zone, nullptr if none of its ambient injectors are playing
+    const Premix* getPremix(int zone) const;
+
+    int getNumStreams() const { return _numStreams; }
+
+private:
+    // indexed by zone + 1, so that NO_ZONE is the first one
+    std::vector<Premix> _premixes;
+    int _numStreams { 0 };
+};
+
+#endif // hifi_AudioMixerAmbientPremix_h
@@ -81,6 +81,13 @@ int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
             }
             case PacketType::AudioStreamStats: {
                 parseData(*packet);
+
+                // the listener reports the loss of its mix, the encoder of the mix adapts to it
+                if (_encoder) {
+                    int rttMsecs = node->getConnectionStats().rtt / (int)USECS_PER_MSEC;
+                    _encoder->setNetworkConditions(_downstreamAudioStreamStats._packetStreamWindowStats.getLostRate(),
+                                                   rttMsecs);
+                }
                 break;
             }
             case PacketType::NegotiateAudioFormat:
@@ -13,6 +13,7 @@
 #define hifi_AudioMixerClientData_h
 
 #include <queue>
+#include <unordered_map>
 
 #include <tbb/concurrent_vector.h>
 
@@ -89,6 +90,9 @@ public:
 
     AudioLimiter audioLimiter;
 
+    // consecutive frames in which nothing was mixed for this listener
+    int numSilentMixFrames { 0 };
+
     void setupCodec(CodecPluginPointer codec, const QString& codecName);
     void cleanupCodec();
     void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) {
@@ -101,6 +105,11 @@ public:
         _shouldFlushEncoder = true;
     }
     void encodeFrameOfZeros(QByteArray& encodedZeros);
+
+    // for batched encoding, which encodes outside of encode() and must then mark the encoder as needing a flush
+    const CodecPluginPointer& getCodec() const { return _codec; }
+    Encoder* getEncoder() const { return _encoder; }
+    void setShouldFlushEncoder() { _shouldFlushEncoder = true; }
     bool shouldFlushEncoder() { return _shouldFlushEncoder; }
 
     QString getCodecName() { return _selectedCodecName; }
@@ -132,6 +141,7 @@ public:
         MixableStreamsVector active;
         MixableStreamsVector inactive;
         MixableStreamsVector skipped;
+        MixableStreamsVector culled; // outside of the audible radius, only re-evaluated periodically
     };
 
     Streams& getStreams() { return _streams; }
@@ -159,6 +169,16 @@ public:
     bool getHasReceivedFirstMix() const { return _hasReceivedFirstMix; }
     void setHasReceivedFirstMix(bool hasReceivedFirstMix) { _hasReceivedFirstMix = hasReceivedFirstMix; }
 
+    // shared HRTF state for clusters of co-located sources, keyed by cluster (see AudioMixerSlave::renderClusters)
+    struct ClusterHRTF {
+        std::unique_ptr<AudioHRTF> hrtf { new AudioHRTF };
+        float azimuth { 0.0f };
+        float distance { 0.0f };
+        unsigned int lastFrame { 0 };
+    };
+    using ClusterHRTFs = std::unordered_map<int, ClusterHRTF>;
+    ClusterHRTFs& getClusterHRTFs() { return _clusterHRTFs; }
+
     // end of methods called non-concurrently from single AudioMixerSlave
 
 signals:
@@ -183,6 +203,7 @@ private:
     bool containsValidPosition(ReceivedMessage& message) const;
 
     Streams _streams;
+    ClusterHRTFs _clusterHRTFs;
 
     quint16 _outgoingMixedAudioSequenceNumber;
 
@@ -0,0 +1,153 @@
+//
+//  AudioMixerRegionForwarder.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerRegionForwarder.h"
+
+#include <algorithm>
+
+#include <AudioHRTF.h>
+#include <AudioHelpers.h>
+#include <InjectedAudioStream.h>
+#include <udt/PacketHeaders.h>
+
+#include "AudioMixer.h"
+#include "AudioMixerClientData.h"
+
+// the distance attenuation of the mix, without the zone-specific coefficients
+static float computeDistanceGain(float distance) {
+    float attenuationPerDoublingInDistance = AudioMixer::getAttenuationPerDoublingInDistance();
+    if (attenuationPerDoublingInDistance < 0.0f) {
+        const float MIN_DISTANCE_LIMIT = ATTN_DISTANCE_REF + 1.0f;
+        float distanceLimit = std::max(-attenuationPerDoublingInDistance, MIN_DISTANCE_LIMIT);
+        float d = distance - ATTN_DISTANCE_REF;
+        return std::min(std::max(1.0f - d / (distanceLimit - ATTN_DISTANCE_REF), 0.0f), ATTN_GAIN_MAX);
+    } else if (attenuationPerDoublingInDistance < 1.0f) {
+        const float MIN_ATTENUATION_COEFFICIENT = 0.001f;
+        float g = glm::clamp(1.0f - attenuationPerDoublingInDistance, MIN_ATTENUATION_COEFFICIENT, 1.0f);
+        float d = (1.0f / ATTN_DISTANCE_REF) * std::max(distance, HRTF_NEARFIELD_MIN);
+        return std::min(fastExp2f(fastLog2f(g) * fastLog2f(d)), ATTN_GAIN_MAX);
+    }
+    return 0.0f;
+}
+
+void AudioMixerRegionForwarder::addRegion(const QString& name, const AABox& area) {
+    Region region;
+    region.name = name;
+    region.area = area;
+    region.nodeID = QUuid::createUuid();
+    region.streamID = QUuid::createUuid();
+    _regions.push_back(region);
+}
+
+void AudioMixerRegionForwarder::forward(ConstIter begin, ConstIter end) {
+    _numForwardedStreams = 0;
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::vector<SharedNodePointer> downstreamMixers;
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        if (node->getType() == NodeType::DownstreamAudioMixer && node->getActiveSocket()) {
+            downstreamMixers.push_back(node);
+        }
+    });
+    if (downstreamMixers.empty()) {
+        return;
+    }
+
+    const int NUM_SAMPLES = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+    for (auto& region : _regions) {
+        glm::vec3 center = region.area.calcCenter();
+        std::fill(_mixSamples, _mixSamples + NUM_SAMPLES, 0.0f);
+        bool hasAudio = false;
+
+        std::for_each(begin, end, [&](const SharedNodePointer& node) {
+            AudioMixerClientData* nodeData = static_cast<AudioMixerClientData*>(node->getLinkedData());
+            if (!nodeData || node->isUpstream()) {
+                return;
+            }
+
+            for (auto& stream : nodeData->getAudioStreams()) {
+                if (!stream->lastPopSucceeded() || stream->getLastPopOutputLoudness() == 0.0f ||
+                    !region.area.contains(stream->getPosition())) {
+                    continue;
+                }
+
+                float gain = computeDistanceGain(glm::length(stream->getPosition() - center));
+                if (stream->getType() == PositionalAudioStream::Injector) {
+                    gain *= static_cast<const InjectedAudioStream*>(stream.get())->getAttenuationRatio();
+                }
+                if (gain == 0.0f) {
+                    continue;
+                }
+
+                // the downmix is mono, fold stereo streams
+                const float SCALE = gain / AudioConstants::MAX_SAMPLE_VALUE;
+                if (stream->isStereo()) {
+                    stream->getLastPopOutput().readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
+                    for (int i = 0; i < NUM_SAMPLES; i++) {
+                        _mixSamples[i] += 0.5f * SCALE * (float)(_bufferSamples[2 * i] + _bufferSamples[2 * i + 1]);
+                    }
+                } else {
+                    stream->getLastPopOutput().readSamples(_bufferSamples, NUM_SAMPLES);
+                    for (int i = 0; i < NUM_SAMPLES; i++) {
+                        _mixSamples[i] += SCALE * (float)_bufferSamples[i];
+                    }
+                }
+                hasAudio = true;
+                ++_numForwardedStreams;
+            }
+        });
+
+        // a silent region sends nothing, its injector on the downstream mixers starves like any finished one
+        if (hasAudio) {
+            sendRegion(region, downstreamMixers);
+        }
+    }
+}
+
+void AudioMixerRegionForwarder::sendRegion(Region& region, const std::vector<SharedNodePointer>& downstreamMixers) {
+    const int NUM_SAMPLES = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL;
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        _bufferSamples[i] = (int16_t)glm::clamp(roundf(_mixSamples[i] * AudioConstants::MAX_SAMPLE_VALUE),
+                                                (float)AudioConstants::MIN_SAMPLE_VALUE,
+                                                (float)AudioConstants::MAX_SAMPLE_VALUE);
+    }
+
+    // the same layout as the packets of an AudioInjector, behind the ID of the replicated node
+    auto packet = NLPacket::create(PacketType::ReplicatedInjectAudio);
+    packet->write(region.nodeID.toRfc4122());
+    packet->writePrimitive(region.sequence++);
+    packet->writeString(QString());
+    packet->write(region.streamID.toRfc4122());
+    packet->writePrimitive(false); // isStereo
+    packet->writePrimitive((uchar)0); // loopback
+
+    glm::vec3 center = region.area.calcCenter();
+    glm::quat orientation;
+    glm::vec3 boxCorner(0.0f);
+    packet->writePrimitive(center);
+    packet->writePrimitive(orientation);
+    packet->writePrimitive(center);
+    packet->writePrimitive(boxCorner);
+
+    float radius = 0.0f;
+    packet->writePrimitive(radius);
+    packet->writePrimitive(packFloatGainToByte(1.0f));
+    packet->writePrimitive(false); // ignorePenumbra
+    packet->writePrimitive(false); // ambient
+
+    packet->write(reinterpret_cast<const char*>(_bufferSamples), NUM_SAMPLES * sizeof(int16_t));
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    for (auto& downstreamMixer : downstreamMixers) {
+        nodeList->sendUnreliablePacket(*packet, *downstreamMixer);
+    }
+}
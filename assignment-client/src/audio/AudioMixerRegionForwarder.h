@@ -0,0 +1,60 @@
+//
+//  AudioMixerRegionForwarder.h
+//  assignment-client/src/audio
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerRegionForwarder_h
+#define hifi_AudioMixerRegionForwarder_h
+
+#include <vector>
+
+#include <QtCore/QUuid>
+
+#include <AABox.h>
+#include <AudioConstants.h>
+#include <NodeList.h>
+
+// Lets a domain's audio be split across several mixers by region.
+//   Each forwarded region is an audio zone whose local streams are downmixed once per frame, as heard from the
+//   center of the zone, and sent to the downstream audio mixers as a single mono injector placed at that center.
+//   The downstream mixers take it as any other replicated stream, so their listeners hear the crowd of the
+//   region as one pre-attenuated source instead of each of its streams.
+//   Streams of upstream nodes are never part of the downmix, so two mixers forwarding to each other don't echo.
+//   Only used by the mixer thread, while the slaves are idle.
+class AudioMixerRegionForwarder {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    void clearRegions() { _regions.clear(); }
+    void addRegion(const QString& name, const AABox& area);
+    bool isEnabled() const { return !_regions.empty(); }
+
+    // downmix the last popped frame of the streams of the given nodes and send it downstream
+    void forward(ConstIter begin, ConstIter end);
+
+    int getNumRegions() const { return (int)_regions.size(); }
+    int getNumForwardedStreams() const { return _numForwardedStreams; }
+
+private:
+    struct Region {
+        QString name;
+        AABox area;
+        QUuid nodeID; // the replicated node the downstream mixers will create for this region
+        QUuid streamID;
+        quint16 sequence { 0 };
+    };
+
+    void sendRegion(Region& region, const std::vector<SharedNodePointer>& downstreamMixers);
+
+    std::vector<Region> _regions;
+    float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+    int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    int _numForwardedStreams { 0 };
+};
+
+#endif // hifi_AudioMixerRegionForwarder_h
@@ -54,6 +54,9 @@ inline float computeGain(float masterAvatarGain, float masterInjectorGain, const
         const PositionalAudioStream& streamToAdd, const glm::vec3& relativePosition, float distance);
 inline float computeAzimuth(const AvatarAudioStream& listeningNodeStream, const PositionalAudioStream& streamToAdd,
         const glm::vec3& relativePosition);
+inline int computeClusterKey(float azimuth, float distance);
+
+static const int HRTF_DATASET_INDEX = 1;
 
 void AudioMixerSlave::processPackets(const SharedNodePointer& node) {
     AudioMixerClientData* data = (AudioMixerClientData*)node->getLinkedData();
@@ -100,7 +103,10 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
         bool mixHasAudio = prepareMix(node);
 
         // send audio packet
-        if (mixHasAudio || data->shouldFlushEncoder()) {
+        if (mixHasAudio && AudioMixer::getEncodeBatchSize() > 0) {
+            // encode and send along with the other mixes of this batch
+            queueEncode(node, *data);
+        } else if (mixHasAudio || data->shouldFlushEncoder()) {
             QByteArray encodedBuffer;
             if (mixHasAudio) {
                 // encode the audio
@@ -128,6 +134,75 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
     }
 }
 
+void AudioMixerSlave::finishMix() {
+    flushEncodes();
+}
+
+void AudioMixerSlave::queueEncode(const SharedNodePointer& node, AudioMixerClientData& data) {
+    QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
+    _pendingEncodes.push_back({ node, &data, decodedBuffer });
+
+    if ((int)_pendingEncodes.size() >= AudioMixer::getEncodeBatchSize()) {
+        flushEncodes();
+    }
+}
+
+void AudioMixerSlave::flushEncodes() {
+    if (_pendingEncodes.empty()) {
+        return;
+    }
+
+    // group the mixes by codec, so that each plugin is handed all of its encoders at once
+    std::stable_sort(_pendingEncodes.begin(), _pendingEncodes.end(), [](const PendingEncode& a, const PendingEncode& b) {
+        return a.data->getCodec().get() < b.data->getCodec().get();
+    });
+
+    auto groupBegin = _pendingEncodes.begin();
+    while (groupBegin != _pendingEncodes.end()) {
+        CodecPlugin* codec = groupBegin->data->getCodec().get();
+        auto groupEnd = std::find_if(groupBegin, _pendingEncodes.end(), [&](const PendingEncode& pending) {
+            return pending.data->getCodec().get() != codec;
+        });
+
+        _batchEncoders.clear();
+        _batchDecodedBuffers.clear();
+        std::for_each(groupBegin, groupEnd, [&](const PendingEncode& pending) {
+            _batchEncoders.push_back(pending.data->getEncoder());
+            _batchDecodedBuffers.push_back(pending.decodedBuffer);
+        });
+        int numBuffers = (int)_batchEncoders.size();
+        _batchEncodedBuffers.resize(numBuffers);
+
+        bool hasEncoders = std::none_of(_batchEncoders.begin(), _batchEncoders.end(), [](Encoder* encoder) {
+            return encoder == nullptr;
+        });
+        if (codec && hasEncoders) {
+            codec->encodeBatch(_batchEncoders.data(), _batchDecodedBuffers.data(), _batchEncodedBuffers.data(), numBuffers);
+            ++stats.encodeBatches;
+        } else {
+            // no codec negotiated (or being set up), which sends the raw mix like encode() does
+            for (int i = 0; i < numBuffers; ++i) {
+                groupBegin[i].data->encode(_batchDecodedBuffers[i], _batchEncodedBuffers[i]);
+            }
+        }
+
+        for (int i = 0; i < numBuffers; ++i) {
+            PendingEncode& pending = groupBegin[i];
+
+            // once you have encoded, you need to flush eventually.
+            pending.data->setShouldFlushEncoder();
+            sendMixPacket(pending.node, *pending.data, _batchEncodedBuffers[i]);
+        }
+        stats.batchedEncodes += numBuffers;
+
+        groupBegin = groupEnd;
+    }
+
+    _pendingEncodes.clear();
+    _batchDecodedBuffers.clear();
+    _batchEncodedBuffers.clear();
+}
+
 
 template <class Container, class Predicate>
 void erase_if(Container& cont, Predicate&& pred) {
@@ -239,6 +314,10 @@ bool shouldBeInactive(MixableStream& stream) {
             stream.positionalStream->getLastPopOutputLoudness() == 0.0f);
 };
 
+bool shouldBeCulled(const MixableStream& stream, const AudioMixerStreamGrid::StreamSet& audibleStreams) {
+    return audibleStreams.find(stream.positionalStream) == audibleStreams.end();
+};
+
 bool shouldBeSkipped(MixableStream& stream, const Node& listener,
                      const AvatarAudioStream& listenerAudioStream,
                      const AudioMixerClientData& listenerData) {
@@ -295,6 +374,12 @@ float approximateVolume(const MixableStream& stream, const AvatarAudioStream* li
         return 1.0f;
     }
 
+    // ambient injectors are heard at their own volume wherever the listener is
+    if (stream.positionalStream->isAmbient()) {
+        return stream.positionalStream->getLastPopOutputTrailingLoudness() *
+               reinterpret_cast<const InjectedAudioStream*>(stream.positionalStream)->getAttenuationRatio();
+    }
+
     // approximate the gain
     float gain = approximateGain(*listenerAudioStream, *(stream.positionalStream));
 
@@ -306,19 +391,67 @@ float approximateVolume(const MixableStream& stream, const AvatarAudioStream* li
     return stream.positionalStream->getLastPopOutputTrailingLoudness() * gain;
 };
 
+void AudioMixerSlave::cullStreams(const Node& listener, AudioMixerClientData& listenerData, bool isCulling) {
+    auto& streams = listenerData.getStreams();
+    AvatarAudioStream* listenerAudioStream = listenerData.getAvatarAudioStream();
+
+    if (!isCulling) {
+        // culling was disabled, or the listener is soloing: everything is evaluated again
+        for (auto& stream : streams.culled) {
+            streams.inactive.push_back(move(stream));
+        }
+        streams.culled.clear();
+        return;
+    }
+
+    _audibleStreams.clear();
+    _sharedData.streamGrid.findAudibleStreams(listenerAudioStream->getPosition(), _audibleStreams);
+
+    // the culled bucket is only walked when it might have changed, which keeps far streams off the per-frame path
+    //   - streams have been removed, so we cannot keep dangling entries
+    //   - ignores have been staged, which must be applied to every stream this frame
+    //   - periodically (staggered across listeners), to pick up streams that came into range
+    const unsigned int CULLED_RECHECK_FRAMES = 5;
+    bool hasRemovals = !_sharedData.removedNodes.empty() || !_sharedData.removedStreams.empty();
+    bool hasStagedIgnores = !listenerData.getNewIgnoredNodeIDs().empty() || !listenerData.getNewUnignoredNodeIDs().empty() ||
+                            !listenerData.getNewIgnoringNodeIDs().empty() || !listenerData.getNewUnignoringNodeIDs().empty();
+    bool isRecheckFrame = (_frame + listener.getLocalID()) % CULLED_RECHECK_FRAMES == 0;
+
+    if (hasRemovals || hasStagedIgnores || isRecheckFrame) {
+        erase_if(streams.culled, [&](MixableStream& stream) {
+            if (shouldBeRemoved(stream, _sharedData)) {
+                return true;
+            }
+
+            // keeps the ignore flags current
+            shouldBeSkipped(stream, listener, *listenerAudioStream, listenerData);
+
+            if (isRecheckFrame && !shouldBeCulled(stream, _audibleStreams)) {
+                streams.inactive.push_back(move(stream));
+                ++stats.culledToInactive;
+                return true;
+            }
+            return false;
+        });
+    }
+}
+
 bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     AvatarAudioStream* listenerAudioStream = static_cast<AudioMixerClientData*>(listener->getLinkedData())->getAvatarAudioStream();
     AudioMixerClientData* listenerData = static_cast<AudioMixerClientData*>(listener->getLinkedData());
 
-    // zero out the mix for this listener
-    memset(_mixSamples, 0, sizeof(_mixSamples));
+    // the mix is zeroed by the first stream added to it
+    _hasMixInputs = false;
 
     bool isThrottling = _numToRetain != -1;
     bool isSoloing = !listenerData->getSoloedNodes().empty();
 
+    bool isCulling = _sharedData.streamGrid.isEnabled() && !isSoloing;
+
     auto& streams = listenerData->getStreams();
 
     addStreams(*listener, *listenerData);
+    cullStreams(*listener, *listenerData, isCulling);
 
     // Process skipped streams
     erase_if(streams.skipped, [&](MixableStream& stream) {
@@ -356,6 +489,12 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
+        if (isCulling && shouldBeCulled(stream, _audibleStreams)) {
+            streams.culled.push_back(move(stream));
+            ++stats.inactiveToCulled;
+            return true;
+        }
+
         if (!shouldBeInactive(stream)) {
             streams.active.push_back(move(stream));
             ++stats.inactiveToActive;
@@ -375,6 +514,14 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
+        if (isCulling && shouldBeCulled(stream, _audibleStreams)) {
+            // reset the HRTF state, as we do for throttled streams, so the tail is not replayed when it comes back
+            resetHRTFState(stream);
+            streams.culled.push_back(move(stream));
+            ++stats.activeToCulled;
+            return true;
+        }
+
         if (isThrottling) {
             // we're throttling, so we need to update the approximate volume for any un-skipped streams
             // unless this is simply for an echo (in which case the approx volume is 1.0)
@@ -460,9 +607,16 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
         });
     }
 
+    // render the deferred, co-located sources with shared HRTFs
+    renderClusters(*listenerData);
+
+    // add the ambient injectors, as the premixes of their zones where possible
+    mixAmbientSources(*listenerAudioStream, listenerData->getMasterInjectorGain());
+
     stats.skipped += (int)streams.skipped.size();
     stats.inactive += (int)streams.inactive.size();
     stats.active += (int)streams.active.size();
+    stats.culled += (int)streams.culled.size();
 
     // clear the newly ignored, un-ignored, ignoring, and un-ignoring streams now that we've processed them
     listenerData->clearStagedIgnoreChanges();
@@ -473,6 +627,24 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     stats.mixTime += mixTime.count();
 #endif
 
+    if (!_hasMixInputs) {
+        // nothing was mixed, so the mix is known to be silent without scanning it
+        ++stats.silentMixHits;
+
+        // keep the limiter running until its envelope and delay line have settled on silence,
+        // after which rendering more silence through it is a no-op
+        const int LIMITER_SETTLE_FRAMES = (int)ceil(AudioConstants::NETWORK_FRAMES_PER_SEC);
+        if (listenerData->numSilentMixFrames < LIMITER_SETTLE_FRAMES) {
+            ++listenerData->numSilentMixFrames;
+            memset(_mixSamples, 0, sizeof(_mixSamples));
+            listenerData->audioLimiter.render(_mixSamples, _bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        } else {
+            ++stats.limiterSkips;
+        }
+        return false;
+    }
+    listenerData->numSilentMixFrames = 0;
+
     // check for silent audio before limiting
     // limiting uses a dither and can only guarantee abs(sample) <= 1
     bool hasAudio = false;
@@ -498,6 +670,17 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
 
     auto streamToAdd = mixableStream.positionalStream;
 
+    if (streamToAdd->isAmbient() && streamToAdd->getType() == PositionalAudioStream::Injector) {
+        // deferred to the premix of its zone, an injector that is not playing (or is faded out) adds nothing
+        if (masterInjectorGain > 0.0f && AudioMixerAmbientPremix::isPremixed(*streamToAdd)) {
+            _ambientSources.push_back({ streamToAdd, mixableStream.hrtf.get(),
+                                        AudioMixerAmbientPremix::findZone(streamToAdd->getPosition()) });
+        }
+        return;
+    }
+
+    beginMixInput();
+
     // check if this is a server echo of a source back to itself
     bool isEcho = (streamToAdd == &listeningNodeStream);
 
@@ -510,8 +693,6 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
                                                    relativePosition, distance));
     float azimuth = isEcho ? 0.0f : computeAzimuth(listeningNodeStream, listeningNodeStream, relativePosition);
 
-    const int HRTF_DATASET_INDEX = 1;
-
     if (!streamToAdd->lastPopSucceeded()) {
         bool forceSilentBlock = true;
 
@@ -565,6 +746,18 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
         mixableStream.hrtf->mixMono(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         ++stats.manualEchoMixes;
+    } else if (AudioMixer::shouldClusterHRTFs() && distance > HRTF_NEARFIELD_MAX) {
+
+        // defer the render, co-located sources will share a single HRTF pass (see renderClusters)
+        _clusterSources.emplace_back();
+        ClusterSource& source = _clusterSources.back();
+        source.key = computeClusterKey(azimuth, distance);
+        source.azimuth = azimuth;
+        source.distance = distance;
+        source.gain = gain;
+        source.hrtf = mixableStream.hrtf.get();
+
+        streamPopOutput.readSamples(source.samples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
     } else {
 
         streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
@@ -575,6 +768,169 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
     }
 }
 
+void AudioMixerSlave::renderClusters(AudioMixerClientData& listenerData) {
+    auto& clusters = listenerData.getClusterHRTFs();
+
+    // group the deferred sources by cluster
+    _clusterOrder.resize(_clusterSources.size());
+    for (int i = 0; i < (int)_clusterOrder.size(); ++i) {
+        _clusterOrder[i] = i;
+    }
+    std::sort(_clusterOrder.begin(), _clusterOrder.end(), [&](int a, int b) {
+        return _clusterSources[a].key < _clusterSources[b].key;
+    });
+
+    auto groupBegin = _clusterOrder.begin();
+    while (groupBegin != _clusterOrder.end()) {
+        int key = _clusterSources[*groupBegin].key;
+        auto groupEnd = std::find_if(groupBegin, _clusterOrder.end(), [&](int i) {
+            return _clusterSources[i].key != key;
+        });
+        int numSources = (int)(groupEnd - groupBegin);
+
+        if (numSources == 1) {
+            // nothing to share, render on its own
+            ClusterSource& source = _clusterSources[*groupBegin];
+            source.hrtf->render(source.samples, _mixSamples, HRTF_DATASET_INDEX, source.azimuth, source.distance,
+                                source.gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+            ++stats.hrtfRenders;
+        } else {
+            // premix the sources, and place the cluster at their gain-weighted center
+            float premixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
+            float referenceAzimuth = _clusterSources[*groupBegin].azimuth;
+            float sumAzimuthOffset = 0.0f;
+            float sumDistance = 0.0f;
+            float sumWeight = 0.0f;
+
+            std::for_each(groupBegin, groupEnd, [&](int i) {
+                ClusterSource& source = _clusterSources[i];
+                source.hrtf->premix(source.samples, premixSamples, source.azimuth, source.distance, source.gain,
+                                    AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+
+                // azimuth offsets are unwrapped around the first source, as a cluster can straddle +/-PI
+                float azimuthOffset = source.azimuth - referenceAzimuth;
+                if (azimuthOffset > PI) {
+                    azimuthOffset -= TWO_PI;
+                } else if (azimuthOffset < -PI) {
+                    azimuthOffset += TWO_PI;
+                }
+
+                float weight = source.gain + EPSILON;
+                sumAzimuthOffset += weight * azimuthOffset;
+                sumDistance += weight * source.distance;
+                sumWeight += weight;
+            });
+
+            float azimuth = referenceAzimuth + sumAzimuthOffset / sumWeight;
+            if (azimuth > PI) {
+                azimuth -= TWO_PI;
+            } else if (azimuth < -PI) {
+                azimuth += TWO_PI;
+            }
+            float distance = sumDistance / sumWeight;
+
+            // source gains were applied by the premix
+            auto& cluster = clusters[key];
+            cluster.azimuth = azimuth;
+            cluster.distance = distance;
+            cluster.lastFrame = _frame;
+            cluster.hrtf->render(premixSamples, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, 1.0f,
+                                 AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+
+            ++stats.hrtfRenders;
+            ++stats.hrtfClusters;
+            stats.hrtfClusteredSources += numSources;
+        }
+
+        groupBegin = groupEnd;
+    }
+
+    _clusterSources.clear();
+
+    // retire clusters that were not rendered this frame
+    for (auto it = clusters.begin(); it != clusters.end();) {
+        auto& cluster = it->second;
+        if (cluster.lastFrame == _frame) {
+            ++it;
+            continue;
+        }
+
+        // render a silent block to flush the tail of the last mixed block, as we do for streams gone silent
+        static float silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
+        beginMixInput();
+        cluster.hrtf->render(silentMonoBlock, _mixSamples, HRTF_DATASET_INDEX, cluster.azimuth, cluster.distance, 1.0f,
+                             AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        ++stats.hrtfRenders;
+
+        it = clusters.erase(it);
+    }
+}
+
+void AudioMixerSlave::mixAmbientSources(const AvatarAudioStream& listenerAudioStream, float masterInjectorGain) {
+    if (_ambientSources.empty()) {
+        return;
+    }
+
+    // the listener hears the ambient injectors of its zone, and those outside of every zone
+    int listenerZone = AudioMixerAmbientPremix::findZone(listenerAudioStream.getPosition());
+    const int NO_ZONE = AudioMixerAmbientPremix::NO_ZONE;
+    const int NUM_ZONES_HEARD = listenerZone == NO_ZONE ? 1 : 2;
+    const int zonesHeard[2] = { NO_ZONE, listenerZone };
+
+    for (int i = 0; i < NUM_ZONES_HEARD; ++i) {
+        int zone = zonesHeard[i];
+        int numSources = (int)std::count_if(_ambientSources.begin(), _ambientSources.end(), [&](const AmbientSource& source) {
+            return source.zone == zone;
+        });
+        if (numSources == 0) {
+            continue;
+        }
+
+        beginMixInput();
+
+        // the premix holds every playing ambient injector of the zone, so it can only be used when
+        // none of them are skipped (ignored, soloed out, throttled) for this listener
+        const AudioMixerAmbientPremix::Premix* premix = _sharedData.ambientPremix.getPremix(zone);
+        if (premix && premix->numStreams == numSources) {
+            for (int j = 0; j < AudioConstants::NETWORK_FRAME_SAMPLES_STEREO; ++j) {
+                _mixSamples[j] += masterInjectorGain * premix->samples[j];
+            }
+            ++stats.ambientPremixes;
+            stats.ambientPremixedSources += numSources;
+            continue;
+        }
+
+        for (const auto& source : _ambientSources) {
+            if (source.zone != zone) {
+                continue;
+            }
+
+            float gain = masterInjectorGain *
+                         reinterpret_cast<const InjectedAudioStream*>(source.stream)->getAttenuationRatio();
+            AudioRingBuffer::ConstIterator streamPopOutput = source.stream->getLastPopOutput();
+            if (source.stream->isStereo()) {
+                streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
+                source.hrtf->mixStereo(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+            } else {
+                streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+                source.hrtf->mixMono(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+            }
+            ++stats.manualAmbientMixes;
+        }
+    }
+
+    // the injectors of other zones are not heard by this listener
+    _ambientSources.clear();
+}
+
+void AudioMixerSlave::beginMixInput() {
+    if (!_hasMixInputs) {
+        // zero out the mix for this listener
+        memset(_mixSamples, 0, sizeof(_mixSamples));
+        _hasMixInputs = true;
+    }
+}
+
 void AudioMixerSlave::updateHRTFParameters(AudioMixerClientData::MixableStream& mixableStream,
                                            AvatarAudioStream& listeningNodeStream,
                                            float masterAvatarGain,
@@ -801,6 +1157,18 @@ float computeGain(float masterAvatarGain,
     return gain;
 }
 
+int computeClusterKey(float azimuth, float distance) {
+    // azimuth is quantized to the resolution of the HRTF tables
+    const float AZIMUTH_STEP = TWO_PI / HRTF_AZIMUTHS;
+    int azimuthBin = (int)((azimuth + PI) / AZIMUTH_STEP) % HRTF_AZIMUTHS;
+
+    // distance is quantized to half-octaves (perceived distance is roughly logarithmic)
+    const int NUM_DISTANCE_BINS = 64;
+    int distanceBin = glm::clamp((int)(2.0f * fastLog2f(distance)), 0, NUM_DISTANCE_BINS - 1);
+
+    return azimuthBin * NUM_DISTANCE_BINS + distanceBin;
+}
+
 float computeAzimuth(const AvatarAudioStream& listeningNodeStream,
                      const PositionalAudioStream& streamToAdd,
                      const glm::vec3& relativePosition) {
@@ -22,8 +22,10 @@
 #include <NodeList.h>
 #include <PositionalAudioStream.h>
 
+#include "AudioMixerAmbientPremix.h"
 #include "AudioMixerClientData.h"
 #include "AudioMixerStats.h"
+#include "AudioMixerStreamGrid.h"
 
 class AvatarAudioStream;
 class AudioHRTF;
@@ -36,6 +38,8 @@ public:
         AudioMixerClientData::ConcurrentAddedStreams addedStreams;
         std::vector<Node::LocalID> removedNodes;
         std::vector<NodeIDStreamID> removedStreams;
+        AudioMixerStreamGrid streamGrid;
+        AudioMixerAmbientPremix ambientPremix;
     };
 
     AudioMixerSlave(SharedData& sharedData) : _sharedData(sharedData) {};
@@ -50,6 +54,9 @@ public:
     // returns true if a mixed packet was sent to the node
     void mix(const SharedNodePointer& node);
 
+    // complete a round of mixing, once this slave has no more nodes to mix (sends any batched mixes)
+    void finishMix();
+
     AudioMixerStats stats;
 
 private:
@@ -66,12 +73,57 @@ private:
                               float masterInjectorGain);
     void resetHRTFState(AudioMixerClientData::MixableStream& mixableStream);
 
+    // zeroes _mixSamples before the first input is added to it for the current listener
+    void beginMixInput();
+
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
+    void renderClusters(AudioMixerClientData& listenerData);
+    void mixAmbientSources(const AvatarAudioStream& listenerAudioStream, float masterInjectorGain);
+    void cullStreams(const Node& listener, AudioMixerClientData& listenerData, bool isCulling);
+
+    // batched encoding, see AudioMixer::getEncodeBatchSize
+    void queueEncode(const SharedNodePointer& node, AudioMixerClientData& data);
+    void flushEncodes();
 
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    bool _hasMixInputs { false };   // set once a stream has been added to _mixSamples for the current listener
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
 
+    // mono sources deferred to a shared HRTF render, for the current listener
+    struct ClusterSource {
+        int key;
+        float azimuth;
+        float distance;
+        float gain;
+        AudioHRTF* hrtf;
+        int16_t samples[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+    };
+    std::vector<ClusterSource> _clusterSources;
+    std::vector<int> _clusterOrder;
+
+    // ambient injectors heard by the current listener, added as the premixes of their zones (see mixAmbientSources)
+    struct AmbientSource {
+        const PositionalAudioStream* stream;
+        AudioHRTF* hrtf;
+        int zone;
+    };
+    std::vector<AmbientSource> _ambientSources;
+
+    // mixes waiting to be encoded and sent as a batch
+    struct PendingEncode {
+        SharedNodePointer node;
+        AudioMixerClientData* data;
+        QByteArray decodedBuffer;
+    };
+    std::vector<PendingEncode> _pendingEncodes;
+    std::vector<Encoder*> _batchEncoders;
+    std::vector<QByteArray> _batchDecodedBuffers;
+    std::vector<QByteArray> _batchEncodedBuffers;
+
+    // streams within the audible radius of the current listener (only used when culling)
+    AudioMixerStreamGrid::StreamSet _audibleStreams;
+
     // frame state
     ConstIter _begin;
     ConstIter _end;
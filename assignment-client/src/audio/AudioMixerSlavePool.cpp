@@ -14,14 +14,29 @@
 #include <assert.h>
 #include <algorithm>
 
+#include <QJsonObject>
+
+#include <Profile.h>
+
 void AudioMixerSlaveThread::run() {
     while (true) {
         wait();
 
-        // iterate over all available nodes
-        SharedNodePointer node;
-        while (try_pop(node)) {
-            (this->*_function)(node);
+        {
+            PROFILE_RANGE(mixer, "AudioMixerSlave::run");
+
+            // send the packets for all of this slave's nodes together
+            udt::Socket::WriteBatch writeBatch;
+
+            // iterate over all available nodes
+            SharedNodePointer node;
+            while (try_pop(node)) {
+                (this->*_function)(node);
+            }
+
+            if (_pool._finish) {
+                _pool._finish(*this);
+            }
         }
 
         bool stopping = _stop;
@@ -61,12 +76,54 @@ void AudioMixerSlaveThread::notify(bool stopping) {
 }
 
 bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node) {
-    return _pool._queue.try_pop(node);
+    bool popped;
+    if (_pool._workStealing) {
+        popped = popOwnTask(node) || stealTask(node);
+    } else {
+        popped = _pool._queue.try_pop(node);
+    }
+
+    if (popped) {
+        ++_numTasksSinceStats;
+    }
+    return popped;
+}
+
+bool AudioMixerSlaveThread::popOwnTask(SharedNodePointer& node) {
+    Lock lock(_tasksMutex);
+    if (_tasks.empty()) {
+        return false;
+    }
+
+    node = std::move(_tasks.front());
+    _tasks.pop_front();
+    return true;
+}
+
+bool AudioMixerSlaveThread::stealTask(SharedNodePointer& node) {
+    // visit the other slaves in order, starting from our neighbor, so thieves spread across victims
+    int numSlaves = (int)_pool._slaves.size();
+    for (int i = 1; i < numSlaves; ++i) {
+        AudioMixerSlaveThread& victim = *_pool._slaves[(_index + i) % numSlaves];
+
+        Lock lock(victim._tasksMutex);
+        if (!victim._tasks.empty()) {
+            node = std::move(victim._tasks.back());
+            victim._tasks.pop_back();
+
+            ++_numStolenSinceStats;
+            ++stats.tasksStolen;
+            return true;
+        }
+    }
+
+    return false;
 }
 
 void AudioMixerSlavePool::processPackets(ConstIter begin, ConstIter end) {
     _function = &AudioMixerSlave::processPackets;
     _configure = [](AudioMixerSlave& slave) {};
+    _finish = [](AudioMixerSlave& slave) {};
     run(begin, end);
 }
 
@@ -75,6 +132,9 @@ void AudioMixerSlavePool::mix(ConstIter begin, ConstIter end, unsigned int frame
     _configure = [=](AudioMixerSlave& slave) {
         slave.configureMix(_begin, _end, frame, numToRetain);
     };
+    _finish = [](AudioMixerSlave& slave) {
+        slave.finishMix();
+    };
 
     run(begin, end);
 }
@@ -83,10 +143,14 @@ void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
     _begin = begin;
     _end = end;
 
-    // fill the queue
-    std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
-        _queue.push(node);
-    });
+    if (_workStealing) {
+        distribute(_begin, _end);
+    } else {
+        // fill the queue
+        std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
+            _queue.push(node);
+        });
+    }
 
     {
         Lock lock(_mutex);
@@ -105,6 +169,25 @@ void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
     }
 
     assert(_queue.empty());
+#ifndef NDEBUG
+    for (auto& slave : _slaves) {
+        Lock lock(slave->_tasksMutex);
+        assert(slave->_tasks.empty());
+    }
+#endif
+}
+
+void AudioMixerSlavePool::distribute(ConstIter begin, ConstIter end) {
+    // deal nodes round-robin so each slave starts with a similar share,
+    // any imbalance in per-node cost is then absorbed by stealing
+    size_t numSlaves = _slaves.size();
+    size_t i = 0;
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        AudioMixerSlaveThread& slave = *_slaves[i % numSlaves];
+        Lock lock(slave._tasksMutex);
+        slave._tasks.push_back(node);
+        ++i;
+    });
 }
 
 void AudioMixerSlavePool::each(std::function<void(AudioMixerSlave& slave)> functor) {
@@ -126,6 +209,21 @@ void AudioMixerSlavePool::queueStats(QJsonObject& stats) {
 }
 #endif // DEBUG_EVENT_QUEUE
 
+void AudioMixerSlavePool::stealStats(QJsonObject& stats) {
+    unsigned i = 0;
+    for (auto& slave : _slaves) {
+        QJsonObject slaveStats;
+        slaveStats["tasks"] = slave->_numTasksSinceStats;
+        slaveStats["stolen"] = slave->_numStolenSinceStats;
+        stats[QString("slave_%1").arg(i)] = slaveStats;
+
+        slave->_numTasksSinceStats = 0;
+        slave->_numStolenSinceStats = 0;
+
+        i++;
+    }
+}
+
 void AudioMixerSlavePool::setNumThreads(int numThreads) {
     // clamp to allowed size
     {
@@ -157,6 +255,7 @@ void AudioMixerSlavePool::resize(int numThreads) {
         // start new slaves
         for (int i = 0; i < numThreads - _numThreads; ++i) {
             auto slave = new AudioMixerSlaveThread(*this, _workerSharedData);
+            slave->_index = (int)_slaves.size();
             slave->start();
             _slaves.emplace_back(slave);
         }
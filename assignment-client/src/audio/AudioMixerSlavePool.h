@@ -13,6 +13,7 @@
 #define hifi_AudioMixerSlavePool_h
 
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <vector>
 
@@ -43,9 +44,23 @@ private:
     void notify(bool stopping);
     bool try_pop(SharedNodePointer& node);
 
+    // work-stealing helpers
+    bool popOwnTask(SharedNodePointer& node);
+    bool stealTask(SharedNodePointer& node);
+
     AudioMixerSlavePool& _pool;
     void (AudioMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
     bool _stop { false };
+
+    // work-stealing state
+    //   the owning slave pops from the front, other slaves steal from the back
+    Mutex _tasksMutex;
+    std::deque<SharedNodePointer> _tasks; // guarded by _tasksMutex
+    int _index { 0 };
+
+    // steal accounting since the last stats report (only read while the pool is idle)
+    int _numTasksSinceStats { 0 };
+    int _numStolenSinceStats { 0 };
 };
 
 // Slave pool for audio mixers
@@ -76,18 +91,27 @@ public:
     void queueStats(QJsonObject& stats);
 #endif
 
+    // per-slave task and steal counts since the last call (resets the counts)
+    void stealStats(QJsonObject& stats);
+
     void setNumThreads(int numThreads);
     int numThreads() { return _numThreads; }
 
+    // work-stealing distributes nodes across per-slave deques instead of a single shared queue
+    void setWorkStealing(bool workStealing) { _workStealing = workStealing; }
+    bool isWorkStealing() const { return _workStealing; }
+
 private:
     void run(ConstIter begin, ConstIter end);
     void resize(int numThreads);
+    void distribute(ConstIter begin, ConstIter end);
 
     std::vector<std::unique_ptr<AudioMixerSlaveThread>> _slaves;
 
     friend void AudioMixerSlaveThread::wait();
     friend void AudioMixerSlaveThread::notify(bool stopping);
     friend bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node);
+    friend bool AudioMixerSlaveThread::stealTask(SharedNodePointer& node);
 
     // synchronization state
     Mutex _mutex;
@@ -95,10 +119,12 @@ private:
     ConditionVariable _poolCondition;
     void (AudioMixerSlave::*_function)(const SharedNodePointer& node);
     std::function<void(AudioMixerSlave&)> _configure;
+    std::function<void(AudioMixerSlave&)> _finish;
     int _numThreads { 0 };
     int _numStarted { 0 }; // guarded by _mutex
     int _numFinished { 0 }; // guarded by _mutex
     int _numStopped { 0 }; // guarded by _mutex
+    bool _workStealing { false }; // only changed between runs
 
     // frame state
     Queue _queue;
@@ -21,20 +21,38 @@ void AudioMixerStats::reset() {
     hrtfRenders = 0;
     hrtfResets = 0;
     hrtfUpdates = 0;
+    hrtfClusters = 0;
+    hrtfClusteredSources = 0;
 
     manualStereoMixes = 0;
     manualEchoMixes = 0;
 
+    ambientPremixes = 0;
+    ambientPremixedSources = 0;
+    manualAmbientMixes = 0;
+
     skippedToActive = 0;
     skippedToInactive = 0;
     inactiveToSkipped = 0;
     inactiveToActive = 0;
     activeToSkipped = 0;
     activeToInactive = 0;
+    culledToInactive = 0;
+    inactiveToCulled = 0;
+    activeToCulled = 0;
 
     skipped = 0;
     inactive = 0;
     active = 0;
+    culled = 0;
+
+    tasksStolen = 0;
+
+    silentMixHits = 0;
+    limiterSkips = 0;
+
+    encodeBatches = 0;
+    batchedEncodes = 0;
 
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime = 0;
@@ -51,20 +69,38 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     hrtfRenders += otherStats.hrtfRenders;
     hrtfResets += otherStats.hrtfResets;
     hrtfUpdates += otherStats.hrtfUpdates;
+    hrtfClusters += otherStats.hrtfClusters;
+    hrtfClusteredSources += otherStats.hrtfClusteredSources;
 
     manualStereoMixes += otherStats.manualStereoMixes;
     manualEchoMixes += otherStats.manualEchoMixes;
 
+    ambientPremixes += otherStats.ambientPremixes;
+    ambientPremixedSources += otherStats.ambientPremixedSources;
+    manualAmbientMixes += otherStats.manualAmbientMixes;
+
     skippedToActive += otherStats.skippedToActive;
     skippedToInactive += otherStats.skippedToInactive;
     inactiveToSkipped += otherStats.inactiveToSkipped;
     inactiveToActive += otherStats.inactiveToActive;
     activeToSkipped += otherStats.activeToSkipped;
     activeToInactive += otherStats.activeToInactive;
+    culledToInactive += otherStats.culledToInactive;
+    inactiveToCulled += otherStats.inactiveToCulled;
+    activeToCulled += otherStats.activeToCulled;
 
     skipped += otherStats.skipped;
     inactive += otherStats.inactive;
     active += otherStats.active;
+    culled += otherStats.culled;
+
+    tasksStolen += otherStats.tasksStolen;
+
+    silentMixHits += otherStats.silentMixHits;
+    limiterSkips += otherStats.limiterSkips;
+
+    encodeBatches += otherStats.encodeBatches;
+    batchedEncodes += otherStats.batchedEncodes;
 
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime += otherStats.mixTime;
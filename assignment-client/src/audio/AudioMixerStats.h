@@ -26,20 +26,38 @@ struct AudioMixerStats {
     int hrtfRenders { 0 };
     int hrtfResets { 0 };
     int hrtfUpdates { 0 };
+    int hrtfClusters { 0 };
+    int hrtfClusteredSources { 0 };
 
     int manualStereoMixes { 0 };
     int manualEchoMixes { 0 };
 
+    int ambientPremixes { 0 };
+    int ambientPremixedSources { 0 };
+    int manualAmbientMixes { 0 };
+
     int skippedToActive { 0 };
     int skippedToInactive { 0 };
     int inactiveToSkipped { 0 };
     int inactiveToActive { 0 };
     int activeToSkipped { 0 };
     int activeToInactive { 0 };
+    int culledToInactive { 0 };
+    int inactiveToCulled { 0 };
+    int activeToCulled { 0 };
 
     int skipped { 0 };
     int inactive { 0 };
     int active { 0 };
+    int culled { 0 };
+
+    int tasksStolen { 0 };
+
+    int silentMixHits { 0 };
+    int limiterSkips { 0 };
+
+    int encodeBatches { 0 };
+    int batchedEncodes { 0 };
 
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     uint64_t mixTime { 0 };
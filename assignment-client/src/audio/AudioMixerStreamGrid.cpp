@@ -0,0 +1,90 @@
+//
+//  AudioMixerStreamGrid.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerStreamGrid.h"
+
+#include <algorithm>
+
+#include <glm/gtx/norm.hpp>
+
+#include <PositionalAudioStream.h>
+
+#include "AudioMixerClientData.h"
+
+AudioMixerStreamGrid::CellKey AudioMixerStreamGrid::computeKey(const glm::ivec3& cell) {
+    // pack 21 bits per axis, which covers +/-1M cells in each direction
+    const uint64_t MASK = (1 << 21) - 1;
+    return ((uint64_t)(cell.x & MASK) << 42) | ((uint64_t)(cell.y & MASK) << 21) | (uint64_t)(cell.z & MASK);
+}
+
+glm::ivec3 AudioMixerStreamGrid::computeCell(const glm::vec3& position) const {
+    return glm::ivec3(glm::floor(position / _cellSize));
+}
+
+void AudioMixerStreamGrid::rebuild(ConstIter begin, ConstIter end) {
+    // keep the buckets occupied last frame around, the set of occupied cells is mostly stable from frame to frame
+    for (auto it = _cells.begin(); it != _cells.end();) {
+        if (it->second.empty()) {
+            it = _cells.erase(it);
+        } else {
+            it->second.clear();
+            ++it;
+        }
+    }
+    _ambient.clear();
+    _numStreams = 0;
+
+    if (!isEnabled()) {
+        return;
+    }
+
+    // a cell as wide as the audible radius means a query never has to look past neighboring cells
+    _cellSize = _audibleRadius;
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        AudioMixerClientData* nodeData = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (!nodeData) {
+            return;
+        }
+
+        for (auto& stream : nodeData->getAudioStreams()) {
+            if (stream->isStereo() || stream->isAmbient()) {
+                _ambient.push_back(stream.get());
+            } else {
+                _cells[computeKey(computeCell(stream->getPosition()))].push_back(stream.get());
+            }
+            ++_numStreams;
+        }
+    });
+}
+
+void AudioMixerStreamGrid::findAudibleStreams(const glm::vec3& position, StreamSet& streams) const {
+    streams.insert(_ambient.begin(), _ambient.end());
+
+    const float radiusSquared = _audibleRadius * _audibleRadius;
+    glm::ivec3 center = computeCell(position);
+    glm::ivec3 cell;
+    for (cell.x = center.x - 1; cell.x <= center.x + 1; ++cell.x) {
+        for (cell.y = center.y - 1; cell.y <= center.y + 1; ++cell.y) {
+            for (cell.z = center.z - 1; cell.z <= center.z + 1; ++cell.z) {
+                auto it = _cells.find(computeKey(cell));
+                if (it == _cells.end()) {
+                    continue;
+                }
+
+                for (auto stream : it->second) {
+                    if (glm::distance2(stream->getPosition(), position) <= radiusSquared) {
+                        streams.insert(stream);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,59 @@
+//
+//  AudioMixerStreamGrid.h
+//  assignment-client/src/audio
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerStreamGrid_h
+#define hifi_AudioMixerStreamGrid_h
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <NodeList.h>
+
+class PositionalAudioStream;
+
+// Uniform spatial hash of all mixable streams, rebuilt once per mix frame.
+//   Each listener queries the cells overlapping its audible radius, so that streams far outside of it
+//   can be culled without being evaluated. Stereo and ambient streams are not spatialized, and are kept in an
+//   ambient bucket that is returned by every query.
+//   The grid is written by the mixer thread only while the slaves are idle, and is read-only during a mix.
+class AudioMixerStreamGrid {
+public:
+    using ConstIter = NodeList::const_iterator;
+    using StreamSet = std::unordered_set<const PositionalAudioStream*>;
+
+    // radius <= 0 disables culling
+    void setAudibleRadius(float radius) { _audibleRadius = radius; }
+    float getAudibleRadius() const { return _audibleRadius; }
+    bool isEnabled() const { return _audibleRadius > 0.0f; }
+
+    // rebuild the grid from the streams of the given nodes
+    void rebuild(ConstIter begin, ConstIter end);
+
+    // collect all streams within the audible radius of position (plus the ambient bucket) into streams
+    void findAudibleStreams(const glm::vec3& position, StreamSet& streams) const;
+
+    int getNumStreams() const { return _numStreams; }
+
+private:
+    using CellKey = uint64_t;
+    static CellKey computeKey(const glm::ivec3& cell);
+    glm::ivec3 computeCell(const glm::vec3& position) const;
+
+    std::unordered_map<CellKey, std::vector<const PositionalAudioStream*>> _cells;
+    std::vector<const PositionalAudioStream*> _ambient;
+    float _audibleRadius { 0.0f };
+    float _cellSize { 1.0f };
+    int _numStreams { 0 };
+};
+
+#endif // hifi_AudioMixerStreamGrid_h
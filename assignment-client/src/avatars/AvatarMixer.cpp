@@ -30,6 +30,7 @@
 #include <AvatarLogging.h>
 #include <LogHandler.h>
 #include <NodeList.h>
+#include <Profile.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
 #include <UUID.h>
@@ -73,8 +74,8 @@ AvatarMixer::AvatarMixer(ReceivedMessage& message) :
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
     packetReceiver.registerListener(PacketType::AvatarData, this, "queueIncomingPacket");
     packetReceiver.registerListener(PacketType::AdjustAvatarSorting, this, "handleAdjustAvatarSorting");
-    packetReceiver.registerListener(PacketType::AvatarQuery, this, "handleAvatarQueryPacket");
-    packetReceiver.registerListener(PacketType::AvatarIdentity, this, "handleAvatarIdentityPacket");
+    packetReceiver.registerListener(PacketType::AvatarQuery, this, "queueIncomingPacket");
+    packetReceiver.registerListener(PacketType::AvatarIdentity, this, "queueIncomingPacket");
     packetReceiver.registerListener(PacketType::KillAvatar, this, "handleKillAvatarPacket");
     packetReceiver.registerListener(PacketType::NodeIgnoreRequest, this, "handleNodeIgnoreRequestPacket");
     packetReceiver.registerListener(PacketType::RadiusIgnoreRequest, this, "handleRadiusIgnoreRequestPacket");
@@ -134,7 +135,7 @@ void AvatarMixer::handleReplicatedPacket(QSharedPointer<ReceivedMessage> message
     assert(replicatedNode);
 
     if (message->getType() == PacketType::ReplicatedAvatarIdentity) {
-        handleAvatarIdentityPacket(message, replicatedNode);
+        queueIncomingPacket(message, replicatedNode);
     } else if (message->getType() == PacketType::ReplicatedKillAvatar) {
         handleKillAvatarPacket(message, replicatedNode);
     }
@@ -252,6 +253,7 @@ void AvatarMixer::start() {
 
         auto frameDuration = timeFrame(frameTimestamp); // calculates last frame duration and sleeps remainder of target amount
         throttle(frameDuration, frame); // determines _throttlingRatio for upcoming mix frame
+        PROFILE_RANGE(mixer, "AvatarMixer::frame");
 
         int lockWait, nodeTransform, functor;
 
@@ -280,6 +282,7 @@ void AvatarMixer::start() {
 
         // Allow nodes to process any pending/queued packets across our worker threads
         {
+            PROFILE_RANGE(mixer, "processIncomingPackets");
             auto start = usecTimestampNow();
 
             nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
@@ -317,8 +320,26 @@ void AvatarMixer::start() {
             _broadcastAvatarDataNodeFunctor += functor;
         }
 
+        // bin the avatars for the slaves, which only test the avatars in the cells near the views of each listener
+        {
+            PROFILE_RANGE(mixer, "buildAvatarGrid");
+            auto& avatarGrid = _slaveSharedData.avatarGrid;
+            avatarGrid.clear();
+            nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+                std::for_each(cbegin, cend, [&](const SharedNodePointer& node) {
+                    if (node->getType() == NodeType::Agent && node->getLinkedData()) {
+                        auto& avatar = static_cast<AvatarMixerClientData*>(node->getLinkedData())->getAvatar();
+                        glm::vec3 boxScale = avatar.getGlobalBoundingBox().getScale();
+                        float radius = 0.5f * glm::max(boxScale.x, glm::max(boxScale.y, boxScale.z));
+                        avatarGrid.insert(node->getLocalID(), avatar.getClientGlobalPosition(), radius);
+                    }
+                });
+            });
+        }
+
         // this is where we need to put the real work...
         {
+            PROFILE_RANGE(mixer, "broadcastAvatarData");
             auto start = usecTimestampNow();
             nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
                 auto start = usecTimestampNow();
@@ -585,19 +606,6 @@ void AvatarMixer::handleAdjustAvatarSorting(QSharedPointer<ReceivedMessage> mess
 }
 
 
-void AvatarMixer::handleAvatarQueryPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    auto start = usecTimestampNow();
-    getOrCreateClientData(senderNode);
-
-    AvatarMixerClientData* nodeData = dynamic_cast<AvatarMixerClientData*>(senderNode->getLinkedData());
-    if (nodeData) {
-        nodeData->readViewFrustumPacket(message->getMessage());
-    }
-
-    auto end = usecTimestampNow();
-    _handleViewFrustumPacketElapsedTime += (end - start);
-}
-
 void AvatarMixer::handleRequestsDomainListDataPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
     auto start = usecTimestampNow();
 
@@ -639,35 +647,6 @@ void AvatarMixer::handleRequestsDomainListDataPacket(QSharedPointer<ReceivedMess
     _handleRequestsDomainListDataPacketElapsedTime += (end - start);
 }
 
-void AvatarMixer::handleAvatarIdentityPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
-    auto start = usecTimestampNow();
-    auto nodeList = DependencyManager::get<NodeList>();
-    getOrCreateClientData(senderNode);
-
-    if (senderNode->getLinkedData()) {
-        AvatarMixerClientData* nodeData = dynamic_cast<AvatarMixerClientData*>(senderNode->getLinkedData());
-        if (nodeData != nullptr) {
-            AvatarData& avatar = nodeData->getAvatar();
-
-            // parse the identity packet and update the change timestamp if appropriate
-            bool identityChanged = false;
-            bool displayNameChanged = false;
-            QDataStream avatarIdentityStream(message->getMessage());
-            avatar.processAvatarIdentity(avatarIdentityStream, identityChanged, displayNameChanged);
-
-            if (identityChanged) {
-                QMutexLocker nodeDataLocker(&nodeData->getMutex());
-                nodeData->flagIdentityChange();
-                if (displayNameChanged) {
-                    nodeData->setAvatarSessionDisplayNameMustChange(true);
-                }
-            }
-        }
-    }
-    auto end = usecTimestampNow();
-    _handleAvatarIdentityPacketElapsedTime += (end - start);
-}
-
 void AvatarMixer::handleKillAvatarPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
     auto start = usecTimestampNow();
     handleAvatarKilled(node);
@@ -776,12 +755,10 @@ void AvatarMixer::sendStatsPacket() {
     singleCoreTasks["queueIncomingPacket"] = TIGHT_LOOP_STAT_UINT64(_queueIncomingPacketElapsedTime);
 
     QJsonObject incomingPacketStats;
-    incomingPacketStats["handleAvatarIdentityPacket"] = TIGHT_LOOP_STAT_UINT64(_handleAvatarIdentityPacketElapsedTime);
     incomingPacketStats["handleKillAvatarPacket"] = TIGHT_LOOP_STAT_UINT64(_handleKillAvatarPacketElapsedTime);
     incomingPacketStats["handleNodeIgnoreRequestPacket"] = TIGHT_LOOP_STAT_UINT64(_handleNodeIgnoreRequestPacketElapsedTime);
     incomingPacketStats["handleRadiusIgnoreRequestPacket"] = TIGHT_LOOP_STAT_UINT64(_handleRadiusIgnoreRequestPacketElapsedTime);
     incomingPacketStats["handleRequestsDomainListDataPacket"] = TIGHT_LOOP_STAT_UINT64(_handleRequestsDomainListDataPacketElapsedTime);
-    incomingPacketStats["handleAvatarQueryPacket"] = TIGHT_LOOP_STAT_UINT64(_handleViewFrustumPacketElapsedTime);
 
     singleCoreTasks["incoming_packets"] = incomingPacketStats;
     singleCoreTasks["sendStats"] = (float)_sendStatsElapsedTime;
@@ -838,6 +815,14 @@ void AvatarMixer::sendStatsPacket() {
     slavesAggregatObject["sent_5_averageTraitsBytes"] = TIGHT_LOOP_STAT(aggregateStats.numTraitsBytesSent);
     slavesAggregatObject["sent_6_averageIdentityBytes"] = TIGHT_LOOP_STAT(aggregateStats.numIdentityBytesSent);
     slavesAggregatObject["sent_7_averageHeroAvatars"] = TIGHT_LOOP_STAT(aggregateStats.numHeroesIncluded);
+    slavesAggregatObject["sent_8_averageEncodeCacheHits"] = TIGHT_LOOP_STAT(aggregateStats.numEncodeCacheHits);
+    int encodeCacheLookups = aggregateStats.numEncodeCacheHits + aggregateStats.numEncodeCacheMisses;
+    slavesAggregatObject["sent_9_encodeCacheHitRate"] = encodeCacheLookups ?
+        (float)aggregateStats.numEncodeCacheHits / (float)encodeCacheLookups : 0.0f;
+    slavesAggregatObject["sent_10_averageTraitDeltas"] = TIGHT_LOOP_STAT(aggregateStats.numTraitDeltasSent);
+    slavesAggregatObject["sent_11_averageOverBudgetTraits"] = TIGHT_LOOP_STAT(aggregateStats.overBudgetTraits);
+    float averageCulledByGrid = averageNodes ? aggregateStats.numCulledByGrid / averageNodes : 0.0f;
+    slavesAggregatObject["sent_12_averageCulledByGrid"] = TIGHT_LOOP_STAT(averageCulledByGrid);
 
     slavesAggregatObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processIncomingPacketsElapsedTime);
     slavesAggregatObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.ignoreCalculationElapsedTime);
@@ -845,11 +830,19 @@ void AvatarMixer::sendStatsPacket() {
     slavesAggregatObject["timing_4_avatarDataPacking"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.avatarDataPackingElapsedTime);
     slavesAggregatObject["timing_5_packetSending"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.packetSendingElapsedTime);
     slavesAggregatObject["timing_6_jobElapsedTime"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.jobElapsedTime);
+    slavesAggregatObject["timing_7_prioritySort"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.prioritySortElapsedTime);
+
+    QJsonObject queuedPacketStats;
+    queuedPacketStats["AvatarData"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processAvatarDataElapsedTime);
+    queuedPacketStats["AvatarIdentity"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processAvatarIdentityElapsedTime);
+    queuedPacketStats["AvatarQuery"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processAvatarQueryElapsedTime);
+    queuedPacketStats["SetAvatarTraits"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processSetAvatarTraitsElapsedTime);
+    queuedPacketStats["BulkAvatarTraitsAck"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processTraitsAckElapsedTime);
+    queuedPacketStats["ChallengeOwnership"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processChallengeOwnershipElapsedTime);
+    slavesAggregatObject["timing_8_queuedPackets"] = queuedPacketStats;
 
     statsObject["slaves_aggregate (per frame)"] = slavesAggregatObject;
 
-    _handleViewFrustumPacketElapsedTime = 0;
-    _handleAvatarIdentityPacketElapsedTime = 0;
     _handleKillAvatarPacketElapsedTime = 0;
     _handleNodeIgnoreRequestPacketElapsedTime = 0;
     _handleRadiusIgnoreRequestPacketElapsedTime = 0;
@@ -1010,6 +1003,13 @@ void AvatarMixer::parseDomainServerSettings(const QJsonObject& domainSettings) {
         qCDebug(avatars) << "Avatar mixer will automatically determine number of threads to use. Using:" << _slavePool.numThreads() << "threads.";
     }
 
+    {
+        const QString RECEIVE_WORKERS = "receive_workers";
+        bool ok = false;
+        int numReceiveWorkers = avatarMixerGroupObject[RECEIVE_WORKERS].toString().toInt(&ok);
+        DependencyManager::get<NodeList>()->setNumReceiveWorkers(ok ? numReceiveWorkers : 0);
+    }
+
     {
         const QString CONNECTION_RATE = "connection_rate";
         auto nodeList = DependencyManager::get<NodeList>();
@@ -1029,6 +1029,26 @@ void AvatarMixer::parseDomainServerSettings(const QJsonObject& domainSettings) {
         }
     }
 
+    {   // Replicate the avatars without the replication permission too, at a reduced rate:
+        static const QString REPLICATE_ALL_AVATARS_KEY = "replicate_all_avatars";
+        static const QString NEIGHBOR_REPLICATION_RATE_KEY = "neighbor_replication_rate";
+        const float DEFAULT_NEIGHBOR_REPLICATION_RATE = 10.0f;
+        const float MIN_NEIGHBOR_REPLICATION_RATE = 1.0f;
+        _slaveSharedData.replicateAllAvatars = avatarMixerGroupObject[REPLICATE_ALL_AVATARS_KEY].toBool(false);
+        float rate = std::max((float)avatarMixerGroupObject[NEIGHBOR_REPLICATION_RATE_KEY].toDouble(DEFAULT_NEIGHBOR_REPLICATION_RATE),
+                              MIN_NEIGHBOR_REPLICATION_RATE);
+        _slaveSharedData.neighborReplicationIntervalUsecs = (uint64_t)(USECS_PER_SECOND / rate);
+        if (_slaveSharedData.replicateAllAvatars) {
+            qCDebug(avatars) << "Avatar mixer replicating all avatars downstream at" << rate << "Hz";
+        }
+    }
+
+    {   // Send joints that changed as deltas against the last frame sent to each listener:
+        static const QString JOINT_DELTAS_KEY = "joint_deltas";
+        AvatarData::_sendJointDeltas = avatarMixerGroupObject[JOINT_DELTAS_KEY].toBool(false);
+        qCDebug(avatars) << "Avatar mixer joint delta encoding" << (AvatarData::_sendJointDeltas ? "enabled" : "disabled");
+    }
+
     const QString AVATARS_SETTINGS_KEY = "avatars";
 
     static const QString MIN_HEIGHT_OPTION = "min_avatar_height";
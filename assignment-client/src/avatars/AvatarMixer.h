@@ -54,8 +54,6 @@ public slots:
 private slots:
     void queueIncomingPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
     void handleAdjustAvatarSorting(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
-    void handleAvatarQueryPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
-    void handleAvatarIdentityPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleKillAvatarPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleNodeIgnoreRequestPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleRadiusIgnoreRequestPacket(QSharedPointer<ReceivedMessage> packet, SharedNodePointer sendingNode);
@@ -134,8 +132,6 @@ private:
     quint64 _broadcastAvatarDataNodeFunctor { 0 };
 
     quint64 _handleAdjustAvatarSortingElapsedTime { 0 };
-    quint64 _handleViewFrustumPacketElapsedTime { 0 };
-    quint64 _handleAvatarIdentityPacketElapsedTime { 0 };
     quint64 _handleKillAvatarPacketElapsedTime { 0 };
     quint64 _handleNodeIgnoreRequestPacketElapsedTime { 0 };
     quint64 _handleRadiusIgnoreRequestPacketElapsedTime { 0 };
@@ -12,6 +12,9 @@
 #include "AvatarMixerClientData.h"
 
 #include <algorithm>
+
+#include <QtCore/QDataStream>
+
 #include <udt/PacketHeaders.h>
 
 #include <DependencyManager.h>
@@ -52,34 +55,55 @@ void AvatarMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message,
     _packetQueue.push(message);
 }
 
-int AvatarMixerClientData::processPackets(const SlaveSharedData& slaveSharedData) {
+int AvatarMixerClientData::processPackets(const SlaveSharedData& slaveSharedData, AvatarMixerSlaveStats& stats) {
     int packetsProcessed = 0;
     SharedNodePointer node = _packetQueue.node;
     assert(_packetQueue.empty() || node);
     _packetQueue.node.clear();
 
+    auto start = usecTimestampNow();
     while (!_packetQueue.empty()) {
         auto& packet = _packetQueue.front();
 
         packetsProcessed++;
 
+        quint64* elapsedTime = nullptr;
         switch (packet->getType()) {
             case PacketType::AvatarData:
                 parseData(*packet, slaveSharedData);
+                elapsedTime = &stats.processAvatarDataElapsedTime;
+                break;
+            case PacketType::AvatarIdentity:
+            case PacketType::ReplicatedAvatarIdentity:
+                processAvatarIdentityMessage(*packet);
+                elapsedTime = &stats.processAvatarIdentityElapsedTime;
+                break;
+            case PacketType::AvatarQuery:
+                readViewFrustumPacket(packet->getMessage());
+                elapsedTime = &stats.processAvatarQueryElapsedTime;
                 break;
             case PacketType::SetAvatarTraits:
                 processSetTraitsMessage(*packet, slaveSharedData, *node);
+                elapsedTime = &stats.processSetAvatarTraitsElapsedTime;
                 break;
             case PacketType::BulkAvatarTraitsAck:
                 processBulkAvatarTraitsAckMessage(*packet);
+                elapsedTime = &stats.processTraitsAckElapsedTime;
                 break;
             case PacketType::ChallengeOwnership:
                 _avatar->processChallengeResponse(*packet);
+                elapsedTime = &stats.processChallengeOwnershipElapsedTime;
                 break;
             default:
                 Q_UNREACHABLE();
         }
         _packetQueue.pop();
+
+        auto end = usecTimestampNow();
+        if (elapsedTime) {
+            *elapsedTime += (end - start);
+        }
+        start = end;
     }
     assert(_packetQueue.empty());
 
@@ -182,6 +206,23 @@ int AvatarMixerClientData::parseData(ReceivedMessage& message, const SlaveShared
     return true;
 }
 
+void AvatarMixerClientData::processAvatarIdentityMessage(ReceivedMessage& message) {
+    // parse the identity packet and update the change timestamp if appropriate
+    bool identityChanged = false;
+    bool displayNameChanged = false;
+    QDataStream avatarIdentityStream(message.getMessage());
+    _avatar->processAvatarIdentity(avatarIdentityStream, identityChanged, displayNameChanged);
+
+    if (identityChanged) {
+        // the display names are made unique on the mixer thread, which reads these flags with the mutex locked
+        QMutexLocker nodeDataLocker(&getMutex());
+        flagIdentityChange();
+        if (displayNameChanged) {
+            setAvatarSessionDisplayNameMustChange(true);
+        }
+    }
+}
+
 void AvatarMixerClientData::processSetTraitsMessage(ReceivedMessage& message,
                                                     const SlaveSharedData& slaveSharedData,
                                                     Node& sendingNode) {
@@ -268,8 +309,23 @@ void AvatarMixerClientData::processSetTraitsMessage(ReceivedMessage& message,
                         // to track a deleted instance but keep version information
                         // the avatar mixer uses the negative value of the sent version
                         instanceVersionRef = -packetTraitVersion;
+                        _avatarEntityDeltas.erase(instanceID);
                     } else {
-                        _avatar->processTraitInstance(traitType, instanceID, message.read(traitSize));
+                        auto traitData = message.read(traitSize);
+                        if (traitType == AvatarTraits::AvatarEntity) {
+                            // the listeners that have the version this replaces only need what changed in it
+                            QByteArray delta;
+                            if (instanceVersionRef > AvatarTraits::DEFAULT_TRAIT_VERSION) {
+                                delta = AvatarTraits::computeTraitDelta(_avatar->packTraitInstance(traitType, instanceID),
+                                                                        traitData);
+                            }
+                            if (!delta.isEmpty()) {
+                                _avatarEntityDeltas[instanceID] = { instanceVersionRef, delta };
+                            } else {
+                                _avatarEntityDeltas.erase(instanceID);
+                            }
+                        }
+                        _avatar->processTraitInstance(traitType, instanceID, traitData);
                         instanceVersionRef = packetTraitVersion;
                     }
 
@@ -290,6 +346,12 @@ void AvatarMixerClientData::processSetTraitsMessage(ReceivedMessage& message,
     }
 }
 
+const AvatarMixerClientData::TraitInstanceDelta* AvatarMixerClientData::getAvatarEntityDelta(
+    const AvatarTraits::TraitInstanceID& instanceID) const {
+    auto itr = _avatarEntityDeltas.find(instanceID);
+    return itr != _avatarEntityDeltas.end() ? &itr->second : nullptr;
+}
+
 void AvatarMixerClientData::processBulkAvatarTraitsAckMessage(ReceivedMessage& message) {
     // Avatar Traits flow control marks each outgoing avatar traits packet with a
     // sequence number. The mixer caches the traits sent in the traits packet.
@@ -399,6 +461,11 @@ uint64_t AvatarMixerClientData::getLastBroadcastTime(NLPacket::LocalID nodeUUID)
     return 0;
 }
 
+uint64_t AvatarMixerClientData::getLastReplicationTime(NLPacket::LocalID nodeID) const {
+    auto nodeMatch = _lastReplicationTimes.find(nodeID);
+    return nodeMatch != _lastReplicationTimes.end() ? nodeMatch->second : 0;
+}
+
 uint16_t AvatarMixerClientData::getLastBroadcastSequenceNumber(NLPacket::LocalID nodeID) const {
     // return the matching PacketSequenceNumber, or the default if we don't have it
     auto nodeMatch = _lastBroadcastSequenceNumbers.find(nodeID);
@@ -508,10 +575,33 @@ AvatarMixerClientData::TraitsCheckTimestamp AvatarMixerClientData::getLastOtherA
 void AvatarMixerClientData::cleanupKilledNode(const QUuid&, Node::LocalID nodeLocalID) {
     removeLastBroadcastSequenceNumber(nodeLocalID);
     removeLastBroadcastTime(nodeLocalID);
+    _lastReplicationTimes.erase(nodeLocalID);
     _lastSentTraitsTimestamps.erase(nodeLocalID);
     _perNodeSentTraitVersions.erase(nodeLocalID);
     _perNodeAckedTraitVersions.erase(nodeLocalID);
+    _otherAvatarPriorities.erase(nodeLocalID);
     for (auto&& pendingTraitVersions : _perNodePendingTraitVersions) {
         pendingTraitVersions.second.erase(nodeLocalID);
     }
 }
+
+bool AvatarMixerClientData::checkSortInputsChanged(const glm::vec3& weights, float positionThreshold,
+                                                   float directionThreshold) {
+    bool changed = weights != _lastSortWeights || _currentViewFrustums.size() != _lastSortViewFrustums.size();
+    for (size_t i = 0; !changed && i < _currentViewFrustums.size(); ++i) {
+        const auto& view = _currentViewFrustums[i];
+        const auto& lastView = _lastSortViewFrustums[i];
+        changed = glm::distance(view.getPosition(), lastView.getPosition()) > positionThreshold
+            || glm::dot(view.getDirection(), lastView.getDirection()) < 1.0f - directionThreshold
+            || view.getAngle() != lastView.getAngle() || view.getRadius() != lastView.getRadius();
+    }
+
+    if (changed) {
+        _lastSortViewFrustums = _currentViewFrustums;
+        _lastSortWeights = weights;
+        for (auto& otherAvatarPriority : _otherAvatarPriorities) {
+            otherAvatarPriority.second.hasPriority = false;
+        }
+    }
+    return changed;
+}
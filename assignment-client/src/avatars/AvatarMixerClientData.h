@@ -36,6 +36,7 @@ const QString OUTBOUND_AVATAR_TRAITS_STATS_KEY = "outbound_av_traits_kbps";
 const QString INBOUND_AVATAR_DATA_STATS_KEY = "inbound_av_data_kbps";
 
 struct SlaveSharedData;
+class AvatarMixerSlaveStats;
 
 class AvatarMixerClientData : public NodeData {
     Q_OBJECT
@@ -63,6 +64,10 @@ public:
     void setLastBroadcastTime(NLPacket::LocalID nodeUUID, uint64_t broadcastTime) { _lastBroadcastTimes[nodeUUID] = broadcastTime; }
     Q_INVOKABLE void removeLastBroadcastTime(NLPacket::LocalID nodeUUID) { _lastBroadcastTimes.erase(nodeUUID); }
 
+    // when the avatar of another node was last replicated to this downstream mixer
+    uint64_t getLastReplicationTime(NLPacket::LocalID nodeID) const;
+    void setLastReplicationTime(NLPacket::LocalID nodeID, uint64_t replicationTime) { _lastReplicationTimes[nodeID] = replicationTime; }
+
     Q_INVOKABLE void cleanupKilledNode(const QUuid& nodeUUID, Node::LocalID nodeLocalID);
 
     uint16_t getLastReceivedSequenceNumber() const { return _lastReceivedSequenceNumber; }
@@ -129,8 +134,10 @@ public:
     QVector<JointData>& getLastOtherAvatarSentJoints(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarSentJoints[otherAvatar]; }
 
     void queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
-    int processPackets(const SlaveSharedData& slaveSharedData); // returns number of packets processed
+    // returns number of packets processed, and adds the time spent on each type of packet to the stats
+    int processPackets(const SlaveSharedData& slaveSharedData, AvatarMixerSlaveStats& stats);
 
+    void processAvatarIdentityMessage(ReceivedMessage& message);
     void processSetTraitsMessage(ReceivedMessage& message, const SlaveSharedData& slaveSharedData, Node& sendingNode);
     void processBulkAvatarTraitsAckMessage(ReceivedMessage& message);
     void checkSkeletonURLAgainstWhitelist(const SlaveSharedData& slaveSharedData, Node& sendingNode,
@@ -158,6 +165,32 @@ public:
 
     void resetSentTraitData(Node::LocalID nodeID);
 
+    // the changes from the previous version of an avatar entity to the current one, when they are smaller than it
+    struct TraitInstanceDelta {
+        AvatarTraits::TraitVersion baseVersion;
+        QByteArray delta;
+    };
+    const TraitInstanceDelta* getAvatarEntityDelta(const AvatarTraits::TraitInstanceID& instanceID) const;
+
+    // Inputs and result of the last priority computed for an "other" avatar, so that the broadcast can reuse it
+    // while neither avatar has moved beyond a threshold, and the rank of the other avatar in the last sort.
+    struct OtherAvatarPriority {
+        glm::vec3 position;
+        float radius { 0.0f };
+        uint64_t ageSeconds { 0 };
+        float priority { 0.0f };
+        bool hasPriority { false };
+        int rank { -1 };
+    };
+    using OtherAvatarPriorities = std::unordered_map<Node::LocalID, OtherAvatarPriority>;
+    OtherAvatarPriorities& getOtherAvatarPriorities() { return _otherAvatarPriorities; }
+    int getNumRankedOtherAvatars() const { return _numRankedOtherAvatars; }
+    void setNumRankedOtherAvatars(int numRanked) { _numRankedOtherAvatars = numRanked; }
+
+    // invalidates all cached priorities (but not ranks) if the views or weights have changed beyond the thresholds
+    // since the last invalidation, returns true if it did
+    bool checkSortInputsChanged(const glm::vec3& weights, float positionThreshold, float directionThreshold);
+
 private:
     struct PacketQueue : public std::queue<QSharedPointer<ReceivedMessage>> {
         QWeakPointer<Node> node;
@@ -169,6 +202,7 @@ private:
     uint16_t _lastReceivedSequenceNumber { 0 };
     std::unordered_map<NLPacket::LocalID, uint16_t> _lastBroadcastSequenceNumbers;
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastBroadcastTimes;
+    std::unordered_map<NLPacket::LocalID, uint64_t> _lastReplicationTimes;
 
     // this is a map of the last time we encoded an "other" avatar for
     // sending to "this" node
@@ -191,6 +225,11 @@ private:
     std::vector<QUuid> _radiusIgnoredOthers;
     ConicalViewFrustums _currentViewFrustums;
 
+    OtherAvatarPriorities _otherAvatarPriorities;
+    int _numRankedOtherAvatars { 0 };
+    ConicalViewFrustums _lastSortViewFrustums;
+    glm::vec3 _lastSortWeights { -1.0f };
+
     int _recentOtherAvatarsInView { 0 };
     int _recentOtherAvatarsOutOfView { 0 };
     QString _baseDisplayName{}; // The santized key used in determinging unique sessionDisplayName, so that we can remove from dictionary.
@@ -200,6 +239,8 @@ private:
     AvatarTraits::TraitVersions _lastReceivedTraitVersions;
     TraitsCheckTimestamp _lastReceivedTraitsChange;
 
+    std::unordered_map<AvatarTraits::TraitInstanceID, TraitInstanceDelta> _avatarEntityDeltas;
+
     AvatarTraits::TraitMessageSequence _currentTraitsMessageSequence{ 0 };
 
     // Cache of trait versions sent in a given packet (indexed by sequence number)
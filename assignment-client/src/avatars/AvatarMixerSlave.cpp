@@ -51,6 +51,10 @@ void AvatarMixerSlave::configureBroadcast(ConstIter begin, ConstIter end,
     _maxKbpsPerNode = maxKbpsPerNode;
     _throttlingRatio = throttlingRatio;
     _avatarHeroFraction = priorityReservedFraction;
+
+    // the cached encodings are only valid for the frame they were encoded in
+    _sendAllEncodings.clear();
+    _palMinimumEncodings.clear();
 }
 
 void AvatarMixerSlave::harvestStats(AvatarMixerSlaveStats& stats) {
@@ -64,7 +68,7 @@ void AvatarMixerSlave::processIncomingPackets(const SharedNodePointer& node) {
     auto nodeData = dynamic_cast<AvatarMixerClientData*>(node->getLinkedData());
     if (nodeData) {
         _stats.nodesProcessed++;
-        _stats.packetsProcessed += nodeData->processPackets(*_sharedData);
+        _stats.packetsProcessed += nodeData->processPackets(*_sharedData, _stats);
     }
     auto end = usecTimestampNow();
     _stats.processIncomingPacketsElapsedTime += (end - start);
@@ -196,9 +200,24 @@ qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* lis
                 if (!isDeleted && (sentInstanceIt == sentIDValuePairs.end() || receivedVersion > sentInstanceIt->value)) {
                     bytesWritten += addTraitsNodeHeader(listeningNodeData, sendingNodeData, traitsPacketList, bytesWritten);
 
-                    // this instance version exists and has never been sent or is newer so we need to send it
-                    bytesWritten += AvatarTraits::packVersionedTraitInstance(traitType, instanceID, traitsPacketList,
-                                                                             receivedVersion, *sendingAvatar);
+                    // this instance version exists and has never been sent or is newer so we need to send it, only
+                    // as what changed when the listener has the version it replaced
+                    const AvatarMixerClientData::TraitInstanceDelta* delta = nullptr;
+                    if (traitType == AvatarTraits::AvatarEntity && ackedInstanceIt != ackIDValuePairs.end()) {
+                        delta = sendingNodeData->getAvatarEntityDelta(instanceID);
+                        if (delta && delta->baseVersion != ackedInstanceIt->value) {
+                            delta = nullptr;
+                        }
+                    }
+                    if (delta) {
+                        bytesWritten += AvatarTraits::packVersionedTraitInstanceDelta(traitType, instanceID, traitsPacketList,
+                                                                                      receivedVersion, delta->baseVersion,
+                                                                                      delta->delta);
+                        _stats.numTraitDeltasSent++;
+                    } else {
+                        bytesWritten += AvatarTraits::packVersionedTraitInstance(traitType, instanceID, traitsPacketList,
+                                                                                 receivedVersion, *sendingAvatar);
+                    }
 
                     if (sentInstanceIt != sentIDValuePairs.end()) {
                         sentInstanceIt->value = receivedVersion;
@@ -261,6 +280,12 @@ int AvatarMixerSlave::sendReplicatedIdentityPacket(const Node& agentNode, const
 }
 
 static const int AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND = 45;
+static const float TRAITS_BUDGET_FRACTION = 0.5f;
+
+// how far the priority inputs may drift before a cached priority is recomputed
+static const float PRIORITY_POSITION_THRESHOLD = 0.1f; // meters
+static const float PRIORITY_RADIUS_THRESHOLD = 0.05f; // meters
+static const float PRIORITY_DIRECTION_THRESHOLD = 0.0005f; // 1 - cos(angle), about 1.8 degrees
 
 void AvatarMixerSlave::broadcastAvatarData(const SharedNodePointer& node) {
     quint64 start = usecTimestampNow();
@@ -347,6 +372,9 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     // max number of avatarBytes per frame (13 900, typical)
     const int maxAvatarBytesPerFrame = int(_maxKbpsPerNode * BYTES_PER_KILOBIT / AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND);
     const int maxHeroBytesPerFrame = int(maxAvatarBytesPerFrame * _avatarHeroFraction);  // 5555, typical
+    // the traits of the avatars past this wait for the next frames, so that a listener that just arrived in a crowded
+    // domain gets the traits of the avatars in priority order instead of all of them at once
+    const int maxTraitBytesPerFrame = int(maxAvatarBytesPerFrame * TRAITS_BUDGET_FRACTION);
 
     // keep track of the number of other avatars held back in this frame
     int numAvatarsHeldBack = 0;
@@ -386,6 +414,10 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
 
     avatarPriorityQueues[kNonhero].reserve(_end - _begin);
 
+    // candidates are pushed to the queues once they are all known, see below
+    std::vector<SortableAvatar> sortCandidates;
+    sortCandidates.reserve(_end - _begin);
+
     for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
         Node* otherNodeRaw = (*listedNode).data();
         if (otherNodeRaw->getType() != NodeType::Agent
@@ -468,8 +500,7 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             const MixerAvatar* avatarNodeData = sourceAvatarNodeData->getConstAvatarData();
             auto lastEncodeTime = destinationNodeData->getLastOtherAvatarEncodeTime(sourceAvatarNode->getLocalID());
 
-            avatarPriorityQueues[avatarNodeData->getHasPriority() ? kHero : kNonhero].push(
-                SortableAvatar(avatarNodeData, sourceAvatarNode, lastEncodeTime));
+            sortCandidates.push_back(SortableAvatar(avatarNodeData, sourceAvatarNode, lastEncodeTime));
         }
         
         // If Node A's PAL WAS open but is no longer open, AND
@@ -493,10 +524,76 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
         destinationNodeData->setPrevRequestsDomainListData(PALIsOpen);
     }
 
+    auto startPrioritySort = chrono::high_resolution_clock::now();
+
+    // Push the candidates in the order of their rank in the last sort, followed by those that were not ranked,
+    // so that the incremental sort only has to move the avatars that changed rank. Priorities are only
+    // recomputed for avatars whose inputs have drifted beyond a threshold since they were last computed.
+    glm::vec3 sortWeights(AvatarData::_avatarSortCoefficientSize, AvatarData::_avatarSortCoefficientCenter,
+        AvatarData::_avatarSortCoefficientAge);
+    destinationNodeData->checkSortInputsChanged(sortWeights, PRIORITY_POSITION_THRESHOLD, PRIORITY_DIRECTION_THRESHOLD);
+    auto& otherAvatarPriorities = destinationNodeData->getOtherAvatarPriorities();
+
+    std::vector<int> rankedCandidates(destinationNodeData->getNumRankedOtherAvatars(), -1);
+    std::vector<int> unrankedCandidates;
+    for (int i = 0; i < (int)sortCandidates.size(); ++i) {
+        auto otherAvatarPriority = otherAvatarPriorities.find(sortCandidates[i].getNode()->getLocalID());
+        int rank = otherAvatarPriority != otherAvatarPriorities.end() ? otherAvatarPriority->second.rank : -1;
+        if (rank >= 0 && rank < (int)rankedCandidates.size() && rankedCandidates[rank] == -1) {
+            rankedCandidates[rank] = i;
+        } else {
+            unrankedCandidates.push_back(i);
+        }
+    }
+
+    // the avatars in the cells that miss all of the views are out of view, and skip the view tests of the priority
+    const auto& avatarGrid = _sharedData->avatarGrid;
+    std::vector<bool> cellsInView;
+    avatarGrid.findCellsInViews(cameraViews, cellsInView);
+
+    uint64_t sortTimestamp = usecTimestampNow();
+    auto pushCandidate = [&](int index) {
+        const SortableAvatar& candidate = sortCandidates[index];
+        auto& otherAvatarPriority = otherAvatarPriorities[candidate.getNode()->getLocalID()];
+        auto& queue = avatarPriorityQueues[candidate.getAvatar()->getHasPriority() ? kHero : kNonhero];
+
+        glm::vec3 position = candidate.getPosition();
+        float radius = candidate.getRadius();
+        uint64_t ageSeconds = (sortTimestamp - candidate.getTimestamp()) / USECS_PER_SECOND;
+        if (!otherAvatarPriority.hasPriority || otherAvatarPriority.ageSeconds != ageSeconds
+            || glm::distance2(position, otherAvatarPriority.position) > PRIORITY_POSITION_THRESHOLD * PRIORITY_POSITION_THRESHOLD
+            || std::abs(radius - otherAvatarPriority.radius) > PRIORITY_RADIUS_THRESHOLD) {
+            otherAvatarPriority.position = position;
+            otherAvatarPriority.radius = radius;
+            otherAvatarPriority.ageSeconds = ageSeconds;
+            int cellIndex = avatarGrid.getCellIndex(candidate.getNode()->getLocalID());
+            if (cellIndex >= 0 && !cellsInView[cellIndex]) {
+                otherAvatarPriority.priority = queue.computeOutOfViewPriority(candidate);
+                _stats.numCulledByGrid++;
+            } else {
+                otherAvatarPriority.priority = queue.computePriority(candidate);
+            }
+            otherAvatarPriority.hasPriority = true;
+        }
+        queue.push(candidate, otherAvatarPriority.priority);
+    };
+    for (int index : rankedCandidates) {
+        if (index != -1) {
+            pushCandidate(index);
+        }
+    }
+    for (int index : unrankedCandidates) {
+        pushCandidate(index);
+    }
+
+    _stats.prioritySortElapsedTime +=
+        (quint64)chrono::duration_cast<chrono::microseconds>(chrono::high_resolution_clock::now() - startPrioritySort).count();
+
     // loop through our sorted avatars and allocate our bandwidth to them accordingly
 
     int remainingAvatars = (int)avatarPriorityQueues[kHero].size() + (int)avatarPriorityQueues[kNonhero].size();
     auto traitsPacketList = NLPacketList::create(PacketType::BulkAvatarTraits, QByteArray(), true, true);
+    traitsPacketList->setPriorityWeight(udt::PacketList::LATENCY_SENSITIVE_PRIORITY_WEIGHT);
 
     auto avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
     const int avatarPacketCapacity = avatarPacket->getPayloadCapacity();
@@ -505,9 +602,19 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     int numAvatarsSent = 0;
     auto identityPacketList = NLPacketList::create(PacketType::AvatarIdentity, QByteArray(), true, true);
 
+    // rank the sorted avatars for the next frame, heroes first
+    int numRanked = 0;
+
     // Loop over two priorities - hero avatars then everyone else:
     for (PriorityVariants currentVariant = kHero; currentVariant <= kNonhero; ++((int&)currentVariant)) {
-        const auto& sortedAvatarVector = avatarPriorityQueues[currentVariant].getSortedVector(numToSendEst);
+        auto startSort = chrono::high_resolution_clock::now();
+        const auto& sortedAvatarVector = avatarPriorityQueues[currentVariant].getIncrementallySortedVector();
+        for (const auto& sortedAvatar : sortedAvatarVector) {
+            otherAvatarPriorities[sortedAvatar.getNode()->getLocalID()].rank = numRanked++;
+        }
+        _stats.prioritySortElapsedTime +=
+            (quint64)chrono::duration_cast<chrono::microseconds>(chrono::high_resolution_clock::now() - startSort).count();
+
         for (const auto& sortedAvatar : sortedAvatarVector) {
             const Node* sourceNode = sortedAvatar.getNode();
             auto lastEncodeForOther = sortedAvatar.getTimestamp();
@@ -569,7 +676,33 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             AvatarDataPacket::SendStatus sendStatus;
             sendStatus.sendUUID = true;
 
-            do {
+            EncodedAvatar* cachedEncoding = nullptr;
+            if (detail == AvatarData::SendAllData) {
+                cachedEncoding = &_sendAllEncodings[sourceNode->getLocalID()];
+            } else if (detail == AvatarData::PALMinimum) {
+                cachedEncoding = &_palMinimumEncodings[sourceNode->getLocalID()];
+            }
+
+            if (cachedEncoding && !cachedEncoding->bytes.isEmpty()) {
+                // another listener already got this exact payload this frame, copy it rather than re-encoding it
+                const QByteArray& bytes = cachedEncoding->bytes;
+                if (bytes.size() > avatarSpaceAvailable) {
+                    nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+                    ++numPacketsSent;
+                    avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                    avatarSpaceAvailable = avatarPacketCapacity;
+                }
+                avatarPacket->write(bytes);
+                avatarSpaceAvailable -= bytes.size();
+                numAvatarDataBytes += bytes.size();
+                if (detail == AvatarData::SendAllData) {
+                    lastSentJointsForOther = cachedEncoding->sentJoints;
+                }
+                _stats.numEncodeCacheHits++;
+            } else do {
+                // only a payload encoded whole, in one go, can be reused
+                bool isCacheable = cachedEncoding && sendStatus.itemFlags == 0;
+
                 auto startSerialize = chrono::high_resolution_clock::now();
                 QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
                     sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
@@ -578,6 +711,16 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 _stats.toByteArrayElapsedTime +=
                     (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
 
+                if (isCacheable) {
+                    _stats.numEncodeCacheMisses++;
+                    if (sendStatus) {
+                        cachedEncoding->bytes = bytes;
+                        if (detail == AvatarData::SendAllData) {
+                            cachedEncoding->sentJoints = lastSentJointsForOther;
+                        }
+                    }
+                }
+
                 avatarPacket->write(bytes);
                 avatarSpaceAvailable -= bytes.size();
                 numAvatarDataBytes += bytes.size();
@@ -610,8 +753,13 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 (quint64)chrono::duration_cast<chrono::microseconds>(endAvatarDataPacking - startAvatarDataPacking).count();
 
             if (!overBudget) {
-                // use helper to add any changed traits to our packet list
-                traitBytesSent += addChangedTraitsToBulkPacket(destinationNodeData, sourceNodeData, *traitsPacketList);
+                if (traitBytesSent < maxTraitBytesPerFrame) {
+                    // use helper to add any changed traits to our packet list
+                    traitBytesSent += addChangedTraitsToBulkPacket(destinationNodeData, sourceNodeData, *traitsPacketList);
+                } else if (sourceNodeData->getLastReceivedTraitsChange() >
+                           destinationNodeData->getLastOtherAvatarTraitsSendPoint(sourceNode->getLocalID())) {
+                    _stats.overBudgetTraits++;
+                }
             }
             numAvatarsSent++;
             remainingAvatars--;
@@ -624,6 +772,8 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
         }
     }
 
+    destinationNodeData->setNumRankedOtherAvatars(numRanked);
+
     if (destinationNodeData->getNumAvatarsSentLastFrame() > numToSendEst) {
         qCWarning(avatars) << "More avatars sent than upper estimate" << destinationNodeData->getNumAvatarsSentLastFrame()
             << " / " << numToSendEst;
@@ -685,13 +835,22 @@ void AvatarMixerSlave::broadcastAvatarDataToDownstreamMixer(const SharedNodePoin
     // reset the number of sent avatars
     nodeData->resetNumAvatarsSentLastFrame();
 
+    quint64 now = usecTimestampNow();
+
     std::for_each(_begin, _end, [&](const SharedNodePointer& agentNode) {
         if (!AvatarMixer::shouldReplicateTo(*agentNode, *node)) {
             return;
         }
-        
+
+        // the avatars with the replication permission go at the full rate, the others of this mixer at the neighbor rate
+        bool shouldReplicate = agentNode->isReplicated();
+        if (!shouldReplicate && _sharedData->replicateAllAvatars && !agentNode->isUpstream()) {
+            shouldReplicate = now - nodeData->getLastReplicationTime(agentNode->getLocalID()) >=
+                _sharedData->neighborReplicationIntervalUsecs;
+        }
+
         // collect agents that we have avatar data for that we are supposed to replicate
-        if (agentNode->getType() == NodeType::Agent && agentNode->getLinkedData() && agentNode->isReplicated()) {
+        if (agentNode->getType() == NodeType::Agent && agentNode->getLinkedData() && shouldReplicate) {
             const AvatarMixerClientData* agentNodeData = reinterpret_cast<const AvatarMixerClientData*>(agentNode->getLinkedData());
 
             AvatarSharedPointer otherAvatar = agentNodeData->getAvatarSharedPointer();
@@ -753,6 +912,7 @@ void AvatarMixerSlave::broadcastAvatarDataToDownstreamMixer(const SharedNodePoin
                 // set the last sent sequence number for this sender on the receiver
                 nodeData->setLastBroadcastSequenceNumber(agentNode->getLocalID(),
                                                          agentNodeData->getLastReceivedSequenceNumber());
+                nodeData->setLastReplicationTime(agentNode->getLocalID(), now);
 
                 // increment the number of avatars sent to this reciever
                 nodeData->incrementNumAvatarsSentLastFrame();
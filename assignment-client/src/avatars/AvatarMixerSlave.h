@@ -12,8 +12,16 @@
 #ifndef hifi_AvatarMixerSlave_h
 #define hifi_AvatarMixerSlave_h
 
+#include <unordered_map>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+
+#include <JointData.h>
 #include <NodeList.h>
 
+#include "AvatarSpatialGrid.h"
+
 class AvatarMixerClientData;
 
 class AvatarMixerSlaveStats {
@@ -21,6 +29,12 @@ public:
     int nodesProcessed { 0 };
     int packetsProcessed { 0 };
     quint64 processIncomingPacketsElapsedTime { 0 };
+    quint64 processAvatarDataElapsedTime { 0 };
+    quint64 processAvatarIdentityElapsedTime { 0 };
+    quint64 processAvatarQueryElapsedTime { 0 };
+    quint64 processSetAvatarTraitsElapsedTime { 0 };
+    quint64 processTraitsAckElapsedTime { 0 };
+    quint64 processChallengeOwnershipElapsedTime { 0 };
 
     int nodesBroadcastedTo { 0 };
     int downstreamMixersBroadcastedTo { 0 };
@@ -33,11 +47,17 @@ public:
     int numOthersIncluded { 0 };
     int overBudgetAvatars { 0 };
     int numHeroesIncluded { 0 };
+    int numEncodeCacheHits { 0 };
+    int numEncodeCacheMisses { 0 };
+    int numTraitDeltasSent { 0 };
+    int overBudgetTraits { 0 };
+    int numCulledByGrid { 0 };
 
     quint64 ignoreCalculationElapsedTime { 0 };
     quint64 avatarDataPackingElapsedTime { 0 };
     quint64 packetSendingElapsedTime { 0 };
     quint64 toByteArrayElapsedTime { 0 };
+    quint64 prioritySortElapsedTime { 0 };
     quint64 jobElapsedTime { 0 };
 
     void reset() {
@@ -45,6 +65,12 @@ public:
         nodesProcessed = 0;
         packetsProcessed = 0;
         processIncomingPacketsElapsedTime = 0;
+        processAvatarDataElapsedTime = 0;
+        processAvatarIdentityElapsedTime = 0;
+        processAvatarQueryElapsedTime = 0;
+        processSetAvatarTraitsElapsedTime = 0;
+        processTraitsAckElapsedTime = 0;
+        processChallengeOwnershipElapsedTime = 0;
 
         // sending job stats
         nodesBroadcastedTo = 0;
@@ -59,11 +85,17 @@ public:
         numOthersIncluded = 0;
         overBudgetAvatars = 0;
         numHeroesIncluded = 0;
+        numEncodeCacheHits = 0;
+        numEncodeCacheMisses = 0;
+        numTraitDeltasSent = 0;
+        overBudgetTraits = 0;
+        numCulledByGrid = 0;
 
         ignoreCalculationElapsedTime = 0;
         avatarDataPackingElapsedTime = 0;
         packetSendingElapsedTime = 0;
         toByteArrayElapsedTime = 0;
+        prioritySortElapsedTime = 0;
         jobElapsedTime = 0;
     }
 
@@ -71,6 +103,12 @@ public:
         nodesProcessed += rhs.nodesProcessed;
         packetsProcessed += rhs.packetsProcessed;
         processIncomingPacketsElapsedTime += rhs.processIncomingPacketsElapsedTime;
+        processAvatarDataElapsedTime += rhs.processAvatarDataElapsedTime;
+        processAvatarIdentityElapsedTime += rhs.processAvatarIdentityElapsedTime;
+        processAvatarQueryElapsedTime += rhs.processAvatarQueryElapsedTime;
+        processSetAvatarTraitsElapsedTime += rhs.processSetAvatarTraitsElapsedTime;
+        processTraitsAckElapsedTime += rhs.processTraitsAckElapsedTime;
+        processChallengeOwnershipElapsedTime += rhs.processChallengeOwnershipElapsedTime;
 
         nodesBroadcastedTo += rhs.nodesBroadcastedTo;
         downstreamMixersBroadcastedTo += rhs.downstreamMixersBroadcastedTo;
@@ -83,11 +121,17 @@ public:
         numOthersIncluded += rhs.numOthersIncluded;
         overBudgetAvatars += rhs.overBudgetAvatars;
         numHeroesIncluded += rhs.numHeroesIncluded;
+        numEncodeCacheHits += rhs.numEncodeCacheHits;
+        numEncodeCacheMisses += rhs.numEncodeCacheMisses;
+        numTraitDeltasSent += rhs.numTraitDeltasSent;
+        overBudgetTraits += rhs.overBudgetTraits;
+        numCulledByGrid += rhs.numCulledByGrid;
 
         ignoreCalculationElapsedTime += rhs.ignoreCalculationElapsedTime;
         avatarDataPackingElapsedTime += rhs.avatarDataPackingElapsedTime;
         packetSendingElapsedTime += rhs.packetSendingElapsedTime;
         toByteArrayElapsedTime += rhs.toByteArrayElapsedTime;
+        prioritySortElapsedTime += rhs.prioritySortElapsedTime;
         jobElapsedTime += rhs.jobElapsedTime;
         return *this;
     }
@@ -100,6 +144,14 @@ struct SlaveSharedData {
     QStringList skeletonURLWhitelist;
     QUrl skeletonReplacementURL;
     EntityTreePointer entityTree;
+
+    // Avatars without the replication permission are also replicated to the downstream mixers, at a reduced rate,
+    // so that the avatars of a region that is split across the mixers of several domains see each other.
+    bool replicateAllAvatars { false };
+    uint64_t neighborReplicationIntervalUsecs { 0 };
+
+    // the avatars of the frame, rebuilt by the mixer before each broadcast
+    AvatarSpatialGrid avatarGrid;
 };
 
 class AvatarMixerSlave {
@@ -143,6 +195,16 @@ private:
     float _throttlingRatio { 0.0f };
     float _avatarHeroFraction { 0.4f };
 
+    // Payloads that are the same for every listener (SendAllData and PALMinimum), encoded at most once per frame
+    // per avatar by this slave. For SendAllData, the joints a listener will have been sent are cached with them.
+    struct EncodedAvatar {
+        QByteArray bytes;
+        QVector<JointData> sentJoints;
+    };
+    using EncodedAvatars = std::unordered_map<Node::LocalID, EncodedAvatar>;
+    EncodedAvatars _sendAllEncodings;
+    EncodedAvatars _palMinimumEncodings;
+
     AvatarMixerSlaveStats _stats;
     SlaveSharedData* _sharedData;
 };
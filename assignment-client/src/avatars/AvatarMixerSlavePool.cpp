@@ -14,14 +14,23 @@
 #include <assert.h>
 #include <algorithm>
 
+#include <Profile.h>
+
 void AvatarMixerSlaveThread::run() {
     while (true) {
         wait();
 
-        // iterate over all available nodes
-        SharedNodePointer node;
-        while (try_pop(node)) {
-            (this->*_function)(node);
+        {
+            PROFILE_RANGE(mixer, "AvatarMixerSlave::run");
+
+            // send the packets for all of this slave's nodes together
+            udt::Socket::WriteBatch writeBatch;
+
+            // iterate over all available nodes
+            SharedNodePointer node;
+            while (try_pop(node)) {
+                (this->*_function)(node);
+            }
         }
 
         bool stopping = _stop;
@@ -0,0 +1,99 @@
+//
+//  AvatarSpatialGrid.cpp
+//  assignment-client/src/avatars
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarSpatialGrid.h"
+
+const float AvatarSpatialGrid::CELL_SIZE = 16.0f;
+const int AvatarSpatialGrid::CELLS_PER_COARSE_CELL = 4;
+
+// the cells are padded before they are tested so that the avatars that move into view during the frame aren't missed
+static const float CELL_VIEW_MARGIN = 1.0f; // meters
+
+void AvatarSpatialGrid::clear() {
+    _cells.clear();
+    _coarseCells.clear();
+    _cellIndices.clear();
+    _coarseCellIndices.clear();
+    _avatarCells.clear();
+}
+
+void AvatarSpatialGrid::insert(Node::LocalID localID, const glm::vec3& position, float radius) {
+    AABox avatarBox(position - glm::vec3(radius), glm::vec3(2.0f * radius));
+
+    CellKey coarseKey = computeKey(position, CELL_SIZE * CELLS_PER_COARSE_CELL);
+    auto coarseCellIndex = _coarseCellIndices.find(coarseKey);
+    if (coarseCellIndex == _coarseCellIndices.end()) {
+        coarseCellIndex = _coarseCellIndices.emplace(coarseKey, (int)_coarseCells.size()).first;
+        _coarseCells.emplace_back();
+    }
+    Cell& coarseCell = _coarseCells[coarseCellIndex->second];
+
+    CellKey key = computeKey(position, CELL_SIZE);
+    auto cellIndex = _cellIndices.find(key);
+    if (cellIndex == _cellIndices.end()) {
+        cellIndex = _cellIndices.emplace(key, (int)_cells.size()).first;
+        _cells.emplace_back();
+        coarseCell.children.push_back(cellIndex->second);
+    }
+
+    addToBounds(coarseCell, avatarBox);
+    addToBounds(_cells[cellIndex->second], avatarBox);
+    _avatarCells[localID] = cellIndex->second;
+}
+
+int AvatarSpatialGrid::getCellIndex(Node::LocalID localID) const {
+    auto avatarCell = _avatarCells.find(localID);
+    return avatarCell != _avatarCells.end() ? avatarCell->second : -1;
+}
+
+void AvatarSpatialGrid::findCellsInViews(const ConicalViewFrustums& views, std::vector<bool>& cellsInViewOut) const {
+    cellsInViewOut.assign(_cells.size(), false);
+    for (const auto& coarseCell : _coarseCells) {
+        if (!isInViews(coarseCell.bounds, views)) {
+            continue;
+        }
+        if (coarseCell.children.size() == 1) {
+            cellsInViewOut[coarseCell.children.front()] = true;
+            continue;
+        }
+        for (int cellIndex : coarseCell.children) {
+            cellsInViewOut[cellIndex] = isInViews(_cells[cellIndex].bounds, views);
+        }
+    }
+}
+
+AvatarSpatialGrid::CellKey AvatarSpatialGrid::computeKey(const glm::vec3& position, float cellSize) {
+    // 21 bits per axis cover more than the extent of a domain at the cell sizes of the grid
+    const CellKey AXIS_MASK = (1 << 21) - 1;
+    glm::ivec3 cell = glm::ivec3(glm::floor(position / cellSize));
+    return ((CellKey)(cell.x & AXIS_MASK) << 42) | ((CellKey)(cell.y & AXIS_MASK) << 21) | (CellKey)(cell.z & AXIS_MASK);
+}
+
+void AvatarSpatialGrid::addToBounds(Cell& cell, const AABox& box) {
+    if (cell.isEmpty) {
+        cell.bounds = box;
+        cell.isEmpty = false;
+    } else {
+        cell.bounds += box;
+    }
+}
+
+bool AvatarSpatialGrid::isInViews(const AABox& bounds, const ConicalViewFrustums& views) {
+    // the views test the bounding sphere of the box, which holds the bounding spheres of all of the avatars in it,
+    // so a cell that misses all of the views has none of its avatars in view
+    AABox paddedBounds = bounds;
+    paddedBounds.setBox(bounds.getCorner() - glm::vec3(CELL_VIEW_MARGIN), bounds.getScale() + glm::vec3(2.0f * CELL_VIEW_MARGIN));
+    for (const auto& view : views) {
+        if (view.intersects(paddedBounds)) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,66 @@
+//
+//  AvatarSpatialGrid.h
+//  assignment-client/src/avatars
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarSpatialGrid_h
+#define hifi_AvatarSpatialGrid_h
+
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <AABox.h>
+#include <Node.h>
+#include <shared/ConicalViewFrustum.h>
+
+// The avatars of a frame binned in a two level grid, built by the mixer before the broadcast and read by all of the
+// slaves.  A listener tests the coarse cells against its views and the fine cells of the coarse cells that pass,
+// instead of testing each of the other avatars, and the avatars in the cells outside of all of its views are known
+// to be out of view without testing them one by one.
+class AvatarSpatialGrid {
+public:
+    static const float CELL_SIZE; // meters
+    static const int CELLS_PER_COARSE_CELL; // along each axis
+
+    void clear();
+
+    // the position and radius are the ones the slaves sort the avatar with
+    void insert(Node::LocalID localID, const glm::vec3& position, float radius);
+
+    int getNumCells() const { return (int)_cells.size(); }
+    int getNumAvatars() const { return (int)_avatarCells.size(); }
+
+    // the index of the fine cell of the avatar, -1 if it wasn't inserted this frame
+    int getCellIndex(Node::LocalID localID) const;
+
+    // flags the fine cells with avatars that may be in or near one of the views, indexed by cell
+    void findCellsInViews(const ConicalViewFrustums& views, std::vector<bool>& cellsInViewOut) const;
+
+private:
+    using CellKey = int64_t;
+
+    struct Cell {
+        AABox bounds; // of the bounding spheres of the avatars in the cell
+        bool isEmpty { true };
+        std::vector<int> children; // the fine cells of a coarse cell
+    };
+
+    static CellKey computeKey(const glm::vec3& position, float cellSize);
+    static void addToBounds(Cell& cell, const AABox& box);
+    static bool isInViews(const AABox& bounds, const ConicalViewFrustums& views);
+
+    std::vector<Cell> _cells;
+    std::vector<Cell> _coarseCells;
+    std::unordered_map<CellKey, int> _cellIndices;
+    std::unordered_map<CellKey, int> _coarseCellIndices;
+    std::unordered_map<Node::LocalID, int> _avatarCells;
+};
+
+#endif // hifi_AvatarSpatialGrid_h
@@ -11,6 +11,8 @@
 
 #include "EntityServer.h"
 
+#include <algorithm>
+
 #include <QtCore/QEventLoop>
 #include <QTimer>
 #include <QJsonArray>
@@ -161,11 +163,13 @@ int EntityServer::sendSpecialPackets(const SharedNodePointer& node, OctreeQueryN
     if (nodeData) {
 
         quint64 deletedEntitiesSentAt = nodeData->getLastDeletedEntitiesSentAt();
-        quint64 considerEntitiesSince = EntityTree::getAdjustedConsiderSince(deletedEntitiesSentAt);
 
         quint64 deletePacketSentAt = usecTimestampNow();
         EntityTreePointer tree = std::static_pointer_cast<EntityTree>(_tree);
-        auto recentlyDeleted = tree->getRecentlyDeletedEntityIDs();
+
+        // the IDs deleted since we last sent to this node, already encoded by the tree for every node
+        QByteArray encodedIDs = tree->getEncodedEntityIDsDeletedSince(deletedEntitiesSentAt);
+        int numIDs = encodedIDs.size() / NUM_BYTES_RFC4122_UUID;
 
         packetsSent = 0;
 
@@ -189,76 +193,63 @@ int EntityServer::sendSpecialPackets(const SharedNodePointer& node, OctreeQueryN
         qint64 numberOfIDsPos = deletesPacket->pos();
         deletesPacket->writePrimitive(numberOfIDs);
 
-        // we keep a multi map of entity IDs to timestamps, we only want to include the entity IDs that have been
-        // deleted since we last sent to this node
-        auto it = recentlyDeleted.constBegin();
-        while (it != recentlyDeleted.constEnd()) {
-
-            // if the timestamp is more recent then out last sent time, include it
-            if (it.key() > considerEntitiesSince) {
-
-                // get all the IDs for this timestamp
-                const auto& entityIDsFromTime = recentlyDeleted.values(it.key());
-
-                for (const auto& entityID : entityIDsFromTime) {
+        // FIXME - we still seem to see cases where incorrect EntityIDs get sent from the server
+        // to the client. These were causing "lost" entities like flashlights and laser pointers
+        // now that we keep around some additional history of the erased entities and resend that
+        // history for a longer time window, these entities are not "lost". But we haven't yet
+        // found/fixed the underlying issue that caused bad UUIDs to be sent to some users.
+        int numIDsWritten = 0;
+        while (numIDsWritten < numIDs) {
 
-                    // check to make sure we have room for one more ID, if we don't have more
-                    // room, then send out this packet and create another one
-                    if (NUM_BYTES_RFC4122_UUID > deletesPacket->bytesAvailableForWrite()) {
+            // check to make sure we have room for one more ID, if we don't have more
+            // room, then send out this packet and create another one
+            if (NUM_BYTES_RFC4122_UUID > deletesPacket->bytesAvailableForWrite()) {
 
-                        // replace the count for the number of included IDs
-                        deletesPacket->seek(numberOfIDsPos);
-                        deletesPacket->writePrimitive(numberOfIDs);
+                // replace the count for the number of included IDs
+                deletesPacket->seek(numberOfIDsPos);
+                deletesPacket->writePrimitive(numberOfIDs);
 
-                        // Send the current packet
-                        queryNode->packetSent(*deletesPacket);
-                        auto thisPacketSize = deletesPacket->getDataSize();
-                        totalBytes += thisPacketSize;
-                        packetsSent++;
-                        DependencyManager::get<NodeList>()->sendPacket(std::move(deletesPacket), *node);
+                // Send the current packet
+                queryNode->packetSent(*deletesPacket);
+                auto thisPacketSize = deletesPacket->getDataSize();
+                totalBytes += thisPacketSize;
+                packetsSent++;
+                DependencyManager::get<NodeList>()->sendPacket(std::move(deletesPacket), *node);
 
-                        #ifdef EXTRA_ERASE_DEBUGGING
-                            qDebug() << "EntityServer::sendSpecialPackets() sending packet packetsSent[" << packetsSent << "] size:" << thisPacketSize;
-                        #endif
+                #ifdef EXTRA_ERASE_DEBUGGING
+                    qDebug() << "EntityServer::sendSpecialPackets() sending packet packetsSent[" << packetsSent << "] size:" << thisPacketSize;
+                #endif
 
 
-                        // create another packet
-                        deletesPacket = NLPacket::create(PacketType::EntityErase);
+                // create another packet
+                deletesPacket = NLPacket::create(PacketType::EntityErase);
 
-                        // pack in flags
-                        deletesPacket->writePrimitive(flags);
+                // pack in flags
+                deletesPacket->writePrimitive(flags);
 
-                        // pack in sequence number
-                        sequenceNumber = queryNode->getSequenceNumber();
-                        deletesPacket->writePrimitive(sequenceNumber);
+                // pack in sequence number
+                sequenceNumber = queryNode->getSequenceNumber();
+                deletesPacket->writePrimitive(sequenceNumber);
 
-                        // pack in timestamp
-                        deletesPacket->writePrimitive(now);
+                // pack in timestamp
+                deletesPacket->writePrimitive(now);
 
-                        // figure out where we are now and pack a temporary number of IDs
-                        numberOfIDs = 0;
-                        numberOfIDsPos = deletesPacket->pos();
-                        deletesPacket->writePrimitive(numberOfIDs);
-                    }
-
-                    // FIXME - we still seem to see cases where incorrect EntityIDs get sent from the server
-                    // to the client. These were causing "lost" entities like flashlights and laser pointers
-                    // now that we keep around some additional history of the erased entities and resend that
-                    // history for a longer time window, these entities are not "lost". But we haven't yet
-                    // found/fixed the underlying issue that caused bad UUIDs to be sent to some users.
-                    deletesPacket->write(entityID.toRfc4122());
-                    ++numberOfIDs;
-
-                    #ifdef EXTRA_ERASE_DEBUGGING
-                        qDebug() << "EntityTree::encodeEntitiesDeletedSince() including:" << entityID;
-                    #endif
-                } // end for (ids)
-
-            } // end if (it.val > sinceLast)
+                // figure out where we are now and pack a temporary number of IDs
+                numberOfIDs = 0;
+                numberOfIDsPos = deletesPacket->pos();
+                deletesPacket->writePrimitive(numberOfIDs);
+            }
 
+            // as many IDs as the packet has room for, in one copy
+            int numIDsToWrite = std::min(numIDs - numIDsWritten, (int)(deletesPacket->bytesAvailableForWrite() / NUM_BYTES_RFC4122_UUID));
+            deletesPacket->write(encodedIDs.constData() + numIDsWritten * NUM_BYTES_RFC4122_UUID, numIDsToWrite * NUM_BYTES_RFC4122_UUID);
+            numberOfIDs += numIDsToWrite;
+            numIDsWritten += numIDsToWrite;
 
-            ++it;
-        } // end while
+            #ifdef EXTRA_ERASE_DEBUGGING
+                qDebug() << "EntityServer::sendSpecialPackets() including" << numIDsToWrite << "IDs";
+            #endif
+        }
 
         // replace the count for the number of included IDs
         deletesPacket->seek(numberOfIDsPos);
@@ -336,6 +327,14 @@ void EntityServer::readAdditionalConfiguration(const QJsonObject& settingsSectio
 
     startDynamicDomainVerification();
 
+    // the encoding of entities that didn't change is kept and copied to the next viewers that ask for it
+    const int DEFAULT_ENCODED_ENTITY_CACHE_MB = 64;
+    int encodedEntityCacheMB;
+    if (!readOptionInt("encodedEntityCacheSize", settingsSectionObject, encodedEntityCacheMB)) {
+        encodedEntityCacheMB = DEFAULT_ENCODED_ENTITY_CACHE_MB;
+    }
+    EntityItem::setEncodedDataCacheLimit((int64_t)std::max(0, encodedEntityCacheMB) * BYTES_PER_KILOBYTE * BYTES_PER_KILOBYTE);
+
     tree->setWantEditLogging(wantEditLogging);
     tree->setWantTerseEditLogging(wantTerseEditLogging);
 
@@ -397,6 +396,8 @@ void EntityServer::trackViewerGone(const QUuid& sessionID) {
         _viewerSendingStats.remove(sessionID);
     }
 
+    _sharedTraversals.removeViewer(sessionID);
+
     if (_entitySimulation) {
         _tree->withReadLock([&] {
             _entitySimulation->clearOwnership(sessionID);
@@ -412,6 +413,15 @@ QString EntityServer::serverSubclassStats() {
     statsString += "<b>Entity Server Memory Statistics</b>\r\n";
     statsString += QString().sprintf("EntityTreeElement size... %ld bytes\r\n", sizeof(EntityTreeElement));
     statsString += QString().sprintf("       EntityItem size... %ld bytes\r\n", sizeof(EntityItem));
+    statsString += QString().sprintf("Encoded entity cache... %lld bytes\r\n", (long long)EntityItem::getEncodedDataCacheSize());
+    statsString += QString().sprintf("With certifiable properties... %d entities\r\n",
+                                     EntityItem::getNumWithCertifiableProperties());
+    auto& stringPool = EntityItem::getStringPool();
+    statsString += QString().sprintf("Interned urls and scripts... %d strings, %lld bytes\r\n",
+                                     stringPool.getNumStrings(), (long long)stringPool.getNumBytes());
+    auto& elementPool = EntityTreeElement::getElementPool();
+    statsString += QString().sprintf("Element pool... %lld elements in %lld bytes\r\n",
+                                     (long long)elementPool.getNumBlocks(), (long long)elementPool.getNumBytes());
     statsString += "\r\n\r\n";
 
     statsString += "<b>Entity Server Sending to Viewer Statistics</b>\r\n";
@@ -455,6 +465,21 @@ QString EntityServer::serverSubclassStats() {
     }
     statsString += "\r\n\r\n";
 
+    auto entityEditFilters = DependencyManager::get<EntityEditFilters>();
+    if (entityEditFilters) {
+        statsString += "<b>Entity Edit Filter Latency</b>\r\n";
+        for (int i = 0; i < EntityEditFilters::NUM_LATENCY_BUCKETS; i++) {
+            auto bucket = (EntityEditFilters::LatencyBucket)i;
+            statsString += QString("%1 %2 edits\r\n")
+                .arg(EntityEditFilters::getLatencyBucketName(bucket).rightJustified(COLUMN_WIDTH, ' '))
+                .arg(locale.toString((qulonglong)entityEditFilters->getNumFilteredInBucket(bucket)).rightJustified(COLUMN_WIDTH, ' '));
+        }
+        statsString += QString("%1 %2 edits\r\n")
+            .arg(QString("rejected by rules").rightJustified(COLUMN_WIDTH, ' '))
+            .arg(locale.toString((qulonglong)entityEditFilters->getNumRejectedByRules()).rightJustified(COLUMN_WIDTH, ' '));
+        statsString += "\r\n\r\n";
+    }
+
     return statsString;
 }
 
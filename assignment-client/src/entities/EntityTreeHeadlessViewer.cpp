@@ -10,8 +10,19 @@
 //
 
 #include "EntityTreeHeadlessViewer.h"
+
+#include <algorithm>
+
+#include <QtCore/QJsonArray>
+
+#include <EntityNodeData.h>
+#include <NumericalConstants.h>
+
 #include "SimpleEntitySimulation.h"
 
+// how often the entities that moved out of the query regions are removed
+static const quint64 FORGET_INTERVAL_USECS = USECS_PER_SECOND;
+
 EntityTreeHeadlessViewer::EntityTreeHeadlessViewer()
     :   OctreeHeadlessViewer(), _simulation(NULL) {
 }
@@ -40,7 +51,57 @@ void EntityTreeHeadlessViewer::update() {
             tree->preUpdate();
             tree->update();
         });
+
+        // the entity server stops updating the entities that moved out of the regions, they would stay as they were
+        if (!_queryRegions.empty() && usecTimestampNow() - _lastForgetTime > FORGET_INTERVAL_USECS) {
+            forgetEntitiesOutsideRegions();
+        }
+    }
+}
+
+void EntityTreeHeadlessViewer::setQueryRegions(const QVariantList& regions) {
+    auto jsonRegions = QJsonArray::fromVariantList(regions);
+    auto& octreeQuery = getOctreeQuery();
+    auto parameters = octreeQuery.getJSONParameters();
+    if (jsonRegions.isEmpty()) {
+        parameters.remove(EntityJSONQueryProperties::REGIONS_PROPERTY);
+    } else {
+        parameters[EntityJSONQueryProperties::REGIONS_PROPERTY] = jsonRegions;
     }
+    octreeQuery.setJSONParameters(parameters);
+
+    _queryRegions = DiffTraversal::QueryRegion::fromJSON(jsonRegions);
+    if (!_queryRegions.empty()) {
+        forgetEntitiesOutsideRegions();
+    }
+}
+
+void EntityTreeHeadlessViewer::setQueryFilter(const QVariantMap& filter) {
+    auto& octreeQuery = getOctreeQuery();
+    auto oldParameters = octreeQuery.getJSONParameters();
+    auto parameters = QJsonObject::fromVariantMap(filter);
+    // the regions and the flags aren't part of the property filter
+    for (const auto& key : { EntityJSONQueryProperties::REGIONS_PROPERTY, EntityJSONQueryProperties::FLAGS_PROPERTY }) {
+        parameters.remove(key);
+        if (oldParameters.contains(key)) {
+            parameters[key] = oldParameters[key];
+        }
+    }
+    octreeQuery.setJSONParameters(parameters);
+}
+
+void EntityTreeHeadlessViewer::forgetEntitiesOutsideRegions() {
+    _lastForgetTime = usecTimestampNow();
+    if (!_tree) {
+        return;
+    }
+    std::static_pointer_cast<EntityTree>(_tree)->forgetEntities([&](const EntityItemPointer& entity) {
+        bool success = false;
+        auto cube = entity->getQueryAACube(success);
+        return success && std::none_of(_queryRegions.begin(), _queryRegions.end(), [&](const DiffTraversal::QueryRegion& region) {
+            return region.touches(cube);
+        });
+    });
 }
 
 void EntityTreeHeadlessViewer::processEraseMessage(ReceivedMessage& message, const SharedNodePointer& sourceNode) {
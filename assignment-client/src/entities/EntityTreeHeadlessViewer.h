@@ -18,6 +18,8 @@
 #include <OctreePacketData.h>
 #include <ViewFrustum.h>
 
+#include <DiffTraversal.h>
+
 #include "../octree/OctreeHeadlessViewer.h"
 #include "EntityTree.h"
 
@@ -52,6 +54,33 @@ public:
 
     virtual void init() override;
 
+public slots:
+
+    /**jsdoc
+     * A box <code>{ corner, dimensions }</code> or a sphere <code>{ center, radius }</code>, in world coordinates.
+     * @typedef {object} EntityViewer.QueryRegion
+     * @property {Vec3} [corner] - The minimum corner of the box.
+     * @property {Vec3} [dimensions] - The dimensions of the box.
+     * @property {Vec3} [center] - The center of the sphere.
+     * @property {number} [radius] - The radius of the sphere.
+     */
+    /**jsdoc
+     * Limits the entities that the entity server sends, and that the viewer keeps, to those that touch one of the regions.
+     * Entities that the viewer already has outside of the regions are removed from it. This takes effect with the next
+     * {@link EntityViewer.queryOctree|queryOctree}.
+     * @function EntityViewer.setQueryRegions
+     * @param {Array.<EntityViewer.QueryRegion>} regions - The regions. An empty array removes the limit.
+     */
+    void setQueryRegions(const QVariantList& regions);
+
+    /**jsdoc
+     * Limits the entities that the entity server sends to those that match the property filter, for example
+     * <code>{ type: "Zone" }</code>. This takes effect with the next {@link EntityViewer.queryOctree|queryOctree}.
+     * @function EntityViewer.setQueryFilter
+     * @param {object} filter - The property filter. An empty object removes the filter.
+     */
+    void setQueryFilter(const QVariantMap& filter);
+
 protected:
     virtual OctreePointer createTree() override {
         EntityTreePointer newTree = EntityTreePointer(new EntityTree(true));
@@ -59,7 +88,12 @@ protected:
         return newTree;
     }
 
+    void forgetEntitiesOutsideRegions();
+
     EntitySimulationPointer _simulation;
+
+    std::vector<DiffTraversal::QueryRegion> _queryRegions;
+    quint64 _lastForgetTime { 0 };
 };
 
 #endif // hifi_EntityTreeHeadlessViewer_h
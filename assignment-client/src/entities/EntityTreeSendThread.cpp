@@ -11,9 +11,13 @@
 
 #include "EntityTreeSendThread.h"
 
+#include <glm/gtx/norm.hpp>
+
 #include <EntityNodeData.h>
 #include <EntityTypes.h>
+#include <NumericalConstants.h>
 #include <OctreeUtils.h>
+#include <workload/Region.h>
 
 #include "EntityServer.h"
 
@@ -32,9 +36,66 @@ void EntityTreeSendThread::resetState() {
     qCDebug(entities) << "Clearing known EntityTreeSendThread state for" << _nodeUuid;
 
     _knownState.clear();
+    _deferredUpdates.clear();
     _traversal.reset();
 }
 
+// the shortest time between two updates of an entity, by region
+static const uint64_t REGION_UPDATE_INTERVALS[workload::Region::NUM_KNOWN_REGIONS] = {
+    0,                          // R1: at the full rate
+    100 * USECS_PER_MSEC,       // R2
+    500 * USECS_PER_MSEC,       // R3
+    2 * USECS_PER_SECOND        // R4: in view, beyond all of the regions
+};
+
+uint8_t EntityTreeSendThread::computeRegion(const EntityItemPointer& entity) const {
+    bool success = false;
+    auto cube = entity->getQueryAACube(success);
+    if (!success || _regionViews.empty()) {
+        return workload::Region::R1;
+    }
+    glm::vec3 center = cube.calcCenter();
+    float radius = 0.5f * SQRT_THREE * cube.getScale();
+
+    // the same test as workload::Space
+    uint8_t region = workload::Region::R4;
+    for (const auto& view : _regionViews) {
+        for (uint8_t k = 0; k < region; ++k) {
+            float touchDistance = radius + view.regions[k].w;
+            if (glm::distance2(center, glm::vec3(view.regions[k])) < touchDistance * touchDistance) {
+                region = k;
+                break;
+            }
+        }
+    }
+    return region;
+}
+
+bool EntityTreeSendThread::deferUpdate(const EntityItemPointer& entity, uint64_t lastSent) {
+    if (usecTimestampNow() - lastSent >= REGION_UPDATE_INTERVALS[computeRegion(entity)]) {
+        return false;
+    }
+    _deferredUpdates[entity.get()] = entity;
+    return true;
+}
+
+void EntityTreeSendThread::queueDueUpdates() {
+    for (auto itr = _deferredUpdates.begin(); itr != _deferredUpdates.end();) {
+        EntityItemPointer entity = itr->second.lock();
+        auto knownTimestamp = _knownState.find(itr->first);
+        if (!entity || knownTimestamp == _knownState.end()) {
+            itr = _deferredUpdates.erase(itr);
+        } else if (usecTimestampNow() - knownTimestamp->second >= REGION_UPDATE_INTERVALS[computeRegion(entity)]) {
+            if (!_sendQueue.contains(entity.get())) {
+                _sendQueue.emplace(entity, PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY);
+            }
+            itr = _deferredUpdates.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+}
+
 void EntityTreeSendThread::preDistributionProcessing() {
     auto node = _node.toStrongRef();
     auto nodeData = static_cast<EntityNodeData*>(node->getLinkedData());
@@ -107,12 +168,32 @@ bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, O
 
         DiffTraversal::View newView;
         newView.viewFrustums = nodeData->getCurrentViews();
+        auto jsonRegions = nodeData->getJSONParameters()[EntityJSONQueryProperties::REGIONS_PROPERTY].toArray();
+        newView.regions = DiffTraversal::QueryRegion::fromJSON(jsonRegions);
 
         int32_t lodLevelOffset = nodeData->getBoundaryLevelAdjust() + (viewFrustumChanged ? LOW_RES_MOVING_ADJUST : NO_BOUNDARY_ADJUST);
         newView.lodScaleFactor = powf(2.0f, lodLevelOffset);
-        
+        newView.prioritizeCollidables = nodeData->wantReportInitialCompletion();
+
+        _regionViews.clear();
+        for (const auto& frustum : newView.viewFrustums) {
+            workload::View regionView;
+            regionView.origin = frustum.getPosition();
+            regionView.direction = frustum.getDirection();
+            workload::View::updateRegionsDefault(regionView);
+            _regionViews.push_back(regionView);
+        }
+
         startNewTraversal(newView, root, isFullScene);
 
+        // viewers with very similar views share one traversal of the tree, we only filter its elements
+        auto& sharedTraversals = static_cast<EntityServer*>(_myServer)->getSharedTraversals();
+        sharedTraversals.updateView(_nodeUuid, newView);
+        auto sharedTraversal = sharedTraversals.getTraversal(newView, root);
+        if (sharedTraversal) {
+            _traversal.useSharedTraversal(sharedTraversal);
+        }
+
         // When the viewFrustum changed the sort order may be incorrect, so we re-sort
         // and also use the opportunity to cull anything no longer in view
         if (viewFrustumChanged && !_sendQueue.empty()) {
@@ -155,6 +236,10 @@ bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, O
         OctreeServer::trackTreeTraverseTime((float)(usecTimestampNow() - startTime));
     }
 
+    if (!_deferredUpdates.empty()) {
+        queueDueUpdates();
+    }
+
     bool sendComplete = OctreeSendThread::traverseTreeAndSendContents(node, nodeData, viewFrustumChanged, isFullScene);
 
     if (sendComplete && nodeData->wantReportInitialCompletion() && _traversal.finished()) {
@@ -272,8 +357,9 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
                             const auto& view = _traversal.getCurrentView();
                             priority = view.computePriority(entity);
 
-                        } else if (entity->getLastEdited() > knownTimestamp->second ||
-                                   entity->getLastChangedOnServer() > knownTimestamp->second) {
+                        } else if ((entity->getLastEdited() > knownTimestamp->second ||
+                                    entity->getLastChangedOnServer() > knownTimestamp->second) &&
+                                   !deferUpdate(entity, knownTimestamp->second)) {
                             // it is known and it changed --> put it on the queue with any priority
                             // TODO: sort these correctly
                             priority = PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
@@ -287,7 +373,7 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
             });
             break;
         case DiffTraversal::Differential:
-            assert(view.usesViewFrustums());
+            assert(view.usesViewFrustums() || view.usesRegions());
             _traversal.setScanCallback([this] (DiffTraversal::VisibleElement& next) {
                 next.element->forEachEntity([&](EntityItemPointer entity) {
                     // Bail early if we've already checked this entity this frame
@@ -301,8 +387,9 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
                         const auto& view = _traversal.getCurrentView();
                         priority = view.computePriority(entity);
 
-                    } else if (entity->getLastEdited() > knownTimestamp->second ||
-                               entity->getLastChangedOnServer() > knownTimestamp->second) {
+                    } else if ((entity->getLastEdited() > knownTimestamp->second ||
+                                entity->getLastChangedOnServer() > knownTimestamp->second) &&
+                               !deferUpdate(entity, knownTimestamp->second)) {
                         // it is known and it changed --> put it on the queue with any priority
                         // TODO: sort these correctly
                         priority = PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
@@ -420,14 +507,15 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
 
 void EntityTreeSendThread::editingEntityPointer(const EntityItemPointer& entity) {
     if (entity) {
-        if (!_sendQueue.contains(entity.get()) && _knownState.find(entity.get()) != _knownState.end()) {
+        auto knownTimestamp = _knownState.find(entity.get());
+        if (!_sendQueue.contains(entity.get()) && knownTimestamp != _knownState.end()) {
             const auto& view = _traversal.getCurrentView();
             float priority = view.computePriority(entity);
 
             // We can force a removal from _knownState if the current view is used and entity is out of view
             if (priority == PrioritizedEntity::DO_NOT_SEND) {
                 _sendQueue.emplace(entity, PrioritizedEntity::FORCE_REMOVE, true);
-            } else if (priority == PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY) {
+            } else if (priority == PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY && !deferUpdate(entity, knownTimestamp->second)) {
                 _sendQueue.emplace(entity, PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY, true);
             }
         }
@@ -436,4 +524,5 @@ void EntityTreeSendThread::editingEntityPointer(const EntityItemPointer& entity)
 
 void EntityTreeSendThread::deletingEntityPointer(EntityItem* entity) {
     _knownState.erase(entity);
+    _deferredUpdates.erase(entity);
 }
@@ -19,6 +19,7 @@
 #include <DiffTraversal.h>
 #include <EntityPriorityQueue.h>
 #include <shared/ConicalViewFrustum.h>
+#include <workload/View.h>
 
 
 class EntityNodeData;
@@ -49,9 +50,18 @@ private:
     bool hasSomethingToSend(OctreeQueryNode* nodeData) override { return !_sendQueue.empty(); }
     bool shouldStartNewTraversal(OctreeQueryNode* nodeData, bool viewFrustumChanged) override { return viewFrustumChanged || _traversal.finished(); }
 
+    // The updates of known entities are sent at the cadence of the workload region they are in for this viewer,
+    // classified against the default workload regions of its views as the interface does.
+    uint8_t computeRegion(const EntityItemPointer& entity) const;
+    // true when it is too early to send the update, and the entity is kept to be queued once it is due
+    bool deferUpdate(const EntityItemPointer& entity, uint64_t lastSent);
+    void queueDueUpdates();
+
     DiffTraversal _traversal;
     EntityPriorityQueue _sendQueue;
     std::unordered_map<EntityItem*, uint64_t> _knownState;
+    std::unordered_map<EntityItem*, EntityItemWeakPointer> _deferredUpdates;
+    std::vector<workload::View> _regionViews;
 
     // packet construction stuff
     EntityTreeElementExtraEncodeDataPointer _extraEncodeData { new EntityTreeElementExtraEncodeData() };
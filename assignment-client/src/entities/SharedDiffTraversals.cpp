@@ -0,0 +1,61 @@
+//
+//  SharedDiffTraversals.cpp
+//  assignment-client/src/entities
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SharedDiffTraversals.h"
+
+#include <algorithm>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+// elements added to the tree after a shared traversal started are only found by the next one,
+// so we keep them short lived
+static const quint64 MAX_SHARED_TRAVERSAL_AGE = 200 * USECS_PER_MSEC;
+static const int MIN_VIEWERS_PER_SHARED_TRAVERSAL = 2;
+
+void SharedDiffTraversals::updateView(const QUuid& viewerID, const DiffTraversal::View& view) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _views[viewerID] = view;
+}
+
+void SharedDiffTraversals::removeViewer(const QUuid& viewerID) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _views.erase(viewerID);
+}
+
+DiffTraversal::SharedTraversalPointer SharedDiffTraversals::getTraversal(const DiffTraversal::View& view,
+                                                                         const EntityTreeElementPointer& root) {
+    // we build under the lock so that the other viewers of the group wait for this traversal instead of repeating it
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    quint64 now = usecTimestampNow();
+    _traversals.erase(std::remove_if(_traversals.begin(), _traversals.end(),
+                                     [&](const DiffTraversal::SharedTraversalPointer& traversal) {
+        return now - traversal->view.startTime > MAX_SHARED_TRAVERSAL_AGE;
+    }), _traversals.end());
+
+    auto it = std::find_if(_traversals.begin(), _traversals.end(), [&](const DiffTraversal::SharedTraversalPointer& traversal) {
+        return traversal->view.isVerySimilar(view);
+    });
+    if (it != _traversals.end()) {
+        return *it;
+    }
+
+    int numSimilarViews = (int)std::count_if(_views.begin(), _views.end(), [&](const decltype(_views)::value_type& entry) {
+        return entry.second.isVerySimilar(view);
+    });
+    if (numSimilarViews < MIN_VIEWERS_PER_SHARED_TRAVERSAL) {
+        return nullptr;
+    }
+
+    auto traversal = DiffTraversal::buildSharedTraversal(view, root);
+    _traversals.push_back(traversal);
+    return traversal;
+}
@@ -0,0 +1,41 @@
+//
+//  SharedDiffTraversals.h
+//  assignment-client/src/entities
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SharedDiffTraversals_h
+#define hifi_SharedDiffTraversals_h
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <DiffTraversal.h>
+#include <UUIDHasher.h>
+
+// Groups the viewers of the EntityServer whose views are very similar, so that the tree is traversed
+// once per group instead of once per viewer. Each EntityTreeSendThread then only filters the shared
+// list of elements against its own known state and view.
+class SharedDiffTraversals {
+public:
+    // the latest view of a viewer, used to decide if enough viewers share it to be worth a shared traversal
+    void updateView(const QUuid& viewerID, const DiffTraversal::View& view);
+    void removeViewer(const QUuid& viewerID);
+
+    // returns a recent traversal for a view very similar to this one, or builds it if other viewers also have
+    // a similar view, otherwise returns nullptr and the viewer should traverse the tree itself.
+    // Must be called with the tree read locked.
+    DiffTraversal::SharedTraversalPointer getTraversal(const DiffTraversal::View& view, const EntityTreeElementPointer& root);
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<QUuid, DiffTraversal::View, UUIDHasher> _views;
+    std::vector<DiffTraversal::SharedTraversalPointer> _traversals;
+};
+
+#endif // hifi_SharedDiffTraversals_h
@@ -11,12 +11,15 @@
 
 #include "MessagesMixer.h"
 
+#include <algorithm>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QJsonObject>
 #include <QBuffer>
 #include <LogHandler.h>
 #include <MessagesClient.h>
 #include <NodeList.h>
+#include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 
 const QString MESSAGES_MIXER_LOGGING_NAME = "messages-mixer";
@@ -31,40 +34,70 @@ MessagesMixer::MessagesMixer(ReceivedMessage& message) : ThreadedAssignment(mess
 }
 
 void MessagesMixer::nodeKilled(SharedNodePointer killedNode) {
-    for (auto& channel : _channelSubscribers) {
-        channel.remove(killedNode->getUUID());
+    auto channels = _subscriberChannels.take(killedNode->getUUID());
+    for (const auto& channel : channels) {
+        removeSubscriber(channel, killedNode->getUUID());
     }
 }
 
 void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
-    QString channel, message;
-    QByteArray data;
-    QUuid senderID;
-    bool isText;
-    MessagesClient::decodeMessagesPacket(receivedMessage, channel, isText, message, data, senderID);
+    // only the channel is read, the subscribers get the message as it was received
+    QString channel = MessagesClient::decodeMessagesChannel(receivedMessage);
+    const QByteArray message = receivedMessage->getMessage();
+
+    auto& stats = _channelStats[channel];
+    stats.messages++;
+    stats.bytesIn += message.size();
+
+    auto subscribers = _channelSubscribers.constFind(channel);
+    if (subscribers == _channelSubscribers.constEnd()) {
+        return;
+    }
 
+    // the message goes to the subscribers of its channel, without a look at the nodes that aren't
     auto nodeList = DependencyManager::get<NodeList>();
+    for (const auto& weakNode : *subscribers) {
+        auto node = weakNode.toStrongRef();
+        if (!node || !node->getActiveSocket()) {
+            continue;
+        }
 
-    nodeList->eachMatchingNode(
-        [&](const SharedNodePointer& node)->bool {
-        return node->getActiveSocket() && _channelSubscribers[channel].contains(node->getUUID());
-    },
-        [&](const SharedNodePointer& node) {
-        auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
-                                   MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
+        // the reliable packets are sequenced per connection, so each subscriber gets its own
+        auto packetList = NLPacketList::create(PacketType::MessagesData, QByteArray(), true, true);
+        packetList->setPriorityWeight(udt::PacketList::LATENCY_SENSITIVE_PRIORITY_WEIGHT);
+        packetList->write(message);
         nodeList->sendPacketList(std::move(packetList), *node);
-    });
+
+        stats.messagesOut++;
+        stats.bytesOut += message.size();
+    }
 }
 
 void MessagesMixer::handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
     QString channel = QString::fromUtf8(message->getMessage());
-    _channelSubscribers[channel] << senderNode->getUUID();
+    _channelSubscribers[channel].insert(senderNode->getUUID(), senderNode);
+    _subscriberChannels[senderNode->getUUID()] << channel;
 }
 
 void MessagesMixer::handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
     QString channel = QString::fromUtf8(message->getMessage());
-    if (_channelSubscribers.contains(channel)) {
-        _channelSubscribers[channel].remove(senderNode->getUUID());
+    auto channels = _subscriberChannels.find(senderNode->getUUID());
+    if (channels != _subscriberChannels.end() && channels->remove(channel)) {
+        if (channels->isEmpty()) {
+            _subscriberChannels.erase(channels);
+        }
+        removeSubscriber(channel, senderNode->getUUID());
+    }
+}
+
+void MessagesMixer::removeSubscriber(const QString& channel, const QUuid& nodeID) {
+    auto subscribers = _channelSubscribers.find(channel);
+    if (subscribers != _channelSubscribers.end()) {
+        subscribers->remove(nodeID);
+        // a channel nobody listens to anymore is forgotten
+        if (subscribers->isEmpty()) {
+            _channelSubscribers.erase(subscribers);
+        }
     }
 }
 
@@ -81,11 +114,28 @@ void MessagesMixer::sendStatsPacket() {
     });
 
     statsObject["messages"] = messagesMixerObject;
+
+    // the traffic of the channels since the last stats, per second
+    QJsonObject channelsObject;
+    float elapsedSeconds = std::max(_channelStatsTimer.restart(), (qint64)1) / (float)MSECS_PER_SECOND;
+    for (auto it = _channelStats.cbegin(); it != _channelStats.cend(); ++it) {
+        const auto& stats = it.value();
+        QJsonObject channelStats;
+        channelStats["subscribers"] = _channelSubscribers.value(it.key()).size();
+        channelStats["messages_in_per_second"] = stats.messages / elapsedSeconds;
+        channelStats["kbps_in"] = stats.bytesIn / elapsedSeconds / BYTES_PER_KILOBIT;
+        channelStats["messages_out_per_second"] = stats.messagesOut / elapsedSeconds;
+        channelStats["kbps_out"] = stats.bytesOut / elapsedSeconds / BYTES_PER_KILOBIT;
+        channelsObject[it.key()] = channelStats;
+    }
+    _channelStats.clear();
+    statsObject["channels"] = channelsObject;
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(statsObject);
 }
 
 void MessagesMixer::run() {
     ThreadedAssignment::commonInit(MESSAGES_MIXER_LOGGING_NAME, NodeType::MessagesMixer);
+    _channelStatsTimer.start();
     auto nodeList = DependencyManager::get<NodeList>();
     nodeList->addSetOfNodeTypesToNodeInterestSet({ NodeType::Agent, NodeType::EntityScriptServer });
 }
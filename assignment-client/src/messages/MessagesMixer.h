@@ -15,6 +15,9 @@
 #ifndef hifi_MessagesMixer_h
 #define hifi_MessagesMixer_h
 
+#include <QtCore/QElapsedTimer>
+
+#include <Node.h>
 #include <ThreadedAssignment.h>
 
 /// Handles assignments of type MessagesMixer - distribution of avatar data to various clients
@@ -34,7 +37,23 @@ private slots:
     void handleMessagesUnsubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
 
 private:
-    QHash<QString,QSet<QUuid>> _channelSubscribers;
+    struct ChannelStats {
+        quint64 messages { 0 };
+        quint64 bytesIn { 0 };
+        quint64 messagesOut { 0 };
+        quint64 bytesOut { 0 };
+    };
+
+    void removeSubscriber(const QString& channel, const QUuid& nodeID);
+
+    // the subscribers of each channel, and the channels of each subscriber so that a node that is killed is only
+    // removed from its own channels
+    QHash<QString, QHash<QUuid, QWeakPointer<Node>>> _channelSubscribers;
+    QHash<QUuid, QSet<QString>> _subscriberChannels;
+
+    // the traffic of the channels since the last stats packet
+    QHash<QString, ChannelStats> _channelStats;
+    QElapsedTimer _channelStatsTimer;
 };
 
 #endif // hifi_MessagesMixer_h
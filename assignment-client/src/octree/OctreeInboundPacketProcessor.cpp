@@ -42,6 +42,8 @@ void OctreeInboundPacketProcessor::resetStats() {
     _totalLockWaitTime = 0;
     _totalElementsInPacket = 0;
     _totalPackets = 0;
+    _lockWaitHistogram.reset();
+    _lockHoldHistogram.reset();
     _lastNackTime = usecTimestampNow();
 
     QWriteLocker locker(&_senderStatsLock);
@@ -154,52 +156,53 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
         }
         
         const unsigned char* editData = nullptr;
-        
-        while (message->getBytesLeftToRead() > 0) {
 
-            editData = reinterpret_cast<const unsigned char*>(message->getRawMessage() + message->getPosition());
+        // the edits in a packet are applied as one batch, so a client editing many entities at once doesn't make us
+        // hand the tree lock back and forth with the send threads for every one of them
+        quint64 startProcess, startLock = usecTimestampNow();
+        _myServer->getOctree()->withWriteLock([&] {
+            startProcess = usecTimestampNow();
+            while (message->getBytesLeftToRead() > 0) {
 
-            int maxSize = message->getBytesLeftToRead();
+                editData = reinterpret_cast<const unsigned char*>(message->getRawMessage() + message->getPosition());
 
-            if (debugProcessPacket) {
-                qDebug() << " --- inside while loop ---";
-                qDebug() << "    maxSize=" << maxSize;
-                qDebug("OctreeInboundPacketProcessor::processPacket() %hhu "
-                       "payload=%p payloadLength=%lld editData=%p payloadPosition=%lld maxSize=%d",
-                       (unsigned char)packetType, message->getRawMessage(), message->getSize(), editData,
-                        message->getPosition(), maxSize);
-            }
+                int maxSize = message->getBytesLeftToRead();
+
+                if (debugProcessPacket) {
+                    qDebug() << " --- inside while loop ---";
+                    qDebug() << "    maxSize=" << maxSize;
+                    qDebug("OctreeInboundPacketProcessor::processPacket() %hhu "
+                           "payload=%p payloadLength=%lld editData=%p payloadPosition=%lld maxSize=%d",
+                           (unsigned char)packetType, message->getRawMessage(), message->getSize(), editData,
+                            message->getPosition(), maxSize);
+                }
 
-            quint64 startProcess, startLock = usecTimestampNow();
-            int editDataBytesRead;
-            _myServer->getOctree()->withWriteLock([&] {
-                startProcess = usecTimestampNow();
-                editDataBytesRead =
+                int editDataBytesRead =
                     _myServer->getOctree()->processEditPacketData(*message, editData, maxSize, sendingNode);
-            });
-            quint64 endProcess = usecTimestampNow();
 
-            if (debugProcessPacket) {
-                qDebug() << "OctreeInboundPacketProcessor::processPacket() after processEditPacketData()..."
-                    << "editDataBytesRead=" << editDataBytesRead;
-            }
+                if (debugProcessPacket) {
+                    qDebug() << "OctreeInboundPacketProcessor::processPacket() after processEditPacketData()..."
+                        << "editDataBytesRead=" << editDataBytesRead;
+                }
 
-            editsInPacket++;
-            quint64 thisProcessTime = endProcess - startProcess;
-            quint64 thisLockWaitTime = startProcess - startLock;
-            processTime += thisProcessTime;
-            lockWaitTime += thisLockWaitTime;
+                editsInPacket++;
 
-            // skip to next edit record in the packet
-            message->seek(message->getPosition() + editDataBytesRead);
+                // skip to next edit record in the packet
+                message->seek(message->getPosition() + editDataBytesRead);
 
-            if (debugProcessPacket) {
-                qDebug() << "    editDataBytesRead=" << editDataBytesRead;
-                qDebug() << "    AFTER processEditPacketData payload position=" << message->getPosition();
-                qDebug() << "    AFTER processEditPacketData payload size=" << message->getSize();
-            }
+                if (debugProcessPacket) {
+                    qDebug() << "    editDataBytesRead=" << editDataBytesRead;
+                    qDebug() << "    AFTER processEditPacketData payload position=" << message->getPosition();
+                    qDebug() << "    AFTER processEditPacketData payload size=" << message->getSize();
+                }
 
-        }
+            }
+        });
+        quint64 endProcess = usecTimestampNow();
+        processTime = endProcess - startProcess;
+        lockWaitTime = startProcess - startLock;
+        _lockWaitHistogram.record(lockWaitTime);
+        _lockHoldHistogram.record(processTime);
 
         if (debugProcessPacket) {
             qDebug("OctreeInboundPacketProcessor::processPacket() DONE LOOPING FOR %hhu "
@@ -286,12 +289,11 @@ int OctreeInboundPacketProcessor::sendNackPackets() {
             continue;
         }
 
-        // retrieve sequence number stats of node, prune its missing set
+        // retrieve sequence number stats of node
         SequenceNumberStats& sequenceNumberStats = nodeStats.getIncomingEditSequenceNumberStats();
-        sequenceNumberStats.pruneMissingSet();
 
         // construct nack packet(s) for this node
-        const QSet<unsigned short int>& missingSequenceNumbers = sequenceNumberStats.getMissingSet();
+        const QSet<unsigned short int> missingSequenceNumbers = sequenceNumberStats.getMissingSet();
 
         auto it = missingSequenceNumbers.constBegin();
 
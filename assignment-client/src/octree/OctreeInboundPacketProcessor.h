@@ -14,6 +14,7 @@
 #ifndef hifi_OctreeInboundPacketProcessor_h
 #define hifi_OctreeInboundPacketProcessor_h
 
+#include <LatencyHistogram.h>
 #include <ReceivedPacketProcessor.h>
 
 #include "SequenceNumberStats.h"
@@ -70,6 +71,10 @@ public:
     quint64 getAverageLockWaitTimePerElement() const
                 { return _totalElementsInPacket == 0 ? 0 : _totalLockWaitTime / _totalElementsInPacket; }
 
+    // how long edit packets waited for the tree write lock, and how long they held it once they had it
+    const LatencyHistogram& getLockWaitHistogram() const { return _lockWaitHistogram; }
+    const LatencyHistogram& getLockHoldHistogram() const { return _lockHoldHistogram; }
+
     void resetStats();
 
     NodeToSenderStatsMap getSingleSenderStats() { QReadLocker locker(&_senderStatsLock); return _singleSenderStats; }
@@ -99,6 +104,8 @@ private:
     std::atomic<uint64_t> _totalLockWaitTime;
     std::atomic<uint64_t> _totalElementsInPacket;
     std::atomic<uint64_t> _totalPackets;
+    LatencyHistogram _lockWaitHistogram;
+    LatencyHistogram _lockHoldHistogram;
     
     NodeToSenderStatsMap _singleSenderStats;
     QReadWriteLock _senderStatsLock;
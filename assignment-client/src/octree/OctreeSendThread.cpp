@@ -18,6 +18,7 @@
 #include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
+#include <Profile.h>
 
 #include "OctreeServer.h"
 #include "OctreeServerConsts.h"
@@ -65,6 +66,19 @@ void OctreeSendThread::setIsShuttingDown() {
     _isShuttingDown = true;
 }
 
+void OctreeSendThread::initializePooled() {
+    _isPooled = true;
+    initialize(false);
+}
+
+bool OctreeSendThread::processPooled() {
+    if (!process()) {
+        emit finished();
+        return false;
+    }
+    return true;
+}
+
 
 bool OctreeSendThread::process() {
     if (_isShuttingDown) {
@@ -72,6 +86,7 @@ bool OctreeSendThread::process() {
     }
 
     OctreeServer::didProcess(this);
+    PROFILE_RANGE(network, "OctreeSendThread::process");
 
     quint64  start = usecTimestampNow();
 
@@ -112,7 +127,10 @@ bool OctreeSendThread::process() {
             usecToSleep = MIN_USEC_TO_SLEEP;
         }
 
-        {
+        if (_isPooled) {
+            // the worker sends to the other clients in the meantime
+            _nextSendAt = usecTimestampNow() + usecToSleep;
+        } else {
             PerformanceWarning warn(false,"OctreeSendThread... usleep()",false,&_usleepTime,&_usleepCalls);
             std::this_thread::sleep_for(std::chrono::microseconds(usecToSleep));
         }
@@ -321,6 +339,8 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
     _trueBytesSent = 0;
     _packetsSentThisInterval = 0;
 
+    updateSendBudget(node, nodeData);
+
     bool isFullScene = nodeData->shouldForceFullScene();
     if (isFullScene) {
         // we're forcing a full scene, clear the force in OctreeQueryNode so we don't force it next time again
@@ -337,6 +357,7 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
     targetSize = nodeData->getAvailable() - sizeof(OCTREE_PACKET_INTERNAL_SECTION_SIZE);
 
     _packetData.changeSettings(true, targetSize); // FIXME - eventually support only compressed packets
+    _packetData.setUseCompressionDictionary(nodeData->wantCompressionDictionary());
 
     // If the current view frustum has changed OR we have nothing to send, then search against
     // the current view frustum for things to send.
@@ -385,12 +406,8 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
         _totalSpecialBytes += specialBytesSent;
     }
 
-    // calculate max number of packets that can be sent during this interval
-    int clientMaxPacketsPerInterval = std::max(1, (nodeData->getMaxQueryPacketsPerSecond() / INTERVALS_PER_SECOND));
-    int maxPacketsPerInterval = std::min(clientMaxPacketsPerInterval, _myServer->getPacketsPerClientPerInterval());
-
     // Re-send packets that were nacked by the client
-    while (nodeData->hasNextNackedPacket() && _packetsSentThisInterval < maxPacketsPerInterval) {
+    while (nodeData->hasNextNackedPacket() && _packetsSentThisInterval < _maxPacketsThisInterval) {
         const NLPacket* packet = nodeData->getNextNackedPacket();
         if (packet) {
             DependencyManager::get<NodeList>()->sendUnreliablePacket(*packet, *node);
@@ -405,6 +422,15 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
         }
     }
 
+    if (nodeData->hasNextNackedPacket()) {
+        _wasBudgetLimited = true;
+    }
+
+    // spend what we sent from the bucket, the stats and special packets can overdraw it a little
+    _packetBudget = std::max(0.0f, _packetBudget - _packetsSentThisInterval);
+    _packetsSentSinceRateSample += _truePacketsSent;
+    updateAchievedRate();
+
     quint64 end = usecTimestampNow();
     int elapsedmsec = (end - start) / USECS_PER_MSEC;
     OctreeServer::trackLoopTime(elapsedmsec);
@@ -426,10 +452,7 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
 }
 
 bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData, bool viewFrustumChanged, bool isFullScene) {
-    // calculate max number of packets that can be sent during this interval
-    int clientMaxPacketsPerInterval = std::max(1, (nodeData->getMaxQueryPacketsPerSecond() / INTERVALS_PER_SECOND));
-    int maxPacketsPerInterval = std::min(clientMaxPacketsPerInterval, _myServer->getPacketsPerClientPerInterval());
-
+    PROFILE_RANGE(network, "traverseTreeAndSendContents");
     int extraPackingAttempts = 0;
 
     // init params once outside the while loop
@@ -441,7 +464,7 @@ bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, Octre
 
     bool somethingToSend = true; // assume we have something
     bool hadSomething = hasSomethingToSend(nodeData);
-    while (somethingToSend && _packetsSentThisInterval < maxPacketsPerInterval && !nodeData->isShuttingDown()) {
+    while (somethingToSend && _packetsSentThisInterval < _maxPacketsThisInterval && !nodeData->isShuttingDown()) {
         float compressAndWriteElapsedUsec = OctreeServer::SKIP_TIME;
         float packetSendingElapsedUsec = OctreeServer::SKIP_TIME;
 
@@ -465,7 +488,11 @@ bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, Octre
             if (_packetData.hasContent()) {
                 // yes, more data to send
                 quint64 compressAndWriteStart = usecTimestampNow();
-                unsigned int additionalSize = _packetData.getFinalizedSize() + sizeof(OCTREE_PACKET_INTERNAL_SECTION_SIZE);
+                int finalizedSize = _packetData.getFinalizedSize(); // compresses the section
+                nodeData->stats.sectionCompressed(_packetData.getUncompressedSize(), finalizedSize,
+                                                  usecTimestampNow() - compressAndWriteStart);
+
+                unsigned int additionalSize = finalizedSize + sizeof(OCTREE_PACKET_INTERNAL_SECTION_SIZE);
                 if (additionalSize > nodeData->getAvailable()) {
                     // no room --> flush what we've got
                     _packetsSentThisInterval += handlePacketSend(node, nodeData);
@@ -503,11 +530,85 @@ bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, Octre
         OctreeServer::trackInsideTime((float)(usecTimestampNow() - startInside));
     }
 
-    if (somethingToSend && _myServer->wantsVerboseDebug()) {
-        qCDebug(octree) << "Hit PPS Limit, packetsSentThisInterval =" << _packetsSentThisInterval
-                        << "  maxPacketsPerInterval = " << maxPacketsPerInterval
-                        << "  clientMaxPacketsPerInterval = " << clientMaxPacketsPerInterval;
+    if (somethingToSend) {
+        _wasBudgetLimited = true;
+
+        if (_myServer->wantsVerboseDebug()) {
+            qCDebug(octree) << "Hit PPS Limit, packetsSentThisInterval =" << _packetsSentThisInterval
+                            << "  maxPacketsThisInterval = " << _maxPacketsThisInterval
+                            << "  budgetedPacketsPerSecond = " << (float)_budgetedPacketsPerSecond;
+        }
     }
 
     return params.stopReason == EncodeBitstreamParams::FINISHED;
 }
+
+void OctreeSendThread::updateSendBudget(const SharedNodePointer& node, OctreeQueryNode* nodeData) {
+    // the limits from the client's query and from the server settings still cap the budget
+    int clientMaxPacketsPerInterval = std::max(1, (nodeData->getMaxQueryPacketsPerSecond() / INTERVALS_PER_SECOND));
+    int maxPacketsPerInterval = std::min(clientMaxPacketsPerInterval, _myServer->getPacketsPerClientPerInterval());
+    float maxPacketsPerSecond = (float)(maxPacketsPerInterval * INTERVALS_PER_SECOND);
+    float minPacketsPerSecond = std::min((float)INTERVALS_PER_SECOND, maxPacketsPerSecond);
+
+    quint64 now = usecTimestampNow();
+    float budget = _budgetedPacketsPerSecond;
+
+    if (_lastBudgetUpdate == 0) {
+        // start where the static limit would have had us, and back off from there if the client loses packets
+        budget = maxPacketsPerSecond;
+        _packetBudget = budget / INTERVALS_PER_SECOND;
+        _lastBudgetUpdate = now;
+        _lastBudgetAdjustment = now;
+        _lastRateSample = now;
+    }
+
+    _numNacksSinceAdjustment += nodeData->takeNumNackedPackets();
+
+    // adjust once per round trip of the client's connection, so that we see the effect of the last adjustment
+    const quint64 DEFAULT_ADJUSTMENT_INTERVAL_USECS = 100 * USECS_PER_MSEC;
+    auto connectionStats = node->getConnectionStats();
+    quint64 adjustmentInterval = connectionStats.rtt > 0 ? (quint64)connectionStats.rtt : DEFAULT_ADJUSTMENT_INTERVAL_USECS;
+
+    if (now - _lastBudgetAdjustment >= adjustmentInterval) {
+        const float BUDGET_DECREASE_FACTOR = 0.75f;
+        const float BUDGET_INCREASE_RATIO = 0.05f; // of the maximum, per round trip
+
+        if (_numNacksSinceAdjustment > 0) {
+            budget *= BUDGET_DECREASE_FACTOR;
+        } else if (_wasBudgetLimited) {
+            budget += maxPacketsPerSecond * BUDGET_INCREASE_RATIO;
+        }
+
+        _numNacksSinceAdjustment = 0;
+        _wasBudgetLimited = false;
+        _lastBudgetAdjustment = now;
+    }
+
+    // octree packets are unreliable and do not go through the connection's congestion control,
+    // but while it carries reliable traffic its window over its RTT is a rate the path to this client sustains
+    if (connectionStats.rtt > 0 && connectionStats.congestionWindowSize > 0 && connectionStats.sentPackets > 0) {
+        float connectionPacketsPerSecond = (float)connectionStats.congestionWindowSize * USECS_PER_SECOND / connectionStats.rtt;
+        budget = std::max(budget, std::min(connectionPacketsPerSecond, maxPacketsPerSecond));
+    }
+
+    budget = std::max(minPacketsPerSecond, std::min(budget, maxPacketsPerSecond));
+    _budgetedPacketsPerSecond = budget;
+
+    // refill the bucket for the time since the last pass, keeping at most a couple of intervals worth so we never burst
+    const float MAX_BURST_INTERVALS = 2.0f;
+    float elapsedSeconds = (float)(now - _lastBudgetUpdate) / USECS_PER_SECOND;
+    _packetBudget = std::min(_packetBudget + budget * elapsedSeconds, budget / INTERVALS_PER_SECOND * MAX_BURST_INTERVALS);
+    _lastBudgetUpdate = now;
+
+    _maxPacketsThisInterval = (int)_packetBudget;
+}
+
+void OctreeSendThread::updateAchievedRate() {
+    quint64 now = usecTimestampNow();
+    quint64 elapsed = now - _lastRateSample;
+    if (elapsed >= USECS_PER_SECOND) {
+        _achievedPacketsPerSecond = (float)_packetsSentSinceRateSample * USECS_PER_SECOND / elapsed;
+        _packetsSentSinceRateSample = 0;
+        _lastRateSample = now;
+    }
+}
@@ -38,6 +38,19 @@ public:
 
     QUuid getNodeUuid() const { return _nodeUuid; }
 
+    /// Sends from the worker of an OctreeSendWorkerPool rather than from a thread of its own
+    void initializePooled();
+
+    /// Sends to the client once, for the worker, returns false and emits finished once there's nothing left to do
+    bool processPooled();
+
+    /// When the worker should send to the client next
+    quint64 getNextSendAt() const { return _nextSendAt; }
+
+    // the adaptive send budget for this client and the rate actually sent over the last second
+    float getBudgetedPacketsPerSecond() const { return _budgetedPacketsPerSecond; }
+    float getAchievedPacketsPerSecond() const { return _achievedPacketsPerSecond; }
+
     static AtomicUIntStat _totalBytes;
     static AtomicUIntStat _totalWastedBytes;
     static AtomicUIntStat _totalPackets;
@@ -66,6 +79,8 @@ private:
     virtual void preDistributionProcessing() = 0;
     int handlePacketSend(SharedNodePointer node, OctreeQueryNode* nodeData, bool dontSuppressDuplicate = false);
     int packetDistributor(SharedNodePointer node, OctreeQueryNode* nodeData, bool viewFrustumChanged);
+    void updateSendBudget(const SharedNodePointer& node, OctreeQueryNode* nodeData);
+    void updateAchievedRate();
 
     virtual bool hasSomethingToSend(OctreeQueryNode* nodeData) = 0;
     virtual bool shouldStartNewTraversal(OctreeQueryNode* nodeData, bool viewFrustumChanged) = 0;
@@ -73,7 +88,25 @@ private:
     int _truePacketsSent { 0 }; // available for debug stats
     int _trueBytesSent { 0 }; // available for debug stats
     int _packetsSentThisInterval { 0 }; // used for bandwidth throttle condition
+
+    // Per client send budget, decreased when the client NACKs and increased while we have more to send,
+    // once per round trip of the client's connection. Packets are drawn from a bucket refilled at the budgeted
+    // rate each interval, rather than sent in bursts up to a static per interval limit.
+    std::atomic<float> _budgetedPacketsPerSecond { 0.0f };
+    float _packetBudget { 0.0f };
+    int _maxPacketsThisInterval { 0 };
+    bool _wasBudgetLimited { false };
+    int _numNacksSinceAdjustment { 0 };
+    quint64 _lastBudgetUpdate { 0 };
+    quint64 _lastBudgetAdjustment { 0 };
+
+    std::atomic<float> _achievedPacketsPerSecond { 0.0f };
+    int _packetsSentSinceRateSample { 0 };
+    quint64 _lastRateSample { 0 };
     bool _isShuttingDown { false };
+
+    bool _isPooled { false };
+    quint64 _nextSendAt { 0 };
 };
 
 #endif // hifi_OctreeSendThread_h
@@ -0,0 +1,156 @@
+//
+//  OctreeSendWorkerPool.cpp
+//  assignment-client/src/octree
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeSendWorkerPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+#include "OctreeSendThread.h"
+
+class OctreeSendWorkerPool::Worker : public QObject {
+public:
+    Worker(const QString& name) {
+        _thread.setObjectName(name);
+
+        _timer = new QTimer(this);
+        _timer->setSingleShot(true);
+        _timer->setTimerType(Qt::PreciseTimer);
+        connect(_timer, &QTimer::timeout, this, &Worker::sendToNextDue);
+
+        moveToThread(&_thread);
+        _thread.start();
+    }
+
+    ~Worker() {
+        QMetaObject::invokeMethod(this, [this] { _timer->stop(); }, Qt::BlockingQueuedConnection);
+        _thread.quit();
+        _thread.wait();
+    }
+
+    // called on the thread of the worker
+    void add(OctreeSendThread* sendThread) {
+        _due.emplace(usecTimestampNow(), sendThread);
+        scheduleNext();
+    }
+
+    // called on the thread of the worker
+    void remove(OctreeSendThread* sendThread, QThread* destination) {
+        auto it = std::find_if(_due.begin(), _due.end(), [&](const Due::value_type& due) { return due.second == sendThread; });
+        if (it != _due.end()) {
+            _due.erase(it);
+        }
+        sendThread->moveToThread(destination);
+        scheduleNext();
+    }
+
+    quint64 sampleMaxLagUsecs() { return _maxLagUsecs.exchange(0); }
+
+    int numSendThreads { 0 }; // only used from the thread of the pool
+
+private:
+    using Due = std::multimap<quint64, OctreeSendThread*>;
+
+    void sendToNextDue() {
+        if (_due.empty()) {
+            return;
+        }
+
+        auto now = usecTimestampNow();
+        auto next = _due.begin();
+        if (next->first <= now) {
+            auto sendThread = next->second;
+            quint64 lagUsecs = now - next->first;
+            _due.erase(next);
+
+            if (lagUsecs > _maxLagUsecs) {
+                _maxLagUsecs = lagUsecs;
+            }
+
+            // a send thread that is done stays out of the queue until it is removed
+            if (sendThread->processPooled()) {
+                _due.emplace(sendThread->getNextSendAt(), sendThread);
+            }
+        }
+        scheduleNext();
+    }
+
+    void scheduleNext() {
+        if (_due.empty()) {
+            _timer->stop();
+            return;
+        }
+
+        auto now = usecTimestampNow();
+        auto dueAt = _due.begin()->first;
+        int msecs = dueAt > now ? (int)((dueAt - now + USECS_PER_MSEC - 1) / USECS_PER_MSEC) : 0;
+        _timer->start(msecs);
+    }
+
+    QThread _thread;
+    QTimer* _timer { nullptr };
+    Due _due;
+    std::atomic<quint64> _maxLagUsecs { 0 };
+};
+
+OctreeSendWorkerPool::OctreeSendWorkerPool(int numWorkers, const QString& serverName) {
+    _workers.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        _workers.emplace_back(new Worker(QString("%1 Send Worker %2").arg(serverName).arg(i)));
+    }
+}
+
+OctreeSendWorkerPool::~OctreeSendWorkerPool() {
+    while (!_workerOfSendThread.empty()) {
+        remove(_workerOfSendThread.begin()->first);
+    }
+}
+
+void OctreeSendWorkerPool::add(OctreeSendThread* sendThread) {
+    auto worker = std::min_element(_workers.begin(), _workers.end(),
+        [](const std::unique_ptr<Worker>& a, const std::unique_ptr<Worker>& b) {
+            return a->numSendThreads < b->numSendThreads;
+        })->get();
+    ++worker->numSendThreads;
+    _workerOfSendThread[sendThread] = worker;
+
+    sendThread->moveToThread(worker->thread());
+    QMetaObject::invokeMethod(worker, [worker, sendThread] { worker->add(sendThread); });
+}
+
+void OctreeSendWorkerPool::remove(OctreeSendThread* sendThread) {
+    auto it = _workerOfSendThread.find(sendThread);
+    if (it == _workerOfSendThread.end()) {
+        return;
+    }
+    auto worker = it->second;
+    _workerOfSendThread.erase(it);
+    --worker->numSendThreads;
+
+    // queued behind the add, so the worker always has the send thread by the time it is removed
+    QThread* destination = QThread::currentThread();
+    QMetaObject::invokeMethod(worker, [worker, sendThread, destination] { worker->remove(sendThread, destination); },
+        Qt::BlockingQueuedConnection);
+}
+
+quint64 OctreeSendWorkerPool::sampleMaxLagUsecs() {
+    quint64 maxLagUsecs = 0;
+    for (auto& worker : _workers) {
+        maxLagUsecs = std::max(maxLagUsecs, worker->sampleMaxLagUsecs());
+    }
+    return maxLagUsecs;
+}
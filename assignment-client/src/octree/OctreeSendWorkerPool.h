@@ -0,0 +1,49 @@
+//
+//  OctreeSendWorkerPool.h
+//  assignment-client/src/octree
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeSendWorkerPool_h
+#define hifi_OctreeSendWorkerPool_h
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QString>
+
+class OctreeSendThread;
+
+/// Sends to the clients of an octree server from a fixed set of worker threads, rather than from a thread per client.
+/// Each worker keeps its clients ordered by when they are due for their next send and sends to one of them per pass
+/// of its event loop, so that the queued slots of the send threads it holds run between the sends. A client stays on
+/// the worker that had the fewest clients when it was added.
+class OctreeSendWorkerPool {
+public:
+    OctreeSendWorkerPool(int numWorkers, const QString& serverName);
+    ~OctreeSendWorkerPool();
+
+    int getNumWorkers() const { return (int)_workers.size(); }
+
+    /// Starts sending from one of the workers, the send thread is moved to the thread of that worker
+    void add(OctreeSendThread* sendThread);
+
+    /// Stops sending and moves the send thread back to the calling thread, waits for a send that is in progress
+    void remove(OctreeSendThread* sendThread);
+
+    /// The longest time a client waited past when it was due, since the last call
+    quint64 sampleMaxLagUsecs();
+
+private:
+    class Worker;
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::unordered_map<OctreeSendThread*, Worker*> _workerOfSendThread;
+};
+
+#endif // hifi_OctreeSendWorkerPool_h
@@ -427,6 +427,12 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
 
         statsString += QString("          Total Clients Connected: %1 clients\r\n")
             .arg(locale.toString((uint)getCurrentClientCount()).rightJustified(COLUMN_WIDTH, ' '));
+        if (_sendWorkerPool) {
+            statsString += QString("                     Send Workers: %1 workers\r\n")
+                .arg(locale.toString((uint)_sendWorkerPool->getNumWorkers()).rightJustified(COLUMN_WIDTH, ' '));
+            statsString += QString("          Send Worker Lag (max): %1 usecs\r\n")
+                .arg(locale.toString((uint)_sendWorkerPool->sampleMaxLagUsecs()).rightJustified(COLUMN_WIDTH, ' '));
+        }
 
         quint64 oneSecondAgo = usecTimestampNow() - USECS_PER_SECOND;
 
@@ -439,6 +445,24 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
         statsString += QString("      writeDatagram() last second: %1 clients\r\n\r\n")
             .arg(locale.toString((uint)howManyThreadsDidCallWriteDatagram(oneSecondAgo)).rightJustified(COLUMN_WIDTH, ' '));
 
+        // the adaptive send budget of each client, next to what was actually sent to it
+        float totalBudgetedPacketsPerSecond = 0.0f;
+        float totalAchievedPacketsPerSecond = 0.0f;
+        for (auto& it : _sendThreads) {
+            float budgeted = it.second->getBudgetedPacketsPerSecond();
+            float achieved = it.second->getAchievedPacketsPerSecond();
+            totalBudgetedPacketsPerSecond += budgeted;
+            totalAchievedPacketsPerSecond += achieved;
+
+            statsString += QString("    %1 sent/budget: %2 / %3 pps\r\n")
+                .arg(uuidStringWithoutCurlyBraces(it.first).left(8))
+                .arg(locale.toString((uint)achieved).rightJustified(COLUMN_WIDTH, ' '))
+                .arg(locale.toString((uint)budgeted).rightJustified(COLUMN_WIDTH, ' '));
+        }
+        statsString += QString("       Total sent/budget: %1 / %2 pps\r\n\r\n")
+            .arg(locale.toString((uint)totalAchievedPacketsPerSecond).rightJustified(COLUMN_WIDTH, ' '))
+            .arg(locale.toString((uint)totalBudgetedPacketsPerSecond).rightJustified(COLUMN_WIDTH, ' '));
+
         float averageLoopTime = getAverageLoopTime();
         statsString += QString().sprintf("           Average packetLoop() time:      %7.2f msecs"
                                          "                 samples: %12d \r\n",
@@ -691,6 +715,24 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
         statsString += QString("  Average Wait Lock Time/Element: %1 usecs\r\n")
             .arg(locale.toString((uint)averageLockWaitTimePerElement).rightJustified(COLUMN_WIDTH, ' '));
 
+        // the edits of all senders go through the one tree write lock, a long tail here stalls every edit behind it
+        auto appendLockHistogram = [&](const QString& title, const LatencyHistogram& histogram) {
+            statsString += QString("\r\n     %1 -------------------------\r\n").arg(title);
+            statsString += QString("                             Maximum: %1 usecs\r\n")
+                .arg(locale.toString((uint)histogram.getMaxUsecs()).rightJustified(COLUMN_WIDTH, ' '));
+            for (int i = 0; i < LatencyHistogram::NUM_BUCKETS; ++i) {
+                auto count = histogram.getCount(i);
+                if (count > 0) {
+                    statsString += QString("%1: %2 packets\r\n")
+                        .arg(LatencyHistogram::getBucketName(i).rightJustified(36, ' '))
+                        .arg(locale.toString(count).rightJustified(COLUMN_WIDTH, ' '));
+                }
+            }
+        };
+        appendLockHistogram("Edit Lock Wait Times", _octreeInboundPacketProcessor->getLockWaitHistogram());
+        appendLockHistogram("Edit Lock Hold Times", _octreeInboundPacketProcessor->getLockHoldHistogram());
+        statsString += "\r\n";
+
         statsString += QString("             Average Decode Time: %1 usecs\r\n")
             .arg(locale.toString((uint)averageDecodeTime).rightJustified(COLUMN_WIDTH, ' '));
         statsString += QString("             Average Lookup Time: %1 usecs\r\n")
@@ -795,9 +837,6 @@ bool OctreeServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
                                          OctreeElement::getOctreeMemoryUsage() / (double)memoryScale, memoryScaleLabel);
         statsString += QString().sprintf("Octcode Memory Usage:            %8.2f %s\r\n",
                                          OctreeElement::getOctcodeMemoryUsage() / (double)memoryScale, memoryScaleLabel);
-        statsString += QString().sprintf("External Children Memory Usage:  %8.2f %s\r\n",
-                                         OctreeElement::getExternalChildrenMemoryUsage() / (double)memoryScale,
-                                         memoryScaleLabel);
         statsString += "                                 -----------\r\n";
         statsString += QString().sprintf("                         Total:  %8.2f %s\r\n",
                                          OctreeElement::getTotalMemoryUsage() / (double)memoryScale, memoryScaleLabel);
@@ -878,16 +917,31 @@ OctreeServer::UniqueSendThread OctreeServer::createSendThread(const SharedNodePo
 
     // we want to be notified when the thread finishes
     connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread);
-    sendThread->initialize(true);
+    if (_sendWorkerPool) {
+        sendThread->initializePooled();
+        _sendWorkerPool->add(sendThread.get());
+    } else {
+        sendThread->initialize(true);
+    }
 
     return sendThread;
 }
 
+OctreeServer::SendThreads::iterator OctreeServer::eraseSendThread(SendThreads::iterator it) {
+    if (_sendWorkerPool) {
+        _sendWorkerPool->remove(it->second.get());
+    }
+    return _sendThreads.erase(it);
+}
+
 void OctreeServer::removeSendThread() {
     // If the object has been deleted since the event was queued, sender() will return nullptr
     if (auto sendThread = qobject_cast<OctreeSendThread*>(sender())) {
-        // This deletes the unique_ptr, so sendThread is destructed after that line
-        _sendThreads.erase(sendThread->getNodeUuid());
+        auto it = _sendThreads.find(sendThread->getNodeUuid());
+        if (it != _sendThreads.end() && it->second.get() == sendThread) {
+            // This deletes the unique_ptr, so sendThread is destructed after that line
+            eraseSendThread(it);
+        }
     }
 }
 
@@ -902,7 +956,7 @@ void OctreeServer::handleOctreeQueryPacket(QSharedPointer<ReceivedMessage> messa
         if (it == _sendThreads.end()) {
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
         } else if (it->second->isShuttingDown()) {
-            _sendThreads.erase(it); // Remove right away and wait on thread to be
+            eraseSendThread(it); // Remove right away and wait on thread to be
 
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
         }
@@ -1047,7 +1101,11 @@ void OctreeServer::readConfiguration() {
         qDebug() << "persistFilePath=" << _persistFilePath;
         qDebug() << "persisAbsoluteFilePath=" << _persistAbsoluteFilePath;
 
-        _persistAsFileType = "json.gz";
+        bool persistAsBinary = false;
+        readOptionBool(QString("persistAsBinary"), settingsSectionObject, persistAsBinary);
+        _persistAsFileType = persistAsBinary ? "bin" : "json.gz";
+
+        readOptionBool(QString("persistJournal"), settingsSectionObject, _persistJournal);
 
         _persistInterval = OctreePersistThread::DEFAULT_PERSIST_INTERVAL;
         int result { -1 };
@@ -1096,6 +1154,12 @@ void OctreeServer::readConfiguration() {
     qDebug("packetsPerSecondTotalMax=%d _packetsTotalPerInterval=%d",
                     packetsPerSecondTotalMax, _packetsTotalPerInterval);
 
+    // Check to see if the clients should be sent to from a pool of workers rather than from a thread each
+    if (readOptionInt(QString("sendWorkers"), settingsSectionObject, _numSendWorkers)) {
+        _numSendWorkers = std::max(_numSendWorkers, 0);
+    }
+    qDebug("sendWorkers=%d", _numSendWorkers);
+
 
     readAdditionalConfiguration(settingsSectionObject);
 }
@@ -1186,7 +1250,7 @@ void OctreeServer::domainSettingsRequestComplete() {
 
         // now set up PersistThread
         _persistManager = new OctreePersistThread(_tree, _persistAbsoluteFilePath, _persistInterval, _debugTimestampNow,
-                                                 _persistAsFileType);
+                                                 _persistAsFileType, _persistJournal);
         _persistManager->moveToThread(&_persistThread);
         connect(&_persistThread, &QThread::finished, _persistManager, &QObject::deleteLater);
         connect(&_persistThread, &QThread::started, _persistManager, &OctreePersistThread::start);
@@ -1219,6 +1283,10 @@ void OctreeServer::beginRunning() {
 
     srand((unsigned)time(0));
 
+    if (_numSendWorkers > 0) {
+        _sendWorkerPool.reset(new OctreeSendWorkerPool(_numSendWorkers, _safeServerName));
+    }
+
     // set up our OctreeServerPacketProcessor
     _octreeInboundPacketProcessor = new OctreeInboundPacketProcessor(this);
     _octreeInboundPacketProcessor->initialize(true);
@@ -1292,12 +1360,16 @@ void OctreeServer::aboutToFinish() {
     for (auto& it : _sendThreads) {
         auto& sendThread = *it.second;
         sendThread.setIsShuttingDown();
+        if (_sendWorkerPool) {
+            _sendWorkerPool->remove(&sendThread);
+        }
         sendThread.terminate();
     }
 
     // Clear will destruct all the unique_ptr to OctreeSendThreads which will call the GenericThread's dtor
     // which waits on the thread to be done before returning
     _sendThreads.clear(); // Cleans up all the send threads.
+    _sendWorkerPool.reset();
 
     if (_persistManager) {
         _persistThread.quit();
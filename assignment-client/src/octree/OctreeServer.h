@@ -24,6 +24,7 @@
 
 #include "OctreePersistThread.h"
 #include "OctreeSendThread.h"
+#include "OctreeSendWorkerPool.h"
 #include "OctreeServerConsts.h"
 #include "OctreeInboundPacketProcessor.h"
 
@@ -166,6 +167,8 @@ protected:
     
     UniqueSendThread createSendThread(const SharedNodePointer& node);
     virtual UniqueSendThread newSendThread(const SharedNodePointer& node) = 0;
+    // takes a pooled send thread off its worker before it is destructed
+    SendThreads::iterator eraseSendThread(SendThreads::iterator it);
 
     int _argc;
     const char** _argv;
@@ -181,6 +184,7 @@ protected:
     QString _persistFilePath;
     QString _persistAbsoluteFilePath;
     QString _persistAsFileType;
+    bool _persistJournal { false };
     int _packetsPerClientPerInterval;
     int _packetsTotalPerInterval;
     OctreePointer _tree; // this IS a reaveraging tree
@@ -203,6 +207,10 @@ protected:
     
     SendThreads _sendThreads;
 
+    // when set, the clients are sent to from this many workers rather than from a thread each
+    int _numSendWorkers { 0 };
+    std::unique_ptr<OctreeSendWorkerPool> _sendWorkerPool;
+
     static int _clientCount;
     static SimpleMovingAverage _averageLoopTime;
 
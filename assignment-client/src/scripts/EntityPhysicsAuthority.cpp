@@ -0,0 +1,88 @@
+//
+//  EntityPhysicsAuthority.cpp
+//  assignment-client/src/scripts
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityPhysicsAuthority.h"
+
+#include <GLMHelpers.h>
+#include <PhysicsHelpers.h>
+#include <SimulationFlags.h>
+#include <workload/Region.h>
+
+EntityPhysicsAuthority::EntityPhysicsAuthority(const EntityTreePointer& tree, EntityEditPacketSender* packetSender,
+                                               const std::vector<QUuid>& zoneIDs) :
+    _tree(tree),
+    _zoneIDs(zoneIDs)
+{
+    ObjectMotionState::setShapeManager(&_shapeManager);
+    EntityMotionState::setMinimumBidPriority(AUTHORITATIVE_SIMULATION_PRIORITY);
+
+    _physicsEngine = std::make_shared<PhysicsEngine>(Vectors::ZERO);
+    _physicsEngine->init();
+
+    _entitySimulation = std::make_shared<PhysicalEntitySimulation>();
+    _entitySimulation->init(_tree, _physicsEngine, packetSender);
+    _entitySimulation->setRegionOperator([this](const EntityItemPointer& entity) {
+        return computeRegion(entity);
+    });
+}
+
+EntityPhysicsAuthority::~EntityPhysicsAuthority() {
+    if (_tree->getSimulation() == _entitySimulation) {
+        _tree->setSimulation(nullptr);
+    } else {
+        _entitySimulation->clearEntities();
+    }
+    EntityMotionState::setMinimumBidPriority(0);
+}
+
+void EntityPhysicsAuthority::setSessionUUID(const QUuid& sessionUUID) {
+    Physics::setSessionUUID(sessionUUID);
+}
+
+uint8_t EntityPhysicsAuthority::computeRegion(const EntityItemPointer& entity) const {
+    glm::vec3 position = entity->getWorldPosition();
+    for (const auto& zoneID : _zoneIDs) {
+        EntityItemPointer zone = _tree->findEntityByEntityItemID(zoneID);
+        if (zone && zone->getType() == EntityTypes::Zone && zone->contains(position)) {
+            return workload::Region::R1;
+        }
+    }
+    return workload::Region::R4;
+}
+
+void EntityPhysicsAuthority::update() {
+    _entitySimulation->removeDeadEntities();
+
+    {
+        PhysicsEngine::Transaction transaction;
+        _entitySimulation->buildPhysicsTransaction(transaction);
+        _physicsEngine->processTransaction(transaction);
+        _entitySimulation->handleProcessedPhysicsTransaction(transaction);
+    }
+
+    _entitySimulation->applyDynamicChanges();
+    _physicsEngine->forEachDynamic([&](EntityDynamicPointer dynamic) {
+        dynamic->prepareForPhysicsSimulation();
+    });
+
+    _tree->withWriteLock([&] {
+        _physicsEngine->stepSimulation();
+    });
+
+    if (_physicsEngine->hasOutgoingChanges()) {
+        auto& collisionEvents = _physicsEngine->getCollisionEvents();
+        _tree->withWriteLock([&] {
+            _entitySimulation->handleChangedMotionStates(_physicsEngine->getChangedMotionStates());
+            _entitySimulation->handleDeactivatedMotionStates(_physicsEngine->getDeactivatedMotionStates());
+        });
+        // collision events run scripts, they must not be handled under the lock
+        _entitySimulation->handleCollisionEvents(collisionEvents);
+    }
+}
@@ -0,0 +1,51 @@
+//
+//  EntityPhysicsAuthority.h
+//  assignment-client/src/scripts
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityPhysicsAuthority_h
+#define hifi_EntityPhysicsAuthority_h
+
+#include <vector>
+
+#include <QtCore/QUuid>
+
+#include <EntityEditPacketSender.h>
+#include <EntityTree.h>
+#include <PhysicalEntitySimulation.h>
+#include <PhysicsEngine.h>
+#include <ShapeManager.h>
+
+// A headless physics simulation of the entities inside of designated zones.  It bids for them at
+// AUTHORITATIVE_SIMULATION_PRIORITY, which no interface outbids, so the interfaces stop bidding and only follow
+// the updates it sends.  There can only be one per process: the motion states keep their settings in statics.
+class EntityPhysicsAuthority {
+public:
+    EntityPhysicsAuthority(const EntityTreePointer& tree, EntityEditPacketSender* packetSender,
+                           const std::vector<QUuid>& zoneIDs);
+    ~EntityPhysicsAuthority();
+
+    const PhysicalEntitySimulationPointer& getSimulation() const { return _entitySimulation; }
+
+    void setSessionUUID(const QUuid& sessionUUID);
+
+    // pulls the changes of the tree into physics, steps it and sends the results of what it owns
+    void update();
+
+private:
+    // R1 inside of the zones, which is where the simulation bids, else no region it simulates
+    uint8_t computeRegion(const EntityItemPointer& entity) const;
+
+    EntityTreePointer _tree;
+    std::vector<QUuid> _zoneIDs;
+    ShapeManager _shapeManager;
+    PhysicsEnginePointer _physicsEngine;
+    PhysicalEntitySimulationPointer _entitySimulation;
+};
+
+#endif // hifi_EntityPhysicsAuthority_h
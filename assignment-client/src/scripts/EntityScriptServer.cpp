@@ -13,12 +13,16 @@
 
 #include <mutex>
 
+#include <QtCore/QJsonArray>
+#include <QtCore/QRegExp>
+
 #include <AudioConstants.h>
 #include <AudioInjectorManager.h>
 #include <ClientServerUtils.h>
 #include <DebugDraw.h>
 #include <EntityNodeData.h>
 #include <EntityScriptingInterface.h>
+#include <EntityTreeElement.h>
 #include <LogHandler.h>
 #include <MessagesClient.h>
 #include <plugins/CodecPlugin.h>
@@ -54,7 +58,10 @@ void messageHandler(QtMsgType type, const QMessageLogContext& context, const QSt
 
 int EntityScriptServer::_entitiesScriptEngineCount = 0;
 
-EntityScriptServer::EntityScriptServer(ReceivedMessage& message) : ThreadedAssignment(message) {
+EntityScriptServer::EntityScriptServer(ReceivedMessage& message) :
+    ThreadedAssignment(message),
+    _entityScriptShards(new EntityScriptShards(1, QStringList()))
+{
     qInstallMessageHandler(messageHandler);
 
     DependencyManager::registerInheritance<EntityDynamicFactoryInterface, AssignmentDynamicFactory>();
@@ -96,6 +103,15 @@ EntityScriptServer::EntityScriptServer(ReceivedMessage& message) : ThreadedAssig
     timer->setInterval(LOG_INTERVAL);
     connect(timer, &QTimer::timeout, this, &EntityScriptServer::pushLogs);
     timer->start();
+
+    // the threads of the engines are sampled ahead of their stats being sent
+    static const int SCRIPT_SHARD_STATS_INTERVAL = MSECS_PER_SECOND;
+    auto statsTimer = new QTimer(this);
+    statsTimer->setInterval(SCRIPT_SHARD_STATS_INTERVAL);
+    connect(statsTimer, &QTimer::timeout, this, [this] {
+        _entityScriptShards->sampleStats();
+    });
+    statsTimer->start();
 }
 
 EntityScriptServer::~EntityScriptServer() {
@@ -125,7 +141,8 @@ void EntityScriptServer::handleEntityScriptGetStatusPacket(QSharedPointer<Receiv
         replyPacketList->writePrimitive(messageID);
 
         EntityScriptDetails details;
-        if (_entitiesScriptEngine->getEntityScriptDetails(entityID, details)) {
+        auto engine = _entityScriptShards->findEngine(entityID);
+        if (engine && engine->getEntityScriptDetails(entityID, details)) {
             replyPacketList->writePrimitive(true);
             replyPacketList->writePrimitive(details.status);
             replyPacketList->writeString(details.errorInfo);
@@ -167,10 +184,86 @@ void EntityScriptServer::handleSettings() {
 
     qDebug() << QString("Received entity script server settings, Max Entity PPS: %1, Entity PPS Per Entity Script: %2")
                 .arg(_maxEntityPPS).arg(_entityPPSPerScript);
+
+    static const QString AUTHORITATIVE_PHYSICS_OPTION = "authoritative_physics";
+    static const QString AUTHORITATIVE_PHYSICS_ZONES_OPTION = "authoritative_physics_zones";
+    static const QString AUTHORITATIVE_PHYSICS_PPS_OPTION = "authoritative_physics_pps";
+
+    if (entityScriptServerSettings[AUTHORITATIVE_PHYSICS_OPTION].toBool() && !_physicsAuthority) {
+        std::vector<QUuid> zoneIDs;
+        auto zoneNames = entityScriptServerSettings[AUTHORITATIVE_PHYSICS_ZONES_OPTION].toString()
+            .split(QRegExp("[,\\s]+"), QString::SkipEmptyParts);
+        for (const auto& zoneName : zoneNames) {
+            QUuid zoneID(zoneName);
+            if (zoneID.isNull()) {
+                qWarning() << "Ignoring authoritative physics zone" << zoneName << "which is not an entity ID.";
+            } else {
+                zoneIDs.push_back(zoneID);
+            }
+        }
+        _physicsPPS = std::max(0, entityScriptServerSettings[AUTHORITATIVE_PHYSICS_PPS_OPTION].toInt());
+        setupPhysicsAuthority(zoneIDs);
+        qDebug() << "Simulating the physics of" << (int)zoneIDs.size() << "zones, Physics PPS:" << _physicsPPS;
+    }
+
+    static const QString SCRIPT_ENGINE_THREADS_OPTION = "script_engine_threads";
+    static const QString ISOLATED_SCRIPTS_OPTION = "isolated_scripts";
+
+    int numHashedShards = std::max(1, entityScriptServerSettings[SCRIPT_ENGINE_THREADS_OPTION].toInt());
+    QStringList isolatedScripts;
+    auto resourceManager = DependencyManager::get<ResourceManager>();
+    for (const auto& scriptURL : entityScriptServerSettings[ISOLATED_SCRIPTS_OPTION].toString()
+            .split(QRegExp("[,\\s]+"), QString::SkipEmptyParts)) {
+        // compared with the normalized URLs of the server scripts
+        auto normalizedURL = resourceManager->normalizeURL(scriptURL);
+        if (!isolatedScripts.contains(normalizedURL)) {
+            isolatedScripts << normalizedURL;
+        }
+    }
+    if (numHashedShards != _entityScriptShards->getNumHashedShards() ||
+        isolatedScripts != _entityScriptShards->getIsolatedScripts()) {
+        qDebug() << "Running the entity scripts on" << numHashedShards << "script engines, isolating" << isolatedScripts;
+        reshardEntityScripts(numHashedShards, isolatedScripts);
+    }
+}
+
+void EntityScriptServer::setupPhysicsAuthority(const std::vector<QUuid>& zoneIDs) {
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto tree = _entityViewer.getTree();
+
+    _physicsAuthority.reset(new EntityPhysicsAuthority(tree, &_entityEditSender, zoneIDs));
+    _physicsAuthority->setSessionUUID(nodeList->getSessionUUID());
+    connect(nodeList.data(), &LimitedNodeList::uuidChanged, this, [this](const QUuid& ownerUUID, const QUuid& oldUUID) {
+        if (_physicsAuthority) {
+            _physicsAuthority->setSessionUUID(ownerUUID);
+        }
+    });
+
+    // the entities received so far move to the physical simulation
+    EntitySimulationPointer simulation = _physicsAuthority->getSimulation();
+    tree->setSimulation(simulation);
+    tree->withReadLock([&] {
+        tree->recurseTreeWithOperation([&](const OctreeElementPointer& element, void* extraData) {
+            std::static_pointer_cast<EntityTreeElement>(element)->forEachEntity([&](EntityItemPointer entity) {
+                simulation->addEntity(entity);
+            });
+            return true;
+        });
+    });
+
+    // the simulation needs every entity of the zones, not only those with server scripts
+    QJsonObject queryFlags;
+    queryFlags[EntityJSONQueryProperties::INCLUDE_ANCESTORS_PROPERTY] = true;
+    queryFlags[EntityJSONQueryProperties::INCLUDE_DESCENDANTS_PROPERTY] = true;
+    QJsonObject queryJSONParameters;
+    queryJSONParameters[EntityJSONQueryProperties::FLAGS_PROPERTY] = queryFlags;
+    _entityViewer.getOctreeQuery().setJSONParameters(queryJSONParameters);
+
+    updateEntityPPS();
 }
 
 void EntityScriptServer::updateEntityPPS() {
-    int numRunningScripts = _entitiesScriptEngine->getNumRunningEntityScripts();
+    int numRunningScripts = _entityScriptShards->getNumRunningEntityScripts();
     int pps;
     if (std::numeric_limits<int>::max() / _entityPPSPerScript < numRunningScripts) {
         qWarning() << QString("Integer multiplication would overflow, clamping to maxint: %1 * %2").arg(numRunningScripts).arg(_entityPPSPerScript);
@@ -180,6 +273,10 @@ void EntityScriptServer::updateEntityPPS() {
         pps = _entityPPSPerScript * numRunningScripts;
         pps = std::min(_maxEntityPPS, pps);
     }
+    if (_physicsAuthority) {
+        // the updates of the physics are not sent by scripts, they come on top
+        pps = (std::numeric_limits<int>::max() - pps < _physicsPPS) ? std::numeric_limits<int>::max() : pps + _physicsPPS;
+    }
     _entityEditSender.setPacketsPerSecond(pps);
 }
 
@@ -231,7 +328,7 @@ void EntityScriptServer::pushLogs() {
 
 void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
 
-    if (_entitiesScriptEngine && _entityViewer.getTree() && !_shuttingDown) {
+    if (_entityViewer.getTree() && !_shuttingDown) {
         auto entityID = QUuid::fromRfc4122(receivedMessage->read(NUM_BYTES_RFC4122_UUID));
 
         auto method = receivedMessage->readString();
@@ -245,7 +342,7 @@ void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<Recei
             params << paramString;
         }
 
-        _entitiesScriptEngine->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
+        _entityScriptShards->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
     }
 }
 
@@ -276,8 +373,8 @@ void EntityScriptServer::run() {
         NodeType::EntityServer, NodeType::MessagesMixer, NodeType::AssetServer
     });
 
-    // Setup Script Engine
-    resetEntitiesScriptEngine();
+    // Setup Script Engines
+    resetEntitiesScriptEngines();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     entityScriptingInterface->init();
@@ -439,74 +536,115 @@ void EntityScriptServer::selectAudioFormat(const QString& selectedCodecName) {
     }
 }
 
-void EntityScriptServer::resetEntitiesScriptEngine() {
-    auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
-    auto newEngine = scriptEngineFactory(ScriptEngine::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
+void EntityScriptServer::resetEntitiesScriptEngines() {
+    auto scriptEngines = DependencyManager::get<ScriptEngines>().data();
 
-    auto webSocketServerConstructorValue = newEngine->newFunction(WebSocketServerClass::constructor);
-    newEngine->globalObject().setProperty("WebSocketServer", webSocketServerConstructorValue);
+    std::vector<ScriptEnginePointer> newEngines;
+    for (int shard = 0; shard < _entityScriptShards->getNumShards(); shard++) {
+        auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
+        auto newEngine = scriptEngineFactory(ScriptEngine::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
+
+        auto webSocketServerConstructorValue = newEngine->newFunction(WebSocketServerClass::constructor);
+        newEngine->globalObject().setProperty("WebSocketServer", webSocketServerConstructorValue);
+
+        newEngine->registerGlobalObject("SoundCache", DependencyManager::get<SoundCacheScriptingInterface>().data());
+        newEngine->registerGlobalObject("AvatarList", DependencyManager::get<AvatarHashMap>().data());
+
+        // connect this script engines printedMessage signal to the global ScriptEngines these various messages
+        connect(newEngine.data(), &ScriptEngine::printedMessage, scriptEngines, &ScriptEngines::onPrintedMessage);
+        connect(newEngine.data(), &ScriptEngine::errorMessage, scriptEngines, &ScriptEngines::onErrorMessage);
+        connect(newEngine.data(), &ScriptEngine::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
+        connect(newEngine.data(), &ScriptEngine::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
+
+        // the tree is updated once per frame, by the first engine
+        if (shard == 0) {
+            connect(newEngine.data(), &ScriptEngine::update, this, [this] {
+                _entityViewer.queryOctree();
+                _entityViewer.getTree()->preUpdate();
+                _entityViewer.getTree()->update();
+                if (_physicsAuthority) {
+                    _physicsAuthority->update();
+                }
+            });
+        }
 
-    newEngine->registerGlobalObject("SoundCache", DependencyManager::get<SoundCacheScriptingInterface>().data());
-    newEngine->registerGlobalObject("AvatarList", DependencyManager::get<AvatarHashMap>().data());
+        connect(newEngine.data(), &ScriptEngine::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
 
-    // connect this script engines printedMessage signal to the global ScriptEngines these various messages
-    auto scriptEngines = DependencyManager::get<ScriptEngines>().data();
-    connect(newEngine.data(), &ScriptEngine::printedMessage, scriptEngines, &ScriptEngines::onPrintedMessage);
-    connect(newEngine.data(), &ScriptEngine::errorMessage, scriptEngines, &ScriptEngines::onErrorMessage);
-    connect(newEngine.data(), &ScriptEngine::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
-    connect(newEngine.data(), &ScriptEngine::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
-
-    connect(newEngine.data(), &ScriptEngine::update, this, [this] {
-        _entityViewer.queryOctree();
-        _entityViewer.getTree()->preUpdate();
-        _entityViewer.getTree()->update();
-    });
+        scriptEngines->runScriptInitializers(newEngine);
+        newEngine->runInThread();
+        newEngines.push_back(newEngine);
+    }
 
-    scriptEngines->runScriptInitializers(newEngine);
-    newEngine->runInThread();
-    auto newEngineSP = qSharedPointerCast<EntitiesScriptEngineProvider>(newEngine);
-    DependencyManager::get<EntityScriptingInterface>()->setEntitiesScriptEngine(newEngineSP);
+    _entityScriptShards->setEngines(newEngines);
+    DependencyManager::get<EntityScriptingInterface>()->setEntitiesScriptEngine(
+        qSharedPointerCast<EntitiesScriptEngineProvider>(_entityScriptShards));
+}
 
-    if (_entitiesScriptEngine) {
-        disconnect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-                   this, &EntityScriptServer::updateEntityPPS);
+void EntityScriptServer::stopEntitiesScriptEngines() {
+    // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
+    auto engines = _entityScriptShards->getEngines();
+    for (const auto& engine : engines) {
+        disconnect(engine.data(), &ScriptEngine::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
+        engine->unloadAllEntityScripts();
+        engine->stop();
+    }
+    for (const auto& engine : engines) {
+        engine->waitTillDoneRunning();
     }
-
-    _entitiesScriptEngine.swap(newEngine);
-    connect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-            this, &EntityScriptServer::updateEntityPPS);
 }
 
+void EntityScriptServer::reshardEntityScripts(int numHashedShards, const QStringList& isolatedScripts) {
+    stopEntitiesScriptEngines();
+    _entityScriptShards.reset(new EntityScriptShards(numHashedShards, isolatedScripts));
+    if (_shuttingDown) {
+        return;
+    }
+    resetEntitiesScriptEngines();
+
+    // the entities already received load their scripts again on the engines of their new shards
+    auto tree = _entityViewer.getTree();
+    if (tree) {
+        QVector<EntityItemID> entityIDs;
+        tree->withReadLock([&] {
+            tree->recurseTreeWithOperation([&](const OctreeElementPointer& element, void* extraData) {
+                std::static_pointer_cast<EntityTreeElement>(element)->forEachEntity([&](EntityItemPointer entity) {
+                    entityIDs.push_back(entity->getEntityItemID());
+                });
+                return true;
+            });
+        });
+        for (const auto& entityID : entityIDs) {
+            checkAndCallPreload(entityID);
+        }
+    }
+    updateEntityPPS();
+}
 
 void EntityScriptServer::clear() {
-    // unload and stop the engine
-    if (_entitiesScriptEngine) {
-        // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
-        _entitiesScriptEngine->unloadAllEntityScripts();
-        _entitiesScriptEngine->stop();
-        _entitiesScriptEngine->waitTillDoneRunning();
-    }
+    // unload and stop the engines
+    stopEntitiesScriptEngines();
 
     _entityViewer.clear();
 
-    // reset the engine
+    // reset the engines
     if (!_shuttingDown) {
-        resetEntitiesScriptEngine();
+        resetEntitiesScriptEngines();
     }
 }
 
 void EntityScriptServer::shutdownScriptEngine() {
-    if (_entitiesScriptEngine) {
-        _entitiesScriptEngine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+    for (const auto& engine : _entityScriptShards->getEngines()) {
+        engine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
     }
     _shuttingDown = true;
 
     clear(); // always clear() on shutdown
+    _physicsAuthority.reset();
 
     auto scriptEngines = DependencyManager::get<ScriptEngines>();
     scriptEngines->shutdownScripting();
 
-    _entitiesScriptEngine.clear();
+    _entityScriptShards->setEngines(std::vector<ScriptEnginePointer>());
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     // our entity tree is going to go away so tell that to the EntityScriptingInterface
@@ -524,8 +662,12 @@ void EntityScriptServer::addingEntity(const EntityItemID& entityID) {
 }
 
 void EntityScriptServer::deletingEntity(const EntityItemID& entityID) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
-        _entitiesScriptEngine->unloadEntityScript(entityID, true);
+    if (_entityViewer.getTree() && !_shuttingDown) {
+        auto engine = _entityScriptShards->findEngine(entityID);
+        if (engine) {
+            engine->unloadEntityScript(entityID, true);
+            _entityScriptShards->removeEntity(entityID);
+        }
     }
 }
 
@@ -536,20 +678,27 @@ void EntityScriptServer::entityServerScriptChanging(const EntityItemID& entityID
 }
 
 void EntityScriptServer::checkAndCallPreload(const EntityItemID& entityID, bool forceRedownload) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
+    if (_entityViewer.getTree() && !_shuttingDown) {
 
         EntityItemPointer entity = _entityViewer.getTree()->findEntityByEntityItemID(entityID);
         EntityScriptDetails details;
-        bool isRunning = _entitiesScriptEngine->getEntityScriptDetails(entityID, details);
+        auto runningEngine = _entityScriptShards->findEngine(entityID);
+        bool isRunning = runningEngine && runningEngine->getEntityScriptDetails(entityID, details);
         if (entity && (forceRedownload || !isRunning || details.scriptText != entity->getServerScripts())) {
             if (isRunning) {
-                _entitiesScriptEngine->unloadEntityScript(entityID, true);
+                runningEngine->unloadEntityScript(entityID, true);
             }
+            _entityScriptShards->removeEntity(entityID);
 
             QString scriptUrl = entity->getServerScripts();
             if (!scriptUrl.isEmpty()) {
                 scriptUrl = DependencyManager::get<ResourceManager>()->normalizeURL(scriptUrl);
-                _entitiesScriptEngine->loadEntityScript(entityID, scriptUrl, forceRedownload);
+                int shard = _entityScriptShards->computeShard(entityID, scriptUrl);
+                auto engine = _entityScriptShards->getEngine(shard);
+                if (engine) {
+                    _entityScriptShards->setEntityShard(entityID, shard);
+                    engine->loadEntityScript(entityID, scriptUrl, forceRedownload);
+                }
             }
         }
     }
@@ -565,12 +714,32 @@ void EntityScriptServer::sendStatsPacket() {
     statsObject["octree_stats"] = octreeStats;
 
     QJsonObject scriptEngineStats;
-    int numberRunningScripts = 0;
-    const auto scriptEngine = _entitiesScriptEngine;
-    if (scriptEngine) {
-        numberRunningScripts = scriptEngine->getNumRunningEntityScripts();
+    scriptEngineStats["number_running_scripts"] = _entityScriptShards->getNumRunningEntityScripts();
+
+    QJsonObject shardsStats;
+    auto engines = _entityScriptShards->getEngines();
+    for (int shard = 0; shard < (int)engines.size(); shard++) {
+        QJsonObject shardStats;
+        shardStats["number_running_scripts"] = engines[shard]->getNumRunningEntityScripts();
+        shardStats["cpu_load"] = _entityScriptShards->getCPULoad(shard);
+        shardStats["queue_latency_usecs"] = (double)_entityScriptShards->getQueueLatency(shard);
+        if (shard >= _entityScriptShards->getNumHashedShards()) {
+            shardStats["isolated_script"] = _entityScriptShards->getIsolatedScripts()[shard - _entityScriptShards->getNumHashedShards()];
+        }
+        shardsStats[QString::number(shard)] = shardStats;
+    }
+    scriptEngineStats["shards"] = shardsStats;
+
+    // the entity scripts that have run the longest
+    static const int MAX_STATS_SCRIPT_PROFILES = 20;
+    QJsonArray profilesStats;
+    for (const auto& profile : DependencyManager::get<ScriptEngines>()->getProfiles()) {
+        if (profilesStats.size() >= MAX_STATS_SCRIPT_PROFILES) {
+            break;
+        }
+        profilesStats.append(QJsonObject::fromVariantMap(profile.toMap()));
     }
-    scriptEngineStats["number_running_scripts"] = numberRunningScripts;
+    scriptEngineStats["script_profiles"] = profilesStats;
     statsObject["script_engine_stats"] = scriptEngineStats;
     
 
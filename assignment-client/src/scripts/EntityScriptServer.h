@@ -12,6 +12,7 @@
 #ifndef hifi_EntityScriptServer_h
 #define hifi_EntityScriptServer_h
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -24,6 +25,8 @@
 #include <SimpleEntitySimulation.h>
 #include <ThreadedAssignment.h>
 #include "../entities/EntityTreeHeadlessViewer.h"
+#include "EntityPhysicsAuthority.h"
+#include "EntityScriptShards.h"
 
 class EntityScriptServer : public ThreadedAssignment {
     Q_OBJECT
@@ -61,7 +64,11 @@ private:
     void negotiateAudioFormat();
     void selectAudioFormat(const QString& selectedCodecName);
 
-    void resetEntitiesScriptEngine();
+    void setupPhysicsAuthority(const std::vector<QUuid>& zoneIDs);
+
+    void resetEntitiesScriptEngines();
+    void stopEntitiesScriptEngines();
+    void reshardEntityScripts(int numHashedShards, const QStringList& isolatedScripts);
     void clear();
     void shutdownScriptEngine();
 
@@ -75,13 +82,15 @@ private:
     bool _shuttingDown { false };
 
     static int _entitiesScriptEngineCount;
-    ScriptEnginePointer _entitiesScriptEngine;
+    QSharedPointer<EntityScriptShards> _entityScriptShards;
     SimpleEntitySimulationPointer _entitySimulation;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
+    std::unique_ptr<EntityPhysicsAuthority> _physicsAuthority;
 
     int _maxEntityPPS { DEFAULT_MAX_ENTITY_PPS };
     int _entityPPSPerScript { DEFAULT_ENTITY_PPS_PER_SCRIPT };
+    int _physicsPPS { 0 };
 
     std::set<QUuid> _logListeners;
     std::vector<std::pair<QUuid, quint64>> _killedListeners;
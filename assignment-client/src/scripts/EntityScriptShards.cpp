@@ -0,0 +1,127 @@
+//
+//  EntityScriptShards.cpp
+//  assignment-client/src/scripts
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityScriptShards.h"
+
+#include <algorithm>
+
+#include <QtCore/QMetaObject>
+
+#include <SharedUtil.h>
+
+EntityScriptShards::EntityScriptShards(int numHashedShards, const QStringList& isolatedScripts) :
+    _numHashedShards(std::max(1, numHashedShards)),
+    _isolatedScripts(isolatedScripts)
+{
+}
+
+int EntityScriptShards::computeShard(const EntityItemID& entityID, const QString& scriptURL) const {
+    int isolatedIndex = _isolatedScripts.indexOf(scriptURL);
+    if (isolatedIndex != -1) {
+        return _numHashedShards + isolatedIndex;
+    }
+    // unseeded, so that an entity stays on the same shard across restarts
+    return (int)(qHash(entityID) % (uint)_numHashedShards);
+}
+
+void EntityScriptShards::setEngines(const std::vector<ScriptEnginePointer>& engines) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _engines = engines;
+    _stats.clear();
+    for (size_t i = 0; i < _engines.size(); i++) {
+        _stats.push_back(std::make_shared<ShardStats>());
+    }
+    _entityShards.clear();
+}
+
+std::vector<ScriptEnginePointer> EntityScriptShards::getEngines() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _engines;
+}
+
+ScriptEnginePointer EntityScriptShards::getEngine(int shard) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (shard < 0 || shard >= (int)_engines.size()) {
+        return ScriptEnginePointer();
+    }
+    return _engines[shard];
+}
+
+ScriptEnginePointer EntityScriptShards::findEngine(const EntityItemID& entityID) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entityShards.constFind(entityID);
+    if (it == _entityShards.constEnd() || it.value() >= (int)_engines.size()) {
+        return ScriptEnginePointer();
+    }
+    return _engines[it.value()];
+}
+
+void EntityScriptShards::setEntityShard(const EntityItemID& entityID, int shard) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entityShards[entityID] = shard;
+}
+
+void EntityScriptShards::removeEntity(const EntityItemID& entityID) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entityShards.remove(entityID);
+}
+
+int EntityScriptShards::getNumRunningEntityScripts() const {
+    int numRunningScripts = 0;
+    for (const auto& engine : getEngines()) {
+        numRunningScripts += engine->getNumRunningEntityScripts();
+    }
+    return numRunningScripts;
+}
+
+void EntityScriptShards::sampleStats() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 0; i < _engines.size(); i++) {
+        auto stats = _stats[i];
+        quint64 queuedTime = usecTimestampNow();
+        QMetaObject::invokeMethod(_engines[i].data(), [stats, queuedTime] {
+            quint64 now = usecTimestampNow();
+            quint64 threadCPUTime = usecThreadCPUTime();
+            stats->queueLatency = now > queuedTime ? now - queuedTime : 0;
+            if (stats->lastSampleTime != 0 && now > stats->lastSampleTime) {
+                stats->cpuLoad = (float)(threadCPUTime - stats->lastThreadCPUTime) / (float)(now - stats->lastSampleTime);
+            }
+            stats->lastSampleTime = now;
+            stats->lastThreadCPUTime = threadCPUTime;
+        }, Qt::QueuedConnection);
+    }
+}
+
+float EntityScriptShards::getCPULoad(int shard) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (shard >= 0 && shard < (int)_stats.size()) ? _stats[shard]->cpuLoad.load() : 0.0f;
+}
+
+quint64 EntityScriptShards::getQueueLatency(int shard) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (shard >= 0 && shard < (int)_stats.size()) ? _stats[shard]->queueLatency.load() : 0;
+}
+
+void EntityScriptShards::callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                                const QStringList& params, const QUuid& remoteCallerID) {
+    auto engine = findEngine(entityID);
+    if (engine) {
+        engine->callEntityScriptMethod(entityID, methodName, params, remoteCallerID);
+    }
+}
+
+QFuture<QVariant> EntityScriptShards::getLocalEntityScriptDetails(const EntityItemID& entityID) {
+    auto engine = findEngine(entityID);
+    if (!engine) {
+        // any engine answers that it has no script for the entity
+        engine = getEngine(0);
+    }
+    return engine ? engine->getLocalEntityScriptDetails(entityID) : QFuture<QVariant>();
+}
@@ -0,0 +1,79 @@
+//
+//  EntityScriptShards.h
+//  assignment-client/src/scripts
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityScriptShards_h
+#define hifi_EntityScriptShards_h
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QStringList>
+
+#include <EntitiesScriptEngineProvider.h>
+#include <ScriptEngine.h>
+
+// The script engines that the entity server scripts are spread over, each running on its own thread so that a slow
+// script only delays the scripts of its shard.  An entity goes to a shard picked from its ID, unless its script is one
+// of the isolated ones, which each have a shard of their own.  The calls to the scripts of an entity go to its shard.
+class EntityScriptShards : public EntitiesScriptEngineProvider {
+public:
+    EntityScriptShards(int numHashedShards, const QStringList& isolatedScripts);
+
+    int getNumHashedShards() const { return _numHashedShards; }
+    const QStringList& getIsolatedScripts() const { return _isolatedScripts; }
+    int getNumShards() const { return _numHashedShards + _isolatedScripts.size(); }
+
+    // the same entity and script always go to the same shard
+    int computeShard(const EntityItemID& entityID, const QString& scriptURL) const;
+
+    // one engine per shard, replacing the previous ones and forgetting which entities they ran
+    void setEngines(const std::vector<ScriptEnginePointer>& engines);
+    std::vector<ScriptEnginePointer> getEngines() const;
+    ScriptEnginePointer getEngine(int shard) const;
+
+    // the engine that runs the script of an entity, if it has one
+    ScriptEnginePointer findEngine(const EntityItemID& entityID) const;
+
+    void setEntityShard(const EntityItemID& entityID, int shard);
+    void removeEntity(const EntityItemID& entityID);
+
+    int getNumRunningEntityScripts() const;
+
+    // measures the load of the threads of the engines, the results come in when the engines get to them
+    void sampleStats();
+    float getCPULoad(int shard) const;
+    quint64 getQueueLatency(int shard) const;
+
+    void callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                const QStringList& params = QStringList(), const QUuid& remoteCallerID = QUuid()) override;
+    QFuture<QVariant> getLocalEntityScriptDetails(const EntityItemID& entityID) override;
+
+private:
+    // written by the thread of the engine
+    struct ShardStats {
+        std::atomic<float> cpuLoad { 0.0f };
+        std::atomic<quint64> queueLatency { 0 };
+        quint64 lastSampleTime { 0 };
+        quint64 lastThreadCPUTime { 0 };
+    };
+
+    const int _numHashedShards;
+    const QStringList _isolatedScripts;
+
+    mutable std::mutex _mutex;
+    std::vector<ScriptEnginePointer> _engines;
+    std::vector<std::shared_ptr<ShardStats>> _stats;
+    QHash<EntityItemID, int> _entityShards;
+};
+
+#endif // hifi_EntityScriptShards_h
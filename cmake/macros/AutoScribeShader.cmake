@@ -59,6 +59,12 @@ macro(AUTOSCRIBE_PLATFORM_SHADER)
     set_property(SOURCE ${AUTOSCRIBE_SPIRV_JSON_FILE} PROPERTY SKIP_AUTOMOC ON)
     list(APPEND REFLECTED_SHADERS ${AUTOSCRIBE_SPIRV_JSON_FILE})
 
+    set(AUTOSCRIBE_SPIRV_REFLECTION_FILE "${AUTOSCRIBE_OUTPUT_FILE}.reflection")
+    AUTOSCRIBE_APPEND_QRC("${SHADER_COUNT}/${AUTOSCRIBE_PLATFORM_PATH}/reflection" "${AUTOSCRIBE_SPIRV_REFLECTION_FILE}")
+    source_group(${SOURCE_GROUP_PATH} FILES ${AUTOSCRIBE_SPIRV_REFLECTION_FILE})
+    set_property(SOURCE ${AUTOSCRIBE_SPIRV_REFLECTION_FILE} PROPERTY SKIP_AUTOMOC ON)
+    list(APPEND REFLECTED_SHADERS ${AUTOSCRIBE_SPIRV_REFLECTION_FILE})
+
     unset(SHADER_GEN_LINE)
     list(APPEND SHADER_GEN_LINE ${AUTOSCRIBE_DIALECT})
     list(APPEND SHADER_GEN_LINE ${AUTOSCRIBE_VARIANT})
@@ -0,0 +1,15 @@
+#
+#  Copyright 2019 High Fidelity, Inc.
+#
+#  Distributed under the Apache License, Version 2.0.
+#  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+#
+macro(TARGET_OPUS)
+    # using VCPKG for opus
+    find_path(OPUS_INCLUDE_DIRS opus/opus.h PATHS ${VCPKG_INSTALL_ROOT}/include NO_DEFAULT_PATH)
+    find_library(OPUS_LIBRARY_RELEASE opus PATHS ${VCPKG_INSTALL_ROOT}/lib NO_DEFAULT_PATH)
+    find_library(OPUS_LIBRARY_DEBUG opus PATHS ${VCPKG_INSTALL_ROOT}/debug/lib NO_DEFAULT_PATH)
+    select_library_configurations(OPUS)
+    target_include_directories(${TARGET_NAME} SYSTEM PRIVATE ${OPUS_INCLUDE_DIRS})
+    target_link_libraries(${TARGET_NAME} ${OPUS_LIBRARIES})
+endmacro()
@@ -331,7 +331,7 @@ std::pair<bool, QString> AssetsBackupHandler::recoverBackup(const QString& backu
                     continue;
                 }
 
-                writeAssetFile(asset, zipFile.readAll());
+                writeAssetFile(asset, zipFile);
             }
         }
 
@@ -404,12 +404,16 @@ void AssetsBackupHandler::consolidateBackup(const QString& backupName, QuaZip& z
             continue;
         }
 
+        // most assets are images and models that are already compressed, the fastest level is nearly as small
         QuaZipFile zipFile { &zip };
-        if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ZIP_ASSETS_FOLDER + "/" + hash))) {
+        if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ZIP_ASSETS_FOLDER + "/" + hash), nullptr, 0,
+                          Z_DEFLATED, Z_BEST_SPEED)) {
             qCDebug(asset_backup) << "Could not open zip file:" << zipFile.getZipError();
             continue;
         }
-        zipFile.write(file.readAll());
+        if (!copyBackupData(file, zipFile)) {
+            qCDebug(asset_backup) << "Could not write asset file" << hash << "to zip";
+        }
         zipFile.close();
         if (zipFile.getZipError() != UNZ_OK) {
             qCDebug(asset_backup) << "Could not close zip file: " << zipFile.getZipError();
@@ -520,6 +524,36 @@ bool AssetsBackupHandler::writeAssetFile(const AssetUtils::AssetHash& hash, cons
     return true;
 }
 
+bool AssetsBackupHandler::writeAssetFile(const AssetUtils::AssetHash& hash, QIODevice& data) {
+    QDir assetsDir { _assetsDirectory };
+    QFile file { assetsDir.filePath(hash + ".part") };
+    if (!file.open(QFile::WriteOnly)) {
+        qCCritical(asset_backup) << "Could not open asset file for write:" << file.fileName();
+        return false;
+    }
+
+    // stream the asset to a partial file, which only takes its name once its content matches its hash
+    QCryptographicHash dataHash { QCryptographicHash::Sha256 };
+    bool success = copyBackupData(data, file, &dataHash);
+    file.close();
+    if (!success || QString(dataHash.result().toHex()) != hash) {
+        qCCritical(asset_backup) << "Could not write data matching its hash to file" << file.fileName();
+        file.remove();
+        return false;
+    }
+
+    QFile::remove(assetsDir.filePath(hash));
+    if (!file.rename(assetsDir.filePath(hash))) {
+        qCCritical(asset_backup) << "Could not rename asset file" << file.fileName();
+        file.remove();
+        return false;
+    }
+
+    _assetsOnDisk.insert(hash);
+
+    return true;
+}
+
 void AssetsBackupHandler::computeServerStateDifference(const AssetUtils::Mappings& currentMappings,
                                                        const AssetUtils::Mappings& newMappings) {
     _mappingsLeftToSet.reserve((int)newMappings.size());
@@ -14,10 +14,29 @@
 
 #include <memory>
 
+#include <QCryptographicHash>
+#include <QIODevice>
 #include <QString>
 
 class QuaZip;
 
+// Copies the rest of source to destination a chunk at a time, so that the content of a backup never needs to fit
+// in memory, and adds what it copies to hash if there is one.
+inline bool copyBackupData(QIODevice& source, QIODevice& destination, QCryptographicHash* hash = nullptr) {
+    static const qint64 CHUNK_SIZE = 1 << 20;
+    QByteArray chunk;
+    while (!source.atEnd()) {
+        chunk = source.read(CHUNK_SIZE);
+        if (chunk.isEmpty() || destination.write(chunk) != chunk.size()) {
+            return false;
+        }
+        if (hash) {
+            hash->addData(chunk);
+        }
+    }
+    return true;
+}
+
 class BackupHandlerInterface {
 public:
     virtual ~BackupHandlerInterface() = default;
@@ -14,9 +14,13 @@
 #include <openssl/err.h>
 #include <openssl/rsa.h>
 #include <openssl/x509.h>
+#include <functional>
+#include <memory>
 #include <random>
 
 #include <QDataStream>
+#include <QRunnable>
+#include <QThreadPool>
 
 #include <AccountManager.h>
 #include <Assignment.h>
@@ -26,10 +30,18 @@
 
 using SharedAssignmentPointer = QSharedPointer<Assignment>;
 
+// handling a connect request evaluates the permissions of its user, which is slow enough that a storm of them
+// keeps the domain-server from handling anything else if they're all handled as they come
+static const int CONNECT_REQUEST_INTERVAL_MSECS = 10;
+static const int MAX_CONNECT_REQUESTS_PER_INTERVAL = 4;
+
 DomainGatekeeper::DomainGatekeeper(DomainServer* server) :
     _server(server)
 {
     initLocalIDManagement();
+
+    _connectRequestTimer.setInterval(CONNECT_REQUEST_INTERVAL_MSECS);
+    connect(&_connectRequestTimer, &QTimer::timeout, this, &DomainGatekeeper::processQueuedConnectRequests);
 }
 
 void DomainGatekeeper::addPendingAssignedNode(const QUuid& nodeUUID, const QUuid& assignmentUUID,
@@ -58,6 +70,36 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
         return;
     }
 
+    // a sender that is already waiting keeps its turn with its latest request
+    auto& queuedRequest = _queuedConnectRequests[message->getSenderSockAddr()];
+    if (!queuedRequest) {
+        _connectRequestQueue.push_back(message->getSenderSockAddr());
+    }
+    queuedRequest = message;
+
+    if (!_connectRequestTimer.isActive()) {
+        _connectRequestTimer.start();
+        processQueuedConnectRequests();
+    }
+}
+
+void DomainGatekeeper::processQueuedConnectRequests() {
+    for (int i = 0; i < MAX_CONNECT_REQUESTS_PER_INTERVAL && !_connectRequestQueue.empty(); i++) {
+        auto itr = _queuedConnectRequests.find(_connectRequestQueue.front());
+        _connectRequestQueue.pop_front();
+        auto message = itr->second;
+        _queuedConnectRequests.erase(itr);
+        handleConnectRequest(message);
+    }
+
+    if (_connectRequestQueue.empty()) {
+        _connectRequestTimer.stop();
+    }
+}
+
+void DomainGatekeeper::handleConnectRequest(QSharedPointer<ReceivedMessage> message) {
+    message->seek(0);
+
     QDataStream packetStream(message->getMessage());
 
     // read a NodeConnectionData object from the packet so we can pass around this data while we're inspecting it
@@ -104,6 +146,10 @@ void DomainGatekeeper::processConnectRequestPacket(QSharedPointer<ReceivedMessag
             }
         }
 
+        if (startSignatureVerification(username, usernameSignature, message)) {
+            return;
+        }
+
         node = processAgentConnectRequest(nodeConnection, username, usernameSignature);
     }
 
@@ -313,6 +359,7 @@ void DomainGatekeeper::updateNodePermissions() {
         }
 
         node->setPermissions(userPerms);
+        static_cast<DomainServerNodeData*>(node->getLinkedData())->clearSerializedNode();
 
         if (!userPerms.can(NodePermissions::Permission::canConnectToDomain)) {
             qDebug() << "node" << node->getUUID() << "no longer has permission to connect.";
@@ -364,6 +411,7 @@ SharedNodePointer DomainGatekeeper::processAssignmentConnectRequest(const NodeCo
     nodeData->setNodeVersion(it->second.getNodeVersion());
     nodeData->setHardwareAddress(nodeConnection.hardwareAddress);
     nodeData->setMachineFingerprint(nodeConnection.machineFingerprint);
+    nodeData->setPacketAuthMethods(nodeConnection.packetAuthMethods);
     // client-side send time of last connect/domain list request
     nodeData->setLastDomainCheckinTimestamp(nodeConnection.lastPingTimestamp);
     nodeData->setWasAssigned(true);
@@ -384,6 +432,7 @@ SharedNodePointer DomainGatekeeper::processAssignmentConnectRequest(const NodeCo
     userPerms.permissions |= NodePermissions::Permission::canReplaceDomainContent;
     userPerms.permissions |= NodePermissions::Permission::canGetAndSetPrivateUserData;
     newNode->setPermissions(userPerms);
+    static_cast<DomainServerNodeData*>(newNode->getLinkedData())->clearSerializedNode();
     return newNode;
 }
 
@@ -493,6 +542,7 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
 
     // set the edit rights for this user
     newNode->setPermissions(userPerms);
+    static_cast<DomainServerNodeData*>(newNode->getLinkedData())->clearSerializedNode();
 
     // grab the linked data for our new node so we can set the username
     DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(newNode->getLinkedData());
@@ -506,6 +556,9 @@ SharedNodePointer DomainGatekeeper::processAgentConnectRequest(const NodeConnect
     // set the machine fingerprint passed in the connect request
     nodeData->setMachineFingerprint(nodeConnection.machineFingerprint);
 
+    // and how it can sign its packets
+    nodeData->setPacketAuthMethods(nodeConnection.packetAuthMethods);
+
     // set client-side send time of last connect/domain list request
     nodeData->setLastDomainCheckinTimestamp(nodeConnection.lastPingTimestamp);
 
@@ -558,6 +611,91 @@ void DomainGatekeeper::cleanupICEPeerForNode(const QUuid& nodeID) {
     }
 }
 
+namespace {
+    // runs work on the thread pool, then done on the thread of context
+    class SignatureVerificationTask : public QRunnable {
+    public:
+        SignatureVerificationTask(std::function<void()> work, QObject* context, std::function<void()> done) :
+            _work(work), _context(context), _done(done) {}
+
+        void run() override {
+            _work();
+            QMetaObject::invokeMethod(_context, _done, Qt::QueuedConnection);
+        }
+
+    private:
+        std::function<void()> _work;
+        QObject* _context;
+        std::function<void()> _done;
+    };
+}
+
+DomainGatekeeper::SignatureResult DomainGatekeeper::checkUserSignature(const QString& lowerUsername,
+                                                                       const QByteArray& usernameSignature,
+                                                                       const QByteArray& publicKey,
+                                                                       const QUuid& connectionToken) {
+    const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(publicKey.constData());
+
+    // first load up the public key into an RSA struct
+    RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, publicKey.size());
+    if (!rsaPublicKey) {
+        return SignatureResult::InvalidKey;
+    }
+
+    QByteArray lowercaseUsernameUTF8 = lowerUsername.toUtf8();
+    QByteArray usernameWithToken = QCryptographicHash::hash(lowercaseUsernameUTF8.append(connectionToken.toRfc4122()),
+                                                            QCryptographicHash::Sha256);
+
+    int decryptResult = RSA_verify(NID_sha256,
+                                   reinterpret_cast<const unsigned char*>(usernameWithToken.constData()),
+                                   usernameWithToken.size(),
+                                   reinterpret_cast<const unsigned char*>(usernameSignature.constData()),
+                                   usernameSignature.size(),
+                                   rsaPublicKey);
+
+    // free up the public key, we don't need it anymore
+    RSA_free(rsaPublicKey);
+
+    return decryptResult == 1 ? SignatureResult::Verified : SignatureResult::Mismatch;
+}
+
+bool DomainGatekeeper::startSignatureVerification(const QString& username, const QByteArray& usernameSignature,
+                                                  QSharedPointer<ReceivedMessage> message) {
+    if (username.isEmpty() || usernameSignature.isEmpty()) {
+        return false;
+    }
+
+    auto lowerUsername = username.toLower();
+    if (_pendingSignatureVerifications.contains(lowerUsername)) {
+        // the request is handled again once the verification of the previous one is done
+        return true;
+    }
+
+    QByteArray publicKey = _userPublicKeys.value(lowerUsername).first;
+    QUuid connectionToken = _connectionTokenHash.value(lowerUsername);
+    if (publicKey.isEmpty() || connectionToken.isNull()) {
+        return false;
+    }
+
+    auto itr = _signatureVerifications.constFind(lowerUsername);
+    if (itr != _signatureVerifications.constEnd() && itr->usernameSignature == usernameSignature &&
+        itr->publicKey == publicKey && itr->connectionToken == connectionToken) {
+        return false;
+    }
+
+    _pendingSignatureVerifications.insert(lowerUsername);
+    auto result = std::make_shared<SignatureResult>();
+    auto task = new SignatureVerificationTask([=] {
+        *result = checkUserSignature(lowerUsername, usernameSignature, publicKey, connectionToken);
+    }, this, [=] {
+        _pendingSignatureVerifications.remove(lowerUsername);
+        _signatureVerifications.insert(lowerUsername, { usernameSignature, publicKey, connectionToken, *result });
+        handleConnectRequest(message);
+    });
+    QThreadPool::globalInstance()->start(task);
+    return true;
+}
+
 bool DomainGatekeeper::verifyUserSignature(const QString& username,
                                            const QByteArray& usernameSignature,
                                            const HifiSockAddr& senderSockAddr) {
@@ -571,30 +709,21 @@ bool DomainGatekeeper::verifyUserSignature(const QString& username,
     const QUuid& connectionToken = _connectionTokenHash.value(lowerUsername);
 
     if (!publicKeyArray.isEmpty() && !connectionToken.isNull()) {
-        // if we do have a public key for the user, check for a signature match
-
-        const unsigned char* publicKeyData = reinterpret_cast<const unsigned char*>(publicKeyArray.constData());
-
-        // first load up the public key into an RSA struct
-        RSA* rsaPublicKey = d2i_RSA_PUBKEY(NULL, &publicKeyData, publicKeyArray.size());
-
-        QByteArray lowercaseUsernameUTF8 = lowerUsername.toUtf8();
-        QByteArray usernameWithToken = QCryptographicHash::hash(lowercaseUsernameUTF8.append(connectionToken.toRfc4122()),
-                                                                QCryptographicHash::Sha256);
-
-        if (rsaPublicKey) {
-            int decryptResult = RSA_verify(NID_sha256,
-                                           reinterpret_cast<const unsigned char*>(usernameWithToken.constData()),
-                                           usernameWithToken.size(),
-                                           reinterpret_cast<const unsigned char*>(usernameSignature.constData()),
-                                           usernameSignature.size(),
-                                           rsaPublicKey);
+        // if we do have a public key for the user, check for a signature match, which the thread pool usually already did
+        SignatureResult result;
+        auto verification = _signatureVerifications.take(lowerUsername);
+        if (verification.usernameSignature == usernameSignature && verification.publicKey == publicKeyArray &&
+            verification.connectionToken == connectionToken) {
+            result = verification.result;
+        } else {
+            result = checkUserSignature(lowerUsername, usernameSignature, publicKeyArray, connectionToken);
+        }
 
-            if (decryptResult == 1) {
+        if (result != SignatureResult::InvalidKey) {
+            if (result == SignatureResult::Verified) {
                 qDebug() << "Username signature matches for" << username;
 
-                // free up the public key and remove connection token before we return
-                RSA_free(rsaPublicKey);
+                // remove connection token before we return
                 _connectionTokenHash.remove(username);
 
                 return true;
@@ -611,9 +740,6 @@ bool DomainGatekeeper::verifyUserSignature(const QString& username,
                     qDebug() << "Error decrypting username signature for" << username << "with optimisitic key -"
                         << "re-requesting public key and delaying connection";
                 }
-
-                // free up the public key, we don't need it anymore
-                RSA_free(rsaPublicKey);
             }
 
         } else {
@@ -14,10 +14,12 @@
 #ifndef hifi_DomainGatekeeper_h
 #define hifi_DomainGatekeeper_h
 
+#include <deque>
 #include <unordered_map>
 #include <unordered_set>
 
 #include <QtCore/QObject>
+#include <QtCore/QTimer>
 #include <QtNetwork/QNetworkReply>
 
 #include <DomainHandler.h>
@@ -46,6 +48,8 @@ public:
 
     static void sendProtocolMismatchConnectionDenial(const HifiSockAddr& senderSockAddr);
 public slots:
+    // queues the request, they are handled a few at a time and in turn by sender so that a reconnect storm
+    // doesn't stall the domain-server
     void processConnectRequestPacket(QSharedPointer<ReceivedMessage> message);
     void processICEPingPacket(QSharedPointer<ReceivedMessage> message);
     void processICEPingReplyPacket(QSharedPointer<ReceivedMessage> message);
@@ -71,7 +75,31 @@ public slots:
 
 private slots:
     void handlePeerPingTimeout();
+    void processQueuedConnectRequests();
 private:
+    enum class SignatureResult {
+        Verified,
+        Mismatch,
+        InvalidKey
+    };
+
+    struct SignatureVerification {
+        QByteArray usernameSignature;
+        QByteArray publicKey;
+        QUuid connectionToken;
+        SignatureResult result;
+    };
+
+    static SignatureResult checkUserSignature(const QString& lowerUsername, const QByteArray& usernameSignature,
+                                              const QByteArray& publicKey, const QUuid& connectionToken);
+
+    void handleConnectRequest(QSharedPointer<ReceivedMessage> message);
+
+    // verifies the signature on the thread pool and handles the request again once it is done, false if there isn't
+    // enough to verify it yet or it already was
+    bool startSignatureVerification(const QString& username, const QByteArray& usernameSignature,
+                                    QSharedPointer<ReceivedMessage> message);
+
     SharedNodePointer processAssignmentConnectRequest(const NodeConnectionData& nodeConnection,
                                                       const PendingAssignedNodeData& pendingAssignment);
     SharedNodePointer processAgentConnectRequest(const NodeConnectionData& nodeConnection,
@@ -107,6 +135,16 @@ private:
     
     QHash<QString, QUuid> _connectionTokenHash;
 
+    // the connect requests waiting for their turn, one per sender so that the requests a client resends while it
+    // waits don't take more turns
+    std::unordered_map<HifiSockAddr, QSharedPointer<ReceivedMessage>> _queuedConnectRequests;
+    std::deque<HifiSockAddr> _connectRequestQueue;
+    QTimer _connectRequestTimer;
+
+    // the signatures verified by the thread pool, by lowercase username
+    QHash<QString, SignatureVerification> _signatureVerifications;
+    QSet<QString> _pendingSignatureVerifications;
+
     // the word "optimistic" below is used for keys that we request during user connection before the user has
     // had a chance to upload a new public key
 
@@ -784,6 +784,7 @@ void DomainServer::setupNodeListAndAssignments() {
 
     packetReceiver.registerListener(PacketType::OctreeDataFileRequest, this, "processOctreeDataRequestMessage");
     packetReceiver.registerListener(PacketType::OctreeDataPersist, this, "processOctreeDataPersistMessage");
+    packetReceiver.registerListener(PacketType::NodeTraceReply, this, "processNodeTraceReplyMessage");
 
     packetReceiver.registerListener(PacketType::OctreeFileReplacement, this, "handleOctreeFileReplacementRequest");
     packetReceiver.registerListener(PacketType::DomainContentReplacementFromUrl, this, "handleDomainContentReplacementFromURLRequest");
@@ -1071,12 +1072,16 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
     QDataStream packetStream(message->getMessage());
     NodeConnectionData nodeRequestData = NodeConnectionData::fromDataStream(packetStream, message->getSenderSockAddr(), false);
 
-    // update this node's sockets in case they have changed
-    sendingNode->setPublicSocket(nodeRequestData.publicSockAddr);
-    sendingNode->setLocalSocket(nodeRequestData.localSockAddr);
-
     DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(sendingNode->getLinkedData());
 
+    // update this node's sockets in case they have changed
+    if (sendingNode->getPublicSocket() != nodeRequestData.publicSockAddr ||
+        sendingNode->getLocalSocket() != nodeRequestData.localSockAddr) {
+        sendingNode->setPublicSocket(nodeRequestData.publicSockAddr);
+        sendingNode->setLocalSocket(nodeRequestData.localSockAddr);
+        nodeData->clearSerializedNode();
+    }
+
     if (!nodeData->hasCheckedIn()) {
         nodeData->setHasCheckedIn(true);
 
@@ -1175,6 +1180,7 @@ void DomainServer::handleConnectedNode(SharedNodePointer newNode, quint64 reques
     if (shouldReplicateNode(*newNode)) {
         qDebug() << "Setting node to replicated: " << newNode->getUUID();
         newNode->setIsReplicated(true);
+        nodeData->clearSerializedNode();
     }
 
     // send out this node to our other connected nodes
@@ -1221,10 +1227,11 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
                     domainListPackets->startSegment();
 
                     // don't send avatar nodes to other avatars, that will come from avatar mixer
-                    domainListStream << *otherNode.data();
+                    domainListPackets->write(serializedNodeForDomainList(otherNode));
 
                     // pack the secret that these two nodes will use to communicate with each other
                     domainListStream << connectionSecretForNodes(node, otherNode);
+                    domainListStream << (quint8)packetAuthMethodForNodes(node, otherNode);
 
                     // we've added the node we wanted so end the segment now
                     domainListPackets->endSegment();
@@ -1240,6 +1247,18 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     limitedNodeList->sendPacketList(std::move(domainListPackets), *node);
 }
 
+const QByteArray& DomainServer::serializedNodeForDomainList(const SharedNodePointer& node) {
+    // the same node is written in the lists of all the nodes interested in it, so it is only serialized once
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    if (nodeData->getSerializedNode().isEmpty()) {
+        QByteArray serializedNode;
+        QDataStream serializedNodeStream(&serializedNode, QIODevice::WriteOnly);
+        serializedNodeStream << *node.data();
+        nodeData->setSerializedNode(serializedNode);
+    }
+    return nodeData->getSerializedNode();
+}
+
 QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
     DomainServerNodeData* nodeAData = static_cast<DomainServerNodeData*>(nodeA->getLinkedData());
     DomainServerNodeData* nodeBData = static_cast<DomainServerNodeData*>(nodeB->getLinkedData());
@@ -1261,6 +1280,17 @@ QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, con
     return QUuid();
 }
 
+HMACAuth::AuthMethod DomainServer::packetAuthMethodForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
+    DomainServerNodeData* nodeAData = static_cast<DomainServerNodeData*>(nodeA->getLinkedData());
+    DomainServerNodeData* nodeBData = static_cast<DomainServerNodeData*>(nodeB->getLinkedData());
+
+    if (nodeAData && nodeBData) {
+        return HMACAuth::negotiatePacketAuthMethod(nodeAData->getPacketAuthMethods(), nodeBData->getPacketAuthMethods());
+    }
+
+    return HMACAuth::MD5;
+}
+
 void DomainServer::broadcastNewNode(const SharedNodePointer& addedNode) {
 
     auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
@@ -1269,9 +1299,7 @@ void DomainServer::broadcastNewNode(const SharedNodePointer& addedNode) {
     auto addNodePacket = NLPacket::create(PacketType::DomainServerAddedNode);
 
     // setup the add packet for this new node
-    QDataStream addNodeStream(addNodePacket.get());
-
-    addNodeStream << *addedNode.data();
+    addNodePacket->write(serializedNodeForDomainList(addedNode));
 
     int connectionSecretIndex = addNodePacket->pos();
 
@@ -1293,6 +1321,7 @@ void DomainServer::broadcastNewNode(const SharedNodePointer& addedNode) {
 
                 // replace the bytes at the end of the packet for the connection secret between these nodes
                 addNodePacket->write(rfcConnectionSecret);
+                addNodePacket->writePrimitive((quint8)packetAuthMethodForNodes(node, addedNode));
 
                 limitedNodeList->sendUnreliablePacket(*addNodePacket, *node);
             }
@@ -1795,6 +1824,20 @@ void DomainServer::processOctreeDataPersistMessage(QSharedPointer<ReceivedMessag
     }
 }
 
+void DomainServer::processNodeTraceReplyMessage(QSharedPointer<ReceivedMessage> message) {
+    QUuid requestID = QUuid::fromRfc4122(message->read(NUM_BYTES_RFC4122_UUID));
+    auto pendingRequest = _pendingTraceRequests.take(requestID);
+    if (!pendingRequest.connection) {
+        return;
+    }
+
+    constexpr const char* CONTENT_TYPE_GZIP = "application/gzip";
+    auto contentDisposition = "attachment; filename=\"" + pendingRequest.filename + "\"";
+    pendingRequest.connection->respond(HTTPConnection::StatusCode200, message->readAll(), CONTENT_TYPE_GZIP, {
+        { "Content-Disposition", contentDisposition.toUtf8() }
+    });
+}
+
 QString DomainServer::getContentBackupDir() {
     return PathUtils::getAppDataFilePath("backups");
 }
@@ -2266,6 +2309,44 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
 
                 return false;
             }
+
+            // check if this is a request for the last seconds of the trace of a node
+            const QString NODE_TRACE_REGEX_STRING = QString("\\%1\\/(%2)\\/trace.json.gz\\/?$").arg(URI_NODES).arg(UUID_REGEX_STRING);
+            QRegExp nodeTraceRegex(NODE_TRACE_REGEX_STRING);
+
+            if (nodeTraceRegex.indexIn(url.path()) != -1) {
+                SharedNodePointer matchingNode = nodeList->nodeWithUUID(QUuid(nodeTraceRegex.cap(1)));
+                if (!matchingNode || matchingNode->getType() == NodeType::Agent || !matchingNode->getActiveSocket()) {
+                    return false;
+                }
+
+                static const quint32 DEFAULT_TRACE_SECONDS = 30;
+                bool ok;
+                quint32 seconds = QUrlQuery(url).queryItemValue("seconds").toUInt(&ok);
+                if (!ok) {
+                    seconds = DEFAULT_TRACE_SECONDS;
+                }
+
+                QUuid requestID = QUuid::createUuid();
+                QString nodeTypeName = NodeType::getNodeTypeName(matchingNode->getType()).toLower().replace(' ', '-');
+                _pendingTraceRequests.insert(requestID, { connection, QString("trace-%1-%2.json.gz").arg(nodeTypeName)
+                    .arg(QDateTime::currentDateTime().toString("yyyy-MM-dd_hh-mm-ss")) });
+
+                auto packet = NLPacket::create(PacketType::NodeTraceRequest, NUM_BYTES_RFC4122_UUID + sizeof(seconds), true);
+                packet->write(requestID.toRfc4122());
+                packet->writePrimitive(seconds);
+                nodeList->sendPacket(std::move(packet), *matchingNode->getActiveSocket());
+
+                // don't keep the request if the node never answers
+                static const int TRACE_REPLY_TIMEOUT_MSECS = 30 * MSECS_PER_SECOND;
+                QTimer::singleShot(TRACE_REPLY_TIMEOUT_MSECS, this, [this, requestID] {
+                    auto pendingRequest = _pendingTraceRequests.take(requestID);
+                    if (pendingRequest.connection) {
+                        pendingRequest.connection->respond(HTTPConnection::StatusCode500, "The node didn't send its trace");
+                    }
+                });
+                return true;
+            }
         }
     } else if (connection->requestOperation() == QNetworkAccessManager::PostOperation) {
         if (url.path() == URI_ASSIGNMENT) {
@@ -3065,7 +3146,10 @@ void DomainServer::updateReplicatedNodes() {
                 qDebug() << "Setting node to replicated:"
                     << otherNode->getPermissions().getVerifiedUserName() << otherNode->getUUID();
             }
-            otherNode->setIsReplicated(shouldReplicate);
+            if (isReplicated != shouldReplicate) {
+                otherNode->setIsReplicated(shouldReplicate);
+                static_cast<DomainServerNodeData*>(otherNode->getLinkedData())->clearSerializedNode();
+            }
         }
     );
 }
@@ -106,6 +106,7 @@ private slots:
 
     void processOctreeDataRequestMessage(QSharedPointer<ReceivedMessage> message);
     void processOctreeDataPersistMessage(QSharedPointer<ReceivedMessage> message);
+    void processNodeTraceReplyMessage(QSharedPointer<ReceivedMessage> message);
 
     void setupPendingAssignmentCredits();
     void sendPendingTransactionsToServer();
@@ -185,7 +186,9 @@ private:
 
     bool isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
 
+    const QByteArray& serializedNodeForDomainList(const SharedNodePointer& node);
     QUuid connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
+    HMACAuth::AuthMethod packetAuthMethodForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
     void broadcastNewNode(const SharedNodePointer& node);
 
     void parseAssignmentConfigs(QSet<Assignment::Type>& excludedTypes);
@@ -296,6 +299,13 @@ private:
 
     QHash<QUuid, QPointer<HTTPSConnection>> _pendingOAuthConnections;
 
+    // the HTTP requests for the trace of a node, by the ID of the request sent to it
+    struct PendingTraceRequest {
+        QPointer<HTTPConnection> connection;
+        QString filename;
+    };
+    QHash<QUuid, PendingTraceRequest> _pendingTraceRequests;
+
     std::unordered_map<int, QByteArray> _pendingUploadedContents;
     std::unordered_map<int, std::unique_ptr<QTemporaryFile>> _pendingContentFiles;
 
@@ -61,6 +61,10 @@ public:
     void setMachineFingerprint(const QUuid& machineFingerprint) { _machineFingerprint = machineFingerprint; }
     const QUuid& getMachineFingerprint() { return _machineFingerprint; }
 
+    // the mask of HMACAuth methods the node can sign packets with
+    void setPacketAuthMethods(quint8 packetAuthMethods) { _packetAuthMethods = packetAuthMethods; }
+    quint8 getPacketAuthMethods() const { return _packetAuthMethods; }
+
     void setLastDomainCheckinTimestamp(quint64 lastDomainCheckinTimestamp) { _lastDomainCheckinTimestamp = lastDomainCheckinTimestamp; }
     quint64 getLastDomainCheckinTimestamp() { return _lastDomainCheckinTimestamp; }
 
@@ -75,7 +79,13 @@ public:
 
     bool hasCheckedIn() const { return _hasCheckedIn; }
     void setHasCheckedIn(bool hasCheckedIn) { _hasCheckedIn = hasCheckedIn; }
-    
+
+    // the node as it is written in the domain lists of the other nodes, which must be cleared whenever the
+    // sockets, permissions or replication of the node change
+    const QByteArray& getSerializedNode() const { return _serializedNode; }
+    void setSerializedNode(const QByteArray& serializedNode) { _serializedNode = serializedNode; }
+    void clearSerializedNode() { _serializedNode.clear(); }
+
 private:
     QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
     QJsonArray overrideValuesIfNeeded(const QJsonArray& newStats);
@@ -96,12 +106,15 @@ private:
     QString _nodeVersion;
     QString _hardwareAddress;
     QUuid   _machineFingerprint;
+    quint8 _packetAuthMethods { 0 };
     quint64 _lastDomainCheckinTimestamp;
     QString _placeName;
 
     bool _wasAssigned { false };
 
     bool _hasCheckedIn { false };
+
+    QByteArray _serializedNode;
 };
 
 #endif // hifi_DomainServerNodeData_h
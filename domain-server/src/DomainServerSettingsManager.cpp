@@ -59,7 +59,13 @@ static const QString SPLIT_MENU_GROUPS_CONTENT_SETTINGS_KEY = "content_settings"
 
 const QString SETTINGS_VIEWPOINT_KEY = "viewpoint";
 
+static const int PERSIST_SETTINGS_DELAY_MSECS = 1000;
+
 DomainServerSettingsManager::DomainServerSettingsManager() {
+    _persistTimer.setSingleShot(true);
+    _persistTimer.setInterval(PERSIST_SETTINGS_DELAY_MSECS);
+    connect(&_persistTimer, &QTimer::timeout, this, &DomainServerSettingsManager::persistToFile);
+
     // load the description object from the settings description
     QFile descriptionFile(QCoreApplication::applicationDirPath() + SETTINGS_DESCRIPTION_RELATIVE_PATH);
     descriptionFile.open(QIODevice::ReadOnly);
@@ -95,6 +101,13 @@ DomainServerSettingsManager::DomainServerSettingsManager() {
                               Q_ARG(int, MISSING_SETTINGS_DESC_ERROR_CODE));
 }
 
+DomainServerSettingsManager::~DomainServerSettingsManager() {
+    // don't lose the changes that were still waiting to be written
+    if (_persistTimer.isActive()) {
+        persistToFile();
+    }
+}
+
 void DomainServerSettingsManager::splitSettingsDescription() {
     // construct separate description arrays for domain settings and content settings
     // since they are displayed on different pages
@@ -648,7 +661,7 @@ void DomainServerSettingsManager::packPermissions() {
     // save settings for blacklist groups
     packPermissionsForMap("permissions", _groupForbiddens, GROUP_FORBIDDENS_KEYPATH);
 
-    persistToFile();
+    schedulePersistToFile();
 }
 
 bool DomainServerSettingsManager::unpackPermissionsForKeypath(const QString& keyPath,
@@ -704,6 +717,8 @@ void DomainServerSettingsManager::unpackPermissions() {
 
     bool needPack = false;
 
+    invalidateGroupIDLists();
+
     needPack |= unpackPermissionsForKeypath(AGENT_STANDARD_PERMISSIONS_KEYPATH, &_standardAgentPermissions);
 
     needPack |= unpackPermissionsForKeypath(AGENT_PERMISSIONS_KEYPATH, &_agentPermissions);
@@ -816,6 +831,7 @@ bool DomainServerSettingsManager::ensurePermissionsForGroupRanks() {
             }
             if (perms->getGroupID() != groupID) {
                 perms->setGroupID(groupID);
+                invalidateGroupIDLists();
                 changed = true;
             }
             if (perms->getRankID() != rankID) {
@@ -843,6 +859,7 @@ bool DomainServerSettingsManager::ensurePermissionsForGroupRanks() {
             }
             if (perms->getGroupID() != groupID) {
                 perms->setGroupID(groupID);
+                invalidateGroupIDLists();
                 changed = true;
             }
             if (perms->getRankID() != rankID) {
@@ -1042,8 +1059,9 @@ QStringList DomainServerSettingsManager::getAllNames() const {
 }
 
 NodePermissions DomainServerSettingsManager::getStandardPermissionsForName(const NodePermissionsKey& name) const {
-    if (_standardAgentPermissions.contains(name)) {
-        return *(_standardAgentPermissions[name].get());
+    auto permissions = _standardAgentPermissions[name];
+    if (permissions) {
+        return *permissions;
     }
     NodePermissions nullPermissions;
     nullPermissions.setAll(false);
@@ -1052,8 +1070,9 @@ NodePermissions DomainServerSettingsManager::getStandardPermissionsForName(const
 
 NodePermissions DomainServerSettingsManager::getPermissionsForName(const QString& name) const {
     NodePermissionsKey nameKey = NodePermissionsKey(name, 0);
-    if (_agentPermissions.contains(nameKey)) {
-        return *(_agentPermissions[nameKey].get());
+    auto permissions = _agentPermissions[nameKey];
+    if (permissions) {
+        return *permissions;
     }
     NodePermissions nullPermissions;
     nullPermissions.setAll(false);
@@ -1062,8 +1081,9 @@ NodePermissions DomainServerSettingsManager::getPermissionsForName(const QString
 
 NodePermissions DomainServerSettingsManager::getPermissionsForIP(const QHostAddress& address) const {
     NodePermissionsKey ipKey = NodePermissionsKey(address.toString(), 0);
-    if (_ipPermissions.contains(ipKey)) {
-        return *(_ipPermissions[ipKey].get());
+    auto permissions = _ipPermissions[ipKey];
+    if (permissions) {
+        return *permissions;
     }
     NodePermissions nullPermissions;
     nullPermissions.setAll(false);
@@ -1072,8 +1092,9 @@ NodePermissions DomainServerSettingsManager::getPermissionsForIP(const QHostAddr
 
 NodePermissions DomainServerSettingsManager::getPermissionsForMAC(const QString& macAddress) const {
     NodePermissionsKey macKey = NodePermissionsKey(macAddress, 0);
-    if (_macPermissions.contains(macKey)) {
-        return *(_macPermissions[macKey].get());
+    auto permissions = _macPermissions[macKey];
+    if (permissions) {
+        return *permissions;
     }
     NodePermissions nullPermissions;
     nullPermissions.setAll(false);
@@ -1082,8 +1103,9 @@ NodePermissions DomainServerSettingsManager::getPermissionsForMAC(const QString&
 
 NodePermissions DomainServerSettingsManager::getPermissionsForMachineFingerprint(const QUuid& machineFingerprint) const {
     NodePermissionsKey fingerprintKey = NodePermissionsKey(machineFingerprint.toString(), 0);
-    if (_machineFingerprintPermissions.contains(fingerprintKey)) {
-        return *(_machineFingerprintPermissions[fingerprintKey].get());
+    auto permissions = _machineFingerprintPermissions[fingerprintKey];
+    if (permissions) {
+        return *permissions;
     }
     NodePermissions nullPermissions;
     nullPermissions.setAll(false);
@@ -1092,8 +1114,9 @@ NodePermissions DomainServerSettingsManager::getPermissionsForMachineFingerprint
 
 NodePermissions DomainServerSettingsManager::getPermissionsForGroup(const QString& groupName, QUuid rankID) const {
     NodePermissionsKey groupRankKey = NodePermissionsKey(groupName, rankID);
-    if (_groupPermissions.contains(groupRankKey)) {
-        return *(_groupPermissions[groupRankKey].get());
+    auto permissions = _groupPermissions[groupRankKey];
+    if (permissions) {
+        return *permissions;
     }
     NodePermissions nullPermissions;
     nullPermissions.setAll(false);
@@ -1102,19 +1125,21 @@ NodePermissions DomainServerSettingsManager::getPermissionsForGroup(const QStrin
 
 NodePermissions DomainServerSettingsManager::getPermissionsForGroup(const QUuid& groupID, QUuid rankID) const {
     GroupByUUIDKey byUUIDKey = GroupByUUIDKey(groupID, rankID);
-    if (!_groupPermissionsByUUID.contains(byUUIDKey)) {
+    auto permissions = _groupPermissionsByUUID.value(byUUIDKey);
+    if (!permissions) {
         NodePermissions nullPermissions;
         nullPermissions.setAll(false);
         return nullPermissions;
     }
-    NodePermissionsKey groupKey = _groupPermissionsByUUID[byUUIDKey]->getKey();
+    NodePermissionsKey groupKey = permissions->getKey();
     return getPermissionsForGroup(groupKey.first, groupKey.second);
 }
 
 NodePermissions DomainServerSettingsManager::getForbiddensForGroup(const QString& groupName, QUuid rankID) const {
     NodePermissionsKey groupRankKey = NodePermissionsKey(groupName, rankID);
-    if (_groupForbiddens.contains(groupRankKey)) {
-        return *(_groupForbiddens[groupRankKey].get());
+    auto permissions = _groupForbiddens[groupRankKey];
+    if (permissions) {
+        return *permissions;
     }
     NodePermissions allForbiddens;
     allForbiddens.setAll(true);
@@ -1123,13 +1148,14 @@ NodePermissions DomainServerSettingsManager::getForbiddensForGroup(const QString
 
 NodePermissions DomainServerSettingsManager::getForbiddensForGroup(const QUuid& groupID, QUuid rankID) const {
     GroupByUUIDKey byUUIDKey = GroupByUUIDKey(groupID, rankID);
-    if (!_groupForbiddensByUUID.contains(byUUIDKey)) {
+    auto forbiddens = _groupForbiddensByUUID.value(byUUIDKey);
+    if (!forbiddens) {
         NodePermissions allForbiddens;
         allForbiddens.setAll(true);
         return allForbiddens;
     }
 
-    NodePermissionsKey groupKey = _groupForbiddensByUUID[byUUIDKey]->getKey();
+    NodePermissionsKey groupKey = forbiddens->getKey();
     return getForbiddensForGroup(groupKey.first, groupKey.second);
 }
 
@@ -1871,7 +1897,20 @@ void DomainServerSettingsManager::sortPermissions() {
     }
 }
 
+void DomainServerSettingsManager::schedulePersistToFile() {
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, [this] { schedulePersistToFile(); });
+        return;
+    }
+    if (!_persistTimer.isActive()) {
+        _persistTimer.start();
+    }
+}
+
 void DomainServerSettingsManager::persistToFile() {
+    // this writes everything, including what was scheduled to be written
+    _persistTimer.stop();
+
     QString settingsFilename = _configMap.getUserConfigFilename();
     QDir settingsDir = QFileInfo(settingsFilename).dir();
     if (!settingsDir.exists() && !settingsDir.mkpath(".")) {
@@ -1941,6 +1980,7 @@ bool DomainServerSettingsManager::setGroupID(const QString& groupName, const QUu
         if (perms->getID().toLower() == groupName.toLower() && !perms->isGroup()) {
             changed = true;
             perms->setGroupID(groupID);
+            invalidateGroupIDLists();
         }
     }
 
@@ -1949,6 +1989,7 @@ bool DomainServerSettingsManager::setGroupID(const QString& groupName, const QUu
         if (perms->getID().toLower() == groupName.toLower() && !perms->isGroup()) {
             changed = true;
             perms->setGroupID(groupID);
+            invalidateGroupIDLists();
         }
     }
 
@@ -2158,31 +2199,46 @@ void DomainServerSettingsManager::recordGroupMembership(const QString& name, con
 }
 
 QUuid DomainServerSettingsManager::isGroupMember(const QString& name, const QUuid& groupID) {
-    const QHash<QUuid, QUuid>& groupsForName = _groupMembership[name.toLower()];
-    if (groupsForName.contains(groupID)) {
-        return groupsForName[groupID];
+    // a lookup that doesn't add an empty membership for each agent that isn't in any of the groups
+    auto groupsForName = _groupMembership.constFind(name.toLower());
+    if (groupsForName != _groupMembership.constEnd()) {
+        return groupsForName->value(groupID);
     }
     return QUuid();
 }
 
-QList<QUuid> DomainServerSettingsManager::getGroupIDs() {
-    QSet<QUuid> result;
-    foreach (NodePermissionsKey groupKey, _groupPermissions.keys()) {
-        if (_groupPermissions[groupKey]->isGroup()) {
-            result += _groupPermissions[groupKey]->getGroupID();
+void DomainServerSettingsManager::updateGroupIDLists() {
+    if (_groupIDListsValid) {
+        return;
+    }
+
+    QSet<QUuid> permissionGroupIDs;
+    for (const auto& entry : _groupPermissions.get()) {
+        if (entry.second->isGroup()) {
+            permissionGroupIDs += entry.second->getGroupID();
         }
     }
-    return result.toList();
-}
+    _permissionGroupIDs = permissionGroupIDs.toList();
 
-QList<QUuid> DomainServerSettingsManager::getBlacklistGroupIDs() {
-    QSet<QUuid> result;
-    foreach (NodePermissionsKey groupKey, _groupForbiddens.keys()) {
-        if (_groupForbiddens[groupKey]->isGroup()) {
-            result += _groupForbiddens[groupKey]->getGroupID();
+    QSet<QUuid> forbiddenGroupIDs;
+    for (const auto& entry : _groupForbiddens.get()) {
+        if (entry.second->isGroup()) {
+            forbiddenGroupIDs += entry.second->getGroupID();
         }
     }
-    return result.toList();
+    _forbiddenGroupIDs = forbiddenGroupIDs.toList();
+
+    _groupIDListsValid = true;
+}
+
+QList<QUuid> DomainServerSettingsManager::getGroupIDs() {
+    updateGroupIDLists();
+    return _permissionGroupIDs;
+}
+
+QList<QUuid> DomainServerSettingsManager::getBlacklistGroupIDs() {
+    updateGroupIDLists();
+    return _forbiddenGroupIDs;
 }
 
 void DomainServerSettingsManager::debugDumpGroupsState() {
@@ -15,6 +15,7 @@
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonDocument>
+#include <QtCore/QTimer>
 #include <QtNetwork/QNetworkReply>
 
 #include <HifiConfigVariantMap.h>
@@ -52,6 +53,7 @@ class DomainServerSettingsManager : public QObject {
     Q_OBJECT
 public:
     DomainServerSettingsManager();
+    ~DomainServerSettingsManager();
     bool handleAuthenticatedHTTPRequest(HTTPConnection* connection, const QUrl& url);
 
     void setupConfigMap(const QString& userConfigFilename);
@@ -159,6 +161,10 @@ private:
     // since it may take either a read lock or write lock and recursive locking doesn't allow a change in type
     void persistToFile();
 
+    // the changes that come in bursts, like the answers of the group api or the kicks, are written together
+    // a moment later instead of rewriting the whole file for each of them
+    void schedulePersistToFile();
+
     void splitSettingsDescription();
 
     double _descriptionVersion;
@@ -197,6 +203,14 @@ private:
     QHash<GroupByUUIDKey, NodePermissionsPointer> _groupPermissionsByUUID;
     QHash<GroupByUUIDKey, NodePermissionsPointer> _groupForbiddensByUUID;
 
+    // the group-ids of the group permissions and forbiddens, looked at for every agent that connects and
+    // gathered again only after the rows of those groups changed
+    void invalidateGroupIDLists() { _groupIDListsValid = false; }
+    void updateGroupIDLists();
+    QList<QUuid> _permissionGroupIDs;
+    QList<QUuid> _forbiddenGroupIDs;
+    bool _groupIDListsValid { false };
+
     QHash<QString, QUuid> _groupIDs; // keep track of group-name to group-id mappings
     QHash<QUuid, QString> _groupNames; // keep track of group-id to group-name mappings
 
@@ -208,6 +222,8 @@ private:
 
     /// guard read/write access from multiple threads to settings 
     QReadWriteLock _settingsLock { QReadWriteLock::Recursive };
+
+    QTimer _persistTimer;
 };
 
 #endif // hifi_DomainServerSettingsManager_h
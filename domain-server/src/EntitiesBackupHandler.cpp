@@ -39,13 +39,13 @@ void EntitiesBackupHandler::createBackup(const QString& backupName, QuaZip& zip)
     QFile entitiesFile { _entitiesFilePath };
 
     if (entitiesFile.open(QIODevice::ReadOnly)) {
+        // the entities file is already gzipped, it is stored as it is rather than deflated again
         QuaZipFile zipFile { &zip };
-        if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_BACKUP_FILENAME, _entitiesFilePath))) {
+        if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(ENTITIES_BACKUP_FILENAME, _entitiesFilePath), nullptr, 0, 0)) {
             qCritical().nospace() << "Failed to open " << ENTITIES_BACKUP_FILENAME << " for writing in zip";
             return;
         }
-        auto entityData = entitiesFile.readAll();
-        if (zipFile.write(entityData) != entityData.size()) {
+        if (!copyBackupData(entitiesFile, zipFile)) {
             qCritical() << "Failed to write entities file to backup";
             zipFile.close();
             return;
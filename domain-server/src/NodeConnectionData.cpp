@@ -46,6 +46,8 @@ NodeConnectionData NodeConnectionData::fromDataStream(QDataStream& dataStream, c
         dataStream >> newHeader.connectReason;
 
         dataStream >> newHeader.previousConnectionUpTime;
+
+        dataStream >> newHeader.packetAuthMethods;
     }
 
     dataStream >> newHeader.lastPingTimestamp;
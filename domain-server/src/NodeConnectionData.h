@@ -34,6 +34,7 @@ public:
     QString SystemInfo;
     quint32 connectReason;
     quint64 previousConnectionUpTime;
+    quint8 packetAuthMethods { 0 };
     QByteArray protocolVersion;
 };
 
@@ -22,11 +22,13 @@
 #include <LimitedNodeList.h>
 #include <NetworkAccessManager.h>
 #include <NetworkingConstants.h>
+#include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 #include <SharedUtil.h>
 
 const int CLEAR_INACTIVE_PEERS_INTERVAL_MSECS = 1 * 1000;
 const int PEER_SILENCE_THRESHOLD_MSECS = 5 * 1000;
+const int STATS_INTERVAL_MSECS = 10 * 1000;
 
 IceServer::IceServer(int argc, char* argv[]) :
     QCoreApplication(argc, argv),
@@ -50,6 +52,12 @@ IceServer::IceServer(int argc, char* argv[]) :
     connect(inactivePeerTimer, &QTimer::timeout, this, &IceServer::clearInactivePeers);
     inactivePeerTimer->start(CLEAR_INACTIVE_PEERS_INTERVAL_MSECS);
 
+    // and one to log how many heartbeats we handle and how long their verification takes
+    _lastStatsTime = usecTimestampNow();
+    QTimer* statsTimer = new QTimer(this);
+    connect(statsTimer, &QTimer::timeout, this, &IceServer::logStats);
+    statsTimer->start(STATS_INTERVAL_MSECS);
+
     // handle public keys when they arrive from the QNetworkAccessManager
     auto& networkAccessManager = NetworkAccessManager::getInstance();
     connect(&networkAccessManager, &QNetworkAccessManager::finished, this, &IceServer::publicKeyReplyFinished);
@@ -74,6 +82,7 @@ void IceServer::processPacket(std::unique_ptr<udt::Packet> packet) {
     if (nlPacket->getPayloadSize() >= NLPacket::localHeaderSize(PacketType::ICEServerHeartbeat)) {
         
         if (nlPacket->getType() == PacketType::ICEServerHeartbeat) {
+            ++_numHeartbeats;
             SharedNetworkPeer peer = addOrUpdateHeartbeatingPeer(*nlPacket);
             if (peer) {
                 // so that we can send packets to the heartbeating peer when we need, we need to activate a socket now
@@ -175,6 +184,15 @@ bool IceServer::isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& pla
             const auto rsaPublicKey = it->second.get();
 
             if (rsaPublicKey) {
+                // the same heartbeat as the last one we verified with this key doesn't need to be verified again
+                auto verifiedIt = _verifiedHeartbeats.find(domainID);
+                if (verifiedIt != _verifiedHeartbeats.end() &&
+                    verifiedIt->second.signature == signature && verifiedIt->second.plaintext == plaintext) {
+                    ++_numVerifiedFromCache;
+                    return true;
+                }
+
+                auto verificationStart = usecTimestampNow();
                 auto hashedPlaintext = QCryptographicHash::hash(plaintext, QCryptographicHash::Sha256);
                 int verificationResult = RSA_verify(NID_sha256,
                                                     reinterpret_cast<const unsigned char*>(hashedPlaintext.constData()),
@@ -183,8 +201,15 @@ bool IceServer::isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& pla
                                                     signature.size(),
                                                     rsaPublicKey);
 
+                auto verificationUsecs = usecTimestampNow() - verificationStart;
+                ++_numSignatureVerifications;
+                _totalVerificationUsecs += verificationUsecs;
+                _maxVerificationUsecs = std::max(_maxVerificationUsecs, verificationUsecs);
+
                 if (verificationResult == 1) {
                     // this is the only success case - we return true here to indicate that the heartbeat is verified
+                    // the payload is only borrowed from the packet, so keep our own copy of it
+                    _verifiedHeartbeats[domainID] = { QByteArray(plaintext.constData(), plaintext.size()), signature };
                     return true;
                 } else {
                     qDebug() << "Failed to verify heartbeat for" << domainID << "- re-requesting public key from API.";
@@ -255,6 +280,8 @@ void IceServer::publicKeyReplyFinished(QNetworkReply* reply) {
 
                 if (rsaPublicKey) {
                     _domainPublicKeys[domainID] = { rsaPublicKey, RSA_free };
+                    // what was verified with the previous key has to be verified again
+                    _verifiedHeartbeats.erase(domainID);
                 } else {
                     qWarning() << "Could not convert in-memory public key for" << domainID << "to usable RSA public key.";
                     qWarning() << "Public key will be re-requested on next heartbeat.";
@@ -301,6 +328,7 @@ void IceServer::clearInactivePeers() {
 
             // if we had a public key for this domain, remove it now
             _domainPublicKeys.erase(peer->getUUID());
+            _verifiedHeartbeats.erase(peer->getUUID());
 
             // remove the peer object
             peerItem = _activePeers.erase(peerItem);
@@ -310,3 +338,24 @@ void IceServer::clearInactivePeers() {
         }
     }
 }
+
+void IceServer::logStats() {
+    auto now = usecTimestampNow();
+    float elapsedSeconds = (float)(now - _lastStatsTime) / USECS_PER_SECOND;
+    _lastStatsTime = now;
+
+    if (_numHeartbeats > 0) {
+        quint64 averageVerificationUsecs = _numSignatureVerifications > 0 ?
+            _totalVerificationUsecs / _numSignatureVerifications : 0;
+        qDebug() << "Handled" << _numHeartbeats / elapsedSeconds << "heartbeats per second from" << _activePeers.size()
+            << "peers -" << _numVerifiedFromCache << "matched a verified heartbeat," << _numSignatureVerifications
+            << "signature verifications took" << averageVerificationUsecs << "usecs on average and"
+            << _maxVerificationUsecs << "usecs at most";
+    }
+
+    _numHeartbeats = 0;
+    _numVerifiedFromCache = 0;
+    _numSignatureVerifications = 0;
+    _totalVerificationUsecs = 0;
+    _maxVerificationUsecs = 0;
+}
@@ -35,6 +35,7 @@ public:
 private slots:
     void clearInactivePeers();
     void publicKeyReplyFinished(QNetworkReply* reply);
+    void logStats();
 private:
     bool packetVersionMatch(const udt::Packet& packet);
     void processPacket(std::unique_ptr<udt::Packet> packet);
@@ -56,6 +57,22 @@ private:
     DomainPublicKeyHash _domainPublicKeys;
 
     QSet<QUuid> _pendingPublicKeyRequests;
+
+    // the last heartbeat of each domain that passed the signature check, a domain keeps sending the same signed
+    // heartbeat until its sockets change so the RSA verification only runs when they do
+    struct VerifiedHeartbeat {
+        QByteArray plaintext;
+        QByteArray signature;
+    };
+    std::unordered_map<QUuid, VerifiedHeartbeat> _verifiedHeartbeats;
+
+    // for the stats logged every STATS_INTERVAL_MSECS
+    int _numHeartbeats { 0 };
+    int _numVerifiedFromCache { 0 };
+    int _numSignatureVerifications { 0 };
+    quint64 _totalVerificationUsecs { 0 };
+    quint64 _maxVerificationUsecs { 0 };
+    quint64 _lastStatsTime { 0 };
 };
 
 #endif // hifi_IceServer_h
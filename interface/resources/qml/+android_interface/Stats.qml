@@ -341,7 +341,8 @@ Item {
                     StatText {
                         visible: root.expanded;
                         text: " out of view: " + root.itemOutOfView +
-                            " too small: " + root.itemTooSmall;
+                            " too small: " + root.itemTooSmall +
+                            " occluded: " + root.itemOccluded;
                     }
                     StatText {
                         visible: root.expanded;
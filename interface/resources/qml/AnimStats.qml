@@ -104,6 +104,9 @@ Item {
                     StatText {
                         text: root.flowText
                     }
+                    StatText {
+                        text: root.ikText
+                    }
                     StatText {
                         text: "State Machines:---------------------------------------------------------------------------"
                     }
@@ -109,6 +109,11 @@ Item {
                         text: "Long Frame Count: " + root.longframes;
                         visible: root.longframes > 0;
                     }
+                    StatText {
+                        text: "Pose Age Render/Present: " + root.renderposeage.toFixed(1) + "/" +
+                            root.presentposeage.toFixed(1) + " ms";
+                        visible: root.presentposeage > 0;
+                    }
                     StatText {
                         text: "Packets In/Out: " + root.packetInCount + "/" + root.packetOutCount
                     }
@@ -131,6 +136,11 @@ Item {
                         visible: root.expanded
                         text: "Avatars NOT Updated: " + root.notUpdatedAvatarCount
                     }
+                    StatText {
+                        visible: root.expanded
+                        text: "Avatar Joint Rates Full/Half/Quarter: " + root.fullRateAvatarCount + "/" +
+                            root.halfRateAvatarCount + "/" + root.quarterRateAvatarCount
+                    }
                     StatText {
                         visible: root.expanded
                         text: "Total picks:\n    " +
@@ -147,6 +157,14 @@ Item {
                                     "Parabolas:\t" + root.parabolaPicksUpdated.x + "/" + root.parabolaPicksUpdated.y + "/" + root.parabolaPicksUpdated.z + "\n    " +
                                     "Colliders:\t" + root.collisionPicksUpdated.x + "/" + root.collisionPicksUpdated.y + "/" + root.collisionPicksUpdated.z
                     }
+                    StatText {
+                        visible: root.expanded
+                        text: "Pick update times (us):\n    " +
+                                    "Styluses:\t" + root.stylusPicksUsecs + "\n    " +
+                                    "Rays:\t" + root.rayPicksUsecs + "\n    " +
+                                    "Parabolas:\t" + root.parabolaPicksUsecs + "\n    " +
+                                    "Colliders:\t" + root.collisionPicksUsecs
+                    }
                     StatText {
                         visible: { root.eventQueueDebuggingOn && root.expanded }
                         text: { if (root.eventQueueDebuggingOn) {
@@ -298,6 +316,18 @@ Item {
                         text: "Processing: " + root.processing +
                               ", Pending: " + root.processingPending;
                     }
+                    ListView {
+                        width: geoCol.width
+                        height: root.downloadOrigins.length * 15
+
+                        visible: root.expanded && root.downloadOrigins.length > 0;
+
+                        model: root.downloadOrigins
+                        delegate: StatText {
+                            visible: root.expanded;
+                            text: "\t" + modelData
+                        }
+                    }
                     StatText {
                         visible: root.expanded && root.downloadUrls.length > 0;
                         text: "Download URLs:"
@@ -338,6 +368,9 @@ Item {
                     }
                     StatText {
                         text: "GPU: " + root.gpuFrameTime.toFixed(1) + " ms"
+                    }
+                    StatText {
+                        text: "QML: " + root.qmlRenderTime.toFixed(1) + " ms (Desktop: " + root.desktopQmlRenderTime.toFixed(1) + " ms)"
                     }                    
                     StatText {
                         text: "GPU (Per pixel): " + root.gpuFrameTimePerPixel.toFixed(1) + " ns/pp"
@@ -353,7 +386,8 @@ Item {
                     }
                     StatText {
                         text: "Triangles: " + root.triangles +
-                            " / Material Switches: " + root.materialSwitches
+                            " / Material Switches: " + root.materialSwitches +
+                            " / Instanced: " + root.instancedItems
                     }
                     StatText {
                         visible: root.expanded;
@@ -421,7 +455,8 @@ Item {
                     StatText {
                         visible: root.expanded;
                         text: " out of view: " + root.itemOutOfView +
-                            " too small: " + root.itemTooSmall;
+                            " too small: " + root.itemTooSmall +
+                            " occluded: " + root.itemOccluded;
                     }
                     StatText {
                         visible: root.expanded;
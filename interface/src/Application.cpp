@@ -57,6 +57,7 @@
 #include <gl/GLHelpers.h>
 
 #include <shared/FileUtils.h>
+#include <shared/FrameBudget.h>
 #include <shared/QtHelpers.h>
 #include <shared/PlatformHelper.h>
 #include <shared/GlobalAppProperties.h>
@@ -217,6 +218,7 @@
 #include "ui/DomainConnectionModel.h"
 #include "ui/Keyboard.h"
 #include "ui/InteractiveWindow.h"
+#include "StartupTasks.h"
 #include "Util.h"
 #include "InterfaceParentFinder.h"
 #include "ui/OctreeStatsProvider.h"
@@ -832,14 +834,14 @@ bool setupEssentials(int& argc, char** argv, bool runningMarkerExisted) {
     pluginManager->setInputPluginProvider([] { return getInputPlugins(); });
     pluginManager->setDisplayPluginProvider([] { return getDisplayPlugins(); });
     pluginManager->setInputPluginSettingsPersister([](const InputPluginList& plugins) { saveInputPluginSettings(plugins); });
-    if (auto steamClient = pluginManager->getSteamClientPlugin()) {
-        steamClient->init();
-    }
-    if (auto oculusPlatform = pluginManager->getOculusPlatformPlugin()) {
-        oculusPlatform->init();
-    }
 
     PROFILE_SET_THREAD_NAME("Main Thread");
+    PROFILE_RANGE(startup, __FUNCTION__);
+
+    // The plugin libraries load while the dependencies are set, getting a plugin waits for them
+    auto startupTasks = DependencyManager::set<StartupTasks>();
+    DependencyManager::set<FrameBudget>();
+    startupTasks->addConcurrent("load plugins", [pluginManager] { pluginManager->loadPlugins(); });
 
 #if defined(Q_OS_WIN)
     // Select appropriate audio DLL
@@ -970,6 +972,13 @@ bool setupEssentials(int& argc, char** argv, bool runningMarkerExisted) {
     DependencyManager::set<AvatarPackager>();
     DependencyManager::set<ScreenshareScriptingInterface>();
     PlatformHelper::setup();
+
+    if (auto steamClient = pluginManager->getSteamClientPlugin()) {
+        steamClient->init();
+    }
+    if (auto oculusPlatform = pluginManager->getOculusPlatformPlugin()) {
+        oculusPlatform->init();
+    }
     
     QObject::connect(PlatformHelper::instance(), &PlatformHelper::systemWillWake, [] {
         QMetaObject::invokeMethod(DependencyManager::get<NodeList>().data(), "noteAwakening", Qt::QueuedConnection);
@@ -2031,7 +2040,9 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
         applicationUpdater->setInstallerType(type);
         applicationUpdater->setInstallerCampaign(installerCampaign);
         connect(applicationUpdater.data(), &AutoUpdater::newVersionIsAvailable, dialogsManager.data(), &DialogsManager::showUpdateDialog);
-        applicationUpdater->checkForUpdate();
+        DependencyManager::get<StartupTasks>()->addDeferred("check for update", [applicationUpdater] {
+            applicationUpdater->checkForUpdate();
+        });
     }
 
     Menu::getInstance()->setIsOptionChecked(MenuOption::ActionMotorControl, true);
@@ -2976,6 +2987,7 @@ Application::~Application() {
 }
 
 void Application::initializeGL() {
+    PROFILE_RANGE(startup, __FUNCTION__);
     qCDebug(interfaceapp) << "Created Display Window.";
 
 #ifdef DISABLE_QML
@@ -3085,6 +3097,7 @@ void Application::initializeGL() {
 }
 
 void Application::initializeDisplayPlugins() {
+    PROFILE_RANGE(startup, __FUNCTION__);
     auto displayPlugins = PluginManager::getInstance()->getDisplayPlugins();
     Setting::Handle<QString> activeDisplayPluginSetting{ ACTIVE_DISPLAY_PLUGIN_SETTING_NAME, displayPlugins.at(0)->getName() };
     auto lastActiveDisplayPluginName = activeDisplayPluginSetting.get();
@@ -3143,6 +3156,7 @@ void Application::initializeDisplayPlugins() {
 }
 
 void Application::initializeRenderEngine() {
+    PROFILE_RANGE(startup, __FUNCTION__);
     // FIXME: on low end systems os the shaders take up to 1 minute to compile, so we pause the deadlock watchdog thread.
     DeadlockWatchdogThread::withPause([&] {
         _graphicsEngine.initializeRender();
@@ -3184,6 +3198,7 @@ void Application::showLoginScreen() {
 static const QUrl AUTHORIZED_EXTERNAL_QML_SOURCE { "https://content.highfidelity.com/Experiences/Releases" };
 
 void Application::initializeUi() {
+    PROFILE_RANGE(startup, __FUNCTION__);
 
     // Allow remote QML content from trusted sources ONLY
     {
@@ -3309,6 +3324,18 @@ void Application::initializeUi() {
     // BUGZ-1365 - the root context should explicitly default to being unable to load local HTML content
     ContextAwareProfile::restrictContext(offscreenUi->getSurfaceContext(), true);
     offscreenUi->resume();
+
+    // The windows that the scripts and the toolbar mode of the tablet open on the desktop, compiled ahead of
+    // the first time the user opens one of them
+    DependencyManager::get<StartupTasks>()->addDeferred("precompile QML", [] {
+        getOffscreenUI()->precompile({
+            PathUtils::qmlUrl("InteractiveWindow.qml"),
+            PathUtils::qmlUrl("hifi/tablet/WindowRoot.qml"),
+            PathUtils::qmlUrl("hifi/tablet/TabletMenu.qml"),
+            PathUtils::qmlUrl("hifi/tablet/TabletAddressDialog.qml"),
+            PathUtils::qmlUrl("Browser.qml"),
+        });
+    });
 #endif
     connect(_window, &MainWindow::windowGeometryChanged, [this](const QRect& r){
         resizeGL();
@@ -5149,6 +5176,17 @@ void Application::idle() {
     }
 #endif
 
+    // What could wait for the first frame runs once there is one
+    static bool firstPresent = true;
+    if (firstPresent) {
+        auto displayPlugin = getActiveDisplayPlugin();
+        if (displayPlugin && displayPlugin->presentCount() > 0) {
+            firstPresent = false;
+            qCDebug(interfaceapp, "First frame presented after %4.2f seconds.", (double)_sessionRunTimer.elapsed() / 1000.0);
+            DependencyManager::get<StartupTasks>()->startDeferred();
+        }
+    }
+
 #ifdef Q_OS_WIN
     // If tracing is enabled then monitor the CPU in a separate thread
     static std::once_flag once;
@@ -5524,6 +5562,7 @@ QVector<EntityItemID> Application::pasteEntities(float x, float y, float z) {
 }
 
 void Application::init() {
+    PROFILE_RANGE(startup, __FUNCTION__);
     // Make sure Login state is up to date
 #if !defined(DISABLE_QML)
     DependencyManager::get<DialogsManager>()->toggleLoginDialog();
@@ -5566,8 +5605,13 @@ void Application::init() {
         return atan2(maxSize, distance);
     });
 
+    // the bounding volume hierarchies of static meshes are kept across sessions
+    auto shapeCache = std::make_shared<CollisionShapeCache>("shape_cache", "bvh");
+    shapeCache->initialize();
+    _shapeManager.setShapeCache(shapeCache);
     ObjectMotionState::setShapeManager(&_shapeManager);
     _physicsEngine->init();
+    _physicsEngine->setMultithreaded(Menu::getInstance()->isOptionChecked(MenuOption::PhysicsMultithreaded));
 
     EntityTreePointer tree = getEntities()->getTree();
     _entitySimulation->init(tree, _physicsEngine, &_entityEditSender);
@@ -6160,6 +6204,10 @@ void Application::updateSecondaryCameraViewFrustum() {
 
 static bool domainLoadingInProgress = false;
 
+// the part of the frame the update can use before the deferrable work waits for the next frame
+static const float UPDATE_FRAME_BUDGET_RATIO = 0.5f;
+static const float DEFAULT_TARGET_FRAME_RATE = 60.0f;
+
 void Application::tryToEnablePhysics() {
     bool enableInterstitial = DependencyManager::get<NodeList>()->getDomainHandler().getInterstitialModeEnabled();
 
@@ -6187,6 +6235,17 @@ void Application::update(float deltaTime) {
     if (_aboutToQuit) {
         return;
     }
+    _lastUpdateStartTime = usecTimestampNow();
+
+    // the scene loads as fast as it can until physics is enabled, past that the deferrable work has a budget
+    auto frameBudget = DependencyManager::get<FrameBudget>();
+    if (_physicsEnabled) {
+        float targetFrameRate = getTargetRenderFrameRate();
+        if (targetFrameRate <= 0.0f) {
+            targetFrameRate = DEFAULT_TARGET_FRAME_RATE;
+        }
+        frameBudget->beginFrame((uint64_t)(UPDATE_FRAME_BUDGET_RATIO * USECS_PER_SECOND / targetFrameRate));
+    }
 
     if (!_physicsEnabled) {
         if (!domainLoadingInProgress) {
@@ -6552,6 +6611,9 @@ void Application::update(float deltaTime) {
     PerformanceWarning warn(showWarnings, "Application::update()");
 
     updateLOD(deltaTime);
+    if (!isThrottleRendering()) {
+        _performanceManager.updateDynamicResolution(getGPUContext()->getFrameTimerGPUAverage(), getTargetRenderFrameRate(), deltaTime);
+    }
 
     if (!_loginDialogID.isNull()) {
         _loginStateManager.update(getMyAvatar()->getDominantHand(), _loginDialogID);
@@ -6642,6 +6704,11 @@ void Application::update(float deltaTime) {
         avatarManager->postUpdate(deltaTime, getMain3DScene());
     }
 
+    {
+        PerformanceTimer perfTimer("deferredWork");
+        frameBudget->runDeferred();
+    }
+
     {
         PROFILE_RANGE_EX(app, "PostUpdateLambdas", 0xffff0000, (uint64_t)0);
         PerformanceTimer perfTimer("postUpdateLambdas");
@@ -6676,12 +6743,15 @@ void Application::update(float deltaTime) {
         PerformanceTimer perfTimer("squeezeVision");
         _visionSqueeze.updateVisionSqueeze(myAvatar->getSensorToWorldMatrix(), deltaTime);
     }
+
+    frameBudget->endFrame();
 }
 
 void Application::updateRenderArgs(float deltaTime) {
     _graphicsEngine.editRenderArgs([this, deltaTime](AppRenderArgs& appRenderArgs) {
         PerformanceTimer perfTimer("editRenderArgs");
         appRenderArgs._headPose = getHMDSensorPose();
+        appRenderArgs._simulationStartTime = _lastUpdateStartTime;
 
         auto myAvatar = getMyAvatar();
 
@@ -6856,9 +6926,8 @@ int Application::sendNackPackets() {
                 if (_octreeServerSceneStats.find(nodeUUID) == _octreeServerSceneStats.end()) {
                     return;
                 }
-                // get sequence number stats of node, prune its missing set, and make a copy of the missing set
+                // get sequence number stats of node and make a copy of the missing set
                 SequenceNumberStats& sequenceNumberStats = _octreeServerSceneStats[nodeUUID].getIncomingOctreeSequenceNumberStats();
-                sequenceNumberStats.pruneMissingSet();
                 missingSequenceNumbers = sequenceNumberStats.getMissingSet();
             });
 
@@ -8538,7 +8607,8 @@ void Application::shareSnapshot(const QString& path, const QUrl& href) {
 }
 
 float Application::getRenderResolutionScale() const {
-    return RenderScriptingInterface::getInstance()->getViewportResolutionScale();
+    auto renderInterface = RenderScriptingInterface::getInstance();
+    return renderInterface->getViewportResolutionScale() * renderInterface->getDynamicResolutionScale();
 }
 
 void Application::notifyPacketVersionMismatch() {
@@ -8996,6 +9066,10 @@ void Application::setShowBulletConstraintLimits(bool value) {
     _physicsEngine->setShowBulletConstraintLimits(value);
 }
 
+void Application::setPhysicsMultithreaded(bool value) {
+    _physicsEngine->setMultithreaded(value);
+}
+
 void Application::createLoginDialog() {
     const glm::vec3 LOGIN_DIMENSIONS { 0.89f, 0.5f, 0.01f };
     const auto OFFSET = glm::vec2(0.7f, -0.1f);
@@ -537,6 +537,7 @@ private slots:
     void setShowBulletContactPoints(bool value);
     void setShowBulletConstraints(bool value);
     void setShowBulletConstraintLimits(bool value);
+    void setPhysicsMultithreaded(bool value);
 
     void onDismissedLoginDialog();
 
@@ -630,6 +631,7 @@ private:
     QTimer _minimizedWindowTimer;
     QElapsedTimer _timerStart;
     QElapsedTimer _lastTimeUpdated;
+    uint64_t _lastUpdateStartTime { 0 };
 
     int _minimumGPUTextureMemSizeStabilityCount { 30 };
 
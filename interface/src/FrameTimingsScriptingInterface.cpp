@@ -10,6 +10,8 @@
 
 #include <TextureCache.h>
 
+#include "Application.h"
+
 void FrameTimingsScriptingInterface::start() {
     _values.clear();
     DependencyManager::get<TextureCache>()->setUnusedResourceCacheSize(0);
@@ -51,3 +53,8 @@ QVariantList FrameTimingsScriptingInterface::getValues() const {
     }
     return result;
 }
+
+QVariantList FrameTimingsScriptingInterface::getTimeline() const {
+    auto displayPlugin = qApp->getActiveDisplayPlugin();
+    return displayPlugin ? displayPlugin->getFrameTimeline() : QVariantList();
+}
@@ -22,6 +22,10 @@ public:
     Q_INVOKABLE void finish();
     Q_INVOKABLE QVariantList getValues() const;
 
+    // the simulation, record, execute and present timestamps of the last presented frames, in usecs,
+    // and how long the gpu took on each of them
+    Q_INVOKABLE QVariantList getTimeline() const;
+
 
     uint64_t getMax() const { return _max; }
     uint64_t getMin() const { return _min; }
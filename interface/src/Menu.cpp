@@ -478,6 +478,18 @@ Menu::Menu() {
         MeshPartPayload::enableMaterialProceduralShaders = action->isChecked();
     });
 
+    action = addCheckableActionToQMenuAndActionHash(renderOptionsMenu, MenuOption::IndirectModelDraws, 0,
+        ModelMeshPartPayload::enableIndirectDraws);
+    connect(action, &QAction::triggered, [action] {
+        ModelMeshPartPayload::enableIndirectDraws = action->isChecked();
+    });
+
+    action = addCheckableActionToQMenuAndActionHash(renderOptionsMenu, MenuOption::ModelLODs, 0,
+        ModelMeshPartPayload::enableLODs);
+    connect(action, &QAction::triggered, [action] {
+        ModelMeshPartPayload::enableLODs = action->isChecked();
+    });
+
     {
         auto drawStatusConfig = qApp->getRenderEngine()->getConfiguration()->getConfig<render::DrawStatus>("RenderMainView.DrawStatus");
         addCheckableActionToQMenuAndActionHash(renderOptionsMenu, MenuOption::HighlightTransitions, 0, false,
@@ -677,6 +689,7 @@ Menu::Menu() {
     addCheckableActionToQMenuAndActionHash(physicsOptionsMenu, MenuOption::PhysicsShowBulletContactPoints, 0, false, qApp, SLOT(setShowBulletContactPoints(bool)));
     addCheckableActionToQMenuAndActionHash(physicsOptionsMenu, MenuOption::PhysicsShowBulletConstraints, 0, false, qApp, SLOT(setShowBulletConstraints(bool)));
     addCheckableActionToQMenuAndActionHash(physicsOptionsMenu, MenuOption::PhysicsShowBulletConstraintLimits, 0, false, qApp, SLOT(setShowBulletConstraintLimits(bool)));
+    addCheckableActionToQMenuAndActionHash(physicsOptionsMenu, MenuOption::PhysicsMultithreaded, 0, false, qApp, SLOT(setPhysicsMultithreaded(bool)));
 
     // Developer > Picking >>>
     MenuWrapper* pickingOptionsMenu = developerMenu->addMenu("Picking");
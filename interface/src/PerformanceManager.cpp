@@ -17,6 +17,18 @@
 #include "scripting/RenderScriptingInterface.h"
 #include "LODManager.h"
 
+// the fraction of the viewport resolution scale, in steps so that the framebuffers are only rebuilt on real changes
+static const float MIN_DYNAMIC_RESOLUTION_SCALE = 0.5f;
+static const float DYNAMIC_RESOLUTION_SCALE_STEP = 0.05f;
+
+// the fractions of the frame period above which the resolution drops and under which it goes back up, far enough
+// apart that a step up doesn't bring the GPU time back over the top one
+static const float GPU_TIME_HIGH_BUDGET = 0.9f;
+static const float GPU_TIME_LOW_BUDGET = 0.7f;
+
+static const float GPU_TIME_TIMESCALE = 0.25f; // sec
+static const float MIN_TIME_BETWEEN_RESOLUTION_CHANGES = 0.5f; // sec
+
 PerformanceManager::PerformanceManager()
 {
     setPerformancePreset((PerformancePreset) _performancePresetSetting.get());
@@ -123,3 +135,55 @@ void PerformanceManager::applyPerformancePreset(PerformanceManager::PerformanceP
         break;
     }
 }
+
+void PerformanceManager::setDynamicResolutionEnabled(bool enabled) {
+    _performancePresetSettingLock.withWriteLock([&] {
+        _dynamicResolutionSetting.set(enabled);
+    });
+    if (!enabled) {
+        applyDynamicResolutionScale(1.0f);
+    }
+}
+
+bool PerformanceManager::isDynamicResolutionEnabled() const {
+    return _performancePresetSettingLock.resultWithReadLock<bool>([&] {
+        return _dynamicResolutionSetting.get();
+    });
+}
+
+void PerformanceManager::updateDynamicResolution(float gpuTime, float targetFrameRate, float deltaTime) {
+    if (!isDynamicResolutionEnabled() || targetFrameRate <= 0.0f) {
+        _smoothGPUTime = 0.0f;
+        return;
+    }
+
+    deltaTime = glm::clamp(deltaTime, 0.0f, 1.0f);
+    float blend = std::min(deltaTime / GPU_TIME_TIMESCALE, 1.0f);
+    _smoothGPUTime = glm::mix(_smoothGPUTime, std::max(gpuTime, 0.0f), blend);
+
+    // the GPU times of the frames already in flight are from before the last change
+    _timeSinceResolutionChange += deltaTime;
+    if (_timeSinceResolutionChange < MIN_TIME_BETWEEN_RESOLUTION_CHANGES) {
+        return;
+    }
+
+    float framePeriod = (float)MSECS_PER_SECOND / targetFrameRate;
+    float scale = _dynamicResolutionScale;
+    if (_smoothGPUTime > GPU_TIME_HIGH_BUDGET * framePeriod) {
+        // the GPU time goes with the number of pixels, the square of the scale
+        float fittingScale = scale * sqrtf(GPU_TIME_HIGH_BUDGET * framePeriod / _smoothGPUTime);
+        scale = std::min(floorf(fittingScale / DYNAMIC_RESOLUTION_SCALE_STEP) * DYNAMIC_RESOLUTION_SCALE_STEP,
+                         scale - DYNAMIC_RESOLUTION_SCALE_STEP);
+    } else if (_smoothGPUTime < GPU_TIME_LOW_BUDGET * framePeriod) {
+        scale += DYNAMIC_RESOLUTION_SCALE_STEP;
+    }
+    applyDynamicResolutionScale(glm::clamp(scale, MIN_DYNAMIC_RESOLUTION_SCALE, 1.0f));
+}
+
+void PerformanceManager::applyDynamicResolutionScale(float scale) {
+    if (scale != _dynamicResolutionScale) {
+        _dynamicResolutionScale = scale;
+        _timeSinceResolutionChange = 0.0f;
+        RenderScriptingInterface::getInstance()->setDynamicResolutionScale(scale);
+    }
+}
@@ -38,9 +38,25 @@ public:
     void setPerformancePreset(PerformancePreset performancePreset);
     PerformancePreset getPerformancePreset() const;
 
+    // With dynamic resolution the main view renders at a fraction of the viewport resolution scale, which follows the
+    // GPU frame time to keep it under the frame period of the display
+    void setDynamicResolutionEnabled(bool enabled);
+    bool isDynamicResolutionEnabled() const;
+    float getDynamicResolutionScale() const { return _dynamicResolutionScale; }
+
+    // gpuTime is in ms, called once per update
+    void updateDynamicResolution(float gpuTime, float targetFrameRate, float deltaTime);
+
 private:
     mutable ReadWriteLockable _performancePresetSettingLock;
     Setting::Handle<int> _performancePresetSetting { "performancePreset", PerformanceManager::PerformancePreset::UNKNOWN };
+    Setting::Handle<bool> _dynamicResolutionSetting { "dynamicResolution", false };
+
+    float _smoothGPUTime { 0.0f };
+    float _dynamicResolutionScale { 1.0f };
+    float _timeSinceResolutionChange { 0.0f };
+
+    void applyDynamicResolutionScale(float scale);
 
     // The concrete performance preset changes
     void applyPerformancePreset(PerformanceManager::PerformancePreset performancePreset);
@@ -0,0 +1,144 @@
+//
+//  StartupTasks.cpp
+//  interface/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "StartupTasks.h"
+
+#include <algorithm>
+
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
+
+#include <Profile.h>
+
+#include "InterfaceLogging.h"
+
+void StartupTasks::addConcurrent(const QString& name, Task task, const QStringList& dependencies) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_concurrentTasks.contains(name)) {
+        qCWarning(interfaceapp) << "Startup task" << name << "was already added";
+        return;
+    }
+
+    ConcurrentTask concurrentTask;
+    concurrentTask.task = task;
+    for (const auto& dependency : dependencies) {
+        if (_concurrentTasks.contains(dependency)) {
+            concurrentTask.dependencies << dependency;
+        } else {
+            qCWarning(interfaceapp) << "Startup task" << name << "depends on" << dependency << "which wasn't added before it";
+        }
+    }
+    _concurrentTasks.insert(name, concurrentTask);
+    _numConcurrentRemaining++;
+    startReadyTasks();
+}
+
+void StartupTasks::addDeferred(const QString& name, Task task) {
+    Q_ASSERT(QThread::currentThread() == thread());
+    _deferredTasks.push_back({ name, task });
+    if (_deferredDone) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _deferredDone = false;
+        _finished = false;
+        lock.unlock();
+        QTimer::singleShot(0, this, &StartupTasks::runNextDeferred);
+    }
+}
+
+void StartupTasks::wait(const QString& name) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (!_concurrentTasks.contains(name)) {
+        qCWarning(interfaceapp) << "Waited for a startup task that wasn't added:" << name;
+        return;
+    }
+    PROFILE_RANGE(startup, "wait " + name);
+    _taskDone.wait(lock, [&] { return _concurrentTasks[name].isDone; });
+}
+
+void StartupTasks::startDeferred() {
+    Q_ASSERT(QThread::currentThread() == thread());
+    if (_deferredStarted) {
+        return;
+    }
+    _deferredStarted = true;
+    PROFILE_INSTANT(startup, "first frame", "g");
+    runNextDeferred();
+}
+
+void StartupTasks::startReadyTasks() {
+    for (auto itr = _concurrentTasks.begin(); itr != _concurrentTasks.end(); ++itr) {
+        auto& concurrentTask = itr.value();
+        if (concurrentTask.isStarted) {
+            continue;
+        }
+        bool isReady = std::all_of(concurrentTask.dependencies.cbegin(), concurrentTask.dependencies.cend(),
+            [&](const QString& dependency) { return _concurrentTasks[dependency].isDone; });
+        if (isReady) {
+            concurrentTask.isStarted = true;
+            QString name = itr.key();
+            QtConcurrent::run([this, name] { runConcurrent(name); });
+        }
+    }
+}
+
+void StartupTasks::runConcurrent(const QString& name) {
+    Task task;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        task = _concurrentTasks[name].task;
+    }
+
+    {
+        PROFILE_RANGE(startup, name);
+        task();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto& concurrentTask = _concurrentTasks[name];
+        concurrentTask.isDone = true;
+        concurrentTask.task = Task();
+        _numConcurrentRemaining--;
+        startReadyTasks();
+    }
+    _taskDone.notify_all();
+    checkFinished();
+}
+
+void StartupTasks::runNextDeferred() {
+    if (_deferredTasks.isEmpty()) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _deferredDone = true;
+        }
+        checkFinished();
+        return;
+    }
+
+    auto deferredTask = _deferredTasks.takeFirst();
+    {
+        PROFILE_RANGE(startup, deferredTask.first);
+        deferredTask.second();
+    }
+    QTimer::singleShot(0, this, &StartupTasks::runNextDeferred);
+}
+
+void StartupTasks::checkFinished() {
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_finished || !_deferredDone || _numConcurrentRemaining > 0) {
+            return;
+        }
+        _finished = true;
+    }
+    qCDebug(interfaceapp) << "Startup tasks finished";
+    emit finished();
+}
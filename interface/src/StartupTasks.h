@@ -0,0 +1,77 @@
+//
+//  StartupTasks.h
+//  interface/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_StartupTasks_h
+#define hifi_StartupTasks_h
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+
+#include <DependencyManager.h>
+
+// The parts of the startup that don't have to run one after the other on the main thread.
+// The concurrent tasks run on the global thread pool as soon as the tasks they depend on are done, the deferred
+// ones run on the main thread once the first frame was presented, one per pass of the event loop so that they
+// don't hold up the frames that follow.  Every task is a range of the startup trace category.
+class StartupTasks : public QObject, public Dependency {
+    Q_OBJECT
+    SINGLETON_DEPENDENCY
+
+public:
+    using Task = std::function<void()>;
+
+    // the dependencies must have been added before, a task whose dependencies are done starts right away
+    void addConcurrent(const QString& name, Task task, const QStringList& dependencies = QStringList());
+
+    // runs on the main thread after the first frame, in the order they were added
+    void addDeferred(const QString& name, Task task);
+
+    // blocks until a concurrent task is done, for the startup code that needs what it made
+    void wait(const QString& name);
+
+    // called on the main thread once the first frame was presented
+    void startDeferred();
+
+signals:
+    // all of the tasks are done, the concurrent and the deferred ones
+    void finished();
+
+private:
+    struct ConcurrentTask {
+        Task task;
+        QStringList dependencies;
+        bool isStarted { false };
+        bool isDone { false };
+    };
+
+    // starts the concurrent tasks whose dependencies are done, with _mutex locked
+    void startReadyTasks();
+    void runConcurrent(const QString& name);
+    void runNextDeferred();
+    void checkFinished();
+
+    std::mutex _mutex;
+    std::condition_variable _taskDone;
+    QHash<QString, ConcurrentTask> _concurrentTasks;
+    int _numConcurrentRemaining { 0 };
+
+    QList<QPair<QString, Task>> _deferredTasks;
+    bool _deferredStarted { false };
+    bool _deferredDone { false };
+    bool _finished { false };
+};
+
+#endif // hifi_StartupTasks_h
@@ -35,6 +35,7 @@
 #include <RegisteredMetaTypes.h>
 #include <Rig.h>
 #include <SettingHandle.h>
+#include <TBBHelpers.h>
 #include <UsersScriptingInterface.h>
 #include <UUID.h>
 #include <shared/ConicalViewFrustum.h>
@@ -82,6 +83,9 @@ AvatarManager::AvatarManager(QObject* parent) :
     _transitConfig._framesPerMeter = AVATAR_TRANSIT_FRAMES_PER_METER;
     _transitConfig._isDistanceBased = AVATAR_TRANSIT_DISTANCE_BASED;
     _transitConfig._abortDistance = AVATAR_TRANSIT_ABORT_DISTANCE;
+
+    // the joints of the packets that arrive in a frame are unpacked together at the start of updateOtherAvatars
+    _deferJointDecompression = true;
 }
 
 AvatarSharedPointer AvatarManager::addAvatar(const QUuid& sessionUUID, const QWeakPointer<Node>& mixerWeakPointer) {
@@ -109,6 +113,7 @@ void AvatarManager::init() {
     {
         QWriteLocker locker(&_hashLock);
         _avatarHash.insert(MY_AVATAR_KEY, _myAvatar);
+        markHashChanged();
     }
 
     _shouldRender = DependencyManager::get<SceneScriptingInterface>()->shouldRenderAvatars();
@@ -216,13 +221,33 @@ float AvatarManager::getAvatarSimulationRate(const QUuid& sessionID, const QStri
     return avatar ? avatar->getSimulationRate(rateName) : 0.0f;
 }
 
+OtherAvatar::AnimationLOD AvatarManager::computeAnimationLOD(const ConicalViewFrustums& views, const glm::vec3& position,
+                                                             float radius) const {
+    // the angular size, from the nearest view
+    float size = 0.0f;
+    for (const auto& view : views) {
+        float distance = glm::distance(view.getPosition(), position);
+        size = std::max(size, radius / std::max(distance, radius));
+    }
+    if (size < _quarterRateAnimationSize) {
+        return OtherAvatar::AnimationLOD::QuarterRate;
+    } else if (size < _halfRateAnimationSize) {
+        return OtherAvatar::AnimationLOD::HalfRate;
+    }
+    return OtherAvatar::AnimationLOD::FullRate;
+}
+
+void AvatarManager::setAnimationLODSizes(float halfRateSize, float quarterRateSize) {
+    _halfRateAnimationSize = std::max(halfRateSize, 0.0f);
+    _quarterRateAnimationSize = glm::clamp(quarterRateSize, 0.0f, _halfRateAnimationSize);
+}
+
 void AvatarManager::updateOtherAvatars(float deltaTime) {
-    {
-        // lock the hash for read to check the size
-        QReadLocker lock(&_hashLock);
-        if (_avatarHash.size() < 2) {
-            return;
-        }
+    decompressJointData();
+
+    auto avatarMap = getHashCopy();
+    if (avatarMap.size() < 2) {
+        return;
     }
 
     PerformanceTimer perfTimer("otherAvatars");
@@ -239,8 +264,6 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
         std::shared_ptr<Avatar> _avatar;
     };
 
-    auto avatarMap = getHashCopy();
-
     const auto& views = qApp->getConicalViews();
     // Prepare 2 queues for heros and for crowd avatars
     using AvatarPriorityQueue = PrioritySortUtil::PriorityQueue<SortableAvatar>;
@@ -296,10 +319,42 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
     render::Transaction renderTransaction;
     workload::Transaction workloadTransaction;
 
+    // Sorting the queues HERE as part of the measured timing.  The new joints of the avatars in view are decoded
+    // on the workers, in priority order, before the serial pass takes the avatars one by one.
+    // The animation LOD of each avatar in view is picked here too, from its size on screen.
+    const std::vector<SortableAvatar>* sortedAvatarVectors[NumVariants];
+    std::vector<OtherAvatarPointer> avatarsToDecode;
+    int numAvatarsPerAnimationLOD[OtherAvatar::NumAnimationLODs] = { 0 };
     for (int p = kHero; p < NumVariants; p++) {
-        auto& priorityQueue = avatarPriorityQueues[p];
-        // Sorting the current queue HERE as part of the measured timing.
-        const auto& sortedAvatarVector = priorityQueue.getSortedVector();
+        sortedAvatarVectors[p] = &avatarPriorityQueues[p].getSortedVector();
+        for (const auto& sortData : *sortedAvatarVectors[p]) {
+            auto avatar = std::static_pointer_cast<OtherAvatar>(sortData.getAvatar());
+            avatar->_jointDataDecoded = false;
+            if (sortData.getPriority() > OUT_OF_VIEW_THRESHOLD) {
+                OtherAvatar::AnimationLOD lod = computeAnimationLOD(views, sortData.getPosition(), sortData.getRadius());
+                avatar->setAnimationLOD(lod);
+                numAvatarsPerAnimationLOD[lod]++;
+                if (avatar->hasNewJointData() && avatar->isAnimationFrame()) {
+                    avatarsToDecode.push_back(avatar);
+                }
+            }
+        }
+    }
+    for (int lod = 0; lod < OtherAvatar::NumAnimationLODs; lod++) {
+        _numAvatarsPerAnimationLOD[lod] = numAvatarsPerAnimationLOD[lod];
+    }
+    {
+        PROFILE_RANGE(simulation_avatars, "decodeJointData");
+        tbb::parallel_for((size_t)0, avatarsToDecode.size(), [&](size_t i) {
+            avatarsToDecode[i]->decodeJointData();
+        });
+    }
+
+    std::vector<OtherAvatarPointer> simulatedAvatars;
+    simulatedAvatars.reserve(avatarMap.size());
+
+    for (int p = kHero; p < NumVariants; p++) {
+        const auto& sortedAvatarVector = *sortedAvatarVectors[p];
 
         auto passExpiry = updatePriorityExpiries[p];
 
@@ -341,6 +396,7 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
                     avatar->setIsNewAvatar(false);
                 }
                 avatar->simulate(deltaTime, inView);
+                simulatedAvatars.push_back(avatar);
                 if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1) {
                     _myAvatar->addAvatarHandsToFlow(avatar);
                 }
@@ -365,6 +421,7 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
                         crowdQueue.push(SortableAvatar((*it).getAvatar()));
                         ++it;
                     }
+                    sortedAvatarVectors[kNonHero] = &crowdQueue.getSortedVector();
                 } else {
                     // Non Hero
                     // --> bail on the rest of the avatar updates
@@ -386,6 +443,15 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
         }
     }
 
+    // the skinning matrices of the simulated avatars are computed on the workers as well, so by the time their
+    // render items are updated at the end of the frame there is nothing left to compute on this thread
+    {
+        PROFILE_RANGE(simulation_avatars, "updateClusterMatrices");
+        tbb::parallel_for((size_t)0, simulatedAvatars.size(), [&](size_t i) {
+            simulatedAvatars[i]->getSkeletonModel()->updateClusterMatrices();
+        });
+    }
+
     if (_shouldRender) {
         qApp->getMain3DScene()->enqueueTransaction(renderTransaction);
     }
@@ -626,6 +692,7 @@ void AvatarManager::clearOtherAvatars() {
                 ++avatarIterator;
             }
         }
+        markHashChanged();
     }
 
     for (auto& av : removedAvatars) {
@@ -635,18 +702,23 @@ void AvatarManager::clearOtherAvatars() {
 
 void AvatarManager::deleteAllAvatars() {
     _otherAvatarsToChangeInPhysics.clear();
-    QReadLocker locker(&_hashLock);
-    AvatarHash::iterator avatarIterator = _avatarHash.begin();
-    while (avatarIterator != _avatarHash.end()) {
-        auto avatar = std::static_pointer_cast<Avatar>(avatarIterator.value());
-        avatarIterator = _avatarHash.erase(avatarIterator);
-        avatar->die();
-        if (avatar != _myAvatar) {
-            auto otherAvatar = std::static_pointer_cast<OtherAvatar>(avatar);
-            assert(!otherAvatar->_motionState);
-            assert(otherAvatar->getDetailedMotionStates().size() == 0);
+    {
+        QWriteLocker locker(&_hashLock);
+        AvatarHash::iterator avatarIterator = _avatarHash.begin();
+        while (avatarIterator != _avatarHash.end()) {
+            auto avatar = std::static_pointer_cast<Avatar>(avatarIterator.value());
+            avatarIterator = _avatarHash.erase(avatarIterator);
+            avatar->die();
+            if (avatar != _myAvatar) {
+                auto otherAvatar = std::static_pointer_cast<OtherAvatar>(avatar);
+                assert(!otherAvatar->_motionState);
+                assert(otherAvatar->getDetailedMotionStates().size() == 0);
+            }
         }
+        markHashChanged();
     }
+    // publish the empty hash so that the last snapshot doesn't keep the avatars alive
+    getHashSnapshot();
 }
 
 void AvatarManager::handleChangedMotionStates(const VectorOfMotionStates& motionStates) {
@@ -22,6 +22,7 @@
 #include <PhysicsEngine.h>
 #include <PIDController.h>
 #include <SimpleMovingAverage.h>
+#include <shared/ConicalViewFrustum.h>
 #include <shared/RateCounter.h>
 #include <avatars-renderer/ScriptAvatar.h>
 #include <AudioInjectorManager.h>
@@ -117,6 +118,7 @@ public:
     int getNumAvatarsNotUpdated() const { return _numAvatarsNotUpdated; }
     int getNumHeroAvatars() const { return _numHeroAvatars; }
     int getNumHeroAvatarsUpdated() const { return _numHeroAvatarsUpdated; }
+    int getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLOD lod) const { return _numAvatarsPerAnimationLOD[lod]; }
     float getAvatarSimulationTime() const { return _avatarSimulationTime; }
 
     void updateMyAvatar(float deltaTime);
@@ -232,6 +234,16 @@ public:
      */
     Q_INVOKABLE void setAvatarSortCoefficient(const QString& name, const QScriptValue& value);
 
+    /**jsdoc
+     * Sets the sizes on screen below which other avatars apply their received joints at reduced rates. A size is the
+     * radius of the avatar divided by its distance from the camera.
+     * @function AvatarManager.setAnimationLODSizes
+     * @param {number} halfRateSize - Below this size, the joints are applied every other frame. Default <code>0.05</code>.
+     * @param {number} quarterRateSize - Below this size, the joints are applied every fourth frame. Default
+     *     <code>0.02</code>.
+     */
+    Q_INVOKABLE void setAnimationLODSizes(float halfRateSize, float quarterRateSize);
+
     /**jsdoc
      * Gets PAL (People Access List) data for one or more avatars. Using this method is faster than iterating over each avatar 
      * and obtaining data about each individually.
@@ -284,6 +296,9 @@ private:
 
     AvatarSharedPointer newSharedAvatar(const QUuid& sessionUUID) override;
 
+    OtherAvatar::AnimationLOD computeAnimationLOD(const ConicalViewFrustums& views, const glm::vec3& position,
+                                                  float radius) const;
+
     // called only from the AvatarHashMap thread - cannot be called while this thread holds the
     // hash lock, since handleRemovedAvatar needs a write lock on the entity tree and the entity tree
     // frequently grabs a read lock on the hash to get a given avatar by ID
@@ -304,6 +319,9 @@ private:
     int _numAvatarsNotUpdated { 0 };
     int _numHeroAvatars{ 0 };
     int _numHeroAvatarsUpdated{ 0 };
+    int _numAvatarsPerAnimationLOD[OtherAvatar::NumAnimationLODs] { 0 };
+    float _halfRateAnimationSize { 0.05f };
+    float _quarterRateAnimationSize { 0.02f };
     float _avatarSimulationTime { 0.0f };
     bool _shouldRender { true };
     bool _myAvatarDataPacketsPaused { false };
@@ -243,6 +243,22 @@ void OtherAvatar::setCollisionWithOtherAvatarsFlags() {
     }
 }
 
+void OtherAvatar::setAnimationLOD(AnimationLOD lod) {
+    _animationLOD = lod;
+    _animationFrame++;
+}
+
+void OtherAvatar::decodeJointData() {
+    PROFILE_RANGE(simulation_avatars, "decodeJointData");
+    {
+        QReadLocker readLock(&_jointDataLock);
+        _skeletonModel->getRig().copyJointsFromJointData(_jointData);
+    }
+    glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
+    _skeletonModel->getRig().computeExternalPoses(rootTransform);
+    _jointDataDecoded = true;
+}
+
 void OtherAvatar::simulate(float deltaTime, bool inView) {
     PROFILE_RANGE(simulation, "simulate");
 
@@ -261,10 +277,11 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
         PROFILE_RANGE(simulation, "updateJoints");
         if (inView) {
             Head* head = getHead();
-            if (_hasNewJointData || _transit.isActive()) {
-                _skeletonModel->getRig().copyJointsFromJointData(_jointData);
-                glm::mat4 rootTransform = glm::scale(_skeletonModel->getScale()) * glm::translate(_skeletonModel->getOffset());
-                _skeletonModel->getRig().computeExternalPoses(rootTransform);
+            // at the reduced rates the joints keep their pose between the frames that apply them
+            if ((_hasNewJointData || _transit.isActive()) && isAnimationFrame()) {
+                if (!_jointDataDecoded) {
+                    decodeJointData();
+                }
                 _jointDataSimulationRate.increment();
 
                 head->simulate(deltaTime);
@@ -290,6 +307,7 @@ void OtherAvatar::simulate(float deltaTime, bool inView) {
         }
         _skeletonModelSimulationRate.increment();
     }
+    _jointDataDecoded = false;
 
     // update animation for display name fade in/out
     if ( _displayNameTargetAlpha != _displayNameAlpha) {
@@ -32,6 +32,14 @@ public:
         MultiSphereHigh // All joints
     };
 
+    // How often the received joints are applied, from the size of the avatar on screen
+    enum AnimationLOD {
+        FullRate = 0,
+        HalfRate,
+        QuarterRate,
+        NumAnimationLODs
+    };
+
     virtual void instantiableAvatar() override { };
     virtual void createOrb() override;
     virtual void indicateLoadingStatus(LoadingStatus loadingStatus) override;
@@ -58,11 +66,20 @@ public:
     BodyLOD getBodyLOD() { return _bodyLOD; }
     void computeShapeLOD();
 
+    // called once per frame, advances the frame that the reduced rates count from
+    void setAnimationLOD(AnimationLOD lod);
+    AnimationLOD getAnimationLOD() const { return _animationLOD; }
+    bool isAnimationFrame() const { return (_animationFrame & ((1 << _animationLOD) - 1)) == 0; }
+
     void updateCollisionGroup(bool myAvatarCollide);
     bool getCollideWithOtherAvatars() const { return _collideWithOtherAvatars; } 
 
     void setCollisionWithOtherAvatarsFlags() override;
 
+    // copies the received joints into the rig and computes its poses.  It only touches this avatar, so the
+    // AvatarManager runs it for many avatars on the workers, and simulate() then skips it
+    void decodeJointData();
+
     void simulate(float deltaTime, bool inView) override;
     void debugJointData() const;
     friend AvatarManager;
@@ -91,6 +108,10 @@ protected:
     uint8_t _workloadRegion { workload::Region::INVALID };
     BodyLOD _bodyLOD { BodyLOD::Sphere };
     bool _needsDetailedRebuild { false };
+    bool _jointDataDecoded { false };
+    AnimationLOD _animationLOD { AnimationLOD::FullRate };
+    // starts anywhere so that the avatars at the same reduced rate are not all updated in the same frame
+    uint32_t _animationFrame { (uint32_t)randIntInRange(0, 3) };
 };
 
 using OtherAvatarPointer = std::shared_ptr<OtherAvatar>;
@@ -202,6 +202,7 @@ void GraphicsEngine::render_performFrame() {
     ViewFrustum viewFrustum;
 
     bool isStereo;
+    uint64_t simulationStartTime;
     glm::mat4  stereoEyeOffsets[2];
     glm::mat4  stereoEyeProjections[2];
 
@@ -218,6 +219,7 @@ void GraphicsEngine::render_performFrame() {
         eyeToWorld = _appRenderArgs._eyeToWorld;
         sensorToWorld = _appRenderArgs._sensorToWorld;
         isStereo = _appRenderArgs._isStereo;
+        simulationStartTime = _appRenderArgs._simulationStartTime;
         for_each_eye([&](Eye eye) {
             stereoEyeOffsets[eye] = _appRenderArgs._eyeOffsets[eye];
             stereoEyeProjections[eye] = _appRenderArgs._eyeProjections[eye];
@@ -289,6 +291,9 @@ void GraphicsEngine::render_performFrame() {
 
     auto frame = getGPUContext()->endFrame();
     frame->frameIndex = _renderFrameCount;
+    frame->simulationStartTime = simulationStartTime;
+    frame->recordStartTime = lastPaintBegin;
+    frame->recordEndTime = usecTimestampNow();
     frame->framebuffer = finalFramebuffer;
     frame->framebufferRecycler = [](const gpu::FramebufferPointer& framebuffer) {
         auto frameBufferCache = DependencyManager::get<FramebufferCache>();
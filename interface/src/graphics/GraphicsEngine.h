@@ -33,6 +33,7 @@ struct AppRenderArgs {
     glm::mat4 _sensorToWorld;
     float _sensorToWorldScale{ 1.0f };
     bool _isStereo{ false };
+    uint64_t _simulationStartTime{ 0 };
 };
 
 using RenderArgsEditor = std::function <void(AppRenderArgs&)>;
@@ -32,6 +32,7 @@
 #include "InterfaceLogging.h"
 #include "UserActivityLogger.h"
 #include "MainWindow.h"
+#include "StartupTasks.h"
 
 #include "Profile.h"
 
@@ -184,7 +185,16 @@ int main(int argc, const char* argv[]) {
             break;
         }
     }
-    if (traceFile != nullptr) {
+    // --traceStartupFile only traces the startup, until the tasks deferred after the first frame are done
+    const char* traceStartupFile = nullptr;
+    const QString traceStartupFileFlag("--traceStartupFile");
+    for (int a = 1; a < argc; ++a) {
+        if (traceStartupFileFlag == argv[a] && argc > a + 1) {
+            traceStartupFile = argv[a + 1];
+            break;
+        }
+    }
+    if (traceFile != nullptr || traceStartupFile != nullptr) {
         tracer->startTracing();
     }
    
@@ -376,6 +386,13 @@ int main(int argc, const char* argv[]) {
         Application app(argcExtended, const_cast<char**>(argvExtended.data()), startupTime, runningMarkerExisted);
         PROFILE_SYNC_END(startup, "app full ctor", "");
 
+        if (traceStartupFile != nullptr && traceFile == nullptr) {
+            QObject::connect(DependencyManager::get<StartupTasks>().data(), &StartupTasks::finished, &app, [&] {
+                tracer->stopTracing();
+                tracer->serialize(QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation) + "/" + traceStartupFile);
+            });
+        }
+
 #if defined(Q_OS_LINUX)
         app.setWindowIcon(QIcon(PathUtils::resourcesPath() + "images/hifi-logo.svg"));
 #endif
@@ -50,6 +50,9 @@ void SafeLanding::startTracking(QSharedPointer<EntityTreeRenderer> entityTreeRen
             _sequenceNumbers.clear();
             _trackingEntities = true;
             _startTime = usecTimestampNow();
+            _sequenceFinishedTime = 0;
+            _collidablesReadyTime = 0;
+            _completeTime = 0;
 
             connect(std::const_pointer_cast<EntityTree>(entityTree).get(),
                 &EntityTree::addingEntity, this, &SafeLanding::addTrackedEntity, Qt::DirectConnection);
@@ -91,6 +94,7 @@ void SafeLanding::finishSequence(OCTREE_PACKET_SEQUENCE first, OCTREE_PACKET_SEQ
     if (_trackingEntities) {
         _sequenceStart = first;
         _sequenceEnd = last;
+        _sequenceFinishedTime = usecTimestampNow();
     }
 }
 
@@ -107,9 +111,12 @@ void SafeLanding::updateTracking() {
     {
         Locker lock(_lock);
         bool enableInterstitial = DependencyManager::get<NodeList>()->getDomainHandler().getInterstitialModeEnabled();
+        bool collidablesReady = true;
         auto entityMapIter = _trackedEntities.begin();
         while (entityMapIter != _trackedEntities.end()) {
             auto entity = entityMapIter->second;
+            bool isPhysicsReady = isEntityPhysicsReady(entity);
+            collidablesReady = collidablesReady && isPhysicsReady;
             bool isVisuallyReady = true;
             if (enableInterstitial) {
                 auto entityRenderable = _entityTreeRenderer->renderableForEntityId(entityMapIter->first);
@@ -118,7 +125,7 @@ void SafeLanding::updateTracking() {
                 }
                 isVisuallyReady = entity->isVisuallyReady() || (!entityRenderable && !entity->isParentPathComplete());
             }
-            if (isEntityPhysicsReady(entity) && isVisuallyReady) {
+            if (isPhysicsReady && isVisuallyReady) {
                 entityMapIter = _trackedEntities.erase(entityMapIter);
             } else {
                 entityMapIter++;
@@ -127,6 +134,10 @@ void SafeLanding::updateTracking() {
         if (enableInterstitial) {
             _trackedEntityStabilityCount++;
         }
+        // the entities sent first are the collidables, the rest only has to be seen
+        if (collidablesReady && _collidablesReadyTime == 0 && _sequenceStart != SafeLanding::INVALID_SEQUENCE) {
+            _collidablesReadyTime = usecTimestampNow();
+        }
     }
 
     if (_trackedEntities.empty()) {
@@ -156,6 +167,14 @@ void SafeLanding::stopTracking() {
     Locker lock(_lock);
     if (_trackingEntities) {
         _trackingEntities = false;
+        _completeTime = usecTimestampNow();
+        if (_collidablesReadyTime == 0) {
+            _collidablesReadyTime = _completeTime;
+        }
+        qCDebug(interfaceapp) << "Safe landing took" << phaseUsecs(_completeTime) / USECS_PER_MSEC << "ms:"
+            << "initial entities sent after" << phaseUsecs(_sequenceFinishedTime) / USECS_PER_MSEC << "ms,"
+            << "collidables ready after" << phaseUsecs(_collidablesReadyTime) / USECS_PER_MSEC << "ms,"
+            << _maxTrackedEntityCount << "entities tracked";
         if (_entityTreeRenderer) {
             auto entityTree = _entityTreeRenderer->getTree();
             disconnect(std::const_pointer_cast<EntityTree>(entityTree).get(),
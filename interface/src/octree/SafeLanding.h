@@ -43,6 +43,12 @@ public:
     void addToSequence(OCTREE_PACKET_SEQUENCE sequenceNumber);
     float loadingProgressPercentage();
 
+    // how long the phases of the last landing took, from the start of the tracking: until the server had sent
+    // the initial entities, until the collidables among them were ready for physics, and until the landing was safe
+    quint64 getSequenceFinishedUsecs() const { return phaseUsecs(_sequenceFinishedTime); }
+    quint64 getCollidablesReadyUsecs() const { return phaseUsecs(_collidablesReadyTime); }
+    quint64 getCompleteUsecs() const { return phaseUsecs(_completeTime); }
+
 private slots:
     void addTrackedEntity(const EntityItemID& entityID);
     void deleteTrackedEntity(const EntityItemID& entityID);
@@ -50,6 +56,7 @@ private slots:
 private:
     bool isEntityPhysicsReady(const EntityItemPointer& entity);
     void debugDumpSequenceIDs() const;
+    quint64 phaseUsecs(quint64 phaseTime) const { return phaseTime > _startTime ? phaseTime - _startTime : 0; }
 
     std::mutex _lock;
     using Locker = std::lock_guard<std::mutex>;
@@ -64,6 +71,9 @@ private:
     int32_t _trackedEntityStabilityCount { 0 };
 
     quint64 _startTime { 0 };
+    quint64 _sequenceFinishedTime { 0 };
+    quint64 _collidablesReadyTime { 0 };
+    quint64 _completeTime { 0 };
 
     struct SequenceLessThan {
         bool operator()(const OCTREE_PACKET_SEQUENCE& a, const OCTREE_PACKET_SEQUENCE& b) const;
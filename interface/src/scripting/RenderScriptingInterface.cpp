@@ -173,18 +173,42 @@ void RenderScriptingInterface::forceViewportResolutionScale(float scale) {
     _renderSettingLock.withWriteLock([&] {
         _viewportResolutionScale = (scale);
         _viewportResolutionScaleSetting.set(scale);
+        float resolutionScale = _viewportResolutionScale * _dynamicResolutionScale;
 
         auto renderConfig = qApp->getRenderEngine()->getConfiguration();
         assert(renderConfig);
         auto deferredView = renderConfig->getConfig("RenderMainView.RenderDeferredTask");
         // mainView can be null if we're rendering in forward mode
         if (deferredView) {
-            deferredView->setProperty("resolutionScale", _viewportResolutionScale);
+            deferredView->setProperty("resolutionScale", resolutionScale);
         }
         auto forwardView = renderConfig->getConfig("RenderMainView.RenderForwardTask");
         // mainView can be null if we're rendering in forward mode
         if (forwardView) {
-            forwardView->setProperty("resolutionScale", _viewportResolutionScale);
+            forwardView->setProperty("resolutionScale", resolutionScale);
         }
     });
 }
+
+float RenderScriptingInterface::getDynamicResolutionScale() const {
+    return _dynamicResolutionScale;
+}
+
+bool RenderScriptingInterface::getDynamicResolutionEnabled() const {
+    return qApp->getPerformanceManager().isDynamicResolutionEnabled();
+}
+
+void RenderScriptingInterface::setDynamicResolutionEnabled(bool enabled) {
+    if (getDynamicResolutionEnabled() != enabled) {
+        qApp->getPerformanceManager().setDynamicResolutionEnabled(enabled);
+        emit settingsChanged();
+    }
+}
+
+void RenderScriptingInterface::setDynamicResolutionScale(float scale) {
+    if (_dynamicResolutionScale != scale && scale > 0.0f) {
+        _dynamicResolutionScale = scale;
+        forceViewportResolutionScale(_viewportResolutionScale);
+        emit dynamicResolutionScaleChanged();
+    }
+}
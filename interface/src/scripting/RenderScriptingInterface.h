@@ -37,6 +37,8 @@ class RenderScriptingInterface : public QObject {
     Q_PROPERTY(bool ambientOcclusionEnabled READ getAmbientOcclusionEnabled WRITE setAmbientOcclusionEnabled NOTIFY settingsChanged)
     Q_PROPERTY(bool antialiasingEnabled READ getAntialiasingEnabled WRITE setAntialiasingEnabled NOTIFY settingsChanged)
     Q_PROPERTY(float viewportResolutionScale READ getViewportResolutionScale WRITE setViewportResolutionScale NOTIFY settingsChanged)
+    Q_PROPERTY(bool dynamicResolutionEnabled READ getDynamicResolutionEnabled WRITE setDynamicResolutionEnabled NOTIFY settingsChanged)
+    Q_PROPERTY(float dynamicResolutionScale READ getDynamicResolutionScale NOTIFY dynamicResolutionScaleChanged)
 
 public:
     RenderScriptingInterface();
@@ -170,6 +172,32 @@ public slots:
      */
     void setViewportResolutionScale(float resolutionScale);
 
+    /**jsdoc
+     * Gets the fraction of the view port resolution scale the main view currently renders at. It is <code>1.0</code>
+     * unless dynamic resolution is lowering it to keep up with the frame rate of the display.
+     * @function Render.getDynamicResolutionScale
+     * @returns {number} The dynamic resolution scale, in the range <code>0.5</code> &ndash; <code>1.0</code>.
+     */
+    float getDynamicResolutionScale() const;
+
+    /**jsdoc
+     * Gets whether or not the main view resolution follows the GPU frame time.
+     * @function Render.getDynamicResolutionEnabled
+     * @returns {boolean} <code>true</code> if dynamic resolution is enabled, <code>false</code> if it isn't.
+     */
+    bool getDynamicResolutionEnabled() const;
+
+    /**jsdoc
+     * Sets whether or not the main view resolution follows the GPU frame time. It stays under the view port resolution
+     * scale.
+     * @function Render.setDynamicResolutionEnabled
+     * @param {boolean} enabled - <code>true</code> to enable dynamic resolution, <code>false</code> to disable.
+     */
+    void setDynamicResolutionEnabled(bool enabled);
+
+    // applied by the PerformanceManager, on top of the view port resolution scale
+    void setDynamicResolutionScale(float scale);
+
 signals:
     
     /**jsdoc
@@ -184,6 +212,13 @@ signals:
      */
     void settingsChanged();
 
+    /**jsdoc
+     * Triggered when dynamic resolution changes the resolution the main view renders at.
+     * @function Render.dynamicResolutionScaleChanged
+     * @returns {Signal}
+     */
+    void dynamicResolutionScaleChanged();
+
 private:
     // One lock to serialize and access safely all the settings
     mutable ReadWriteLockable _renderSettingLock;
@@ -194,6 +229,7 @@ private:
     bool _ambientOcclusionEnabled{ false };
     bool _antialiasingEnabled{ true };
     float _viewportResolutionScale{ 1.0f };
+    float _dynamicResolutionScale{ 1.0f };
 
     // Actual settings saved on disk
     Setting::Handle<int> _renderMethodSetting { "renderMethod", RENDER_FORWARD ? render::Args::RenderMethod::FORWARD : render::Args::RenderMethod::DEFERRED };
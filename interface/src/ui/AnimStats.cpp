@@ -109,6 +109,14 @@ void AnimStats::updateStats(bool force) {
     _networkGraphText = QString("Network Graph: %1").arg(networkGraphActive ? "enabled" : "disabled");
     emit networkGraphTextChanged();
 
+    // print the loops and the time of the last IK solve
+    const Rig& rig = myAvatar->getSkeletonModel()->getRig();
+    _ikText = QString("IK: %1 loops, %2 us, error %3").
+        arg(rig.getIKNumLoopsOnLastSolve()).
+        arg(rig.getIKUsecsOnLastSolve()).
+        arg(QString::number(rig.getIKErrorOnLastSolve(), 'f', 4));
+    emit ikTextChanged();
+
     // update animation debug alpha values
     QStringList newAnimAlphaValues;
     qint64 now = usecTimestampNow();
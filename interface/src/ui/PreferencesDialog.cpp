@@ -498,6 +498,12 @@ void setupPreferences() {
         auto preference = new CheckPreference(AUDIO_BUFFERS, "Disable output starve detection", getter, setter);
         preferences->addPreference(preference);
     }
+    {
+        auto getter = []()->bool { return DependencyManager::get<AudioClient>()->getOutputLowLatencyEnabled(); };
+        auto setter = [](bool value) { DependencyManager::get<AudioClient>()->setOutputLowLatencyEnabled(value); };
+        auto preference = new CheckPreference(AUDIO_BUFFERS, "Low-latency output (applies on device restart)", getter, setter);
+        preferences->addPreference(preference);
+    }
     {
         auto getter = []()->float { return DependencyManager::get<AudioClient>()->getOutputBufferSize(); };
         auto setter = [](float value) { DependencyManager::get<AudioClient>()->setOutputBufferSize(value); };
@@ -130,6 +130,9 @@ void Stats::updateStats(bool force) {
     STAT_UPDATE(updatedAvatarCount, avatarManager->getNumAvatarsUpdated());
     STAT_UPDATE(updatedHeroAvatarCount, avatarManager->getNumHeroAvatarsUpdated());
     STAT_UPDATE(notUpdatedAvatarCount, avatarManager->getNumAvatarsNotUpdated());
+    STAT_UPDATE(fullRateAvatarCount, avatarManager->getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLOD::FullRate));
+    STAT_UPDATE(halfRateAvatarCount, avatarManager->getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLOD::HalfRate));
+    STAT_UPDATE(quarterRateAvatarCount, avatarManager->getNumAvatarsAtAnimationLOD(OtherAvatar::AnimationLOD::QuarterRate));
     STAT_UPDATE(serverCount, (int)nodeList->size());
     STAT_UPDATE_FLOAT(renderrate, qApp->getRenderLoopRate(), 0.1f);
     RefreshRateManager& refreshRateManager = qApp->getRefreshRateManager();
@@ -147,6 +150,8 @@ void Stats::updateStats(bool force) {
         STAT_UPDATE(longrenders, stats["long_render_count"].toInt());
         STAT_UPDATE(longsubmits, stats["long_submit_count"].toInt());
         STAT_UPDATE(longframes, stats["long_frame_count"].toInt());
+        STAT_UPDATE_FLOAT(renderposeage, (float)stats["render_pose_age_msecs"].toDouble(), 0.1f);
+        STAT_UPDATE_FLOAT(presentposeage, (float)stats["present_pose_age_msecs"].toDouble(), 0.1f);
         STAT_UPDATE_FLOAT(presentrate, displayPlugin->presentRate(), 0.1f);
         STAT_UPDATE_FLOAT(presentnewrate, displayPlugin->newFramePresentRate(), 0.1f);
         STAT_UPDATE_FLOAT(presentdroprate, displayPlugin->droppedFrameRate(), 0.1f);
@@ -173,6 +178,11 @@ void Stats::updateStats(bool force) {
         STAT_UPDATE(rayPicksUpdated, updatedPicks[PickQuery::Ray]);
         STAT_UPDATE(parabolaPicksUpdated, updatedPicks[PickQuery::Parabola]);
         STAT_UPDATE(collisionPicksUpdated, updatedPicks[PickQuery::Collision]);
+        std::vector<uint64_t> pickUpdateTimes = pickManager->getPickUpdateTimes();
+        STAT_UPDATE(stylusPicksUsecs, (int)pickUpdateTimes[PickQuery::Stylus]);
+        STAT_UPDATE(rayPicksUsecs, (int)pickUpdateTimes[PickQuery::Ray]);
+        STAT_UPDATE(parabolaPicksUsecs, (int)pickUpdateTimes[PickQuery::Parabola]);
+        STAT_UPDATE(collisionPicksUsecs, (int)pickUpdateTimes[PickQuery::Collision]);
     }
 
     STAT_UPDATE(packetInCount, nodeList->getInboundPPS());
@@ -312,6 +322,16 @@ void Stats::updateStats(bool force) {
             }
             emit downloadUrlsChanged();
         }
+
+        QStringList downloadOrigins;
+        foreach (const auto& origin, ResourceCache::getRequestOriginStats()) {
+            downloadOrigins << QString("%1: %2/%3, Pending: %4").arg(origin.origin).arg(origin.loading).arg(origin.limit)
+                .arg(origin.pending);
+        }
+        if (downloadOrigins != _downloadOrigins) {
+            _downloadOrigins = downloadOrigins;
+            emit downloadOriginsChanged();
+        }
         // TODO fix to match original behavior
         //stringstream downloads;
         //downloads << "Downloads: ";
@@ -387,6 +407,8 @@ void Stats::updateStats(bool force) {
     auto config = qApp->getRenderEngine()->getConfiguration().get();
     STAT_UPDATE(engineFrameTime, (float) config->getCPURunTime());
     STAT_UPDATE(avatarSimulationTime, (float)avatarManager->getAvatarSimulationTime());
+    STAT_UPDATE(qmlRenderTime, (float)OffscreenUi::takeTotalRenderDuration() / (float)USECS_PER_MSEC);
+    STAT_UPDATE(desktopQmlRenderTime, (float)DependencyManager::get<OffscreenUi>()->getLastRenderDuration() / (float)USECS_PER_MSEC);
 
     if (_expanded) {
         STAT_UPDATE(gpuBuffers, (int)gpu::Context::getBufferGPUCount());
@@ -573,10 +595,12 @@ void Stats::updateStats(bool force) {
 void Stats::setRenderDetails(const render::RenderDetails& details) {
     STAT_UPDATE(triangles, details._trianglesRendered);
     STAT_UPDATE(materialSwitches, details._materialSwitches);
+    STAT_UPDATE(instancedItems, details._instancedItems);
     if (_expanded) {
         STAT_UPDATE(itemConsidered, details._item._considered);
         STAT_UPDATE(itemOutOfView, details._item._outOfView);
         STAT_UPDATE(itemTooSmall, details._item._tooSmall);
+        STAT_UPDATE(itemOccluded, details._item._occluded);
         STAT_UPDATE(itemRendered, details._item._rendered);
         STAT_UPDATE(shadowConsidered, details._shadow._considered);
         STAT_UPDATE(shadowOutOfView, details._shadow._outOfView);
@@ -64,6 +64,12 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} longframes - The number of times <code>longsubmits + longrenders</code> has taken longer than 15ms.
  *     <em>Read-only.</em>
+ * @property {number} renderposeage - The age of the head pose a frame was rendered with when the frame is given to the
+ *     display device, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} presentposeage - The age of the head pose the view of a frame was corrected to just before the frame
+ *     was executed on the GPU, when the frame is given to the display device, in ms.
+ *     <em>Read-only.</em>
  *
  * @property {number} presentnewrate - The rate at which the display plugin is presenting new GPU frames, in Hz.
  *     <em>Read-only.</em>
@@ -96,6 +102,15 @@ private: \
  * @property {number} notUpdatedAvatarCount - The number of avatars in the domain, other than the client's, that weren't able 
  *     to be updated in the most recent game loop because there wasn't enough time to.
  *     <em>Read-only.</em>
+ * @property {number} fullRateAvatarCount - The number of avatars in view, other than the client's, that apply their joints 
+ *     every frame.
+ *     <em>Read-only.</em>
+ * @property {number} halfRateAvatarCount - The number of avatars in view, other than the client's, that are small enough on 
+ *     screen to apply their joints every other frame.
+ *     <em>Read-only.</em>
+ * @property {number} quarterRateAvatarCount - The number of avatars in view, other than the client's, that are small enough 
+ *     on screen to apply their joints every fourth frame.
+ *     <em>Read-only.</em>
  * @property {number} packetInCount - The number of packets being received from the domain server, in packets per second.
  *     <em>Read-only.</em>
  * @property {number} packetOutCount - The number of packets being sent to the domain server, in packets per second.
@@ -206,6 +221,9 @@ private: \
  * @property {string[]} downloadUrls - The download URLs.
  *     <em>Read-only.</em>
  *     <p><strong>Note:</strong> Property not available in the API.</p>
+ * @property {string[]} downloadOrigins - The downloads in progress, their limit and the downloads pending of each host.
+ *     <em>Read-only.</em>
+ *     <p><strong>Note:</strong> Property not available in the API.</p>
  * @property {number} processing - The number of completed downloads being processed.
  *     <em>Read-only.</em>
  * @property {number} processingPending - The number of completed downloads waiting to be processed.
@@ -216,12 +234,16 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} materialSwitches - The number of material switches performed for the rendered scene.
  *     <em>Read-only.</em>
+ * @property {number} instancedItems - The number of items drawn along with others in shared instanced draws.
+ *     <em>Read-only.</em>
  * @property {number} itemConsidered - The number of item considerations made for rendering.
  *     <em>Read-only.</em>
  * @property {number} itemOutOfView - The number of items out of view.
  *     <em>Read-only.</em>
  * @property {number} itemTooSmall - The number of items too small to render.
  *     <em>Read-only.</em>
+ * @property {number} itemOccluded - The number of items hidden behind others in a previous frame.
+ *     <em>Read-only.</em>
  * @property {number} itemRendered - The number of items rendered.
  *     <em>Read-only.</em>
  * @property {number} shadowConsidered - The number of shadow considerations made for rendering.
@@ -327,6 +349,10 @@ private: \
  *     <em>Read-only.</em>
  * @property {number} avatarSimulationTime - The time being spent simulating avatars each frame, in ms.
  *     <em>Read-only.</em>
+ * @property {number} qmlRenderTime - The time being spent rendering all the QML surfaces each frame, in ms.
+ *     <em>Read-only.</em>
+ * @property {number} desktopQmlRenderTime - The time taken by the last render of the QML desktop, in ms.
+ *     <em>Read-only.</em>
  *
  * @property {number} stylusPicksCount - The number of stylus picks currently in effect.
  *     <em>Read-only.</em>
@@ -370,6 +396,21 @@ private: \
  *     </ul>
  *     <em>Read-only.</em>
  *     <p><strong>Note:</strong> Property not available in the API.</p>
+ * @property {number} stylusPicksUsecs - The time spent updating the stylus picks in the most recent game loop, in
+ *     microseconds.
+ *     <em>Read-only.</em>
+ *     <p><strong>Note:</strong> Property not available in the API.</p>
+ * @property {number} rayPicksUsecs - The time spent updating the ray picks in the most recent game loop, in microseconds.
+ *     <em>Read-only.</em>
+ *     <p><strong>Note:</strong> Property not available in the API.</p>
+ * @property {number} parabolaPicksUsecs - The time spent updating the parabola picks in the most recent game loop, in
+ *     microseconds.
+ *     <em>Read-only.</em>
+ *     <p><strong>Note:</strong> Property not available in the API.</p>
+ * @property {number} collisionPicksUsecs - The time spent updating the collision picks in the most recent game loop, in
+ *     microseconds.
+ *     <em>Read-only.</em>
+ *     <p><strong>Note:</strong> Property not available in the API.</p>
  *
  * @property {boolean} eventQueueDebuggingOn - <code>true</code> if event queue statistics are provided, <code>false</code> if
  *     they're not.
@@ -464,6 +505,8 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(int, longsubmits, 0)
     STATS_PROPERTY(int, longrenders, 0)
     STATS_PROPERTY(int, longframes, 0)
+    STATS_PROPERTY(float, renderposeage, 0)
+    STATS_PROPERTY(float, presentposeage, 0)
 
     STATS_PROPERTY(float, presentnewrate, 0)
     STATS_PROPERTY(float, presentdroprate, 0)
@@ -478,6 +521,9 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(int, updatedAvatarCount, 0)
     STATS_PROPERTY(int, updatedHeroAvatarCount, 0)
     STATS_PROPERTY(int, notUpdatedAvatarCount, 0)
+    STATS_PROPERTY(int, fullRateAvatarCount, 0)
+    STATS_PROPERTY(int, halfRateAvatarCount, 0)
+    STATS_PROPERTY(int, quarterRateAvatarCount, 0)
     STATS_PROPERTY(int, packetInCount, 0)
     STATS_PROPERTY(int, packetOutCount, 0)
     STATS_PROPERTY(float, mbpsIn, 0)
@@ -518,14 +564,17 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(int, downloadLimit, 0)
     STATS_PROPERTY(int, downloadsPending, 0)
     Q_PROPERTY(QStringList downloadUrls READ downloadUrls NOTIFY downloadUrlsChanged)
+    Q_PROPERTY(QStringList downloadOrigins READ downloadOrigins NOTIFY downloadOriginsChanged)
     STATS_PROPERTY(int, processing, 0)
     STATS_PROPERTY(int, processingPending, 0)
     STATS_PROPERTY(int, triangles, 0)
     STATS_PROPERTY(quint32 , drawcalls, 0)
     STATS_PROPERTY(int, materialSwitches, 0)
+    STATS_PROPERTY(int, instancedItems, 0)
     STATS_PROPERTY(int, itemConsidered, 0)
     STATS_PROPERTY(int, itemOutOfView, 0)
     STATS_PROPERTY(int, itemTooSmall, 0)
+    STATS_PROPERTY(int, itemOccluded, 0)
     STATS_PROPERTY(int, itemRendered, 0)
     STATS_PROPERTY(int, shadowConsidered, 0)
     STATS_PROPERTY(int, shadowOutOfView, 0)
@@ -568,6 +617,8 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(float, batchFrameTime, 0)
     STATS_PROPERTY(float, engineFrameTime, 0)
     STATS_PROPERTY(float, avatarSimulationTime, 0)
+    STATS_PROPERTY(float, qmlRenderTime, 0)
+    STATS_PROPERTY(float, desktopQmlRenderTime, 0)
 
     STATS_PROPERTY(int, stylusPicksCount, 0)
     STATS_PROPERTY(int, rayPicksCount, 0)
@@ -577,6 +628,10 @@ class Stats : public QQuickItem {
     STATS_PROPERTY(QVector3D, rayPicksUpdated, QVector3D(0, 0, 0))
     STATS_PROPERTY(QVector3D, parabolaPicksUpdated, QVector3D(0, 0, 0))
     STATS_PROPERTY(QVector3D, collisionPicksUpdated, QVector3D(0, 0, 0))
+    STATS_PROPERTY(int, stylusPicksUsecs, 0)
+    STATS_PROPERTY(int, rayPicksUsecs, 0)
+    STATS_PROPERTY(int, parabolaPicksUsecs, 0)
+    STATS_PROPERTY(int, collisionPicksUsecs, 0)
 
     STATS_PROPERTY(int, mainThreadQueueDepth, -1);
     STATS_PROPERTY(int, nodeListThreadQueueDepth, -1);
@@ -610,6 +665,7 @@ public:
     }
 
     QStringList downloadUrls () { return _downloadUrls; }
+    QStringList downloadOrigins () { return _downloadOrigins; }
 
 public slots:
 
@@ -712,6 +768,20 @@ signals:
      */
     void longframesChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>renderposeage</code> property changes.
+     * @function Stats.renderposeageChanged
+     * @returns {Signal}
+     */
+    void renderposeageChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>presentposeage</code> property changes.
+     * @function Stats.presentposeageChanged
+     * @returns {Signal}
+     */
+    void presentposeageChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>presentnewrate</code> property changes.
      * @function Stats.presentnewrateChanged
@@ -803,6 +873,27 @@ signals:
      */
     void notUpdatedAvatarCountChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>fullRateAvatarCount</code> property changes.
+     * @function Stats.fullRateAvatarCountChanged
+     * @returns {Signal}
+     */
+    void fullRateAvatarCountChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>halfRateAvatarCount</code> property changes.
+     * @function Stats.halfRateAvatarCountChanged
+     * @returns {Signal}
+     */
+    void halfRateAvatarCountChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>quarterRateAvatarCount</code> property changes.
+     * @function Stats.quarterRateAvatarCountChanged
+     * @returns {Signal}
+     */
+    void quarterRateAvatarCountChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>packetInCount</code> property changes.
      * @function Stats.packetInCountChanged
@@ -1069,6 +1160,13 @@ signals:
      */
     void downloadUrlsChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>downloadOrigins</code> property changes.
+     * @function Stats.downloadOriginsChanged
+     * @returns {Signal}
+     */
+    void downloadOriginsChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>processing</code> property changes.
      * @function Stats.processingChanged
@@ -1104,6 +1202,13 @@ signals:
      */
     void materialSwitchesChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>instancedItems</code> property changes.
+     * @function Stats.instancedItemsChanged
+     * @returns {Signal}
+     */
+    void instancedItemsChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>itemConsidered</code> property changes.
      * @function Stats.itemConsideredChanged
@@ -1125,6 +1230,13 @@ signals:
      */
     void itemTooSmallChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>itemOccluded</code> property changes.
+     * @function Stats.itemOccludedChanged
+     * @returns {Signal}
+     */
+    void itemOccludedChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>itemRendered</code> property changes.
      * @function Stats.itemRenderedChanged
@@ -1412,6 +1524,20 @@ signals:
      */
     void avatarSimulationTimeChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>qmlRenderTime</code> property changes.
+     * @function Stats.qmlRenderTimeChanged
+     * @returns {Signal}
+     */
+    void qmlRenderTimeChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>desktopQmlRenderTime</code> property changes.
+     * @function Stats.desktopQmlRenderTimeChanged
+     * @returns {Signal}
+     */
+    void desktopQmlRenderTimeChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>stylusPicksCount</code> property changes.
      * @function Stats.stylusPicksCountChanged
@@ -1468,6 +1594,34 @@ signals:
      */
     void collisionPicksUpdatedChanged();
 
+    /**jsdoc
+     * Triggered when the value of the <code>stylusPicksUsecs</code> property changes.
+     * @function Stats.stylusPicksUsecsChanged
+     * @returns {Signal}
+     */
+    void stylusPicksUsecsChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>rayPicksUsecs</code> property changes.
+     * @function Stats.rayPicksUsecsChanged
+     * @returns {Signal}
+     */
+    void rayPicksUsecsChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>parabolaPicksUsecs</code> property changes.
+     * @function Stats.parabolaPicksUsecsChanged
+     * @returns {Signal}
+     */
+    void parabolaPicksUsecsChanged();
+
+    /**jsdoc
+     * Triggered when the value of the <code>collisionPicksUsecs</code> property changes.
+     * @function Stats.collisionPicksUsecsChanged
+     * @returns {Signal}
+     */
+    void collisionPicksUsecsChanged();
+
     /**jsdoc
      * Triggered when the value of the <code>mainThreadQueueDepth</code> property changes.
      * @function Stats.mainThreadQueueDepthChanged
@@ -1781,6 +1935,7 @@ private:
     QString _monospaceFont;
     const AudioIOStats* _audioStats;
     QStringList _downloadUrls = QStringList();
+    QStringList _downloadOrigins = QStringList();
 };
 
 #endif // hifi_Stats_h
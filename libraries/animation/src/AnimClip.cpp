@@ -251,12 +251,12 @@ AnimClip::~AnimClip() {
 const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) {
 
     // lookup parameters from animVars, using current instance variables as defaults.
-    _startFrame = animVars.lookup(_startFrameVar, _startFrame);
-    _endFrame = animVars.lookup(_endFrameVar, _endFrame);
-    _timeScale = animVars.lookup(_timeScaleVar, _timeScale);
-    _loopFlag = animVars.lookup(_loopFlagVar, _loopFlag);
-    _mirrorFlag = animVars.lookup(_mirrorFlagVar, _mirrorFlag);
-    float frame = animVars.lookup(_frameVar, _frame);
+    _startFrame = animVars.lookup(_startFrameKey, _startFrame);
+    _endFrame = animVars.lookup(_endFrameKey, _endFrame);
+    _timeScale = animVars.lookup(_timeScaleKey, _timeScale);
+    _loopFlag = animVars.lookup(_loopFlagKey, _loopFlag);
+    _mirrorFlag = animVars.lookup(_mirrorFlagKey, _mirrorFlag);
+    float frame = animVars.lookup(_frameKey, _frame);
 
     _frame = ::accumulateTime(_startFrame, _endFrame, _timeScale, frame, dt, _loopFlag, _id, triggersOut);
 
@@ -264,13 +264,13 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
     if (_blendType == AnimBlendType_Normal) {
         if (_networkAnim && _networkAnim->isLoaded() && _skeleton) {
             // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
+            _anim = AnimCompressedClip(copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton));
 
             // we no longer need the actual animation resource anymore.
             _networkAnim.reset();
 
             // mirrorAnim will be re-built on demand, if needed.
-            _mirrorAnim.clear();
+            _mirrorAnim = AnimCompressedClip();
 
             _poses.resize(_skeleton->getNumJoints());
         }
@@ -278,14 +278,14 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
         // an additive blend type
         if (_networkAnim && _networkAnim->isLoaded() && _baseNetworkAnim && _baseNetworkAnim->isLoaded() && _skeleton) {
             // loading is complete, copy & retarget animation.
-            _anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
+            auto anim = copyAndRetargetFromNetworkAnim(_networkAnim, _skeleton);
 
             // we no longer need the actual animation resource anymore.
             _networkAnim.reset();
 
             // mirrorAnim will be re-built on demand, if needed.
             // TODO: handle mirrored relative animations.
-            _mirrorAnim.clear();
+            _mirrorAnim = AnimCompressedClip();
 
             _poses.resize(_skeleton->getNumJoints());
 
@@ -293,18 +293,19 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
             auto baseAnim = copyAndRetargetFromNetworkAnim(_baseNetworkAnim, _skeleton);
 
             if (_blendType == AnimBlendType_AddAbsolute) {
-                bakeAbsoluteDeltaAnim(_anim, baseAnim[(int)_baseFrame], _skeleton);
+                bakeAbsoluteDeltaAnim(anim, baseAnim[(int)_baseFrame], _skeleton);
             } else {
                 // AnimBlendType_AddRelative
-                bakeRelativeDeltaAnim(_anim, baseAnim[(int)_baseFrame]);
+                bakeRelativeDeltaAnim(anim, baseAnim[(int)_baseFrame]);
             }
+            _anim = AnimCompressedClip(anim);
         }
     }
 
-    if (_anim.size()) {
+    if (!_anim.empty()) {
 
         // lazy creation of mirrored animation frames.
-        if (_mirrorFlag && _anim.size() != _mirrorAnim.size()) {
+        if (_mirrorFlag && _anim.getNumFrames() != _mirrorAnim.getNumFrames()) {
             buildMirrorAnim();
         }
 
@@ -318,15 +319,16 @@ const AnimPoseVec& AnimClip::evaluate(const AnimVariantMap& animVars, const Anim
 
         // It can be quite possible for the user to set _startFrame and _endFrame to
         // values before or past valid ranges.  We clamp the frames here.
-        int frameCount = (int)_anim.size();
+        int frameCount = _anim.getNumFrames();
         prevIndex = std::min(std::max(0, prevIndex), frameCount - 1);
         nextIndex = std::min(std::max(0, nextIndex), frameCount - 1);
 
-        const AnimPoseVec& prevFrame = _mirrorFlag ? _mirrorAnim[prevIndex] : _anim[prevIndex];
-        const AnimPoseVec& nextFrame = _mirrorFlag ? _mirrorAnim[nextIndex] : _anim[nextIndex];
+        const AnimCompressedClip& anim = _mirrorFlag ? _mirrorAnim : _anim;
+        anim.sampleFrame(prevIndex, _prevPoses);
+        anim.sampleFrame(nextIndex, _nextPoses);
         float alpha = glm::fract(_frame);
 
-        ::blend(_poses.size(), &prevFrame[0], &nextFrame[0], alpha, &_poses[0]);
+        ::blend(_poses.size(), &_prevPoses[0], &_nextPoses[0], alpha, &_poses[0]);
     }
 
     processOutputJoints(triggersOut);
@@ -344,12 +346,12 @@ void AnimClip::setCurrentFrameInternal(float frame) {
 void AnimClip::buildMirrorAnim() {
     assert(_skeleton);
 
-    _mirrorAnim.clear();
-    _mirrorAnim.reserve(_anim.size());
-    for (auto& relPoses : _anim) {
-        _mirrorAnim.push_back(relPoses);
-        _skeleton->mirrorRelativePoses(_mirrorAnim.back());
+    std::vector<AnimPoseVec> mirrorAnim(_anim.getNumFrames());
+    for (int frame = 0; frame < _anim.getNumFrames(); frame++) {
+        _anim.sampleFrame(frame, mirrorAnim[frame]);
+        _skeleton->mirrorRelativePoses(mirrorAnim[frame]);
     }
+    _mirrorAnim = AnimCompressedClip(mirrorAnim);
 }
 
 const AnimPoseVec& AnimClip::getPosesInternal() const {
@@ -13,6 +13,7 @@
 
 #include <string>
 #include "AnimationCache.h"
+#include "AnimCompressedClip.h"
 #include "AnimNode.h"
 
 // Playback a single animation timeline.
@@ -31,12 +32,12 @@ public:
 
     virtual const AnimPoseVec& evaluate(const AnimVariantMap& animVars, const AnimContext& context, float dt, AnimVariantMap& triggersOut) override;
 
-    void setStartFrameVar(const QString& startFrameVar) { _startFrameVar = startFrameVar; }
-    void setEndFrameVar(const QString& endFrameVar) { _endFrameVar = endFrameVar; }
-    void setTimeScaleVar(const QString& timeScaleVar) { _timeScaleVar = timeScaleVar; }
-    void setLoopFlagVar(const QString& loopFlagVar) { _loopFlagVar = loopFlagVar; }
-    void setMirrorFlagVar(const QString& mirrorFlagVar) { _mirrorFlagVar = mirrorFlagVar; }
-    void setFrameVar(const QString& frameVar) { _frameVar = frameVar; }
+    void setStartFrameVar(const QString& startFrameVar) { _startFrameVar = startFrameVar; _startFrameKey = AnimVariantMap::getKey(startFrameVar); }
+    void setEndFrameVar(const QString& endFrameVar) { _endFrameVar = endFrameVar; _endFrameKey = AnimVariantMap::getKey(endFrameVar); }
+    void setTimeScaleVar(const QString& timeScaleVar) { _timeScaleVar = timeScaleVar; _timeScaleKey = AnimVariantMap::getKey(timeScaleVar); }
+    void setLoopFlagVar(const QString& loopFlagVar) { _loopFlagVar = loopFlagVar; _loopFlagKey = AnimVariantMap::getKey(loopFlagVar); }
+    void setMirrorFlagVar(const QString& mirrorFlagVar) { _mirrorFlagVar = mirrorFlagVar; _mirrorFlagKey = AnimVariantMap::getKey(mirrorFlagVar); }
+    void setFrameVar(const QString& frameVar) { _frameVar = frameVar; _frameKey = AnimVariantMap::getKey(frameVar); }
 
     float getStartFrame() const { return _startFrame; }
     void setStartFrame(float startFrame) { _startFrame = startFrame; }
@@ -71,9 +72,13 @@ protected:
 
     AnimPoseVec _poses;
 
-    // _anim[frame][joint]
-    std::vector<AnimPoseVec> _anim;
-    std::vector<AnimPoseVec> _mirrorAnim;
+    // the frames are rebuilt from their keys when they are sampled
+    AnimCompressedClip _anim;
+    AnimCompressedClip _mirrorAnim;
+
+    // the frames on either side of _frame
+    AnimPoseVec _prevPoses;
+    AnimPoseVec _nextPoses;
 
     QString _url;
     float _startFrame;
@@ -93,6 +98,13 @@ protected:
     QString _mirrorFlagVar;
     QString _frameVar;
 
+    AnimVariantMap::Key _startFrameKey { AnimVariantMap::INVALID_KEY };
+    AnimVariantMap::Key _endFrameKey { AnimVariantMap::INVALID_KEY };
+    AnimVariantMap::Key _timeScaleKey { AnimVariantMap::INVALID_KEY };
+    AnimVariantMap::Key _loopFlagKey { AnimVariantMap::INVALID_KEY };
+    AnimVariantMap::Key _mirrorFlagKey { AnimVariantMap::INVALID_KEY };
+    AnimVariantMap::Key _frameKey { AnimVariantMap::INVALID_KEY };
+
     // no copies
     AnimClip(const AnimClip&) = delete;
     AnimClip& operator=(const AnimClip&) = delete;
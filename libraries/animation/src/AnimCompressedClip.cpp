@@ -0,0 +1,235 @@
+//
+//  AnimCompressedClip.cpp
+//  libraries/animation/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AnimCompressedClip.h"
+
+#include <algorithm>
+
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+
+#include "AnimUtil.h"
+
+// the angle between a rotation and the one rebuilt from its keys
+static const float MAX_ROTATION_ERROR = 0.002f; // radians
+static const float MIN_ROTATION_DOT = cosf(0.5f * MAX_ROTATION_ERROR);
+
+// translations and scales are compared to the largest value of their track
+static const float MAX_RELATIVE_ERROR = 0.001f;
+static const float MIN_ERROR = 1.0e-6f;
+
+// bounds the cost of the reduction, which checks every frame of a span for each frame it adds to it
+static const uint32_t MAX_KEY_SPAN = 64;
+
+static const uint16_t QUANTIZED_MASK = 0x7fff;
+static const float QUANTIZED_SCALE = (float)QUANTIZED_MASK;
+
+// The frames to keep so that interpolating between them rebuilds every frame within the tolerance of isClose,
+// a single key when the whole track is close to its first value.
+template <typename T, typename Lerp, typename Close>
+static std::vector<uint32_t> reduceKeys(const std::vector<T>& values, Lerp lerpValues, Close isClose) {
+    std::vector<uint32_t> keys;
+    keys.push_back(0);
+
+    uint32_t numValues = (uint32_t)values.size();
+    bool isConstant = true;
+    for (uint32_t i = 1; i < numValues && isConstant; i++) {
+        isConstant = isClose(values[0], values[i]);
+    }
+    if (isConstant) {
+        return keys;
+    }
+
+    // grow the span from the last key while the frames inside of it can be interpolated
+    uint32_t start = 0;
+    for (uint32_t end = 2; end < numValues; end++) {
+        bool canSkip = end - start <= MAX_KEY_SPAN;
+        for (uint32_t i = start + 1; i < end && canSkip; i++) {
+            float alpha = (float)(i - start) / (float)(end - start);
+            canSkip = isClose(lerpValues(values[start], values[end], alpha), values[i]);
+        }
+        if (!canSkip) {
+            start = end - 1;
+            keys.push_back(start);
+        }
+    }
+    keys.push_back(numValues - 1);
+    return keys;
+}
+
+static float maxAbsComponent(const glm::vec3& value) {
+    return std::max(fabsf(value.x), std::max(fabsf(value.y), fabsf(value.z)));
+}
+
+static float computeTolerance(const std::vector<glm::vec3>& values) {
+    float maxValue = 0.0f;
+    for (const auto& value : values) {
+        maxValue = std::max(maxValue, maxAbsComponent(value));
+    }
+    return std::max(MAX_RELATIVE_ERROR * maxValue, MIN_ERROR);
+}
+
+static std::vector<uint32_t> reduceVectorKeys(const std::vector<glm::vec3>& values) {
+    float tolerance = computeTolerance(values);
+    return reduceKeys(values,
+        [](const glm::vec3& a, const glm::vec3& b, float alpha) { return lerp(a, b, alpha); },
+        [tolerance](const glm::vec3& a, const glm::vec3& b) { return maxAbsComponent(a - b) <= tolerance; });
+}
+
+static std::vector<uint32_t> reduceRotationKeys(const std::vector<glm::quat>& values) {
+    return reduceKeys(values,
+        [](const glm::quat& a, const glm::quat& b, float alpha) { return safeLerp(a, b, alpha); },
+        [](const glm::quat& a, const glm::quat& b) { return fabsf(glm::dot(a, b)) >= MIN_ROTATION_DOT; });
+}
+
+AnimCompressedClip::AnimCompressedClip(const std::vector<AnimPoseVec>& frames) :
+    _numFrames((int)frames.size())
+{
+    if (frames.empty()) {
+        return;
+    }
+
+    size_t numJoints = frames[0].size();
+    _tracks.resize(numJoints);
+
+    std::vector<glm::quat> rotations(frames.size());
+    std::vector<glm::vec3> translations(frames.size());
+    std::vector<glm::vec3> scales(frames.size());
+    for (size_t joint = 0; joint < numJoints; joint++) {
+        for (size_t frame = 0; frame < frames.size(); frame++) {
+            const AnimPose& pose = frames[frame][joint];
+            rotations[frame] = glm::normalize(pose.rot());
+            translations[frame] = pose.trans();
+            scales[frame] = pose.scale();
+        }
+
+        Track& track = _tracks[joint];
+        std::vector<uint32_t> keys = reduceRotationKeys(rotations);
+        track.rotationOffset = (uint32_t)_rotations.size();
+        track.numRotations = (uint32_t)keys.size();
+        for (auto key : keys) {
+            _rotationFrames.push_back(key);
+            _rotations.push_back(quantize(rotations[key]));
+        }
+
+        keys = reduceVectorKeys(translations);
+        track.translationOffset = (uint32_t)_translations.size();
+        track.numTranslations = (uint32_t)keys.size();
+        for (auto key : keys) {
+            _translationFrames.push_back(key);
+            _translations.push_back(translations[key]);
+        }
+
+        keys = reduceVectorKeys(scales);
+        track.scaleOffset = (uint32_t)_scales.size();
+        track.numScales = (uint32_t)keys.size();
+        for (auto key : keys) {
+            _scaleFrames.push_back(key);
+            _scales.push_back(scales[key]);
+        }
+    }
+
+    _rotationFrames.shrink_to_fit();
+    _rotations.shrink_to_fit();
+    _translationFrames.shrink_to_fit();
+    _translations.shrink_to_fit();
+    _scaleFrames.shrink_to_fit();
+    _scales.shrink_to_fit();
+}
+
+void AnimCompressedClip::sampleFrame(int frame, AnimPoseVec& posesOut) const {
+    posesOut.resize(_tracks.size());
+    for (size_t joint = 0; joint < _tracks.size(); joint++) {
+        const Track& track = _tracks[joint];
+        AnimPose& pose = posesOut[joint];
+        float alpha;
+
+        uint32_t key = track.rotationOffset + findKey(&_rotationFrames[track.rotationOffset], track.numRotations, frame, alpha);
+        pose.rot() = dequantize(_rotations[key]);
+        if (alpha > 0.0f) {
+            pose.rot() = safeLerp(pose.rot(), dequantize(_rotations[key + 1]), alpha);
+        }
+
+        key = track.translationOffset + findKey(&_translationFrames[track.translationOffset], track.numTranslations, frame, alpha);
+        pose.trans() = _translations[key];
+        if (alpha > 0.0f) {
+            pose.trans() = lerp(pose.trans(), _translations[key + 1], alpha);
+        }
+
+        key = track.scaleOffset + findKey(&_scaleFrames[track.scaleOffset], track.numScales, frame, alpha);
+        pose.scale() = _scales[key];
+        if (alpha > 0.0f) {
+            pose.scale() = lerp(pose.scale(), _scales[key + 1], alpha);
+        }
+    }
+}
+
+size_t AnimCompressedClip::getByteSize() const {
+    return sizeof(AnimCompressedClip) + _tracks.capacity() * sizeof(Track) +
+        (_rotationFrames.capacity() + _translationFrames.capacity() + _scaleFrames.capacity()) * sizeof(uint32_t) +
+        _rotations.capacity() * sizeof(QuantizedQuat) +
+        (_translations.capacity() + _scales.capacity()) * sizeof(glm::vec3);
+}
+
+// Smallest three: the largest component is left out and rebuilt from the others, which are then within
+// +/- 1/sqrt(2) and take 15 bits each.  The index of the largest one is in the top bits of the first two.
+AnimCompressedClip::QuantizedQuat AnimCompressedClip::quantize(const glm::quat& rotation) {
+    const float components[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+    int largest = 0;
+    for (int i = 1; i < 4; i++) {
+        if (fabsf(components[i]) > fabsf(components[largest])) {
+            largest = i;
+        }
+    }
+    // q and -q are the same rotation, make the one left out positive
+    float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+    QuantizedQuat quantized;
+    int j = 0;
+    for (int i = 0; i < 4; i++) {
+        if (i != largest) {
+            float value = glm::clamp(sign * components[i] * SQUARE_ROOT_OF_2, -1.0f, 1.0f);
+            quantized.data[j++] = (uint16_t)roundf((0.5f * value + 0.5f) * QUANTIZED_SCALE);
+        }
+    }
+    quantized.data[0] |= (uint16_t)((largest & 1) << 15);
+    quantized.data[1] |= (uint16_t)((largest >> 1) << 15);
+    return quantized;
+}
+
+glm::quat AnimCompressedClip::dequantize(const QuantizedQuat& quantized) {
+    int largest = (quantized.data[0] >> 15) | ((quantized.data[1] >> 15) << 1);
+    float components[4];
+    float sumOfSquares = 0.0f;
+    int j = 0;
+    for (int i = 0; i < 4; i++) {
+        if (i != largest) {
+            float value = (2.0f * ((float)(quantized.data[j++] & QUANTIZED_MASK) / QUANTIZED_SCALE) - 1.0f) / SQUARE_ROOT_OF_2;
+            components[i] = value;
+            sumOfSquares += value * value;
+        }
+    }
+    components[largest] = sqrtf(std::max(0.0f, 1.0f - sumOfSquares));
+    return glm::normalize(glm::quat(components[3], components[0], components[1], components[2]));
+}
+
+uint32_t AnimCompressedClip::findKey(const uint32_t* keyFrames, uint32_t numKeys, int frame, float& alphaOut) {
+    alphaOut = 0.0f;
+    if (numKeys == 1) {
+        return 0;
+    }
+    const uint32_t* next = std::upper_bound(keyFrames, keyFrames + numKeys, (uint32_t)frame);
+    if (next == keyFrames + numKeys) {
+        return numKeys - 1;
+    }
+    uint32_t key = (uint32_t)(next - keyFrames) - 1;
+    alphaOut = (float)((uint32_t)frame - keyFrames[key]) / (float)(*next - keyFrames[key]);
+    return key;
+}
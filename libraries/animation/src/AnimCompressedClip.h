@@ -0,0 +1,71 @@
+//
+//  AnimCompressedClip.h
+//  libraries/animation/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AnimCompressedClip_h
+#define hifi_AnimCompressedClip_h
+
+#include <vector>
+
+#include "AnimPose.h"
+
+// The relative poses of every frame of an animation, kept as keys per joint track.
+// A track whose values don't change is a single key, the others only keep the frames that can't be
+// rebuilt within an error bound by interpolating their neighbouring keys, and the rotations are quantized
+// with the smallest three encoding.
+class AnimCompressedClip {
+public:
+    AnimCompressedClip() {}
+
+    // frames[frame][joint], every frame must have the same number of joints
+    explicit AnimCompressedClip(const std::vector<AnimPoseVec>& frames);
+
+    bool empty() const { return _numFrames == 0; }
+    int getNumFrames() const { return _numFrames; }
+    int getNumJoints() const { return (int)_tracks.size(); }
+
+    // rebuilds the relative poses of a frame, which must be in [0, getNumFrames())
+    void sampleFrame(int frame, AnimPoseVec& posesOut) const;
+
+    // memory used by the keys, to compare with the size of the frames it was built from
+    size_t getByteSize() const;
+
+private:
+    struct QuantizedQuat {
+        uint16_t data[3];
+    };
+
+    struct Track {
+        uint32_t rotationOffset { 0 };
+        uint32_t numRotations { 0 };
+        uint32_t translationOffset { 0 };
+        uint32_t numTranslations { 0 };
+        uint32_t scaleOffset { 0 };
+        uint32_t numScales { 0 };
+    };
+
+    static QuantizedQuat quantize(const glm::quat& rotation);
+    static glm::quat dequantize(const QuantizedQuat& quantized);
+
+    // the key before frame and how far frame is towards the next one
+    static uint32_t findKey(const uint32_t* keyFrames, uint32_t numKeys, int frame, float& alphaOut);
+
+    int _numFrames { 0 };
+    std::vector<Track> _tracks;
+
+    // the keys of all the tracks, each track uses a range of them
+    std::vector<uint32_t> _rotationFrames;
+    std::vector<QuantizedQuat> _rotations;
+    std::vector<uint32_t> _translationFrames;
+    std::vector<glm::vec3> _translations;
+    std::vector<uint32_t> _scaleFrames;
+    std::vector<glm::vec3> _scales;
+};
+
+#endif // hifi_AnimCompressedClip_h
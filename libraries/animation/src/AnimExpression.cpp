@@ -340,7 +340,9 @@ bool AnimExpression::parseFactor(const QString& str, QString::const_iterator& it
 //
 
 AnimExpression::OpCode AnimExpression::evaluate(const AnimVariantMap& map) const {
-    std::stack<OpCode> stack;
+    std::vector<OpCode> operands;
+    operands.reserve(_opCodes.size());
+    OpCodeStack stack(std::move(operands));
     for (auto& opCode : _opCodes) {
         switch (opCode.type) {
         case OpCode::Identifier:
@@ -377,19 +379,19 @@ AnimExpression::OpCode AnimExpression::evaluate(const AnimVariantMap& map) const
 #define PUSH(EXPR)                              \
     stack.push(OpCode {(EXPR)})
 
-void AnimExpression::evalAnd(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalAnd(const AnimVariantMap& map, OpCodeStack& stack) const {
     POP_BOOL(lhs);
     POP_BOOL(rhs);
     PUSH(lhs && rhs);
 }
 
-void AnimExpression::evalOr(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalOr(const AnimVariantMap& map, OpCodeStack& stack) const {
     POP_BOOL(lhs);
     POP_BOOL(rhs);
     PUSH(lhs || rhs);
 }
 
-void AnimExpression::evalGreaterThan(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalGreaterThan(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = stack.top(); stack.pop();
     OpCode rhs = stack.top(); stack.pop();
 
@@ -397,7 +399,7 @@ void AnimExpression::evalGreaterThan(const AnimVariantMap& map, std::stack<OpCod
     PUSH(false);
 }
 
-void AnimExpression::evalGreaterThanEqual(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalGreaterThanEqual(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = stack.top(); stack.pop();
     OpCode rhs = stack.top(); stack.pop();
 
@@ -405,7 +407,7 @@ void AnimExpression::evalGreaterThanEqual(const AnimVariantMap& map, std::stack<
     PUSH(false);
 }
 
-void AnimExpression::evalLessThan(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalLessThan(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = stack.top(); stack.pop();
     OpCode rhs = stack.top(); stack.pop();
 
@@ -413,7 +415,7 @@ void AnimExpression::evalLessThan(const AnimVariantMap& map, std::stack<OpCode>&
     PUSH(false);
 }
 
-void AnimExpression::evalLessThanEqual(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalLessThanEqual(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = stack.top(); stack.pop();
     OpCode rhs = stack.top(); stack.pop();
 
@@ -421,7 +423,7 @@ void AnimExpression::evalLessThanEqual(const AnimVariantMap& map, std::stack<OpC
     PUSH(false);
 }
 
-void AnimExpression::evalEqual(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalEqual(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = stack.top(); stack.pop();
     OpCode rhs = stack.top(); stack.pop();
 
@@ -429,7 +431,7 @@ void AnimExpression::evalEqual(const AnimVariantMap& map, std::stack<OpCode>& st
     PUSH(false);
 }
 
-void AnimExpression::evalNotEqual(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalNotEqual(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = stack.top(); stack.pop();
     OpCode rhs = stack.top(); stack.pop();
 
@@ -437,12 +439,12 @@ void AnimExpression::evalNotEqual(const AnimVariantMap& map, std::stack<OpCode>&
     PUSH(false);
 }
 
-void AnimExpression::evalNot(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalNot(const AnimVariantMap& map, OpCodeStack& stack) const {
     POP_BOOL(rhs);
     PUSH(!rhs);
 }
 
-void AnimExpression::evalSubtract(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalSubtract(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = stack.top(); stack.pop();
     OpCode rhs = stack.top(); stack.pop();
 
@@ -450,7 +452,7 @@ void AnimExpression::evalSubtract(const AnimVariantMap& map, std::stack<OpCode>&
     PUSH(0.0f);
 }
 
-void AnimExpression::add(int lhs, const OpCode& rhs, std::stack<OpCode>& stack) const {
+void AnimExpression::add(int lhs, const OpCode& rhs, OpCodeStack& stack) const {
     switch (rhs.type) {
     case OpCode::Bool:
     case OpCode::Int:
@@ -464,7 +466,7 @@ void AnimExpression::add(int lhs, const OpCode& rhs, std::stack<OpCode>& stack)
     }
 }
 
-void AnimExpression::add(float lhs, const OpCode& rhs, std::stack<OpCode>& stack) const {
+void AnimExpression::add(float lhs, const OpCode& rhs, OpCodeStack& stack) const {
     switch (rhs.type) {
     case OpCode::Bool:
     case OpCode::Int:
@@ -478,7 +480,7 @@ void AnimExpression::add(float lhs, const OpCode& rhs, std::stack<OpCode>& stack
     }
 }
 
-void AnimExpression::evalAdd(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalAdd(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = coerseToValue(map, stack.top());
     stack.pop();
     OpCode rhs = coerseToValue(map, stack.top());
@@ -500,7 +502,7 @@ void AnimExpression::evalAdd(const AnimVariantMap& map, std::stack<OpCode>& stac
     }
 }
 
-void AnimExpression::evalMultiply(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalMultiply(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = coerseToValue(map, stack.top());
     stack.pop();
     OpCode rhs = coerseToValue(map, stack.top());
@@ -522,7 +524,7 @@ void AnimExpression::evalMultiply(const AnimVariantMap& map, std::stack<OpCode>&
     }
 }
 
-void AnimExpression::mul(int lhs, const OpCode& rhs, std::stack<OpCode>& stack) const {
+void AnimExpression::mul(int lhs, const OpCode& rhs, OpCodeStack& stack) const {
     switch (rhs.type) {
     case OpCode::Bool:
     case OpCode::Int:
@@ -536,7 +538,7 @@ void AnimExpression::mul(int lhs, const OpCode& rhs, std::stack<OpCode>& stack)
     }
 }
 
-void AnimExpression::mul(float lhs, const OpCode& rhs, std::stack<OpCode>& stack) const {
+void AnimExpression::mul(float lhs, const OpCode& rhs, OpCodeStack& stack) const {
     switch (rhs.type) {
     case OpCode::Bool:
     case OpCode::Int:
@@ -550,7 +552,7 @@ void AnimExpression::mul(float lhs, const OpCode& rhs, std::stack<OpCode>& stack
     }
 }
 
-void AnimExpression::evalDivide(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalDivide(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = stack.top(); stack.pop();
     OpCode rhs = stack.top(); stack.pop();
 
@@ -558,7 +560,7 @@ void AnimExpression::evalDivide(const AnimVariantMap& map, std::stack<OpCode>& s
     PUSH(0.0f);
 }
 
-void AnimExpression::evalModulus(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalModulus(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode lhs = stack.top(); stack.pop();
     OpCode rhs = stack.top(); stack.pop();
 
@@ -566,12 +568,12 @@ void AnimExpression::evalModulus(const AnimVariantMap& map, std::stack<OpCode>&
     PUSH((int)0);
 }
 
-void AnimExpression::evalUnaryMinus(const AnimVariantMap& map, std::stack<OpCode>& stack) const {
+void AnimExpression::evalUnaryMinus(const AnimVariantMap& map, OpCodeStack& stack) const {
     OpCode rhs = stack.top(); stack.pop();
 
     switch (rhs.type) {
     case OpCode::Identifier: {
-        const AnimVariant& var = map.get(rhs.strVal);
+        const AnimVariant& var = map.get(rhs.key);
         switch (var.getType()) {
         case AnimVariant::Type::Bool:
             qCWarning(animation) << "AnimExpression: type missmatch for unary minus, expected a number not a bool";
@@ -615,7 +617,7 @@ AnimExpression::OpCode AnimExpression::coerseToValue(const AnimVariantMap& map,
     switch (opCode.type) {
     case OpCode::Identifier:
         {
-            const AnimVariant& var = map.get(opCode.strVal);
+            const AnimVariant& var = map.get(opCode.key);
             switch (var.getType()) {
             case AnimVariant::Type::Bool:
                 return OpCode((bool)var.getBool());
@@ -83,8 +83,8 @@ protected:
             UnaryMinus
         };
         explicit OpCode(Type type) : type {type} {}
-        explicit OpCode(const QStringRef& strRef) : type {Type::Identifier}, strVal {strRef.toString()} {}
-        explicit OpCode(const QString& str) : type {Type::Identifier}, strVal {str} {}
+        explicit OpCode(const QStringRef& strRef) : OpCode(strRef.toString()) {}
+        explicit OpCode(const QString& str) : type {Type::Identifier}, strVal {str}, key {AnimVariantMap::getKey(str)} {}
         explicit OpCode(int val) : type {Type::Int}, intVal {val} {}
         explicit OpCode(bool val) : type {Type::Bool}, intVal {(int)val} {}
         explicit OpCode(float val) : type {Type::Float}, floatVal {val} {}
@@ -93,7 +93,7 @@ protected:
             if (type == Int || type == Bool) {
                 return intVal != 0;
             } else if (type == Identifier) {
-                return map.lookup(strVal, false);
+                return map.lookup(key, false);
             } else {
                 return true;
             }
@@ -101,10 +101,15 @@ protected:
 
         Type type {Int};
         QString strVal;
+        // the identifier is resolved to its key when the expression is parsed
+        AnimVariantMap::Key key {AnimVariantMap::INVALID_KEY};
         int intVal {0};
         float floatVal {0.0f};
     };
 
+    // the operands of the evaluation, on a vector rather than a deque
+    using OpCodeStack = std::stack<OpCode, std::vector<OpCode>>;
+
     void unconsumeToken(const Token& token);
     Token consumeToken(const QString& str, QString::const_iterator& iter) const;
     Token consumeIdentifier(const QString& str, QString::const_iterator& iter) const;
@@ -123,25 +128,25 @@ protected:
     bool parseFactor(const QString& str, QString::const_iterator& iter);
 
     OpCode evaluate(const AnimVariantMap& map) const;
-    void evalAnd(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalOr(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalGreaterThan(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalGreaterThanEqual(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalLessThan(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalLessThanEqual(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalEqual(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalNotEqual(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalNot(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalSubtract(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalAdd(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void add(int lhs, const OpCode& rhs, std::stack<OpCode>& stack) const;
-    void add(float lhs, const OpCode& rhs, std::stack<OpCode>& stack) const;
-    void evalMultiply(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void mul(int lhs, const OpCode& rhs, std::stack<OpCode>& stack) const;
-    void mul(float lhs, const OpCode& rhs, std::stack<OpCode>& stack) const;
-    void evalDivide(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalModulus(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
-    void evalUnaryMinus(const AnimVariantMap& map, std::stack<OpCode>& stack) const;
+    void evalAnd(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalOr(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalGreaterThan(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalGreaterThanEqual(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalLessThan(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalLessThanEqual(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalEqual(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalNotEqual(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalNot(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalSubtract(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalAdd(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void add(int lhs, const OpCode& rhs, OpCodeStack& stack) const;
+    void add(float lhs, const OpCode& rhs, OpCodeStack& stack) const;
+    void evalMultiply(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void mul(int lhs, const OpCode& rhs, OpCodeStack& stack) const;
+    void mul(float lhs, const OpCode& rhs, OpCodeStack& stack) const;
+    void evalDivide(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalModulus(const AnimVariantMap& map, OpCodeStack& stack) const;
+    void evalUnaryMinus(const AnimVariantMap& map, OpCodeStack& stack) const;
 
     OpCode coerseToValue(const AnimVariantMap& map, const OpCode& opCode) const;
 
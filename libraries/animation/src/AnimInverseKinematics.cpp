@@ -9,6 +9,8 @@
 
 #include "AnimInverseKinematics.h"
 
+#include <algorithm>
+
 #include <GeometryUtil.h>
 #include <GLMHelpers.h>
 #include <NumericalConstants.h>
@@ -220,6 +222,8 @@ float AnimInverseKinematics::getInterpolationAlpha(float timer) {
 }
 
 void AnimInverseKinematics::solve(const AnimContext& context, const std::vector<IKTarget>& targets, float dt, JointChainInfoVec& jointChainInfoVec) {
+    uint64_t startTime = usecTimestampNow();
+
     // compute absolute poses that correspond to relative target poses
     AnimPoseVec absolutePoses;
     absolutePoses.resize(_relativePoses.size());
@@ -235,13 +239,26 @@ void AnimInverseKinematics::solve(const AnimContext& context, const std::vector<
 
     std::map<int, int> targetToChainMap;
 
+    // the error is only measured for the targets with a position, the solve stops early once they are all reached
+    auto hasPosition = [](const IKTarget& target) {
+        return target.getType() == IKTarget::Type::RotationAndPosition || target.getType() == IKTarget::Type::HmdHead ||
+            target.getType() == IKTarget::Type::HipsRelativeRotationAndPosition;
+    };
+    bool hasPositionTargets = std::any_of(targets.begin(), targets.end(), hasPosition);
+
     float maxError = 0.0f;
     int numLoops = 0;
     const int MAX_IK_LOOPS = 16;
-    while (numLoops < MAX_IK_LOOPS) {
+    const int MIN_IK_LOOPS = 4;
+    const float CONVERGED_IK_ERROR = 0.001f; // meters
+    bool isLastLoop = false;
+    while (!isLastLoop) {
         ++numLoops;
+        // the last loop interpolates the chains, so the one after the error drops below the tolerance is the last
+        isLastLoop = numLoops == MAX_IK_LOOPS ||
+            (numLoops > MIN_IK_LOOPS && hasPositionTargets && maxError < CONVERGED_IK_ERROR);
 
-        bool debug = context.getEnableDebugDrawIKChains() && numLoops == MAX_IK_LOOPS;
+        bool debug = context.getEnableDebugDrawIKChains() && isLastLoop;
 
         // solve all targets
         for (size_t i = 0; i < targets.size(); i++) {
@@ -258,7 +275,7 @@ void AnimInverseKinematics::solve(const AnimContext& context, const std::vector<
         }
         
         // on last iteration, interpolate jointChains, if necessary
-        if (numLoops == MAX_IK_LOOPS) {
+        if (isLastLoop) {
             for (size_t i = 0; i < _prevJointChainInfoVec.size(); i++) {
                 targetToChainMap.insert(std::pair<int, int>(_prevJointChainInfoVec[i].target.getIndex(), (int)i));
                 if (_prevJointChainInfoVec[i].timer > 0.0f) {
@@ -325,8 +342,7 @@ void AnimInverseKinematics::solve(const AnimContext& context, const std::vector<
         // compute maxError
         maxError = 0.0f;
         for (size_t i = 0; i < targets.size(); i++) {
-            if (targets[i].getType() == IKTarget::Type::RotationAndPosition || targets[i].getType() == IKTarget::Type::HmdHead ||
-                targets[i].getType() == IKTarget::Type::HipsRelativeRotationAndPosition) {
+            if (hasPosition(targets[i])) {
                 float error = glm::length(absolutePoses[targets[i].getIndex()].trans() - targets[i].getTranslation());
                 if (error > maxError) {
                     maxError = error;
@@ -407,6 +423,9 @@ void AnimInverseKinematics::solve(const AnimContext& context, const std::vector<
             }
         }
     }
+
+    _numLoopsOnLastSolve = numLoops;
+    _usecsOnLastSolve = usecTimestampNow() - startTime;
 }
 
 void AnimInverseKinematics::solveTargetWithCCD(const AnimContext& context, const IKTarget& target, const AnimPoseVec& absolutePoses,
@@ -58,6 +58,8 @@ public:
     void clearIKJointLimitHistory();
 
     float getMaxErrorOnLastSolve() { return _maxErrorOnLastSolve; }
+    int getNumLoopsOnLastSolve() const { return _numLoopsOnLastSolve; }
+    uint64_t getUsecsOnLastSolve() const { return _usecsOnLastSolve; }
 
     /**jsdoc
      * <p>Specifies the initial conditions of the IK solver.</p>
@@ -198,6 +200,8 @@ protected:
     int _rightHandIndex { -1 };
 
     float _maxErrorOnLastSolve { FLT_MAX };
+    int _numLoopsOnLastSolve { 0 };
+    uint64_t _usecsOnLastSolve { 0 };
     bool _previousEnableDebugIKTargets { false };
     SolutionSource _solutionSource { SolutionSource::RelaxToUnderPoses };
     QString _solutionSourceVar;
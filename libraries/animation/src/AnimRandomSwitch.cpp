@@ -240,7 +240,7 @@ void AnimRandomSwitch::switchRandomState(const AnimVariantMap& animVars, const A
 AnimRandomSwitch::RandomSwitchState::Pointer AnimRandomSwitch::evaluateTransitions(const AnimVariantMap& animVars) const {
 	assert(_currentState);
 	for (auto& transition : _currentState->_transitions) {
-		if (animVars.lookup(transition._var, false)) {
+		if (animVars.lookup(transition._key, false)) {
 			return transition._randomSwitchState;
 		}
 	}
@@ -69,9 +69,10 @@ protected:
         class Transition {
         public:
             friend AnimRandomSwitch;
-            Transition(const QString& var, RandomSwitchState::Pointer randomState) : _var(var), _randomSwitchState(randomState) {}
+            Transition(const QString& var, RandomSwitchState::Pointer randomState) : _var(var), _key(AnimVariantMap::getKey(var)), _randomSwitchState(randomState) {}
         protected:
             QString _var;
+            AnimVariantMap::Key _key;
             RandomSwitchState::Pointer _randomSwitchState;
         };
 
@@ -178,7 +178,7 @@ void AnimStateMachine::switchState(const AnimVariantMap& animVars, const AnimCon
 AnimStateMachine::State::Pointer AnimStateMachine::evaluateTransitions(const AnimVariantMap& animVars) const {
     assert(_currentState);
     for (auto& transition : _currentState->_transitions) {
-        if (animVars.lookup(transition._var, false)) {
+        if (animVars.lookup(transition._key, false)) {
             return transition._state;
         }
     }
@@ -65,9 +65,10 @@ protected:
         class Transition {
         public:
             friend AnimStateMachine;
-            Transition(const QString& var, State::Pointer state) : _var(var), _state(state) {}
+            Transition(const QString& var, State::Pointer state) : _var(var), _key(AnimVariantMap::getKey(var)), _state(state) {}
         protected:
             QString _var;
+            AnimVariantMap::Key _key;
             State::Pointer _state;
         };
 
@@ -13,8 +13,116 @@
 #include <NumericalConstants.h>
 #include <DebugDraw.h>
 
-// TODO: use restrict keyword
-// TODO: excellent candidate for simd vectorization.
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+// on x86 architecture, assume that SSE2 is present
+#include <emmintrin.h>
+
+// A pose is blended as its ten floats.  The overlapping loads at the scale and at the translation blend their
+// neighbouring rotation components as plain vectors, which is wrong, so the rotation is stored last over them.
+static_assert(sizeof(AnimPose) == 10 * sizeof(float), "the blend kernels expect AnimPose to be ten packed floats");
+
+static const int POSE_SCALE_OFFSET = 0;
+static const int POSE_ROT_OFFSET = 3;
+static const int POSE_TRANS_OFFSET = 6;
+
+// the dot product of a and b, in all four lanes
+static inline __m128 dot4(__m128 a, __m128 b) {
+    __m128 t = _mm_mul_ps(a, b);
+    t = _mm_add_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_add_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+// b, negated if it is not on the same side as a
+static inline __m128 alignQuat(__m128 a, __m128 b) {
+    __m128 negative = _mm_cmplt_ps(dot4(a, b), _mm_setzero_ps());
+    return _mm_xor_ps(b, _mm_and_ps(negative, _mm_set1_ps(-0.0f)));
+}
+
+static inline __m128 normalizeQuat(__m128 q) {
+    return _mm_div_ps(q, _mm_sqrt_ps(dot4(q, q)));
+}
+
+static inline void storePose(float* result, __m128 scale, __m128 rot, __m128 trans) {
+    _mm_storeu_ps(result + POSE_SCALE_OFFSET, scale);
+    _mm_storeu_ps(result + POSE_TRANS_OFFSET, trans);
+    _mm_storeu_ps(result + POSE_ROT_OFFSET, rot);
+}
+
+void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
+    const __m128 alphaA = _mm_set1_ps(1.0f - alpha);
+    const __m128 alphaB = _mm_set1_ps(alpha);
+    for (size_t i = 0; i < numPoses; i++) {
+        const float* aPose = reinterpret_cast<const float*>(a + i);
+        const float* bPose = reinterpret_cast<const float*>(b + i);
+
+        __m128 aRot = _mm_loadu_ps(aPose + POSE_ROT_OFFSET);
+        __m128 bRot = alignQuat(aRot, _mm_loadu_ps(bPose + POSE_ROT_OFFSET));
+        __m128 rot = normalizeQuat(_mm_add_ps(_mm_mul_ps(aRot, alphaA), _mm_mul_ps(bRot, alphaB)));
+        __m128 scale = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(aPose + POSE_SCALE_OFFSET), alphaA),
+                                  _mm_mul_ps(_mm_loadu_ps(bPose + POSE_SCALE_OFFSET), alphaB));
+        __m128 trans = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(aPose + POSE_TRANS_OFFSET), alphaA),
+                                  _mm_mul_ps(_mm_loadu_ps(bPose + POSE_TRANS_OFFSET), alphaB));
+        storePose(reinterpret_cast<float*>(result + i), scale, rot, trans);
+    }
+}
+
+void blend3(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, float* alphas, AnimPose* result) {
+    const __m128 alphaA = _mm_set1_ps(alphas[0]);
+    const __m128 alphaB = _mm_set1_ps(alphas[1]);
+    const __m128 alphaC = _mm_set1_ps(alphas[2]);
+    for (size_t i = 0; i < numPoses; i++) {
+        const float* aPose = reinterpret_cast<const float*>(a + i);
+        const float* bPose = reinterpret_cast<const float*>(b + i);
+        const float* cPose = reinterpret_cast<const float*>(c + i);
+
+        __m128 aRot = _mm_loadu_ps(aPose + POSE_ROT_OFFSET);
+        __m128 bRot = alignQuat(aRot, _mm_loadu_ps(bPose + POSE_ROT_OFFSET));
+        __m128 cRot = alignQuat(aRot, _mm_loadu_ps(cPose + POSE_ROT_OFFSET));
+        __m128 rot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aRot, alphaA), _mm_mul_ps(bRot, alphaB)), _mm_mul_ps(cRot, alphaC));
+
+        __m128 scale = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(aPose + POSE_SCALE_OFFSET), alphaA),
+                                             _mm_mul_ps(_mm_loadu_ps(bPose + POSE_SCALE_OFFSET), alphaB)),
+                                  _mm_mul_ps(_mm_loadu_ps(cPose + POSE_SCALE_OFFSET), alphaC));
+        __m128 trans = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(aPose + POSE_TRANS_OFFSET), alphaA),
+                                             _mm_mul_ps(_mm_loadu_ps(bPose + POSE_TRANS_OFFSET), alphaB)),
+                                  _mm_mul_ps(_mm_loadu_ps(cPose + POSE_TRANS_OFFSET), alphaC));
+        storePose(reinterpret_cast<float*>(result + i), scale, normalizeQuat(rot), trans);
+    }
+}
+
+void blend4(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPose* c, const AnimPose* d, float* alphas, AnimPose* result) {
+    const __m128 alphaA = _mm_set1_ps(alphas[0]);
+    const __m128 alphaB = _mm_set1_ps(alphas[1]);
+    const __m128 alphaC = _mm_set1_ps(alphas[2]);
+    const __m128 alphaD = _mm_set1_ps(alphas[3]);
+    for (size_t i = 0; i < numPoses; i++) {
+        const float* aPose = reinterpret_cast<const float*>(a + i);
+        const float* bPose = reinterpret_cast<const float*>(b + i);
+        const float* cPose = reinterpret_cast<const float*>(c + i);
+        const float* dPose = reinterpret_cast<const float*>(d + i);
+
+        __m128 aRot = _mm_loadu_ps(aPose + POSE_ROT_OFFSET);
+        __m128 bRot = alignQuat(aRot, _mm_loadu_ps(bPose + POSE_ROT_OFFSET));
+        __m128 cRot = alignQuat(aRot, _mm_loadu_ps(cPose + POSE_ROT_OFFSET));
+        __m128 dRot = alignQuat(aRot, _mm_loadu_ps(dPose + POSE_ROT_OFFSET));
+        __m128 rot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aRot, alphaA), _mm_mul_ps(bRot, alphaB)),
+                                _mm_add_ps(_mm_mul_ps(cRot, alphaC), _mm_mul_ps(dRot, alphaD)));
+
+        __m128 scale = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(aPose + POSE_SCALE_OFFSET), alphaA),
+                                             _mm_mul_ps(_mm_loadu_ps(bPose + POSE_SCALE_OFFSET), alphaB)),
+                                  _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(cPose + POSE_SCALE_OFFSET), alphaC),
+                                             _mm_mul_ps(_mm_loadu_ps(dPose + POSE_SCALE_OFFSET), alphaD)));
+        __m128 trans = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(aPose + POSE_TRANS_OFFSET), alphaA),
+                                             _mm_mul_ps(_mm_loadu_ps(bPose + POSE_TRANS_OFFSET), alphaB)),
+                                  _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(cPose + POSE_TRANS_OFFSET), alphaC),
+                                             _mm_mul_ps(_mm_loadu_ps(dPose + POSE_TRANS_OFFSET), alphaD)));
+        storePose(reinterpret_cast<float*>(result + i), scale, normalizeQuat(rot), trans);
+    }
+}
+
+#else
+
 void blend(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
     for (size_t i = 0; i < numPoses; i++) {
         const AnimPose& aPose = a[i];
@@ -51,6 +159,8 @@ void blend4(size_t numPoses, const AnimPose* a, const AnimPose* b, const AnimPos
     }
 }
 
+#endif
+
 // additive blend
 void blendAdd(size_t numPoses, const AnimPose* a, const AnimPose* b, float alpha, AnimPose* result) {
 
@@ -11,12 +11,99 @@
 
 #include "AnimVariant.h" // which has AnimVariant/AnimVariantMap
 
+#include <algorithm>
+
+#include <QHash>
+#include <QReadWriteLock>
 #include <QScriptEngine>
 #include <QScriptValueIterator>
 #include <QThread>
 #include <RegisteredMetaTypes.h>
 
 const AnimVariant AnimVariant::False = AnimVariant();
+const AnimVariantMap::Key AnimVariantMap::INVALID_KEY;
+
+namespace {
+    // the names interned by every anim graph and script, which only grow
+    struct KeyRegistry {
+        QReadWriteLock lock;
+        QHash<QString, AnimVariantMap::Key> keys;
+        std::vector<QString> names;
+    };
+
+    KeyRegistry& getKeyRegistry() {
+        static KeyRegistry registry;
+        return registry;
+    }
+}
+
+AnimVariantMap::Key AnimVariantMap::getKey(const QString& name) {
+    if (name.isEmpty()) {
+        return INVALID_KEY;
+    }
+    Key key = findKey(name);
+    if (key != INVALID_KEY) {
+        return key;
+    }
+
+    auto& registry = getKeyRegistry();
+    QWriteLocker locker(&registry.lock);
+    auto iter = registry.keys.find(name);
+    if (iter != registry.keys.end()) {
+        return iter.value();
+    }
+    key = (Key)registry.names.size();
+    registry.names.push_back(name);
+    registry.keys.insert(name, key);
+    return key;
+}
+
+AnimVariantMap::Key AnimVariantMap::findKey(const QString& name) {
+    if (name.isEmpty()) {
+        return INVALID_KEY;
+    }
+    auto& registry = getKeyRegistry();
+    QReadLocker locker(&registry.lock);
+    return registry.keys.value(name, INVALID_KEY);
+}
+
+QString AnimVariantMap::getKeyName(Key key) {
+    auto& registry = getKeyRegistry();
+    QReadLocker locker(&registry.lock);
+    return (key >= 0 && key < (Key)registry.names.size()) ? registry.names[key] : QString();
+}
+
+void AnimVariantMap::setVariant(Key key, AnimVariant&& variant) {
+    if (key < 0) {
+        return;
+    }
+    if (key >= (Key)_variants.size()) {
+        _variants.resize(key + 1);
+        _isSet.resize(key + 1, false);
+    }
+    if (!_isSet[key]) {
+        _isSet[key] = true;
+        _keys.push_back(key);
+    }
+    _variants[key] = std::move(variant);
+}
+
+void AnimVariantMap::unset(Key key) {
+    if (!hasKey(key)) {
+        return;
+    }
+    _isSet[key] = false;
+    _variants[key] = AnimVariant();
+    _keys.erase(std::find(_keys.begin(), _keys.end(), key));
+}
+
+void AnimVariantMap::clearMap() {
+    for (Key key : _keys) {
+        _isSet[key] = false;
+        _variants[key] = AnimVariant();
+    }
+    _keys.clear();
+}
 
 QScriptValue AnimVariantMap::animVariantMapToScriptValue(QScriptEngine* engine, const QStringList& names, bool useNames) const {
     if (QThread::currentThread() != engine->thread()) {
@@ -52,25 +139,23 @@ QScriptValue AnimVariantMap::animVariantMapToScriptValue(QScriptEngine* engine,
     };
     if (useNames) { // copy only the requested names
         for (const QString& name : names) {
-            auto search = _map.find(name);
-            if (search != _map.end()) {
-                setOne(name, search->second);
-            } else if (_triggers.count(name) == 1) {
-                target.setProperty(name, true);
+            const AnimVariant* variant = find(findKey(name));
+            if (variant) {
+                setOne(name, *variant);
             } // scripts are allowed to request names that do not exist
         }
 
     } else {  // copy all of them
-        for (auto& pair : _map) {
-            setOne(pair.first, pair.second);
+        for (Key key : _keys) {
+            setOne(getKeyName(key), _variants[key]);
         }
     }
     return target;
 }
 
 void AnimVariantMap::copyVariantsFrom(const AnimVariantMap& other) {
-    for (auto& pair : other._map) {
-        _map[pair.first] = pair.second;
+    for (Key key : other._keys) {
+        setVariant(key, AnimVariant(other._variants[key]));
     }
 }
 
@@ -128,21 +213,23 @@ void AnimVariantMap::animVariantMapFromScriptValue(const QScriptValue& source) {
 
 std::map<QString, QString> AnimVariantMap::toDebugMap() const {
     std::map<QString, QString> result;
-    for (auto& pair : _map) {
-        switch (pair.second.getType()) {
+    for (Key key : _keys) {
+        QString name = getKeyName(key);
+        const AnimVariant& variant = _variants[key];
+        switch (variant.getType()) {
         case AnimVariant::Type::Bool:
-            result[pair.first] = QString("%1").arg(pair.second.getBool());
+            result[name] = QString("%1").arg(variant.getBool());
             break;
         case AnimVariant::Type::Int:
-            result[pair.first] = QString("%1").arg(pair.second.getInt());
+            result[name] = QString("%1").arg(variant.getInt());
             break;
         case AnimVariant::Type::Float:
-            result[pair.first] = QString::number(pair.second.getFloat(), 'f', 3);
+            result[name] = QString::number(variant.getFloat(), 'f', 3);
             break;
         case AnimVariant::Type::Vec3: {
             // To prevent filling up debug stats, don't show vec3 values
-            glm::vec3 value = pair.second.getVec3();
-            result[pair.first] = QString("(%1, %2, %3)").
+            glm::vec3 value = variant.getVec3();
+            result[name] = QString("(%1, %2, %3)").
                 arg(QString::number(value.x, 'f', 3)).
                 arg(QString::number(value.y, 'f', 3)).
                 arg(QString::number(value.z, 'f', 3));
@@ -150,8 +237,8 @@ std::map<QString, QString> AnimVariantMap::toDebugMap() const {
         }
         case AnimVariant::Type::Quat: {
             // To prevent filling up the anim stats, don't show quat values
-            glm::quat value = pair.second.getQuat();
-            result[pair.first] = QString("(%1, %2, %3, %4)").
+            glm::quat value = variant.getQuat();
+            result[name] = QString("(%1, %2, %3, %4)").
                 arg(QString::number(value.x, 'f', 3)).
                 arg(QString::number(value.y, 'f', 3)).
                 arg(QString::number(value.z, 'f', 3)).
@@ -160,7 +247,7 @@ std::map<QString, QString> AnimVariantMap::toDebugMap() const {
         }
         case AnimVariant::Type::String:
             // To prevent filling up anim stats, don't show string values
-            result[pair.first] = pair.second.getString();
+            result[name] = variant.getString();
             break;
         default:
             // invalid AnimVariant::Type
@@ -17,6 +17,7 @@
 #include <glm/gtx/quaternion.hpp>
 #include <map>
 #include <set>
+#include <vector>
 #include <QScriptValue>
 #include <StreamUtils.h>
 #include <GLMHelpers.h>
@@ -114,119 +115,120 @@ protected:
     } _val;
 };
 
+// The variables of the anim graph, by name.  The names are interned to keys that are shared by every map, and the
+// variants are stored at the index of their key.  The nodes resolve the keys of the names they look up once, when they
+// are loaded, so that evaluating the graph doesn't compare strings.
 class AnimVariantMap {
 public:
+    using Key = int;
+    static const Key INVALID_KEY = -1;
 
-    bool lookup(const QString& key, bool defaultValue) const {
-        // check triggers first, then map
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else if (_triggers.find(key) != _triggers.end()) {
-            return true;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getBool() : defaultValue;
-        }
+    // the key of the name, interning it if it's new.  Empty names have no key.
+    static Key getKey(const QString& name);
+    // the key of the name if it was interned, without interning it
+    static Key findKey(const QString& name);
+    static QString getKeyName(Key key);
+
+    bool lookup(Key key, bool defaultValue) const {
+        const AnimVariant* variant = find(key);
+        return variant ? variant->getBool() : defaultValue;
     }
 
-    int lookup(const QString& key, int defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getInt() : defaultValue;
-        }
+    int lookup(Key key, int defaultValue) const {
+        const AnimVariant* variant = find(key);
+        return variant ? variant->getInt() : defaultValue;
     }
 
-    float lookup(const QString& key, float defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getFloat() : defaultValue;
-        }
+    float lookup(Key key, float defaultValue) const {
+        const AnimVariant* variant = find(key);
+        return variant ? variant->getFloat() : defaultValue;
     }
 
-    const glm::vec3& lookupRaw(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getVec3() : defaultValue;
-        }
+    const glm::vec3& lookupRaw(Key key, const glm::vec3& defaultValue) const {
+        const AnimVariant* variant = find(key);
+        return variant ? variant->getVec3() : defaultValue;
     }
 
-    glm::vec3 lookupRigToGeometry(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? transformPoint(_rigToGeometryMat, iter->second.getVec3()) : defaultValue;
-        }
+    glm::vec3 lookupRigToGeometry(Key key, const glm::vec3& defaultValue) const {
+        const AnimVariant* variant = find(key);
+        return variant ? transformPoint(_rigToGeometryMat, variant->getVec3()) : defaultValue;
     }
 
-    glm::vec3 lookupRigToGeometryVector(const QString& key, const glm::vec3& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? transformVectorFast(_rigToGeometryMat, iter->second.getVec3()) : defaultValue;
-        }
+    glm::vec3 lookupRigToGeometryVector(Key key, const glm::vec3& defaultValue) const {
+        const AnimVariant* variant = find(key);
+        return variant ? transformVectorFast(_rigToGeometryMat, variant->getVec3()) : defaultValue;
     }
 
-    const glm::quat& lookupRaw(const QString& key, const glm::quat& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getQuat() : defaultValue;
-        }
+    const glm::quat& lookupRaw(Key key, const glm::quat& defaultValue) const {
+        const AnimVariant* variant = find(key);
+        return variant ? variant->getQuat() : defaultValue;
     }
 
-    glm::quat lookupRigToGeometry(const QString& key, const glm::quat& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? _rigToGeometryRot * iter->second.getQuat() : defaultValue;
-        }
+    glm::quat lookupRigToGeometry(Key key, const glm::quat& defaultValue) const {
+        const AnimVariant* variant = find(key);
+        return variant ? _rigToGeometryRot * variant->getQuat() : defaultValue;
     }
 
-    const QString& lookup(const QString& key, const QString& defaultValue) const {
-        if (key.isEmpty()) {
-            return defaultValue;
-        } else {
-            auto iter = _map.find(key);
-            return iter != _map.end() ? iter->second.getString() : defaultValue;
-        }
+    const QString& lookup(Key key, const QString& defaultValue) const {
+        const AnimVariant* variant = find(key);
+        return variant ? variant->getString() : defaultValue;
     }
 
-    void set(const QString& key, bool value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, int value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, float value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const glm::vec3& value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const glm::quat& value) { _map[key] = AnimVariant(value); }
-    void set(const QString& key, const QString& value) { _map[key] = AnimVariant(value); }
-    void unset(const QString& key) { _map.erase(key); }
+    bool lookup(const QString& name, bool defaultValue) const { return lookup(findKey(name), defaultValue); }
+    int lookup(const QString& name, int defaultValue) const { return lookup(findKey(name), defaultValue); }
+    float lookup(const QString& name, float defaultValue) const { return lookup(findKey(name), defaultValue); }
+    const glm::vec3& lookupRaw(const QString& name, const glm::vec3& defaultValue) const {
+        return lookupRaw(findKey(name), defaultValue);
+    }
+    glm::vec3 lookupRigToGeometry(const QString& name, const glm::vec3& defaultValue) const {
+        return lookupRigToGeometry(findKey(name), defaultValue);
+    }
+    glm::vec3 lookupRigToGeometryVector(const QString& name, const glm::vec3& defaultValue) const {
+        return lookupRigToGeometryVector(findKey(name), defaultValue);
+    }
+    const glm::quat& lookupRaw(const QString& name, const glm::quat& defaultValue) const {
+        return lookupRaw(findKey(name), defaultValue);
+    }
+    glm::quat lookupRigToGeometry(const QString& name, const glm::quat& defaultValue) const {
+        return lookupRigToGeometry(findKey(name), defaultValue);
+    }
+    const QString& lookup(const QString& name, const QString& defaultValue) const {
+        return lookup(findKey(name), defaultValue);
+    }
+
+    void set(Key key, bool value) { setVariant(key, AnimVariant(value)); }
+    void set(Key key, int value) { setVariant(key, AnimVariant(value)); }
+    void set(Key key, float value) { setVariant(key, AnimVariant(value)); }
+    void set(Key key, const glm::vec3& value) { setVariant(key, AnimVariant(value)); }
+    void set(Key key, const glm::quat& value) { setVariant(key, AnimVariant(value)); }
+    void set(Key key, const QString& value) { setVariant(key, AnimVariant(value)); }
+    void unset(Key key);
 
-    void setTrigger(const QString& key) { _map[key] = AnimVariant(true); }
+    void set(const QString& name, bool value) { set(getKey(name), value); }
+    void set(const QString& name, int value) { set(getKey(name), value); }
+    void set(const QString& name, float value) { set(getKey(name), value); }
+    void set(const QString& name, const glm::vec3& value) { set(getKey(name), value); }
+    void set(const QString& name, const glm::quat& value) { set(getKey(name), value); }
+    void set(const QString& name, const QString& value) { set(getKey(name), value); }
+    void unset(const QString& name) { unset(findKey(name)); }
+
+    void setTrigger(Key key) { set(key, true); }
+    void setTrigger(const QString& name) { set(getKey(name), true); }
 
     void setRigToGeometryTransform(const glm::mat4& rigToGeometry) {
         _rigToGeometryMat = rigToGeometry;
         _rigToGeometryRot = glmExtractRotation(rigToGeometry);
     }
 
-    void clearMap() { _map.clear(); _triggers.clear(); }
-    bool hasKey(const QString& key) const { return _map.find(key) != _map.end(); }
+    void clearMap();
+    bool hasKey(Key key) const { return find(key) != nullptr; }
+    bool hasKey(const QString& name) const { return hasKey(findKey(name)); }
 
-    const AnimVariant& get(const QString& key) const {
-        auto iter = _map.find(key);
-        if (iter != _map.end()) {
-            return iter->second;
-        } else {
-            return AnimVariant::False;
-        }
+    const AnimVariant& get(Key key) const {
+        const AnimVariant* variant = find(key);
+        return variant ? *variant : AnimVariant::False;
     }
+    const AnimVariant& get(const QString& name) const { return get(findKey(name)); }
 
     // Answer a Plain Old Javascript Object (for the given engine) all of our values set as properties.
     QScriptValue animVariantMapToScriptValue(QScriptEngine* engine, const QStringList& names, bool useNames) const;
@@ -240,25 +242,27 @@ public:
 #ifndef NDEBUG
     void dump() const {
         qCDebug(animation) << "AnimVariantMap =";
-        for (auto& pair : _map) {
-            switch (pair.second.getType()) {
+        for (Key key : _keys) {
+            const AnimVariant& variant = _variants[key];
+            QString name = getKeyName(key);
+            switch (variant.getType()) {
             case AnimVariant::Type::Bool:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getBool();
+                qCDebug(animation) << "    " << name << "=" << variant.getBool();
                 break;
             case AnimVariant::Type::Int:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getInt();
+                qCDebug(animation) << "    " << name << "=" << variant.getInt();
                 break;
             case AnimVariant::Type::Float:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getFloat();
+                qCDebug(animation) << "    " << name << "=" << variant.getFloat();
                 break;
             case AnimVariant::Type::Vec3:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getVec3();
+                qCDebug(animation) << "    " << name << "=" << variant.getVec3();
                 break;
             case AnimVariant::Type::Quat:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getQuat();
+                qCDebug(animation) << "    " << name << "=" << variant.getQuat();
                 break;
             case AnimVariant::Type::String:
-                qCDebug(animation) << "    " << pair.first << "=" << pair.second.getString();
+                qCDebug(animation) << "    " << name << "=" << variant.getString();
                 break;
             default:
                 assert(false);
@@ -268,8 +272,16 @@ public:
 #endif
 
 protected:
-    std::map<QString, AnimVariant> _map;
-    std::set<QString> _triggers;
+    const AnimVariant* find(Key key) const {
+        return (key >= 0 && key < (Key)_isSet.size() && _isSet[key]) ? &_variants[key] : nullptr;
+    }
+    void setVariant(Key key, AnimVariant&& variant);
+
+    // indexed by key
+    std::vector<AnimVariant> _variants;
+    std::vector<bool> _isSet;
+    // the keys that are set, in the order they were set
+    std::vector<Key> _keys;
     glm::mat4 _rigToGeometryMat;
     glm::quat _rigToGeometryRot;
 };
@@ -9,6 +9,11 @@
 //
 
 #include "Flow.h"
+
+#include <atomic>
+
+#include <tbb/parallel_for.h>
+
 #include "Rig.h"
 #include "AnimSkeleton.h"
 
@@ -628,20 +633,34 @@ void Flow::update(float deltaTime, AnimPoseVec& relativePoses, AnimPoseVec& abso
         if (_scale != _lastScale) {
             setScale(_scale);
         }
-        for (size_t i = 0; i < _jointThreads.size(); i++) {
-            size_t index = _invertThreadLoop ? _jointThreads.size() - 1 - i : i;
+        std::atomic<bool> missingRootFrame { false };
+        auto updateThread = [&](size_t index) {
+            if (missingRootFrame || usecTimestampNow() > updateExpiry) {
+                return;
+            }
             auto &thread = _jointThreads[index];
             thread.update(deltaTime);
             thread.solve(_collisionSystem);
             if (!updateRootFramePositions(absolutePoses, index)) {
+                missingRootFrame = true;
                 return;
             }
             thread.computeJointRotations();
-            if (usecTimestampNow() > updateExpiry) {
-                break;
-                qWarning(animation) << "Flow Bones ran out of time while updating threads";
+        };
+
+        // A thread only moves its own joints, and reads the collisions and the poses, so the threads of an avatar
+        // with many of them are solved on the TBB workers.  The order alternates between frames otherwise, so that
+        // the same threads aren't always the ones left out when the time runs out.
+        if (_jointThreads.size() >= MIN_PARALLEL_FLOW_THREADS) {
+            tbb::parallel_for((size_t)0, _jointThreads.size(), updateThread);
+        } else {
+            for (size_t i = 0; i < _jointThreads.size(); i++) {
+                updateThread(_invertThreadLoop ? _jointThreads.size() - 1 - i : i);
             }
         }
+        if (missingRootFrame) {
+            return;
+        }
         setJoints(relativePoses, overrideFlags);
         updateJoints(relativePoses, absolutePoses);
         _invertThreadLoop = !_invertThreadLoop;
@@ -673,11 +692,11 @@ bool Flow::worldToJointPoint(const AnimPoseVec& absolutePoses, const glm::vec3&
 
 bool Flow::updateRootFramePositions(const AnimPoseVec& absolutePoses, size_t threadIndex) {
     auto &joints = _jointThreads[threadIndex]._joints;
-    int rootIndex = _flowJointData[joints[0]].getParentIndex();
+    int rootIndex = _flowJointData.at(joints[0]).getParentIndex();
     _jointThreads[threadIndex]._rootFramePositions.clear();
     for (size_t j = 0; j < joints.size(); j++) {
         glm::vec3 jointPos;
-        if (worldToJointPoint(absolutePoses, _flowJointData[joints[j]].getCurrentPosition(), rootIndex, jointPos)) {
+        if (worldToJointPoint(absolutePoses, _flowJointData.at(joints[j]).getCurrentPosition(), rootIndex, jointPos)) {
             _jointThreads[threadIndex]._rootFramePositions.push_back(jointPos);
         } else {
             return false;
@@ -44,6 +44,7 @@ const float DEFAULT_DELTA = 0.55f;
 const float DEFAULT_RADIUS = 0.01f;
 
 const uint64_t MAX_UPDATE_FLOW_TIME_BUDGET = 2000;
+const size_t MIN_PARALLEL_FLOW_THREADS = 8;
 
 struct FlowPhysicsSettings {
     FlowPhysicsSettings() {};
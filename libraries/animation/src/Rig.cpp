@@ -834,6 +834,36 @@ float Rig::getIKErrorOnLastSolve() const {
     return result;
 }
 
+int Rig::getIKNumLoopsOnLastSolve() const {
+    int result = 0;
+
+    if (_animNode) {
+        _animNode->traverse([&](AnimNode::Pointer node) {
+            auto ikNode = std::dynamic_pointer_cast<AnimInverseKinematics>(node);
+            if (ikNode) {
+                result = ikNode->getNumLoopsOnLastSolve();
+            }
+            return true;
+        });
+    }
+    return result;
+}
+
+uint64_t Rig::getIKUsecsOnLastSolve() const {
+    uint64_t result = 0;
+
+    if (_animNode) {
+        _animNode->traverse([&](AnimNode::Pointer node) {
+            auto ikNode = std::dynamic_pointer_cast<AnimInverseKinematics>(node);
+            if (ikNode) {
+                result = ikNode->getUsecsOnLastSolve();
+            }
+            return true;
+        });
+    }
+    return result;
+}
+
 int Rig::getJointParentIndex(int childIndex) const {
     if (_animSkeleton && isIndexValid(childIndex)) {
         return _animSkeleton->getParentIndex(childIndex);
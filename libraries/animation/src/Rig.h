@@ -155,6 +155,8 @@ public:
     float getMaxHipsOffsetLength() const;
 
     float getIKErrorOnLastSolve() const;
+    int getIKNumLoopsOnLastSolve() const;
+    uint64_t getIKUsecsOnLastSolve() const;
 
     int getJointParentIndex(int childIndex) const;
 
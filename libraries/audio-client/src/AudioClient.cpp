@@ -325,6 +325,9 @@ AudioClient::AudioClient() {
         Setting::Handle<bool>::Deprecated("repetitionWithFade", InboundAudioStream::REPETITION_WITH_FADE);
     }
 
+    // the received stream is written by the network thread and popped by the device callback
+    _receivedAudioStream.setLockFree(true);
+
     connect(&_receivedAudioStream, &MixedProcessedAudioStream::processSamples,
 	    this, &AudioClient::processReceivedSamples, Qt::DirectConnection);
     connect(this, &AudioClient::changeDevice, this, [=](const HifiAudioDeviceInfo& outputDeviceInfo) {
@@ -405,6 +408,17 @@ void AudioClient::customDeleter() {
     deleteLater();
 }
 
+void AudioClient::sendDownstreamAudioStatsPacket() {
+    _stats.publish();
+
+    // the mixer reports the loss of the microphone stream about as often as this is sent, the encoder adapts to it
+    auto audioMixer = DependencyManager::get<NodeList>()->soloNodeOfType(NodeType::AudioMixer);
+    if (_encoder && audioMixer) {
+        int rttMsecs = audioMixer->getConnectionStats().rtt / (int)USECS_PER_MSEC;
+        _encoder->setNetworkConditions(_stats.getUpstreamLossRate(), rttMsecs);
+    }
+}
+
 void AudioClient::handleMismatchAudioFormat(SharedNodePointer node, const QString& currentCodec, const QString& recievedCodec) {
     qCDebug(audioclient) << __FUNCTION__ << "sendingNode:" << *node << "currentCodec:" << currentCodec << "recievedCodec:" << recievedCodec;
     selectAudioFormat(recievedCodec);
@@ -2020,6 +2034,10 @@ void AudioClient::setHeadsetPluggedIn(bool pluggedIn) {
 
 void AudioClient::outputNotify() {
     int recentUnfulfilled = _audioOutputIODevice.getRecentUnfulfilledReads();
+    if (_isOutputLowLatency.load(std::memory_order_relaxed)) {
+        updateOutputLatencyTarget(recentUnfulfilled);
+    }
+
     if (recentUnfulfilled > 0) {
         qCDebug(audioclient, "Starve detected, %d new unfulfilled reads", recentUnfulfilled);
 
@@ -2048,6 +2066,30 @@ void AudioClient::outputNotify() {
     }
 }
 
+void AudioClient::updateOutputLatencyTarget(int recentUnfulfilled) {
+    quint64 now = usecTimestampNow() / USECS_PER_MSEC;
+    int oldTargetFrames = _outputTargetFrames.load(std::memory_order_relaxed);
+    int newTargetFrames = oldTargetFrames;
+
+    if (recentUnfulfilled > 0) {
+        // the target is already as shallow as it can be, so grow on any starve
+        newTargetFrames = std::min(oldTargetFrames + 1, MAX_BUFFER_FRAMES);
+        _outputLatencyStableStartTimeMsec = now;
+    } else if ((int)(now - _outputLatencyStableStartTimeMsec) > LATENCY_REDUCTION_PERIOD) {
+        // shrink only if the device buffer has not recently drained below a frame of slack
+        if (_stats.getOutputMsUnplayedWindowMin() > AudioConstants::NETWORK_FRAME_MSECS) {
+            newTargetFrames = std::max(oldTargetFrames - 1, MIN_BUFFER_FRAMES);
+        }
+        _outputLatencyStableStartTimeMsec = now;
+    }
+
+    if (newTargetFrames != oldTargetFrames) {
+        qCDebug(audioclient, "Low-latency output target set to %d frames", newTargetFrames);
+        _outputTargetFrames.store(newTargetFrames, std::memory_order_relaxed);
+        _stats.updateDeviceBufferMs(newTargetFrames * AudioConstants::NETWORK_FRAME_MSECS);
+    }
+}
+
 void AudioClient::noteAwakening() {
     qCDebug(audioclient) << "Restarting the audio devices.";
     switchInputToAudioDevice(_inputDeviceInfo); 
@@ -2153,9 +2195,17 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
 
             int deviceChannelCount = _outputFormat.channelCount();
             int frameSize = (AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL * deviceChannelCount * _outputFormat.sampleRate()) / _desiredOutputFormat.sampleRate();
-            int requestedSize = _sessionOutputBufferSizeFrames * frameSize * AudioConstants::SAMPLE_SIZE;
+            // in low-latency mode, allocate for the deepest target and let the device callback limit the fill
+            bool isLowLatency = _outputLowLatencyEnabled.get();
+            int requestedFrames = isLowLatency ? MAX_BUFFER_FRAMES : _sessionOutputBufferSizeFrames;
+            int requestedSize = requestedFrames * frameSize * AudioConstants::SAMPLE_SIZE;
             _audioOutput->setBufferSize(requestedSize);
 
+            _isOutputLowLatency.store(isLowLatency, std::memory_order_relaxed);
+            _outputTargetFrames.store(_sessionOutputBufferSizeFrames, std::memory_order_relaxed);
+            _outputDeviceFrameSize = frameSize;
+            _outputLatencyStableStartTimeMsec = usecTimestampNow() / USECS_PER_MSEC;
+
             connect(_audioOutput, &QAudioOutput::notify, this, &AudioClient::outputNotify);
 
             // start the output device
@@ -2196,6 +2246,13 @@ bool AudioClient::switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDevi
             qCDebug(audioclient) << "requested (bytes):" << requestedSize;
             qCDebug(audioclient) << "period (samples):" << _outputPeriod;
             qCDebug(audioclient) << "local buffer (samples):" << localPeriod;
+            qCDebug(audioclient) << "low latency:" << isLowLatency;
+
+            if (isLowLatency) {
+                _stats.updateDeviceBufferMs(_sessionOutputBufferSizeFrames * AudioConstants::NETWORK_FRAME_MSECS);
+            } else {
+                _stats.updateDeviceBufferMs(bufferSize / (float)_outputFormat.bytesForDuration(USECS_PER_MSEC));
+            }
 
             // unlock to avoid a deadlock with the device callback (which always succeeds this initialization)
             localAudioLock.unlock();
@@ -2309,6 +2366,16 @@ qint64 AudioClient::AudioOutputIODevice::readData(char * data, qint64 maxSize) {
     // restrict samplesRequested to the size of our mix/scratch buffers
     maxSamplesRequested = std::min(maxSamplesRequested, _audio->_outputPeriod);
 
+    if (_audio->_isOutputLowLatency.load(std::memory_order_relaxed)) {
+        // only top up the device buffer to the target depth, the remainder waits in the (lock-free) received stream,
+        // but always pull at least a frame so the device never goes idle
+        int frameSize = _audio->_outputDeviceFrameSize;
+        int targetSamples = _audio->_outputTargetFrames.load(std::memory_order_relaxed) * frameSize;
+        int unplayedSamples = (_audio->_audioOutput->bufferSize() - _audio->_audioOutput->bytesFree()) / AudioConstants::SAMPLE_SIZE;
+        int deviceSamplesAllowed = std::max(targetSamples - unplayedSamples, frameSize);
+        maxSamplesRequested = std::min(maxSamplesRequested, deviceSamplesAllowed * OUTPUT_CHANNEL_COUNT / deviceChannelCount);
+    }
+
     int16_t* scratchBuffer = _audio->_outputScratchBuffer;
     float* mixBuffer = _audio->_outputMixBuffer;
 
@@ -83,6 +83,7 @@ class NLPacket;
 
 #define DEFAULT_STARVE_DETECTION_ENABLED true
 #define DEFAULT_BUFFER_FRAMES 1
+#define DEFAULT_LOW_LATENCY_ENABLED false
 
 class AudioClient : public AbstractAudioInterface, public Dependency {
     Q_OBJECT
@@ -145,6 +146,10 @@ public:
     bool getOutputStarveDetectionEnabled() { return _outputStarveDetectionEnabled.get(); }
     void setOutputStarveDetectionEnabled(bool enabled) { _outputStarveDetectionEnabled.set(enabled); }
 
+    // takes effect the next time the output device is started
+    bool getOutputLowLatencyEnabled() { return _outputLowLatencyEnabled.get(); }
+    void setOutputLowLatencyEnabled(bool enabled) { _outputLowLatencyEnabled.set(enabled); }
+
     bool isSimulatingJitter() { return _gate.isSimulatingJitter(); }
     void setIsSimulatingJitter(bool enable) { _gate.setIsSimulatingJitter(enable); }
 
@@ -200,7 +205,7 @@ public slots:
     void handleSelectedAudioFormat(QSharedPointer<ReceivedMessage> message);
     void handleMismatchAudioFormat(SharedNodePointer node, const QString& currentCodec, const QString& recievedCodec);
 
-    void sendDownstreamAudioStatsPacket() { _stats.publish(); }
+    void sendDownstreamAudioStatsPacket();
     void handleMicAudioInput();
     void audioInputStateChanged(QAudio::State state);
     void checkInputTimeout();
@@ -303,6 +308,7 @@ private:
     static const int OUTPUT_CHANNEL_COUNT{ 2 };
     static const int STARVE_DETECTION_THRESHOLD{ 3 };
     static const int STARVE_DETECTION_PERIOD{ 10 * 1000 }; // 10 Seconds
+    static const int LATENCY_REDUCTION_PERIOD{ 5 * 1000 }; // 5 Seconds
 
     static const AudioPositionGetter DEFAULT_POSITION_GETTER;
     static const AudioOrientationGetter DEFAULT_ORIENTATION_GETTER;
@@ -384,6 +390,14 @@ private:
     Setting::Handle<int> _outputBufferSizeFrames{"audioOutputBufferFrames", DEFAULT_BUFFER_FRAMES};
     int _sessionOutputBufferSizeFrames{ _outputBufferSizeFrames.get() };
     Setting::Handle<bool> _outputStarveDetectionEnabled{ "audioOutputStarveDetectionEnabled", DEFAULT_STARVE_DETECTION_ENABLED};
+    Setting::Handle<bool> _outputLowLatencyEnabled{ "audioOutputLowLatencyEnabled", DEFAULT_LOW_LATENCY_ENABLED };
+
+    // low-latency output: the device buffer is allocated for MAX_BUFFER_FRAMES, but the device callback only keeps
+    // _outputTargetFrames of it filled, leaving the rest in _receivedAudioStream until the device pulls it
+    std::atomic<bool> _isOutputLowLatency { false };
+    std::atomic<int> _outputTargetFrames { DEFAULT_BUFFER_FRAMES };
+    int _outputDeviceFrameSize { 0 };
+    quint64 _outputLatencyStableStartTimeMsec { 0 };
 
     StDev _stdev;
     QElapsedTimer _timeSinceLastReceived;
@@ -455,6 +469,7 @@ private:
 
     bool switchInputToAudioDevice(const HifiAudioDeviceInfo inputDeviceInfo, bool isShutdownRequest = false);
     bool switchOutputToAudioDevice(const HifiAudioDeviceInfo outputDeviceInfo, bool isShutdownRequest = false);
+    void updateOutputLatencyTarget(int recentUnfulfilled);
 
     // Callback acceleration dependent calculations
     int calculateNumberOfInputCallbackBytes(const QAudioFormat& format) const;
@@ -84,6 +84,7 @@ void AudioIOStats::processStreamStatsPacket(QSharedPointer<ReceivedMessage> mess
 
         if (streamStats._streamType == PositionalAudioStream::Microphone) {
             _interface->updateMixerStream(streamStats);
+            _upstreamLossRate = streamStats._packetStreamWindowStats.getLostRate();
         } else {
             _injectorStreams[streamStats._streamIdentifier] = streamStats;
         }
@@ -110,6 +111,7 @@ void AudioIOStats::publish() {
 
     // update the interface
     _interface->updateLocalBuffers(_inputMsRead, _inputMsUnplayed, _outputMsUnplayed, _packetTimegaps);
+    _interface->deviceBufferMs(_deviceBufferMs);
     _interface->updateClientStream(stats);
 
     // prepare a packet to the mixer
@@ -242,6 +242,9 @@ class AudioStatsInterface : public QObject {
      *
      * @property {AudioStats.AudioStreamStats} clientStream - Statistics of the client's audio stream.
      *     <em>Read-only.</em>
+     * @property {number} deviceBufferMs - The target depth of the output device buffer, in ms. In low-latency output mode 
+     *     this adapts to the recent output starves; otherwise it is the size of the device buffer.
+     *     <em>Read-only.</em>
      * @property {number} inputReadMsMax - The maximum duration of a block of audio data recently read from the microphone, in 
      *     ms.
      *     <em>Read-only.</em>
@@ -302,6 +305,14 @@ class AudioStatsInterface : public QObject {
      */
     AUDIO_PROPERTY(float, outputUnplayedMsMax);
 
+    /**jsdoc
+     * Triggered when the target depth of the output device buffer changes.
+     * @function AudioStats.deviceBufferMsChanged
+     * @param {number} deviceBufferMs - The target depth of the output device buffer, in ms.
+     * @returns {Signal} 
+     */
+    AUDIO_PROPERTY(float, deviceBufferMs);
+
 
     /**jsdoc
      * Triggered when the overall maximum time between sending data packets to the audio mixer changes.
@@ -399,8 +410,13 @@ public:
     void updateInputMsRead(float ms) const { _inputMsRead.update(ms); }
     void updateInputMsUnplayed(float ms) const { _inputMsUnplayed.update(ms); }
     void updateOutputMsUnplayed(float ms) const { _outputMsUnplayed.update(ms); }
+    void updateDeviceBufferMs(float ms) { _deviceBufferMs = ms; }
+    float getOutputMsUnplayedWindowMin() const { return _outputMsUnplayed.getWindowMin(); }
     void sentPacket() const;
 
+    // the loss rate of the microphone stream over the recent window, as the mixer last reported it
+    float getUpstreamLossRate() const { return _upstreamLossRate; }
+
     void publish();
 
 public slots:
@@ -412,12 +428,14 @@ private:
     mutable MovingMinMaxAvg<float> _inputMsRead;
     mutable MovingMinMaxAvg<float> _inputMsUnplayed;
     mutable MovingMinMaxAvg<float> _outputMsUnplayed;
+    float _deviceBufferMs { 0.0f };
 
     mutable quint64 _lastSentPacketTime;
     mutable MovingMinMaxAvg<quint64> _packetTimegaps;
 
     MixedProcessedAudioStream* _receivedAudioStream;
     QHash<QUuid, AudioStreamStats> _injectorStreams;
+    float _upstreamLossRate { 0.0f };
 };
 
 #endif // hifi_AudioIOStats_h
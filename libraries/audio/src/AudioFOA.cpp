@@ -940,6 +940,8 @@ void rifft512_AVX2(float buf[512]);
 void rfft512_cmadd_1X2_AVX2(const float src[512], const float coef0[512], const float coef1[512], float dst0[512], float dst1[512]);
 void convertInput_AVX2(int16_t* src, float *dst[4], float gain, int numFrames);
 void rotate_4x4_AVX2(float* buf[4], const float m0[4][4], const float m1[4][4], const float* win, int numFrames);
+void rfft512_cmadd_1X2_AVX512(const float src[512], const float coef0[512], const float coef1[512], float dst0[512], float dst1[512]);
+void rotate_4x4_AVX512(float* buf[4], const float m0[4][4], const float m1[4][4], const float* win, int numFrames);
 
 static void rfft512(float buf[512]) {
     static auto f = cpuSupportsAVX2() ? rfft512_AVX2 : rfft512_ref;
@@ -952,7 +954,7 @@ static void rifft512(float buf[512]) {
 }
 
 static void rfft512_cmadd_1X2(const float src[512], const float coef0[512], const float coef1[512], float dst0[512], float dst1[512]) {
-    static auto f = cpuSupportsAVX2() ? rfft512_cmadd_1X2_AVX2 : rfft512_cmadd_1X2_ref;
+    static auto f = cpuSupportsAVX512() ? rfft512_cmadd_1X2_AVX512 : (cpuSupportsAVX2() ? rfft512_cmadd_1X2_AVX2 : rfft512_cmadd_1X2_ref);
     (*f)(src, coef0, coef1, dst0, dst1);    // dispatch
 }
 
@@ -962,10 +964,72 @@ static void convertInput(int16_t* src, float *dst[4], float gain, int numFrames)
 }
 
 static void rotate_4x4(float* buf[4], const float m0[4][4], const float m1[4][4], const float* win, int numFrames) {
-    static auto f = cpuSupportsAVX2() ? rotate_4x4_AVX2 : rotate_4x4_ref;
+    static auto f = cpuSupportsAVX512() ? rotate_4x4_AVX512 : (cpuSupportsAVX2() ? rotate_4x4_AVX2 : rotate_4x4_ref);
     (*f)(buf, m0, m1, win, numFrames);  // dispatch
 }
 
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+// in-place rotation and scaling of the soundfield
+// crossfade between old and new matrix, to prevent artifacts
+static void rotate_4x4_NEON(float* buf[4], const float m0[4][4], const float m1[4][4], const float* win, int numFrames) {
+
+    // matrix difference
+    const float md[4][4] = { 
+        { m0[0][0] - m1[0][0], m0[0][1] - m1[0][1], m0[0][2] - m1[0][2], m0[0][3] - m1[0][3] },
+        { m0[1][0] - m1[1][0], m0[1][1] - m1[1][1], m0[1][2] - m1[1][2], m0[1][3] - m1[1][3] },
+        { m0[2][0] - m1[2][0], m0[2][1] - m1[2][1], m0[2][2] - m1[2][2], m0[2][3] - m1[2][3] },
+        { m0[3][0] - m1[3][0], m0[3][1] - m1[3][1], m0[3][2] - m1[3][2], m0[3][3] - m1[3][3] },
+    };
+
+    assert(numFrames % 4 == 0);
+
+    for (int i = 0; i < numFrames; i += 4) {
+
+        float32x4_t frac = vld1q_f32(&win[i]);
+
+        // interpolate the matrix
+        float32x4_t m00 = vmlaq_n_f32(vdupq_n_f32(m1[0][0]), frac, md[0][0]);
+
+        float32x4_t m11 = vmlaq_n_f32(vdupq_n_f32(m1[1][1]), frac, md[1][1]);
+        float32x4_t m21 = vmlaq_n_f32(vdupq_n_f32(m1[2][1]), frac, md[2][1]);
+        float32x4_t m31 = vmlaq_n_f32(vdupq_n_f32(m1[3][1]), frac, md[3][1]);
+
+        float32x4_t m12 = vmlaq_n_f32(vdupq_n_f32(m1[1][2]), frac, md[1][2]);
+        float32x4_t m22 = vmlaq_n_f32(vdupq_n_f32(m1[2][2]), frac, md[2][2]);
+        float32x4_t m32 = vmlaq_n_f32(vdupq_n_f32(m1[3][2]), frac, md[3][2]);
+
+        float32x4_t m13 = vmlaq_n_f32(vdupq_n_f32(m1[1][3]), frac, md[1][3]);
+        float32x4_t m23 = vmlaq_n_f32(vdupq_n_f32(m1[2][3]), frac, md[2][3]);
+        float32x4_t m33 = vmlaq_n_f32(vdupq_n_f32(m1[3][3]), frac, md[3][3]);
+
+        float32x4_t b0 = vld1q_f32(&buf[0][i]);
+        float32x4_t b1 = vld1q_f32(&buf[1][i]);
+        float32x4_t b2 = vld1q_f32(&buf[2][i]);
+        float32x4_t b3 = vld1q_f32(&buf[3][i]);
+
+        // matrix multiply
+        float32x4_t w = vmulq_f32(m00, b0);
+
+        float32x4_t x = vmlaq_f32(vmlaq_f32(vmulq_f32(m11, b1), m12, b2), m13, b3);
+        float32x4_t y = vmlaq_f32(vmlaq_f32(vmulq_f32(m21, b1), m22, b2), m23, b3);
+        float32x4_t z = vmlaq_f32(vmlaq_f32(vmulq_f32(m31, b1), m32, b2), m33, b3);
+
+        vst1q_f32(&buf[0][i], w);
+        vst1q_f32(&buf[1][i], x);
+        vst1q_f32(&buf[2][i], y);
+        vst1q_f32(&buf[3][i], z);
+    }
+}
+
+static auto& rfft512 = rfft512_ref;
+static auto& rifft512 = rifft512_ref;
+static auto& rfft512_cmadd_1X2 = rfft512_cmadd_1X2_ref;
+static auto& convertInput = convertInput_ref;
+static auto& rotate_4x4 = rotate_4x4_NEON;
+
 #else   // portable reference code
 
 static auto& rfft512 = rfft512_ref;
@@ -414,6 +414,59 @@ static void interpolate(const float* src0, const float* src1, float* dst, float
 
 #else   // portable reference code
 
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+// 1 channel input, 4 channel output
+static void FIR_1x4(float* src, float* dst0, float* dst1, float* dst2, float* dst3, float coef[4][HRTF_TAPS], int numFrames) {
+
+    float* coef0 = coef[0] + HRTF_TAPS - 1;     // process backwards
+    float* coef1 = coef[1] + HRTF_TAPS - 1;
+    float* coef2 = coef[2] + HRTF_TAPS - 1;
+    float* coef3 = coef[3] + HRTF_TAPS - 1;
+
+    assert(numFrames % 4 == 0);
+
+    for (int i = 0; i < numFrames; i += 4) {
+
+        float32x4_t acc0 = vdupq_n_f32(0);
+        float32x4_t acc1 = vdupq_n_f32(0);
+        float32x4_t acc2 = vdupq_n_f32(0);
+        float32x4_t acc3 = vdupq_n_f32(0);
+        float32x4_t acc4 = vdupq_n_f32(0);
+        float32x4_t acc5 = vdupq_n_f32(0);
+        float32x4_t acc6 = vdupq_n_f32(0);
+        float32x4_t acc7 = vdupq_n_f32(0);
+
+        float* ps = &src[i - HRTF_TAPS + 1];    // process forwards
+
+        static_assert(HRTF_TAPS % 2 == 0, "HRTF_TAPS must be a multiple of 2");
+
+        for (int k = 0; k < HRTF_TAPS; k += 2) {
+
+            float32x4_t x0 = vld1q_f32(&ps[k+0]);
+            acc0 = vmlaq_n_f32(acc0, x0, coef0[-k-0]);
+            acc1 = vmlaq_n_f32(acc1, x0, coef1[-k-0]);
+            acc2 = vmlaq_n_f32(acc2, x0, coef2[-k-0]);
+            acc3 = vmlaq_n_f32(acc3, x0, coef3[-k-0]);
+
+            float32x4_t x1 = vld1q_f32(&ps[k+1]);
+            acc4 = vmlaq_n_f32(acc4, x1, coef0[-k-1]);
+            acc5 = vmlaq_n_f32(acc5, x1, coef1[-k-1]);
+            acc6 = vmlaq_n_f32(acc6, x1, coef2[-k-1]);
+            acc7 = vmlaq_n_f32(acc7, x1, coef3[-k-1]);
+        }
+
+        vst1q_f32(&dst0[i], vaddq_f32(acc0, acc4));
+        vst1q_f32(&dst1[i], vaddq_f32(acc1, acc5));
+        vst1q_f32(&dst2[i], vaddq_f32(acc2, acc6));
+        vst1q_f32(&dst3[i], vaddq_f32(acc3, acc7));
+    }
+}
+
+#else
+
 // 1 channel input, 4 channel output
 static void FIR_1x4(float* src, float* dst0, float* dst1, float* dst2, float* dst3, float coef[4][HRTF_TAPS], int numFrames) {
 
@@ -479,6 +532,8 @@ static void FIR_1x4(float* src, float* dst0, float* dst1, float* dst2, float* ds
     }
 }
 
+#endif
+
 // 4 channel planar to interleaved
 static void interleave_4x4(float* src0, float* src1, float* src2, float* src3, float* dst, int numFrames) {
 
@@ -664,6 +719,26 @@ static void biquad2_4x4(float* src, float* dst, float coef[5][8], float state[3]
 // crossfade 4 inputs into 2 outputs with accumulation (interleaved)
 static void crossfade_4x2(float* src, float* dst, const float* win, int numFrames) {
 
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+    assert(numFrames % 4 == 0);
+
+    for (int i = 0; i < numFrames; i += 4) {
+
+        float32x4_t frac = vld1q_f32(&win[i]);
+
+        // deinterleave 4 frames of [ L0 R0 L1 R1 ] and [ L R ]
+        float32x4x4_t x = vld4q_f32(&src[4*i]);
+        float32x4x2_t y = vld2q_f32(&dst[2*i]);
+
+        y.val[0] = vaddq_f32(y.val[0], vmlaq_f32(x.val[2], frac, vsubq_f32(x.val[0], x.val[2])));
+        y.val[1] = vaddq_f32(y.val[1], vmlaq_f32(x.val[3], frac, vsubq_f32(x.val[1], x.val[3])));
+
+        vst2q_f32(&dst[2*i], y);
+    }
+
+#else
+
     for (int i = 0; i < numFrames; i++) {
 
         float frac = win[i];
@@ -671,6 +746,8 @@ static void crossfade_4x2(float* src, float* dst, const float* win, int numFrame
         dst[2*i+0] += src[4*i+2] + frac * (src[4*i+0] - src[4*i+2]);
         dst[2*i+1] += src[4*i+3] + frac * (src[4*i+1] - src[4*i+3]);
     }
+
+#endif
 }
 
 // linear interpolation with gain
@@ -704,6 +781,21 @@ static void gainfade_1x2(int16_t* src, float* dst, const float* win, float gain0
     }
 }
 
+// apply gain crossfade with accumulation (mono)
+static void gainfade_1x1(int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+
+    gain0 *= (1/32768.0f);  // int16_t to float
+    gain1 *= (1/32768.0f);
+
+    for (int i = 0; i < numFrames; i++) {
+
+        float frac = win[i];
+        float gain = gain1 + frac * (gain0 - gain1);
+
+        dst[i] += (float)src[i] * gain;
+    }
+}
+
 // apply gain crossfade with accumulation (interleaved)
 static void gainfade_2x2(int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
 
@@ -1058,11 +1150,36 @@ static void setFilters(float firCoef[4][HRTF_TAPS], float bqCoef[5][8], int dela
 void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
                        float lpfDistance) {
 
-    assert(index >= 0);
-    assert(index < HRTF_TABLES);
     assert(numFrames == HRTF_BLOCK);
 
     ALIGN32 float in[HRTF_TAPS + HRTF_BLOCK];               // mono
+
+    // convert mono input to float
+    for (int i = 0; i < HRTF_BLOCK; i++) {
+        in[HRTF_TAPS+i] = (float)input[i] * (1/32768.0f);
+    }
+
+    renderBlock(in, output, index, azimuth, distance, gain, lpfDistance);
+}
+
+void AudioHRTF::render(float* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
+                       float lpfDistance) {
+
+    assert(numFrames == HRTF_BLOCK);
+
+    ALIGN32 float in[HRTF_TAPS + HRTF_BLOCK];               // mono
+
+    memcpy(&in[HRTF_TAPS], input, HRTF_BLOCK * sizeof(float));
+
+    renderBlock(in, output, index, azimuth, distance, gain, lpfDistance);
+}
+
+void AudioHRTF::renderBlock(float* in, float* output, int index, float azimuth, float distance, float gain,
+                            float lpfDistance) {
+
+    assert(index >= 0);
+    assert(index < HRTF_TABLES);
+
     ALIGN32 float firCoef[4][HRTF_TAPS];                    // 4-channel
     ALIGN32 float firBuffer[4][HRTF_DELAY + HRTF_BLOCK];    // 4-channel
     ALIGN32 float bqCoef[5][8];                             // 4-channel (interleaved)
@@ -1096,11 +1213,6 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     _gainState = gain;
     _lpfState = lpf;
 
-    // convert mono input to float
-    for (int i = 0; i < HRTF_BLOCK; i++) {
-        in[HRTF_TAPS+i] = (float)input[i] * (1/32768.0f);
-    }
-
     // FIR state update
     memcpy(in, _firState, HRTF_TAPS * sizeof(float));
     memcpy(_firState, &in[HRTF_BLOCK], HRTF_TAPS * sizeof(float));
@@ -1198,3 +1310,30 @@ void AudioHRTF::mixStereo(int16_t* input, float* output, float gain, int numFram
 
     _resetState = false;
 }
+
+void AudioHRTF::premix(int16_t* input, float* output, float azimuth, float distance, float gain, int numFrames,
+                       float lpfDistance) {
+
+    assert(numFrames == HRTF_BLOCK);
+
+    // apply global and local gain adjustment
+    gain *= _gainAdjust;
+
+    // disable interpolation from reset state
+    if (_resetState) {
+        _gainState = gain;
+    }
+
+    // crossfade gain and accumulate into the shared (mono) input
+    gainfade_1x1(input, output, crossfadeTable, _gainState, gain, HRTF_BLOCK);
+
+    // the filter tail is carried by the shared render, so flush our own history,
+    // but keep the parameters current in case this source is rendered on its own next block
+    memset(_firState, 0, sizeof(_firState));
+    memset(_delayState, 0, sizeof(_delayState));
+    memset(_bqState, 0, sizeof(_bqState));
+
+    setParameterHistory(azimuth, distance, gain, lpfDistance);
+
+    _resetState = false;
+}
@@ -58,6 +58,22 @@ public:
     void render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
                 float lpfDistance = LPF_DISTANCE_REF);
 
+    //
+    // input: mono source, already premixed (float, unity scale)
+    // otherwise identical to render() above
+    //
+    void render(float* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
+                float lpfDistance = LPF_DISTANCE_REF);
+
+    //
+    // Premix a mono source into a shared input, so that many co-located sources can be spatialized
+    // with a single render() pass. Applies the same gain interpolation as render(), and keeps the
+    // parameter history current so the source can leave the shared pass without artifacts.
+    // output: mono premix buffer (accumulates into existing output)
+    //
+    void premix(int16_t* input, float* output, float azimuth, float distance, float gain, int numFrames,
+                float lpfDistance = LPF_DISTANCE_REF);
+
     //
     // Non-spatialized direct mix (accumulates into existing output)
     //
@@ -111,6 +127,9 @@ private:
     AudioHRTF(const AudioHRTF&) = delete;
     AudioHRTF& operator=(const AudioHRTF&) = delete;
 
+    // in: HRTF_TAPS of FIR history, followed by HRTF_BLOCK of mono input
+    void renderBlock(float* in, float* output, int index, float azimuth, float distance, float gain, float lpfDistance);
+
     // SIMD channel assignmentS
     enum Channel {
         L0, R0,
@@ -288,6 +288,7 @@ int64_t AudioInjector::injectNextFrame() {
             quint8 volume = MAX_INJECTOR_VOLUME;
             audioPacketStream << volume;
             audioPacketStream << options.ignorePenumbra;
+            audioPacketStream << options.ambient;
 
             audioDataOffset = _currentPacket->pos();
 
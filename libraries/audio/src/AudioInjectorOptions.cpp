@@ -26,6 +26,7 @@ AudioInjectorOptions::AudioInjectorOptions() :
     stereo(false),
     ambisonic(false),
     ignorePenumbra(false),
+    ambient(false),
     localOnly(false),
     secondOffset(0.0f),
     pitch(1.0f)
@@ -41,6 +42,7 @@ QScriptValue injectorOptionsToScriptValue(QScriptEngine* engine, const AudioInje
     obj.setProperty("loop", injectorOptions.loop);
     obj.setProperty("orientation", quatToScriptValue(engine, injectorOptions.orientation));
     obj.setProperty("ignorePenumbra", injectorOptions.ignorePenumbra);
+    obj.setProperty("ambient", injectorOptions.ambient);
     obj.setProperty("localOnly", injectorOptions.localOnly);
     obj.setProperty("secondOffset", injectorOptions.secondOffset);
     obj.setProperty("pitch", injectorOptions.pitch);
@@ -65,6 +67,9 @@ QScriptValue injectorOptionsToScriptValue(QScriptEngine* engine, const AudioInje
  *     others via the audio mixer.
  * @property {boolean} ignorePenumbra=false - <p class="important">Deprecated: This property is deprecated and will be
  *     removed.</p>
+ * @property {boolean} ambient=false - If <code>true</code>, the sound is not spatialized or attenuated with distance: it is
+ *     heard at the same volume by everyone in the audio zone that contains its <code>position</code>, or by everyone in the
+ *     domain if no audio zone contains it. The audio mixer mixes the ambient sounds of a zone once for all its listeners.
  */
 void injectorOptionsFromScriptValue(const QScriptValue& object, AudioInjectorOptions& injectorOptions) {
     if (!object.isObject()) {
@@ -104,6 +109,12 @@ void injectorOptionsFromScriptValue(const QScriptValue& object, AudioInjectorOpt
             } else {
                 qCWarning(audio) << "Audio injector options: ignorePenumbra is not a boolean";
             }
+        } else if (it.name() == "ambient") {
+            if (it.value().isBool()) {
+                injectorOptions.ambient = it.value().toBool();
+            } else {
+                qCWarning(audio) << "Audio injector options: ambient is not a boolean";
+            }
         } else if (it.name() == "localOnly") {
             if (it.value().isBool()) {
                 injectorOptions.localOnly = it.value().toBool();
@@ -28,6 +28,7 @@ public:
     bool stereo;
     bool ambisonic;
     bool ignorePenumbra;
+    bool ambient;
     bool localOnly;
     float secondOffset;
     float pitch;    // multiplier, where 2.0f shifts up one octave
@@ -191,6 +191,94 @@ int32_t LimiterImpl::envelope(int32_t attn) {
     return attn;
 }
 
+//
+// Output stage: apply the gain and dither, and convert to 16-bit
+// The gain and dither are per sample, so the loop is the same for any number of channels.
+//
+
+// frames of gain computed before the output stage is run on them
+static const int LIMITER_BLOCK = 64;
+
+static FORCEINLINE int16_t saturate16(int32_t x) {
+    return (int16_t)MIN(MAX(x, -32768), 32767);
+}
+
+static void applyGain_ref(const float* input, const float* gain, const float* dither, int16_t* output, int numSamples) {
+    for (int i = 0; i < numSamples; i++) {
+        output[i] = saturate16(floatToInt(input[i] * gain[i] + dither[i]));
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <emmintrin.h>  // SSE2
+
+static void applyGain_SSE(const float* input, const float* gain, const float* dither, int16_t* output, int numSamples) {
+
+    int i = 0;
+    for (; i < numSamples - 7; i += 8) {
+
+        __m128 x0 = _mm_mul_ps(_mm_loadu_ps(&input[i + 0]), _mm_loadu_ps(&gain[i + 0]));
+        x0 = _mm_add_ps(x0, _mm_loadu_ps(&dither[i + 0]));
+        __m128 x1 = _mm_mul_ps(_mm_loadu_ps(&input[i + 4]), _mm_loadu_ps(&gain[i + 4]));
+        x1 = _mm_add_ps(x1, _mm_loadu_ps(&dither[i + 4]));
+
+        // round-to-nearest, and pack with saturation
+        __m128i a0 = _mm_packs_epi32(_mm_cvtps_epi32(x0), _mm_cvtps_epi32(x1));
+
+        _mm_storeu_si128((__m128i*)&output[i], a0);
+    }
+    applyGain_ref(&input[i], &gain[i], &dither[i], &output[i], numSamples - i);
+}
+
+//
+// Runtime CPU dispatch
+//
+
+#include "CPUDetect.h"
+
+void applyGain_AVX2(const float* input, const float* gain, const float* dither, int16_t* output, int numSamples);
+
+static void applyGain(const float* input, const float* gain, const float* dither, int16_t* output, int numSamples) {
+    static auto f = cpuSupportsAVX2() ? applyGain_AVX2 : applyGain_SSE;
+    (*f)(input, gain, dither, output, numSamples);   // dispatch
+}
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+static void applyGain(const float* input, const float* gain, const float* dither, int16_t* output, int numSamples) {
+
+    const uint32x4_t SIGN_MASK = vdupq_n_u32(0x80000000);
+    const uint32x4_t HALF = vreinterpretq_u32_f32(vdupq_n_f32(0.5f));
+
+    int i = 0;
+    for (; i < numSamples - 7; i += 8) {
+
+        float32x4_t x0 = vmlaq_f32(vld1q_f32(&dither[i + 0]), vld1q_f32(&input[i + 0]), vld1q_f32(&gain[i + 0]));
+        float32x4_t x1 = vmlaq_f32(vld1q_f32(&dither[i + 4]), vld1q_f32(&input[i + 4]), vld1q_f32(&gain[i + 4]));
+
+        // round half away from zero, as floatToInt()
+        x0 = vaddq_f32(x0, vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(x0), SIGN_MASK), HALF)));
+        x1 = vaddq_f32(x1, vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(x1), SIGN_MASK), HALF)));
+
+        // truncate, and narrow with saturation
+        int16x8_t a0 = vcombine_s16(vqmovn_s32(vcvtq_s32_f32(x0)), vqmovn_s32(vcvtq_s32_f32(x1)));
+
+        vst1q_s16(&output[i], a0);
+    }
+    applyGain_ref(&input[i], &gain[i], &dither[i], &output[i], numSamples - i);
+}
+
+#else   // portable reference code
+
+static void applyGain(const float* input, const float* gain, const float* dither, int16_t* output, int numSamples) {
+    applyGain_ref(input, gain, dither, output, numSamples);
+}
+
+#endif
+
 //
 // Limiter (mono)
 //
@@ -204,11 +292,31 @@ public:
     LimiterMono(int sampleRate) : LimiterImpl(sampleRate) {}
 
     void process(float* input, int16_t* output, int numFrames) override;
+
+private:
+    void computeGains(float* input, float* delayed, float* gains, float* dithers, int numFrames);
 };
 
 template<int N>
 void LimiterMono<N>::process(float* input, int16_t* output, int numFrames) {
 
+    float delayed[LIMITER_BLOCK];
+    float gains[LIMITER_BLOCK];
+    float dithers[LIMITER_BLOCK];
+
+    for (int block = 0; block < numFrames; block += LIMITER_BLOCK) {
+
+        int numBlockFrames = MIN(numFrames - block, LIMITER_BLOCK);
+        computeGains(&input[block], delayed, gains, dithers, numBlockFrames);
+
+        applyGain(delayed, gains, dithers, &output[block], numBlockFrames);
+    }
+}
+
+// computes the gain and dither of each sample, and delays the audio
+template<int N>
+void LimiterMono<N>::computeGains(float* input, float* delayed, float* gains, float* dithers, int numFrames) {
+
     for (int n = 0; n < numFrames; n++) {
 
         // peak detect and convert to log2 domain
@@ -230,15 +338,11 @@ void LimiterMono<N>::process(float* input, int16_t* output, int numFrames) {
         // delay audio
         float x = input[n];
         _delay.process(x);
+        delayed[n] = x;
 
-        // apply gain
-        x *= gain;
-
-        // apply dither
-        x += dither();
-
-        // store 16-bit output
-        output[n] = (int16_t)floatToInt(x);
+        // the gain and dither are applied by the output stage
+        gains[n] = gain;
+        dithers[n] = dither();
     }
 }
 
@@ -256,11 +360,31 @@ public:
 
     // interleaved stereo input/output
     void process(float* input, int16_t* output, int numFrames) override;
+
+private:
+    void computeGains(float* input, float* delayed, float* gains, float* dithers, int numFrames);
 };
 
 template<int N>
 void LimiterStereo<N>::process(float* input, int16_t* output, int numFrames) {
 
+    float delayed[2*LIMITER_BLOCK];
+    float gains[2*LIMITER_BLOCK];
+    float dithers[2*LIMITER_BLOCK];
+
+    for (int block = 0; block < numFrames; block += LIMITER_BLOCK) {
+
+        int numBlockFrames = MIN(numFrames - block, LIMITER_BLOCK);
+        computeGains(&input[2*block], delayed, gains, dithers, numBlockFrames);
+
+        applyGain(delayed, gains, dithers, &output[2*block], 2*numBlockFrames);
+    }
+}
+
+// computes the gain and dither of each sample, and delays the audio
+template<int N>
+void LimiterStereo<N>::computeGains(float* input, float* delayed, float* gains, float* dithers, int numFrames) {
+
     for (int n = 0; n < numFrames; n++) {
 
         // peak detect and convert to log2 domain
@@ -283,19 +407,15 @@ void LimiterStereo<N>::process(float* input, int16_t* output, int numFrames) {
         float x0 = input[2*n+0];
         float x1 = input[2*n+1];
         _delay.process(x0, x1);
+        delayed[2*n+0] = x0;
+        delayed[2*n+1] = x1;
 
-        // apply gain
-        x0 *= gain;
-        x1 *= gain;
-
-        // apply dither
+        // the gain and dither are applied by the output stage
         float d = dither();
-        x0 += d;
-        x1 += d;
-
-        // store 16-bit output
-        output[2*n+0] = (int16_t)floatToInt(x0);
-        output[2*n+1] = (int16_t)floatToInt(x1);
+        gains[2*n+0] = gain;
+        gains[2*n+1] = gain;
+        dithers[2*n+0] = d;
+        dithers[2*n+1] = d;
     }
 }
 
@@ -313,11 +433,31 @@ public:
 
     // interleaved quad input/output
     void process(float* input, int16_t* output, int numFrames) override;
+
+private:
+    void computeGains(float* input, float* delayed, float* gains, float* dithers, int numFrames);
 };
 
 template<int N>
 void LimiterQuad<N>::process(float* input, int16_t* output, int numFrames) {
 
+    float delayed[4*LIMITER_BLOCK];
+    float gains[4*LIMITER_BLOCK];
+    float dithers[4*LIMITER_BLOCK];
+
+    for (int block = 0; block < numFrames; block += LIMITER_BLOCK) {
+
+        int numBlockFrames = MIN(numFrames - block, LIMITER_BLOCK);
+        computeGains(&input[4*block], delayed, gains, dithers, numBlockFrames);
+
+        applyGain(delayed, gains, dithers, &output[4*block], 4*numBlockFrames);
+    }
+}
+
+// computes the gain and dither of each sample, and delays the audio
+template<int N>
+void LimiterQuad<N>::computeGains(float* input, float* delayed, float* gains, float* dithers, int numFrames) {
+
     for (int n = 0; n < numFrames; n++) {
 
         // peak detect and convert to log2 domain
@@ -342,25 +482,17 @@ void LimiterQuad<N>::process(float* input, int16_t* output, int numFrames) {
         float x2 = input[4*n+2];
         float x3 = input[4*n+3];
         _delay.process(x0, x1, x2, x3);
+        delayed[4*n+0] = x0;
+        delayed[4*n+1] = x1;
+        delayed[4*n+2] = x2;
+        delayed[4*n+3] = x3;
 
-        // apply gain
-        x0 *= gain;
-        x1 *= gain;
-        x2 *= gain;
-        x3 *= gain;
-
-        // apply dither
+        // the gain and dither are applied by the output stage
         float d = dither();
-        x0 += d;
-        x1 += d;
-        x2 += d;
-        x3 += d;
-
-        // store 16-bit output
-        output[4*n+0] = (int16_t)floatToInt(x0);
-        output[4*n+1] = (int16_t)floatToInt(x1);
-        output[4*n+2] = (int16_t)floatToInt(x2);
-        output[4*n+3] = (int16_t)floatToInt(x3);
+        for (int c = 0; c < 4; c++) {
+            gains[4*n+c] = gain;
+            dithers[4*n+c] = d;
+        }
     }
 }
 
@@ -33,12 +33,7 @@ AudioRingBufferTemplate<T>::AudioRingBufferTemplate(int numFrameSamples, int num
     _sampleCapacity(numFrameSamples * numFramesCapacity),
     _bufferLength(numFrameSamples * (numFramesCapacity + 1))
 {
-    if (numFrameSamples) {
-        _buffer = new Sample[_bufferLength];
-        memset(_buffer, 0, _bufferLength * SampleSize);
-        _nextOutput = _buffer;
-        _endOfLastWrite = _buffer;
-    }
+    allocate();
 }
 
 template <class T>
@@ -46,10 +41,39 @@ AudioRingBufferTemplate<T>::~AudioRingBufferTemplate() {
     delete[] _buffer;
 }
 
+template <class T>
+void AudioRingBufferTemplate<T>::allocate() {
+    if (_bufferLength == 0) {
+        delete[] _buffer;
+        _buffer = nullptr;
+        _allocatedLength = 0;
+    } else if (!_isLockFree || _bufferLength > _allocatedLength) {
+        delete[] _buffer;
+
+        // lock-free buffers round up to a power of two, so that most later resizes fit
+        int allocatedLength = _bufferLength;
+        if (_isLockFree) {
+            allocatedLength = 1;
+            while (allocatedLength < _bufferLength) {
+                allocatedLength <<= 1;
+            }
+        }
+
+        _buffer = new Sample[allocatedLength];
+        _allocatedLength = allocatedLength;
+    }
+
+    if (_buffer) {
+        memset(_buffer, 0, _bufferLength * SampleSize);
+    }
+    reset();
+}
+
 template <class T>
 void AudioRingBufferTemplate<T>::clear() {
-    _endOfLastWrite = _buffer;
-    _nextOutput = _buffer;
+    _endOfLastWrite.store(_buffer, std::memory_order_relaxed);
+    _nextOutput.store(_buffer, std::memory_order_relaxed);
+    _pendingDropSamples.store(0, std::memory_order_relaxed);
 }
 
 template <class T>
@@ -60,19 +84,36 @@ void AudioRingBufferTemplate<T>::reset() {
 
 template <class T>
 void AudioRingBufferTemplate<T>::resizeForFrameSize(int numFrameSamples) {
-    delete[] _buffer;
     _numFrameSamples = numFrameSamples;
     _sampleCapacity = numFrameSamples * _frameCapacity;
     _bufferLength = numFrameSamples * (_frameCapacity + 1);
 
-    if (numFrameSamples) {
-        _buffer = new Sample[_bufferLength];
-        memset(_buffer, 0, _bufferLength * SampleSize);
+    allocate();
+}
+
+template <class T>
+void AudioRingBufferTemplate<T>::setLockFree(bool isLockFree) {
+    _isLockFree = isLockFree;
+    _allocatedLength = 0;   // force a reallocation for the new mode
+    allocate();
+}
+
+template <class T>
+void AudioRingBufferTemplate<T>::dropOldestSamples(int numSamples) {
+    if (_isLockFree) {
+        // only the reader may move the read position
+        _pendingDropSamples.fetch_add(numSamples, std::memory_order_relaxed);
     } else {
-        _buffer = nullptr;
+        shiftReadPosition(std::min(numSamples, samplesAvailable()));
     }
+}
 
-    reset();
+template <class T>
+void AudioRingBufferTemplate<T>::applyPendingDrops() {
+    if (_pendingDropSamples.load(std::memory_order_relaxed) > 0) {
+        int numSamples = _pendingDropSamples.exchange(0, std::memory_order_relaxed);
+        shiftReadPosition(std::min(numSamples, samplesAvailable()));
+    }
 }
 
 template <class T>
@@ -97,20 +138,23 @@ int AudioRingBufferTemplate<T>::writeSamples(const Sample* source, int maxSample
 template <class T>
 int AudioRingBufferTemplate<T>::readData(char *data, int maxSize) {
     // only copy up to the number of samples we have available
+    applyPendingDrops();
+
     int maxSamples = maxSize / SampleSize;
     int numReadSamples = std::min(maxSamples, samplesAvailable());
+    Sample* nextOutput = readPosition();
 
-    if (_nextOutput + numReadSamples > _buffer + _bufferLength) {
+    if (nextOutput + numReadSamples > _buffer + _bufferLength) {
         // we're going to need to do two reads to get this data, it wraps around the edge
-        int numSamplesToEnd = (_buffer + _bufferLength) - _nextOutput;
+        int numSamplesToEnd = (_buffer + _bufferLength) - nextOutput;
 
         // read to the end of the buffer
-        memcpy(data, _nextOutput, numSamplesToEnd * SampleSize);
+        memcpy(data, nextOutput, numSamplesToEnd * SampleSize);
 
         // read the rest from the beginning of the buffer
         memcpy(data + (numSamplesToEnd * SampleSize), _buffer, (numReadSamples - numSamplesToEnd) * SampleSize);
     } else {
-        memcpy(data, _nextOutput, numReadSamples * SampleSize);
+        memcpy(data, nextOutput, numReadSamples * SampleSize);
     }
 
     shiftReadPosition(numReadSamples);
@@ -121,14 +165,16 @@ int AudioRingBufferTemplate<T>::readData(char *data, int maxSize) {
 template <class T>
 int AudioRingBufferTemplate<T>::appendData(char *data, int maxSize) {
     // only copy up to the number of samples we have available
+    applyPendingDrops();
+
     int maxSamples = maxSize / SampleSize;
     int numReadSamples = std::min(maxSamples, samplesAvailable());
 
     Sample* dest = reinterpret_cast<Sample*>(data);
-    Sample* output = _nextOutput;
-    if (_nextOutput + numReadSamples > _buffer + _bufferLength) {
+    Sample* output = readPosition();
+    if (output + numReadSamples > _buffer + _bufferLength) {
         // we're going to need to do two reads to get this data, it wraps around the edge
-        int numSamplesToEnd = (_buffer + _bufferLength) - _nextOutput;
+        int numSamplesToEnd = (_buffer + _bufferLength) - output;
 
         // read to the end of the buffer
         for (int i = 0; i < numSamplesToEnd; i++) {
@@ -160,45 +206,58 @@ template <class T>
 int AudioRingBufferTemplate<T>::writeData(const char* data, int maxSize) {
     // only copy up to the number of samples we have capacity for
     int maxSamples = maxSize / SampleSize;
-    int numWriteSamples = std::min(maxSamples, _sampleCapacity);
-    int samplesRoomFor = _sampleCapacity - samplesAvailable();
-
-    if (numWriteSamples > samplesRoomFor) {
-        // there's not enough room for this write. erase old data to make room for this new data
-        int samplesToDelete = numWriteSamples - samplesRoomFor;
-        _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, samplesToDelete);
-        _overflowCount++;
+    int numWriteSamples = makeRoomForWrite(std::min(maxSamples, _sampleCapacity));
+    Sample* endOfLastWrite = _endOfLastWrite.load(std::memory_order_relaxed);
 
-        std::call_once(messageIDFlag, [](int* id) { *id = LogHandler::getInstance().newRepeatedMessageID(); },
-            &repeatedOverflowMessageID);
-        HIFI_FCDEBUG_ID(audio(), repeatedOverflowMessageID, RING_BUFFER_OVERFLOW_DEBUG);
-    }
-
-    if (_endOfLastWrite + numWriteSamples > _buffer + _bufferLength) {
+    if (endOfLastWrite + numWriteSamples > _buffer + _bufferLength) {
         // we're going to need to do two writes to set this data, it wraps around the edge
-        int numSamplesToEnd = (_buffer + _bufferLength) - _endOfLastWrite;
+        int numSamplesToEnd = (_buffer + _bufferLength) - endOfLastWrite;
 
         // write to the end of the buffer
-        memcpy(_endOfLastWrite, data, numSamplesToEnd * SampleSize);
+        memcpy(endOfLastWrite, data, numSamplesToEnd * SampleSize);
 
         // write the rest to the beginning of the buffer
         memcpy(_buffer, data + (numSamplesToEnd * SampleSize), (numWriteSamples - numSamplesToEnd) * SampleSize);
     } else {
-        memcpy(_endOfLastWrite, data, numWriteSamples * SampleSize);
+        memcpy(endOfLastWrite, data, numWriteSamples * SampleSize);
     }
 
-    _endOfLastWrite = shiftedPositionAccomodatingWrap(_endOfLastWrite, numWriteSamples);
+    setWritePosition(shiftedPositionAccomodatingWrap(endOfLastWrite, numWriteSamples));
 
     return numWriteSamples * SampleSize;
 }
 
+template <class T>
+int AudioRingBufferTemplate<T>::makeRoomForWrite(int numSamples) {
+    int samplesRoomFor = _sampleCapacity - samplesAvailable();
+
+    if (numSamples > samplesRoomFor) {
+        _overflowCount++;
+
+        std::call_once(messageIDFlag, [](int* id) { *id = LogHandler::getInstance().newRepeatedMessageID(); },
+            &repeatedOverflowMessageID);
+        HIFI_FCDEBUG_ID(audio(), repeatedOverflowMessageID, RING_BUFFER_OVERFLOW_DEBUG);
+
+        if (_isLockFree) {
+            // the read position belongs to the reader, so drop what does not fit
+            return samplesRoomFor;
+        }
+
+        // there's not enough room for this write. erase old data to make room for this new data
+        int samplesToDelete = numSamples - samplesRoomFor;
+        shiftReadPosition(samplesToDelete);
+    }
+    return numSamples;
+}
+
 template <class T>
 int AudioRingBufferTemplate<T>::samplesAvailable() const {
-    if (!_endOfLastWrite) {
+    Sample* endOfLastWrite = writePosition();
+    if (!endOfLastWrite) {
         return 0;
     }
 
-    int sampleDifference = _endOfLastWrite - _nextOutput;
+    int sampleDifference = endOfLastWrite - readPosition();
     if (sampleDifference < 0) {
         sampleDifference += _bufferLength;
     }
@@ -231,15 +290,16 @@ int AudioRingBufferTemplate<T>::addSilentSamples(int silentSamples) {
         HIFI_FCDEBUG(audio(), DROPPED_SILENT_DEBUG);
     }
 
-    if (_endOfLastWrite + numWriteSamples > _buffer + _bufferLength) {
-        int numSamplesToEnd = (_buffer + _bufferLength) - _endOfLastWrite;
-        memset(_endOfLastWrite, 0, numSamplesToEnd * SampleSize);
+    Sample* endOfLastWrite = _endOfLastWrite.load(std::memory_order_relaxed);
+    if (endOfLastWrite + numWriteSamples > _buffer + _bufferLength) {
+        int numSamplesToEnd = (_buffer + _bufferLength) - endOfLastWrite;
+        memset(endOfLastWrite, 0, numSamplesToEnd * SampleSize);
         memset(_buffer, 0, (numWriteSamples - numSamplesToEnd) * SampleSize);
     } else {
-        memset(_endOfLastWrite, 0, numWriteSamples * SampleSize);
+        memset(endOfLastWrite, 0, numWriteSamples * SampleSize);
     }
 
-    _endOfLastWrite = shiftedPositionAccomodatingWrap(_endOfLastWrite, numWriteSamples);
+    setWritePosition(shiftedPositionAccomodatingWrap(endOfLastWrite, numWriteSamples));
 
     return numWriteSamples;
 }
@@ -272,50 +332,32 @@ float AudioRingBufferTemplate<T>::getFrameLoudness(ConstIterator frameStart) con
 
 template <class T>
 int AudioRingBufferTemplate<T>::writeSamples(ConstIterator source, int maxSamples) {
-    int samplesToCopy = std::min(maxSamples, _sampleCapacity);
-    int samplesRoomFor = _sampleCapacity - samplesAvailable();
-    if (samplesToCopy > samplesRoomFor) {
-        // there's not enough room for this write.  erase old data to make room for this new data
-        int samplesToDelete = samplesToCopy - samplesRoomFor;
-        _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, samplesToDelete);
-        _overflowCount++;
-
-        std::call_once(messageIDFlag, [](int* id) { *id = LogHandler::getInstance().newRepeatedMessageID(); },
-            &repeatedOverflowMessageID);
-        HIFI_FCDEBUG_ID(audio(), repeatedOverflowMessageID, RING_BUFFER_OVERFLOW_DEBUG);
-    }
+    int samplesToCopy = makeRoomForWrite(std::min(maxSamples, _sampleCapacity));
 
+    Sample* endOfLastWrite = _endOfLastWrite.load(std::memory_order_relaxed);
     Sample* bufferLast = _buffer + _bufferLength - 1;
     for (int i = 0; i < samplesToCopy; i++) {
-        *_endOfLastWrite = *source;
-        _endOfLastWrite = (_endOfLastWrite == bufferLast) ? _buffer : _endOfLastWrite + 1;
+        *endOfLastWrite = *source;
+        endOfLastWrite = (endOfLastWrite == bufferLast) ? _buffer : endOfLastWrite + 1;
         ++source;
     }
+    setWritePosition(endOfLastWrite);
 
     return samplesToCopy;
 }
 
 template <class T>
 int AudioRingBufferTemplate<T>::writeSamplesWithFade(ConstIterator source, int maxSamples, float fade) {
-    int samplesToCopy = std::min(maxSamples, _sampleCapacity);
-    int samplesRoomFor = _sampleCapacity - samplesAvailable();
-    if (samplesToCopy > samplesRoomFor) {
-        // there's not enough room for this write.  erase old data to make room for this new data
-        int samplesToDelete = samplesToCopy - samplesRoomFor;
-        _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, samplesToDelete);
-        _overflowCount++;
-
-        std::call_once(messageIDFlag, [](int* id) { *id = LogHandler::getInstance().newRepeatedMessageID(); },
-            &repeatedOverflowMessageID);
-        HIFI_FCDEBUG_ID(audio(), repeatedOverflowMessageID, RING_BUFFER_OVERFLOW_DEBUG);
-    }
+    int samplesToCopy = makeRoomForWrite(std::min(maxSamples, _sampleCapacity));
 
+    Sample* endOfLastWrite = _endOfLastWrite.load(std::memory_order_relaxed);
     Sample* bufferLast = _buffer + _bufferLength - 1;
     for (int i = 0; i < samplesToCopy; i++) {
-        *_endOfLastWrite = (Sample)((float)(*source) * fade);
-        _endOfLastWrite = (_endOfLastWrite == bufferLast) ? _buffer : _endOfLastWrite + 1;
+        *endOfLastWrite = (Sample)((float)(*source) * fade);
+        endOfLastWrite = (endOfLastWrite == bufferLast) ? _buffer : endOfLastWrite + 1;
         ++source;
     }
+    setWritePosition(endOfLastWrite);
 
     return samplesToCopy;
 }
@@ -14,6 +14,8 @@
 
 #include "AudioConstants.h"
 
+#include <atomic>
+
 #include <QtCore/QIODevice>
 
 #include <SharedUtil.h>
@@ -51,6 +53,19 @@ public:
     // IMPORTANT: Avoid changes to the implementation that touch shared data unless you can
     // maintain this behavior.
 
+    /// Single-producer/single-consumer mode, for a buffer written and read on two different threads (causes a reset())
+    /// The writer never moves the read position: a full buffer drops the newest samples instead of overwriting
+    /// the oldest, and dropOldestSamples() is deferred to the reader. The buffer is allocated once for a
+    /// power-of-two number of samples, so that resizes which fit do not reallocate.
+    void setLockFree(bool isLockFree);
+    bool isLockFree() const { return _isLockFree; }
+
+    /// Drop up to numSamples of the oldest data (may be called by the writer)
+    void dropOldestSamples(int numSamples);
+
+    /// Apply drops requested by the writer in lock-free mode (called by the reader, and by its reads)
+    void applyPendingDrops();
+
     /// Read up to maxSamples into destination (will only read up to samplesAvailable())
     /// Returns number of read samples
     int readSamples(Sample* destination, int maxSamples);
@@ -85,17 +100,19 @@ public:
     int writeData(const char* source, int maxSize);
 
     /// Returns a reference to the index-th sample offset from the current read sample
-    Sample& operator[](const int index) { return *shiftedPositionAccomodatingWrap(_nextOutput, index); }
-    const Sample& operator[] (const int index) const { return *shiftedPositionAccomodatingWrap(_nextOutput, index); }
+    Sample& operator[](const int index) { return *shiftedPositionAccomodatingWrap(readPosition(), index); }
+    const Sample& operator[] (const int index) const { return *shiftedPositionAccomodatingWrap(readPosition(), index); }
 
     /// Essentially discards the next numSamples from the ring buffer
     /// NOTE: This is not checked - it is possible to shift past written data
     ///       Use samplesAvailable() to see the distance a valid shift can go
-    void shiftReadPosition(unsigned int numSamples) { _nextOutput = shiftedPositionAccomodatingWrap(_nextOutput, numSamples); }
+    void shiftReadPosition(unsigned int numSamples) {
+        _nextOutput.store(shiftedPositionAccomodatingWrap(readPosition(), numSamples), std::memory_order_release);
+    }
 
     int samplesAvailable() const;
     int framesAvailable() const { return (_numFrameSamples == 0) ? 0 : samplesAvailable() / _numFrameSamples; }
-    float getNextOutputFrameLoudness() const { return getFrameLoudness(_nextOutput); }
+    float getNextOutputFrameLoudness() const { return getFrameLoudness(readPosition()); }
 
 
     int getNumFrameSamples() const { return _numFrameSamples; }
@@ -199,10 +216,10 @@ public:
     };
 
     ConstIterator nextOutput() const {
-        return ConstIterator(_buffer, _bufferLength, _nextOutput);
+        return ConstIterator(_buffer, _bufferLength, readPosition());
     }
     ConstIterator lastFrameWritten() const {
-        return ConstIterator(_buffer, _bufferLength, _endOfLastWrite) - _numFrameSamples;
+        return ConstIterator(_buffer, _bufferLength, writePosition()) - _numFrameSamples;
     }
 
     int writeSamples(ConstIterator source, int maxSamples);
@@ -214,14 +231,27 @@ protected:
     Sample* shiftedPositionAccomodatingWrap(Sample* position, int numSamplesShift) const;
     float getFrameLoudness(const Sample* frameStart) const;
 
+    // the positions are published with release and observed with acquire, so that the samples written
+    // (or consumed) before a position moves are visible to the other thread once it sees the new position
+    Sample* readPosition() const { return _nextOutput.load(std::memory_order_acquire); }
+    Sample* writePosition() const { return _endOfLastWrite.load(std::memory_order_acquire); }
+    void setWritePosition(Sample* position) { _endOfLastWrite.store(position, std::memory_order_release); }
+
+    // returns the number of samples a write of numSamples can store, making room for them if allowed
+    int makeRoomForWrite(int numSamples);
+    void allocate();
+
     int _numFrameSamples;
     int _frameCapacity;
     int _sampleCapacity;
     int _bufferLength; // actual _buffer length (_sampleCapacity + 1)
-    int _overflowCount{ 0 }; // times the ring buffer has overwritten data
+    int _allocatedLength { 0 }; // _buffer allocation, which is at least _bufferLength
+    int _overflowCount{ 0 }; // times the ring buffer has overwritten (or dropped, when lock-free) data
+    bool _isLockFree { false };
 
-    Sample* _nextOutput{ nullptr };
-    Sample* _endOfLastWrite{ nullptr };
+    std::atomic<Sample*> _nextOutput { nullptr };
+    std::atomic<Sample*> _endOfLastWrite { nullptr };
+    std::atomic<int> _pendingDropSamples { 0 };
     Sample* _buffer{ nullptr };
 };
 
@@ -148,7 +148,15 @@ int InboundAudioStream::parseData(ReceivedMessage& message) {
             // also result in allowing the codec to interpolate lost data. Then
             // fall through to the "on time" logic to actually handle this packet
             int packetsDropped = arrivalInfo._seqDiffFromExpected;
-            lostAudioData(packetsDropped);
+
+            // the codec may recover the last of the dropped packets from the redundant data of this one
+            QByteArray nextAudioData;
+            if (message.getType() != PacketType::SilentAudioFrame
+                && message.getType() != PacketType::ReplicatedSilentAudioFrame
+                && codecInPacket == _selectedCodecName) {
+                nextAudioData = message.peek(message.getBytesLeftToRead());
+            }
+            lostAudioData(packetsDropped, nextAudioData);
 
             // fall through to OnTime case
         }
@@ -215,7 +223,7 @@ int InboundAudioStream::parseData(ReceivedMessage& message) {
     // drop the oldest frames so the ringbuffer is down to the desired size.
     if (framesAvailable > _desiredJitterBufferFrames + MAX_FRAMES_OVER_DESIRED) {
         int framesToDrop = framesAvailable - (_desiredJitterBufferFrames + DESIRED_JITTER_BUFFER_FRAMES_PADDING);
-        _ringBuffer.shiftReadPosition(framesToDrop * _ringBuffer.getNumFrameSamples());
+        _ringBuffer.dropOldestSamples(framesToDrop * _ringBuffer.getNumFrameSamples());
 
         _framesAvailableStat.reset();
         _currentJitterBufferFrames = 0;
@@ -244,7 +252,7 @@ int InboundAudioStream::parseStreamProperties(PacketType type, const QByteArray&
     }
 }
 
-int InboundAudioStream::lostAudioData(int numPackets) {
+int InboundAudioStream::lostAudioData(int numPackets, const QByteArray& nextPacketAfterStreamProperties) {
     QByteArray decodedBuffer;
 
     while (numPackets--) {
@@ -256,7 +264,9 @@ int InboundAudioStream::lostAudioData(int numPackets) {
             qCInfo(audiostream, "Packet currently being unpacked or lost frame already being generated.  Not generating lost frame.");
             return 0;
         }
-        if (_decoder) {
+        if (_decoder && numPackets == 0 && !nextPacketAfterStreamProperties.isEmpty()) {
+            _decoder->recoverFrame(nextPacketAfterStreamProperties, decodedBuffer);
+        } else if (_decoder) {
             _decoder->lostFrame(decodedBuffer);
         } else {
             decodedBuffer.resize(AudioConstants::NETWORK_FRAME_BYTES_PER_CHANNEL * _numChannels);
@@ -343,6 +353,8 @@ int InboundAudioStream::writeDroppableSilentFrames(int silentFrames) {
 }
 
 int InboundAudioStream::popSamples(int maxSamples, bool allOrNothing) {
+    _ringBuffer.applyPendingDrops();
+
     int samplesPopped = 0;
     int samplesAvailable = _ringBuffer.samplesAvailable();
     if (_isStarved) {
@@ -56,6 +56,10 @@ public:
     virtual void resetStats();
     void clearBuffer();
 
+    // for streams written and popped on different threads, see AudioRingBuffer::setLockFree
+    // (discards any data in the buffer)
+    void setLockFree(bool isLockFree) { _ringBuffer.setLockFree(isLockFree); }
+
     virtual int parseData(ReceivedMessage& packet) override;
 
     int popFrames(int maxFrames, bool allOrNothing);
@@ -135,7 +139,8 @@ protected:
     virtual int parseAudioData(PacketType type, const QByteArray& packetAfterStreamProperties);
 
     /// produces audio data for lost network packets.
-    virtual int lostAudioData(int numPackets);
+    // the audio data that follows the lost packets, when it is known, lets the codec recover the last of them
+    virtual int lostAudioData(int numPackets, const QByteArray& nextPacketAfterStreamProperties = QByteArray());
 
     /// writes silent frames to the buffer that may be dropped to reduce latency caused by the buffer
     virtual int writeDroppableSilentFrames(int silentFrames);
@@ -65,6 +65,7 @@ int InjectedAudioStream::parseStreamProperties(PacketType type,
     _attenuationRatio = unpackFloatGainFromByte(attenuationByte);
     
     packetStream >> _ignorePenumbra;
+    packetStream >> _isAmbient;
     
     int numAudioBytes = packetAfterSeqNum.size() - packetStream.device()->pos();
     numAudioSamples = numAudioBytes / sizeof(int16_t);
@@ -35,7 +35,7 @@ public:
 protected:
     int writeDroppableSilentFrames(int silentFrames) override;
     int parseAudioData(PacketType type, const QByteArray& packetAfterStreamProperties) override;
-    int lostAudioData(int numPackets) override;
+    int lostAudioData(int numPackets, const QByteArray& nextPacketAfterStreamProperties = QByteArray()) override;
 
 private:
     int networkToDeviceFrames(int networkFrames);
@@ -62,6 +62,9 @@ public:
     bool shouldLoopbackForNode() const { return _shouldLoopbackForNode; }
     bool isStereo() const { return _isStereo; }
 
+    // not spatialized, heard at the same gain by every listener of its audio zone
+    bool isAmbient() const { return _isAmbient; }
+
     PositionalAudioStream::Type getType() const { return _type; }
 
     const glm::vec3& getPosition() const { return _position; }
@@ -100,6 +103,7 @@ protected:
     bool _isStereo;
     // Ignore penumbra filter
     bool _ignorePenumbra;
+    bool _isAmbient { false };
 
     float _lastPopOutputTrailingLoudness;
     float _lastPopOutputLoudness;
@@ -12,6 +12,7 @@
 #include "Sound.h"
 
 #include <stdint.h>
+#include <memory>
 
 #include <glm/glm.hpp>
 
@@ -120,17 +121,42 @@ void SoundProcessor::run() {
     static const QString RAW_EXTENSION = ".raw";
     static const QString STEREO_RAW_EXTENSION = ".stereo.raw";
     QString fileType;
+    if (fileName.endsWith(WAV_EXTENSION)) {
+        fileType = "WAV";
+    } else if (fileName.endsWith(MP3_EXTENSION)) {
+        fileType = "MP3";
+    } else if (fileName.endsWith(STEREO_RAW_EXTENSION)) {
+        fileType = "STEREO_RAW";
+    } else if (fileName.endsWith(RAW_EXTENSION)) {
+        fileType = "RAW";
+    } else {
+        qCWarning(audio) << "Unknown sound file type";
+        emit onError(300, "Failed to load sound file, reason: unknown sound file type");
+        return;
+    }
+
+    // sounds decoded in an earlier session are kept as the channel count followed by the resampled samples
+    static const QString PCM_ARTIFACT_TYPE = "pcm1:";
+    auto artifactCache = ResourceCache::getArtifactCache();
+    auto artifactKey = ResourceArtifactCache::getArtifactKey(_data, PCM_ARTIFACT_TYPE + fileType);
+    QByteArray artifact;
+    if (artifactCache && artifactCache->readArtifact(artifactKey, artifact) && artifact.size() > (int)sizeof(uint32_t)) {
+        uint32_t numChannels;
+        memcpy(&numChannels, artifact.constData(), sizeof(uint32_t));
+        int numSamples = (artifact.size() - (int)sizeof(uint32_t)) / AudioConstants::SAMPLE_SIZE;
+        emit onSuccess(AudioData::make(numSamples, numChannels,
+                                       (const AudioSample*)(artifact.constData() + sizeof(uint32_t))));
+        return;
+    }
 
     QByteArray outputAudioByteArray;
     AudioProperties properties;
 
-    if (fileName.endsWith(WAV_EXTENSION)) {
-        fileType = "WAV";
+    if (fileType == "WAV") {
         properties = interpretAsWav(_data, outputAudioByteArray);
-    } else if (fileName.endsWith(MP3_EXTENSION)) {
-        fileType = "MP3";
+    } else if (fileType == "MP3") {
         properties = interpretAsMP3(_data, outputAudioByteArray);
-    } else if (fileName.endsWith(STEREO_RAW_EXTENSION)) {
+    } else if (fileType == "STEREO_RAW") {
         // check if this was a stereo raw file
         // since it's raw the only way for us to know that is if the file was called .stereo.raw
         qCDebug(audio) << "Processing sound of" << _data.size() << "bytes from" << fileName << "as stereo audio file.";
@@ -138,15 +164,11 @@ void SoundProcessor::run() {
         properties.numChannels = 2;
         properties.sampleRate = 48000;
         outputAudioByteArray = _data;
-    } else if (fileName.endsWith(RAW_EXTENSION)) {
+    } else {
         // Process as 48khz RAW file
         properties.numChannels = 1;
         properties.sampleRate = 48000;
         outputAudioByteArray = _data;
-    } else {
-        qCWarning(audio) << "Unknown sound file type";
-        emit onError(300, "Failed to load sound file, reason: unknown sound file type");
-        return;
     }
 
     if (properties.sampleRate == 0) {
@@ -157,6 +179,13 @@ void SoundProcessor::run() {
 
     auto data = downSample(outputAudioByteArray, properties);
 
+    if (artifactCache && !data.isEmpty()) {
+        uint32_t numChannels = properties.numChannels;
+        artifact = QByteArray(reinterpret_cast<const char*>(&numChannels), sizeof(uint32_t));
+        artifact.append(data);
+        artifactCache->writeArtifact(artifactKey, artifact);
+    }
+
     int numSamples = data.size() / AudioConstants::SAMPLE_SIZE;
     auto audioData = AudioData::make(numSamples, properties.numChannels,
                                      (const AudioSample*)data.constData());
@@ -333,7 +362,8 @@ SoundProcessor::AudioProperties SoundProcessor::interpretAsWav(const QByteArray&
     return properties;
 }
 
-// returns MP3 sample rate, used for resampling
+// The frames are resampled in blocks as they are decoded, so the whole sound is never held at its own sample rate.
+// Returns AudioConstants::SAMPLE_RATE, the rate of the output, so that downSample leaves it as it is.
 SoundProcessor::AudioProperties SoundProcessor::interpretAsMP3(const QByteArray& inputAudioByteArray,
                                                                QByteArray& outputAudioByteArray) {
     AudioProperties properties;
@@ -345,6 +375,30 @@ SoundProcessor::AudioProperties SoundProcessor::interpretAsMP3(const QByteArray&
     static const int MP3_BUFFER_SIZE = MP3_SAMPLES_MAX * MP3_CHANNELS_MAX * sizeof(int16_t);
     uint8_t mp3Buffer[MP3_BUFFER_SIZE];
 
+    // about a second and a half of audio at 44.1kHz
+    static const int MP3_FRAMES_PER_BLOCK = 64;
+    QByteArray block;
+    int blockFrames = 0;
+    std::unique_ptr<AudioSRC> resampler;
+    auto resampleBlock = [&] {
+        if (block.isEmpty()) {
+            return;
+        }
+        if (!resampler) {
+            outputAudioByteArray.append(block);
+        } else {
+            int numSourceFrames = block.size() / (properties.numChannels * AudioConstants::SAMPLE_SIZE);
+            int maxDestinationBytes = resampler->getMaxOutput(numSourceFrames) * properties.numChannels * AudioConstants::SAMPLE_SIZE;
+            int offset = outputAudioByteArray.size();
+            outputAudioByteArray.resize(offset + maxDestinationBytes);
+            int numDestinationFrames = resampler->render((const int16_t*)block.constData(),
+                                                         (int16_t*)(outputAudioByteArray.data() + offset), numSourceFrames);
+            outputAudioByteArray.resize(offset + numDestinationFrames * properties.numChannels * AudioConstants::SAMPLE_SIZE);
+        }
+        block.clear();
+        blockFrames = 0;
+    };
+
     // create bitstream
     Bit_stream_struc *bitstream = bs_new();
     if (bitstream == nullptr) {
@@ -384,6 +438,10 @@ SoundProcessor::AudioProperties SoundProcessor::interpretAsMP3(const QByteArray&
                 // save header info
                 properties.sampleRate = header->sample_rate;
                 properties.numChannels = header->channels;
+                if (properties.sampleRate != AudioConstants::SAMPLE_RATE) {
+                    resampler.reset(new AudioSRC(properties.sampleRate, AudioConstants::SAMPLE_RATE, properties.numChannels));
+                }
+                block.reserve(MP3_FRAMES_PER_BLOCK * MP3_BUFFER_SIZE);
 
                 // skip Xing header, if present
                 result = mp3tl_skip_xing(decoder, header);
@@ -400,13 +458,19 @@ SoundProcessor::AudioProperties SoundProcessor::interpretAsMP3(const QByteArray&
                     memset(mp3Buffer, 0, len);
                 }
 
-                if (result == MP3TL_ERR_OK || result == MP3TL_ERR_BAD_FRAME) {
-                    outputAudioByteArray.append((char*)mp3Buffer, len);
+                // the resampler keeps the channel count of the first frame
+                if ((result == MP3TL_ERR_OK || result == MP3TL_ERR_BAD_FRAME) && header->channels == properties.numChannels) {
+                    block.append((char*)mp3Buffer, len);
+                    if (++blockFrames == MP3_FRAMES_PER_BLOCK) {
+                        resampleBlock();
+                    }
                 }
             }
         }
     }
 
+    resampleBlock();
+
     // free decoder
     mp3tl_free(decoder);
 
@@ -418,6 +482,7 @@ SoundProcessor::AudioProperties SoundProcessor::interpretAsMP3(const QByteArray&
         return AudioProperties();
     }
 
+    properties.sampleRate = AudioConstants::SAMPLE_RATE;
     return properties;
 }
 
@@ -0,0 +1,45 @@
+//
+//  AudioLimiter_avx2.cpp
+//  libraries/audio/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <stdint.h>
+#include <immintrin.h>
+
+// output = round(input * gain + dither), saturated to 16-bit
+void applyGain_AVX2(const float* input, const float* gain, const float* dither, int16_t* output, int numSamples) {
+
+    int i = 0;
+    for (; i < numSamples - 15; i += 16) {
+
+        // fused, so the result can differ from the other implementations by 1 ulp of the 16-bit output
+        __m256 x0 = _mm256_fmadd_ps(_mm256_loadu_ps(&input[i + 0]), _mm256_loadu_ps(&gain[i + 0]),
+                                    _mm256_loadu_ps(&dither[i + 0]));
+        __m256 x1 = _mm256_fmadd_ps(_mm256_loadu_ps(&input[i + 8]), _mm256_loadu_ps(&gain[i + 8]),
+                                    _mm256_loadu_ps(&dither[i + 8]));
+
+        // packs works within 128-bit lanes, restore the sample order after it
+        __m256i a0 = _mm256_packs_epi32(_mm256_cvtps_epi32(x0), _mm256_cvtps_epi32(x1));
+        a0 = _mm256_permute4x64_epi64(a0, _MM_SHUFFLE(3, 1, 2, 0));
+
+        _mm256_storeu_si256((__m256i*)&output[i], a0);
+    }
+    for (; i < numSamples; i++) {
+
+        __m128 x0 = _mm_add_ss(_mm_mul_ss(_mm_load_ss(&input[i]), _mm_load_ss(&gain[i])), _mm_load_ss(&dither[i]));
+        int32_t a0 = _mm_cvt_ss2si(x0);
+
+        output[i] = (int16_t)(a0 < -32768 ? -32768 : (a0 > 32767 ? 32767 : a0));
+    }
+
+    _mm256_zeroupper();
+}
+
+#endif
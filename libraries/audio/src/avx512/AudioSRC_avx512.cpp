@@ -0,0 +1,292 @@
+//
+//  AudioSRC_avx512.cpp
+//  libraries/audio/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX512F__
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "../AudioSRC.h"
+
+// high/low part of int64_t
+#define LO32(a)   ((uint32_t)(a))
+#define HI32(a)   ((int32_t)((a) >> 32))
+
+// _numTaps is a multiple of 8, so the last pass of a 16-wide loop is either full or half
+static inline __mmask16 tapMask(int j, int numTaps) {
+    return (j + 16 <= numTaps) ? (__mmask16)0xffff : (__mmask16)0x00ff;
+}
+
+int AudioSRC::multirateFilter1_AVX512(const float* input0, float* output0, int inputFrames) {
+    int outputFrames = 0;
+
+    assert(_numTaps % 8 == 0);  // SIMD8
+
+    if (_step == 0) {   // rational
+
+        int32_t i = HI32(_offset);
+
+        while (i < inputFrames) {
+
+            const float* c0 = &_polyphaseFilter[_numTaps * _phase];
+
+            __m512 acc0 = _mm512_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 16) {
+
+                __mmask16 mask = tapMask(j, _numTaps);
+
+                //float coef = c0[j];
+                __m512 coef0 = _mm512_maskz_loadu_ps(mask, &c0[j]);
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input0[i + j]), coef0, acc0);
+            }
+
+            // horizontal sum
+            output0[outputFrames] = _mm512_reduce_add_ps(acc0);
+            outputFrames += 1;
+
+            i += _stepTable[_phase];
+            if (++_phase == _upFactor) {
+                _phase = 0;
+            }
+        }
+        _offset = (int64_t)(i - inputFrames) << 32;
+
+    } else {    // irrational
+
+        while (HI32(_offset) < inputFrames) {
+
+            int32_t i = HI32(_offset);
+            uint32_t f = LO32(_offset);
+
+            uint32_t phase = f >> SRC_FRACBITS;
+            float ftmp = (f & SRC_FRACMASK) * QFRAC_TO_FLOAT;
+
+            const float* c0 = &_polyphaseFilter[_numTaps * (phase + 0)];
+            const float* c1 = &_polyphaseFilter[_numTaps * (phase + 1)];
+
+            __m512 acc0 = _mm512_setzero_ps();
+            __m512 frac = _mm512_set1_ps(ftmp);
+
+            for (int j = 0; j < _numTaps; j += 16) {
+
+                __mmask16 mask = tapMask(j, _numTaps);
+
+                //float coef = c0[j] + frac * (c1[j] - c0[j]);
+                __m512 coef0 = _mm512_maskz_loadu_ps(mask, &c0[j]);
+                __m512 coef1 = _mm512_maskz_loadu_ps(mask, &c1[j]);
+                coef1 = _mm512_sub_ps(coef1, coef0);
+                coef0 = _mm512_fmadd_ps(coef1, frac, coef0);
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input0[i + j]), coef0, acc0);
+            }
+
+            // horizontal sum
+            output0[outputFrames] = _mm512_reduce_add_ps(acc0);
+            outputFrames += 1;
+
+            _offset += _step;
+        }
+        _offset -= (int64_t)inputFrames << 32;
+    }
+    _mm256_zeroupper();
+
+    return outputFrames;
+}
+
+int AudioSRC::multirateFilter2_AVX512(const float* input0, const float* input1, float* output0, float* output1, int inputFrames) {
+    int outputFrames = 0;
+
+    assert(_numTaps % 8 == 0);  // SIMD8
+
+    if (_step == 0) {   // rational
+
+        int32_t i = HI32(_offset);
+
+        while (i < inputFrames) {
+
+            const float* c0 = &_polyphaseFilter[_numTaps * _phase];
+
+            __m512 acc0 = _mm512_setzero_ps();
+            __m512 acc1 = _mm512_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 16) {
+
+                __mmask16 mask = tapMask(j, _numTaps);
+
+                //float coef = c0[j];
+                __m512 coef0 = _mm512_maskz_loadu_ps(mask, &c0[j]);
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input0[i + j]), coef0, acc0);
+                acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input1[i + j]), coef0, acc1);
+            }
+
+            // horizontal sum
+            output0[outputFrames] = _mm512_reduce_add_ps(acc0);
+            output1[outputFrames] = _mm512_reduce_add_ps(acc1);
+            outputFrames += 1;
+
+            i += _stepTable[_phase];
+            if (++_phase == _upFactor) {
+                _phase = 0;
+            }
+        }
+        _offset = (int64_t)(i - inputFrames) << 32;
+
+    } else {    // irrational
+
+        while (HI32(_offset) < inputFrames) {
+
+            int32_t i = HI32(_offset);
+            uint32_t f = LO32(_offset);
+
+            uint32_t phase = f >> SRC_FRACBITS;
+            float ftmp = (f & SRC_FRACMASK) * QFRAC_TO_FLOAT;
+
+            const float* c0 = &_polyphaseFilter[_numTaps * (phase + 0)];
+            const float* c1 = &_polyphaseFilter[_numTaps * (phase + 1)];
+
+            __m512 acc0 = _mm512_setzero_ps();
+            __m512 acc1 = _mm512_setzero_ps();
+            __m512 frac = _mm512_set1_ps(ftmp);
+
+            for (int j = 0; j < _numTaps; j += 16) {
+
+                __mmask16 mask = tapMask(j, _numTaps);
+
+                //float coef = c0[j] + frac * (c1[j] - c0[j]);
+                __m512 coef0 = _mm512_maskz_loadu_ps(mask, &c0[j]);
+                __m512 coef1 = _mm512_maskz_loadu_ps(mask, &c1[j]);
+                coef1 = _mm512_sub_ps(coef1, coef0);
+                coef0 = _mm512_fmadd_ps(coef1, frac, coef0);
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input0[i + j]), coef0, acc0);
+                acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input1[i + j]), coef0, acc1);
+            }
+
+            // horizontal sum
+            output0[outputFrames] = _mm512_reduce_add_ps(acc0);
+            output1[outputFrames] = _mm512_reduce_add_ps(acc1);
+            outputFrames += 1;
+
+            _offset += _step;
+        }
+        _offset -= (int64_t)inputFrames << 32;
+    }
+    _mm256_zeroupper();
+
+    return outputFrames;
+}
+
+int AudioSRC::multirateFilter4_AVX512(const float* input0, const float* input1, const float* input2, const float* input3,
+                                      float* output0, float* output1, float* output2, float* output3, int inputFrames) {
+    int outputFrames = 0;
+
+    assert(_numTaps % 8 == 0);  // SIMD8
+
+    if (_step == 0) {   // rational
+
+        int32_t i = HI32(_offset);
+
+        while (i < inputFrames) {
+
+            const float* c0 = &_polyphaseFilter[_numTaps * _phase];
+
+            __m512 acc0 = _mm512_setzero_ps();
+            __m512 acc1 = _mm512_setzero_ps();
+            __m512 acc2 = _mm512_setzero_ps();
+            __m512 acc3 = _mm512_setzero_ps();
+
+            for (int j = 0; j < _numTaps; j += 16) {
+
+                __mmask16 mask = tapMask(j, _numTaps);
+
+                //float coef = c0[j];
+                __m512 coef0 = _mm512_maskz_loadu_ps(mask, &c0[j]);
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input0[i + j]), coef0, acc0);
+                acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input1[i + j]), coef0, acc1);
+                acc2 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input2[i + j]), coef0, acc2);
+                acc3 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input3[i + j]), coef0, acc3);
+            }
+
+            // horizontal sum
+            output0[outputFrames] = _mm512_reduce_add_ps(acc0);
+            output1[outputFrames] = _mm512_reduce_add_ps(acc1);
+            output2[outputFrames] = _mm512_reduce_add_ps(acc2);
+            output3[outputFrames] = _mm512_reduce_add_ps(acc3);
+            outputFrames += 1;
+
+            i += _stepTable[_phase];
+            if (++_phase == _upFactor) {
+                _phase = 0;
+            }
+        }
+        _offset = (int64_t)(i - inputFrames) << 32;
+
+    } else {    // irrational
+
+        while (HI32(_offset) < inputFrames) {
+
+            int32_t i = HI32(_offset);
+            uint32_t f = LO32(_offset);
+
+            uint32_t phase = f >> SRC_FRACBITS;
+            float ftmp = (f & SRC_FRACMASK) * QFRAC_TO_FLOAT;
+
+            const float* c0 = &_polyphaseFilter[_numTaps * (phase + 0)];
+            const float* c1 = &_polyphaseFilter[_numTaps * (phase + 1)];
+
+            __m512 acc0 = _mm512_setzero_ps();
+            __m512 acc1 = _mm512_setzero_ps();
+            __m512 acc2 = _mm512_setzero_ps();
+            __m512 acc3 = _mm512_setzero_ps();
+            __m512 frac = _mm512_set1_ps(ftmp);
+
+            for (int j = 0; j < _numTaps; j += 16) {
+
+                __mmask16 mask = tapMask(j, _numTaps);
+
+                //float coef = c0[j] + frac * (c1[j] - c0[j]);
+                __m512 coef0 = _mm512_maskz_loadu_ps(mask, &c0[j]);
+                __m512 coef1 = _mm512_maskz_loadu_ps(mask, &c1[j]);
+                coef1 = _mm512_sub_ps(coef1, coef0);
+                coef0 = _mm512_fmadd_ps(coef1, frac, coef0);
+
+                //acc += input[i + j] * coef;
+                acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input0[i + j]), coef0, acc0);
+                acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input1[i + j]), coef0, acc1);
+                acc2 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input2[i + j]), coef0, acc2);
+                acc3 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &input3[i + j]), coef0, acc3);
+            }
+
+            // horizontal sum
+            output0[outputFrames] = _mm512_reduce_add_ps(acc0);
+            output1[outputFrames] = _mm512_reduce_add_ps(acc1);
+            output2[outputFrames] = _mm512_reduce_add_ps(acc2);
+            output3[outputFrames] = _mm512_reduce_add_ps(acc3);
+            outputFrames += 1;
+
+            _offset += _step;
+        }
+        _offset -= (int64_t)inputFrames << 32;
+    }
+    _mm256_zeroupper();
+
+    return outputFrames;
+}
+
+#endif
@@ -764,7 +764,8 @@ protected:
     LoadingStatus _loadingStatus { LoadingStatus::NoModel };
 
     static void metaBlendshapeOperator(render::ItemID renderItemID, int blendshapeNumber, const QVector<BlendshapeOffset>& blendshapeOffsets,
-                                       const QVector<int>& blendedMeshSizes, const render::ItemIDs& subItemIDs);
+                                       const QVector<int>& blendedMeshSizes, const QVector<int>& blendedMeshRanges,
+                                       const render::ItemIDs& subItemIDs);
     
     std::vector<MultiSphereShape> _multiSphereShapes;
     AABox _fitBoundingBox;
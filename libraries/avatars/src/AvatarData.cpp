@@ -59,6 +59,8 @@ static const int HAND_CONTROLLER_COMPRESSION_RADIX = 12;
 static const int SENSOR_TO_WORLD_SCALE_RADIX = 10;
 static const float AUDIO_LOUDNESS_SCALE = 1024.0f;
 static const float DEFAULT_AVATAR_DENSITY = 1000.0f; // density of water
+static const float JOINT_ROTATION_DELTA_RANGE = 0.0625f; // vector part of the delta, about 7 degrees
+static const float JOINT_TRANSLATION_DELTA_RANGE = 0.0635f; // meters, in 0.5mm steps
 
 #define ASSERT(COND)  do { if (!(COND)) { abort(); } } while(0)
 
@@ -72,14 +74,16 @@ size_t AvatarDataPacket::maxJointDataSize(size_t numJoints) {
     size_t totalSize = sizeof(uint8_t); // numJoints
 
     totalSize += validityBitsSize; // Orientations mask
+    totalSize += validityBitsSize; // Orientation deltas mask
     totalSize += numJoints * sizeof(SixByteQuat); // Orientations
     totalSize += validityBitsSize; // Translations mask
+    totalSize += validityBitsSize; // Translation deltas mask
     totalSize += sizeof(float); // maxTranslationDimension
     totalSize += numJoints * sizeof(SixByteTrans); // Translations
     return totalSize;
 }
 
-size_t AvatarDataPacket::minJointDataSize(size_t numJoints) {
+size_t AvatarDataPacket::minJointDataSize(size_t numJoints, bool hasDeltas) {
     const size_t validityBitsSize = calcBitVectorSize((int)numJoints);
 
     size_t totalSize = sizeof(uint8_t); // numJoints
@@ -90,6 +94,10 @@ size_t AvatarDataPacket::minJointDataSize(size_t numJoints) {
     totalSize += sizeof(float); // maxTranslationDimension
     // assume no valid translations
 
+    if (hasDeltas) {
+        totalSize += 2 * validityBitsSize; // Orientation and translation deltas masks
+    }
+
     return totalSize;
 }
 
@@ -687,11 +695,16 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
     assert(numJoints <= 255);
     const int jointBitVectorSize = calcBitVectorSize(numJoints);
 
+    // deltas need the last sent joints to stay in step with what the receiver reconstructs, and are never used when
+    // sending everything, so that SendAllData can serve as a keyframe
+    const bool sendDeltas = _sendJointDeltas && !sendAll && sentJointDataOut;
+
     // include jointData if there is room for the most minimal section. i.e. no translations or rotations.
-    IF_AVATAR_SPACE(PACKET_HAS_JOINT_DATA, AvatarDataPacket::minJointDataSize(numJoints)) {
+    IF_AVATAR_SPACE(PACKET_HAS_JOINT_DATA, AvatarDataPacket::minJointDataSize(numJoints, sendDeltas)) {
         // Minimum space required for another rotation joint -
-        // size of joint + following translation bit-vector + translation scale:
-        const ptrdiff_t minSizeForJoint = sizeof(AvatarDataPacket::SixByteQuat) + jointBitVectorSize + sizeof(float);
+        // size of joint + following translation bit-vector(s) + translation scale:
+        const ptrdiff_t minSizeForJoint = sizeof(AvatarDataPacket::SixByteQuat) + (sendDeltas ? 2 : 1) * jointBitVectorSize
+            + sizeof(float);
 
         auto startSection = destinationBuffer;
 
@@ -719,6 +732,14 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
 
+        unsigned char* deltaPosition = nullptr;
+        if (sendDeltas) {
+            includedFlags |= AvatarDataPacket::PACKET_HAS_JOINT_DELTAS;
+            deltaPosition = destinationBuffer;
+            memset(deltaPosition, 0, jointBitVectorSize);
+            destinationBuffer += jointBitVectorSize; // Move pointer past the delta bytes
+        }
+
         // sentJointDataOut and lastSentJointData might be the same vector
         if (sentJointDataOut) {
             sentJointDataOut->resize(numJoints); // Make sure the destination is resized before using it
@@ -743,10 +764,21 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 #ifdef WANT_DEBUG
                         rotationSentCount++;
 #endif
-                        destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
-
-                        if (sentJoints) {
-                            sentJoints[i].rotation = data.rotation;
+                        int deltaSize = (sendDeltas && !last.rotationIsDefaultPose) ?
+                            packOrientationQuatDeltaToThreeBytes(destinationBuffer, last.rotation, data.rotation,
+                                                                 JOINT_ROTATION_DELTA_RANGE) : 0;
+                        if (deltaSize > 0) {
+                            deltaPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
+                            // remember what the receiver will reconstruct, so that quantization errors don't accumulate
+                            unpackOrientationQuatDeltaFromThreeBytes(destinationBuffer, last.rotation,
+                                                                    sentJoints[i].rotation, JOINT_ROTATION_DELTA_RANGE);
+                            destinationBuffer += deltaSize;
+                        } else {
+                            destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
+
+                            if (sentJoints) {
+                                sentJoints[i].rotation = data.rotation;
+                            }
                         }
                     }
                 }
@@ -772,6 +804,12 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         memset(destinationBuffer, 0, jointBitVectorSize);
         destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
 
+        if (sendDeltas) {
+            deltaPosition = destinationBuffer;
+            memset(deltaPosition, 0, jointBitVectorSize);
+            destinationBuffer += jointBitVectorSize; // Move pointer past the delta bytes
+        }
+
         // write maxTranslationDimension
         AVATAR_MEMCPY(maxTranslationDimension);
 
@@ -791,11 +829,21 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 #ifdef WANT_DEBUG
                         translationSentCount++;
 #endif
-                        destinationBuffer += packFloatVec3ToSignedTwoByteFixed(destinationBuffer, data.translation / maxTranslationDimension,
-                                                                               TRANSLATION_COMPRESSION_RADIX);
-
-                        if (sentJoints) {
-                            sentJoints[i].translation = data.translation;
+                        int deltaSize = (sendDeltas && !last.translationIsDefaultPose) ?
+                            packFloatVec3DeltaToThreeBytes(destinationBuffer, last.translation, data.translation,
+                                                           JOINT_TRANSLATION_DELTA_RANGE) : 0;
+                        if (deltaSize > 0) {
+                            deltaPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
+                            unpackFloatVec3DeltaFromThreeBytes(destinationBuffer, last.translation,
+                                                               sentJoints[i].translation, JOINT_TRANSLATION_DELTA_RANGE);
+                            destinationBuffer += deltaSize;
+                        } else {
+                            destinationBuffer += packFloatVec3ToSignedTwoByteFixed(destinationBuffer, data.translation / maxTranslationDimension,
+                                                                                   TRANSLATION_COMPRESSION_RADIX);
+
+                            if (sentJoints) {
+                                sentJoints[i].translation = data.translation;
+                            }
                         }
                     }
                 }
@@ -955,21 +1003,28 @@ const unsigned char* unpackHandController(const unsigned char* sourceBuffer, Thr
 }
 
 
-#define PACKET_READ_CHECK(ITEM_NAME, SIZE_TO_READ)                                        \
+#define PACKET_READ_CHECK_OR_RETURN(ITEM_NAME, SIZE_TO_READ, RESULT)                      \
     if ((endPosition - sourceBuffer) < (int)SIZE_TO_READ) {                               \
         if (shouldLogError(now)) {                                                        \
             qCWarning(avatars) << "AvatarData packet too small, attempting to read " <<   \
                 #ITEM_NAME << ", only " << (endPosition - sourceBuffer) <<                \
                 " bytes left, " << getSessionUUID();                                      \
         }                                                                                 \
-        return buffer.size();                                                             \
+        return RESULT;                                                                    \
     }
 
+#define PACKET_READ_CHECK(ITEM_NAME, SIZE_TO_READ) PACKET_READ_CHECK_OR_RETURN(ITEM_NAME, SIZE_TO_READ, buffer.size())
+
 // read data in packet starting at byte offset and return number of bytes parsed
 int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     // lazily allocate memory for HeadData in case we're not an Avatar instance
     lazyInitHeadData();
 
+    // the joint deltas of this buffer apply on top of the joints of the previous one
+    if (hasCompressedJointData()) {
+        decompressJointData();
+    }
+
     AvatarDataPacket::HasFlags packetStateFlags;
 
     const unsigned char* startPosition = reinterpret_cast<const unsigned char*>(buffer.data());
@@ -997,6 +1052,7 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     bool hasJointData             = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DATA);
     bool hasJointDefaultPoseFlags = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS);
     bool hasGrabJoints            = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_GRAB_JOINTS);
+    bool hasJointDeltas           = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DELTAS);
 
     quint64 now = usecTimestampNow();
 
@@ -1323,94 +1379,15 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     if (hasJointData) {
         auto startSection = sourceBuffer;
 
-        PACKET_READ_CHECK(NumJoints, sizeof(uint8_t));
-        int numJoints = *sourceBuffer++;
-        const int bytesOfValidity = (int)ceil((float)numJoints / (float)BITS_IN_BYTE);
-        PACKET_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
-
-        int numValidJointRotations = 0;
-        QVector<bool> validRotations;
-        validRotations.resize(numJoints);
-        { // rotation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
-            for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
-                }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointRotations;
-                }
-                validRotations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
-            }
-        }
-
-        // each joint rotation is stored in 6 bytes.
-        QWriteLocker writeLock(&_jointDataLock);
-        _jointData.resize(numJoints);
-
-        const int COMPRESSED_QUATERNION_SIZE = 6;
-        PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
-        for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validRotations[i]) {
-                sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
-                _hasNewJointData = true;
-                data.rotationIsDefaultPose = false;
-            }
+        sourceBuffer = readJointData(sourceBuffer, endPosition, hasJointDeltas, !_deferJointDecompression);
+        if (!sourceBuffer) {
+            return buffer.size();
         }
-
-        PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
-
-        // get translation validity bits -- these indicate which translations were packed
-        int numValidJointTranslations = 0;
-        QVector<bool> validTranslations;
-        validTranslations.resize(numJoints);
-        { // translation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
-            for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
-                }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointTranslations;
-                }
-                validTranslations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
-            }
-        } // 1 + bytesOfValidity bytes
-
-        // read maxTranslationDimension
-        float maxTranslationDimension;
-        PACKET_READ_CHECK(JointMaxTranslationDimension, sizeof(float));
-        memcpy(&maxTranslationDimension, sourceBuffer, sizeof(float));
-        sourceBuffer += sizeof(float);
-
-        // each joint translation component is stored in 6 bytes.
-        const int COMPRESSED_TRANSLATION_SIZE = 6;
-        PACKET_READ_CHECK(JointTranslation, numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE);
-
-        for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validTranslations[i]) {
-                sourceBuffer += unpackFloatVec3FromSignedTwoByteFixed(sourceBuffer, data.translation, TRANSLATION_COMPRESSION_RADIX);
-                data.translation *= maxTranslationDimension;
-                _hasNewJointData = true;
-                data.translationIsDefaultPose = false;
-            }
+        if (_deferJointDecompression) {
+            _compressedJointData = QByteArray((const char*)startSection, (int)(sourceBuffer - startSection));
+            _compressedJointDeltas = hasJointDeltas;
         }
 
-#ifdef WANT_DEBUG
-        if (numValidJointRotations > 15) {
-            qCDebug(avatars) << "RECEIVING -- rotations:" << numValidJointRotations
-                << "translations:" << numValidJointTranslations
-                << "size:" << (int)(sourceBuffer - startPosition);
-        }
-#endif
         int numBytesRead = sourceBuffer - startSection;
         _jointDataRate.increment(numBytesRead);
         _jointDataUpdateRate.increment();
@@ -1459,23 +1436,13 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     if (hasJointDefaultPoseFlags) {
         auto startSection = sourceBuffer;
 
-        QWriteLocker writeLock(&_jointDataLock);
-
-        PACKET_READ_CHECK(JointDefaultPoseFlagsNumJoints, sizeof(uint8_t));
-        int numJoints = (int)*sourceBuffer++;
-
-        _jointData.resize(numJoints);
-
-        size_t bitVectorSize = calcBitVectorSize(numJoints);
-        PACKET_READ_CHECK(JointDefaultPoseFlagsRotationFlags, bitVectorSize);
-        sourceBuffer += readBitVector(sourceBuffer, numJoints, [&](int i, bool value) {
-            _jointData[i].rotationIsDefaultPose = value;
-        });
-
-        PACKET_READ_CHECK(JointDefaultPoseFlagsTranslationFlags, bitVectorSize);
-        sourceBuffer += readBitVector(sourceBuffer, numJoints, [&](int i, bool value) {
-            _jointData[i].translationIsDefaultPose = value;
-        });
+        sourceBuffer = readJointDefaultPoseFlags(sourceBuffer, endPosition, !_deferJointDecompression);
+        if (!sourceBuffer) {
+            return buffer.size();
+        }
+        if (_deferJointDecompression) {
+            _compressedDefaultPoseFlags = QByteArray((const char*)startSection, (int)(sourceBuffer - startSection));
+        }
 
         int numBytesRead = sourceBuffer - startSection;
         _jointDefaultPoseFlagsRate.increment(numBytesRead);
@@ -1491,6 +1458,190 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     return numBytesRead;
 }
 
+#define JOINT_READ_CHECK(ITEM_NAME, SIZE_TO_READ) PACKET_READ_CHECK_OR_RETURN(ITEM_NAME, SIZE_TO_READ, nullptr)
+
+const unsigned char* AvatarData::readJointData(const unsigned char* sourceBuffer, const unsigned char* endPosition,
+                                               bool hasJointDeltas, bool unpack) {
+    quint64 now = usecTimestampNow();
+
+    JOINT_READ_CHECK(NumJoints, sizeof(uint8_t));
+    int numJoints = *sourceBuffer++;
+    const int bytesOfValidity = (int)ceil((float)numJoints / (float)BITS_IN_BYTE);
+
+    // validity bits -- these indicate which joints were packed
+    auto readValidityBits = [&](QVector<bool>& valid) {
+        int numValid = 0;
+        valid.resize(numJoints);
+        unsigned char validity = 0;
+        int validityBit = 0;
+        for (int i = 0; i < numJoints; i++) {
+            if (validityBit == 0) {
+                validity = *sourceBuffer++;
+            }
+            valid[i] = (bool)(validity & (1 << validityBit));
+            numValid += valid[i] ? 1 : 0;
+            validityBit = (validityBit + 1) % BITS_IN_BYTE;
+        }
+        return numValid;
+    };
+
+    // delta bits -- these indicate which of the valid joints were packed as deltas
+    auto readDeltaBits = [&](const QVector<bool>& valid, QVector<bool>& deltas) {
+        int numDeltas = 0;
+        deltas.fill(false, numJoints);
+        if (hasJointDeltas) {
+            for (int i = 0; i < numJoints; i++) {
+                deltas[i] = valid[i] && (sourceBuffer[i / BITS_IN_BYTE] & (1 << (i % BITS_IN_BYTE)));
+                numDeltas += deltas[i] ? 1 : 0;
+            }
+            sourceBuffer += bytesOfValidity;
+        }
+        return numDeltas;
+    };
+
+    JOINT_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
+    QVector<bool> validRotations;
+    int numValidJointRotations = readValidityBits(validRotations);
+
+    QVector<bool> deltaRotations;
+    if (hasJointDeltas) {
+        JOINT_READ_CHECK(JointRotationDeltaBits, bytesOfValidity);
+    }
+    int numDeltaJointRotations = readDeltaBits(validRotations, deltaRotations);
+
+    // each joint rotation is stored in 6 bytes, or 3 bytes if it is a delta.
+    const int COMPRESSED_QUATERNION_SIZE = 6;
+    const int COMPRESSED_DELTA_SIZE = 3;
+    const int rotationsSize = (numValidJointRotations - numDeltaJointRotations) * COMPRESSED_QUATERNION_SIZE
+        + numDeltaJointRotations * COMPRESSED_DELTA_SIZE;
+    JOINT_READ_CHECK(JointRotations, rotationsSize);
+    const unsigned char* rotationsBuffer = sourceBuffer;
+    sourceBuffer += rotationsSize;
+
+    JOINT_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
+    QVector<bool> validTranslations;
+    int numValidJointTranslations = readValidityBits(validTranslations);
+
+    QVector<bool> deltaTranslations;
+    if (hasJointDeltas) {
+        JOINT_READ_CHECK(JointTranslationDeltaBits, bytesOfValidity);
+    }
+    int numDeltaJointTranslations = readDeltaBits(validTranslations, deltaTranslations);
+
+    // read maxTranslationDimension
+    float maxTranslationDimension;
+    JOINT_READ_CHECK(JointMaxTranslationDimension, sizeof(float));
+    memcpy(&maxTranslationDimension, sourceBuffer, sizeof(float));
+    sourceBuffer += sizeof(float);
+
+    // each joint translation component is stored in 6 bytes, or 3 bytes if it is a delta.
+    const int COMPRESSED_TRANSLATION_SIZE = 6;
+    const int translationsSize = (numValidJointTranslations - numDeltaJointTranslations) * COMPRESSED_TRANSLATION_SIZE
+        + numDeltaJointTranslations * COMPRESSED_DELTA_SIZE;
+    JOINT_READ_CHECK(JointTranslation, translationsSize);
+    const unsigned char* translationsBuffer = sourceBuffer;
+    sourceBuffer += translationsSize;
+
+#ifdef WANT_DEBUG
+    if (numValidJointRotations > 15) {
+        qCDebug(avatars) << "RECEIVING -- rotations:" << numValidJointRotations
+            << "translations:" << numValidJointTranslations;
+    }
+#endif
+
+    if (!unpack) {
+        // the joints are unpacked later, by decompressJointData
+        if (numValidJointRotations > 0 || numValidJointTranslations > 0) {
+            _hasNewJointData = true;
+        }
+        return sourceBuffer;
+    }
+
+    QWriteLocker writeLock(&_jointDataLock);
+    _jointData.resize(numJoints);
+
+    for (int i = 0; i < numJoints; i++) {
+        JointData& data = _jointData[i];
+        if (deltaRotations[i]) {
+            // a delta against a default pose (e.g. after a lost keyframe) can't be applied; wait for the next keyframe
+            if (!data.rotationIsDefaultPose) {
+                unpackOrientationQuatDeltaFromThreeBytes(rotationsBuffer, data.rotation, data.rotation, JOINT_ROTATION_DELTA_RANGE);
+                _hasNewJointData = true;
+            }
+            rotationsBuffer += COMPRESSED_DELTA_SIZE;
+        } else if (validRotations[i]) {
+            rotationsBuffer += unpackOrientationQuatFromSixBytes(rotationsBuffer, data.rotation);
+            _hasNewJointData = true;
+            data.rotationIsDefaultPose = false;
+        }
+    }
+
+    for (int i = 0; i < numJoints; i++) {
+        JointData& data = _jointData[i];
+        if (deltaTranslations[i]) {
+            if (!data.translationIsDefaultPose) {
+                unpackFloatVec3DeltaFromThreeBytes(translationsBuffer, data.translation, data.translation,
+                                                   JOINT_TRANSLATION_DELTA_RANGE);
+                _hasNewJointData = true;
+            }
+            translationsBuffer += COMPRESSED_DELTA_SIZE;
+        } else if (validTranslations[i]) {
+            translationsBuffer += unpackFloatVec3FromSignedTwoByteFixed(translationsBuffer, data.translation, TRANSLATION_COMPRESSION_RADIX);
+            data.translation *= maxTranslationDimension;
+            _hasNewJointData = true;
+            data.translationIsDefaultPose = false;
+        }
+    }
+
+    return sourceBuffer;
+}
+
+const unsigned char* AvatarData::readJointDefaultPoseFlags(const unsigned char* sourceBuffer, const unsigned char* endPosition,
+                                                           bool unpack) {
+    quint64 now = usecTimestampNow();
+
+    JOINT_READ_CHECK(JointDefaultPoseFlagsNumJoints, sizeof(uint8_t));
+    int numJoints = (int)*sourceBuffer++;
+
+    size_t bitVectorSize = calcBitVectorSize(numJoints);
+    JOINT_READ_CHECK(JointDefaultPoseFlagsRotationFlags, bitVectorSize);
+    const unsigned char* rotationFlags = sourceBuffer;
+    sourceBuffer += bitVectorSize;
+
+    JOINT_READ_CHECK(JointDefaultPoseFlagsTranslationFlags, bitVectorSize);
+    const unsigned char* translationFlags = sourceBuffer;
+    sourceBuffer += bitVectorSize;
+
+    if (!unpack) {
+        return sourceBuffer;
+    }
+
+    QWriteLocker writeLock(&_jointDataLock);
+    _jointData.resize(numJoints);
+
+    readBitVector(rotationFlags, numJoints, [&](int i, bool value) {
+        _jointData[i].rotationIsDefaultPose = value;
+    });
+    readBitVector(translationFlags, numJoints, [&](int i, bool value) {
+        _jointData[i].translationIsDefaultPose = value;
+    });
+    return sourceBuffer;
+}
+
+void AvatarData::decompressJointData() {
+    // in the order of the buffer, the default pose flags that followed the joints apply to the deltas of the next one
+    if (!_compressedJointData.isEmpty()) {
+        auto start = reinterpret_cast<const unsigned char*>(_compressedJointData.constData());
+        readJointData(start, start + _compressedJointData.size(), _compressedJointDeltas, true);
+        _compressedJointData.clear();
+    }
+    if (!_compressedDefaultPoseFlags.isEmpty()) {
+        auto start = reinterpret_cast<const unsigned char*>(_compressedDefaultPoseFlags.constData());
+        readJointDefaultPoseFlags(start, start + _compressedDefaultPoseFlags.size(), true);
+        _compressedDefaultPoseFlags.clear();
+    }
+}
+
 /**jsdoc
  * <p>The avatar mixer data comprises different types of data, with the data rates of each being tracked in kbps.</p>
  *
@@ -3149,6 +3300,7 @@ void RayToAvatarIntersectionResultFromScriptValue(const QScriptValue& object, Ra
 float AvatarData::_avatarSortCoefficientSize { 8.0f };
 float AvatarData::_avatarSortCoefficientCenter { 0.25f };
 float AvatarData::_avatarSortCoefficientAge { 1.0f };
+bool AvatarData::_sendJointDeltas { false };
 
 /**jsdoc
  * An object with the UUIDs of avatar entities as keys and avatar entity properties objects as values.
@@ -205,10 +205,12 @@ namespace AvatarDataPacket {
     const HasFlags PACKET_HAS_JOINT_DATA               = 1U << 12;
     const HasFlags PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS = 1U << 13;
     const HasFlags PACKET_HAS_GRAB_JOINTS              = 1U << 14;
+    const HasFlags PACKET_HAS_JOINT_DELTAS             = 1U << 15; // only set together with PACKET_HAS_JOINT_DATA
     const size_t AVATAR_HAS_FLAGS_SIZE = 2;
 
     using SixByteQuat = uint8_t[6];
     using SixByteTrans = uint8_t[6];
+    using ThreeByteDelta = int8_t[3];
 
     // NOTE: AvatarDataPackets start with a uint16_t sequence number that is not reflected in the Header structure.
 
@@ -349,9 +351,13 @@ namespace AvatarDataPacket {
         SixByteQuat rightHandControllerRotation;
         SixByteTrans rightHandControllerTranslation;
     };
+
+    If PACKET_HAS_JOINT_DELTAS is set, each validity bit vector is followed by a delta bit vector of the same size.
+    A set delta bit means the joint is sent as a ThreeByteDelta instead: the quantized vector part of the rotation
+    relative to, or the quantized offset from, the joint last received, see packJointRotationDelta() etc.
     */
     size_t maxJointDataSize(size_t numJoints);
-    size_t minJointDataSize(size_t numJoints);
+    size_t minJointDataSize(size_t numJoints, bool hasDeltas = false);
 
     /*
     struct JointDefaultPoseFlags {
@@ -637,6 +643,15 @@ public:
     /// \return number of bytes parsed
     virtual int parseDataFromBuffer(const QByteArray& buffer);
 
+    // When deferred, the parse only copies the compressed joints of the buffer and decompressJointData unpacks them
+    // later, so that the joints of many avatars can be unpacked in parallel.  Set by the AvatarHashMap that owns the
+    // avatar, before its first parse.
+    void setJointDecompressionDeferred(bool deferred) { _deferJointDecompression = deferred; }
+    bool hasCompressedJointData() const { return !_compressedJointData.isEmpty() || !_compressedDefaultPoseFlags.isEmpty(); }
+
+    // unpacks the joints left compressed by the last parse, from any thread as long as only one thread parses the avatar
+    void decompressJointData();
+
     virtual void setCollisionWithOtherAvatarsFlags() {};
 
     // Body Rotation (degrees)
@@ -1484,6 +1499,10 @@ public:
     static float _avatarSortCoefficientCenter;
     static float _avatarSortCoefficientAge;
 
+    // When set, toByteArray() sends the joints that changed as deltas against sentJointDataOut, except for SendAllData
+    // which is sent whole and doubles as the keyframe that recovers from lost deltas. Only set by the avatar mixer.
+    static bool _sendJointDeltas;
+
     bool getIdentityDataChanged() const { return _identityDataChanged; } // has the identity data changed since the last time sendIdentityPacket() was called
     void markIdentityDataChanged() { _identityDataChanged = true; }
 
@@ -1672,6 +1691,13 @@ protected:
     void insertRemovedEntityID(const QUuid entityID);
     void lazyInitHeadData() const;
 
+    // read the joint sections of a buffer, into _jointData when unpack is true, and return the end of the section or
+    // nullptr when the buffer is too small for it
+    const unsigned char* readJointData(const unsigned char* sourceBuffer, const unsigned char* endPosition,
+                                       bool hasJointDeltas, bool unpack);
+    const unsigned char* readJointDefaultPoseFlags(const unsigned char* sourceBuffer, const unsigned char* endPosition,
+                                                   bool unpack);
+
     float getDistanceBasedMinRotationDOT(glm::vec3 viewerPosition) const;
     float getDistanceBasedMinTranslationDistance(glm::vec3 viewerPosition) const;
 
@@ -1718,6 +1744,11 @@ protected:
 
     bool _hasNewJointData { true }; // set in AvatarData, cleared in Avatar
 
+    bool _deferJointDecompression { false };
+    QByteArray _compressedJointData;
+    bool _compressedJointDeltas { false };
+    QByteArray _compressedDefaultPoseFlags;
+
     mutable HeadData* _headData { nullptr };
 
     QUrl _skeletonModelURL;
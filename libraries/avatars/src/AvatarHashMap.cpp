@@ -17,6 +17,7 @@
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
 #include <SharedUtil.h>
+#include <shared/ParallelFor.h>
 
 #include "AvatarLogging.h"
 #include "AvatarTraits.h"
@@ -137,16 +138,27 @@ AvatarHashMap::AvatarHashMap() {
     });
 }
 
+AvatarHashMap::AvatarHashSnapshot AvatarHashMap::getHashSnapshot() const {
+    if (_hashChanged) {
+        // the writers can't change the hash while it is read locked, so the flag can't be raised again between
+        // clearing it and copying the hash
+        QReadLocker locker(&_hashLock);
+        if (_hashChanged.exchange(false)) {
+            std::atomic_store(&_hashSnapshot, std::make_shared<const AvatarHash>(_avatarHash));
+        }
+    }
+    return std::atomic_load(&_hashSnapshot);
+}
+
 QVector<QUuid> AvatarHashMap::getAvatarIdentifiers() {
-    QReadLocker locker(&_hashLock);
-    return _avatarHash.keys().toVector();
+    return getHashSnapshot()->keys().toVector();
 }
 
 QVector<QUuid> AvatarHashMap::getAvatarsInRange(const glm::vec3& position, float rangeMeters) const {
-    auto hashCopy = getHashCopy();
+    auto snapshot = getHashSnapshot();
     QVector<QUuid> avatarsInRange;
     auto rangeMetersSquared = rangeMeters * rangeMeters;
-    for (const AvatarSharedPointer& sharedAvatar : hashCopy) {
+    for (const AvatarSharedPointer& sharedAvatar : *snapshot) {
         glm::vec3 avatarPosition = sharedAvatar->getWorldPosition();
         auto distanceSquared = glm::distance2(avatarPosition, position);
         if (distanceSquared < rangeMetersSquared) {
@@ -157,8 +169,8 @@ QVector<QUuid> AvatarHashMap::getAvatarsInRange(const glm::vec3& position, float
 }
 
 bool AvatarHashMap::isAvatarInRange(const glm::vec3& position, const float range) {
-    auto hashCopy = getHashCopy();
-    foreach(const AvatarSharedPointer& sharedAvatar, hashCopy) {
+    auto snapshot = getHashSnapshot();
+    for (const AvatarSharedPointer& sharedAvatar : *snapshot) {
         glm::vec3 avatarPosition = sharedAvatar->getWorldPosition();
         float distance = glm::distance(avatarPosition, position);
         if (distance < range) {
@@ -168,6 +180,27 @@ bool AvatarHashMap::isAvatarInRange(const glm::vec3& position, const float range
     return false;
 }
 
+void AvatarHashMap::decompressJointData() {
+    std::vector<AvatarSharedPointer> avatars;
+    for (const AvatarSharedPointer& avatar : *getHashSnapshot()) {
+        if (avatar->hasCompressedJointData()) {
+            avatars.push_back(avatar);
+        }
+    }
+    if (avatars.empty()) {
+        return;
+    }
+
+    PROFILE_RANGE_EX(simulation_avatars, "DecompressJoints", 0xff00ff00, (uint64_t)avatars.size());
+    // each avatar is in a single range, and no packet can parse one until they are done since they are handled on this thread
+    const int MIN_AVATARS_PER_THREAD = 8;
+    parallelForRanges((int)avatars.size(), MIN_AVATARS_PER_THREAD, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            avatars[i]->decompressJointData();
+        }
+    });
+}
+
 void AvatarHashMap::setReplicaCount(int count) {
     _replicas.setReplicaCount(count);
     auto avatars = getAvatarIdentifiers();
@@ -184,10 +217,10 @@ void AvatarHashMap::setReplicaCount(int count) {
 }
 
 int AvatarHashMap::numberOfAvatarsInRange(const glm::vec3& position, float rangeMeters) {
-    auto hashCopy = getHashCopy();
+    auto snapshot = getHashSnapshot();
     auto rangeMeters2 = rangeMeters * rangeMeters;
     int count = 0;
-    for (const AvatarSharedPointer& sharedAvatar : hashCopy) {
+    for (const AvatarSharedPointer& sharedAvatar : *snapshot) {
         glm::vec3 avatarPosition = sharedAvatar->getWorldPosition();
         auto distance2 = glm::distance2(avatarPosition, position);
         if (distance2 < rangeMeters2) {
@@ -209,10 +242,12 @@ AvatarSharedPointer AvatarHashMap::addAvatar(const QUuid& sessionUUID, const QWe
     auto avatar = newSharedAvatar(sessionUUID);
     avatar->setSessionUUID(sessionUUID);
     avatar->setOwningAvatarMixer(mixerWeakPointer);
+    avatar->setJointDecompressionDeferred(_deferJointDecompression);
 
     {
         QWriteLocker locker(&_hashLock);
         _avatarHash.insert(sessionUUID, avatar);
+        markHashChanged();
     }
     emit avatarAddedEvent(sessionUUID);
     return avatar;
@@ -428,8 +463,21 @@ void AvatarHashMap::processBulkAvatarTraits(QSharedPointer<ReceivedMessage> mess
 
                 message->readPrimitive(&traitBinarySize);
 
+                // a delta is followed by the version it applies to and by its own size
+                bool isDelta = traitBinarySize == AvatarTraits::DELTA_TRAIT_SIZE;
+                AvatarTraits::TraitVersion deltaBaseVersion = AvatarTraits::NULL_TRAIT_VERSION;
+                if (isDelta) {
+                    if (message->getBytesLeftToRead() < qint64(sizeof(AvatarTraits::TraitVersion) +
+                                                               sizeof(AvatarTraits::TraitWireSize))) {
+                        qWarning() << "Malformed bulk trait packet, bailling";
+                        return;
+                    }
+                    message->readPrimitive(&deltaBaseVersion);
+                    message->readPrimitive(&traitBinarySize);
+                }
+
                 // Trying to read more bytes than available, bail
-                if (traitBinarySize < -1 || message->getBytesLeftToRead() < traitBinarySize) {
+                if (traitBinarySize < (isDelta ? 0 : -1) || message->getBytesLeftToRead() < traitBinarySize) {
                     qWarning() << "Malformed bulk trait packet, bailling";
                     return;
                 }
@@ -439,12 +487,25 @@ void AvatarHashMap::processBulkAvatarTraits(QSharedPointer<ReceivedMessage> mess
                     if (traitBinarySize == AvatarTraits::DELETED_TRAIT_SIZE) {
                         avatar->processDeletedTraitInstance(traitType, traitInstanceID);
                         _replicas.processDeletedTraitInstance(avatarID, traitType, traitInstanceID);
+                        processedInstanceVersion = packetTraitVersion;
                     } else {
                         auto traitData = message->read(traitBinarySize);
-                        avatar->processTraitInstance(traitType, traitInstanceID, traitData);
-                        _replicas.processTraitInstance(avatarID, traitType, traitInstanceID, traitData);
+                        bool isValid = true;
+                        if (isDelta) {
+                            QByteArray deltaData = traitData;
+                            isValid = deltaBaseVersion == processedInstanceVersion &&
+                                AvatarTraits::applyTraitDelta(avatar->packTraitInstance(traitType, traitInstanceID),
+                                                              deltaData, traitData);
+                        }
+                        if (isValid) {
+                            avatar->processTraitInstance(traitType, traitInstanceID, traitData);
+                            _replicas.processTraitInstance(avatarID, traitType, traitInstanceID, traitData);
+                            processedInstanceVersion = packetTraitVersion;
+                        } else {
+                            qCWarning(avatars) << "Dropping a trait delta of" << avatarID << "for version" << deltaBaseVersion
+                                << "which we don't have";
+                        }
                     }
-                    processedInstanceVersion = packetTraitVersion;
                 } else {
                     skipBinaryTrait = true;
                 }
@@ -493,6 +554,9 @@ void AvatarHashMap::removeAvatar(const QUuid& sessionUUID, KillAvatarReason remo
         if (removedAvatar) {
             removedAvatars.push_back(removedAvatar);
         }
+        if (!removedAvatars.empty()) {
+            markHashChanged();
+        }
     }
 
     for (auto& removedAvatar: removedAvatars) {
@@ -524,6 +588,7 @@ void AvatarHashMap::clearOtherAvatars() {
         removedAvatars = _avatarHash.values();
 
         _avatarHash.clear();
+        markHashChanged();
     }
 
     for (auto& av : removedAvatars) {
@@ -17,6 +17,7 @@
 #include <QtCore/QSharedPointer>
 #include <QtCore/QUuid>
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <chrono>
@@ -74,9 +75,15 @@ class AvatarHashMap : public QObject, public Dependency {
     SINGLETON_DEPENDENCY
 
 public:
-    AvatarHash getHashCopy() { QReadLocker lock(&_hashLock); return _avatarHash; }
-    const AvatarHash getHashCopy() const { QReadLocker lock(&_hashLock); return _avatarHash; }
-    int size() { QReadLocker lock(&_hashLock); return _avatarHash.size(); }
+    using AvatarHashSnapshot = std::shared_ptr<const AvatarHash>;
+
+    // The avatars as of the last change to the hash, which any thread can iterate without locking.  The hash is
+    // copied at most once per batch of changes, by the first reader that comes after them.
+    AvatarHashSnapshot getHashSnapshot() const;
+
+    AvatarHash getHashCopy() { return *getHashSnapshot(); }
+    const AvatarHash getHashCopy() const { return *getHashSnapshot(); }
+    int size() { return getHashSnapshot()->size(); }
 
     // Currently, your own avatar will be included as the null avatar id.
     
@@ -124,6 +131,9 @@ public:
 
     virtual void clearOtherAvatars();
 
+    // unpacks the joints that the avatar data packets left compressed, in parallel, on the thread that owns the map
+    void decompressJointData();
+
 signals:
 
     /**jsdoc
@@ -236,14 +246,23 @@ protected:
     
     virtual void handleRemovedAvatar(const AvatarSharedPointer& removedAvatar, KillAvatarReason removalReason = KillAvatarReason::NoReason);
     
+    // called with the _hashLock locked for write whenever _avatarHash is changed
+    void markHashChanged() { _hashChanged = true; }
+
     mutable QReadWriteLock _hashLock;
     AvatarHash _avatarHash;
 
+    // when set, the avatars leave the joints of their data packets compressed until decompressJointData
+    bool _deferJointDecompression { false };
+
     std::unordered_map<QUuid, AvatarTraits::TraitVersions> _processedTraitVersions;
     AvatarReplicas _replicas;
 
 private:
     QUuid _lastOwnerSessionUUID;
+
+    mutable std::atomic<bool> _hashChanged { false };
+    mutable AvatarHashSnapshot _hashSnapshot { std::make_shared<const AvatarHash>() };
 };
 
 #endif // hifi_AvatarHashMap_h
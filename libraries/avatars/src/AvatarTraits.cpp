@@ -11,6 +11,8 @@
 
 #include "AvatarTraits.h"
 
+#include <cstring>
+
 #include <ExtendedIODevice.h>
 
 #include "AvatarData.h"
@@ -132,4 +134,100 @@ namespace AvatarTraits {
         bytesWritten += destination.writePrimitive(DELETED_TRAIT_SIZE);
         return bytesWritten;
     }
+
+    qint64 packVersionedTraitInstanceDelta(TraitType traitType, TraitInstanceID traitInstanceID,
+                                           ExtendedIODevice& destination, TraitVersion traitVersion,
+                                           TraitVersion baseVersion, const QByteArray& delta) {
+        qint64 bytesWritten = 0;
+        bytesWritten += destination.writePrimitive((TraitType)traitType);
+        bytesWritten += destination.writePrimitive((TraitVersion)traitVersion);
+        bytesWritten += destination.write(traitInstanceID.toRfc4122());
+        bytesWritten += destination.writePrimitive(DELTA_TRAIT_SIZE);
+        bytesWritten += destination.writePrimitive((TraitVersion)baseVersion);
+        bytesWritten += destination.writePrimitive((TraitWireSize)delta.size());
+        bytesWritten += destination.write(delta);
+        return bytesWritten;
+    }
+
+    // A delta is the size of the data followed by runs of an offset, a length and the bytes at that offset in the data.
+    // The bytes between the runs are the ones of the base.
+    using DeltaRunValue = uint16_t;
+    const int DELTA_RUN_HEADER_SIZE = 2 * sizeof(DeltaRunValue);
+
+    QByteArray computeTraitDelta(const QByteArray& base, const QByteArray& data) {
+        if (base.isEmpty() || data.size() > MAXIMUM_TRAIT_SIZE) {
+            return QByteArray();
+        }
+
+        QByteArray delta;
+        TraitWireSize dataSize = data.size();
+        delta.append(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+
+        int commonSize = std::min(base.size(), data.size());
+        int i = 0;
+        while (i < data.size()) {
+            if (i < commonSize && base[i] == data[i]) {
+                ++i;
+                continue;
+            }
+
+            // extend the run over the gaps that are shorter than the header of another run
+            int runStart = i;
+            int runEnd = i + 1;
+            int sameCount = 0;
+            for (int j = runEnd; j < data.size() && sameCount <= DELTA_RUN_HEADER_SIZE; ++j) {
+                if (j < commonSize && base[j] == data[j]) {
+                    ++sameCount;
+                } else {
+                    sameCount = 0;
+                    runEnd = j + 1;
+                }
+            }
+
+            DeltaRunValue offset = runStart;
+            DeltaRunValue length = runEnd - runStart;
+            delta.append(reinterpret_cast<const char*>(&offset), sizeof(offset));
+            delta.append(reinterpret_cast<const char*>(&length), sizeof(length));
+            delta.append(data.constData() + runStart, length);
+            if (delta.size() >= data.size()) {
+                return QByteArray();
+            }
+            i = runEnd;
+        }
+        return delta;
+    }
+
+    bool applyTraitDelta(const QByteArray& base, const QByteArray& delta, QByteArray& dataOut) {
+        TraitWireSize dataSize;
+        if (delta.size() < (int)sizeof(dataSize)) {
+            return false;
+        }
+        memcpy(&dataSize, delta.constData(), sizeof(dataSize));
+        if (dataSize < 0) {
+            return false;
+        }
+
+        dataOut = base.left(dataSize);
+        if (dataOut.size() < dataSize) {
+            dataOut.append(QByteArray(dataSize - dataOut.size(), 0));
+        }
+
+        int position = sizeof(dataSize);
+        while (position < delta.size()) {
+            DeltaRunValue offset;
+            DeltaRunValue length;
+            if (delta.size() - position < DELTA_RUN_HEADER_SIZE) {
+                return false;
+            }
+            memcpy(&offset, delta.constData() + position, sizeof(offset));
+            memcpy(&length, delta.constData() + position + sizeof(offset), sizeof(length));
+            position += DELTA_RUN_HEADER_SIZE;
+            if (delta.size() - position < length || offset + length > dataSize) {
+                return false;
+            }
+            memcpy(dataOut.data() + offset, delta.constData() + position, length);
+            position += length;
+        }
+        return true;
+    }
 };
@@ -17,6 +17,7 @@
 #include <array>
 #include <vector>
 
+#include <QtCore/QByteArray>
 #include <QtCore/QUuid>
 
 class ExtendedIODevice;
@@ -55,6 +56,8 @@ namespace AvatarTraits {
 
     using TraitWireSize = int16_t;
     const TraitWireSize DELETED_TRAIT_SIZE = -1;
+    // an instance sent as the changes from a version the receiver has, see packVersionedTraitInstanceDelta
+    const TraitWireSize DELTA_TRAIT_SIZE = -2;
     const TraitWireSize MAXIMUM_TRAIT_SIZE = INT16_MAX;
 
     using TraitMessageSequence = int64_t;
@@ -74,6 +77,18 @@ namespace AvatarTraits {
     qint64 packInstancedTraitDelete(TraitType traitType, TraitInstanceID instanceID, ExtendedIODevice& destination,
                                            TraitVersion traitVersion = NULL_TRAIT_VERSION);
 
+    // Writes an instance as a delta against the base version of it, as DELTA_TRAIT_SIZE followed by the base version and
+    // the size and data of the delta.  The receiver applies it with applyTraitDelta to the base version it has.
+    qint64 packVersionedTraitInstanceDelta(TraitType traitType, TraitInstanceID traitInstanceID,
+                                           ExtendedIODevice& destination, TraitVersion traitVersion,
+                                           TraitVersion baseVersion, const QByteArray& delta);
+
+    // The runs of bytes of the data that differ from the base, or an empty array when the delta wouldn't be smaller
+    // than the data.  The changes to an avatar entity tend to be a few properties of the same size, so most of the
+    // encoded properties are left out.
+    QByteArray computeTraitDelta(const QByteArray& base, const QByteArray& data);
+    bool applyTraitDelta(const QByteArray& base, const QByteArray& delta, QByteArray& dataOut);
+
 };
 
 #endif // hifi_AvatarTraits_h
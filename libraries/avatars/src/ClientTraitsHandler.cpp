@@ -81,6 +81,7 @@ int ClientTraitsHandler::sendChangedTraitsToMixer() {
 
         // we have a mixer to send to, setup our set traits packet
         auto traitsPacketList = NLPacketList::create(PacketType::SetAvatarTraits, QByteArray(), true, true);
+        traitsPacketList->setPriorityWeight(udt::PacketList::LATENCY_SENSITIVE_PRIORITY_WEIGHT);
 
         // bump and write the current trait version to an extended header
         // the trait version is the same for all traits in this packet list
@@ -160,6 +160,19 @@ void TextureBaker::processTexture() {
         return;
     }
 
+    bool bakeUncompressed = _textureType == image::TextureUsage::Type::SKY_TEXTURE || _textureType == image::TextureUsage::Type::AMBIENT_TEXTURE;
+
+    // Every baked variant is processed out of the same decode of the original
+    image::Image sourceImage;
+    if (_compressionEnabled || bakeUncompressed) {
+        sourceImage = image::loadSourceImage(std::move(buffer), _textureURL.toString().toStdString(), image::ColorChannel::NONE,
+                                             ABSOLUTE_MAX_TEXTURE_NUM_PIXELS);
+        if (sourceImage.isNull()) {
+            handleError("Could not process texture " + _textureURL.toString());
+            return;
+        }
+    }
+
     // Compressed KTX
     if (_compressionEnabled) {
         constexpr std::array<gpu::BackendTarget, 2> BACKEND_TARGETS {{
@@ -167,9 +180,8 @@ void TextureBaker::processTexture() {
             gpu::BackendTarget::GLES32
         }};
         for (auto target : BACKEND_TARGETS) {
-            auto processedTexture = image::processImage(buffer, _textureURL.toString().toStdString(), image::ColorChannel::NONE,
-                                                        ABSOLUTE_MAX_TEXTURE_NUM_PIXELS, _textureType, true,
-                                                        target, _abortProcessing);
+            auto processedTexture = image::processImage(image::Image(sourceImage), _textureURL.toString().toStdString(),
+                                                        _textureType, true, target, _abortProcessing);
             if (!processedTexture) {
                 handleError("Could not process texture " + _textureURL.toString());
                 return;
@@ -208,10 +220,9 @@ void TextureBaker::processTexture() {
     }
 
     // Uncompressed KTX
-    if (_textureType == image::TextureUsage::Type::SKY_TEXTURE || _textureType == image::TextureUsage::Type::AMBIENT_TEXTURE) {
-        buffer->reset();
-        auto processedTexture = image::processImage(std::move(buffer), _textureURL.toString().toStdString(), image::ColorChannel::NONE,
-                                                    ABSOLUTE_MAX_TEXTURE_NUM_PIXELS, _textureType, false, gpu::BackendTarget::GL45, _abortProcessing);
+    if (bakeUncompressed) {
+        auto processedTexture = image::processImage(std::move(sourceImage), _textureURL.toString().toStdString(),
+                                                    _textureType, false, gpu::BackendTarget::GL45, _abortProcessing);
         if (!processedTexture) {
             handleError("Could not process texture " + _textureURL.toString());
             return;
@@ -240,8 +251,6 @@ void TextureBaker::processTexture() {
         }
         _outputFiles.push_back(filePath);
         meta.uncompressed = fileName;
-    } else {
-        buffer.reset();
     }
 
     {
@@ -8,7 +8,9 @@
 
 #include "UserInputMapper.h"
 
+#include <algorithm>
 #include <set>
+#include <unordered_map>
 
 #include <QtCore/QThread>
 #include <QtCore/QFile>
@@ -481,16 +483,22 @@ void UserInputMapper::runMappings() {
         endpointEntry.second->reset();
     }
 
+    if (_routesChanged) {
+        _routesChanged = false;
+        compileRoutes(_deviceRoutes, _deviceProgram);
+        compileRoutes(_standardRoutes, _standardProgram);
+    }
+
     if (debugRoutes) {
         qCDebug(controllers) << "Processing device routes";
     }
     // Now process the current values for each level of the stack
-    applyRoutes(_deviceRoutes);
+    applyRoutes(_deviceProgram);
 
     if (debugRoutes) {
         qCDebug(controllers) << "Processing standard routes";
     }
-    applyRoutes(_standardRoutes);
+    applyRoutes(_standardProgram);
 
     InputRecorder* inputRecorder = InputRecorder::getInstance();
     if (inputRecorder->isPlayingback()) {
@@ -513,31 +521,124 @@ void UserInputMapper::runMappings() {
     debugRoutes = false;
 }
 
-// Encapsulate the logic that routes should not be read before they are written
-void UserInputMapper::applyRoutes(const Route::List& routes) {
-    Route::List deferredRoutes;
+bool UserInputMapper::collectLeafEndpoints(const Endpoint::Pointer& endpoint, std::vector<const Endpoint*>& leaves) {
+    if (!endpoint) {
+        return true;
+    }
+    const Endpoint::List* children = nullptr;
+    if (auto anyEndpoint = std::dynamic_pointer_cast<AnyEndpoint>(endpoint)) {
+        children = &anyEndpoint->_children;
+    } else if (auto arrayEndpoint = std::dynamic_pointer_cast<ArrayEndpoint>(endpoint)) {
+        children = &arrayEndpoint->_children;
+    } else if (std::dynamic_pointer_cast<CompositeEndpoint>(endpoint)) {
+        return false;
+    }
 
-    for (const auto& route : routes) {
-        if (!route) {
-            continue;
+    if (!children) {
+        leaves.push_back(endpoint.get());
+        return true;
+    }
+    for (const auto& child : *children) {
+        if (!collectLeafEndpoints(child, leaves)) {
+            return false;
         }
+    }
+    return true;
+}
 
-        // Try all the deferred routes
-        deferredRoutes.remove_if([](Route::Pointer route) {
-            return UserInputMapper::applyRoute(route);
-        });
+void UserInputMapper::compileRoutes(const Route::List& routes, RouteProgram& program) {
+    program = RouteProgram();
+    for (const auto& route : routes) {
+        if (route) {
+            program.routes.push_back(route);
+        }
+    }
+    int numRoutes = (int)program.routes.size();
+    program.waiters.resize(numRoutes);
+    program.hasUnknownSource.resize(numRoutes, false);
+    program.hasUnknownDestination.resize(numRoutes, false);
+    program.isWaiting.resize(numRoutes, false);
+
+    // a route only waits on the routes after it, the earlier ones already wrote what they could
+    std::unordered_map<const Endpoint*, std::vector<int>> readersBySource;
+    std::vector<const Endpoint*> leaves;
+    for (int i = 0; i < numRoutes; ++i) {
+        const auto& route = program.routes[i];
+
+        leaves.clear();
+        program.hasUnknownDestination[i] = !collectLeafEndpoints(route->destination, leaves);
+        auto& waiters = program.waiters[i];
+        for (auto leaf : leaves) {
+            auto readers = readersBySource.find(leaf);
+            if (readers != readersBySource.end()) {
+                waiters.insert(waiters.end(), readers->second.begin(), readers->second.end());
+            }
+        }
+        std::sort(waiters.begin(), waiters.end());
+        waiters.erase(std::unique(waiters.begin(), waiters.end()), waiters.end());
+
+        if (route->source->getInput().device == STANDARD_DEVICE) {
+            leaves.clear();
+            program.hasUnknownSource[i] = !collectLeafEndpoints(route->source, leaves);
+            for (auto leaf : leaves) {
+                readersBySource[leaf].push_back(i);
+            }
+        }
+    }
+}
 
-        if (!applyRoute(route)) {
-            deferredRoutes.push_back(route);
+// Encapsulate the logic that routes should not be read before they are written
+void UserInputMapper::applyRoutes(RouteProgram& program) {
+    int numRoutes = (int)program.routes.size();
+    for (int i = 0; i < numRoutes; ++i) {
+        if (applyRoute(program.routes[i])) {
+            applyWaitingRoutes(program, i);
+        } else {
+            program.isWaiting[i] = true;
+            if (program.hasUnknownSource[i]) {
+                ++program.numWaitingWithUnknownSource;
+            }
         }
     }
 
     bool force = true;
-    for (const auto& route : deferredRoutes) {
-        UserInputMapper::applyRoute(route, force);
+    for (int i = 0; i < numRoutes; ++i) {
+        if (program.isWaiting[i]) {
+            program.isWaiting[i] = false;
+            UserInputMapper::applyRoute(program.routes[i], force);
+        }
     }
+    program.numWaitingWithUnknownSource = 0;
 }
 
+void UserInputMapper::applyWaitingRoutes(RouteProgram& program, int writer) {
+    auto tryWaiting = [&](int i) {
+        if (program.isWaiting[i] && applyRoute(program.routes[i])) {
+            program.isWaiting[i] = false;
+            if (program.hasUnknownSource[i]) {
+                --program.numWaitingWithUnknownSource;
+            }
+            applyWaitingRoutes(program, i);
+        }
+    };
+
+    if (program.hasUnknownDestination[writer]) {
+        for (int i = 0; i < writer; ++i) {
+            tryWaiting(i);
+        }
+        return;
+    }
+    for (int i : program.waiters[writer]) {
+        tryWaiting(i);
+    }
+    if (program.numWaitingWithUnknownSource > 0) {
+        for (int i = 0; i < writer; ++i) {
+            if (program.hasUnknownSource[i]) {
+                tryWaiting(i);
+            }
+        }
+    }
+}
 
 bool UserInputMapper::applyRoute(const Route::Pointer& route, bool force) {
     if (debugRoutes && route->debug) {
@@ -1214,6 +1315,7 @@ void UserInputMapper::enableMapping(const Mapping::Pointer& mapping) {
         return (value->source->getInput().device == STANDARD_DEVICE);
     });
     _deviceRoutes.insert(_deviceRoutes.begin(), deviceRoutes.begin(), deviceRoutes.end());
+    _routesChanged = true;
 
     if (!debuggableRoutes) {
         debuggableRoutes = hasDebuggableRoute(_deviceRoutes) || hasDebuggableRoute(_standardRoutes);
@@ -1230,6 +1332,7 @@ void UserInputMapper::disableMapping(const Mapping::Pointer& mapping) {
     _standardRoutes.remove_if([&](const Route::Pointer& value) {
         return routeSet.count(value) != 0;
     });
+    _routesChanged = true;
 
     if (debuggableRoutes) {
         debuggableRoutes = hasDebuggableRoute(_deviceRoutes) || hasDebuggableRoute(_standardRoutes);
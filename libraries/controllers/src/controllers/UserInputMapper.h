@@ -13,6 +13,7 @@
 #include <glm/glm.hpp>
 
 #include <unordered_set>
+#include <vector>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -157,9 +158,27 @@ namespace controller {
         friend class RouteBuilderProxy;
         friend class MappingBuilderProxy;
 
+        // The routes of a list in the order they are applied, with the routes that wait on each of them.  A route that
+        // reads a standard input before anything wrote it waits until one of the later routes that may write that input
+        // did, rather than being tried again before every route, and the routes still waiting at the end are applied
+        // anyway.
+        struct RouteProgram {
+            std::vector<RoutePointer> routes;
+            // the earlier routes the source of which each route may write
+            std::vector<std::vector<int>> waiters;
+            // the routes through which a source or destination can't be told, that fall back to trying them all
+            std::vector<bool> hasUnknownSource;
+            std::vector<bool> hasUnknownDestination;
+            std::vector<bool> isWaiting;
+            int numWaitingWithUnknownSource { 0 };
+        };
+
         void runMappings();
 
-        static void applyRoutes(const RouteList& route);
+        static bool collectLeafEndpoints(const EndpointPointer& endpoint, std::vector<const Endpoint*>& leaves);
+        static void compileRoutes(const RouteList& routes, RouteProgram& program);
+        static void applyRoutes(RouteProgram& program);
+        static void applyWaitingRoutes(RouteProgram& program, int writer);
         static bool applyRoute(const RoutePointer& route, bool force = false);
         void enableMapping(const MappingPointer& mapping);
         void disableMapping(const MappingPointer& mapping);
@@ -191,6 +210,10 @@ namespace controller {
 
         RouteList _deviceRoutes;
         RouteList _standardRoutes;
+        // compiled from the lists when they changed
+        RouteProgram _deviceProgram;
+        RouteProgram _standardProgram;
+        bool _routesChanged { true };
 
         QSet<QString> _loadedRouteJsonFiles;
 
@@ -418,6 +418,10 @@ void OpenGLDisplayPlugin::uncustomizeContext() {
     _cursorPipeline.reset();
     _hudPipeline.reset();
     _compositeFramebuffer.reset();
+    for (auto& timelineQuery : _timelineQueries) {
+        timelineQuery.reset();
+    }
+    _numTimelineFrames = 0;
 
     withPresentThreadLock([&] {
         _currentFrame.reset();
@@ -697,6 +701,28 @@ void OpenGLDisplayPlugin::present(const std::shared_ptr<RefreshRateController>&
     incrementPresentCount();
 
     if (_currentFrame) {
+        // the frame that was in this slot has its gpu time by now, if it ever comes
+        size_t timelineSlot = _numTimelineFrames % NUM_TIMELINE_QUERIES;
+        auto& timelineQuery = _timelineQueries[timelineSlot];
+        if (!timelineQuery) {
+            timelineQuery = std::make_shared<gpu::Query>([this, timelineSlot](const gpu::Query& query) {
+                _pendingTimelines[timelineSlot].gpuTime = (uint64_t)(query.getGPUElapsedTime() * USECS_PER_MSEC);
+            }, "OpenGLDisplayPlugin::timeline");
+        } else {
+            render([&](gpu::Batch& batch) {
+                batch.getQuery(timelineQuery);
+            });
+            recordTimeline(_pendingTimelines[timelineSlot]);
+        }
+        ++_numTimelineFrames;
+
+        auto& timeline = _pendingTimelines[timelineSlot];
+        timeline = FrameTimeline();
+        timeline.frameIndex = _currentFrame->frameIndex;
+        timeline.simulationStart = _currentFrame->simulationStartTime;
+        timeline.recordStart = _currentFrame->recordStartTime;
+        timeline.recordEnd = _currentFrame->recordEndTime;
+
         auto correction = getViewCorrection();
         getGLBackend()->setCameraCorrection(correction, _prevRenderView);
         _prevRenderView = correction * _currentFrame->view;
@@ -710,7 +736,15 @@ void OpenGLDisplayPlugin::present(const std::shared_ptr<RefreshRateController>&
             });
             // Execute the frame rendering commands
             PROFILE_RANGE_EX(render, "execute", 0xff00ff00, frameId)
+            timeline.executeStart = usecTimestampNow();
+            render([&](gpu::Batch& batch) {
+                batch.beginQuery(timelineQuery);
+            });
             _gpuContext->executeFrame(_currentFrame);
+            render([&](gpu::Batch& batch) {
+                batch.endQuery(timelineQuery);
+            });
+            timeline.executeEnd = usecTimestampNow();
         }
 
         // Write all layers to a local framebuffer
@@ -737,6 +771,7 @@ void OpenGLDisplayPlugin::present(const std::shared_ptr<RefreshRateController>&
         {
             PROFILE_RANGE_EX(render, "internalPresent", 0xff00ffff, frameId)
             internalPresent();
+            timeline.presentEnd = usecTimestampNow();
         }
 
         gpu::Backend::freeGPUMemSize.set(gpu::gl::getFreeDedicatedMemory());
@@ -749,6 +784,46 @@ void OpenGLDisplayPlugin::present(const std::shared_ptr<RefreshRateController>&
     _movingAveragePresent.addSample((float)(usecTimestampNow() - startPresent));
 }
 
+// as many frames as a second of presents at 90 hz
+static const size_t MAX_TIMELINE_FRAMES = 90;
+
+void OpenGLDisplayPlugin::recordTimeline(const FrameTimeline& timeline) {
+    // the stages as durations, for the trace
+    float simulate = timeline.simulationStart ? (float)(timeline.recordStart - timeline.simulationStart) / USECS_PER_MSEC : 0.0f;
+    PROFILE_COUNTER(render, "frameTimeline", {
+        { "simulate", simulate },
+        { "record", (float)(timeline.recordEnd - timeline.recordStart) / USECS_PER_MSEC },
+        { "wait", (float)(timeline.executeStart - timeline.recordEnd) / USECS_PER_MSEC },
+        { "execute", (float)(timeline.executeEnd - timeline.executeStart) / USECS_PER_MSEC },
+        { "gpu", (float)timeline.gpuTime / USECS_PER_MSEC },
+        { "present", (float)(timeline.presentEnd - timeline.executeEnd) / USECS_PER_MSEC }
+    });
+
+    Lock lock(_timelineMutex);
+    _timeline.push_back(timeline);
+    if (_timeline.size() > MAX_TIMELINE_FRAMES) {
+        _timeline.pop_front();
+    }
+}
+
+QVariantList OpenGLDisplayPlugin::getFrameTimeline() const {
+    QVariantList result;
+    Lock lock(_timelineMutex);
+    for (const auto& timeline : _timeline) {
+        QVariantMap frame;
+        frame["frameIndex"] = timeline.frameIndex;
+        frame["simulationStart"] = (quint64)timeline.simulationStart;
+        frame["recordStart"] = (quint64)timeline.recordStart;
+        frame["recordEnd"] = (quint64)timeline.recordEnd;
+        frame["executeStart"] = (quint64)timeline.executeStart;
+        frame["executeEnd"] = (quint64)timeline.executeEnd;
+        frame["presentEnd"] = (quint64)timeline.presentEnd;
+        frame["gpuTime"] = (quint64)timeline.gpuTime;
+        result << frame;
+    }
+    return result;
+}
+
 float OpenGLDisplayPlugin::newFramePresentRate() const {
     return _newFrameRate.rate();
 }
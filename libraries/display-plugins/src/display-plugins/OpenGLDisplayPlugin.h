@@ -9,7 +9,9 @@
 
 #include "DisplayPlugin.h"
 
+#include <array>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <queue>
 
@@ -22,6 +24,7 @@
 #include <shared/RateCounter.h>
 
 #include <gpu/Batch.h>
+#include <gpu/Query.h>
 
 namespace gpu { namespace gl {
 class GLBackend;
@@ -72,6 +75,8 @@ public:
 
     float renderRate() const override;
 
+    QVariantList getFrameTimeline() const override;
+
     bool beginFrameRender(uint32_t frameIndex) override;
 
     virtual bool wantVsync() const { return true; }
@@ -175,6 +180,30 @@ protected:
     std::map<uint16_t, CursorData> _cursorsData;
     bool _lockCurrentTexture{ false };
 
+    // The stages of a presented frame, in usecs. The cpu ones are timestamps, gpuTime is how long the gpu
+    // executed the frame, it stays 0 if the query did not come back in time.
+    struct FrameTimeline {
+        uint32_t frameIndex{ 0 };
+        uint64_t simulationStart{ 0 };
+        uint64_t recordStart{ 0 };
+        uint64_t recordEnd{ 0 };
+        uint64_t executeStart{ 0 };
+        uint64_t executeEnd{ 0 };
+        uint64_t presentEnd{ 0 };
+        uint64_t gpuTime{ 0 };
+    };
+
+    // the gpu times come back a few presents late, the frames wait for them in these slots
+    static const size_t NUM_TIMELINE_QUERIES { 4 };
+    std::array<gpu::QueryPointer, NUM_TIMELINE_QUERIES> _timelineQueries;
+    std::array<FrameTimeline, NUM_TIMELINE_QUERIES> _pendingTimelines;
+    size_t _numTimelineFrames { 0 };
+
+    mutable Mutex _timelineMutex;
+    std::deque<FrameTimeline> _timeline;
+
+    void recordTimeline(const FrameTimeline& timeline);
+
     void assertNotPresentThread() const;
     void assertIsPresentThread() const;
 
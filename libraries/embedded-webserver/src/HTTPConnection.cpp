@@ -12,6 +12,7 @@
 #include "HTTPConnection.h"
 
 #include <assert.h>
+#include <limits>
 
 #include <QBuffer>
 #include <QCryptographicHash>
@@ -32,6 +33,9 @@ const char* HTTPConnection::StatusCode404 = "404 Not Found";
 const char* HTTPConnection::StatusCode500 = "500 Internal server error";
 const char* HTTPConnection::DefaultContentType = "text/plain; charset=ISO-8859-1";
 
+static const int KEEP_ALIVE_TIMEOUT_SECS = 15;
+static const int KEEP_ALIVE_TIMEOUT_MSECS = KEEP_ALIVE_TIMEOUT_SECS * 1000;
+
 
 class MemoryStorage : public HTTPConnection::Storage {
 public:
@@ -127,6 +131,10 @@ HTTPConnection::HTTPConnection(QTcpSocket* socket, HTTPManager* parentManager) :
     connect(socket, SIGNAL(readyRead()), SLOT(readRequest()));
     connect(socket, SIGNAL(error(QAbstractSocket::SocketError)), SLOT(deleteLater()));
     connect(socket, SIGNAL(disconnected()), SLOT(deleteLater()));
+
+    _keepAliveTimer.setSingleShot(true);
+    _keepAliveTimer.setInterval(KEEP_ALIVE_TIMEOUT_MSECS);
+    connect(&_keepAliveTimer, &QTimer::timeout, _socket, &QTcpSocket::disconnectFromHost);
 }
 
 HTTPConnection::~HTTPConnection() {
@@ -218,48 +226,91 @@ QList<FormData> HTTPConnection::parseFormData() const {
 }
 
 void HTTPConnection::respond(const char* code, const QByteArray& content, const char* contentType, const Headers& headers) {
+    // make sure we receive no further read notifications
+    disconnect(_socket, &QTcpSocket::readyRead, this, nullptr);
+
     respondWithStatusAndHeaders(code, contentType, headers, content.size());
 
     _socket->write(content);
 
-    _socket->disconnectFromHost();
+    finishResponse();
+}
 
+void HTTPConnection::respond(const char* code, std::unique_ptr<QIODevice> device, const char* contentType, const Headers& headers) {
     // make sure we receive no further read notifications
     disconnect(_socket, &QTcpSocket::readyRead, this, nullptr);
-}
 
-void HTTPConnection::respond(const char* code, std::unique_ptr<QIODevice> device, const char* contentType, const Headers& headers) {
     _responseDevice = std::move(device);
+    _isResponseDeviceFinished = false;
 
     if (_responseDevice->isSequential()) {
-        qWarning() << "Error responding to HTTPConnection: sequential IO devices not supported";
-        respondWithStatusAndHeaders(StatusCode500, contentType, headers, 0);
-        _socket->disconnect(SIGNAL(readyRead()), this);
-        _socket->disconnectFromHost();
+        // the size isn't known up front, HTTP/1.1 clients get the content in chunks and HTTP/1.0 ones until the
+        // connection closes
+        _isChunkedResponse = !_isHTTP10Request;
+        _keepAlive = _keepAlive && _isChunkedResponse;
+        connect(_responseDevice.get(), &QIODevice::readyRead, this, &HTTPConnection::writeResponseContent);
+        connect(_responseDevice.get(), &QIODevice::readChannelFinished, this, [this] {
+            _isResponseDeviceFinished = true;
+            writeResponseContent();
+        });
+        respondWithStatusAndHeaders(code, contentType, headers, -1);
+    } else {
+        _isChunkedResponse = false;
+        respondWithStatusAndHeaders(code, contentType, headers, _responseDevice->size());
+    }
+
+    connect(_socket, &QTcpSocket::bytesWritten, this, &HTTPConnection::writeResponseContent);
+    writeResponseContent();
+}
+
+void HTTPConnection::writeResponseContent() {
+    if (!_responseDevice) {
         return;
     }
 
-    int totalToBeWritten = _responseDevice->size();
-    respondWithStatusAndHeaders(code, contentType, headers, totalToBeWritten);
+    // only a few chunks are read ahead of the socket, so that a large file is never all in memory
+    static const qint64 HTTP_RESPONSE_CHUNK_SIZE = 64 * 1024;
+    static const qint64 MAX_RESPONSE_BYTES_TO_WRITE = 4 * HTTP_RESPONSE_CHUNK_SIZE;
+    while (_socket->bytesToWrite() < MAX_RESPONSE_BYTES_TO_WRITE) {
+        QByteArray chunk = _responseDevice->read(HTTP_RESPONSE_CHUNK_SIZE);
+        if (chunk.isEmpty()) {
+            break;
+        }
+        if (_isChunkedResponse) {
+            _socket->write(QByteArray::number(chunk.size(), 16) + "\r\n");
+            _socket->write(chunk);
+            _socket->write("\r\n");
+        } else {
+            _socket->write(chunk);
+        }
+    }
 
-    if (_responseDevice->atEnd()) {
-        _socket->disconnectFromHost();
-    } else {
-        connect(_socket, &QTcpSocket::bytesWritten, this, [this, totalToBeWritten](size_t bytes) mutable {
-            constexpr size_t HTTP_RESPONSE_CHUNK_SIZE = 1024 * 10;
-            if (!_responseDevice->atEnd()) {
-                totalToBeWritten -= _socket->write(_responseDevice->read(HTTP_RESPONSE_CHUNK_SIZE));
-                if (_responseDevice->atEnd()) {
-                    _socket->disconnectFromHost();
-                    disconnect(_socket, &QTcpSocket::bytesWritten, this, nullptr);
-                }
-            }
-        });
+    bool isDone = _responseDevice->isSequential() ? _isResponseDeviceFinished && _responseDevice->bytesAvailable() == 0 :
+        _responseDevice->atEnd();
+    if (isDone) {
+        if (_isChunkedResponse) {
+            _socket->write("0\r\n\r\n");
+        }
+        disconnect(_socket, &QTcpSocket::bytesWritten, this, &HTTPConnection::writeResponseContent);
+        _responseDevice->disconnect(this);
+        _responseDevice.reset();
+        finishResponse();
+    }
+}
 
+void HTTPConnection::finishResponse() {
+    if (!_keepAlive) {
+        _socket->disconnectFromHost();
+        return;
     }
 
-    // make sure we receive no further read notifications
-    disconnect(_socket, &QTcpSocket::readyRead, this, nullptr);
+    // the request is kept until the next one starts, the handlers may still read it after they responded
+    _hasResponded = true;
+    _keepAliveTimer.start();
+    connect(_socket, SIGNAL(readyRead()), SLOT(readRequest()), Qt::UniqueConnection);
+
+    // the client may have sent the next request already
+    QTimer::singleShot(0, this, &HTTPConnection::readRequest);
 }
 
 void HTTPConnection::respondWithStatusAndHeaders(const char* code, const char* contentType, const Headers& headers, qint64 contentLength) {
@@ -276,26 +327,46 @@ void HTTPConnection::respondWithStatusAndHeaders(const char* code, const char* c
         _socket->write("\r\n");
     }
 
-    if (contentLength > 0) {
+    // the length is sent even when there is no content, a kept alive connection has no other way to tell the end
+    if (contentLength >= 0) {
         _socket->write("Content-Length: ");
         _socket->write(QByteArray::number(contentLength));
         _socket->write("\r\n");
+    } else if (_isChunkedResponse) {
+        _socket->write("Transfer-Encoding: chunked\r\n");
+    }
 
+    if (contentLength != 0) {
         _socket->write("Content-Type: ");
         _socket->write(contentType);
         _socket->write("\r\n");
     }
-    _socket->write("Connection: close\r\n\r\n");
+
+    if (_keepAlive) {
+        _socket->write("Connection: keep-alive\r\n");
+        _socket->write("Keep-Alive: timeout=" + QByteArray::number(KEEP_ALIVE_TIMEOUT_SECS) + "\r\n\r\n");
+    } else {
+        _socket->write("Connection: close\r\n\r\n");
+    }
 }
 
 void HTTPConnection::readRequest() {
     if (!_socket->canReadLine()) {
         return;
     }
-    if (!_requestUrl.isEmpty()) {
+    if (!_requestUrl.isEmpty() && !_hasResponded) {
         qDebug() << "Request URL was already set";
         return;
     }
+    _hasResponded = false;
+    _keepAliveTimer.stop();
+
+    // forget the previous request of a kept alive connection
+    _requestHeaders.clear();
+    _lastRequestHeader.clear();
+    _requestContent.reset();
+    _keepAlive = false;
+
     // parse out the method and resource
     QByteArray line = _socket->readLine().trimmed();
     if (line.startsWith("HEAD")) {
@@ -320,6 +391,7 @@ void HTTPConnection::readRequest() {
     }
     int idx = line.indexOf(' ') + 1;
     _requestUrl.setUrl(line.mid(idx, line.lastIndexOf(' ') - idx));
+    _isHTTP10Request = line.endsWith("HTTP/1.0");
 
     // switch to reading the header
     _socket->disconnect(this, SLOT(readRequest()));
@@ -336,23 +408,36 @@ void HTTPConnection::readHeaders() {
         if (trimmed.isEmpty()) {
             _socket->disconnect(this, SLOT(readHeaders()));
 
+            QByteArray connectionHeader = requestHeader("Connection").toLower();
+            _keepAlive = _isHTTP10Request ? connectionHeader.contains("keep-alive") : !connectionHeader.contains("close");
+
             QByteArray clength = requestHeader("Content-Length");
             if (clength.isEmpty()) {
                 _parentManager->handleHTTPRequest(this, _requestUrl);
 
             } else {
                 bool success = false;
-                auto length = clength.toInt(&success);
-                if (!success) {
+                auto length = clength.toLongLong(&success);
+                if (!success || length < 0) {
                     qWarning() << "Invalid header." << _address << trimmed;
+                    _keepAlive = false;
                     respond("400 Bad Request", "The header was malformed.");
                     return;
                 }
 
+                // the content is handed to the handlers as a byte array, bigger uploads have to come in parts
+                static const qint64 MAX_CONTENT_SIZE = std::numeric_limits<int>::max();
+                if (length > MAX_CONTENT_SIZE) {
+                    qWarning() << "Request content too large." << _address << length;
+                    _keepAlive = false;
+                    respond("413 Payload Too Large", "The content is too large, upload it in parts.");
+                    return;
+                }
+
                 // Storing big requests in memory gets expensive, especially on servers
                 // with limited memory. So we store big requests in a temporary file on disk
                 // and map it to faster read/write access.
-                static const int MAX_CONTENT_SIZE_IN_MEMORY = 10 * 1000 * 1000;
+                static const qint64 MAX_CONTENT_SIZE_IN_MEMORY = 10 * 1000 * 1000;
                 if (length < MAX_CONTENT_SIZE_IN_MEMORY) {
                     _requestContent = MemoryStorage::make(length);
                 } else {
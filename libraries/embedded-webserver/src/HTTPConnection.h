@@ -24,6 +24,7 @@
 #include <QObject>
 #include <QPair>
 #include <QTemporaryFile>
+#include <QTimer>
 #include <QUrl>
 
 #include <memory>
@@ -39,7 +40,8 @@ typedef QHash<QByteArray, QByteArray> Headers;
 /// A form data element
 typedef QPair<Headers, QByteArray> FormData;
 
-/// Handles a single HTTP connection.
+/// Handles a single HTTP connection. HTTP/1.1 connections are kept alive for the requests that follow, unless
+/// the client asks to close them.
 class HTTPConnection : public QObject {
    Q_OBJECT
 
@@ -97,10 +99,13 @@ public:
     /// Duplicate keys are not supported.
     QHash<QString, QString> parseUrlEncodedForm();
 
-    /// Sends a response and closes the connection.
+    /// Sends a response, then closes the connection or waits for the next request on it.
     void respond(const char* code, const QByteArray& content = QByteArray(),
         const char* contentType = DefaultContentType,
         const Headers& headers = Headers());
+
+    /// Streams the content of the device in the response, reading it only as fast as the socket sends it.
+    /// The content of a sequential device is sent in chunks until the device finishes its read channel.
     void respond(const char* code, std::unique_ptr<QIODevice> device,
         const char* contentType = DefaultContentType,
         const Headers& headers = Headers());
@@ -116,9 +121,16 @@ protected slots:
     /// Reads the content.
     void readContent();
 
+    /// Writes the content of the response device while the socket has room for it.
+    void writeResponseContent();
+
 protected:
+    /// A negative size sends the content in chunks, or until the connection closes for an HTTP/1.0 client.
     void respondWithStatusAndHeaders(const char* code, const char* contentType, const Headers& headers, qint64 size);
 
+    /// Called once the whole response was written, closes the connection or waits for the next request.
+    void finishResponse();
+
     /// The parent HTTP manager
     HTTPManager* _parentManager;
 
@@ -134,6 +146,9 @@ protected:
     /// The requested URL.
     QUrl _requestUrl;
 
+    /// Whether the request uses HTTP/1.0, which doesn't know about chunks.
+    bool _isHTTP10Request { false };
+
     /// The request headers.
     Headers _requestHeaders;
 
@@ -145,6 +160,21 @@ protected:
 
     /// Response content
     std::unique_ptr<QIODevice> _responseDevice;
+
+    /// Whether the response content is sent in chunks, because the size of the device isn't known.
+    bool _isChunkedResponse { false };
+
+    /// Whether the sequential response device finished its read channel.
+    bool _isResponseDeviceFinished { false };
+
+    /// Whether the connection waits for another request once the response is written.
+    bool _keepAlive { false };
+
+    /// Whether the response to the request was written, and the connection waits for the next one.
+    bool _hasResponded { false };
+
+    /// Closes the connections that are kept alive but don't send another request.
+    QTimer _keepAliveTimer;
 };
 
 #endif // hifi_HTTPConnection_h
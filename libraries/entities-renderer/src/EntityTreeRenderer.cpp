@@ -18,6 +18,7 @@
 #include <QScriptSyntaxCheckResult>
 #include <QThreadPool>
 
+#include <shared/FrameBudget.h>
 #include <shared/QtHelpers.h>
 #include <AbstractScriptingServicesInterface.h>
 #include <AbstractViewStateInterface.h>
@@ -245,16 +246,18 @@ void EntityTreeRenderer::clearDomainAndNonOwnedEntities() {
     // remove all entities from the scene
     auto scene = _viewState->getMain3DScene();
     if (scene) {
+        render::Transaction transaction;
         for (const auto& entry :  _entitiesInScene) {
             const auto& renderer = entry.second;
             const EntityItemPointer& entityItem = renderer->getEntity();
             if (!(entityItem->isLocalEntity() || entityItem->isMyAvatarEntity())) {
-                fadeOutRenderable(renderer);
+                fadeOutRenderable(renderer, transaction);
             } else {
                 savedEntities[entry.first] = entry.second;
                 savedRenderables.insert(entry.second);
             }
         }
+        scene->enqueueTransaction(transaction);
     }
 
     _renderablesToUpdate = savedRenderables;
@@ -292,10 +295,12 @@ void EntityTreeRenderer::clear() {
             resetEntitiesScriptEngine();
         }
         if (scene) {
+            render::Transaction transaction;
             for (const auto& entry :  _entitiesInScene) {
                 const auto& renderer = entry.second;
-                fadeOutRenderable(renderer);
+                fadeOutRenderable(renderer, transaction);
             }
+            scene->enqueueTransaction(transaction);
         } else {
             qCWarning(entitiesrenderer) << "EntitityTreeRenderer::clear(), Unexpected null scene";
         }
@@ -349,7 +354,7 @@ void EntityTreeRenderer::shutdown() {
     clear(); // always clear() on shutdown
 }
 
-void EntityTreeRenderer::addPendingEntities(const render::ScenePointer& scene, render::Transaction& transaction) {
+size_t EntityTreeRenderer::addPendingEntities(const render::ScenePointer& scene, render::Transaction& transaction) {
     PROFILE_RANGE_EX(simulation_physics, "AddToScene", 0xffff00ff, (uint64_t)_entitiesToAdd.size());
     PerformanceTimer pt("add");
     // Clear any expired entities
@@ -363,49 +368,73 @@ void EntityTreeRenderer::addPendingEntities(const render::ScenePointer& scene, r
         }
     }
 
-    if (!_entitiesToAdd.empty()) {
-        std::unordered_set<EntityItemID> processedIds;
-        for (const auto& entry : _entitiesToAdd) {
-            auto entity = entry.second.lock();
-            if (!entity) {
-                continue;
-            }
+    if (_entitiesToAdd.empty()) {
+        return 0;
+    }
 
-            // Path to the parent transforms is not valid,
-            // don't add to the scene graph yet
-            if (!entity->isParentPathComplete()) {
-                continue;
-            }
-            if (entity->getSpaceIndex() == -1) {
+    // The entities whose path to the parent transforms is valid, the others aren't added to the scene graph yet.
+    // They are grouped by type so that the renderers of a type are made one after the other.
+    std::vector<EntityItemPointer> readyEntities;
+    readyEntities.reserve(_entitiesToAdd.size());
+    for (const auto& entry : _entitiesToAdd) {
+        auto entity = entry.second.lock();
+        if (entity && entity->isParentPathComplete()) {
+            readyEntities.push_back(entity);
+        }
+    }
+    std::stable_sort(readyEntities.begin(), readyEntities.end(), [](const EntityItemPointer& a, const EntityItemPointer& b) {
+        return a->getType() < b->getType();
+    });
+
+    // the entities that don't fit in the frame are added during the next ones
+    auto frameBudget = DependencyManager::get<FrameBudget>();
+    workload::Transaction spaceTransaction;
+    bool hasSpaceResets = false;
+    std::unordered_set<EntityItemID> processedIds;
+    for (size_t i = 0; i < readyEntities.size(); ++i) {
+        if (frameBudget && i > 0 && !frameBudget->hasTime()) {
+            frameBudget->countDeferred(FrameBudget::ENTITY_ADD, (int)(readyEntities.size() - i));
+            break;
+        }
+
+        const auto& entity = readyEntities[i];
+        if (entity->getSpaceIndex() == -1) {
+            workload::ProxyID spaceIndex;
+            {
                 std::unique_lock<std::mutex> lock(_spaceLock);
-                auto spaceIndex = _space->allocateID();
-                workload::Sphere sphere(entity->getWorldPosition(), entity->getBoundingRadius());
-                workload::Transaction transaction;
-                SpatiallyNestablePointer nestable = std::static_pointer_cast<SpatiallyNestable>(entity);
-                transaction.reset(spaceIndex, sphere, workload::Owner(nestable));
-                _space->enqueueTransaction(transaction);
-                entity->setSpaceIndex(spaceIndex);
-                connect(entity.get(), &EntityItem::spaceUpdate, this, &EntityTreeRenderer::handleSpaceUpdate, Qt::QueuedConnection);
+                spaceIndex = _space->allocateID();
             }
+            workload::Sphere sphere(entity->getWorldPosition(), entity->getBoundingRadius());
+            SpatiallyNestablePointer nestable = std::static_pointer_cast<SpatiallyNestable>(entity);
+            spaceTransaction.reset(spaceIndex, sphere, workload::Owner(nestable));
+            hasSpaceResets = true;
+            entity->setSpaceIndex(spaceIndex);
+            connect(entity.get(), &EntityItem::spaceUpdate, this, &EntityTreeRenderer::handleSpaceUpdate, Qt::QueuedConnection);
+        }
 
-            auto entityID = entity->getEntityItemID();
-            auto renderable = EntityRenderer::addToScene(*this, entity, scene, transaction);
-            if (renderable) {
-                _entitiesInScene.insert({ entityID, renderable });
-                processedIds.insert(entityID);
-            }
+        auto entityID = entity->getEntityItemID();
+        auto renderable = EntityRenderer::addToScene(*this, entity, scene, transaction);
+        if (renderable) {
+            _entitiesInScene.insert({ entityID, renderable });
+            processedIds.insert(entityID);
         }
+    }
 
-        if (!processedIds.empty()) {
-            for (const auto& processedId : processedIds) {
-                _entitiesToAdd.erase(processedId);
-            }
-            forceRecheckEntities();
+    if (hasSpaceResets) {
+        std::unique_lock<std::mutex> lock(_spaceLock);
+        _space->enqueueTransaction(std::move(spaceTransaction));
+    }
+
+    if (!processedIds.empty()) {
+        for (const auto& processedId : processedIds) {
+            _entitiesToAdd.erase(processedId);
         }
+        forceRecheckEntities();
     }
+    return processedIds.size();
 }
 
-void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene, render::Transaction& transaction) {
+size_t EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene, render::Transaction& transaction) {
     PROFILE_RANGE_EX(simulation_physics, "ChangeInScene", 0xffff00ff, (uint64_t)_changedEntities.size());
     PerformanceTimer pt("change");
     std::unordered_set<EntityItemID> changedEntities;
@@ -424,6 +453,7 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
         }
     }
 
+    size_t numUpdated = 0;
     float expectedUpdateCost = _avgRenderableUpdateCost * _renderablesToUpdate.size();
     if (expectedUpdateCost < MAX_UPDATE_RENDERABLES_TIME_BUDGET) {
         // we expect to update all renderables within available time budget
@@ -433,7 +463,8 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
             assert(renderable); // only valid renderables are added to _renderablesToUpdate
             renderable->updateInScene(scene, transaction);
         }
-        size_t numRenderables = _renderablesToUpdate.size() + 1; // add one to avoid divide by zero
+        numUpdated = _renderablesToUpdate.size();
+        size_t numRenderables = numUpdated + 1; // add one to avoid divide by zero
         _renderablesToUpdate.clear();
 
         // compute average per-renderable update cost
@@ -494,12 +525,13 @@ void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene
             }
 
             // compute average per-renderable update cost
-            size_t numUpdated = sortedRenderables.size() - _renderablesToUpdate.size() + 1; // add one to avoid divide by zero
-            float cost = (float)(usecTimestampNow() - updateStart) / (float)(numUpdated);
+            numUpdated = sortedRenderables.size() - _renderablesToUpdate.size();
+            float cost = (float)(usecTimestampNow() - updateStart) / (float)(numUpdated + 1); // add one to avoid divide by zero
             const float BLEND = 0.1f;
             _avgRenderableUpdateCost = (1.0f - BLEND) * _avgRenderableUpdateCost + BLEND * cost;
         }
     }
+    return numUpdated;
 }
 
 void EntityTreeRenderer::preUpdate() {
@@ -525,11 +557,12 @@ void EntityTreeRenderer::update(bool simulate) {
             PerformanceTimer sceneTimer("scene");
             auto scene = _viewState->getMain3DScene();
             if (scene) {
+                // all of the renderables added and updated in the frame go to the scene in one transaction
                 render::Transaction transaction;
-                addPendingEntities(scene, transaction);
-
-                updateChangedEntities(scene, transaction);
-                scene->enqueueTransaction(transaction);
+                auto numAdded = addPendingEntities(scene, transaction);
+                auto numUpdated = updateChangedEntities(scene, transaction);
+                scene->enqueueTransaction(std::move(transaction));
+                PROFILE_COUNTER(simulation_physics, "renderables", { { "added", (quint64)numAdded }, { "updated", (quint64)numUpdated } });
             }
         }
         {
@@ -1024,7 +1057,9 @@ void EntityTreeRenderer::deletingEntity(const EntityItemID& entityID) {
 
     forceRecheckEntities(); // reset our state to force checking our inside/outsideness of entities
 
-    fadeOutRenderable(renderable);
+    render::Transaction transaction;
+    fadeOutRenderable(renderable, transaction);
+    scene->enqueueTransaction(transaction);
 }
 
 void EntityTreeRenderer::addingEntity(const EntityItemID& entityID) {
@@ -1068,8 +1103,7 @@ void EntityTreeRenderer::checkAndCallPreload(const EntityItemID& entityID, bool
     }
 }
 
-void EntityTreeRenderer::fadeOutRenderable(const EntityRendererPointer& renderable) {
-    render::Transaction transaction;
+void EntityTreeRenderer::fadeOutRenderable(const EntityRendererPointer& renderable, render::Transaction& transaction) {
     auto scene = _viewState->getMain3DScene();
 
     EntityRendererWeakPointer weakRenderable = renderable;
@@ -1081,8 +1115,6 @@ void EntityTreeRenderer::fadeOutRenderable(const EntityRendererPointer& renderab
             scene->enqueueTransaction(transaction);
         }
     });
-
-    scene->enqueueTransaction(transaction);
 }
 
 void EntityTreeRenderer::playEntityCollisionSound(const EntityItemPointer& entity, const Collision& collision) {
@@ -1144,6 +1176,21 @@ void EntityTreeRenderer::entityCollisionWithEntity(const EntityItemID& idA, cons
         return;
     }
 
+    // the scripts get the collisions that don't fit in the frame during the next ones
+    auto frameBudget = DependencyManager::get<FrameBudget>();
+    if (frameBudget && !frameBudget->hasTime()) {
+        frameBudget->defer(FrameBudget::SCRIPT_EVENT, this, [this, idA, idB, collision] {
+            if (_tree && !_shuttingDown) {
+                dispatchCollisionWithEntity(idA, idB, collision);
+            }
+        });
+        return;
+    }
+    dispatchCollisionWithEntity(idA, idB, collision);
+}
+
+void EntityTreeRenderer::dispatchCollisionWithEntity(const EntityItemID& idA, const EntityItemID& idB,
+                                                     const Collision& collision) {
     EntityTreePointer entityTree = std::static_pointer_cast<EntityTree>(_tree);
     const QUuid& myNodeID = DependencyManager::get<NodeList>()->getSessionUUID();
 
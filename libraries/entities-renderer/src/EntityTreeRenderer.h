@@ -95,7 +95,7 @@ public:
     /// reloads the entity scripts, calling unload and preload
     void reloadEntityScripts();
 
-    void fadeOutRenderable(const EntityRendererPointer& renderable);
+    void fadeOutRenderable(const EntityRendererPointer& renderable, render::Transaction& transaction);
 
     // event handles which may generate entity related events
     QUuid mousePressEvent(QMouseEvent* event);
@@ -165,8 +165,9 @@ protected:
     }
 
 private:
-    void addPendingEntities(const render::ScenePointer& scene, render::Transaction& transaction);
-    void updateChangedEntities(const render::ScenePointer& scene, render::Transaction& transaction);
+    // both return how many renderables they added or updated
+    size_t addPendingEntities(const render::ScenePointer& scene, render::Transaction& transaction);
+    size_t updateChangedEntities(const render::ScenePointer& scene, render::Transaction& transaction);
     EntityRendererPointer renderableForEntity(const EntityItemPointer& entity) const { return renderableForEntityId(entity->getID()); }
     render::ItemID renderableIdForEntity(const EntityItemPointer& entity) const { return renderableIdForEntityId(entity->getID()); }
 
@@ -196,6 +197,7 @@ private:
     ScriptEnginePointer _entitiesScriptEngine;
 
     void playEntityCollisionSound(const EntityItemPointer& entity, const Collision& collision);
+    void dispatchCollisionWithEntity(const EntityItemID& idA, const EntityItemID& idB, const Collision& collision);
 
     bool _lastPointerEventValid;
     PointerEvent _lastPointerEvent;
@@ -328,14 +328,19 @@ void EntityRenderer::updateInScene(const ScenePointer& scene, Transaction& trans
     }
 
     doRenderUpdateSynchronous(scene, transaction, _entity);
-    transaction.updateItem<PayloadProxyInterface>(_renderItemID, [this](PayloadProxyInterface& self) {
+    auto renderUpdate = [this](PayloadProxyInterface& self) {
         if (!isValidRenderItem()) {
             return;
         }
         // Happens on the render thread.  Classes should use
         doRenderUpdateAsynchronous(_entity);
         _renderUpdateQueued = false;
-    });
+    };
+    if (isRenderUpdateConcurrent()) {
+        transaction.updateItemConcurrently<PayloadProxyInterface>(_renderItemID, renderUpdate);
+    } else {
+        transaction.updateItem<PayloadProxyInterface>(_renderItemID, renderUpdate);
+    }
 }
 
 //
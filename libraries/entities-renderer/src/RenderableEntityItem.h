@@ -97,6 +97,10 @@ protected:
     
     virtual void doRenderUpdateAsynchronous(const EntityItemPointer& entity) { }
 
+    // Returns true if doRenderUpdateAsynchronous only touches this renderer and reads the entity, so that the scene
+    // can run it alongside the ones of the other renderers on worker threads while the render thread waits
+    virtual bool isRenderUpdateConcurrent() const { return false; }
+
     // Called by the `render` method after `needsRenderUpdate`
     virtual void doRender(RenderArgs* args) = 0;
 
@@ -27,6 +27,7 @@ public:
 
 protected:
     virtual void doRenderUpdateAsynchronousTyped(const TypedEntityPointer& entity) override;
+    virtual bool isRenderUpdateConcurrent() const override { return true; }
 
     virtual ItemKey getKey() override;
     virtual Item::Bound getBound() override;
@@ -20,6 +20,10 @@ using namespace render;
 using namespace render::entities;
 
 static uint8_t CUSTOM_PIPELINE_NUMBER = 0;
+
+// the effects whose bound is smaller than this fraction of their distance emit fewer particles
+static const float FULL_DETAIL_SIZE_TO_DISTANCE_RATIO = 0.5f;
+static const float MIN_PARTICLE_LOD_SCALE = 0.1f;
 static gpu::Stream::FormatPointer _vertexFormat;
 static std::weak_ptr<gpu::Pipeline> _texturedPipeline;
 
@@ -367,7 +371,16 @@ ParticleEffectEntityRenderer::CpuParticle ParticleEffectEntityRenderer::createPa
     return particle;
 }
 
-void ParticleEffectEntityRenderer::stepSimulation() {
+float ParticleEffectEntityRenderer::computeLODScale(const ViewFrustum& viewFrustum) const {
+    float distance = glm::distance(viewFrustum.getPosition(), _bound.calcCenter());
+    float size = glm::length(_bound.getScale());
+    if (distance <= size) {
+        return 1.0f;
+    }
+    return glm::clamp(size / (FULL_DETAIL_SIZE_TO_DISTANCE_RATIO * distance), MIN_PARTICLE_LOD_SCALE, 1.0f);
+}
+
+void ParticleEffectEntityRenderer::stepSimulation(float lodScale) {
     if (_lastSimulated == 0) {
         _lastSimulated = usecTimestampNow();
         return;
@@ -390,14 +403,17 @@ void ParticleEffectEntityRenderer::stepSimulation() {
     if (_emitting && particleProperties.emitting() &&
         (shapeType != SHAPE_TYPE_COMPOUND || (geometryResource && geometryResource->isLoaded()))) {
         uint64_t emitInterval = particleProperties.emitIntervalUsecs();
+        size_t maxEmittedParticles = std::max<size_t>(1, (size_t)(lodScale * particleProperties.maxParticles));
         if (emitInterval > 0 && interval >= _timeUntilNextEmit) {
             auto timeRemaining = interval;
             while (timeRemaining > _timeUntilNextEmit) {
                 if (_shapeType == SHAPE_TYPE_COMPOUND && !_hasComputedTriangles) {
                     computeTriangles(geometryResource->getHFMModel());
                 }
-                // emit particle
-                _cpuParticles.push_back(createParticle(now, modelTransform, particleProperties, shapeType, geometryResource, _triangleInfo));
+                // emit particle, unless the ones alive are already enough for the size of the effect on screen
+                if (_cpuParticles.size() < maxEmittedParticles) {
+                    _cpuParticles.push_back(createParticle(now, modelTransform, particleProperties, shapeType, geometryResource, _triangleInfo));
+                }
                 _timeUntilNextEmit = emitInterval;
                 if (emitInterval < timeRemaining) {
                     timeRemaining -= emitInterval;
@@ -450,7 +466,7 @@ void ParticleEffectEntityRenderer::doRender(RenderArgs* args) {
     }
 
     // FIXME migrate simulation to a compute stage
-    stepSimulation();
+    stepSimulation(computeLODScale(args->getViewFrustum()));
 
     gpu::Batch& batch = *args->_batch;
     batch.setResourceTexture(0, _networkTexture->getGPUTexture());
@@ -91,7 +91,10 @@ private:
     static CpuParticle createParticle(uint64_t now, const Transform& baseTransform, const particle::Properties& particleProperties,
                                       const ShapeType& shapeType, const ModelResource::Pointer& geometryResource,
                                       const TriangleInfo& triangleInfo);
-    void stepSimulation();
+    // lodScale is the fraction of the max particles that can be emitted
+    void stepSimulation(float lodScale);
+    // less than 1 when the effect is small on screen
+    float computeLODScale(const ViewFrustum& viewFrustum) const;
 
     particle::Properties _particleProperties;
     bool _prevEmitterShouldTrail;
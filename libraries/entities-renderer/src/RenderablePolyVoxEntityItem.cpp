@@ -76,6 +76,9 @@
 
 const float MARCHING_CUBE_COLLISION_HULL_OFFSET = 0.5;
 
+// the size of the chunks of _volData whose surfaces are extracted separately, in voxels
+const int MESH_CHUNK_SIZE = 16;
+
 /*
   A PolyVoxEntity has several interdependent parts:
 
@@ -225,6 +228,7 @@ void RenderablePolyVoxEntityItem::setVoxelSurfaceStyle(PolyVoxSurfaceStyle voxel
             volSizeChanged = true;
         }
         _voxelSurfaceStyle = voxelSurfaceStyle;
+        _allChunksDirty = true;
         startUpdates();
     });
 
@@ -938,6 +942,7 @@ void RenderablePolyVoxEntityItem::setVoxelVolumeSize(const glm::vec3& voxelVolum
         }
 
         _volData.reset(new PolyVox::SimpleVolume<uint8_t>(PolyVox::Region(lowCorner, highCorner)));
+        _allChunksDirty = true;
         // having the "outside of voxel-space" value be 255 has helped me notice some problems.
         _volData->setBorderValue(255);
     });
@@ -992,6 +997,7 @@ uint8_t RenderablePolyVoxEntityItem::getVoxelInternal(const ivec3& v) const {
 
 void RenderablePolyVoxEntityItem::setVoxelMarkNeighbors(int x, int y, int z, uint8_t toValue) {
     _volData->setVoxelAt(x, y, z, toValue);
+    markChunksDirty(x, y, z);
     if (x == 0) {
         _neighborXNeedsUpdate = true;
         startUpdates();
@@ -1244,6 +1250,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            markChunksDirty(x, y, z);
                             _volDataDirty = true;
                         }
                     }
@@ -1264,6 +1271,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            markChunksDirty(x, y, z);
                             _volDataDirty = true;
                         }
                     }
@@ -1284,6 +1292,7 @@ void RenderablePolyVoxEntityItem::copyUpperEdgesFromNeighbors() {
                         uint8_t prevValue = _volData->getVoxelAt(x, y, z);
                         if (prevValue != neighborValue) {
                             _volData->setVoxelAt(x, y, z, neighborValue);
+                            markChunksDirty(x, y, z);
                             _volDataDirty = true;
                         }
                     }
@@ -1323,50 +1332,107 @@ void RenderablePolyVoxEntityItem::tellNeighborsToRecopyEdges(bool force) {
 }
 
 
+void RenderablePolyVoxEntityItem::markChunksDirty(int x, int y, int z) {
+    if (_allChunksDirty || _dirtyChunks.empty()) {
+        return;
+    }
+    // the voxel is used by the cells on both of its sides, and by the normals of the cells next to those
+    ivec3 v(x, y, z);
+    ivec3 low = glm::clamp((v - 2) / MESH_CHUNK_SIZE, ivec3(0), _numChunks - 1);
+    ivec3 high = glm::clamp((v + 2) / MESH_CHUNK_SIZE, ivec3(0), _numChunks - 1);
+    loop3(low, high + 1, [&](const ivec3& chunk) {
+        _dirtyChunks[(chunk.z * _numChunks.y + chunk.y) * _numChunks.x + chunk.x] = true;
+    });
+}
+
 void RenderablePolyVoxEntityItem::recomputeMesh() {
     // use _volData to make a renderable mesh
     PolyVoxSurfaceStyle voxelSurfaceStyle;
-    withReadLock([&] {
+    std::shared_ptr<std::vector<ChunkSurface>> chunkSurfaces;
+    std::vector<int> chunksToExtract;
+    ivec3 numChunks;
+    ivec3 upperCorner;
+    withWriteLock([&] {
         voxelSurfaceStyle = _voxelSurfaceStyle;
+
+        const PolyVox::Region& region = _volData->getEnclosingRegion();
+        upperCorner = ivec3(region.getUpperX(), region.getUpperY(), region.getUpperZ());
+        numChunks = glm::max((upperCorner + MESH_CHUNK_SIZE - 1) / MESH_CHUNK_SIZE, ivec3(1));
+        size_t totalChunks = (size_t)(numChunks.x * numChunks.y * numChunks.z);
+        if (_allChunksDirty || !_chunkSurfaces || numChunks != _numChunks) {
+            _chunkSurfaces = std::make_shared<std::vector<ChunkSurface>>(totalChunks);
+            _dirtyChunks.assign(totalChunks, true);
+            _numChunks = numChunks;
+            _allChunksDirty = false;
+        }
+        for (size_t i = 0; i < totalChunks; i++) {
+            if (_dirtyChunks[i]) {
+                chunksToExtract.push_back((int)i);
+                _dirtyChunks[i] = false;
+            }
+        }
+        chunkSurfaces = _chunkSurfaces;
     });
 
     auto entity = std::static_pointer_cast<RenderablePolyVoxEntityItem>(getThisPointer());
 
-    QtConcurrent::run([entity, voxelSurfaceStyle] {
+    QtConcurrent::run([entity, voxelSurfaceStyle, chunkSurfaces, chunksToExtract, numChunks, upperCorner] {
         graphics::MeshPointer mesh(new graphics::Mesh());
 
-        // A mesh object to hold the result of surface extraction
-        PolyVox::SurfaceMesh<PolyVox::PositionMaterialNormal> polyVoxMesh;
-
         entity->withReadLock([&] {
             PolyVox::SimpleVolume<uint8_t>* volData = entity->getVolData();
-            switch (voxelSurfaceStyle) {
-                case PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES:
-                case PolyVoxEntityItem::SURFACE_MARCHING_CUBES: {
-                    PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
-                }
-                case PolyVoxEntityItem::SURFACE_EDGED_CUBIC:
-                case PolyVoxEntityItem::SURFACE_CUBIC: {
-                    PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
-                        (volData, volData->getEnclosingRegion(), &polyVoxMesh);
-                    surfaceExtractor.execute();
-                    break;
+            for (int index : chunksToExtract) {
+                // neighbouring chunks share the voxels of their common face, so that no cell is left out
+                ivec3 chunk(index % numChunks.x, (index / numChunks.x) % numChunks.y, index / (numChunks.x * numChunks.y));
+                ivec3 lower = chunk * MESH_CHUNK_SIZE;
+                ivec3 upper = glm::min(lower + MESH_CHUNK_SIZE, upperCorner);
+                PolyVox::Region region(PolyVox::Vector3DInt32(lower.x, lower.y, lower.z),
+                                       PolyVox::Vector3DInt32(upper.x, upper.y, upper.z));
+
+                ChunkSurface& chunkSurface = (*chunkSurfaces)[index];
+                chunkSurface = ChunkSurface();
+                switch (voxelSurfaceStyle) {
+                    case PolyVoxEntityItem::SURFACE_EDGED_MARCHING_CUBES:
+                    case PolyVoxEntityItem::SURFACE_MARCHING_CUBES: {
+                        PolyVox::MarchingCubesSurfaceExtractor<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
+                            (volData, region, &chunkSurface);
+                        surfaceExtractor.execute();
+                        break;
+                    }
+                    case PolyVoxEntityItem::SURFACE_EDGED_CUBIC:
+                    case PolyVoxEntityItem::SURFACE_CUBIC: {
+                        PolyVox::CubicSurfaceExtractorWithNormals<PolyVox::SimpleVolume<uint8_t>> surfaceExtractor
+                            (volData, region, &chunkSurface);
+                        surfaceExtractor.execute();
+                        break;
+                    }
                 }
             }
         });
 
+        // concatenate the chunks, their vertices are relative to the lower corner of their region
+        std::vector<uint32_t> vecIndices;
+        std::vector<PolyVox::PositionMaterialNormal> vecVertices;
+        for (const auto& chunkSurface : *chunkSurfaces) {
+            const PolyVox::Vector3DInt32& lowerCorner = chunkSurface.m_Region.getLowerCorner();
+            PolyVox::Vector3DFloat offset((float)lowerCorner.getX(), (float)lowerCorner.getY(), (float)lowerCorner.getZ());
+            uint32_t baseVertex = (uint32_t)vecVertices.size();
+            for (auto vertex : chunkSurface.getRawVertexData()) {
+                vertex.setPosition(vertex.getPosition() + offset);
+                vecVertices.push_back(vertex);
+            }
+            for (auto vertexIndex : chunkSurface.getIndices()) {
+                vecIndices.push_back(baseVertex + vertexIndex);
+            }
+        }
+
         // convert PolyVox mesh to a Sam mesh
-        const std::vector<uint32_t>& vecIndices = polyVoxMesh.getIndices();
         auto indexBuffer = std::make_shared<gpu::Buffer>(vecIndices.size() * sizeof(uint32_t),
                                                          (gpu::Byte*)vecIndices.data());
         auto indexBufferPtr = gpu::BufferPointer(indexBuffer);
         gpu::BufferView indexBufferView(indexBufferPtr, gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::INDEX));
         mesh->setIndexBuffer(indexBufferView);
 
-        const std::vector<PolyVox::PositionMaterialNormal>& vecVertices = polyVoxMesh.getRawVertexData();
         auto vertexBuffer = std::make_shared<gpu::Buffer>(vecVertices.size() * sizeof(PolyVox::PositionMaterialNormal),
                                                           (gpu::Byte*)vecVertices.data());
         auto vertexBufferPtr = gpu::BufferPointer(vertexBuffer);
@@ -18,6 +18,7 @@
 
 #include <PolyVoxCore/SimpleVolume.h>
 #include <PolyVoxCore/Raycast.h>
+#include <PolyVoxCore/SurfaceMesh.h>
 
 #include <gpu/Forward.h>
 #include <gpu/Context.h>
@@ -153,6 +154,8 @@ private:
     void stopUpdates();
 
     void recomputeMesh();
+    // marks the chunks whose surface uses the voxel, in _volData coordinates
+    void markChunksDirty(int x, int y, int z);
     void cacheNeighbors();
     void copyUpperEdgesFromNeighbors();
     void tellNeighborsToRecopyEdges(bool force);
@@ -179,6 +182,15 @@ private:
     std::shared_ptr<PolyVox::SimpleVolume<uint8_t>> _volData;
     int _onCount; // how many non-zero voxels are in _volData
 
+    // The surface is extracted in chunks of _volData and only the chunks with changed voxels are extracted
+    // again; the mesh is the concatenation of the chunk surfaces.  The chunk surfaces are only touched by the
+    // worker of recomputeMesh, there is one at a time.
+    using ChunkSurface = PolyVox::SurfaceMesh<PolyVox::PositionMaterialNormal>;
+    std::shared_ptr<std::vector<ChunkSurface>> _chunkSurfaces;
+    std::vector<bool> _dirtyChunks;
+    ivec3 _numChunks { 0 };
+    bool _allChunksDirty { true };
+
     bool _neighborXNeedsUpdate { false };
     bool _neighborYNeedsUpdate { false };
     bool _neighborZNeedsUpdate { false };
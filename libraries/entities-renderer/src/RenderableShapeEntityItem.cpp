@@ -257,6 +257,10 @@ void ShapeEntityRenderer::doRender(RenderArgs* args) {
         } else {
             geometryCache->renderSolidShapeInstance(args, batch, geometryShape, outColor, pipeline);
         }
+        args->_details._instancedItems++;
+    } else if (!_isFading && geometryCache->renderMaterialShapeInstance(args, batch, geometryShape, materials)) {
+        // the fade is set per item by the pipeline, only the shapes which aren't fading can share a draw
+        args->_details._instancedItems++;
     } else {
         if (RenderPipelines::bindMaterials(materials, batch, args->_renderMode, args->_enableTexturing)) {
             args->_details._materialSwitches++;
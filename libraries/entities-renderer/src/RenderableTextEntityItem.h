@@ -45,6 +45,7 @@ private:
     virtual bool needsRenderUpdateFromTypedEntity(const TypedEntityPointer& entity) const override;
     virtual void doRenderUpdateSynchronousTyped(const ScenePointer& scene, Transaction& transaction, const TypedEntityPointer& entity) override;
     virtual void doRenderUpdateAsynchronousTyped(const TypedEntityPointer& entity) override;
+    virtual bool isRenderUpdateConcurrent() const override { return true; }
     virtual void doRender(RenderArgs* args) override;
 
     std::shared_ptr<TextRenderer3D> _textRenderer;
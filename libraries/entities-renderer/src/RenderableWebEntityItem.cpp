@@ -45,6 +45,14 @@ static float OPAQUE_ALPHA_THRESHOLD = 0.99f;
 // If a web-view hasn't been rendered for 30 seconds, de-allocate the framebuffer
 static uint64_t MAX_NO_RENDER_INTERVAL = 30 * USECS_PER_SECOND;
 
+// If a web-view hasn't been rendered for a second, it's out of view: only keep its texture alive
+static uint64_t MAX_NO_RENDER_THROTTLE_INTERVAL = USECS_PER_SECOND;
+static uint8_t THROTTLED_MAX_FPS = 1;
+
+// A web-view further than this many times its size stops rendering and keeps showing its last frame
+static float SUSPEND_DISTANCE_TO_SIZE_RATIO = 50.0f;
+static uint8_t SUSPENDED_MAX_FPS = 0;
+
 static uint8_t YOUTUBE_MAX_FPS = 30;
 
 // Don't allow more than 20 concurrent web views
@@ -86,6 +94,7 @@ WebEntityRenderer::WebEntityRenderer(const EntityItemPointer& entity) : Parent(e
 
     _timer.setInterval(MSECS_PER_SECOND);
     connect(&_timer, &QTimer::timeout, this, &WebEntityRenderer::onTimeout);
+    _timer.start();
 }
 
 WebEntityRenderer::~WebEntityRenderer() {
@@ -139,8 +148,15 @@ void WebEntityRenderer::onTimeout() {
         return;
     }
 
-    if (usecTimestampNow() - lastRenderTime > MAX_NO_RENDER_INTERVAL) {
+    uint64_t noRenderInterval = usecTimestampNow() - lastRenderTime;
+    if (noRenderInterval > MAX_NO_RENDER_INTERVAL) {
         destroyWebSurface();
+    } else if (noRenderInterval > MAX_NO_RENDER_THROTTLE_INTERVAL) {
+        withWriteLock([&] {
+            if (_surfaceMaxFPS > THROTTLED_MAX_FPS && _appliedMaxFPS != SUSPENDED_MAX_FPS) {
+                applySurfaceMaxFps(THROTTLED_MAX_FPS);
+            }
+        });
     }
 }
 
@@ -217,10 +233,11 @@ void WebEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& scene
                         // We special case YouTube URLs since we know they are videos that we should play with at least 30 FPS.
                         // FIXME this doesn't handle redirects or shortened URLs, consider using a signaling method from the web entity
                         if (QUrl(_sourceURL).host().endsWith("youtube.com", Qt::CaseInsensitive)) {
-                            _webSurface->setMaxFps(YOUTUBE_MAX_FPS);
+                            _surfaceMaxFPS = YOUTUBE_MAX_FPS;
                         } else {
-                            _webSurface->setMaxFps(maxFPS);
+                            _surfaceMaxFPS = maxFPS;
                         }
+                        applySurfaceMaxFps(_surfaceMaxFPS);
                         _maxFPS = maxFPS;
                     }
                 }
@@ -298,6 +315,20 @@ void WebEntityRenderer::doRender(RenderArgs* args) {
         forward = _renderLayer != RenderLayer::WORLD || args->_renderMethod == render::Args::FORWARD;
     });
 
+    withWriteLock([&] {
+        if (_surfaceMaxFPS == 0) {
+            return;
+        }
+        bool isFar = false;
+        if (_renderLayer == RenderLayer::WORLD) {
+            glm::vec3 dimensions = transform.getScale();
+            float size = glm::max(dimensions.x, glm::max(dimensions.y, dimensions.z));
+            float distance = glm::distance(args->getViewFrustum().getPosition(), transform.getTranslation());
+            isFar = distance > SUSPEND_DISTANCE_TO_SIZE_RATIO * size;
+        }
+        applySurfaceMaxFps(isFar ? SUSPENDED_MAX_FPS : _surfaceMaxFPS);
+    });
+
     if (color.a == 0.0f) {
         return;
     }
@@ -341,6 +372,7 @@ void WebEntityRenderer::destroyWebSurface() {
     withWriteLock([&] {
         webSurface.swap(_webSurface);
         _contentType = ContentType::NoContent;
+        _appliedMaxFPS = -1;
 
         if (webSurface) {
             --_currentWebCount;
@@ -349,6 +381,13 @@ void WebEntityRenderer::destroyWebSurface() {
     });
 }
 
+void WebEntityRenderer::applySurfaceMaxFps(uint8_t maxFps) {
+    if (_webSurface && _appliedMaxFPS != maxFps) {
+        _webSurface->setMaxFps(maxFps);
+        _appliedMaxFPS = maxFps;
+    }
+}
+
 glm::vec2 WebEntityRenderer::getWindowSize(const TypedEntityPointer& entity) const {
     glm::vec2 dims = glm::vec2(entity->getScaledDimensions());
     dims *= METERS_TO_INCHES * _dpi;
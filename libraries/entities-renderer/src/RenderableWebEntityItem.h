@@ -68,6 +68,8 @@ private:
     void onTimeout();
     void buildWebSurface(const EntityItemPointer& entity, const QString& newSourceURL);
     void destroyWebSurface();
+    // must be called under the write lock
+    void applySurfaceMaxFps(uint8_t maxFps);
     glm::vec2 getWindowSize(const TypedEntityPointer& entity) const;
 
     int _geometryId{ 0 };
@@ -93,12 +95,15 @@ private:
     uint16_t _dpi;
     QString _scriptURL;
     uint8_t _maxFPS;
+    uint8_t _surfaceMaxFPS { 0 };
     WebInputMode _inputMode;
 
     glm::vec3 _contextPosition;
 
     QTimer _timer;
     uint64_t _lastRenderTime { 0 };
+    // the rate last given to the surface, lowered while it isn't rendered or is far away, -1 when unknown
+    int _appliedMaxFPS { -1 };
 
     std::vector<QMetaObject::Connection> _connections;
 
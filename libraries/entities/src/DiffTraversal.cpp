@@ -34,12 +34,16 @@ void DiffTraversal::Waypoint::getNextVisibleElementFirstTime(DiffTraversal::Visi
     } else if (_nextIndex < NUMBER_OF_CHILDREN) {
         EntityTreeElementPointer element = _weakElement.lock();
         if (element) {
+            if (_nextIndex == 0) {
+                _childrenToTraverse = view.getChildrenToTraverse(ChildCubes(*element));
+            }
             while (_nextIndex < NUMBER_OF_CHILDREN) {
-                EntityTreeElementPointer nextElement = element->getChildAtIndex(_nextIndex);
-                ++_nextIndex;
-                if (nextElement && view.shouldTraverseElement(*nextElement)) {
-                    next.element = nextElement;
-                    return;
+                int childIndex = _nextIndex++;
+                if (_childrenToTraverse & (1 << childIndex)) {
+                    if (element->getRawChildAtIndex(childIndex)) {
+                        next.element = element->getChildAtIndex(childIndex);
+                        return;
+                    }
                 }
             }
         }
@@ -61,15 +65,18 @@ void DiffTraversal::Waypoint::getNextVisibleElementRepeat(
     if (_nextIndex < NUMBER_OF_CHILDREN) {
         EntityTreeElementPointer element = _weakElement.lock();
         if (element) {
+            if (_nextIndex == 0) {
+                _childrenToTraverse = view.getChildrenToTraverse(ChildCubes(*element));
+            }
             while (_nextIndex < NUMBER_OF_CHILDREN) {
-                EntityTreeElementPointer nextElement = element->getChildAtIndex(_nextIndex);
-                ++_nextIndex;
-                if (nextElement &&
-                    nextElement->getLastChanged() > lastTime &&
-                    view.shouldTraverseElement(*nextElement)) {
-
-                    next.element = nextElement;
-                    return;
+                int childIndex = _nextIndex++;
+                if (_childrenToTraverse & (1 << childIndex)) {
+                    // only the children that changed are copied out of the element
+                    EntityTreeElement* nextElement = element->getRawChildAtIndex(childIndex);
+                    if (nextElement && nextElement->getLastChanged() > lastTime) {
+                        next.element = element->getChildAtIndex(childIndex);
+                        return;
+                    }
                 }
             }
         }
@@ -88,12 +95,16 @@ void DiffTraversal::Waypoint::getNextVisibleElementDifferential(DiffTraversal::V
     } else if (_nextIndex < NUMBER_OF_CHILDREN) {
         EntityTreeElementPointer element = _weakElement.lock();
         if (element) {
+            if (_nextIndex == 0) {
+                _childrenToTraverse = view.getChildrenToTraverse(ChildCubes(*element));
+            }
             while (_nextIndex < NUMBER_OF_CHILDREN) {
-                EntityTreeElementPointer nextElement = element->getChildAtIndex(_nextIndex);
-                ++_nextIndex;
-                if (nextElement && view.shouldTraverseElement(*nextElement)) {
-                    next.element = nextElement;
-                    return;
+                int childIndex = _nextIndex++;
+                if (_childrenToTraverse & (1 << childIndex)) {
+                    if (element->getRawChildAtIndex(childIndex)) {
+                        next.element = element->getChildAtIndex(childIndex);
+                        return;
+                    }
                 }
             }
         }
@@ -101,15 +112,57 @@ void DiffTraversal::Waypoint::getNextVisibleElementDifferential(DiffTraversal::V
     next.element.reset();
 }
 
+std::vector<DiffTraversal::QueryRegion> DiffTraversal::QueryRegion::fromJSON(const QJsonArray& regions) {
+    auto toVec3 = [](const QJsonValue& value) {
+        auto object = value.toObject();
+        return glm::vec3(object["x"].toDouble(), object["y"].toDouble(), object["z"].toDouble());
+    };
+
+    std::vector<QueryRegion> result;
+    for (const auto& value : regions) {
+        auto object = value.toObject();
+        QueryRegion region;
+        if (object.contains("center") && object.contains("radius")) {
+            region.isSphere = true;
+            region.center = toVec3(object["center"]);
+            region.radius = (float)object["radius"].toDouble();
+        } else if (object.contains("corner") && object.contains("dimensions")) {
+            region.box = AABox(toVec3(object["corner"]), toVec3(object["dimensions"]));
+        } else {
+            continue;
+        }
+        result.push_back(region);
+    }
+    return result;
+}
+
+bool DiffTraversal::QueryRegion::touches(const AACube& cube) const {
+    return isSphere ? cube.touchesSphere(center, radius) : box.touches(cube);
+}
+
+bool DiffTraversal::QueryRegion::operator==(const QueryRegion& other) const {
+    if (isSphere != other.isSphere) {
+        return false;
+    }
+    return isSphere ? (center == other.center && radius == other.radius) : box == other.box;
+}
+
 bool DiffTraversal::View::usesViewFrustums() const {
     return !viewFrustums.empty();
 }
 
+bool DiffTraversal::View::touchesRegions(const AACube& cube) const {
+    return !usesRegions() || any_of(begin(regions), end(regions), [&](const QueryRegion& region) {
+        return region.touches(cube);
+    });
+}
+
 bool DiffTraversal::View::isVerySimilar(const View& view) const {
     auto size = view.viewFrustums.size();
 
     if (view.lodScaleFactor != lodScaleFactor ||
-        viewFrustums.size() != size) {
+        view.prioritizeCollidables != prioritizeCollidables ||
+        viewFrustums.size() != size || view.regions != regions) {
         return false;
     }
 
@@ -126,7 +179,7 @@ float DiffTraversal::View::computePriority(const EntityItemPointer& entity) cons
         return PrioritizedEntity::DO_NOT_SEND;
     }
 
-    if (!usesViewFrustums()) {
+    if (!usesViewFrustums() && !usesRegions()) {
         return PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
     }
 
@@ -136,6 +189,13 @@ float DiffTraversal::View::computePriority(const EntityItemPointer& entity) cons
         return PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
     }
 
+    if (!touchesRegions(cube)) {
+        return PrioritizedEntity::DO_NOT_SEND;
+    }
+    if (!usesViewFrustums()) {
+        return PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY;
+    }
+
     auto center = cube.calcCenter(); // center of bounding sphere
     auto radius = 0.5f * SQRT_THREE * cube.getScale(); // radius of bounding sphere
 
@@ -159,16 +219,23 @@ float DiffTraversal::View::computePriority(const EntityItemPointer& entity) cons
         }
     }
 
+    // the angular size already puts what is near the viewer first, this puts the collidables ahead of the rest
+    const float COLLIDABLE_PRIORITY_BOOST = 4.0f;
+    if (prioritizeCollidables && priority != PrioritizedEntity::DO_NOT_SEND && !entity->getCollisionless()) {
+        priority *= COLLIDABLE_PRIORITY_BOOST;
+    }
+
     return priority;
 }
 
-bool DiffTraversal::View::shouldTraverseElement(const EntityTreeElement& element) const {
+bool DiffTraversal::View::shouldTraverseCube(const AACube& cube) const {
+    if (!touchesRegions(cube)) {
+        return false;
+    }
     if (!usesViewFrustums()) {
         return true;
     }
 
-    const auto& cube = element.getAACube();
-
     auto center = cube.calcCenter(); // center of bounding sphere
     auto radius = 0.5f * SQRT_THREE * cube.getScale(); // radius of bounding sphere
 
@@ -188,6 +255,86 @@ bool DiffTraversal::View::shouldTraverseElement(const EntityTreeElement& element
     });
 }
 
+DiffTraversal::ChildCubes::ChildCubes(const EntityTreeElement& element) {
+    for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+        EntityTreeElement* child = element.getRawChildAtIndex(i);
+        if (child) {
+            set(i, child->getAACube());
+        }
+    }
+}
+
+void DiffTraversal::ChildCubes::set(int childIndex, const AACube& cube) {
+    const glm::vec3& corner = cube.getCorner();
+    cornerX[childIndex] = corner.x;
+    cornerY[childIndex] = corner.y;
+    cornerZ[childIndex] = corner.z;
+    scale[childIndex] = cube.getScale();
+    existing |= 1 << childIndex;
+}
+
+// the same tests as shouldTraverseCube(), a child at a time
+static uint8_t cullChildCubes_ref(const DiffTraversal::ChildCubes& children, const ConicalViewFrustums& frustums,
+                                  float minAngularSize) {
+    uint8_t inView = 0;
+    for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+        glm::vec3 center = glm::vec3(children.cornerX[i], children.cornerY[i], children.cornerZ[i]) +
+            glm::vec3(children.scale[i] * 0.5f);
+        float radius = 0.5f * SQRT_THREE * children.scale[i];
+
+        for (const auto& frustum : frustums) {
+            auto position = center - frustum.getPosition();
+            float distance = glm::length(position);
+            if (frustum.getAngularSize(distance, radius) > minAngularSize && frustum.intersects(position, distance, radius)) {
+                inView |= 1 << i;
+                break;
+            }
+        }
+    }
+    return inView;
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+uint8_t cullChildCubes_AVX2(const DiffTraversal::ChildCubes& children, const ConicalViewFrustums& frustums,
+                            float minAngularSize);
+
+static uint8_t cullChildCubes(const DiffTraversal::ChildCubes& children, const ConicalViewFrustums& frustums,
+                              float minAngularSize) {
+    static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+    if (_cpuSupportsAVX2) {
+        return cullChildCubes_AVX2(children, frustums, minAngularSize);
+    } else {
+        return cullChildCubes_ref(children, frustums, minAngularSize);
+    }
+}
+
+#else   // portable reference code
+static auto& cullChildCubes = cullChildCubes_ref;
+#endif
+
+uint8_t DiffTraversal::View::getChildrenToTraverse(const ChildCubes& children) const {
+    uint8_t childrenToTraverse = children.existing;
+    if (usesRegions()) {
+        for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+            if (childrenToTraverse & (1 << i)) {
+                AACube cube(glm::vec3(children.cornerX[i], children.cornerY[i], children.cornerZ[i]), children.scale[i]);
+                if (!touchesRegions(cube)) {
+                    childrenToTraverse &= ~(1 << i);
+                }
+            }
+        }
+    }
+    if (!usesViewFrustums() || !childrenToTraverse) {
+        return childrenToTraverse;
+    }
+    return childrenToTraverse & cullChildCubes(children, viewFrustums, lodScaleFactor * MIN_ELEMENT_ANGULAR_DIAMETER);
+}
+
 DiffTraversal::DiffTraversal() {
     const int32_t MIN_PATH_DEPTH = 16;
     _path.reserve(MIN_PATH_DEPTH);
@@ -212,10 +359,14 @@ DiffTraversal::Type DiffTraversal::prepareNewTraversal(const DiffTraversal::View
     //
 
     Type type;
-    // If usesViewFrustum changes, treat it as a First traversal
-    if (forceFirstPass || _completedView.startTime == 0 || _currentView.usesViewFrustums() != _completedView.usesViewFrustums()) {
+    _sharedTraversal.reset();
+
+    // If usesViewFrustum or the regions change, treat it as a First traversal
+    if (forceFirstPass || _completedView.startTime == 0 || _currentView.usesViewFrustums() != _completedView.usesViewFrustums() ||
+        view.regions != _completedView.regions) {
         type = Type::First;
         _currentView.viewFrustums = view.viewFrustums;
+        _currentView.regions = view.regions;
         _currentView.lodScaleFactor = view.lodScaleFactor;
         _getNextVisibleElementCallback = [this](DiffTraversal::VisibleElement& next) {
             _path.back().getNextVisibleElementFirstTime(next, _currentView);
@@ -241,14 +392,113 @@ DiffTraversal::Type DiffTraversal::prepareNewTraversal(const DiffTraversal::View
 
     _currentView.startTime = usecTimestampNow();
 
+    _type = type;
     return type;
 }
 
+DiffTraversal::SharedTraversalPointer DiffTraversal::buildSharedTraversal(const DiffTraversal::View& view,
+                                                                          EntityTreeElementPointer root) {
+    assert(root);
+    auto sharedTraversal = std::make_shared<SharedTraversal>();
+    sharedTraversal->view = view;
+    sharedTraversal->view.startTime = usecTimestampNow();
+
+    auto& entries = sharedTraversal->entries;
+
+    struct Fork {
+        EntityTreeElementPointer element;
+        uint32_t entryIndex;
+        int nextIndex;
+        uint8_t childrenToTraverse;
+    };
+    const View& sharedView = sharedTraversal->view;
+
+    // the root is always in view, the same as in a First traversal
+    std::vector<Fork> path;
+    path.push_back({ root, 0, 0, sharedView.getChildrenToTraverse(ChildCubes(*root)) });
+    entries.push_back({ root, 0 });
+
+    while (!path.empty()) {
+        EntityTreeElementPointer nextElement;
+        Fork& fork = path.back();
+        while (fork.nextIndex < NUMBER_OF_CHILDREN && !nextElement) {
+            int childIndex = fork.nextIndex++;
+            if (fork.childrenToTraverse & (1 << childIndex)) {
+                nextElement = fork.element->getChildAtIndex(childIndex);
+            }
+        }
+
+        if (nextElement) {
+            path.push_back({ nextElement, (uint32_t)entries.size(), 0,
+                             sharedView.getChildrenToTraverse(ChildCubes(*nextElement)) });
+            entries.push_back({ nextElement, 0 });
+        } else {
+            // we're done with this subtree
+            entries[fork.entryIndex].subtreeEnd = (uint32_t)entries.size();
+            path.pop_back();
+        }
+    }
+
+    return sharedTraversal;
+}
+
+void DiffTraversal::useSharedTraversal(SharedTraversalPointer sharedTraversal) {
+    assert(sharedTraversal && !_path.empty());
+    _sharedTraversal = sharedTraversal;
+    _sharedIndex = 0;
+    _currentView.startTime = sharedTraversal->view.startTime;
+}
+
+void DiffTraversal::getNextSharedElement(DiffTraversal::VisibleElement& next) {
+    const auto& entries = _sharedTraversal->entries;
+    uint64_t lastTime = _completedView.startTime;
+
+    while (_sharedIndex < entries.size()) {
+        const auto& entry = entries[_sharedIndex];
+        EntityTreeElementPointer element = entry.element.lock();
+        if (!element) {
+            // the element is gone, so is its subtree
+            _sharedIndex = entry.subtreeEnd;
+            continue;
+        }
+
+        if (_type == Type::Repeat) {
+            // the same pruning as a Repeat traversal of the tree, minus the view checks the shared traversal did for us
+            if (_sharedIndex > 0 && element->getLastChanged() <= lastTime) {
+                _sharedIndex = entry.subtreeEnd;
+                continue;
+            }
+            ++_sharedIndex;
+            if (element->getLastChangedContent() > lastTime) {
+                next.element = element;
+                return;
+            }
+        } else {
+            ++_sharedIndex;
+            next.element = element;
+            return;
+        }
+    }
+
+    next.element.reset();
+    completeTraversal();
+}
+
+void DiffTraversal::completeTraversal() {
+    _path.clear();
+    _sharedTraversal.reset();
+    _completedView = _currentView;
+}
+
 void DiffTraversal::getNextVisibleElement(DiffTraversal::VisibleElement& next) {
     if (_path.empty()) {
         next.element.reset();
         return;
     }
+    if (_sharedTraversal) {
+        getNextSharedElement(next);
+        return;
+    }
     _getNextVisibleElementCallback(next);
     if (next.element) {
         int8_t nextIndex = _path.back().getNextIndex();
@@ -262,7 +512,7 @@ void DiffTraversal::getNextVisibleElement(DiffTraversal::VisibleElement& next) {
             _path.pop_back();
             if (_path.empty()) {
                 // we've traversed the entire tree
-                _completedView = _currentView;
+                completeTraversal();
                 return;
             }
             // keep looking for next
@@ -12,6 +12,8 @@
 #ifndef hifi_DiffTraversal_h
 #define hifi_DiffTraversal_h
 
+#include <QtCore/QJsonArray>
+
 #include <shared/ConicalViewFrustum.h>
 
 #include "EntityTreeElement.h"
@@ -26,18 +28,61 @@ public:
         EntityTreeElementPointer element;
     };
 
+    // ChildCubes holds the cubes of the children of an element, laid out for testing all of them at once
+    class ChildCubes {
+    public:
+        ChildCubes() = default;
+        ChildCubes(const EntityTreeElement& element);
+
+        void set(int childIndex, const AACube& cube);
+
+        alignas(32) float cornerX[NUMBER_OF_CHILDREN] {};
+        alignas(32) float cornerY[NUMBER_OF_CHILDREN] {};
+        alignas(32) float cornerZ[NUMBER_OF_CHILDREN] {};
+        alignas(32) float scale[NUMBER_OF_CHILDREN] {};
+        uint8_t existing { 0 }; // bits of the child indices that were set
+    };
+
+    // QueryRegion is a box or a sphere that a viewer subscribed to, only what touches one of its regions is sent to it
+    class QueryRegion {
+    public:
+        // the boxes are { corner, dimensions } and the spheres { center, radius }, the others are skipped
+        static std::vector<QueryRegion> fromJSON(const QJsonArray& regions);
+
+        bool touches(const AACube& cube) const;
+        bool operator==(const QueryRegion& other) const;
+
+        AABox box;
+        glm::vec3 center;
+        float radius { 0.0f };
+        bool isSphere { false };
+    };
+
     // View is a struct with a ViewFrustum and LOD parameters
     class View {
     public:
         bool usesViewFrustums() const;
+        bool usesRegions() const { return !regions.empty(); }
+        bool touchesRegions(const AACube& cube) const;
         bool isVerySimilar(const View& view) const;
 
-        bool shouldTraverseElement(const EntityTreeElement& element) const;
+        bool shouldTraverseElement(const EntityTreeElement& element) const { return shouldTraverseCube(element.getAACube()); }
+        bool shouldTraverseCube(const AACube& cube) const;
+
+        // The children that shouldTraverseCube() would pass, as bits of their child indices.
+        // Tests all of them against every frustum at once, with AVX2 when the CPU has it.
+        uint8_t getChildrenToTraverse(const ChildCubes& children) const;
+
         float computePriority(const EntityItemPointer& entity) const;
 
         ConicalViewFrustums viewFrustums;
+        // when there are regions, what is outside all of them is neither traversed nor sent, in view or not
+        std::vector<QueryRegion> regions;
         uint64_t startTime { 0 };
         float lodScaleFactor { 1.0f };
+        // during the initial send the entities that can be collided with come first, so that the viewer has
+        // the ground it lands on before the rest of what is in view
+        bool prioritizeCollidables { false };
     };
 
     // Waypoint is an bookmark in a "path" of waypoints during a traversal.
@@ -55,14 +100,38 @@ public:
     protected:
         EntityTreeElementWeakPointer _weakElement;
         int8_t _nextIndex;
+        uint8_t _childrenToTraverse { 0 }; // culled all at once, when we get to the first child
     };
 
+    // SharedTraversal is the list of elements found in view by a full traversal, in depth first order,
+    // computed once for the viewers whose views are very similar to its view.
+    class SharedTraversal {
+    public:
+        class Entry {
+        public:
+            EntityTreeElementWeakPointer element;
+            uint32_t subtreeEnd; // index of the first entry past the subtree of this element
+        };
+
+        View view;
+        std::vector<Entry> entries;
+    };
+    using SharedTraversalPointer = std::shared_ptr<const SharedTraversal>;
+
+    // runs a complete traversal of the tree for the view, must be called with the tree read locked
+    static SharedTraversalPointer buildSharedTraversal(const View& view, EntityTreeElementPointer root);
+
     typedef enum { First, Repeat, Differential } Type;
 
     DiffTraversal();
 
     Type prepareNewTraversal(const DiffTraversal::View& view, EntityTreeElementPointer root, bool forceFirstPass = false);
 
+    // Scan the elements of shared traversal instead of walking the tree for the traversal we just prepared.
+    // The completed traversal is then timestamped at the start of the shared one, so that we pick up
+    // any changes made since then on our next Repeat pass.
+    void useSharedTraversal(SharedTraversalPointer sharedTraversal);
+
     const View& getCurrentView() const { return _currentView; }
 
     uint64_t getStartOfCompletedTraversal() const { return _completedView.startTime; }
@@ -71,14 +140,19 @@ public:
     void setScanCallback(std::function<void (VisibleElement&)> cb);
     void traverse(uint64_t timeBudget);
 
-    void reset() { _path.clear(); _completedView.startTime = 0; } // resets our state to force a new "First" traversal
+    void reset() { _path.clear(); _sharedTraversal.reset(); _completedView.startTime = 0; } // resets our state to force a new "First" traversal
 
 private:
     void getNextVisibleElement(VisibleElement& next);
+    void getNextSharedElement(VisibleElement& next);
+    void completeTraversal();
 
     View _currentView;
     View _completedView;
     std::vector<Waypoint> _path;
+    Type _type { First };
+    SharedTraversalPointer _sharedTraversal;
+    uint32_t _sharedIndex { 0 };
     std::function<void (VisibleElement&)> _getNextVisibleElementCallback { nullptr };
     std::function<void (VisibleElement&)> _scanElementCallback { [](VisibleElement& e){} };
 };
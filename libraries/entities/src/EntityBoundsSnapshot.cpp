@@ -0,0 +1,211 @@
+//
+//  EntityBoundsSnapshot.cpp
+//  libraries/entities/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityBoundsSnapshot.h"
+
+#include <algorithm>
+#include <cfloat>
+
+// a refit hierarchy gets looser with every move, past this share of changed entities rebuilding it pays off
+static const float MAX_CHANGES_PER_ENTITY_BEFORE_REBUILD = 0.5f;
+
+const EntityBoundsSnapshot::Bounds EntityBoundsSnapshot::EMPTY_BOUNDS { glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX) };
+
+EntityBoundsSnapshotPointer EntityBoundsSnapshot::build(const QVector<EntityItemPointer>& entities) {
+    auto snapshot = std::make_shared<EntityBoundsSnapshot>();
+    snapshot->_entities.reserve(entities.size());
+    snapshot->_entityBounds.reserve(entities.size());
+
+    for (auto& entity : entities) {
+        bool success;
+        AABox box = entity->getAABox(success);
+        if (success) {
+            snapshot->_entities.push_back(entity);
+            snapshot->_entityBounds.push_back({ box.getMinimumPoint(), box.getMaximumPoint() });
+        }
+    }
+
+    snapshot->buildNodes();
+    return snapshot;
+}
+
+EntityBoundsSnapshotPointer EntityBoundsSnapshot::update(const QVector<EntityItemPointer>& changedEntities,
+                                                         const QVector<EntityItemID>& removedEntityIDs) const {
+    auto snapshot = std::make_shared<EntityBoundsSnapshot>(*this);
+
+    for (auto& entityID : removedEntityIDs) {
+        auto it = snapshot->_entityIndices.find(entityID);
+        if (it != snapshot->_entityIndices.end()) {
+            snapshot->_entities[it.value()].reset();
+            snapshot->_entityBounds[it.value()] = EMPTY_BOUNDS;
+            snapshot->_entityIndices.erase(it);
+        }
+    }
+
+    // known entities are moved in place, new ones go to the end and make us rebuild
+    bool needsRebuild = false;
+    for (auto& entity : changedEntities) {
+        bool success;
+        AABox box = entity->getAABox(success);
+        Bounds bounds = success ? Bounds { box.getMinimumPoint(), box.getMaximumPoint() } : EMPTY_BOUNDS;
+
+        auto it = snapshot->_entityIndices.find(entity->getEntityItemID());
+        if (it != snapshot->_entityIndices.end() && snapshot->_entities[it.value()] == entity && success) {
+            snapshot->_entityBounds[it.value()] = bounds;
+            continue;
+        }
+
+        // the entity lost its bounds, or was replaced by another one with the same id
+        if (it != snapshot->_entityIndices.end()) {
+            snapshot->_entities[it.value()].reset();
+            snapshot->_entityBounds[it.value()] = EMPTY_BOUNDS;
+            snapshot->_entityIndices.erase(it);
+        }
+        if (success) {
+            snapshot->_entities.push_back(entity);
+            snapshot->_entityBounds.push_back(bounds);
+            needsRebuild = true;
+        }
+    }
+
+    snapshot->_numChangesSinceBuild += changedEntities.size() + removedEntityIDs.size();
+    if (needsRebuild ||
+        snapshot->_numChangesSinceBuild > MAX_CHANGES_PER_ENTITY_BEFORE_REBUILD * snapshot->_entityIndices.size()) {
+        snapshot->buildNodes();
+    } else {
+        snapshot->refit();
+    }
+    return snapshot;
+}
+
+void EntityBoundsSnapshot::buildNodes() {
+    // drop the entities that were removed since the last build
+    uint32_t numEntities = 0;
+    for (uint32_t i = 0; i < _entities.size(); ++i) {
+        if (_entities[i]) {
+            _entities[numEntities] = std::move(_entities[i]);
+            _entityBounds[numEntities] = _entityBounds[i];
+            ++numEntities;
+        }
+    }
+    _entities.resize(numEntities);
+    _entityBounds.resize(numEntities);
+
+    std::vector<uint32_t> order(numEntities);
+    for (uint32_t i = 0; i < numEntities; ++i) {
+        order[i] = i;
+    }
+
+    _nodes.clear();
+    _nodes.reserve(2 * (numEntities / MAX_ENTITIES_PER_LEAF + 1));
+    if (numEntities > 0) {
+        buildNode(order, 0, numEntities);
+    }
+
+    // lay the entities out in leaf order
+    std::vector<EntityItemPointer> entities(numEntities);
+    std::vector<Bounds> entityBounds(numEntities);
+    _entityIndices.clear();
+    _entityIndices.reserve(numEntities);
+    for (uint32_t i = 0; i < numEntities; ++i) {
+        entities[i] = std::move(_entities[order[i]]);
+        entityBounds[i] = _entityBounds[order[i]];
+        _entityIndices.insert(entities[i]->getEntityItemID(), i);
+    }
+    _entities.swap(entities);
+    _entityBounds.swap(entityBounds);
+    _numChangesSinceBuild = 0;
+}
+
+uint32_t EntityBoundsSnapshot::buildNode(std::vector<uint32_t>& order, uint32_t begin, uint32_t end) {
+    uint32_t nodeIndex = (uint32_t)_nodes.size();
+    _nodes.push_back({ EMPTY_BOUNDS, begin, end - begin });
+
+    Bounds bounds = EMPTY_BOUNDS;
+    Bounds centers = EMPTY_BOUNDS;
+    for (uint32_t i = begin; i < end; ++i) {
+        const Bounds& entityBounds = _entityBounds[order[i]];
+        bounds.minimum = glm::min(bounds.minimum, entityBounds.minimum);
+        bounds.maximum = glm::max(bounds.maximum, entityBounds.maximum);
+        glm::vec3 center = 0.5f * (entityBounds.minimum + entityBounds.maximum);
+        centers.minimum = glm::min(centers.minimum, center);
+        centers.maximum = glm::max(centers.maximum, center);
+    }
+    _nodes[nodeIndex].bounds = bounds;
+
+    if (end - begin <= MAX_ENTITIES_PER_LEAF) {
+        return nodeIndex;
+    }
+
+    // split at the median along the axis the centers spread the most over, which keeps the depth logarithmic
+    glm::vec3 spread = centers.maximum - centers.minimum;
+    int axis = (spread.x >= spread.y && spread.x >= spread.z) ? 0 : (spread.y >= spread.z ? 1 : 2);
+    uint32_t middle = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end, [&](uint32_t a, uint32_t b) {
+        return _entityBounds[a].minimum[axis] + _entityBounds[a].maximum[axis] <
+            _entityBounds[b].minimum[axis] + _entityBounds[b].maximum[axis];
+    });
+
+    buildNode(order, begin, middle);
+    uint32_t secondChild = buildNode(order, middle, end);
+    _nodes[nodeIndex].first = secondChild;
+    _nodes[nodeIndex].count = 0;
+    return nodeIndex;
+}
+
+void EntityBoundsSnapshot::refit() {
+    // children always come after their parent, so walking backwards visits them first
+    for (uint32_t i = (uint32_t)_nodes.size(); i-- > 0;) {
+        Node& node = _nodes[i];
+        Bounds bounds = EMPTY_BOUNDS;
+        if (node.count > 0) {
+            for (uint32_t j = node.first; j < node.first + node.count; ++j) {
+                bounds.minimum = glm::min(bounds.minimum, _entityBounds[j].minimum);
+                bounds.maximum = glm::max(bounds.maximum, _entityBounds[j].maximum);
+            }
+        } else {
+            const Bounds& firstBounds = _nodes[i + 1].bounds;
+            const Bounds& secondBounds = _nodes[node.first].bounds;
+            bounds.minimum = glm::min(firstBounds.minimum, secondBounds.minimum);
+            bounds.maximum = glm::max(firstBounds.maximum, secondBounds.maximum);
+        }
+        node.bounds = bounds;
+    }
+}
+
+bool EntityBoundsSnapshot::touches(const Bounds& bounds, const Bounds& box) {
+    return glm::all(glm::lessThanEqual(bounds.minimum, box.maximum)) &&
+        glm::all(glm::lessThanEqual(box.minimum, bounds.maximum));
+}
+
+bool EntityBoundsSnapshot::touchesSphere(const Bounds& bounds, const glm::vec3& center, float radiusSquared) {
+    glm::vec3 closestPoint = glm::clamp(center, bounds.minimum, bounds.maximum);
+    return glm::all(glm::lessThanEqual(bounds.minimum, bounds.maximum)) &&
+        glm::dot(closestPoint - center, closestPoint - center) <= radiusSquared;
+}
+
+bool EntityBoundsSnapshot::findRayDistance(const Bounds& bounds, const glm::vec3& origin, const glm::vec3& invDirection,
+                                           float& distance) {
+    if (!glm::all(glm::lessThanEqual(bounds.minimum, bounds.maximum))) {
+        return false;
+    }
+
+    glm::vec3 near = (bounds.minimum - origin) * invDirection;
+    glm::vec3 far = (bounds.maximum - origin) * invDirection;
+    glm::vec3 entry = glm::min(near, far);
+    glm::vec3 exit = glm::max(near, far);
+    float entryDistance = glm::max(glm::max(entry.x, entry.y), glm::max(entry.z, 0.0f));
+    float exitDistance = glm::min(glm::min(exit.x, exit.y), exit.z);
+    if (entryDistance > exitDistance) {
+        return false;
+    }
+    distance = entryDistance;
+    return true;
+}
@@ -0,0 +1,182 @@
+//
+//  EntityBoundsSnapshot.h
+//  libraries/entities/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityBoundsSnapshot_h
+#define hifi_EntityBoundsSnapshot_h
+
+#include <memory>
+#include <vector>
+
+#include <QHash>
+#include <QVector>
+
+#include <glm/glm.hpp>
+
+#include <AABox.h>
+
+#include "EntityItem.h"
+
+class EntityBoundsSnapshot;
+using EntityBoundsSnapshotPointer = std::shared_ptr<const EntityBoundsSnapshot>;
+
+// An immutable bounding volume hierarchy over the world AABoxes of a set of entities. The nodes are laid out flat in
+// depth first order, so a query walks one array instead of the shared pointers and locks of the octree elements.
+// The snapshot holds on to its entities, queries don't need the tree lock and any number of threads can run them.
+// The bounds are only a broadphase, callers still test the entities they are handed.
+class EntityBoundsSnapshot {
+public:
+    static EntityBoundsSnapshotPointer build(const QVector<EntityItemPointer>& entities);
+
+    // A snapshot with the changed entities at their current bounds and the removed ones gone. If only known entities
+    // moved the hierarchy is kept and refit, it is rebuilt when entities are added or the refits have piled up.
+    EntityBoundsSnapshotPointer update(const QVector<EntityItemPointer>& changedEntities,
+                                       const QVector<EntityItemID>& removedEntityIDs) const;
+
+    int getNumEntities() const { return _entityIndices.size(); }
+
+    template <typename F>
+    void forEachEntityTouchingBox(const AABox& box, const F& visitor) const;
+
+    template <typename F>
+    void forEachEntityTouchingSphere(const glm::vec3& center, float radius, const F& visitor) const;
+
+    // Visits the entities whose bounds the ray hits nearer than maxDistance, roughly front to back. The visitor gets
+    // the distance to the bounds and returns the distance still worth searching, the closest hit it has found so far.
+    template <typename F>
+    void forEachEntityOnRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, const F& visitor) const;
+
+private:
+    struct Bounds {
+        glm::vec3 minimum;
+        glm::vec3 maximum;
+    };
+
+    struct Node {
+        Bounds bounds;
+        uint32_t first; // first entity of a leaf, second child of an inner node, the first child follows the node
+        uint32_t count; // number of entities in a leaf, 0 for inner nodes
+    };
+
+    static const uint32_t MAX_ENTITIES_PER_LEAF = 4;
+    static const Bounds EMPTY_BOUNDS;
+
+    void buildNodes();
+    uint32_t buildNode(std::vector<uint32_t>& order, uint32_t begin, uint32_t end);
+    void refit();
+
+    static bool touches(const Bounds& bounds, const Bounds& box);
+    static bool touchesSphere(const Bounds& bounds, const glm::vec3& center, float radiusSquared);
+    static bool findRayDistance(const Bounds& bounds, const glm::vec3& origin, const glm::vec3& invDirection, float& distance);
+
+    template <typename T, typename F>
+    void forEachEntityInNodes(const T& boundsTest, const F& visitor) const;
+
+    std::vector<Node> _nodes;
+    std::vector<Bounds> _entityBounds;
+    std::vector<EntityItemPointer> _entities; // in leaf order, null where an entity was removed since the build
+    QHash<EntityItemID, uint32_t> _entityIndices;
+    int _numChangesSinceBuild { 0 };
+};
+
+template <typename T, typename F>
+void EntityBoundsSnapshot::forEachEntityInNodes(const T& boundsTest, const F& visitor) const {
+    if (_nodes.empty()) {
+        return;
+    }
+
+    uint32_t stack[64];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+        const Node& node = _nodes[stack[--stackSize]];
+        if (!boundsTest(node.bounds)) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                if (_entities[i] && boundsTest(_entityBounds[i])) {
+                    visitor(_entities[i]);
+                }
+            }
+        } else {
+            stack[stackSize++] = node.first;
+            stack[stackSize++] = (uint32_t)(&node - _nodes.data()) + 1;
+        }
+    }
+}
+
+template <typename F>
+void EntityBoundsSnapshot::forEachEntityTouchingBox(const AABox& box, const F& visitor) const {
+    Bounds boxBounds { box.getMinimumPoint(), box.getMaximumPoint() };
+    forEachEntityInNodes([&](const Bounds& bounds) { return touches(bounds, boxBounds); }, visitor);
+}
+
+template <typename F>
+void EntityBoundsSnapshot::forEachEntityTouchingSphere(const glm::vec3& center, float radius, const F& visitor) const {
+    float radiusSquared = radius * radius;
+    forEachEntityInNodes([&](const Bounds& bounds) { return touchesSphere(bounds, center, radiusSquared); }, visitor);
+}
+
+template <typename F>
+void EntityBoundsSnapshot::forEachEntityOnRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                                              const F& visitor) const {
+    if (_nodes.empty()) {
+        return;
+    }
+
+    glm::vec3 invDirection = 1.0f / direction;
+    float distance;
+    if (!findRayDistance(_nodes[0].bounds, origin, invDirection, distance) || distance > maxDistance) {
+        return;
+    }
+
+    struct Entry {
+        uint32_t node;
+        float distance;
+    };
+    Entry stack[64];
+    int stackSize = 0;
+    stack[stackSize++] = { 0, distance };
+    while (stackSize > 0) {
+        Entry entry = stack[--stackSize];
+        if (entry.distance > maxDistance) {
+            continue;
+        }
+
+        const Node& node = _nodes[entry.node];
+        if (node.count > 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                if (_entities[i] && findRayDistance(_entityBounds[i], origin, invDirection, distance) &&
+                    distance <= maxDistance) {
+                    maxDistance = visitor(_entities[i], distance);
+                }
+            }
+            continue;
+        }
+
+        // the nearer child is pushed last, so it is searched first and can cut the farther one off
+        Entry nearChild { entry.node + 1, 0.0f };
+        Entry farChild { node.first, 0.0f };
+        bool hitsNear = findRayDistance(_nodes[nearChild.node].bounds, origin, invDirection, nearChild.distance);
+        bool hitsFar = findRayDistance(_nodes[farChild.node].bounds, origin, invDirection, farChild.distance);
+        if (hitsNear && hitsFar && farChild.distance < nearChild.distance) {
+            std::swap(nearChild, farChild);
+        }
+        if (hitsFar) {
+            stack[stackSize++] = farChild;
+        }
+        if (hitsNear) {
+            stack[stackSize++] = nearChild;
+        }
+    }
+}
+
+#endif // hifi_EntityBoundsSnapshot_h
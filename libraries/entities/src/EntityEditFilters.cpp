@@ -13,6 +13,7 @@
 
 #include <QUrl>
 
+#include <NumericalConstants.h>
 #include <ResourceManager.h>
 #include <shared/ScriptInitializerMixin.h>
 
@@ -44,6 +45,73 @@ QList<EntityItemID> EntityEditFilters::getZonesByPosition(glm::vec3& position) {
 
 bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut,
         bool& wasChanged, EntityTree::FilterType filterType, EntityItemID& itemID, const EntityItemPointer& existingEntity) {
+    auto start = usecTimestampNow();
+    bool accepted = runFilters(position, propertiesIn, propertiesOut, wasChanged, filterType, itemID, existingEntity);
+    auto elapsed = usecTimestampNow() - start;
+
+    LatencyBucket bucket = OVER_100_MSECS;
+    if (elapsed < 100) {
+        bucket = UNDER_100_USECS;
+    } else if (elapsed < USECS_PER_MSEC) {
+        bucket = UNDER_1_MSEC;
+    } else if (elapsed < 10 * USECS_PER_MSEC) {
+        bucket = UNDER_10_MSECS;
+    } else if (elapsed < 100 * USECS_PER_MSEC) {
+        bucket = UNDER_100_MSECS;
+    }
+    _latencyCounts[bucket]++;
+    return accepted;
+}
+
+QString EntityEditFilters::getLatencyBucketName(LatencyBucket bucket) {
+    static const char* LATENCY_BUCKET_NAMES[NUM_LATENCY_BUCKETS] = { "< 0.1 msecs", "< 1 msec", "< 10 msecs", "< 100 msecs",
+                                                                     ">= 100 msecs" };
+    return LATENCY_BUCKET_NAMES[bucket];
+}
+
+int EntityEditFilters::countEdit(const EntityItemID& entityID) {
+    std::unique_lock<std::mutex> lock(_editCountsMutex);
+    auto now = usecTimestampNow();
+    if (now - _editCountsStart >= USECS_PER_SECOND) {
+        _editCounts.clear();
+        _editCountsStart = now;
+    }
+    return ++_editCounts[entityID];
+}
+
+bool EntityEditFilters::passesRules(const FilterRules& rules, const glm::vec3& position, const EntityItemProperties& properties,
+        EntityTree::FilterType filterType, const EntityItemID& entityID) {
+    if (filterType != EntityTree::FilterType::Add && filterType != EntityTree::FilterType::Edit) {
+        return true;
+    }
+
+    if (rules.hasBounds) {
+        glm::vec3 newPosition = properties.positionChanged() ? properties.getPosition() : position;
+        if (glm::any(glm::lessThan(newPosition, rules.boundsMinimum)) ||
+            glm::any(glm::greaterThan(newPosition, rules.boundsMaximum))) {
+            return false;
+        }
+    }
+
+    if (!rules.deniedProperties.empty()) {
+        auto changedProperties = properties.getChangedProperties();
+        for (auto property : rules.deniedProperties) {
+            if (changedProperties.getHasProperty(property)) {
+                return false;
+            }
+        }
+    }
+
+    // the rate is counted for the edits of the entities that exist, the adds don't have their id yet
+    if (rules.maxEditsPerSecond > 0 && filterType == EntityTree::FilterType::Edit && !entityID.isInvalidID() &&
+        countEdit(entityID) > rules.maxEditsPerSecond) {
+        return false;
+    }
+    return true;
+}
+
+bool EntityEditFilters::runFilters(glm::vec3& position, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut,
+        bool& wasChanged, EntityTree::FilterType filterType, EntityItemID& itemID, const EntityItemPointer& existingEntity) {
     
     // get the ids of all the zones (plus the global entity edit filter) that the position
     // lies within
@@ -73,6 +141,16 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
                 return true; // accept the message
             }
 
+            if (!filterData.rules.isEmpty() &&
+                !passesRules(filterData.rules, position, propertiesIn, filterType, itemID)) {
+                _numRejectedByRules++;
+                return false;
+            }
+
+            if (filterData.rulesOnly) {
+                continue;
+            }
+
             auto oldProperties = propertiesIn.getDesiredProperties();
             auto specifiedProperties = propertiesIn.getChangedProperties();
             propertiesIn.setDesiredProperties(specifiedProperties);
@@ -229,6 +307,34 @@ static bool hasCorrectSyntax(const QScriptProgram& program) {
     }
     return true;
 }
+static void rulesFromScriptValue(const QScriptValue& rulesValue, EntityEditFilters::FilterRules& rules) {
+    QScriptValue boundsValue = rulesValue.property("bounds");
+    if (boundsValue.isObject() && boundsValue.property("min").isObject() && boundsValue.property("max").isObject()) {
+        vec3FromScriptValue(boundsValue.property("min"), rules.boundsMinimum);
+        vec3FromScriptValue(boundsValue.property("max"), rules.boundsMaximum);
+        rules.hasBounds = true;
+    }
+
+    QScriptValue deniedPropertiesValue = rulesValue.property("deniedProperties");
+    if (deniedPropertiesValue.isArray()) {
+        auto length = deniedPropertiesValue.property("length").toInteger();
+        for (int i = 0; i < length; i++) {
+            auto propertyName = deniedPropertiesValue.property(i).toString();
+            EntityPropertyInfo propertyInfo;
+            if (EntityItemProperties::getPropertyInfo(propertyName, propertyInfo)) {
+                rules.deniedProperties.push_back(propertyInfo.propertyEnum);
+            } else {
+                qWarning() << "Entity edit filter rules deny an unknown property" << propertyName;
+            }
+        }
+    }
+
+    QScriptValue maxEditsPerSecondValue = rulesValue.property("maxEditsPerSecond");
+    if (maxEditsPerSecondValue.isNumber()) {
+        rules.maxEditsPerSecond = maxEditsPerSecondValue.toInt32();
+    }
+}
+
 static bool hadUncaughtExceptions(QScriptEngine& engine, const QString& fileName) {
     if (engine.hasUncaughtException()) {
         const auto backtrace = engine.uncaughtExceptionBacktrace();
@@ -285,10 +391,20 @@ void EntityEditFilters::scriptRequestFinished(EntityItemID entityID) {
                 entitiesObject.setProperty("DELETE_FILTER_TYPE", EntityTree::FilterType::Delete);
                 global.setProperty("Entities", entitiesObject);
                 filterData.filterFn = global.property("filter");
+                QScriptValue rulesValue = filterData.filterFn.property("rules");
                 if (!filterData.filterFn.isFunction()) {
-                    qDebug() << "Filter function specified but not found. Will reject all edits for those without lock rights.";
-                    delete engine;
-                    filterData.rejectAll=true;
+                    rulesValue = global.property("filterRules");
+                    if (rulesValue.isObject()) {
+                        // only rules, the edits that pass them never go through the script engine
+                        filterData.rulesOnly = true;
+                    } else {
+                        qDebug() << "Filter function specified but not found. Will reject all edits for those without lock rights.";
+                        delete engine;
+                        filterData.rejectAll=true;
+                    }
+                }
+                if (rulesValue.isObject()) {
+                    rulesFromScriptValue(rulesValue, filterData.rules);
                 }
 
                 // if the wantsToFilterEdit is a boolean evaluate as a boolean, otherwise assume true
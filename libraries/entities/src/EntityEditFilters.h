@@ -17,7 +17,10 @@
 #include <QScriptEngine>
 #include <glm/glm.hpp>
 
+#include <array>
+#include <atomic>
 #include <functional>
+#include <mutex>
 
 #include "EntityItemID.h"
 #include "EntityItemProperties.h"
@@ -26,6 +29,21 @@
 class EntityEditFilters : public QObject, public Dependency {
     Q_OBJECT
 public:
+    // the common checks a filter script can declare in filter.rules (or in a global filterRules when it has no
+    // filter function), checked without converting the edit to a script value and before the filter function runs:
+    //   bounds: { min: {x, y, z}, max: {x, y, z} } - rejects adds and edits that put the entity outside of it
+    //   deniedProperties: [ "name", ... ] - rejects adds and edits that change any of these properties
+    //   maxEditsPerSecond: n - rejects the edits of an entity past n in a second
+    struct FilterRules {
+        bool hasBounds { false };
+        glm::vec3 boundsMinimum;
+        glm::vec3 boundsMaximum;
+        std::vector<EntityPropertyList> deniedProperties;
+        int maxEditsPerSecond { 0 };
+
+        bool isEmpty() const { return !hasBounds && deniedProperties.empty() && maxEditsPerSecond <= 0; }
+    };
+
     struct FilterData {
         QScriptValue filterFn;
         bool wantsOriginalProperties { false };
@@ -40,12 +58,15 @@ public:
         EntityPropertyFlags includedZoneProperties;
         bool wantsZoneBoundingBox { false };
 
+        FilterRules rules;
+        bool rulesOnly { false };
+
         std::function<bool()> uncaughtExceptions;
         QScriptEngine* engine;
         bool rejectAll;
         
         FilterData(): engine(nullptr), rejectAll(false) {};
-        bool valid() { return (rejectAll || (engine != nullptr && filterFn.isFunction() && uncaughtExceptions)); }
+        bool valid() { return (rejectAll || (engine != nullptr && (filterFn.isFunction() || rulesOnly) && uncaughtExceptions)); }
     };
 
     EntityEditFilters() {};
@@ -57,6 +78,20 @@ public:
     bool filter(glm::vec3& position, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut, bool& wasChanged, 
                 EntityTree::FilterType filterType, EntityItemID& entityID, const EntityItemPointer& existingEntity);
 
+    // how long the filtering of the edits took, for the stats of the entity server
+    enum LatencyBucket {
+        UNDER_100_USECS = 0,
+        UNDER_1_MSEC,
+        UNDER_10_MSECS,
+        UNDER_100_MSECS,
+        OVER_100_MSECS,
+
+        NUM_LATENCY_BUCKETS
+    };
+    static QString getLatencyBucketName(LatencyBucket bucket);
+    uint64_t getNumFilteredInBucket(LatencyBucket bucket) const { return _latencyCounts[bucket]; }
+    uint64_t getNumRejectedByRules() const { return _numRejectedByRules; }
+
 signals:
     void filterAdded(EntityItemID id, bool success);
 
@@ -66,12 +101,26 @@ private slots:
 private:
     QList<EntityItemID> getZonesByPosition(glm::vec3& position);
 
+    bool runFilters(glm::vec3& position, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut, bool& wasChanged,
+                    EntityTree::FilterType filterType, EntityItemID& entityID, const EntityItemPointer& existingEntity);
+    bool passesRules(const FilterRules& rules, const glm::vec3& position, const EntityItemProperties& properties,
+                     EntityTree::FilterType filterType, const EntityItemID& entityID);
+    int countEdit(const EntityItemID& entityID);
+
     EntityTreePointer _tree {};
     bool _rejectAll {false};
     QScriptValue _nullObjectForFilter{};
     
     QReadWriteLock _lock;
     QMap<EntityItemID, FilterData> _filterDataMap;
+
+    // the edits of each entity since the start of the current second, for maxEditsPerSecond
+    std::mutex _editCountsMutex;
+    QHash<EntityItemID, int> _editCounts;
+    quint64 _editCountsStart { 0 };
+
+    std::array<std::atomic<uint64_t>, NUM_LATENCY_BUCKETS> _latencyCounts {};
+    std::atomic<uint64_t> _numRejectedByRules { 0 };
 };
 
 #endif //hifi_EntityEditFilters_h
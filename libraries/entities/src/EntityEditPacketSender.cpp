@@ -94,6 +94,45 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
         return;
     }
 
+    if (type == PacketType::EntityEdit) {
+        // scripts animating entities edit them every frame, only the merged result has to go to the server
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto heldEdit = _heldEdits.find(entityItemID);
+        if (heldEdit == _heldEdits.end()) {
+            _heldEdits.insert(entityItemID, properties);
+            _heldEditOrder.push_back(entityItemID);
+        } else {
+            heldEdit->merge(properties);
+            heldEdit->setLastEdited(properties.getLastEdited());
+        }
+        return;
+    }
+
+    // the edits held back so far were made before this one, they have to get to the server first
+    queueHeldEditMessages();
+    encodeEditEntityMessage(type, entityItemID, properties);
+}
+
+void EntityEditPacketSender::queueHeldEditMessages() {
+    QHash<EntityItemID, EntityItemProperties> heldEdits;
+    std::vector<EntityItemID> heldEditOrder;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        heldEdits.swap(_heldEdits);
+        heldEditOrder.swap(_heldEditOrder);
+    }
+
+    for (auto& entityItemID : heldEditOrder) {
+        auto heldEdit = heldEdits.find(entityItemID);
+        if (heldEdit != heldEdits.end()) {
+            encodeEditEntityMessage(PacketType::EntityEdit, entityItemID, heldEdit.value());
+            heldEdits.erase(heldEdit);
+        }
+    }
+}
+
+void EntityEditPacketSender::encodeEditEntityMessage(PacketType type, EntityItemID entityItemID,
+                                                     const EntityItemProperties& properties) {
     QByteArray bufferOut(NLPacket::maxPayloadSize(type), 0);
 
     if (type == PacketType::EntityAdd) {
@@ -151,6 +190,12 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
 }
 
 void EntityEditPacketSender::queueEraseEntityMessage(const EntityItemID& entityItemID) {
+    {
+        // no point in sending edits of an entity that is about to be deleted
+        std::lock_guard<std::mutex> lock(_mutex);
+        _heldEdits.remove(entityItemID);
+    }
+    queueHeldEditMessages();
 
     QByteArray bufferOut(NLPacket::maxPayloadSize(PacketType::EntityErase), 0);
 
@@ -160,6 +205,9 @@ void EntityEditPacketSender::queueEraseEntityMessage(const EntityItemID& entityI
 }
 
 void EntityEditPacketSender::queueCloneEntityMessage(const EntityItemID& entityIDToClone, const EntityItemID& newEntityID) {
+    // the clone is made from the entity as the server has it, with the edits made before
+    queueHeldEditMessages();
+
     QByteArray bufferOut(NLPacket::maxPayloadSize(PacketType::EntityClone), 0);
 
     if (EntityItemProperties::encodeCloneEntityMessage(entityIDToClone, newEntityID, bufferOut)) {
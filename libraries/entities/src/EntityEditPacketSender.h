@@ -15,6 +15,9 @@
 #include <OctreeEditPacketSender.h>
 
 #include <mutex>
+#include <vector>
+
+#include <QHash>
 
 #include "EntityItem.h"
 #include "AvatarData.h"
@@ -32,6 +35,8 @@ public:
     /// which voxel-server node or nodes the packet should be sent to. Can be called even before voxel servers are known, in
     /// which case up to MaxPendingMessages will be buffered and processed when voxel servers are known.
     /// NOTE: EntityItemProperties assumes that all distances are in meter units
+    /// Edits of an existing entity are held back until the queued messages are released or the next send interval, and
+    /// the edits of the same entity in the meantime are merged into one property set.
     void queueEditEntityMessage(PacketType type, EntityTreePointer entityTree,
                                 EntityItemID entityItemID, const EntityItemProperties& properties);
 
@@ -43,6 +48,9 @@ public:
     virtual char getMyNodeType() const override { return NodeType::EntityServer; }
     virtual void adjustEditPacketForClockSkew(PacketType type, QByteArray& buffer, qint64 clockSkew) override;
 
+protected:
+    virtual void queueHeldEditMessages() override;
+
 signals:
     void addingEntityWithCertificate(const QString& certificateID, const QString& placeName);
 
@@ -52,9 +60,12 @@ public slots:
 private:
     friend class MyAvatar;
     void queueEditAvatarEntityMessage(EntityTreePointer entityTree, EntityItemID entityItemID);
+    void encodeEditEntityMessage(PacketType type, EntityItemID entityItemID, const EntityItemProperties& properties);
 
 private:
-    std::mutex _mutex;
+    std::mutex _mutex; // protects the held edits
+    QHash<EntityItemID, EntityItemProperties> _heldEdits;
+    std::vector<EntityItemID> _heldEditOrder; // the held edits go out in the order their entities were first edited
     AvatarData* _myAvatar { nullptr };
 };
 #endif // hifi_EntityEditPacketSender_h
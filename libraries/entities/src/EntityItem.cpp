@@ -73,6 +73,19 @@ EntityItem::~EntityItem() {
     assert(!_simulated || (!_element && !_physicsInfo));
     assert(!_element);
     assert(!_physicsInfo);
+
+    clearEncodedData();
+
+    if (_certifiableProperties) {
+        _numWithCertifiableProperties--;
+    }
+}
+
+std::atomic<int> EntityItem::_numWithCertifiableProperties { 0 };
+
+StringPool& EntityItem::getStringPool() {
+    static StringPool stringPool;
+    return stringPool;
 }
 
 EntityPropertyFlags EntityItem::getEntityProperties(EncodeBitstreamParams& params) const {
@@ -196,8 +209,31 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
 
     // If we are being called for a subsequent pass at appendEntityData() that failed to completely encode this item,
     // then our entityTreeElementExtraEncodeData should include data about which properties we need to append.
+    bool isContinuation = false;
     if (entityTreeElementExtraEncodeData && entityTreeElementExtraEncodeData->entities.contains(getEntityItemID())) {
         requestedProperties = entityTreeElementExtraEncodeData->entities.value(getEntityItemID());
+        isContinuation = true;
+    }
+
+    // If nothing we encode changed since our last complete encoding for the same properties, copy it.
+    // Continuations of a partial encoding, and encodings that don't fit in whole, take the regular path.
+    EncodedData encodedDataKey { getLastEdited(), getLastUpdated(), getLastSimulated(), getLastChangedOnServer(),
+                                 requestedProperties, destinationNodeCanGetAndSetPrivateUserData, QByteArray() };
+    bool isEncodedDataCacheEnabled = !isContinuation && _encodedDataCacheLimit > 0;
+    if (isEncodedDataCacheEnabled) {
+        auto encodedData = std::atomic_load(&_encodedData);
+        if (encodedData &&
+            encodedData->lastEdited == encodedDataKey.lastEdited &&
+            encodedData->lastUpdated == encodedDataKey.lastUpdated &&
+            encodedData->lastSimulated == encodedDataKey.lastSimulated &&
+            encodedData->lastChangedOnServer == encodedDataKey.lastChangedOnServer &&
+            encodedData->requestedProperties == encodedDataKey.requestedProperties &&
+            encodedData->includesPrivateUserData == encodedDataKey.includesPrivateUserData &&
+            packetData->appendRawData((const unsigned char*)encodedData->data.constData(), encodedData->data.size())) {
+
+            params.trackSend(getID(), getLastEdited());
+            return OctreeElement::COMPLETED;
+        }
     }
 
     QString privateUserData = "";
@@ -207,6 +243,7 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
 
     EntityPropertyFlags propertiesDidntFit = requestedProperties;
 
+    int startOfEntity = packetData->getUncompressedByteOffset();
     LevelDetails entityLevel = packetData->startLevel();
 
     quint64 lastEdited = getLastEdited();
@@ -379,6 +416,12 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
         }
 
         packetData->endLevel(entityLevel);
+
+        if (isEncodedDataCacheEnabled && appendState == OctreeElement::COMPLETED) {
+            int endOfEntity = packetData->getUncompressedByteOffset();
+            encodedDataKey.data = QByteArray((const char*)packetData->getUncompressedData(startOfEntity), endOfEntity - startOfEntity);
+            storeEncodedData(std::make_shared<const EncodedData>(std::move(encodedDataKey)));
+        }
     } else {
         packetData->discardLevel(entityLevel);
         appendState = OctreeElement::NONE; // if we got here, then we didn't include the item
@@ -1091,7 +1134,7 @@ void EntityItem::setCollisionSoundURL(const QString& value) {
     bool modified = false;
     withWriteLock([&] {
         if (_collisionSoundURL != value) {
-            _collisionSoundURL = value;
+            _collisionSoundURL = getStringPool().intern(value);
             modified = true;
         }
     });
@@ -2599,13 +2642,16 @@ QList<EntityDynamicPointer> EntityItem::getActionsOfType(EntityDynamicType typeT
 
 void EntityItem::locationChanged(bool tellPhysics, bool tellChildren) {
     requiresRecalcBoxes();
+    EntityTreePointer tree = getTree();
     if (tellPhysics) {
         _flags |= Simulation::DIRTY_TRANSFORM;
-        EntityTreePointer tree = getTree();
         if (tree) {
             tree->entityChanged(getThisPointer());
         }
     }
+    if (tree) {
+        tree->entityBoundsChanged(getThisPointer());
+    }
     SpatiallyNestable::locationChanged(tellPhysics, tellChildren);
     std::pair<int32_t, glm::vec4> data(_spaceIndex, glm::vec4(getWorldPosition(), _boundingRadius));
     emit spaceUpdate(data);
@@ -2614,6 +2660,10 @@ void EntityItem::locationChanged(bool tellPhysics, bool tellChildren) {
 
 void EntityItem::dimensionsChanged() {
     requiresRecalcBoxes();
+    EntityTreePointer tree = getTree();
+    if (tree) {
+        tree->entityBoundsChanged(getThisPointer());
+    }
     SpatiallyNestable::dimensionsChanged(); // Do what you have to do
     _boundingRadius = 0.5f * glm::length(getScaledDimensions());
     std::pair<int32_t, glm::vec4> data(_spaceIndex, glm::vec4(getWorldPosition(), _boundingRadius));
@@ -2712,6 +2762,7 @@ void EntityItem::setLastEdited(quint64 lastEdited) {
             _lastEdited = _lastUpdated = lastEdited;
             _changedOnServer = glm::max(lastEdited, _changedOnServer);
         });
+        clearEncodedData();
     }
 }
 
@@ -2719,6 +2770,32 @@ void EntityItem::markAsChangedOnServer() {
     withWriteLock([&] {
         _changedOnServer = usecTimestampNow();
     });
+    clearEncodedData();
+}
+
+std::atomic<int64_t> EntityItem::_encodedDataCacheLimit { 0 };
+std::atomic<int64_t> EntityItem::_encodedDataCacheSize { 0 };
+
+void EntityItem::storeEncodedData(EncodedDataPointer encodedData) const {
+    int64_t size = encodedData->data.size();
+    if (_encodedDataCacheSize + size > _encodedDataCacheLimit) {
+        // over the cap, we'll encode this one every time, but drop what we had that is now stale
+        clearEncodedData();
+        return;
+    }
+
+    _encodedDataCacheSize += size;
+    auto previous = std::atomic_exchange(&_encodedData, encodedData);
+    if (previous) {
+        _encodedDataCacheSize -= previous->data.size();
+    }
+}
+
+void EntityItem::clearEncodedData() const {
+    auto previous = std::atomic_exchange(&_encodedData, EncodedDataPointer());
+    if (previous) {
+        _encodedDataCacheSize -= previous->data.size();
+    }
 }
 
 quint64 EntityItem::getLastChangedOnServer() const {
@@ -2845,8 +2922,9 @@ QString EntityItem::getScript() const {
 }
 
 void EntityItem::setScript(const QString& value) {
+    QString script = getStringPool().intern(value);
     withWriteLock([&] {
-        _script = value;
+        _script = script;
     });
 }
 
@@ -2873,8 +2951,9 @@ QString EntityItem::getServerScripts() const {
 }
 
 void EntityItem::setServerScripts(const QString& serverScripts) {
+    QString internedServerScripts = getStringPool().intern(serverScripts);
     withWriteLock([&] {
-        _serverScripts = serverScripts;
+        _serverScripts = internedServerScripts;
         _serverScriptsChangedTimestamp = usecTimestampNow();
     });
 }
@@ -3101,34 +3180,42 @@ void EntityItem::setPrivateUserData(const QString& value) {
 }
 
 // Certifiable Properties
-#define DEFINE_PROPERTY_GETTER(type, accessor, var) \
+#define DEFINE_PROPERTY_GETTER(type, accessor, var, defaultValue) \
 type EntityItem::get##accessor() const {            \
     type result;         \
     withReadLock([&] {   \
-        result = _##var; \
+        result = _certifiableProperties ? _certifiableProperties->var : defaultValue; \
     });                  \
     return result;       \
 }
 
-#define DEFINE_PROPERTY_SETTER(type, accessor, var)   \
+#define DEFINE_PROPERTY_SETTER(type, accessor, var, defaultValue)   \
 void EntityItem::set##accessor(const type & value) { \
     withWriteLock([&] {                               \
-       _##var = value;                                \
+        if (!_certifiableProperties) {                \
+            if (value == defaultValue) {              \
+                return;                               \
+            }                                         \
+            _certifiableProperties.reset(new CertifiableProperties()); \
+            _numWithCertifiableProperties++;          \
+        }                                             \
+        _certifiableProperties->var = value;          \
     });                                               \
 }
-#define DEFINE_PROPERTY_ACCESSOR(type, accessor, var) DEFINE_PROPERTY_GETTER(type, accessor, var) DEFINE_PROPERTY_SETTER(type, accessor, var)
-DEFINE_PROPERTY_ACCESSOR(QString, ItemName, itemName)
-DEFINE_PROPERTY_ACCESSOR(QString, ItemDescription, itemDescription)
-DEFINE_PROPERTY_ACCESSOR(QString, ItemCategories, itemCategories)
-DEFINE_PROPERTY_ACCESSOR(QString, ItemArtist, itemArtist)
-DEFINE_PROPERTY_ACCESSOR(QString, ItemLicense, itemLicense)
-DEFINE_PROPERTY_ACCESSOR(quint32, LimitedRun, limitedRun)
-DEFINE_PROPERTY_ACCESSOR(QString, MarketplaceID, marketplaceID)
-DEFINE_PROPERTY_ACCESSOR(quint32, EditionNumber, editionNumber)
-DEFINE_PROPERTY_ACCESSOR(quint32, EntityInstanceNumber, entityInstanceNumber)
-DEFINE_PROPERTY_ACCESSOR(QString, CertificateID, certificateID)
-DEFINE_PROPERTY_ACCESSOR(QString, CertificateType, certificateType)
-DEFINE_PROPERTY_ACCESSOR(quint32, StaticCertificateVersion, staticCertificateVersion)
+#define DEFINE_PROPERTY_ACCESSOR(type, accessor, var, defaultValue) \
+    DEFINE_PROPERTY_GETTER(type, accessor, var, defaultValue) DEFINE_PROPERTY_SETTER(type, accessor, var, defaultValue)
+DEFINE_PROPERTY_ACCESSOR(QString, ItemName, itemName, ENTITY_ITEM_DEFAULT_ITEM_NAME)
+DEFINE_PROPERTY_ACCESSOR(QString, ItemDescription, itemDescription, ENTITY_ITEM_DEFAULT_ITEM_DESCRIPTION)
+DEFINE_PROPERTY_ACCESSOR(QString, ItemCategories, itemCategories, ENTITY_ITEM_DEFAULT_ITEM_CATEGORIES)
+DEFINE_PROPERTY_ACCESSOR(QString, ItemArtist, itemArtist, ENTITY_ITEM_DEFAULT_ITEM_ARTIST)
+DEFINE_PROPERTY_ACCESSOR(QString, ItemLicense, itemLicense, ENTITY_ITEM_DEFAULT_ITEM_LICENSE)
+DEFINE_PROPERTY_ACCESSOR(quint32, LimitedRun, limitedRun, ENTITY_ITEM_DEFAULT_LIMITED_RUN)
+DEFINE_PROPERTY_ACCESSOR(QString, MarketplaceID, marketplaceID, ENTITY_ITEM_DEFAULT_MARKETPLACE_ID)
+DEFINE_PROPERTY_ACCESSOR(quint32, EditionNumber, editionNumber, ENTITY_ITEM_DEFAULT_EDITION_NUMBER)
+DEFINE_PROPERTY_ACCESSOR(quint32, EntityInstanceNumber, entityInstanceNumber, ENTITY_ITEM_DEFAULT_ENTITY_INSTANCE_NUMBER)
+DEFINE_PROPERTY_ACCESSOR(QString, CertificateID, certificateID, ENTITY_ITEM_DEFAULT_CERTIFICATE_ID)
+DEFINE_PROPERTY_ACCESSOR(QString, CertificateType, certificateType, ENTITY_ITEM_DEFAULT_CERTIFICATE_TYPE)
+DEFINE_PROPERTY_ACCESSOR(quint32, StaticCertificateVersion, staticCertificateVersion, ENTITY_ITEM_DEFAULT_STATIC_CERTIFICATE_VERSION)
 
 uint32_t EntityItem::getDirtyFlags() const {
     uint32_t result;
@@ -12,6 +12,7 @@
 #ifndef hifi_EntityItem_h
 #define hifi_EntityItem_h
 
+#include <atomic>
 #include <memory>
 #include <stdint.h>
 
@@ -29,6 +30,7 @@
 #include <Transform.h>
 #include <SpatiallyNestable.h>
 #include <Interpolate.h>
+#include <shared/StringPool.h>
 
 #include "EntityItemID.h"
 #include "EntityItemPropertiesDefaults.h"
@@ -139,6 +141,14 @@ public:
                                                         EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
                                                         const bool destinationNodeCanGetAndSetPrivateUserData = false) const;
 
+    // bounds the memory all entities use to keep their last complete encoding for appendEntityData, 0 disables it
+    static void setEncodedDataCacheLimit(int64_t bytes) { _encodedDataCacheLimit = bytes; }
+    static int64_t getEncodedDataCacheSize() { return _encodedDataCacheSize; }
+
+    // the urls and scripts that many entities hold the same copy of are interned in this pool
+    static StringPool& getStringPool();
+    static int getNumWithCertifiableProperties() { return _numWithCertifiableProperties; }
+
     virtual void appendSubclassData(OctreePacketData* packetData, EncodeBitstreamParams& params,
                                     EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
                                     EntityPropertyFlags& requestedProperties,
@@ -662,19 +672,24 @@ protected:
     QString _href; //Hyperlink href
     QString _description; //Hyperlink description
 
-    // Certifiable Properties
-    QString _itemName { ENTITY_ITEM_DEFAULT_ITEM_NAME };
-    QString _itemDescription { ENTITY_ITEM_DEFAULT_ITEM_DESCRIPTION };
-    QString _itemCategories { ENTITY_ITEM_DEFAULT_ITEM_CATEGORIES };
-    QString _itemArtist { ENTITY_ITEM_DEFAULT_ITEM_ARTIST };
-    QString _itemLicense { ENTITY_ITEM_DEFAULT_ITEM_LICENSE };
-    quint32 _limitedRun { ENTITY_ITEM_DEFAULT_LIMITED_RUN };
-    QString _certificateID { ENTITY_ITEM_DEFAULT_CERTIFICATE_ID };
-    QString _certificateType { ENTITY_ITEM_DEFAULT_CERTIFICATE_TYPE };
-    quint32 _editionNumber { ENTITY_ITEM_DEFAULT_EDITION_NUMBER };
-    quint32 _entityInstanceNumber { ENTITY_ITEM_DEFAULT_ENTITY_INSTANCE_NUMBER };
-    QString _marketplaceID { ENTITY_ITEM_DEFAULT_MARKETPLACE_ID };
-    quint32 _staticCertificateVersion { ENTITY_ITEM_DEFAULT_STATIC_CERTIFICATE_VERSION };
+    // Certifiable Properties, only the entities from the marketplace have them so they are allocated once one of them
+    // is set to something other than its default
+    struct CertifiableProperties {
+        QString itemName { ENTITY_ITEM_DEFAULT_ITEM_NAME };
+        QString itemDescription { ENTITY_ITEM_DEFAULT_ITEM_DESCRIPTION };
+        QString itemCategories { ENTITY_ITEM_DEFAULT_ITEM_CATEGORIES };
+        QString itemArtist { ENTITY_ITEM_DEFAULT_ITEM_ARTIST };
+        QString itemLicense { ENTITY_ITEM_DEFAULT_ITEM_LICENSE };
+        quint32 limitedRun { ENTITY_ITEM_DEFAULT_LIMITED_RUN };
+        QString certificateID { ENTITY_ITEM_DEFAULT_CERTIFICATE_ID };
+        QString certificateType { ENTITY_ITEM_DEFAULT_CERTIFICATE_TYPE };
+        quint32 editionNumber { ENTITY_ITEM_DEFAULT_EDITION_NUMBER };
+        quint32 entityInstanceNumber { ENTITY_ITEM_DEFAULT_ENTITY_INSTANCE_NUMBER };
+        QString marketplaceID { ENTITY_ITEM_DEFAULT_MARKETPLACE_ID };
+        quint32 staticCertificateVersion { ENTITY_ITEM_DEFAULT_STATIC_CERTIFICATE_VERSION };
+    };
+    std::unique_ptr<CertifiableProperties> _certifiableProperties;
+    static std::atomic<int> _numWithCertifiableProperties;
 
 
     // NOTE: Damping is applied like this:  v *= pow(1 - damping, dt)
@@ -770,6 +785,27 @@ protected:
     mutable bool _needsRenderUpdate { false };
 
 private:
+    // The bytes appendEntityData wrote for the last complete encoding of this entity, along with everything
+    // they depend on, so that the next viewers asking for the same properties get a copy instead of a re-encode.
+    struct EncodedData {
+        quint64 lastEdited;
+        quint64 lastUpdated;
+        quint64 lastSimulated;
+        quint64 lastChangedOnServer;
+        EntityPropertyFlags requestedProperties;
+        bool includesPrivateUserData;
+        QByteArray data;
+    };
+    using EncodedDataPointer = std::shared_ptr<const EncodedData>;
+
+    void storeEncodedData(EncodedDataPointer encodedData) const;
+    void clearEncodedData() const;
+
+    // send threads encode the same entity concurrently, so this is only accessed with std::atomic_load/exchange
+    mutable EncodedDataPointer _encodedData;
+    static std::atomic<int64_t> _encodedDataCacheLimit;
+    static std::atomic<int64_t> _encodedDataCacheSize;
+
     static std::function<glm::quat(const glm::vec3&, const glm::quat&, BillboardMode, const glm::vec3&)> _getBillboardRotationOperator;
     static std::function<glm::vec3()> _getPrimaryViewFrustumPositionOperator;
 };
@@ -21,6 +21,8 @@ namespace EntityJSONQueryProperties {
     static const QString FLAGS_PROPERTY = "flags";
     static const QString INCLUDE_ANCESTORS_PROPERTY = "includeAncestors";
     static const QString INCLUDE_DESCENDANTS_PROPERTY = "includeDescendants";
+    // the boxes and spheres the entities are sent from, see DiffTraversal::QueryRegion
+    static const QString REGIONS_PROPERTY = "regions";
 }
 
 class EntityNodeData : public OctreeQueryNode {
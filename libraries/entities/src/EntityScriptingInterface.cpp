@@ -776,104 +776,266 @@ QScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(QScri
     return finalResult;
 }
 
+QScriptValue EntityScriptingInterface::getMultipleEntityPropertyArrays(QScriptContext* context, QScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_IDS = 0;
+    const int ARGUMENT_DESIRED_PROPERTIES = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityIDs = qscriptvalue_cast<QVector<QUuid>>(context->argument(ARGUMENT_ENTITY_IDS));
+    QStringList propertyNames;
+    QScriptValue desiredProperties = context->argument(ARGUMENT_DESIRED_PROPERTIES);
+    if (desiredProperties.isString()) {
+        propertyNames << desiredProperties.toString();
+    } else if (desiredProperties.isArray()) {
+        const quint32 length = desiredProperties.property("length").toInt32();
+        for (quint32 i = 0; i < length; i++) {
+            propertyNames << desiredProperties.property(i).toString();
+        }
+    }
+    return entityScriptingInterface->getMultipleEntityPropertyArraysInternal(engine, entityIDs, propertyNames);
+}
+
+QScriptValue EntityScriptingInterface::getMultipleEntityPropertyArraysInternal(QScriptEngine* engine, const QVector<QUuid>& entityIDs,
+                                                                              const QStringList& propertyNames) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    enum ArrayProperty {
+        POSITION = 0,
+        ROTATION,
+        VELOCITY,
+        ANGULAR_VELOCITY,
+        DIMENSIONS,
+        LOCAL_POSITION,
+        LOCAL_ROTATION,
+        LOCAL_VELOCITY,
+        LOCAL_ANGULAR_VELOCITY,
+        LOCAL_DIMENSIONS,
+        NUM_ARRAY_PROPERTIES
+    };
+    static const QString ARRAY_PROPERTY_NAMES[NUM_ARRAY_PROPERTIES] = {
+        "position", "rotation", "velocity", "angularVelocity", "dimensions",
+        "localPosition", "localRotation", "localVelocity", "localAngularVelocity", "localDimensions"
+    };
+
+    // the arrays of the properties that were asked for, with the components of every entity one after the other
+    int size = entityIDs.size();
+    QByteArray found(size, 0);
+    QByteArray values[NUM_ARRAY_PROPERTIES];
+    float* data[NUM_ARRAY_PROPERTIES] = { nullptr };
+    for (int property = 0; property < NUM_ARRAY_PROPERTIES; property++) {
+        if (propertyNames.contains(ARRAY_PROPERTY_NAMES[property])) {
+            int numComponents = (property == ROTATION || property == LOCAL_ROTATION) ? 4 : 3;
+            values[property] = QByteArray(size * numComponents * (int)sizeof(float), 0);
+            data[property] = reinterpret_cast<float*>(values[property].data());
+        }
+    }
+    auto writeVector = [&](int property, int index, const glm::vec3& value) {
+        if (data[property]) {
+            float* components = data[property] + 3 * index;
+            components[0] = value.x;
+            components[1] = value.y;
+            components[2] = value.z;
+        }
+    };
+    auto writeRotation = [&](int property, int index, const glm::quat& value) {
+        if (data[property]) {
+            float* components = data[property] + 4 * index;
+            components[0] = value.x;
+            components[1] = value.y;
+            components[2] = value.z;
+            components[3] = value.w;
+        }
+    };
+
+    if (_entityTree) {
+        // read straight from the entities, without going through their EntityItemProperties
+        int i = 0;
+        const int lockAmount = 500;
+        while (i < size) {
+            _entityTree->withReadLock([&] {
+                for (int j = 0; j < lockAmount && i < size; ++i, ++j) {
+                    const EntityItemPointer entity = _entityTree->findEntityByEntityItemID(EntityItemID(entityIDs.at(i)));
+                    if (!entity) {
+                        continue;
+                    }
+                    found[i] = 1;
+                    writeVector(POSITION, i, entity->getWorldPosition());
+                    writeRotation(ROTATION, i, entity->getWorldOrientation());
+                    writeVector(VELOCITY, i, entity->getWorldVelocity());
+                    writeVector(ANGULAR_VELOCITY, i, entity->getWorldAngularVelocity());
+                    writeVector(DIMENSIONS, i, entity->getScaledDimensions());
+                    writeVector(LOCAL_POSITION, i, entity->getLocalPosition());
+                    writeRotation(LOCAL_ROTATION, i, entity->getLocalOrientation());
+                    writeVector(LOCAL_VELOCITY, i, entity->getLocalVelocity());
+                    writeVector(LOCAL_ANGULAR_VELOCITY, i, entity->getLocalAngularVelocity());
+                    writeVector(LOCAL_DIMENSIONS, i, entity->getUnscaledDimensions());
+                }
+            });
+        }
+    }
+
+    // the engines of the scripts have the typed arrays, which view the ArrayBuffers made from the QByteArrays
+    auto toTypedArray = [&](const QByteArray& bytes, const QString& typeName) {
+        return engine->globalObject().property(typeName).construct(QScriptValueList() << engine->toScriptValue(bytes));
+    };
+    QScriptValue result = engine->newObject();
+    result.setProperty("found", toTypedArray(found, "Uint8Array"));
+    for (int property = 0; property < NUM_ARRAY_PROPERTIES; property++) {
+        if (data[property]) {
+            result.setProperty(ARRAY_PROPERTY_NAMES[property], toTypedArray(values[property], "Float32Array"));
+        }
+    }
+    return result;
+}
+
 QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProperties& scriptSideProperties) {
+    return editEntitiesInternal({ id }, { scriptSideProperties }).at(0);
+}
+
+QScriptValue EntityScriptingInterface::editEntities(QScriptContext* context, QScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_IDS = 0;
+    const int ARGUMENT_PROPERTIES = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityIDs = qscriptvalue_cast<QVector<QUuid>>(context->argument(ARGUMENT_ENTITY_IDS));
+    QScriptValue propertiesValue = context->argument(ARGUMENT_PROPERTIES);
+
+    QVector<EntityItemProperties> properties(entityIDs.size());
+    if (propertiesValue.isArray()) {
+        for (int i = 0; i < entityIDs.size(); i++) {
+            EntityItemPropertiesFromScriptValueHonorReadOnly(propertiesValue.property(i), properties[i]);
+        }
+    } else {
+        // the same edit for every entity
+        EntityItemProperties sharedProperties;
+        EntityItemPropertiesFromScriptValueHonorReadOnly(propertiesValue, sharedProperties);
+        properties.fill(sharedProperties);
+    }
+
+    auto editedIDs = entityScriptingInterface->editEntitiesInternal(entityIDs, properties);
+    QScriptValue result = engine->newArray(editedIDs.size());
+    for (int i = 0; i < editedIDs.size(); i++) {
+        result.setProperty(i, engine->toScriptValue(editedIDs[i]));
+    }
+    return result;
+}
+
+QVector<QUuid> EntityScriptingInterface::editEntitiesInternal(const QVector<QUuid>& ids,
+                                                              QVector<EntityItemProperties> propertiesList) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
-    _activityTracking.editedEntityCount++;
+    int numEdits = ids.size();
+    _activityTracking.editedEntityCount += numEdits;
 
     const auto sessionID = DependencyManager::get<NodeList>()->getSessionUUID();
 
-    EntityItemProperties properties = scriptSideProperties;
+    // the ID of each entity, or null if its edit failed
+    QVector<QUuid> results = ids;
+    QVector<bool> failed(numEdits, false);
 
-    EntityItemID entityID(id);
     if (!_entityTree) {
-        properties.setLastEditedBy(sessionID);
-        queueEntityMessage(PacketType::EntityEdit, entityID, properties);
-        return id;
+        for (int i = 0; i < numEdits; i++) {
+            propertiesList[i].setLastEditedBy(sessionID);
+            queueEntityMessage(PacketType::EntityEdit, EntityItemID(ids[i]), propertiesList[i]);
+        }
+        return results;
     }
 
-    EntityItemPointer entity(nullptr);
-    SimulationOwner simulationOwner;
+    QVector<EntityItemPointer> entities(numEdits);
+    QVector<SimulationOwner> simulationOwners(numEdits);
     _entityTree->withReadLock([&] {
-        // make a copy of entity for local logic outside of tree lock
-        entity = _entityTree->findEntityByEntityItemID(entityID);
-        if (!entity) {
-            return;
-        }
+        for (int i = 0; i < numEdits; i++) {
+            // make a copy of entity for local logic outside of tree lock
+            entities[i] = _entityTree->findEntityByEntityItemID(EntityItemID(ids[i]));
+            if (!entities[i]) {
+                continue;
+            }
 
-        if (entity->isAvatarEntity() && !entity->isMyAvatarEntity()) {
-            // don't edit other avatar's avatarEntities
-            properties = EntityItemProperties();
-            return;
+            if (entities[i]->isAvatarEntity() && !entities[i]->isMyAvatarEntity()) {
+                // don't edit other avatar's avatarEntities
+                propertiesList[i] = EntityItemProperties();
+                continue;
+            }
+            // make a copy of simulationOwner for local logic outside of tree lock
+            simulationOwners[i] = entities[i]->getSimulationOwner();
         }
-        // make a copy of simulationOwner for local logic outside of tree lock
-        simulationOwner = entity->getSimulationOwner();
     });
 
-    QString previousUserdata;
-    if (entity) {
-        if (properties.hasTransformOrVelocityChanges() && entity->hasGrabs()) {
-            // if an entity is grabbed, the grab will override any position changes
-            properties.clearTransformOrVelocityChanges();
-        }
-        if (properties.hasSimulationRestrictedChanges()) {
-            if (_bidOnSimulationOwnership) {
-                // flag for simulation ownership, or upgrade existing ownership priority
-                // (actual bids for simulation ownership are sent by the PhysicalEntitySimulation)
-                entity->upgradeScriptSimulationPriority(properties.computeSimulationBidPriority());
-                if (entity->isLocalEntity() || entity->isMyAvatarEntity() || simulationOwner.getID() == sessionID) {
-                    // we own the simulation --> copy ALL restricted properties
-                    properties.copySimulationRestrictedProperties(entity);
-                } else {
-                    // we don't own the simulation but think we would like to
-
-                    uint8_t desiredPriority = entity->getScriptSimulationPriority();
-                    if (desiredPriority < simulationOwner.getPriority()) {
-                        // the priority at which we'd like to own it is not high enough
-                        // --> assume failure and clear all restricted property changes
-                        properties.clearSimulationRestrictedProperties();
-                    } else {
-                        // the priority at which we'd like to own it is high enough to win.
-                        // --> assume success and copy ALL restricted properties
+    for (int i = 0; i < numEdits; i++) {
+        EntityItemProperties& properties = propertiesList[i];
+        const EntityItemPointer& entity = entities[i];
+        const SimulationOwner& simulationOwner = simulationOwners[i];
+
+        QString previousUserdata;
+        if (entity) {
+            if (properties.hasTransformOrVelocityChanges() && entity->hasGrabs()) {
+                // if an entity is grabbed, the grab will override any position changes
+                properties.clearTransformOrVelocityChanges();
+            }
+            if (properties.hasSimulationRestrictedChanges()) {
+                if (_bidOnSimulationOwnership) {
+                    // flag for simulation ownership, or upgrade existing ownership priority
+                    // (actual bids for simulation ownership are sent by the PhysicalEntitySimulation)
+                    entity->upgradeScriptSimulationPriority(properties.computeSimulationBidPriority());
+                    if (entity->isLocalEntity() || entity->isMyAvatarEntity() || simulationOwner.getID() == sessionID) {
+                        // we own the simulation --> copy ALL restricted properties
                         properties.copySimulationRestrictedProperties(entity);
+                    } else {
+                        // we don't own the simulation but think we would like to
+
+                        uint8_t desiredPriority = entity->getScriptSimulationPriority();
+                        if (desiredPriority < simulationOwner.getPriority()) {
+                            // the priority at which we'd like to own it is not high enough
+                            // --> assume failure and clear all restricted property changes
+                            properties.clearSimulationRestrictedProperties();
+                        } else {
+                            // the priority at which we'd like to own it is high enough to win.
+                            // --> assume success and copy ALL restricted properties
+                            properties.copySimulationRestrictedProperties(entity);
+                        }
                     }
+                } else if (!simulationOwner.getID().isNull()) {
+                    // someone owns this but not us
+                    // clear restricted properties
+                    properties.clearSimulationRestrictedProperties();
                 }
-            } else if (!simulationOwner.getID().isNull()) {
-                // someone owns this but not us
-                // clear restricted properties
-                properties.clearSimulationRestrictedProperties();
+                // clear the cached simulationPriority level
+                entity->upgradeScriptSimulationPriority(0);
             }
-            // clear the cached simulationPriority level
-            entity->upgradeScriptSimulationPriority(0);
-        }
 
-        // set these to make EntityItemProperties::getScalesWithParent() work correctly
-        entity::HostType entityHostType = entity->getEntityHostType();
-        properties.setEntityHostType(entityHostType);
-        if (entityHostType == entity::HostType::LOCAL) {
-            properties.setCollisionless(true);
-        }
-        properties.setOwningAvatarID(entity->getOwningAvatarID());
+            // set these to make EntityItemProperties::getScalesWithParent() work correctly
+            entity::HostType entityHostType = entity->getEntityHostType();
+            properties.setEntityHostType(entityHostType);
+            if (entityHostType == entity::HostType::LOCAL) {
+                properties.setCollisionless(true);
+            }
+            properties.setOwningAvatarID(entity->getOwningAvatarID());
 
-        // make sure the properties has a type, so that the encode can know which properties to include
-        properties.setType(entity->getType());
+            // make sure the properties has a type, so that the encode can know which properties to include
+            properties.setType(entity->getType());
 
-        previousUserdata = entity->getUserData();
-    } else if (_bidOnSimulationOwnership) {
-        // bail when simulation participants don't know about entity
-        return QUuid();
-    }
-    // TODO: it is possible there is no remaining useful changes in properties and we should bail early.
-    // How to check for this cheaply?
+            previousUserdata = entity->getUserData();
+        } else if (_bidOnSimulationOwnership) {
+            // bail when simulation participants don't know about entity
+            failed[i] = true;
+            results[i] = QUuid();
+            continue;
+        }
+        // TODO: it is possible there is no remaining useful changes in properties and we should bail early.
+        // How to check for this cheaply?
 
-    properties = convertPropertiesFromScriptSemantics(properties, properties.getScalesWithParent());
-    synchronizeEditedGrabProperties(properties, previousUserdata);
-    properties.setLastEditedBy(sessionID);
+        properties = convertPropertiesFromScriptSemantics(properties, properties.getScalesWithParent());
+        synchronizeEditedGrabProperties(properties, previousUserdata);
+        properties.setLastEditedBy(sessionID);
+    }
 
     // done reading and modifying properties --> start write
-    bool updatedEntity = false;
     _entityTree->withWriteLock([&] {
-        updatedEntity = _entityTree->updateEntity(entityID, properties);
+        for (int i = 0; i < numEdits; i++) {
+            if (!failed[i]) {
+                _entityTree->updateEntity(EntityItemID(ids[i]), propertiesList[i]);
+            }
+        }
     });
 
     // FIXME: We need to figure out a better way to handle this. Allowing these edits to go through potentially
@@ -885,80 +1047,96 @@ QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProp
     //     return QUuid();
     // }
 
-    bool hasQueryAACubeRelatedChanges = properties.queryAACubeRelatedPropertyChanged();
     // done writing, send update
     _entityTree->withReadLock([&] {
-        // find the entity again: maybe it was removed since we last found it
-        entity = _entityTree->findEntityByEntityItemID(entityID);
-        if (entity) {
-            uint64_t now = usecTimestampNow();
-            entity->setLastBroadcast(now);
-
-            if (hasQueryAACubeRelatedChanges) {
-                properties.setQueryAACube(entity->getQueryAACube());
-
-                // if we've moved an entity with children, check/update the queryAACube of all descendents and tell the server
-                // if they've changed.
-                entity->forEachDescendant([&](SpatiallyNestablePointer descendant) {
-                    if (descendant->getNestableType() == NestableType::Entity) {
-                        if (descendant->updateQueryAACube()) {
-                            EntityItemPointer entityDescendant = std::static_pointer_cast<EntityItem>(descendant);
-                            EntityItemProperties newQueryCubeProperties;
-                            newQueryCubeProperties.setQueryAACube(descendant->getQueryAACube());
-                            newQueryCubeProperties.setLastEdited(properties.getLastEdited());
-                            queueEntityMessage(PacketType::EntityEdit, descendant->getID(), newQueryCubeProperties);
-                            entityDescendant->setLastBroadcast(now);
+        uint64_t now = usecTimestampNow();
+        for (int i = 0; i < numEdits; i++) {
+            if (failed[i]) {
+                continue;
+            }
+            EntityItemProperties& properties = propertiesList[i];
+
+            // find the entity again: maybe it was removed since we last found it
+            EntityItemPointer& entity = entities[i];
+            entity = _entityTree->findEntityByEntityItemID(EntityItemID(ids[i]));
+            if (entity) {
+                entity->setLastBroadcast(now);
+
+                if (properties.queryAACubeRelatedPropertyChanged()) {
+                    properties.setQueryAACube(entity->getQueryAACube());
+
+                    // if we've moved an entity with children, check/update the queryAACube of all descendents and tell the server
+                    // if they've changed.
+                    entity->forEachDescendant([&](SpatiallyNestablePointer descendant) {
+                        if (descendant->getNestableType() == NestableType::Entity) {
+                            if (descendant->updateQueryAACube()) {
+                                EntityItemPointer entityDescendant = std::static_pointer_cast<EntityItem>(descendant);
+                                EntityItemProperties newQueryCubeProperties;
+                                newQueryCubeProperties.setQueryAACube(descendant->getQueryAACube());
+                                newQueryCubeProperties.setLastEdited(properties.getLastEdited());
+                                queueEntityMessage(PacketType::EntityEdit, descendant->getID(), newQueryCubeProperties);
+                                entityDescendant->setLastBroadcast(now);
+                            }
                         }
-                    }
-                });
+                    });
+                }
             }
         }
     });
-    if (!entity) {
-        if (hasQueryAACubeRelatedChanges) {
-            // Sometimes ESS don't have the entity they are trying to edit in their local tree.  In this case,
-            // convertPropertiesFromScriptSemantics doesn't get called and local* edits will get dropped.
-            // This is because, on the script side, "position" is in world frame, but in the network
-            // protocol and in the internal data-structures, "position" is "relative to parent".
-            // Compensate here.  The local* versions will get ignored during the edit-packet encoding.
-            if (properties.localPositionChanged()) {
-                properties.setPosition(properties.getLocalPosition());
-            }
-            if (properties.localRotationChanged()) {
-                properties.setRotation(properties.getLocalRotation());
-            }
-            if (properties.localVelocityChanged()) {
-                properties.setVelocity(properties.getLocalVelocity());
-            }
-            if (properties.localAngularVelocityChanged()) {
-                properties.setAngularVelocity(properties.getLocalAngularVelocity());
-            }
-            if (properties.localDimensionsChanged()) {
-                properties.setDimensions(properties.getLocalDimensions());
+
+    for (int i = 0; i < numEdits; i++) {
+        if (failed[i]) {
+            continue;
+        }
+        EntityItemProperties& properties = propertiesList[i];
+
+        if (!entities[i]) {
+            if (properties.queryAACubeRelatedPropertyChanged()) {
+                // Sometimes ESS don't have the entity they are trying to edit in their local tree.  In this case,
+                // convertPropertiesFromScriptSemantics doesn't get called and local* edits will get dropped.
+                // This is because, on the script side, "position" is in world frame, but in the network
+                // protocol and in the internal data-structures, "position" is "relative to parent".
+                // Compensate here.  The local* versions will get ignored during the edit-packet encoding.
+                if (properties.localPositionChanged()) {
+                    properties.setPosition(properties.getLocalPosition());
+                }
+                if (properties.localRotationChanged()) {
+                    properties.setRotation(properties.getLocalRotation());
+                }
+                if (properties.localVelocityChanged()) {
+                    properties.setVelocity(properties.getLocalVelocity());
+                }
+                if (properties.localAngularVelocityChanged()) {
+                    properties.setAngularVelocity(properties.getLocalAngularVelocity());
+                }
+                if (properties.localDimensionsChanged()) {
+                    properties.setDimensions(properties.getLocalDimensions());
+                }
             }
-        }
-        // we've made an edit to an entity we don't know about, or to a non-entity.  If it's a known non-entity,
-        // print a warning and don't send an edit packet to the entity-server.
-        QSharedPointer<SpatialParentFinder> parentFinder = DependencyManager::get<SpatialParentFinder>();
-        if (parentFinder) {
-            bool success;
-            auto nestableWP = parentFinder->find(id, success, static_cast<SpatialParentTree*>(_entityTree.get()));
-            if (success) {
-                auto nestable = nestableWP.lock();
-                if (nestable) {
-                    NestableType nestableType = nestable->getNestableType();
-                    if (nestableType == NestableType::Avatar) {
-                        qCWarning(entities) << "attempted edit on non-entity: " << id << nestable->getName();
-                        return QUuid(); // null script value to indicate failure
+            // we've made an edit to an entity we don't know about, or to a non-entity.  If it's a known non-entity,
+            // print a warning and don't send an edit packet to the entity-server.
+            QSharedPointer<SpatialParentFinder> parentFinder = DependencyManager::get<SpatialParentFinder>();
+            if (parentFinder) {
+                bool success;
+                auto nestableWP = parentFinder->find(ids[i], success, static_cast<SpatialParentTree*>(_entityTree.get()));
+                if (success) {
+                    auto nestable = nestableWP.lock();
+                    if (nestable) {
+                        NestableType nestableType = nestable->getNestableType();
+                        if (nestableType == NestableType::Avatar) {
+                            qCWarning(entities) << "attempted edit on non-entity: " << ids[i] << nestable->getName();
+                            results[i] = QUuid(); // null script value to indicate failure
+                            continue;
+                        }
                     }
                 }
             }
         }
+        // we queue edit packets even if we don't know about the entity.  This is to allow AC agents
+        // to edit entities they know only by ID.
+        queueEntityMessage(PacketType::EntityEdit, EntityItemID(ids[i]), properties);
     }
-    // we queue edit packets even if we don't know about the entity.  This is to allow AC agents
-    // to edit entities they know only by ID.
-    queueEntityMessage(PacketType::EntityEdit, entityID, properties);
-    return id;
+    return results;
 }
 
 void EntityScriptingInterface::deleteEntity(const QUuid& id) {
@@ -203,6 +203,51 @@ public:
     static QScriptValue getMultipleEntityProperties(QScriptContext* context, QScriptEngine* engine);
     QScriptValue getMultipleEntityPropertiesInternal(QScriptEngine* engine, QVector<QUuid> entityIDs, const QScriptValue& extendedDesiredProperties);
 
+    /**jsdoc
+     * Gets the transform properties of multiple entities as typed arrays, which is faster than getting them as objects when
+     * polling many entities.  The properties are read directly from the entities.
+     * @function Entities.getMultipleEntityPropertyArrays
+     * @param {Uuid[]} entityIDs - The IDs of the entities to get the properties of.
+     * @param {string[]|string} desiredProperties - The name or names of the properties to get, of
+     *     <code>"position"</code>, <code>"rotation"</code>, <code>"velocity"</code>, <code>"angularVelocity"</code>,
+     *     <code>"dimensions"</code>, <code>"localPosition"</code>, <code>"localRotation"</code>, <code>"localVelocity"</code>,
+     *     <code>"localAngularVelocity"</code> and <code>"localDimensions"</code>.
+     * @returns {object} A <code>found</code> Uint8Array that is <code>1</code> for each entity that was found, and a
+     *     Float32Array for each desired property that has the <code>x, y, z</code> components (<code>x, y, z, w</code> for the
+     *     rotations) of each entity one after the other, in the order of <code>entityIDs</code>.  The values of the entities
+     *     that weren't found are zeros.
+     * @example <caption>Report the positions of the nearby entities.</caption>
+     * var entityIDs = Entities.findEntities(MyAvatar.position, 50);
+     * var arrays = Entities.getMultipleEntityPropertyArrays(entityIDs, "position");
+     * for (var i = 0; i < entityIDs.length; i++) {
+     *     if (arrays.found[i]) {
+     *         print(entityIDs[i], arrays.position[3 * i], arrays.position[3 * i + 1], arrays.position[3 * i + 2]);
+     *     }
+     * }
+     */
+    static QScriptValue getMultipleEntityPropertyArrays(QScriptContext* context, QScriptEngine* engine);
+    QScriptValue getMultipleEntityPropertyArraysInternal(QScriptEngine* engine, const QVector<QUuid>& entityIDs,
+                                                         const QStringList& propertyNames);
+
+    /**jsdoc
+     * Edits multiple entities, with one lock of the tree for all of them instead of one per entity.
+     * @function Entities.editEntities
+     * @param {Uuid[]} entityIDs - The IDs of the entities to edit.
+     * @param {Entities.EntityProperties[]|Entities.EntityProperties} properties - The new property values of each entity, in
+     *     the order of <code>entityIDs</code>, or the new property values of all of them.
+     * @returns {Uuid[]} For each entity, its ID if the edit was successful, otherwise <code>null</code> or
+     *     {@link Uuid|Uuid.NULL}.
+     * @example <caption>Move the nearby entities up.</caption>
+     * var entityIDs = Entities.findEntities(MyAvatar.position, 10);
+     * var arrays = Entities.getMultipleEntityPropertyArrays(entityIDs, "position");
+     * var edits = entityIDs.map(function (entityID, i) {
+     *     return { position: { x: arrays.position[3 * i], y: arrays.position[3 * i + 1] + 1, z: arrays.position[3 * i + 2] } };
+     * });
+     * Entities.editEntities(entityIDs, edits);
+     */
+    static QScriptValue editEntities(QScriptContext* context, QScriptEngine* engine);
+    QVector<QUuid> editEntitiesInternal(const QVector<QUuid>& entityIDs, QVector<EntityItemProperties> properties);
+
     QUuid addEntityInternal(const EntityItemProperties& properties, entity::HostType entityHostType);
 
 public slots:
@@ -21,9 +21,13 @@ void EntitySimulation::setEntityTree(EntityTreePointer tree) {
     if (_entityTree && _entityTree != tree) {
         _entitiesToSort.clear();
         _simpleKinematicEntities.clear();
-        _changedEntities.clear();
+        {
+            std::unique_lock<std::mutex> lock(_changedEntitiesMutex);
+            _changedEntities.clear();
+        }
         _entitiesToUpdate.clear();
         _mortalEntities.clear();
+        _mortalExpiries = decltype(_mortalExpiries)();
         _nextExpiry = std::numeric_limits<uint64_t>::max();
     }
     _entityTree = tree;
@@ -69,29 +73,50 @@ void EntitySimulation::prepareEntityForDelete(EntityItemPointer entity) {
 // protected
 void EntitySimulation::expireMortalEntities(uint64_t now) {
     if (now > _nextExpiry) {
-        PROFILE_RANGE_EX(simulation_physics, "ExpireMortals", 0xffff00ff, (uint64_t)_mortalEntities.size());
-        // only search for expired entities if we expect to find one
-        _nextExpiry = std::numeric_limits<uint64_t>::max();
         QMutexLocker lock(&_mutex);
-        SetOfEntities::iterator itemItr = _mortalEntities.begin();
-        while (itemItr != _mortalEntities.end()) {
-            EntityItemPointer entity = *itemItr;
+        PROFILE_RANGE_EX(simulation_physics, "ExpireMortals", 0xffff00ff, (uint64_t)_mortalExpiries.size());
+        // only the expiries that passed come out of the queue
+        while (!_mortalExpiries.empty() && _mortalExpiries.top().expiry < now) {
+            EntityItemPointer entity = _mortalExpiries.top().entity.lock();
+            _mortalExpiries.pop();
+            if (!entity || !_mortalEntities.contains(entity)) {
+                continue;
+            }
             uint64_t expiry = entity->getExpiry();
             if (expiry < now) {
-                itemItr = _mortalEntities.erase(itemItr);
+                _mortalEntities.remove(entity);
                 entity->die();
                 prepareEntityForDelete(entity);
             } else {
-                if (expiry < _nextExpiry) {
-                    // remember the smallest _nextExpiry so we know when to start the next search
-                    _nextExpiry = expiry;
-                }
-                ++itemItr;
+                // the lifetime was extended
+                _mortalExpiries.push({ expiry, entity });
             }
         }
-        if (_mortalEntities.size() < 1) {
-            _nextExpiry = -1;
+        _nextExpiry = _mortalExpiries.empty() ? std::numeric_limits<uint64_t>::max() : _mortalExpiries.top().expiry;
+    }
+}
+
+// protected: _mutex lock is guaranteed
+void EntitySimulation::addMortalEntity(const EntityItemPointer& entity) {
+    _mortalEntities.insert(entity);
+    uint64_t expiry = entity->getExpiry();
+
+    // the stale entries of the entities that were removed or changed their lifetime are dropped once they outnumber
+    // the mortal entities, so that the queue doesn't grow with the entities that come and go
+    const size_t MIN_EXPIRIES_TO_COMPACT = 64;
+    if (_mortalExpiries.size() > MIN_EXPIRIES_TO_COMPACT && _mortalExpiries.size() > 2 * (size_t)_mortalEntities.size()) {
+        std::vector<MortalExpiry> expiries;
+        expiries.reserve(_mortalEntities.size());
+        for (const auto& mortalEntity : _mortalEntities) {
+            expiries.push_back({ mortalEntity->getExpiry(), mortalEntity });
         }
+        _mortalExpiries = decltype(_mortalExpiries)(std::greater<MortalExpiry>(), std::move(expiries));
+    } else {
+        _mortalExpiries.push({ expiry, entity });
+    }
+
+    if (expiry < _nextExpiry) {
+        _nextExpiry = expiry;
     }
 }
 
@@ -147,11 +172,7 @@ void EntitySimulation::sortEntitiesThatMoved() {
 void EntitySimulation::addEntityToInternalLists(EntityItemPointer entity) {
     // protected: _mutex lock is guaranteed
     if (entity->isMortal()) {
-        _mortalEntities.insert(entity);
-        uint64_t expiry = entity->getExpiry();
-        if (expiry < _nextExpiry) {
-            _nextExpiry = expiry;
-        }
+        addMortalEntity(entity);
     }
     if (entity->needsToCallUpdate()) {
         _entitiesToUpdate.insert(entity);
@@ -171,20 +192,25 @@ void EntitySimulation::addEntity(EntityItemPointer entity) {
 }
 
 void EntitySimulation::changeEntity(EntityItemPointer entity) {
-    QMutexLocker lock(&_mutex);
     assert(entity);
+    std::unique_lock<std::mutex> lock(_changedEntitiesMutex);
     _changedEntities.insert(entity);
 }
 
 void EntitySimulation::processChangedEntities() {
+    std::unordered_set<EntityItemPointer> changedEntities;
+    {
+        std::unique_lock<std::mutex> lock(_changedEntitiesMutex);
+        changedEntities.swap(_changedEntities);
+    }
+
     QMutexLocker lock(&_mutex);
-    PROFILE_RANGE_EX(simulation_physics, "processChangedEntities", 0xffff00ff, (uint64_t)_changedEntities.size());
-    for (auto& entity : _changedEntities) {
+    PROFILE_RANGE_EX(simulation_physics, "processChangedEntities", 0xffff00ff, (uint64_t)changedEntities.size());
+    for (auto& entity : changedEntities) {
         if (entity->isSimulated()) {
             processChangedEntity(entity);
         }
     }
-    _changedEntities.clear();
 }
 
 void EntitySimulation::processChangedEntity(const EntityItemPointer& entity) {
@@ -193,11 +219,7 @@ void EntitySimulation::processChangedEntity(const EntityItemPointer& entity) {
     if (dirtyFlags & (Simulation::DIRTY_LIFETIME | Simulation::DIRTY_UPDATEABLE)) {
         if (dirtyFlags & Simulation::DIRTY_LIFETIME) {
             if (entity->isMortal()) {
-                _mortalEntities.insert(entity);
-                uint64_t expiry = entity->getExpiry();
-                if (expiry < _nextExpiry) {
-                    _nextExpiry = expiry;
-                }
+                addMortalEntity(entity);
             } else {
                 _mortalEntities.remove(entity);
             }
@@ -217,11 +239,15 @@ void EntitySimulation::clearEntities() {
     QMutexLocker lock(&_mutex);
     _entitiesToSort.clear();
     _simpleKinematicEntities.clear();
-    _changedEntities.clear();
+    {
+        std::unique_lock<std::mutex> changedLock(_changedEntitiesMutex);
+        _changedEntities.clear();
+    }
     _allEntities.clear();
     _deadEntitiesToRemoveFromTree.clear();
     _entitiesToUpdate.clear();
     _mortalEntities.clear();
+    _mortalExpiries = decltype(_mortalExpiries)();
     _nextExpiry = std::numeric_limits<uint64_t>::max();
 }
 
@@ -13,6 +13,8 @@
 #define hifi_EntitySimulation_h
 
 #include <limits>
+#include <mutex>
+#include <queue>
 #include <unordered_set>
 
 #include <QtCore/QObject>
@@ -87,6 +89,7 @@ protected:
     virtual void processDeadEntities();
 
     void expireMortalEntities(uint64_t now);
+    void addMortalEntity(const EntityItemPointer& entity);
     void callUpdateOnEntitiesThatNeedIt(uint64_t now);
     virtual void sortEntitiesThatMoved();
 
@@ -99,14 +102,29 @@ protected:
 private:
     void moveSimpleKinematics();
 
+    // an entry of _mortalExpiries, it is stale once the entity is no longer in _mortalEntities or its expiry changed,
+    // and stale entries are skipped when they come out
+    struct MortalExpiry {
+        uint64_t expiry;
+        EntityItemWeakPointer entity;
+
+        bool operator>(const MortalExpiry& other) const { return expiry > other.expiry; }
+    };
+
     // We maintain multiple lists, each for its distinct purpose.
     // An entity may be in more than one list.
-    std::unordered_set<EntityItemPointer> _changedEntities; // all changes this frame
+    std::unordered_set<EntityItemPointer> _changedEntities; // all changes this frame, guarded by _changedEntitiesMutex
     SetOfEntities _allEntities; // tracks all entities added the simulation
     SetOfEntities _entitiesToUpdate; // entities that need to call EntityItem::update()
     SetOfEntities _mortalEntities; // entities that have an expiry
+    // the expiries of the mortal entities, soonest first, so that expiring them only looks at the ones that expired
+    std::priority_queue<MortalExpiry, std::vector<MortalExpiry>, std::greater<MortalExpiry>> _mortalExpiries;
     uint64_t _nextExpiry;
 
+    // changeEntity is called from the threads that edit the entities, it only waits for the other changes
+    // and not for the whole update of the simulation
+    std::mutex _changedEntitiesMutex;
+
     // back pointer to EntityTree structure
     EntityTreePointer _entityTree;
 };
@@ -10,6 +10,9 @@
 //
 
 #include "EntityTree.h"
+
+#include <algorithm>
+
 #include <QtCore/QDateTime>
 #include <QtCore/QQueue>
 #include <openssl/err.h>
@@ -24,8 +27,10 @@
 #include <QtScript/QScriptEngine>
 
 #include <Extents.h>
+#include <OctreeBinaryPersist.h>
 #include <PerfStat.h>
 #include <Profile.h>
+#include <shared/ParallelFor.h>
 #include <AddressManager.h>
 
 #include "EntitySimulation.h"
@@ -112,6 +117,7 @@ void EntityTree::eraseDomainAndNonOwnedEntities() {
         }
         _entityMap.swap(savedEntities);
     });
+    resetBoundsSnapshot();
 
     resetClientEditStats();
     clearDeletedEntities();
@@ -155,6 +161,7 @@ void EntityTree::eraseAllOctreeElements(bool createNewRoot) {
         }
     });
     localMap.clear();
+    resetBoundsSnapshot();
     Octree::eraseAllOctreeElements(createNewRoot);
 
     resetClientEditStats();
@@ -730,6 +737,23 @@ void EntityTree::deleteEntitiesByID(const std::vector<EntityItemID>& ids, bool f
     }
 }
 
+void EntityTree::forgetEntities(std::function<bool(const EntityItemPointer&)> shouldForget) {
+    withWriteLock([&] {
+        std::vector<EntityItemPointer> entitiesToForget;
+        {
+            QReadLocker locker(&_entityMapLock);
+            for (const auto& entity : _entityMap) {
+                if (entity && shouldForget(entity)) {
+                    entitiesToForget.push_back(entity);
+                }
+            }
+        }
+        if (!entitiesToForget.empty()) {
+            deleteEntitiesByPointer(entitiesToForget);
+        }
+    });
+}
+
 void EntityTree::deleteEntitiesByPointer(const std::vector<EntityItemPointer>& entities) {
     // tree must be write-locked before calling this method
     //TODO: assert(treeIsLocked);
@@ -765,7 +789,10 @@ void EntityTree::processRemovedEntities(const DeleteEntityOperator& theOperator)
 
             // set up the deleted entities ID
             QWriteLocker recentlyDeletedEntitiesLocker(&_recentlyDeletedEntitiesLock);
-            _recentlyDeletedEntityItemIDs.insert(deletedAt, theEntity->getEntityItemID());
+            logDeletedEntity(deletedAt, theEntity->getEntityItemID());
+            if (_recordsDeletesForJournal) {
+                _journalDeletedEntityIDs.insert(deletedAt, theEntity->getEntityItemID());
+            }
         } else {
             theEntity->forEachDescendant([&](SpatiallyNestablePointer child) {
                 if (child->getNestableType() == NestableType::Avatar) {
@@ -1196,6 +1223,63 @@ void EntityTree::evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter se
     foundEntities.swap(args.entities);
 }
 
+void EntityTree::evalEntitiesInSpheres(const std::vector<std::pair<glm::vec3, float>>& spheres, PickFilter searchFilter,
+                                       std::vector<QVector<QUuid>>& foundEntities) {
+    EntityBoundsSnapshotPointer snapshot = getBoundsSnapshot();
+    foundEntities.assign(spheres.size(), QVector<QUuid>());
+    for (size_t i = 0; i < spheres.size(); ++i) {
+        const glm::vec3& center = spheres[i].first;
+        float radius = spheres[i].second;
+        snapshot->forEachEntityTouchingSphere(center, radius, [&](const EntityItemPointer& entity) {
+            if (EntityTreeElement::checkFilterSettings(entity, searchFilter) &&
+                EntityTreeElement::entityIntersectsSphere(entity, center, radius)) {
+                foundEntities[i].push_back(entity->getID());
+            }
+        });
+    }
+}
+
+void EntityTree::evalEntitiesInBoxes(const std::vector<AABox>& boxes, PickFilter searchFilter,
+                                     std::vector<QVector<QUuid>>& foundEntities) {
+    EntityBoundsSnapshotPointer snapshot = getBoundsSnapshot();
+    foundEntities.assign(boxes.size(), QVector<QUuid>());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        snapshot->forEachEntityTouchingBox(boxes[i], [&](const EntityItemPointer& entity) {
+            if (!EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+                return;
+            }
+            bool success;
+            AABox entityBox = entity->getAABox(success);
+            if (success && entityBox.touches(boxes[i])) {
+                foundEntities[i].push_back(entity->getID());
+            }
+        });
+    }
+}
+
+void EntityTree::evalRayIntersections(const std::vector<PickRay>& rays, PickFilter searchFilter,
+                                      std::vector<EntityRayIntersection>& intersections) {
+    EntityBoundsSnapshotPointer snapshot = getBoundsSnapshot();
+    intersections.assign(rays.size(), EntityRayIntersection());
+    for (size_t i = 0; i < rays.size(); ++i) {
+        const PickRay& ray = rays[i];
+        EntityRayIntersection& intersection = intersections[i];
+        snapshot->forEachEntityOnRay(ray.origin, ray.direction, FLT_MAX, [&](const EntityItemPointer& entity, float) {
+            if ((!entity->getIgnorePickIntersection() || searchFilter.bypassIgnore()) &&
+                EntityTreeElement::checkFilterSettings(entity, searchFilter)) {
+                OctreeElementPointer element = entity->getElement();
+                if (EntityTreeElement::findEntityRayIntersection(entity, ray.origin, ray.direction, element,
+                                                                 intersection.distance, intersection.face,
+                                                                 intersection.surfaceNormal, searchFilter,
+                                                                 intersection.extraInfo)) {
+                    intersection.entityID = entity->getEntityItemID();
+                }
+            }
+            return intersection.distance;
+        });
+    }
+}
+
 EntityItemPointer EntityTree::findEntityByID(const QUuid& id) const {
     EntityItemID entityID(id);
     return findEntityByEntityItemID(entityID);
@@ -1862,7 +1946,7 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
                         // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
                         if (isAdd) {
                             QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                            _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+                            logDeletedEntity(usecTimestampNow(), entityItemID);
                             validEditPacket = false;
                             wasDeletedBecauseOfClientScript = true;
                         } else {
@@ -1887,7 +1971,7 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
                             // the whitelist check
                             if (!wasDeletedBecauseOfClientScript) {
                                 QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                                _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+                                logDeletedEntity(usecTimestampNow(), entityItemID);
                                 validEditPacket = false;
                             }
                         } else {
@@ -1906,7 +1990,7 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
                 // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
                 if (isAdd) {
                     QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                    _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+                    logDeletedEntity(usecTimestampNow(), entityItemID);
                     validEditPacket = false;
                 } else {
                     suppressDisallowedPrivateUserData = true;
@@ -2071,7 +2155,7 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
                     }
                     if (failedAdd) { // Let client know it failed, so that they don't have an entity that no one else sees.
                         QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                        _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+                        logDeletedEntity(usecTimestampNow(), entityItemID);
                     }
                 } else {
                     HIFI_FCDEBUG(entities(), "Edit failed. [" << message.getType() <<"] " <<
@@ -2294,18 +2378,9 @@ quint64 EntityTree::getAdjustedConsiderSince(quint64 sinceTime) {
 bool EntityTree::hasEntitiesDeletedSince(quint64 sinceTime) {
     quint64 considerEntitiesSince = getAdjustedConsiderSince(sinceTime);
 
-    // we can probably leverage the ordered nature of QMultiMap to do this quickly...
-    bool hasSomethingNewer = false;
-
+    // the newest delete is the last one in the log
     QReadLocker locker(&_recentlyDeletedEntitiesLock);
-    QMultiMap<quint64, QUuid>::const_iterator iterator = _recentlyDeletedEntityItemIDs.constBegin();
-    while (iterator != _recentlyDeletedEntityItemIDs.constEnd()) {
-        if (iterator.key() > considerEntitiesSince) {
-            hasSomethingNewer = true;
-            break; // if we have at least one item, we don't need to keep searching
-        }
-        ++iterator;
-    }
+    bool hasSomethingNewer = !_recentlyDeletedEntityTimes.empty() && _recentlyDeletedEntityTimes.back() > considerEntitiesSince;
 
 #ifdef EXTRA_ERASE_DEBUGGING
     if (hasSomethingNewer) {
@@ -2319,25 +2394,36 @@ bool EntityTree::hasEntitiesDeletedSince(quint64 sinceTime) {
     return hasSomethingNewer;
 }
 
+QByteArray EntityTree::getEncodedEntityIDsDeletedSince(quint64 sinceTime) const {
+    quint64 considerEntitiesSince = getAdjustedConsiderSince(sinceTime);
+
+    QReadLocker locker(&_recentlyDeletedEntitiesLock);
+    auto first = std::upper_bound(_recentlyDeletedEntityTimes.begin(), _recentlyDeletedEntityTimes.end(), considerEntitiesSince);
+    int begin = (int)(first - _recentlyDeletedEntityTimes.begin()) * NUM_BYTES_RFC4122_UUID;
+
+    // a deep copy, a log shared with the send threads would be copied by the next delete instead
+    return QByteArray(_recentlyDeletedEntityIDs.constData() + begin, _recentlyDeletedEntityIDs.size() - begin);
+}
+
+void EntityTree::logDeletedEntity(quint64 deletedAt, const QUuid& entityID) {
+    // a clock that was adjusted back can't reorder the log
+    if (!_recentlyDeletedEntityTimes.empty()) {
+        deletedAt = std::max(deletedAt, _recentlyDeletedEntityTimes.back());
+    }
+    _recentlyDeletedEntityTimes.push_back(deletedAt);
+    _recentlyDeletedEntityIDs.append(entityID.toRfc4122());
+}
+
 // called by the server when it knows all nodes have been sent deleted packets
 void EntityTree::forgetEntitiesDeletedBefore(quint64 sinceTime) {
     quint64 considerSinceTime = sinceTime - DELETED_ENTITIES_EXTRA_USECS_TO_CONSIDER;
-    QSet<quint64> keysToRemove;
     QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-    QMultiMap<quint64, QUuid>::iterator iterator = _recentlyDeletedEntityItemIDs.begin();
 
-    // First find all the keys in the map that are older and need to be deleted
-    while (iterator != _recentlyDeletedEntityItemIDs.end()) {
-        if (iterator.key() <= considerSinceTime) {
-            keysToRemove << iterator.key();
-        }
-        ++iterator;
-    }
-
-    // Now run through the keysToRemove and remove them
-    foreach (quint64 value, keysToRemove) {
-        _recentlyDeletedEntityItemIDs.remove(value);
-    }
+    // the older deletes are the start of the log
+    auto end = std::upper_bound(_recentlyDeletedEntityTimes.begin(), _recentlyDeletedEntityTimes.end(), considerSinceTime);
+    int numForgotten = (int)(end - _recentlyDeletedEntityTimes.begin());
+    _recentlyDeletedEntityTimes.erase(_recentlyDeletedEntityTimes.begin(), end);
+    _recentlyDeletedEntityIDs.remove(0, numForgotten * NUM_BYTES_RFC4122_UUID);
 }
 
 
@@ -2500,19 +2586,84 @@ EntityTreeElementPointer EntityTree::getContainingElement(const EntityItemID& en
 
 void EntityTree::addEntityMapEntry(EntityItemPointer entity) {
     EntityItemID id = entity->getEntityItemID();
-    QWriteLocker locker(&_entityMapLock);
-    EntityItemPointer otherEntity = _entityMap.value(id);
-    if (otherEntity) {
-        qCWarning(entities) << "EntityTree::addEntityMapEntry() found pre-existing id " << id;
-        assert(false);
-        return;
+    {
+        QWriteLocker locker(&_entityMapLock);
+        EntityItemPointer otherEntity = _entityMap.value(id);
+        if (otherEntity) {
+            qCWarning(entities) << "EntityTree::addEntityMapEntry() found pre-existing id " << id;
+            assert(false);
+            return;
+        }
+        _entityMap.insert(id, entity);
     }
-    _entityMap.insert(id, entity);
+    entityBoundsChanged(entity);
 }
 
 void EntityTree::clearEntityMapEntry(const EntityItemID& id) {
-    QWriteLocker locker(&_entityMapLock);
-    _entityMap.remove(id);
+    {
+        QWriteLocker locker(&_entityMapLock);
+        _entityMap.remove(id);
+    }
+    entityBoundsRemoved(id);
+}
+
+void EntityTree::entityBoundsChanged(const EntityItemPointer& entity) {
+    if (!_tracksBoundsChanges) {
+        return;
+    }
+    QMutexLocker locker(&_boundsSnapshotMutex);
+    _boundsChangedEntities.insert(entity->getEntityItemID(), entity);
+    _boundsRemovedEntityIDs.remove(entity->getEntityItemID());
+}
+
+void EntityTree::entityBoundsRemoved(const EntityItemID& entityID) {
+    if (!_tracksBoundsChanges) {
+        return;
+    }
+    QMutexLocker locker(&_boundsSnapshotMutex);
+    _boundsChangedEntities.remove(entityID);
+    _boundsRemovedEntityIDs.insert(entityID);
+}
+
+void EntityTree::resetBoundsSnapshot() {
+    QMutexLocker locker(&_boundsSnapshotMutex);
+    _tracksBoundsChanges = false;
+    _boundsSnapshot.reset();
+    _boundsChangedEntities.clear();
+    _boundsRemovedEntityIDs.clear();
+}
+
+EntityBoundsSnapshotPointer EntityTree::getBoundsSnapshot() {
+    QMutexLocker locker(&_boundsSnapshotMutex);
+    if (!_boundsSnapshot) {
+        // changes from here on are tracked, the ones that race with the copy below are applied on the next call
+        _tracksBoundsChanges = true;
+        QVector<EntityItemPointer> entities;
+        {
+            QReadLocker entityMapLocker(&_entityMapLock);
+            entities.reserve(_entityMap.size());
+            for (auto& entity : _entityMap) {
+                entities.push_back(entity);
+            }
+        }
+        _boundsSnapshot = EntityBoundsSnapshot::build(entities);
+    } else if (!_boundsChangedEntities.isEmpty() || !_boundsRemovedEntityIDs.isEmpty()) {
+        QVector<EntityItemPointer> changedEntities;
+        {
+            // entities that moved on their way out of the tree are left to their removal
+            QReadLocker entityMapLocker(&_entityMapLock);
+            for (auto it = _boundsChangedEntities.begin(); it != _boundsChangedEntities.end(); ++it) {
+                EntityItemPointer entity = it.value().lock();
+                if (entity && _entityMap.value(it.key()) == entity) {
+                    changedEntities.push_back(entity);
+                }
+            }
+        }
+        _boundsSnapshot = _boundsSnapshot->update(changedEntities, _boundsRemovedEntityIDs.toList().toVector());
+    }
+    _boundsChangedEntities.clear();
+    _boundsRemovedEntityIDs.clear();
+    return _boundsSnapshot;
 }
 
 void EntityTree::debugDumpMap() {
@@ -2902,6 +3053,48 @@ void convertGrabUserDataToProperties(EntityItemProperties& properties) {
     }
 }
 
+namespace {
+// interleaves the low 21 bits of the value with two zero bits after each
+uint64_t spreadMortonBits(uint64_t value) {
+    value &= 0x1fffff;
+    value = (value | value << 32) & 0x1f00000000ffff;
+    value = (value | value << 16) & 0x1f0000ff0000ff;
+    value = (value | value << 8) & 0x100f00f00f00f00f;
+    value = (value | value << 4) & 0x10c30c30c30c30c3;
+    value = (value | value << 2) & 0x1249249249249249;
+    return value;
+}
+
+uint64_t mortonKey(const glm::vec3& position) {
+    const float MORTON_SCALE = (float)(1 << 21) / (float)TREE_SCALE;
+    glm::vec3 cell = glm::clamp((position + glm::vec3((float)HALF_TREE_SCALE)) * MORTON_SCALE,
+                                glm::vec3(0.0f), glm::vec3((float)((1 << 21) - 1)));
+    return spreadMortonBits((uint64_t)cell.x) | spreadMortonBits((uint64_t)cell.y) << 1 |
+        spreadMortonBits((uint64_t)cell.z) << 2;
+}
+
+// Adding entities in Morton order of their query cubes makes consecutive adds land in the same branch of the tree,
+// so the elements along it are still warm and are split once rather than revisited all over the load.
+void sortEntitiesForInsertion(std::vector<std::pair<EntityItemID, EntityItemProperties>>& entities) {
+    std::vector<std::pair<uint64_t, size_t>> keys;
+    keys.reserve(entities.size());
+    for (size_t i = 0; i < entities.size(); ++i) {
+        const EntityItemProperties& properties = entities[i].second;
+        glm::vec3 center = properties.queryAACubeChanged() ? properties.getQueryAACube().calcCenter() : properties.getPosition();
+        keys.push_back({ mortonKey(center), i });
+    }
+    std::stable_sort(keys.begin(), keys.end(), [](const std::pair<uint64_t, size_t>& a, const std::pair<uint64_t, size_t>& b) {
+        return a.first < b.first;
+    });
+
+    std::vector<std::pair<EntityItemID, EntityItemProperties>> sortedEntities;
+    sortedEntities.reserve(entities.size());
+    for (auto& key : keys) {
+        sortedEntities.push_back(std::move(entities[key.second]));
+    }
+    entities.swap(sortedEntities);
+}
+}
 
 bool EntityTree::readFromMap(QVariantMap& map) {
     // These are needed to deal with older content (before adding inheritance modes)
@@ -2930,149 +3123,163 @@ bool EntityTree::readFromMap(QVariantMap& map) {
     // to a QScriptValue, and then to EntityItemProperties.  These properties are used
     // to add the new entity to the EntityTree.
     QVariantList entitiesQList = map["Entities"].toList();
-    QScriptEngine scriptEngine;
 
     if (entitiesQList.length() == 0) {
         // Empty map or invalidly formed file.
         return false;
     }
 
-    QMap<QUuid, QVector<QUuid>> cloneIDs;
+    // Converting the entities takes most of the load time of large domains, so it is spread over threads with a script
+    // engine each. Wearables are resolved against our avatar, which isn't safe to ask from other threads.
+    const int MIN_ENTITIES_PER_THREAD = 256;
+    std::vector<std::pair<EntityItemID, EntityItemProperties>> parsedEntities(entitiesQList.length());
+    const QUuid myNodeID = DependencyManager::get<NodeList>()->getSessionUUID();
+    int minEntitiesPerThread = _myAvatar ? entitiesQList.length() : MIN_ENTITIES_PER_THREAD;
+    parallelForRanges(entitiesQList.length(), minEntitiesPerThread, [&](int begin, int end) {
+        QScriptEngine scriptEngine;
+        for (int i = begin; i < end; ++i) {
+            // QVariantMap --> QScriptValue --> EntityItemProperties
+            QVariantMap entityMap = entitiesQList.at(i).toMap();
 
-    bool success = true;
-    foreach (QVariant entityVariant, entitiesQList) {
-        // QVariantMap --> QScriptValue --> EntityItemProperties --> Entity
-        QVariantMap entityMap = entityVariant.toMap();
+            // handle parentJointName for wearables
+            if (_myAvatar && entityMap.contains("parentJointName") && entityMap.contains("parentID") &&
+                QUuid(entityMap["parentID"].toString()) == AVATAR_SELF_ID) {
 
-        // handle parentJointName for wearables
-        if (_myAvatar && entityMap.contains("parentJointName") && entityMap.contains("parentID") &&
-            QUuid(entityMap["parentID"].toString()) == AVATAR_SELF_ID) {
+                entityMap["parentJointIndex"] = _myAvatar->getJointIndex(entityMap["parentJointName"].toString());
 
-            entityMap["parentJointIndex"] = _myAvatar->getJointIndex(entityMap["parentJointName"].toString());
+                qCDebug(entities) << "Found parentJointName " << entityMap["parentJointName"].toString() <<
+                    " mapped it to parentJointIndex " << entityMap["parentJointIndex"].toInt();
+            }
 
-            qCDebug(entities) << "Found parentJointName " << entityMap["parentJointName"].toString() <<
-                " mapped it to parentJointIndex " << entityMap["parentJointIndex"].toInt();
-        }
+            QScriptValue entityScriptValue = variantMapToScriptValue(entityMap, scriptEngine);
+            EntityItemProperties properties;
+            EntityItemPropertiesFromScriptValueIgnoreReadOnly(entityScriptValue, properties);
 
-        QScriptValue entityScriptValue = variantMapToScriptValue(entityMap, scriptEngine);
-        EntityItemProperties properties;
-        EntityItemPropertiesFromScriptValueIgnoreReadOnly(entityScriptValue, properties);
+            EntityItemID entityItemID;
+            if (entityMap.contains("id")) {
+                entityItemID = EntityItemID(QUuid(entityMap["id"].toString()));
+            } else {
+                entityItemID = EntityItemID(QUuid::createUuid());
+            }
 
-        EntityItemID entityItemID;
-        if (entityMap.contains("id")) {
-            entityItemID = EntityItemID(QUuid(entityMap["id"].toString()));
-        } else {
-            entityItemID = EntityItemID(QUuid::createUuid());
-        }
+            // Convert old clientOnly bool to new entityHostType enum
+            // (must happen before setOwningAvatarID below)
+            if (contentVersion < (int)EntityVersion::EntityHostTypes) {
+                if (entityMap.contains("clientOnly")) {
+                    properties.setEntityHostType(entityMap["clientOnly"].toBool() ? entity::HostType::AVATAR : entity::HostType::DOMAIN);
+                }
+            }
 
-        // Convert old clientOnly bool to new entityHostType enum
-        // (must happen before setOwningAvatarID below)
-        if (contentVersion < (int)EntityVersion::EntityHostTypes) {
-            if (entityMap.contains("clientOnly")) {
-                properties.setEntityHostType(entityMap["clientOnly"].toBool() ? entity::HostType::AVATAR : entity::HostType::DOMAIN);
+            if (properties.getEntityHostType() == entity::HostType::AVATAR) {
+                properties.setOwningAvatarID(myNodeID);
             }
-        }
 
-        if (properties.getEntityHostType() == entity::HostType::AVATAR) {
-            auto nodeList = DependencyManager::get<NodeList>();
-            const QUuid myNodeID = nodeList->getSessionUUID();
-            properties.setOwningAvatarID(myNodeID);
-        }
+            // Fix for older content not containing mode fields in the zones
+            if (contentVersion < (int)EntityVersion::ZoneLightInheritModes && (properties.getType() == EntityTypes::EntityType::Zone)) {
+                // The legacy version had no keylight mode - this is set to on
+                properties.setKeyLightMode(COMPONENT_MODE_ENABLED);
 
-        // Fix for older content not containing mode fields in the zones
-        if (contentVersion < (int)EntityVersion::ZoneLightInheritModes && (properties.getType() == EntityTypes::EntityType::Zone)) {
-            // The legacy version had no keylight mode - this is set to on
-            properties.setKeyLightMode(COMPONENT_MODE_ENABLED);
+                // The ambient URL has been moved from "keyLight" to "ambientLight"
+                if (entityMap.contains("keyLight")) {
+                    QVariantMap keyLightObject = entityMap["keyLight"].toMap();
+                    properties.getAmbientLight().setAmbientURL(keyLightObject["ambientURL"].toString());
+                }
 
-            // The ambient URL has been moved from "keyLight" to "ambientLight"
-            if (entityMap.contains("keyLight")) {
-                QVariantMap keyLightObject = entityMap["keyLight"].toMap();
-                properties.getAmbientLight().setAmbientURL(keyLightObject["ambientURL"].toString());
-            }
+                // Copy the skybox URL if the ambient URL is empty, as this is the legacy behaviour
+                // Use skybox value only if it is not empty, else set ambientMode to inherit (to use default URL)
+                properties.setAmbientLightMode(COMPONENT_MODE_ENABLED);
+                if (properties.getAmbientLight().getAmbientURL() == "") {
+                    if (properties.getSkybox().getURL() != "") {
+                        properties.getAmbientLight().setAmbientURL(properties.getSkybox().getURL());
+                    } else {
+                        properties.setAmbientLightMode(COMPONENT_MODE_INHERIT);
+                    }
+                }
 
-            // Copy the skybox URL if the ambient URL is empty, as this is the legacy behaviour
-            // Use skybox value only if it is not empty, else set ambientMode to inherit (to use default URL)
-            properties.setAmbientLightMode(COMPONENT_MODE_ENABLED);
-            if (properties.getAmbientLight().getAmbientURL() == "") {
-                if (properties.getSkybox().getURL() != "") {
-                    properties.getAmbientLight().setAmbientURL(properties.getSkybox().getURL());
+                // The background should be enabled if the mode is skybox
+                // Note that if the values are default then they are not stored in the JSON file
+                if (entityMap.contains("backgroundMode") && (entityMap["backgroundMode"].toString() == "skybox")) {
+                    properties.setSkyboxMode(COMPONENT_MODE_ENABLED);
                 } else {
-                    properties.setAmbientLightMode(COMPONENT_MODE_INHERIT);
+                    properties.setSkyboxMode(COMPONENT_MODE_INHERIT);
                 }
             }
 
-            // The background should be enabled if the mode is skybox
-            // Note that if the values are default then they are not stored in the JSON file
-            if (entityMap.contains("backgroundMode") && (entityMap["backgroundMode"].toString() == "skybox")) {
-                properties.setSkyboxMode(COMPONENT_MODE_ENABLED);
-            } else {
-                properties.setSkyboxMode(COMPONENT_MODE_INHERIT);
-            }
-        }
+            // Convert old materials so that they use materialData instead of userData
+            if (contentVersion < (int)EntityVersion::MaterialData && properties.getType() == EntityTypes::EntityType::Material) {
+                if (properties.getMaterialURL().startsWith("userData")) {
+                    QString materialURL = properties.getMaterialURL();
+                    properties.setMaterialURL(materialURL.replace("userData", "materialData"));
 
-        // Convert old materials so that they use materialData instead of userData
-        if (contentVersion < (int)EntityVersion::MaterialData && properties.getType() == EntityTypes::EntityType::Material) {
-            if (properties.getMaterialURL().startsWith("userData")) {
-                QString materialURL = properties.getMaterialURL();
-                properties.setMaterialURL(materialURL.replace("userData", "materialData"));
+                    QJsonObject userData = QJsonDocument::fromJson(properties.getUserData().toUtf8()).object();
+                    QJsonObject materialData;
+                    QJsonValue materialVersion = userData["materialVersion"];
+                    if (!materialVersion.isNull()) {
+                        materialData.insert("materialVersion", materialVersion);
+                        userData.remove("materialVersion");
+                    }
+                    QJsonValue materials = userData["materials"];
+                    if (!materials.isNull()) {
+                        materialData.insert("materials", materials);
+                        userData.remove("materials");
+                    }
 
-                QJsonObject userData = QJsonDocument::fromJson(properties.getUserData().toUtf8()).object();
-                QJsonObject materialData;
-                QJsonValue materialVersion = userData["materialVersion"];
-                if (!materialVersion.isNull()) {
-                    materialData.insert("materialVersion", materialVersion);
-                    userData.remove("materialVersion");
+                    properties.setMaterialData(QJsonDocument(materialData).toJson());
+                    properties.setUserData(QJsonDocument(userData).toJson());
                 }
-                QJsonValue materials = userData["materials"];
-                if (!materials.isNull()) {
-                    materialData.insert("materials", materials);
-                    userData.remove("materials");
+            }
+
+            // Convert old cloneable entities so they use cloneableData instead of userData
+            if (contentVersion < (int)EntityVersion::CloneableData) {
+                QJsonObject userData = QJsonDocument::fromJson(properties.getUserData().toUtf8()).object();
+                QJsonObject grabbableKey = userData["grabbableKey"].toObject();
+                QJsonValue cloneable = grabbableKey["cloneable"];
+                if (cloneable.isBool() && cloneable.toBool()) {
+                    QJsonValue cloneLifetime = grabbableKey["cloneLifetime"];
+                    QJsonValue cloneLimit = grabbableKey["cloneLimit"];
+                    QJsonValue cloneDynamic = grabbableKey["cloneDynamic"];
+                    QJsonValue cloneAvatarEntity = grabbableKey["cloneAvatarEntity"];
+
+                    // This is cloneable, we need to convert the properties
+                    properties.setCloneable(true);
+                    properties.setCloneLifetime(cloneLifetime.toInt());
+                    properties.setCloneLimit(cloneLimit.toInt());
+                    properties.setCloneDynamic(cloneDynamic.toBool());
+                    properties.setCloneAvatarEntity(cloneAvatarEntity.toBool());
                 }
+            }
 
-                properties.setMaterialData(QJsonDocument(materialData).toJson());
-                properties.setUserData(QJsonDocument(userData).toJson());
+            // convert old grab-related userData to new grab properties
+            if (contentVersion < (int)EntityVersion::GrabProperties) {
+                convertGrabUserDataToProperties(properties);
             }
-        }
 
-        // Convert old cloneable entities so they use cloneableData instead of userData
-        if (contentVersion < (int)EntityVersion::CloneableData) {
-            QJsonObject userData = QJsonDocument::fromJson(properties.getUserData().toUtf8()).object();
-            QJsonObject grabbableKey = userData["grabbableKey"].toObject();
-            QJsonValue cloneable = grabbableKey["cloneable"];
-            if (cloneable.isBool() && cloneable.toBool()) {
-                QJsonValue cloneLifetime = grabbableKey["cloneLifetime"];
-                QJsonValue cloneLimit = grabbableKey["cloneLimit"];
-                QJsonValue cloneDynamic = grabbableKey["cloneDynamic"];
-                QJsonValue cloneAvatarEntity = grabbableKey["cloneAvatarEntity"];
+            // Zero out the spread values that were fixed in version ParticleEntityFix so they behave the same as before
+            if (contentVersion < (int)EntityVersion::ParticleEntityFix) {
+                properties.setRadiusSpread(0.0f);
+                properties.setAlphaSpread(0.0f);
+                properties.setColorSpread({0, 0, 0});
+            }
 
-                // This is cloneable, we need to convert the properties
-                properties.setCloneable(true);
-                properties.setCloneLifetime(cloneLifetime.toInt());
-                properties.setCloneLimit(cloneLimit.toInt());
-                properties.setCloneDynamic(cloneDynamic.toBool());
-                properties.setCloneAvatarEntity(cloneAvatarEntity.toBool());
+            if (contentVersion < (int)EntityVersion::FixPropertiesFromCleanup) {
+                if (entityMap.contains("created")) {
+                    quint64 created = QDateTime::fromString(entityMap["created"].toString().trimmed(), Qt::ISODate).toMSecsSinceEpoch() * 1000;
+                    properties.setCreated(created);
+                }
             }
-        }
 
-        // convert old grab-related userData to new grab properties
-        if (contentVersion < (int)EntityVersion::GrabProperties) {
-            convertGrabUserDataToProperties(properties);
+            parsedEntities[i] = { entityItemID, properties };
         }
+    });
 
-        // Zero out the spread values that were fixed in version ParticleEntityFix so they behave the same as before
-        if (contentVersion < (int)EntityVersion::ParticleEntityFix) {
-            properties.setRadiusSpread(0.0f);
-            properties.setAlphaSpread(0.0f);
-            properties.setColorSpread({0, 0, 0});
-        }
+    sortEntitiesForInsertion(parsedEntities);
 
-        if (contentVersion < (int)EntityVersion::FixPropertiesFromCleanup) {
-            if (entityMap.contains("created")) {
-                quint64 created = QDateTime::fromString(entityMap["created"].toString().trimmed(), Qt::ISODate).toMSecsSinceEpoch() * 1000;
-                properties.setCreated(created);
-            }
-        }
+    QMap<QUuid, QVector<QUuid>> cloneIDs;
 
+    bool success = true;
+    for (const auto& parsedEntity : parsedEntities) {
+        const EntityItemID& entityItemID = parsedEntity.first;
+        const EntityItemProperties& properties = parsedEntity.second;
         EntityItemPointer entity = addEntity(entityItemID, properties);
         if (!entity) {
             qCDebug(entities) << "adding Entity failed:" << entityItemID << properties.getType();
@@ -3108,6 +3315,226 @@ bool EntityTree::writeToJSON(QString& jsonString, const OctreeElementPointer& el
     return true;
 }
 
+namespace {
+// journal items start with one of these, followed by the entity items of the snapshot or the deleted id
+enum class JournalOperation : uint8_t {
+    Write = 0,
+    Delete
+};
+
+// entities are stored as their add message, prefixed with their created time which add messages leave out
+bool appendBinaryEntityItems(OctreeUtils::BinaryPersistWriter& writer, const EntityItemPointer& entity,
+                             const QByteArray& itemPrefix) {
+    const int MAX_ENTITY_DATA_SIZE = NLPacket::maxPayloadSize(PacketType::EntityAdd) * 10;
+
+    EntityItemProperties properties = entity->getProperties();
+    properties.markAllChanged();
+    EntityPropertyFlags requestedProperties = properties.getChangedProperties();
+    EntityPropertyFlags didntFitProperties;
+    quint64 created = entity->getCreated();
+
+    // the properties that don't fit go into further items for the same entity, the same way
+    // EntityEditPacketSender splits adds over several messages
+    OctreeElement::AppendState encodeResult = OctreeElement::PARTIAL;
+    bool isFirstItem = true;
+    while (encodeResult == OctreeElement::PARTIAL) {
+        QByteArray entityData(MAX_ENTITY_DATA_SIZE, 0);
+        encodeResult = EntityItemProperties::encodeEntityEditPacket(PacketType::EntityAdd, entity->getEntityItemID(),
+            properties, entityData, requestedProperties, didntFitProperties);
+
+        if (encodeResult == OctreeElement::NONE) {
+            // after the first item this only means the remaining properties don't apply to this entity type
+            if (isFirstItem) {
+                qCWarning(entities) << "Failed to encode entity for binary persist:" << entity->getEntityItemID();
+                return false;
+            }
+            break;
+        }
+
+        entityData.prepend((const char*)&created, sizeof(created));
+        entityData.prepend(itemPrefix);
+        writer.appendItem(entityData);
+
+        requestedProperties = didntFitProperties;
+        isFirstItem = false;
+    }
+    return true;
+}
+
+bool decodeBinaryEntityItem(const char* data, int size, EntityItemID& entityID, EntityItemProperties& properties) {
+    quint64 created;
+    if (size < (int)sizeof(created)) {
+        return false;
+    }
+    memcpy(&created, data, sizeof(created));
+
+    int processedBytes = 0;
+    if (!EntityItemProperties::decodeEntityEditPacket((const unsigned char*)data + sizeof(created),
+            size - (int)sizeof(created), processedBytes, entityID, properties)) {
+        return false;
+    }
+    properties.setCreated(created);
+    return true;
+}
+}
+
+bool EntityTree::writeToBinary(OctreeUtils::BinaryPersistWriter& writer, const OctreeElementPointer& element) {
+    bool success = true;
+    withReadLock([&] {
+        recurseElementWithOperation(element ? element : _rootElement, [&](const OctreeElementPointer& element, void* extraData) {
+            EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+            entityTreeElement->forEachEntity([&](EntityItemPointer entity) {
+                // like the JSON persist, skip the entities we weren't able to resolve a parent for
+                if (entity->isParentIDValid()) {
+                    success = appendBinaryEntityItems(writer, entity, QByteArray()) && success;
+                }
+            });
+            return true;
+        }, nullptr);
+    });
+    return success;
+}
+
+bool EntityTree::writeChangesToBinary(OctreeUtils::BinaryPersistWriter& writer, quint64 changedSince) {
+    bool success = true;
+    withReadLock([&] {
+        // the deletes go first, so an entity that was deleted and added back since is written after its delete
+        {
+            QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+            QByteArray deleteItem;
+            deleteItem.append((char)JournalOperation::Delete);
+            for (auto it = _journalDeletedEntityIDs.upperBound(changedSince); it != _journalDeletedEntityIDs.end(); ++it) {
+                writer.appendItem(deleteItem + it.value().toRfc4122());
+            }
+
+            // anything older went into the journal already, or into the snapshot it applies to
+            _journalDeletedEntityIDs.erase(_journalDeletedEntityIDs.begin(), _journalDeletedEntityIDs.upperBound(changedSince));
+        }
+
+        // the same subtree pruning as the repeat traversals of the send threads
+        QByteArray writeItemPrefix;
+        writeItemPrefix.append((char)JournalOperation::Write);
+        recurseTreeWithOperation([&](const OctreeElementPointer& element, void* extraData) {
+            if (element->getLastChanged() <= changedSince) {
+                return false;
+            }
+
+            EntityTreeElementPointer entityTreeElement = std::static_pointer_cast<EntityTreeElement>(element);
+            if (entityTreeElement->getLastChangedContent() > changedSince) {
+                entityTreeElement->forEachEntity([&](EntityItemPointer entity) {
+                    bool hasChanged = entity->getLastEdited() > changedSince || entity->getLastChangedOnServer() > changedSince;
+                    if (hasChanged && entity->isParentIDValid()) {
+                        success = appendBinaryEntityItems(writer, entity, writeItemPrefix) && success;
+                    }
+                });
+            }
+            return true;
+        });
+    });
+    return success;
+}
+
+void EntityTree::setRecordsDeletesForJournal(bool recordsDeletes) {
+    QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+    _recordsDeletesForJournal = recordsDeletes;
+    _journalDeletedEntityIDs.clear();
+}
+
+bool EntityTree::readFromBinary(const OctreeUtils::BinaryPersistReader& reader,
+                                const std::vector<OctreeUtils::BinaryPersistReader>& journal) {
+    if (!reader.getID().isNull()) {
+        _persistID = reader.getID();
+    }
+    _persistDataVersion = journal.empty() ? reader.getDataVersion() : journal.back().getDataVersion();
+    _namedPaths.clear();
+
+    // the journal is replayed onto the snapshot before building the tree, so that every entity is only added once
+    std::vector<EntityItemID> entityOrder;
+    QHash<EntityItemID, EntityItemProperties> entityProperties;
+
+    // the items of an entity are consecutive, the first replaces what we had for it and the others are merged into it
+    EntityItemID lastEntityID;
+    auto readEntityItem = [&](const char* data, int size) {
+        EntityItemID entityID;
+        EntityItemProperties properties;
+        if (!decodeBinaryEntityItem(data, size, entityID, properties)) {
+            return false;
+        }
+
+        if (entityID == lastEntityID) {
+            entityProperties[entityID].merge(properties);
+        } else {
+            if (!entityProperties.contains(entityID)) {
+                entityOrder.push_back(entityID);
+            }
+            entityProperties[entityID] = properties;
+            lastEntityID = entityID;
+        }
+        return true;
+    };
+
+    bool isComplete = reader.forEachItem(readEntityItem);
+
+    for (auto& record : journal) {
+        if (!isComplete) {
+            break;
+        }
+
+        lastEntityID = EntityItemID();
+        isComplete = record.forEachItem([&](const char* data, int size) {
+            if (size < 1) {
+                return false;
+            }
+
+            if ((JournalOperation)data[0] == JournalOperation::Delete) {
+                if (size < 1 + NUM_BYTES_RFC4122_UUID) {
+                    return false;
+                }
+                entityProperties.remove(QUuid::fromRfc4122(QByteArray::fromRawData(data + 1, NUM_BYTES_RFC4122_UUID)));
+                lastEntityID = EntityItemID();
+                return true;
+            }
+            return readEntityItem(data + 1, size - 1);
+        });
+    }
+
+    if (!isComplete) {
+        qCWarning(entities) << "Binary entity data is truncated or corrupt";
+    }
+
+    QMap<QUuid, QVector<QUuid>> cloneIDs;
+    bool success = true;
+
+    for (auto& entityID : entityOrder) {
+        // entities that were deleted, or added back after a delete, are skipped or only added the first time around
+        auto it = entityProperties.find(entityID);
+        if (it == entityProperties.end()) {
+            continue;
+        }
+
+        EntityItemPointer entity = addEntity(entityID, it.value());
+        if (!entity) {
+            qCDebug(entities) << "adding Entity failed:" << entityID << it.value().getType();
+            success = false;
+        } else {
+            const QUuid& cloneOriginID = entity->getCloneOriginID();
+            if (!cloneOriginID.isNull()) {
+                cloneIDs[cloneOriginID].push_back(entity->getEntityItemID());
+            }
+        }
+        entityProperties.erase(it);
+    }
+
+    for (const auto& entityID : cloneIDs.keys()) {
+        auto entity = findEntityByID(entityID);
+        if (entity) {
+            entity->setCloneIDs(cloneIDs.value(entityID));
+        }
+    }
+
+    return success && isComplete;
+}
+
 void EntityTree::resetClientEditStats() {
     _treeResetTime = usecTimestampNow();
     _maxEditDelta = 0;
@@ -12,6 +12,9 @@
 #ifndef hifi_EntityTree_h
 #define hifi_EntityTree_h
 
+#include <deque>
+
+#include <QMutex>
 #include <QSet>
 #include <QVector>
 
@@ -19,6 +22,7 @@
 #include <SpatialParentFinder.h>
 
 #include "AddEntityOperator.h"
+#include "EntityBoundsSnapshot.h"
 #include "EntityTreeElement.h"
 #include "DeleteEntityOperator.h"
 #include "MovingEntitiesOperator.h"
@@ -37,6 +41,15 @@ public:
     virtual void entityCreated(const EntityItem& newEntity, const SharedNodePointer& senderNode) = 0;
 };
 
+class EntityRayIntersection {
+public:
+    EntityItemID entityID; // null if the ray didn't hit anything
+    float distance { FLT_MAX };
+    BoxFace face { UNKNOWN_FACE };
+    glm::vec3 surfaceNormal;
+    QVariantMap extraInfo;
+};
+
 class SendEntitiesOperationArgs {
 public:
     glm::vec3 root;
@@ -129,6 +142,9 @@ public:
 
     void deleteEntitiesByID(const std::vector<EntityItemID>& entityIDs, bool force = false, bool ignoreWarnings = true);
     void deleteEntitiesByPointer(const std::vector<EntityItemPointer>& entities);
+    // removes the entities for which the predicate is true from this tree only, for viewers that stop following
+    // part of the domain
+    void forgetEntities(std::function<bool(const EntityItemPointer&)> shouldForget);
 
     EntityItemPointer findEntityByID(const QUuid& id) const;
     EntityItemPointer findEntityByEntityItemID(const EntityItemID& entityID) const;
@@ -144,21 +160,34 @@ public:
     void evalEntitiesInBox(const AABox& box, PickFilter searchFilter, QVector<QUuid>& foundEntities);
     void evalEntitiesInFrustum(const ViewFrustum& frustum, PickFilter searchFilter, QVector<QUuid>& foundEntities);
 
+    // Batched versions of evalEntitiesInSphere, evalEntitiesInBox and evalRayIntersection, for callers with many queries
+    // a frame. They run against one bounds snapshot and don't take the tree lock.
+    void evalEntitiesInSpheres(const std::vector<std::pair<glm::vec3, float>>& spheres, PickFilter searchFilter,
+                               std::vector<QVector<QUuid>>& foundEntities);
+    void evalEntitiesInBoxes(const std::vector<AABox>& boxes, PickFilter searchFilter,
+                             std::vector<QVector<QUuid>>& foundEntities);
+    void evalRayIntersections(const std::vector<PickRay>& rays, PickFilter searchFilter,
+                              std::vector<EntityRayIntersection>& intersections);
+
+    // The bounds of the entities as of now. The first call builds the snapshot, later ones bring it up to date with the
+    // entities that were added, removed or moved since. Safe to call from any thread.
+    EntityBoundsSnapshotPointer getBoundsSnapshot();
+    void entityBoundsChanged(const EntityItemPointer& entity);
+
     void addNewlyCreatedHook(NewlyCreatedEntityHook* hook);
     void removeNewlyCreatedHook(NewlyCreatedEntityHook* hook);
 
     bool hasAnyDeletedEntities() const { 
         QReadLocker locker(&_recentlyDeletedEntitiesLock);
-        return _recentlyDeletedEntityItemIDs.size() > 0;
+        return !_recentlyDeletedEntityTimes.empty();
     }
 
     bool hasEntitiesDeletedSince(quint64 sinceTime);
     static quint64 getAdjustedConsiderSince(quint64 sinceTime);
 
-    QMultiMap<quint64, QUuid> getRecentlyDeletedEntityIDs() const { 
-        QReadLocker locker(&_recentlyDeletedEntitiesLock);
-        return _recentlyDeletedEntityItemIDs;
-    }
+    // The IDs of the entities deleted since a time, back to back in RFC 4122 form, ready to be written to the erase
+    // packets.  They were encoded once, when they were logged, and every viewer copies them from the same log.
+    QByteArray getEncodedEntityIDsDeletedSince(quint64 sinceTime) const;
 
     void forgetEntitiesDeletedBefore(quint64 sinceTime);
 
@@ -197,6 +226,11 @@ public:
                             bool skipThoseWithBadParents) override;
     virtual bool readFromMap(QVariantMap& entityDescription) override;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) override;
+    virtual bool writeToBinary(OctreeUtils::BinaryPersistWriter& writer, const OctreeElementPointer& element) override;
+    virtual bool writeChangesToBinary(OctreeUtils::BinaryPersistWriter& writer, quint64 changedSince) override;
+    virtual void setRecordsDeletesForJournal(bool recordsDeletes) override;
+    virtual bool readFromBinary(const OctreeUtils::BinaryPersistReader& reader,
+                                const std::vector<OctreeUtils::BinaryPersistReader>& journal) override;
 
 
     glm::vec3 getContentsDimensions();
@@ -308,7 +342,13 @@ protected:
     QVector<NewlyCreatedEntityHook*> _newlyCreatedHooks;
 
     mutable QReadWriteLock _recentlyDeletedEntitiesLock; /// lock of server side recent deletes
-    QMultiMap<quint64, QUuid> _recentlyDeletedEntityItemIDs; /// server side recent deletes
+    // server side recent deletes, appended in the order of their time.  The IDs of the deletes since a time are the
+    // end of the log, after the first time that is newer.
+    std::deque<quint64> _recentlyDeletedEntityTimes;
+    QByteArray _recentlyDeletedEntityIDs;
+    void logDeletedEntity(quint64 deletedAt, const QUuid& entityID); // with _recentlyDeletedEntitiesLock locked for write
+    bool _recordsDeletesForJournal { false };
+    QMultiMap<quint64, QUuid> _journalDeletedEntityIDs; /// server side deletes not yet in the persist journal
 
     mutable QReadWriteLock _deletedEntitiesLock; /// lock of client side recent deletes
     QSet<QUuid> _deletedEntityItemIDs; /// client side recent deletes
@@ -326,6 +366,14 @@ protected:
     mutable QReadWriteLock _entityMapLock;
     QHash<EntityItemID, EntityItemPointer> _entityMap;
 
+    void entityBoundsRemoved(const EntityItemID& entityID);
+    void resetBoundsSnapshot();
+    QMutex _boundsSnapshotMutex; // not to be taken while holding _entityMapLock, getBoundsSnapshot() takes that inside it
+    EntityBoundsSnapshotPointer _boundsSnapshot;
+    std::atomic<bool> _tracksBoundsChanges { false };
+    QHash<EntityItemID, EntityItemWeakPointer> _boundsChangedEntities;
+    QSet<EntityItemID> _boundsRemovedEntityIDs;
+
     mutable QReadWriteLock _entityCertificateIDMapLock;
     QHash<QString, QList<EntityItemID>> _entityCertificateIDMap;
 
@@ -21,6 +21,7 @@
 #include "EntityItem.h"
 
 #include <PickFilter.h>
+#include <shared/BlockPool.h>
 
 class EntityTree;
 class EntityTreeElement;
@@ -88,10 +89,19 @@ class EntityTreeElement : public OctreeElement, ReadWriteLockable {
 public:
     virtual ~EntityTreeElement();
 
+    // the elements come from slabs of the element pool rather than one by one from the heap
+    static void* operator new(size_t size);
+    static void operator delete(void* element, size_t size);
+    static const BlockPool& getElementPool();
+
     // type safe versions of OctreeElement methods
     EntityTreeElementPointer getChildAtIndex(int index) const {
         return std::static_pointer_cast<EntityTreeElement>(OctreeElement::getChildAtIndex(index));
     }
+    // for the traversals that look at a child without holding on to it
+    EntityTreeElement* getRawChildAtIndex(int index) const {
+        return static_cast<EntityTreeElement*>(OctreeElement::getChildAtIndex(index).get());
+    }
 
     // methods you can and should override to implement your tree functionality
 
@@ -135,6 +145,13 @@ public:
     virtual bool deleteApproved() const override { return !hasEntities(); }
 
     static bool checkFilterSettings(const EntityItemPointer& entity, PickFilter searchFilter);
+
+    // the exact tests of a single entity behind the queries of the elements, also used by the bounds snapshot queries
+    static bool findEntityRayIntersection(const EntityItemPointer& entity, const glm::vec3& origin, const glm::vec3& direction,
+        OctreeElementPointer& element, float& distance, BoxFace& face, glm::vec3& surfaceNormal, PickFilter searchFilter,
+        QVariantMap& extraInfo);
+    static bool entityIntersectsSphere(const EntityItemPointer& entity, const glm::vec3& position, float radius);
+
     virtual bool canPickIntersect() const override { return hasEntities(); }
     virtual EntityItemID evalRayIntersection(const glm::vec3& origin, const glm::vec3& direction,
         OctreeElementPointer& element, float& distance, BoxFace& face, glm::vec3& surfaceNormal,
@@ -294,7 +294,7 @@ ShapeType ModelEntityItem::computeTrueShapeType() const {
 void ModelEntityItem::setModelURL(const QString& url) {
     withWriteLock([&] {
         if (_modelURL != url) {
-            _modelURL = url;
+            _modelURL = getStringPool().intern(url);
             _flags |= Simulation::DIRTY_SHAPE | Simulation::DIRTY_MASS;
             _needsRenderUpdate = true;
         }
@@ -329,7 +329,7 @@ const Transform ModelEntityItem::getTransform(bool& success, int depth) const {
 void ModelEntityItem::setCompoundShapeURL(const QString& url) {
     withWriteLock([&] {
         if (_compoundShapeURL.get() != url) {
-            _compoundShapeURL.set(url);
+            _compoundShapeURL.set(getStringPool().intern(url));
             _flags |= Simulation::DIRTY_SHAPE | Simulation::DIRTY_MASS;
         }
     });
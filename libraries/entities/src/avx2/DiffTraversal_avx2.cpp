@@ -0,0 +1,76 @@
+//
+//  DiffTraversal_avx2.cpp
+//  libraries/entities/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+#include <NumericalConstants.h>
+
+#include "../DiffTraversal.h"
+
+static_assert(NUMBER_OF_CHILDREN == 8, "the children are tested in the 8 lanes of a __m256");
+
+// DiffTraversal::View::shouldTraverseCube() for all the children at once, one lane per child
+uint8_t cullChildCubes_AVX2(const DiffTraversal::ChildCubes& children, const ConicalViewFrustums& frustums,
+                            float minAngularSize) {
+    const float AVOID_DIVIDE_BY_ZERO = 0.001f; // as in ConicalViewFrustum::getAngularSize()
+
+    __m256 scale = _mm256_load_ps(children.scale);
+    __m256 halfScale = _mm256_mul_ps(scale, _mm256_set1_ps(0.5f));
+    __m256 centerX = _mm256_add_ps(_mm256_load_ps(children.cornerX), halfScale);
+    __m256 centerY = _mm256_add_ps(_mm256_load_ps(children.cornerY), halfScale);
+    __m256 centerZ = _mm256_add_ps(_mm256_load_ps(children.cornerZ), halfScale);
+
+    // radius of the bounding spheres
+    __m256 radius = _mm256_mul_ps(scale, _mm256_set1_ps(0.5f * SQRT_THREE));
+    __m256 radiusSquared = _mm256_mul_ps(radius, radius);
+    __m256 minSize = _mm256_set1_ps(minAngularSize);
+
+    __m256 inView = _mm256_setzero_ps();
+    for (const auto& frustum : frustums) {
+        const glm::vec3& frustumPosition = frustum.getPosition();
+        const glm::vec3& frustumDirection = frustum.getDirection();
+
+        // position of the bounding spheres in view-frame
+        __m256 x = _mm256_sub_ps(centerX, _mm256_set1_ps(frustumPosition.x));
+        __m256 y = _mm256_sub_ps(centerY, _mm256_set1_ps(frustumPosition.y));
+        __m256 z = _mm256_sub_ps(centerZ, _mm256_set1_ps(frustumPosition.z));
+        __m256 distanceSquared = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+        __m256 distance = _mm256_sqrt_ps(distanceSquared);
+
+        __m256 angularSize = _mm256_div_ps(radius, _mm256_add_ps(distance, _mm256_set1_ps(AVOID_DIVIDE_BY_ZERO)));
+        __m256 bigEnough = _mm256_cmp_ps(angularSize, minSize, _CMP_GT_OQ);
+
+        // inside the keyhole radius, or before the far clip and within the cone, see ConicalViewFrustum::intersects()
+        __m256 inKeyhole = _mm256_cmp_ps(distance, _mm256_add_ps(radius, _mm256_set1_ps(frustum.getRadius())), _CMP_LT_OQ);
+        __m256 beforeFarClip = _mm256_cmp_ps(distance, _mm256_add_ps(radius, _mm256_set1_ps(frustum.getFarClip())),
+                                             _CMP_LE_OQ);
+
+        __m256 dot = _mm256_fmadd_ps(z, _mm256_set1_ps(frustumDirection.z),
+                                     _mm256_fmadd_ps(y, _mm256_set1_ps(frustumDirection.y),
+                                                     _mm256_mul_ps(x, _mm256_set1_ps(frustumDirection.x))));
+        __m256 coneLimit = _mm256_fmsub_ps(_mm256_sqrt_ps(_mm256_sub_ps(distanceSquared, radiusSquared)),
+                                           _mm256_set1_ps(frustum.getCosAngle()),
+                                           _mm256_mul_ps(radius, _mm256_set1_ps(frustum.getSinAngle())));
+        __m256 inCone = _mm256_cmp_ps(dot, coneLimit, _CMP_GT_OQ);
+
+        __m256 intersects = _mm256_or_ps(inKeyhole, _mm256_and_ps(beforeFarClip, inCone));
+        inView = _mm256_or_ps(inView, _mm256_and_ps(bigEnough, intersects));
+    }
+
+    uint8_t result = (uint8_t)_mm256_movemask_ps(inView);
+
+    _mm256_zeroupper();
+
+    return result;
+}
+
+#endif
@@ -21,9 +21,30 @@
 #include <QtCore/QtEndian>
 #include <QtCore/QFileInfo>
 
+#include <atomic>
+
+#include <Gzip.h>
+#include <TBBHelpers.h>
 #include <shared/NsightHelpers.h>
 #include <hfm/ModelFormatLogging.h>
 
+// A compressed array whose values are only inflated once the whole file is parsed, in parallel with the others.
+// The values point into the QVector of the array property, which is shared by the copies of the property and not
+// detached by anything before then.
+struct DeferredArray {
+    const char* compressed;
+    int compressedLength;
+    char* values;
+    int valuesLength;
+};
+
+// the data of the file when it is all in memory, which the deferred arrays point into
+struct BinaryParseState {
+    const char* data { nullptr };
+    qint64 size { 0 };
+    std::vector<DeferredArray> deferredArrays;
+};
+
 template<class T>
 int streamSize() {
     return sizeof(T);
@@ -35,7 +56,7 @@ int streamSize() {
 }
 
 template<class T>
-QVariant readBinaryArray(QDataStream& in, int& position) {
+QVariant readBinaryArray(QDataStream& in, int& position, BinaryParseState& state) {
     quint32 arrayLength;
     quint32 encoding;
     quint32 compressedLength;
@@ -53,27 +74,33 @@ QVariant readBinaryArray(QDataStream& in, int& position) {
 
     QVector<T> values;
     if ((int)QSysInfo::ByteOrder == (int)in.byteOrder()) {
+        // the values are read, or inflated, straight into the array
         values.resize(arrayLength);
-        hifi::ByteArray arrayData;
+        int valuesLength = (int)(sizeof(T) * arrayLength);
         if (encoding == FBX_PROPERTY_COMPRESSED_FLAG) {
-            // preface encoded data with uncompressed length
-            hifi::ByteArray compressed(sizeof(quint32) + compressedLength, 0);
-            *((quint32*)compressed.data()) = qToBigEndian<quint32>(arrayLength * sizeof(T));
-            in.readRawData(compressed.data() + sizeof(quint32), compressedLength);
-            position += compressedLength;
-            arrayData = qUncompress(compressed);
-            if (arrayData.isEmpty() ||
-                (unsigned int)arrayData.size() != (sizeof(T) * arrayLength)) { // answers empty byte array if corrupt
-                throw QString("corrupt fbx file");
+            if (arrayLength == 0) {
+                in.skipRawData(compressedLength);
+            } else if (state.data) {
+                if (in.device()->pos() + compressedLength > state.size) {
+                    throw QString("corrupt fbx file");
+                }
+                state.deferredArrays.push_back({ state.data + in.device()->pos(), (int)compressedLength,
+                    (char*)values.data(), valuesLength });
+                in.skipRawData(compressedLength);
+            } else {
+                hifi::ByteArray compressed(compressedLength, 0);
+                in.readRawData(compressed.data(), compressedLength);
+                if (!inflateInto((const unsigned char*)compressed.constData(), compressed.size(),
+                                 (unsigned char*)values.data(), valuesLength)) {
+                    throw QString("corrupt fbx file");
+                }
             }
+            position += compressedLength;
         } else {
-            arrayData.resize(sizeof(T) * arrayLength);
-            position += sizeof(T) * arrayLength;
-            in.readRawData(arrayData.data(), arrayData.size());
-        }
-
-        if (arrayData.size() > 0) {
-            memcpy(&values[0], arrayData.constData(), arrayData.size());
+            position += valuesLength;
+            if (valuesLength > 0) {
+                in.readRawData((char*)values.data(), valuesLength);
+            }
         }
     } else {
         values.reserve(arrayLength);
@@ -107,7 +134,7 @@ QVariant readBinaryArray(QDataStream& in, int& position) {
     return QVariant::fromValue(values);
 }
 
-QVariant parseBinaryFBXProperty(QDataStream& in, int& position) {
+QVariant parseBinaryFBXProperty(QDataStream& in, int& position, BinaryParseState& state) {
     char ch;
     in.device()->getChar(&ch);
     position++;
@@ -149,19 +176,19 @@ QVariant parseBinaryFBXProperty(QDataStream& in, int& position) {
             return QVariant::fromValue(value);
         }
         case 'f': {
-            return readBinaryArray<float>(in, position);
+            return readBinaryArray<float>(in, position, state);
         }
         case 'd': {
-            return readBinaryArray<double>(in, position);
+            return readBinaryArray<double>(in, position, state);
         }
         case 'l': {
-            return readBinaryArray<qint64>(in, position);
+            return readBinaryArray<qint64>(in, position, state);
         }
         case 'i': {
-            return readBinaryArray<qint32>(in, position);
+            return readBinaryArray<qint32>(in, position, state);
         }
         case 'b': {
-            return readBinaryArray<bool>(in, position);
+            return readBinaryArray<bool>(in, position, state);
         }
         case 'S':
         case 'R': {
@@ -175,7 +202,7 @@ QVariant parseBinaryFBXProperty(QDataStream& in, int& position) {
     }
 }
 
-FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPositions = false) {
+FBXNode parseBinaryFBXNode(QDataStream& in, int& position, BinaryParseState& state, bool has64BitPositions = false) {
     qint64 endOffset;
     quint64 propertyCount;
     quint64 propertyListLength;
@@ -215,11 +242,11 @@ FBXNode parseBinaryFBXNode(QDataStream& in, int& position, bool has64BitPosition
     position += nameLength;
 
     for (quint32 i = 0; i < propertyCount; i++) {
-        node.properties.append(parseBinaryFBXProperty(in, position));
+        node.properties.append(parseBinaryFBXProperty(in, position, state));
     }
 
     while (endOffset > position) {
-        FBXNode child = parseBinaryFBXNode(in, position, has64BitPositions);
+        FBXNode child = parseBinaryFBXNode(in, position, state, has64BitPositions);
         if (!child.name.isNull()) {
             node.children.append(child);
         }
@@ -387,18 +414,38 @@ FBXNode FBXSerializer::parseFBX(QIODevice* device) {
     position += sizeof(fileVersion);
     bool has64BitPositions = (fileVersion >= FBX_VERSION_2016);
 
+    // the arrays of a file that is in memory are inflated once it has all been parsed
+    BinaryParseState state;
+    auto buffer = qobject_cast<QBuffer*>(device);
+    if (buffer) {
+        state.data = buffer->data().constData();
+        state.size = buffer->data().size();
+    }
+
     // parse the top-level node
     FBXNode top;
     while (device->bytesAvailable()) {
-        FBXNode next = parseBinaryFBXNode(in, position, has64BitPositions);
+        FBXNode next = parseBinaryFBXNode(in, position, state, has64BitPositions);
         if (next.name.isNull()) {
-            return top;
+            break;
 
         } else {
             top.children.append(next);
         }
     }
 
+    std::atomic<bool> isCorrupt { false };
+    tbb::parallel_for((size_t)0, state.deferredArrays.size(), [&](size_t i) {
+        const auto& array = state.deferredArrays[i];
+        if (!inflateInto((const unsigned char*)array.compressed, array.compressedLength,
+                         (unsigned char*)array.values, array.valuesLength)) {
+            isCorrupt = true;
+        }
+    });
+    if (isCorrupt) {
+        throw QString("corrupt fbx file");
+    }
+
     return top;
 }
 
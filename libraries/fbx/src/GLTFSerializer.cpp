@@ -25,6 +25,8 @@
 #include <QtNetwork/QNetworkAccessManager>
 #include <QtNetwork/QNetworkRequest>
 
+#include <algorithm>
+#include <type_traits>
 #include <unordered_set>
 #include <map>
 #include <qfile.h>
@@ -425,6 +427,7 @@ bool GLTFSerializer::addBufferView(const QJsonObject& object) {
     getIntVal(object, "buffer", bufferview.buffer, bufferview.defined);
     getIntVal(object, "byteLength", bufferview.byteLength, bufferview.defined);
     getIntVal(object, "byteOffset", bufferview.byteOffset, bufferview.defined);
+    getIntVal(object, "byteStride", bufferview.byteStride, bufferview.defined);
     getIntVal(object, "target", bufferview.target, bufferview.defined);
 
     _file.bufferviews.push_back(bufferview);
@@ -1760,13 +1763,7 @@ void GLTFSerializer::setHFMMaterial(HFMMaterial& fbxmat, const GLTFMaterial& mat
 }
 
 template <typename T, typename L>
-bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int count, QVector<L>& outarray, int accessorType) {
-    QDataStream blobstream(bin);
-    blobstream.setByteOrder(QDataStream::LittleEndian);
-    blobstream.setVersion(QDataStream::Qt_5_9);
-    blobstream.setFloatingPointPrecision(QDataStream::FloatingPointPrecision::SinglePrecision);
-    blobstream.skipRawData(byteOffset);
-
+bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count, QVector<L>& outarray, int accessorType) {
     int bufferCount = 0;
     switch (accessorType) {
         case GLTFAccessorType::SCALAR:
@@ -1792,28 +1789,43 @@ bool GLTFSerializer::readArray(const hifi::ByteArray& bin, int byteOffset, int c
             break;
         default:
             qWarning(modelformat) << "Unknown accessorType: " << accessorType;
-            blobstream.setDevice(nullptr);
             return false;
     }
-    for (int i = 0; i < count; ++i) {
+    if (count <= 0) {
+        return true;
+    }
+
+    // the elements are views over the binary data, which is little endian
+    qint64 elementSize = (qint64)bufferCount * (qint64)sizeof(T);
+    qint64 stride = byteStride > 0 ? (qint64)byteStride : elementSize;
+    if (byteOffset < 0 || stride < elementSize || (qint64)byteOffset + (count - 1) * stride + elementSize > (qint64)bin.size()) {
+        return false;
+    }
+    const char* source = bin.constData() + byteOffset;
+    int start = outarray.size();
+    outarray.resize(start + count * bufferCount);
+    L* destination = outarray.data() + start;
+
+    if (std::is_same<T, L>::value && stride == elementSize && Q_BYTE_ORDER == Q_LITTLE_ENDIAN) {
+        memcpy(destination, source, count * elementSize);
+        return true;
+    }
+    for (int i = 0; i < count; ++i, source += stride) {
         for (int j = 0; j < bufferCount; ++j) {
-            if (!blobstream.atEnd()) {
-                T value;
-                blobstream >> value;
-                outarray.push_back(value);
-            } else {
-                blobstream.setDevice(nullptr);
-                return false;
-            }
+            T value;
+            memcpy(&value, source + j * sizeof(T), sizeof(T));
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+            std::reverse((char*)&value, (char*)&value + sizeof(T));
+#endif
+            *destination++ = (L)value;
         }
     }
-
-    blobstream.setDevice(nullptr);
     return true;
 }
 template <typename T>
 bool GLTFSerializer::addArrayOfType(const hifi::ByteArray& bin,
                                     int byteOffset,
+                                    int byteStride,
                                     int count,
                                     QVector<T>& outarray,
                                     int accessorType,
@@ -1821,19 +1833,19 @@ bool GLTFSerializer::addArrayOfType(const hifi::ByteArray& bin,
     switch (componentType) {
         case GLTFAccessorComponentType::BYTE: {}
         case GLTFAccessorComponentType::UNSIGNED_BYTE: {
-            return readArray<uchar>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<uchar>(bin, byteOffset, byteStride, count, outarray, accessorType);
         }
         case GLTFAccessorComponentType::SHORT: {
-            return readArray<short>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<short>(bin, byteOffset, byteStride, count, outarray, accessorType);
         }
         case GLTFAccessorComponentType::UNSIGNED_INT: {
-            return readArray<uint>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<uint>(bin, byteOffset, byteStride, count, outarray, accessorType);
         }
         case GLTFAccessorComponentType::UNSIGNED_SHORT: {
-            return readArray<ushort>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<ushort>(bin, byteOffset, byteStride, count, outarray, accessorType);
         }
         case GLTFAccessorComponentType::FLOAT: {
-            return readArray<float>(bin, byteOffset, count, outarray, accessorType);
+            return readArray<float>(bin, byteOffset, byteStride, count, outarray, accessorType);
         }
     }
     return false;
@@ -1957,7 +1969,7 @@ bool GLTFSerializer::addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& ou
 
         int accBoffset = accessor.defined["byteOffset"] ? accessor.byteOffset : 0;
 
-        success = addArrayOfType(buffer.blob, bufferview.byteOffset + accBoffset, accessor.count, outarray, accessor.type,
+        success = addArrayOfType(buffer.blob, bufferview.byteOffset + accBoffset, bufferview.byteStride, accessor.count, outarray, accessor.type,
                                  accessor.componentType);
     } else {
         for (int i = 0; i < accessor.count; ++i) {
@@ -1976,7 +1988,7 @@ bool GLTFSerializer::addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& ou
 
             int accSIBoffset = accessor.sparse.indices.defined["byteOffset"] ? accessor.sparse.indices.byteOffset : 0;
 
-            success = addArrayOfType(sparseIndicesBuffer.blob, sparseIndicesBufferview.byteOffset + accSIBoffset,
+            success = addArrayOfType(sparseIndicesBuffer.blob, sparseIndicesBufferview.byteOffset + accSIBoffset, 0,
                                      accessor.sparse.count, out_sparse_indices_array, GLTFAccessorType::SCALAR,
                                      accessor.sparse.indices.componentType);
             if (success) {
@@ -1987,7 +1999,7 @@ bool GLTFSerializer::addArrayFromAccessor(GLTFAccessor& accessor, QVector<T>& ou
 
                 int accSVBoffset = accessor.sparse.values.defined["byteOffset"] ? accessor.sparse.values.byteOffset : 0;
 
-                success = addArrayOfType(sparseValuesBuffer.blob, sparseValuesBufferview.byteOffset + accSVBoffset,
+                success = addArrayOfType(sparseValuesBuffer.blob, sparseValuesBufferview.byteOffset + accSVBoffset, 0,
                                          accessor.sparse.count, out_sparse_values_array, accessor.type, accessor.componentType);
 
                 if (success) {
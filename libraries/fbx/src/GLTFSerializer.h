@@ -208,12 +208,16 @@ struct GLTFBufferView {
     int buffer; //required
     int byteLength; //required
     int byteOffset { 0 };
+    int byteStride { 0 };
     int target;
     QMap<QString, bool> defined;
     void dump() {
         if (defined["buffer"]) {
             qCDebug(modelformat) << "buffer: " << buffer;
         }
+        if (defined["byteStride"]) {
+            qCDebug(modelformat) << "byteStride: " << byteStride;
+        }
         if (defined["byteLength"]) {
             qCDebug(modelformat) << "byteLength: " << byteLength;
         }
@@ -882,12 +886,13 @@ private:
 
     bool readBinary(const QString& url, hifi::ByteArray& outdata);
 
+    // byteStride is the distance between the elements of an interleaved buffer view, 0 when they are packed
     template<typename T, typename L>
-    bool readArray(const hifi::ByteArray& bin, int byteOffset, int count,
+    bool readArray(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count,
                    QVector<L>& outarray, int accessorType);
 
     template<typename T>
-    bool addArrayOfType(const hifi::ByteArray& bin, int byteOffset, int count,
+    bool addArrayOfType(const hifi::ByteArray& bin, int byteOffset, int byteStride, int count,
                         QVector<T>& outarray, int accessorType, int componentType);
 
     template <typename T>
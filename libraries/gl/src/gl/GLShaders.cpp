@@ -1,6 +1,7 @@
 #include "GLShaders.h"
 
 #include "GLLogging.h"
+#include "GLHelpers.h"
 
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonValue>
@@ -436,6 +437,13 @@ const QString& getShaderCacheFile() {
 static const char* SHADER_JSON_TYPE_KEY = "type";
 static const char* SHADER_JSON_SOURCE_KEY = "source";
 static const char* SHADER_JSON_DATA_KEY = "data";
+static const char* SHADER_JSON_DRIVER_KEY = "driver";
+
+// binaries only load back on the driver that built them
+static QString getDriverSignature() {
+    const auto& contextInfo = ContextInfo::get(true);
+    return QString::fromStdString(contextInfo.vendor + " " + contextInfo.renderer + " " + contextInfo.version);
+}
 
 void gl::loadShaderCache(ShaderCache& cache) {
 #if !defined(DISABLE_QML)
@@ -443,7 +451,14 @@ void gl::loadShaderCache(ShaderCache& cache) {
     if (QFileInfo(shaderCacheFile).exists()) {
         QString json = FileUtils::readFile(shaderCacheFile);
         auto root = QJsonDocument::fromJson(json.toUtf8()).object();
+        if (root[SHADER_JSON_DRIVER_KEY].toString() != getDriverSignature()) {
+            qCDebug(glLogging) << "Discarding the shader cache, it was built by another driver";
+            return;
+        }
         for (const auto& qhash : root.keys()) {
+            if (qhash == SHADER_JSON_DRIVER_KEY) {
+                continue;
+            }
             auto programObject = root[qhash].toObject();
             QByteArray qbinary = QByteArray::fromBase64(programObject[SHADER_JSON_DATA_KEY].toString().toUtf8());
             std::string hash = qhash.toStdString();
@@ -471,6 +486,7 @@ void gl::saveShaderCache(const ShaderCache& cache) {
             qentry[SHADER_JSON_DATA_KEY] = QByteArray{ binary.data(), (int)binary.size() }.toBase64();
             variantMap[key.c_str()] = qentry;
         }
+        variantMap[SHADER_JSON_DRIVER_KEY] = getDriverSignature();
         json = QJsonDocument::fromVariant(variantMap).toJson(QJsonDocument::Indented);
     }
 
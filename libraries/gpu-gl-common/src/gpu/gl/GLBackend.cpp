@@ -68,6 +68,7 @@ GLBackend::CommandCall GLBackend::_commandCalls[Batch::NUM_COMMANDS] =
     (&::gpu::gl::GLBackend::do_blit),
     (&::gpu::gl::GLBackend::do_generateTextureMips),
     (&::gpu::gl::GLBackend::do_generateTextureMipsWithPipeline),
+    (&::gpu::gl::GLBackend::do_readPixels),
 
     (&::gpu::gl::GLBackend::do_advance),
 
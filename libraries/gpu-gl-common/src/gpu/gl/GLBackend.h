@@ -172,6 +172,7 @@ public:
     virtual void do_setFramebufferSwapChain(const Batch& batch, size_t paramOffset) final;
     virtual void do_clearFramebuffer(const Batch& batch, size_t paramOffset) final;
     virtual void do_blit(const Batch& batch, size_t paramOffset) = 0;
+    virtual void do_readPixels(const Batch& batch, size_t paramOffset) final;
 
     virtual void do_advance(const Batch& batch, size_t paramOffset) final;
 
@@ -401,6 +402,9 @@ protected:
         GLuint _drawCallInfoBuffer{ 0 };
         GLuint _objectBufferTexture{ 0 };
         size_t _cameraUboSize{ 0 };
+        // a backend streaming the cameras of a batch into a buffer of its own sets it here, 0 means _cameraBuffer
+        mutable GLuint _currentCameraBuffer{ 0 };
+        mutable size_t _currentCameraBufferOffset{ 0 };
         bool _viewIsCamera{ false };
         bool _skybox{ false };
         Transform _view;
@@ -550,6 +554,18 @@ protected:
         GLuint _drawFBO{ 0 };
     } _output;
 
+    // The readPixels() commands still in flight, in the pixel pack buffer they are read to
+    struct PixelRead {
+        GLuint _buffer { 0 };
+        GLsync _fence { 0 };
+        size_t _numPixels { 0 };
+        Batch::ReadPixelsHandler _handler;
+    };
+    std::list<PixelRead> _pixelReads;
+
+    // hands the pixel reads the gpu is done with over to their handlers
+    void finishPixelReads();
+
     void resetQueryStage();
     struct QueryStageState {
         uint32_t _rangeQueryDepth{ 0 };
@@ -174,6 +174,81 @@ void GLBackend::do_clearFramebuffer(const Batch& batch, size_t paramOffset) {
     (void) CHECK_GL_ERROR();
 }
 
+void GLBackend::do_readPixels(const Batch& batch, size_t paramOffset) {
+    finishPixelReads();
+
+    auto handlerIndex = batch._params[paramOffset + 5]._uint;
+    if (handlerIndex >= batch._readPixelsHandlers.size()) {
+        // the handlers don't survive the serialization of a frame
+        return;
+    }
+
+    const auto& framebuffer = batch._framebuffers.get(batch._params[paramOffset]._uint);
+    Vec4i rect {
+        batch._params[paramOffset + 1]._int,
+        batch._params[paramOffset + 2]._int,
+        batch._params[paramOffset + 3]._int,
+        batch._params[paramOffset + 4]._int
+    };
+    auto readFBO = getFramebufferID(framebuffer);
+    if (!framebuffer || !readFBO || rect.z <= 0 || rect.w <= 0 ||
+        (framebuffer->getWidth() < (uint32)(rect.x + rect.z)) || (framebuffer->getHeight() < (uint32)(rect.y + rect.w))) {
+        qCWarning(gpugllogging) << "GLBackend::do_readPixels : the framebuffer can't provide the rect region queried";
+        return;
+    }
+
+    PixelRead read;
+    read._numPixels = (size_t)(rect.z * rect.w);
+    read._handler = batch._readPixelsHandlers.get(handlerIndex);
+
+    // the pixels go to a pixel pack buffer, so glReadPixels() returns before the gpu gets to them
+    glGenBuffers(1, &read._buffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, read._buffer);
+    glBufferData(GL_PIXEL_PACK_BUFFER, read._numPixels * sizeof(float), nullptr, GL_STREAM_READ);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFBO);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glReadPixels(rect.x, rect.y, rect.z, rect.w, GL_RED, GL_FLOAT, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    read._fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    _pixelReads.push_back(read);
+
+    (void) CHECK_GL_ERROR();
+}
+
+void GLBackend::finishPixelReads() {
+    // the reads complete in order, so the first one still pending ends the walk
+    while (!_pixelReads.empty()) {
+        auto& read = _pixelReads.front();
+        GLenum status = glClientWaitSync(read._fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            break;
+        }
+
+        std::vector<float> pixels(read._numPixels);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, read._buffer);
+        auto mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, read._numPixels * sizeof(float), GL_MAP_READ_BIT);
+        if (mapped) {
+            memcpy(pixels.data(), mapped, read._numPixels * sizeof(float));
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        glDeleteSync(read._fence);
+        glDeleteBuffers(1, &read._buffer);
+        auto handler = std::move(read._handler);
+        _pixelReads.pop_front();
+
+        if (mapped) {
+            handler(pixels);
+        }
+    }
+
+    (void) CHECK_GL_ERROR();
+}
+
 void GLBackend::downloadFramebuffer(const FramebufferPointer& srcFramebuffer, const Vec4i& region, QImage& destImage) {
     auto readFBO = getFramebufferID(srcFramebuffer);
     if (srcFramebuffer && readFBO) {
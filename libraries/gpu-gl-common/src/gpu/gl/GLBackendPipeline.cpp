@@ -304,6 +304,7 @@ void GLBackend::setResourceTexture(unsigned int slot, const TexturePointer& reso
     GLTexture* object = syncGPUObject(resourceTexture);
     if (object) {
         assign(textureState._texture, resourceTexture);
+        object->_lastUsedFrame = _textureManagement._transferEngine->getFrameCount();
         GLuint to = object->_texture;
         textureState._target = object->_target;
         glActiveTexture(GL_TEXTURE0 + slot);
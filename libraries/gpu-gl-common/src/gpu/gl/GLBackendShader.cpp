@@ -118,6 +118,7 @@ GLShader* GLBackend::compileBackendProgram(const Shader& program, const Shader::
             glprogram = ::gl::buildProgram(cachedBinary);
             if (0 != glprogram) {
                 ++gpuBinaryShadersLoaded;
+                _stats._PSNumProgramBinaryHits++;
             } else {
                 cachedBinary = CachedShader();
                 std::unique_lock<std::mutex> shaderCacheLock{ _shaderBinaryCache._mutex };
@@ -128,6 +129,8 @@ GLShader* GLBackend::compileBackendProgram(const Shader& program, const Shader::
         // If we have no program, then either no cached binary, or the binary failed to load 
         // (perhaps a GPU driver update invalidated the cache)
         if (0 == glprogram) {
+            _stats._PSNumProgramBinaryMisses++;
+
             // Let's go through every shaders and make sure they are ready to go
             std::vector<GLuint> shaderGLObjects;
             shaderGLObjects.reserve(program.getShaders().size());
@@ -219,6 +219,17 @@ void GLVariableAllocationSupport::sanityCheck() const {
     }
 }
 
+// The mips of ktx textures are views of their mapped file. Reading a byte of every page has the os page them in
+// here, rather than in the upload on the render thread.
+static void touchPages(const storage::StoragePointer& storage) {
+    static const size_t TOUCHED_PAGE_SIZE = 4096;
+    const volatile uint8_t* data = storage->data();
+    size_t size = storage->size();
+    for (size_t offset = 0; offset < size; offset += TOUCHED_PAGE_SIZE) {
+        (void)data[offset];
+    }
+}
+
 TransferJob::TransferJob(const Texture& texture,
     uint16_t sourceMip,
     uint16_t targetMip,
@@ -255,6 +266,7 @@ TransferJob::TransferJob(const Texture& texture,
         auto mipStorage = texture->accessStoredMipFace(sourceMip, face);
         if (mipStorage) {
             _mipData = mipStorage->createView(_transferSize, _transferOffset);
+            touchPages(_mipData);
         } else {
             qCWarning(gpugllogging) << "Buffering failed because mip could not be retrieved from texture "
                 << texture->source().c_str();
@@ -39,16 +39,20 @@ public:
     /// Called whenever a client creates a new resource texture that should use managed memory
     /// and incremental transfer
     void addMemoryManagedTexture(const TexturePointer& texturePointer);
+    /// The number of frames managed so far, for stamping the textures as they get used
+    uint32_t getFrameCount() const { return _frameCount; }
 
 protected:
     // Fetch all the currently active textures as strong pointers, while clearing the 
     // empty weak pointers out of _registeredTextures
     std::vector<TexturePointer> getAllTextures();
     void resetFrameTextureCreated() { _frameTexturesCreated = 0;  }
+    void countFrame() { ++_frameCount; }
 
 private:
     static const size_t MAX_RESOURCE_TEXTURES_PER_FRAME{ 2 };
     size_t _frameTexturesCreated{ 0 };
+    uint32_t _frameCount{ 0 };
     std::list<TextureWeakPointer> _registeredTextures;
 };
 
@@ -102,6 +106,7 @@ public:
 
     void sanityCheck() const;
     uint16 populatedMip() const { return _populatedMip; }
+    uint16 allocatedMip() const { return _allocatedMip; }
     bool canPromote() const { return _allocatedMip > _minAllocatedMip; }
     bool canDemote() const { return _allocatedMip < _maxAllocatedMip; }
     bool hasPendingTransfers() const { return _populatedMip > _allocatedMip; }
@@ -159,6 +164,8 @@ public:
     virtual Size size() const = 0;
     virtual Size copyMipFaceLinesFromTexture(uint16_t mip, uint8_t face, const uvec3& size, uint32_t yOffset, GLenum internalFormat, GLenum format, GLenum type, Size sourceSize, const void* sourcePointer) const = 0;
     virtual Size copyMipFaceFromTexture(uint16_t sourceMip, uint16_t targetMip, uint8_t face) const final;
+    // The frame of the transfer engine this texture was last bound in
+    uint32_t lastUsedFrame() const { return _lastUsedFrame; }
 
     static const uint8_t TEXTURE_2D_NUM_FACES = 1;
     static const uint8_t TEXTURE_CUBE_NUM_FACES = 6;
@@ -172,6 +179,8 @@ protected:
 
     virtual void copyTextureMipsInGPUMem(GLuint srcId, GLuint destId, uint16_t srcMipOffset, uint16_t destMipOffset, uint16_t populatedMips) {} // Only relevant for Variable Allocation textures
 
+    uint32_t _lastUsedFrame { 0 };
+
     GLTexture(const std::weak_ptr<gl::GLBackend>& backend, const Texture& texture, GLuint id);
 };
 
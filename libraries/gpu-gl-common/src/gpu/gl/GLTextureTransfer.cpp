@@ -43,9 +43,35 @@ using QueuePair = std::pair<TextureWeakPointer, float>;
 // Uses a weak pointer to the texture to avoid keeping it in scope if the client stops using it
 using WorkQueue = std::priority_queue<QueuePair, std::vector<QueuePair>, LessPairSecond<QueuePair>>;
 
-using ImmediateQueuePair = std::pair<TexturePointer, float>;
-// Contains a priority sorted list of textures on which work is to be done in the current frame
-using ImmediateWorkQueue = std::priority_queue<ImmediateQueuePair, std::vector<ImmediateQueuePair>, LessPairSecond<ImmediateQueuePair>>;
+// A texture that can give up some memory in the current frame
+struct DemoteCandidate {
+    TexturePointer texture;
+    uint32_t lastUsedFrame;
+    float priority;
+};
+
+// How many mips of detail the texture is short of what its screen footprint asks for, negative when it holds more
+// than it needs. A texture no render item reported on screen needs none of its mips.
+static float evalMissingDetail(const Texture& texture, uint16 allocatedMip) {
+    float width = (float)std::max(texture.getWidth(), texture.getHeight());
+    float wantedWidth = std::min(texture.getScreenFootprint(), width);
+    float allocatedWidth = std::max(width / (float)(1 << allocatedMip), 1.0f);
+    return log2f(std::max(wantedWidth, 1.0f) / allocatedWidth);
+}
+
+// Promote the textures missing the most visible detail per byte first, the smallest first among the unseen ones
+static float evalPromotePriority(const Texture& texture, const GLTexture* gltexture,
+                                 const GLVariableAllocationSupport* vargltexture) {
+    float missingDetail = std::max(evalMissingDetail(texture, vargltexture->allocatedMip()), 0.0f);
+    return (1.0f + missingDetail) / (float)gltexture->size();
+}
+
+// Demote the largest textures holding the most detail nobody sees first
+static float evalDemotePriority(const Texture& texture, const GLTexture* gltexture,
+                                const GLVariableAllocationSupport* vargltexture) {
+    float excessDetail = std::max(-evalMissingDetail(texture, vargltexture->allocatedMip()), 0.0f);
+    return (1.0f + excessDetail) * (float)gltexture->size();
+}
 
 // A map of weak texture pointers to queues of work to be done to transfer their data from the backing store to the GPU
 using TransferMap = std::map<TextureWeakPointer, TransferQueue, std::owner_less<TextureWeakPointer>>;
@@ -166,6 +192,7 @@ void GLTextureTransferEngineDefault::manageMemory() {
     PROFILE_RANGE(render_gpu_gl, __FUNCTION__);
     // reset the count used to limit the number of textures created per frame
     resetFrameTextureCreated();
+    countFrame();
     // Determine the current memory management state.  It will be either idle (no work to do),
     // undersubscribed (need to do more allocation) or transfer (need to upload content from the
     // backing store to the GPU
@@ -255,8 +282,7 @@ void GLTextureTransferEngineDefault::updateMemoryPressure() {
             GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
             GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
             if (MemoryPressureState::Undersubscribed == _memoryPressureState && vargltexture->canPromote()) {
-                // Promote smallest first
-                _promoteQueue.push({ texture, 1.0f / (float)gltexture->size() });
+                _promoteQueue.push({ texture, evalPromotePriority(*texture, gltexture, vargltexture) });
             } else if (MemoryPressureState::Transfer == _memoryPressureState && vargltexture->hasPendingTransfers()) {
                 populateTransferQueue(texture);
             }
@@ -300,6 +326,7 @@ void GLTextureTransferEngineDefault::processTransferQueues() {
             const auto& tranferJob = activeTransferJob.second;
             if (tranferJob->sourceMip() < vargltexture->populatedMip()) {
                 tranferJob->transfer(texturePointer);
+                Backend::textureTransferredGPUMemSize.update(0, tranferJob->size());
             }
             // The pop_front MUST be the last call since all of these varaibles in scope are
             // references that will be invalid after the pop
@@ -445,8 +472,7 @@ void GLTextureTransferEngineDefault::processPromotes() {
         vartexture->promote();
         auto allocationDelta = gltexture->size() - originalSize;
         if (vartexture->canPromote()) {
-            // Promote smallest first
-            _promoteQueue.push({ texture, 1.0f / (float)gltexture->size() });
+            _promoteQueue.push({ texture, evalPromotePriority(*texture, gltexture, vartexture) });
         }
         allocatedBytes += allocationDelta;
         if (++allocations >= MAX_ALLOCATIONS_PER_FRAME) {
@@ -465,29 +491,32 @@ void GLTextureTransferEngineDefault::processPromotes() {
 }
 
 void GLTextureTransferEngineDefault::processDemotes(size_t reliefRequired, const std::vector<TexturePointer>& strongTextures) {
-    // Demote largest first
-    ImmediateWorkQueue demoteQueue;
+    // Demote the least recently used first, among the textures last used in the same frame the ones holding
+    // the most unseen detail first
+    std::vector<DemoteCandidate> demoteCandidates;
     for (const auto& texture : strongTextures) {
         GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
         GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
         if (vargltexture->canDemote()) {
-            demoteQueue.push({ texture, (float)gltexture->size() });
+            demoteCandidates.push_back({ texture, gltexture->lastUsedFrame(), evalDemotePriority(*texture, gltexture, vargltexture) });
         }
     }
+    std::sort(demoteCandidates.begin(), demoteCandidates.end(), [](const DemoteCandidate& a, const DemoteCandidate& b) {
+        if (a.lastUsedFrame != b.lastUsedFrame) {
+            return a.lastUsedFrame < b.lastUsedFrame;
+        }
+        return a.priority > b.priority;
+    });
 
     size_t relieved = 0;
-    while (!demoteQueue.empty() && relieved < reliefRequired) {
-        {
-            const auto& target = demoteQueue.top();
-            const auto& texture = target.first;
-            GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
-            auto oldSize = gltexture->size();
-            GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
-            vargltexture->demote();
-            auto newSize = gltexture->size();
-            relieved += (oldSize - newSize);
-        }
-        demoteQueue.pop();
+    for (auto it = demoteCandidates.begin(); it != demoteCandidates.end() && relieved < reliefRequired; ++it) {
+        GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*it->texture);
+        auto oldSize = gltexture->size();
+        GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
+        vargltexture->demote();
+        auto newSize = gltexture->size();
+        relieved += (oldSize - newSize);
+        Backend::textureResourceEvictionCount.increment();
     }
 }
 
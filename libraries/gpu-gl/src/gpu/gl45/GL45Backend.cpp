@@ -38,6 +38,11 @@ GL45Backend::GL45Backend() : Parent() {
     staticInit();
 }
 
+void GL45Backend::shutdown() {
+    killTransformRing();
+    Parent::shutdown();
+}
+
 void GL45Backend::recycle() const {
     Parent::recycle();
 }
@@ -15,6 +15,7 @@
 #include <gpu/gl/GLBackend.h>
 #include <gpu/gl/GLTexture.h>
 
+#include <array>
 #include <thread>
 #include <gpu/TextureTable.h>
 
@@ -51,7 +52,10 @@ public:
     static const std::string GL45_VERSION;
     const std::string& getVersion() const override { return GL45_VERSION; }
 
+    void shutdown() override;
+
     bool supportedTextureFormat(const gpu::Element& format) override;
+    bool supportsMultiDrawIndirect() const override { return true; }
 
     class GL45Texture : public GLTexture {
         using Parent = GLTexture;
@@ -175,6 +179,10 @@ public:
 
         Size copyMipFaceLinesFromTexture(uint16_t mip, uint8_t face, const uvec3& size, uint32_t yOffset, GLenum internalFormat, GLenum format, GLenum type, Size sourceSize, const void* sourcePointer) const override;
         void copyTextureMipsInGPUMem(GLuint srcId, GLuint destId, uint16_t srcMipOffset, uint16_t destMipOffset, uint16_t populatedMips) override;
+        void populateTransferQueue(TransferQueue& pendingTransfers) override;
+
+        // The mip of the gpu::Texture held by the first level of the gl storage
+        virtual uint16_t getStorageMipOffset() const = 0;
 
 #if GPU_BINDLESS_TEXTURES
         virtual const Bindless& getBindless() const override;
@@ -191,13 +199,14 @@ public:
         void syncSampler() const override;
         size_t promote() override;
         size_t demote() override;
-        void populateTransferQueue(TransferQueue& pendingTransfers) override;
+        uint16_t getStorageMipOffset() const override { return _allocatedMip; }
 
         void allocateStorage(uint16 mip);
         Size copyMipsFromTexture();
     };
 
-#if 0
+    // Resource textures allocated once over their whole mip chain as sparse storage. Promoting and demoting them
+    // commits and decommits the pages of their mips, instead of reallocating the texture and copying the mips over.
     class GL45SparseResourceTexture : public GL45VariableAllocationTexture {
         using Parent = GL45VariableAllocationTexture;
         friend class GL45Backend;
@@ -210,26 +219,26 @@ public:
         static bool isSparseEligible(const Texture& texture);
         static PageDimensions getPageDimensionsForFormat(const TextureTypeFormat& typeFormat);
         static PageDimensions getPageDimensionsForFormat(GLenum type, GLenum format);
-        static const uint32_t DEFAULT_PAGE_DIMENSION = 128;
-        static const uint32_t DEFAULT_MAX_SPARSE_LEVEL = 0xFFFF;
 
     protected:
         GL45SparseResourceTexture(const std::weak_ptr<GLBackend>& backend, const Texture& texture);
         ~GL45SparseResourceTexture();
-        uint32 size() const override { return _allocatedPages * _pageBytes; }
-        void promote() override;
-        void demote() override;
+
+        void syncSampler() const override;
+        size_t promote() override;
+        size_t demote() override;
+        uint16_t getStorageMipOffset() const override { return 0; }
 
     private:
-        uvec3 getPageCounts(const uvec3& dimensions) const;
         uint32_t getPageCount(const uvec3& dimensions) const;
+        void commitMips(uint16_t beginMip, uint16_t endMip, bool commit);
 
-        uint32_t _allocatedPages { 0 };
-        uint32_t _pageBytes { 0 };
-        uvec3 _pageDimensions { DEFAULT_PAGE_DIMENSION };
-        GLuint _maxSparseLevel { DEFAULT_MAX_SPARSE_LEVEL };
+        uvec3 _pageDimensions { 0 };
+        Size _pageBytes { 0 };
+        // The mips from this one on make the mip tail, they share pages that can't be decommitted
+        uint16_t _numSparseLevels { 0 };
+        uint32_t _committedPages { 0 };
     };
-#endif
 
 protected:
 
@@ -265,6 +274,33 @@ protected:
     void initTransform() override;
     void updateTransform(const Batch& batch) override;
 
+    // The cameras, objects and named draw call infos of the batches are written to a persistently mapped buffer
+    // instead of orphaning the transform buffers for every batch. The buffer is split in sections, a section
+    // gets a fence when the writes move on to the next one and is only written again once the gpu passed it.
+    struct TransformRing {
+        static const size_t NUM_SECTIONS { 3 };
+        static const size_t SECTION_SIZE { 8 * 1024 * 1024 };
+
+        GLuint _buffer{ 0 };
+        uint8_t* _mapped{ nullptr };
+        std::array<GLsync, NUM_SECTIONS> _fences {};
+        size_t _section{ 0 };
+        size_t _sectionOffset{ 0 };
+        size_t _alignment{ 1 };
+        // where the named draw call infos of the current batch are, the ring or _drawCallInfoBuffer
+        GLuint _drawCallInfoBuffer{ 0 };
+
+        size_t align(size_t size) const { return (size + _alignment - 1) / _alignment * _alignment; }
+        // the offset in _buffer of size contiguous bytes, waiting for the gpu if it still reads them.
+        // INVALID_OFFSET if it is larger than a section.
+        size_t allocate(size_t size);
+    };
+    mutable TransformRing _transformRing;
+
+    void initTransformRing();
+    void killTransformRing();
+    void transferTransformStateToBuffers(const Batch& batch) const;
+
     // Resource Stage
     bool bindResourceBuffer(uint32_t slot, const BufferPointer& buffer) override;
     void releaseResourceBuffer(uint32_t slot) override;
@@ -33,7 +33,7 @@ using namespace gpu::gl;
 using namespace gpu::gl45;
 
 #define FORCE_STRICT_TEXTURE 0
-#define ENABLE_SPARSE_TEXTURE 0
+#define ENABLE_SPARSE_TEXTURE 1
 
 bool GL45Backend::supportedTextureFormat(const gpu::Element& format) {
     switch (format.getSemantic()) {
@@ -91,7 +91,7 @@ GLTexture* GL45Backend::syncGPUObject(const TexturePointer& texturePointer) {
                 auto& transferEngine  = _textureManagement._transferEngine;
                 if (transferEngine->allowCreate()) {
 #if ENABLE_SPARSE_TEXTURE
-                    if (isTextureManagementSparseEnabled() && GL45Texture::isSparseEligible(texture)) {
+                    if (isTextureManagementSparseEnabled() && GL45SparseResourceTexture::isSparseEligible(texture)) {
                         object = new GL45SparseResourceTexture(shared_from_this(), texture);
                     } else {
                         object = new GL45ResourceTexture(shared_from_this(), texture);
@@ -131,8 +131,12 @@ GLTexture* GL45Backend::syncGPUObject(const TexturePointer& texturePointer) {
 
 void GL45Backend::initTextureManagementStage() {
     GLBackend::initTextureManagementStage();
-    // enable the Sparse Texture on gl45
-    _textureManagement._sparseCapable = true;
+    // enable the Sparse Texture on gl45, the mips get committed with the DSA entry point
+    _textureManagement._sparseCapable = GLAD_GL_ARB_sparse_texture && (glTexturePageCommitmentEXT != nullptr);
+    if (!_textureManagement._sparseCapable) {
+        qCDebug(gpugllogging) << "GPU is not sparse capable";
+        return;
+    }
 
     // But now let s refine the behavior based on vendor
     std::string vendor { (const char*)glGetString(GL_VENDOR) };
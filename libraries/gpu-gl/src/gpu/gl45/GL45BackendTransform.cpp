@@ -27,11 +27,144 @@ void GL45Backend::initTransform() {
     while (_transform._cameraUboSize < cameraSize) {
         _transform._cameraUboSize += UNIFORM_BUFFER_OFFSET_ALIGNMENT;
     }
+    initTransformRing();
+}
+
+void GL45Backend::initTransformRing() {
+    // every range of the ring is bound as a uniform, storage or texture buffer, or read as vertices
+    GLint alignment = UNIFORM_BUFFER_OFFSET_ALIGNMENT;
+    GLint storageAlignment = 1;
+    GLint textureAlignment = 1;
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+    glGetIntegerv(GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, &textureAlignment);
+    alignment = std::max(alignment, std::max(storageAlignment, textureAlignment));
+    _transformRing._alignment = (size_t)std::max(alignment, (GLint)sizeof(Batch::TransformObject));
+
+    static const GLbitfield RING_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    size_t ringSize = TransformRing::NUM_SECTIONS * TransformRing::SECTION_SIZE;
+    glCreateBuffers(1, &_transformRing._buffer);
+    glNamedBufferStorage(_transformRing._buffer, ringSize, nullptr, RING_FLAGS);
+    _transformRing._mapped = (uint8_t*)glMapNamedBufferRange(_transformRing._buffer, 0, ringSize, RING_FLAGS);
+    if (!_transformRing._mapped) {
+        qCWarning(gpugl45logging) << "GL45Backend::initTransformRing - unable to map the transform ring, transforms go through the driver";
+        glDeleteBuffers(1, &_transformRing._buffer);
+        _transformRing._buffer = 0;
+    }
+    CHECK_GL_ERROR();
+}
+
+void GL45Backend::killTransformRing() {
+    for (auto& fence : _transformRing._fences) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = 0;
+        }
+    }
+    if (_transformRing._buffer) {
+        glUnmapNamedBuffer(_transformRing._buffer);
+        glDeleteBuffers(1, &_transformRing._buffer);
+        _transformRing._buffer = 0;
+        _transformRing._mapped = nullptr;
+    }
+}
+
+size_t GL45Backend::TransformRing::allocate(size_t size) {
+    if (!_mapped || size > SECTION_SIZE) {
+        return INVALID_OFFSET;
+    }
+
+    if (_sectionOffset + size > SECTION_SIZE) {
+        // everything issued so far is done with the current section once the gpu gets to this fence
+        _fences[_section] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        _section = (_section + 1) % NUM_SECTIONS;
+        _sectionOffset = 0;
+
+        auto& fence = _fences[_section];
+        if (fence) {
+            PROFILE_RANGE(render_gpu_gl_detail, "waitTransformRing");
+            static const GLuint64 WAIT_TIMEOUT_NS = 1000000;
+            GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            while (true) {
+                GLenum result = glClientWaitSync(fence, waitFlags, WAIT_TIMEOUT_NS);
+                if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED) {
+                    break;
+                }
+                waitFlags = 0;
+            }
+            glDeleteSync(fence);
+            fence = 0;
+        }
+    }
+
+    size_t offset = _section * SECTION_SIZE + _sectionOffset;
+    _sectionOffset += align(size);
+    return offset;
 }
 
 void GL45Backend::transferTransformState(const Batch& batch) const {
+    size_t camerasSize = _transform._cameraUboSize * _transform._cameras.size();
+    size_t objectsSize = batch._objects.size() * sizeof(Batch::TransformObject);
+    size_t drawCallInfosSize = 0;
+    for (auto& data : batch._namedData) {
+        drawCallInfosSize += data.second.drawCallInfos.size() * sizeof(Batch::DrawCallInfo);
+    }
+
+    size_t ringSize = _transformRing.align(camerasSize) + _transformRing.align(objectsSize) + drawCallInfosSize;
+    size_t ringOffset = INVALID_OFFSET;
+    if (ringSize > 0) {
+        ringOffset = _transformRing.allocate(ringSize);
+    }
+    if (ringOffset == INVALID_OFFSET) {
+        transferTransformStateToBuffers(batch);
+        return;
+    }
+
+    uint8_t* mapped = _transformRing._mapped;
+    _transform._currentCameraBuffer = 0;
+    _transform._currentCameraBufferOffset = 0;
+    if (camerasSize > 0) {
+        for (size_t i = 0; i < _transform._cameras.size(); ++i) {
+            memcpy(mapped + ringOffset + (_transform._cameraUboSize * i), &_transform._cameras[i], sizeof(TransformStageState::CameraBufferElement));
+        }
+        _transform._currentCameraBuffer = _transformRing._buffer;
+        _transform._currentCameraBufferOffset = ringOffset;
+        ringOffset += _transformRing.align(camerasSize);
+    }
+
+    if (objectsSize > 0) {
+        memcpy(mapped + ringOffset, batch._objects.data(), objectsSize);
+#ifdef GPU_SSBO_TRANSFORM_OBJECT
+        glBindBufferRange(GL_SHADER_STORAGE_BUFFER, slot::storage::ObjectTransforms, _transformRing._buffer, ringOffset, objectsSize);
+#else
+        glActiveTexture(GL_TEXTURE0 + slot::texture::ObjectTransforms);
+        glBindTexture(GL_TEXTURE_BUFFER, _transform._objectBufferTexture);
+        glTextureBufferRange(_transform._objectBufferTexture, GL_RGBA32F, _transformRing._buffer, ringOffset, objectsSize);
+#endif
+        ringOffset += _transformRing.align(objectsSize);
+    }
+
+    if (drawCallInfosSize > 0) {
+        for (auto& data : batch._namedData) {
+            auto bytesToCopy = data.second.drawCallInfos.size() * sizeof(Batch::DrawCallInfo);
+            memcpy(mapped + ringOffset, data.second.drawCallInfos.data(), bytesToCopy);
+            _transform._drawCallInfoOffsets[data.first] = (GLvoid*)ringOffset;
+            ringOffset += bytesToCopy;
+        }
+        _transformRing._drawCallInfoBuffer = _transformRing._buffer;
+    }
+
+    CHECK_GL_ERROR();
+
+    // Make sure the current Camera offset is unknown before render Draw
+    _transform._currentCameraOffset = INVALID_OFFSET;
+}
+
+// the batches too large for a section of the ring
+void GL45Backend::transferTransformStateToBuffers(const Batch& batch) const {
     // FIXME not thread safe
     static std::vector<uint8_t> bufferData;
+    _transform._currentCameraBuffer = 0;
+    _transform._currentCameraBufferOffset = 0;
     if (!_transform._cameras.empty()) {
         bufferData.resize(_transform._cameraUboSize * _transform._cameras.size());
         for (size_t i = 0; i < _transform._cameras.size(); ++i) {
@@ -54,6 +187,7 @@ void GL45Backend::transferTransformState(const Batch& batch) const {
             _transform._drawCallInfoOffsets[data.first] = (GLvoid*)currentSize;
         }
         glNamedBufferData(_transform._drawCallInfoBuffer, bufferData.size(), bufferData.data(), GL_STREAM_DRAW);
+        _transformRing._drawCallInfoBuffer = _transform._drawCallInfoBuffer;
     }
 
 #ifdef GPU_SSBO_TRANSFORM_OBJECT
@@ -97,7 +231,7 @@ void GL45Backend::updateTransform(const Batch& batch) {
         // NOTE: A stride of zero in BindVertexBuffer signifies that all elements are sourced from the same location,
         //       so we must provide a stride.
         //       This is in contrast to VertexAttrib*Pointer, where a zero signifies tightly-packed elements.
-        glBindVertexBuffer(gpu::Stream::DRAW_CALL_INFO, _transform._drawCallInfoBuffer, (GLintptr)_transform._drawCallInfoOffsets[batch._currentNamedCall], 2 * sizeof(GLushort));
+        glBindVertexBuffer(gpu::Stream::DRAW_CALL_INFO, _transformRing._drawCallInfoBuffer, (GLintptr)_transform._drawCallInfoOffsets[batch._currentNamedCall], 2 * sizeof(GLushort));
     }
 
     (void)CHECK_GL_ERROR();
@@ -236,7 +236,7 @@ size_t GL45ResourceTexture::demote() {
     return (oldSize - _size);
 }
 
-void GL45ResourceTexture::populateTransferQueue(TransferQueue& pendingTransfers) {
+void GL45VariableAllocationTexture::populateTransferQueue(TransferQueue& pendingTransfers) {
     PROFILE_RANGE(render_gpu_gl, __FUNCTION__);
     sanityCheck();
 
@@ -248,7 +248,7 @@ void GL45ResourceTexture::populateTransferQueue(TransferQueue& pendingTransfers)
     uint16_t sourceMip = _populatedMip;
     do {
         --sourceMip;
-        auto targetMip = sourceMip - _allocatedMip;
+        auto targetMip = sourceMip - getStorageMipOffset();
         auto mipDimensions = _gpuObject.evalMipDimensions(sourceMip);
         for (uint8_t face = 0; face < maxFace; ++face) {
             if (!_gpuObject.isStoredMipFaceAvailable(sourceMip, face)) {
@@ -291,15 +291,12 @@ void GL45ResourceTexture::populateTransferQueue(TransferQueue& pendingTransfers)
 }
 
 // Sparsely allocated, managed size resource textures
-#if 0
-#define SPARSE_PAGE_SIZE_OVERHEAD_ESTIMATE 1.3f
-
 using GL45SparseResourceTexture = GL45Backend::GL45SparseResourceTexture;
 
-GL45Texture::PageDimensionsMap GL45Texture::pageDimensionsByFormat;
-Mutex GL45Texture::pageDimensionsMutex;
+GL45SparseResourceTexture::PageDimensionsMap GL45SparseResourceTexture::pageDimensionsByFormat;
+Mutex GL45SparseResourceTexture::pageDimensionsMutex;
 
-GL45Texture::PageDimensions GL45Texture::getPageDimensionsForFormat(const TextureTypeFormat& typeFormat) {
+GL45SparseResourceTexture::PageDimensions GL45SparseResourceTexture::getPageDimensionsForFormat(const TextureTypeFormat& typeFormat) {
     {
         Lock lock(pageDimensionsMutex);
         if (pageDimensionsByFormat.count(typeFormat)) {
@@ -314,11 +311,11 @@ GL45Texture::PageDimensions GL45Texture::getPageDimensionsForFormat(const Textur
     if (count > 0) {
         std::vector<GLint> x, y, z;
         x.resize(count);
-        glGetInternalformativ(typeFormat.first, typeFormat.second, GL_VIRTUAL_PAGE_SIZE_X_ARB, 1, &x[0]);
+        glGetInternalformativ(typeFormat.first, typeFormat.second, GL_VIRTUAL_PAGE_SIZE_X_ARB, count, &x[0]);
         y.resize(count);
-        glGetInternalformativ(typeFormat.first, typeFormat.second, GL_VIRTUAL_PAGE_SIZE_Y_ARB, 1, &y[0]);
+        glGetInternalformativ(typeFormat.first, typeFormat.second, GL_VIRTUAL_PAGE_SIZE_Y_ARB, count, &y[0]);
         z.resize(count);
-        glGetInternalformativ(typeFormat.first, typeFormat.second, GL_VIRTUAL_PAGE_SIZE_Z_ARB, 1, &z[0]);
+        glGetInternalformativ(typeFormat.first, typeFormat.second, GL_VIRTUAL_PAGE_SIZE_Z_ARB, count, &z[0]);
 
         result.resize(count);
         for (GLint i = 0; i < count; ++i) {
@@ -336,17 +333,20 @@ GL45Texture::PageDimensions GL45Texture::getPageDimensionsForFormat(const Textur
     return result;
 }
 
-GL45Texture::PageDimensions GL45Texture::getPageDimensionsForFormat(GLenum target, GLenum format) {
+GL45SparseResourceTexture::PageDimensions GL45SparseResourceTexture::getPageDimensionsForFormat(GLenum target, GLenum format) {
     return getPageDimensionsForFormat({ target, format });
 }
-bool GL45Texture::isSparseEligible(const Texture& texture) {
+
+bool GL45SparseResourceTexture::isSparseEligible(const Texture& texture) {
     Q_ASSERT(TextureUsageType::RESOURCE == texture.getUsageType());
 
-    // Disabling sparse for the momemnt
-    return false;
+    if (texture.isArray() || (texture.getType() != Texture::TEX_2D && texture.getType() != Texture::TEX_CUBE)) {
+        return false;
+    }
 
-    const auto allowedPageDimensions = getPageDimensionsForFormat(getGLTextureType(texture), 
-        gl::GLTexelFormat::evalGLTexelFormatInternal(texture.getTexelFormat()));
+    // In order to enable sparse the texture size must be an integer multiple of the page size
+    const auto allowedPageDimensions = getPageDimensionsForFormat(getGLTextureType(texture),
+        GLTexelFormat::evalGLTexelFormat(texture.getTexelFormat()).internalFormat);
     const auto textureDimensions = texture.getDimensions();
     for (const auto& pageDimensions : allowedPageDimensions) {
         if (uvec3(0) == (textureDimensions % pageDimensions)) {
@@ -357,361 +357,125 @@ bool GL45Texture::isSparseEligible(const Texture& texture) {
     return false;
 }
 
-
 GL45SparseResourceTexture::GL45SparseResourceTexture(const std::weak_ptr<GLBackend>& backend, const Texture& texture) : GL45VariableAllocationTexture(backend, texture) {
     const GLTexelFormat texelFormat = GLTexelFormat::evalGLTexelFormat(_gpuObject.getTexelFormat());
     const uvec3 dimensions = _gpuObject.getDimensions();
     auto allowedPageDimensions = getPageDimensionsForFormat(_target, texelFormat.internalFormat);
-    uint32_t pageDimensionsIndex = 0;
-    // In order to enable sparse the texture size must be an integer multiple of the page size
+    GLint pageDimensionsIndex = 0;
     for (size_t i = 0; i < allowedPageDimensions.size(); ++i) {
-        pageDimensionsIndex = (uint32_t)i;
-        _pageDimensions = allowedPageDimensions[i];
-        // Is this texture an integer multiple of page dimensions?
-        if (uvec3(0) == (dimensions % _pageDimensions)) {
-            qCDebug(gpugl45logging) << "Enabling sparse for texture " << _gpuObject.source().c_str();
+        if (uvec3(0) == (dimensions % allowedPageDimensions[i])) {
+            pageDimensionsIndex = (GLint)i;
             break;
         }
     }
+    _pageDimensions = allowedPageDimensions[pageDimensionsIndex];
+
+    // The storage of the whole mip chain is allocated once, virtually, only the committed pages use memory
+    auto mipLevels = texture.getNumMips();
     glTextureParameteri(_id, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
     glTextureParameteri(_id, GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, pageDimensionsIndex);
-    glGetTextureParameterIuiv(_id, GL_NUM_SPARSE_LEVELS_ARB, &_maxSparseLevel);
-
-    _pageBytes = _gpuObject.getTexelFormat().getSize();
-    _pageBytes *= _pageDimensions.x * _pageDimensions.y * _pageDimensions.z;
-    // Testing with a simple texture allocating app shows an estimated 20% GPU memory overhead for 
-    // sparse textures as compared to non-sparse, so we acount for that here.
-    _pageBytes = (uint32_t)(_pageBytes * SPARSE_PAGE_SIZE_OVERHEAD_ESTIMATE);
-
-    //allocateStorage();
-    syncSampler();
-}
-
-GL45SparseResourceTexture::~GL45SparseResourceTexture() {
-    Backend::updateTextureGPUVirtualMemoryUsage(size(), 0);
-}
-
-uvec3 GL45SparseResourceTexture::getPageCounts(const uvec3& dimensions) const {
-    auto result = (dimensions / _pageDimensions) +
-        glm::clamp(dimensions % _pageDimensions, glm::uvec3(0), glm::uvec3(1));
-    return result;
-}
-
-uint32_t GL45SparseResourceTexture::getPageCount(const uvec3& dimensions) const {
-    auto pageCounts = getPageCounts(dimensions);
-    return pageCounts.x * pageCounts.y * pageCounts.z;
-}
-
-void GL45SparseResourceTexture::promote() {
-}
-
-void GL45SparseResourceTexture::demote() {
-}
-
-SparseInfo::SparseInfo(GL45Texture& texture)
-    : texture(texture) {
-}
+    glTextureStorage2D(_id, mipLevels, texelFormat.internalFormat, dimensions.x, dimensions.y);
+    GLint numSparseLevels = 0;
+    glGetTextureParameteriv(_id, GL_NUM_SPARSE_LEVELS_ARB, &numSparseLevels);
+    _numSparseLevels = (uint16_t)std::min<GLint>(numSparseLevels, mipLevels);
+    _pageBytes = _gpuObject.evalMipFaceSize(0) / getPageCount(dimensions);
 
-void SparseInfo::maybeMakeSparse() {
-    // Don't enable sparse for objects with explicitly managed mip levels
-    if (!texture._gpuObject.isAutogenerateMips()) {
-        return;
-    }
+    _allocatedMip = mipLevels;
+    _maxAllocatedMip = _populatedMip = mipLevels;
+    _minAllocatedMip = texture.minAvailableMipLevel();
 
-    const uvec3 dimensions = texture._gpuObject.getDimensions();
-    auto allowedPageDimensions = getPageDimensionsForFormat(texture._target, texture._internalFormat);
-    // In order to enable sparse the texture size must be an integer multiple of the page size
-    for (size_t i = 0; i < allowedPageDimensions.size(); ++i) {
-        pageDimensionsIndex = (uint32_t)i;
-        pageDimensions = allowedPageDimensions[i];
-        // Is this texture an integer multiple of page dimensions?
-        if (uvec3(0) == (dimensions % pageDimensions)) {
-            qCDebug(gpugl45logging) << "Enabling sparse for texture " << texture._source.c_str();
-            sparse = true;
+    for (uint16_t mip = _minAllocatedMip; mip < mipLevels; ++mip) {
+        if (glm::all(glm::lessThanEqual(texture.evalMipDimensions(mip), INITIAL_MIP_TRANSFER_DIMENSIONS))) {
+            _maxAllocatedMip = _populatedMip = mip;
             break;
         }
     }
-
-    if (sparse) {
-        glTextureParameteri(texture._id, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
-        glTextureParameteri(texture._id, GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, pageDimensionsIndex);
-    } else {
-        qCDebug(gpugl45logging) << "Size " << dimensions.x << " x " << dimensions.y <<
-            " is not supported by any sparse page size for texture" << texture._source.c_str();
-    }
-}
-
-
-// This can only be called after we've established our storage size
-void SparseInfo::update() {
-    if (!sparse) {
-        return;
-    }
-    glGetTextureParameterIuiv(texture._id, GL_NUM_SPARSE_LEVELS_ARB, &maxSparseLevel);
-
-    for (uint16_t mipLevel = 0; mipLevel <= maxSparseLevel; ++mipLevel) {
-        auto mipDimensions = texture._gpuObject.evalMipDimensions(mipLevel);
-        auto mipPageCount = getPageCount(mipDimensions);
-        maxPages += mipPageCount;
-    }
-    if (texture._target == GL_TEXTURE_CUBE_MAP) {
-        maxPages *= GLTexture::CUBE_NUM_FACES;
-    }
-}
-
-
-void SparseInfo::allocateToMip(uint16_t targetMip) {
-    // Not sparse, do nothing
-    if (!sparse) {
-        return;
-    }
-
-    if (allocatedMip == INVALID_MIP) {
-        allocatedMip = maxSparseLevel + 1;
-    }
-
-    // Don't try to allocate below the maximum sparse level
-    if (targetMip > maxSparseLevel) {
-        targetMip = maxSparseLevel;
-    }
-
-    // Already allocated this level
-    if (allocatedMip <= targetMip) {
-        return;
-    }
-
-    uint32_t maxFace = (uint32_t)(GL_TEXTURE_CUBE_MAP == texture._target ? CUBE_NUM_FACES : 1);
-    for (uint16_t mip = targetMip; mip < allocatedMip; ++mip) {
-        auto size = texture._gpuObject.evalMipDimensions(mip);
-        glTexturePageCommitmentEXT(texture._id, mip, 0, 0, 0, size.x, size.y, maxFace, GL_TRUE);
-        allocatedPages += getPageCount(size);
-    }
-    allocatedMip = targetMip;
-}
-
-uint32_t SparseInfo::getSize() const {
-    return allocatedPages * pageBytes;
-}
-using SparseInfo = GL45Backend::GL45Texture::SparseInfo;
-
-void GL45Texture::updateSize() const {
-    if (_gpuObject.getTexelFormat().isCompressed()) {
-        qFatal("Compressed textures not yet supported");
-    }
-
-    if (_transferrable && _sparseInfo.sparse) {
-        auto size = _sparseInfo.getSize();
-        Backend::updateTextureGPUSparseMemoryUsage(_size, size);
-        setSize(size);
-    } else {
-        setSize(_gpuObject.evalTotalSize(_mipOffset));
-    }
-}
-
-void GL45Texture::startTransfer() {
-    Parent::startTransfer();
-    _sparseInfo.update();
-    _populatedMip = _maxMip + 1;
-}
-
-bool GL45Texture::continueTransfer() {
-    size_t maxFace = GL_TEXTURE_CUBE_MAP == _target ? CUBE_NUM_FACES : 1;
-    if (_populatedMip == _minMip) {
-        return false;
+    // The mips of the tail share their pages, they stay committed as long as the texture lives
+    _maxAllocatedMip = std::min(_maxAllocatedMip, _numSparseLevels);
+    if (_numSparseLevels < mipLevels) {
+        commitMips(_numSparseLevels, _numSparseLevels + 1, true);
     }
 
-    uint16_t targetMip = _populatedMip - 1;
-    while (targetMip > 0 && !_gpuObject.isStoredMipFaceAvailable(targetMip)) {
-        --targetMip;
-    }
+    auto targetMip = _populatedMip - std::min<uint16_t>(_populatedMip, 2);
+    uint16_t allocatedMip = std::max<uint16_t>(_minAllocatedMip, targetMip);
+    _allocatedMip = std::min(allocatedMip, _maxAllocatedMip);
+    commitMips(_allocatedMip, _numSparseLevels, true);
 
-    _sparseInfo.allocateToMip(targetMip);
-    for (uint8_t face = 0; face < maxFace; ++face) {
-        auto size = _gpuObject.evalMipDimensions(targetMip);
-        if (_gpuObject.isStoredMipFaceAvailable(targetMip, face)) {
-            auto mip = _gpuObject.accessStoredMipFace(targetMip, face);
-            GLTexelFormat texelFormat = GLTexelFormat::evalGLTexelFormat(_gpuObject.getTexelFormat(), mip->getFormat());
-            if (GL_TEXTURE_2D == _target) {
-                glTextureSubImage2D(_id, targetMip, 0, 0, size.x, size.y, texelFormat.format, texelFormat.type, mip->readData());
-            } else if (GL_TEXTURE_CUBE_MAP == _target) {
-                // DSA ARB does not work on AMD, so use EXT
-                // unless EXT is not available on the driver
-                if (glTextureSubImage2DEXT) {
-                    auto target = CUBE_FACE_LAYOUT[face];
-                    glTextureSubImage2DEXT(_id, target, targetMip, 0, 0, size.x, size.y, texelFormat.format, texelFormat.type, mip->readData());
-                } else {
-                    glTextureSubImage3D(_id, targetMip, 0, 0, face, size.x, size.y, 1, texelFormat.format, texelFormat.type, mip->readData());
-                }
-            } else {
-                Q_ASSERT(false);
-            }
-            (void)CHECK_GL_ERROR();
-            break;
+    Size amount = 0;
+    size_t maxFace = GLTexture::getFaceCount(_target);
+    for (uint16_t sourceMip = _populatedMip; sourceMip < mipLevels; ++sourceMip) {
+        for (uint8_t face = 0; face < maxFace; ++face) {
+            amount += copyMipFaceFromTexture(sourceMip, sourceMip, face);
         }
     }
-    _populatedMip = targetMip;
-    return _populatedMip != _minMip;
+    incrementPopulatedSize(amount);
+    syncSampler();
 }
 
-void GL45Texture::finishTransfer() {
-    Parent::finishTransfer();
+GL45SparseResourceTexture::~GL45SparseResourceTexture() {
+    // Deleting the texture decommits its pages
+    Backend::textureResourceCommittedPageCount.update(_committedPages, 0);
 }
 
-void GL45Texture::postTransfer() {
-    Parent::postTransfer();
+uint32_t GL45SparseResourceTexture::getPageCount(const uvec3& dimensions) const {
+    auto pageCounts = (dimensions + _pageDimensions - uvec3(1)) / _pageDimensions;
+    return pageCounts.x * pageCounts.y * pageCounts.z;
 }
 
-void GL45Texture::stripToMip(uint16_t newMinMip) {
-    if (newMinMip < _minMip) {
-        qCWarning(gpugl45logging) << "Cannot decrease the min mip";
-        return;
-    }
-
-    if (_sparseInfo.sparse && newMinMip > _sparseInfo.maxSparseLevel) {
-        qCWarning(gpugl45logging) << "Cannot increase the min mip into the mip tail";
-        return;
-    }
-
-    // If we weren't generating mips before, we need to now that we're stripping down mip levels.
-    if (!_gpuObject.isAutogenerateMips()) {
-        qCDebug(gpugl45logging) << "Force mip generation for texture";
-        glGenerateTextureMipmap(_id);
-    }
-
-
-    uint8_t maxFace = (uint8_t)((_target == GL_TEXTURE_CUBE_MAP) ? GLTexture::CUBE_NUM_FACES : 1);
-    if (_sparseInfo.sparse) {
-        for (uint16_t mip = _minMip; mip < newMinMip; ++mip) {
-            auto id = _id;
-            auto mipDimensions = _gpuObject.evalMipDimensions(mip);
-            glTexturePageCommitmentEXT(id, mip, 0, 0, 0, mipDimensions.x, mipDimensions.y, maxFace, GL_FALSE);
-            auto deallocatedPages = _sparseInfo.getPageCount(mipDimensions) * maxFace;
-            assert(deallocatedPages < _sparseInfo.allocatedPages);
-            _sparseInfo.allocatedPages -= deallocatedPages;
-        }
-        _minMip = newMinMip;
-    } else {
-        GLuint oldId = _id;
-        // Find the distance between the old min mip and the new one
-        uint16 mipDelta = newMinMip - _minMip;
-        _mipOffset += mipDelta;
-        const_cast<uint16&>(_maxMip) -= mipDelta;
-        auto newLevels = usedMipLevels();
-
-        // Create and setup the new texture (allocate)
-        glCreateTextures(_target, 1, &const_cast<GLuint&>(_id));
-        glTextureParameteri(_id, GL_TEXTURE_BASE_LEVEL, 0);
-        glTextureParameteri(_id, GL_TEXTURE_MAX_LEVEL, _maxMip - _minMip);
-        Vec3u newDimensions = _gpuObject.evalMipDimensions(_mipOffset);
-        glTextureStorage2D(_id, newLevels, _internalFormat, newDimensions.x, newDimensions.y);
-
-        // Copy the contents of the old texture to the new
-        GLuint fbo { 0 };
-        glCreateFramebuffers(1, &fbo);
-        glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
-        for (uint16 targetMip = _minMip; targetMip <= _maxMip; ++targetMip) {
-            uint16 sourceMip = targetMip + mipDelta;
-            Vec3u mipDimensions = _gpuObject.evalMipDimensions(targetMip + _mipOffset);
-            for (GLenum target : getFaceTargets(_target)) {
-                glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, target, oldId, sourceMip);
-                (void)CHECK_GL_ERROR();
-                glCopyTextureSubImage2D(_id, targetMip, 0, 0, 0, 0, mipDimensions.x, mipDimensions.y);
-                (void)CHECK_GL_ERROR();
-            }
+void GL45SparseResourceTexture::commitMips(uint16_t beginMip, uint16_t endMip, bool commit) {
+    auto oldCommittedPages = _committedPages;
+    auto oldSize = _size;
+    const uint8_t maxFace = GLTexture::getFaceCount(_target);
+    for (uint16_t mip = beginMip; mip < endMip; ++mip) {
+        auto mipDimensions = _gpuObject.evalMipDimensions(mip);
+        glTexturePageCommitmentEXT(_id, mip, 0, 0, 0, mipDimensions.x, mipDimensions.y, maxFace, commit ? GL_TRUE : GL_FALSE);
+        auto pages = getPageCount(mipDimensions) * maxFace;
+        if (commit) {
+            _committedPages += pages;
+        } else {
+            Q_ASSERT(pages <= _committedPages);
+            _committedPages -= pages;
         }
-        glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
-        glDeleteFramebuffers(1, &fbo);
-        glDeleteTextures(1, &oldId);
-    }
-
-    // Re-sync the sampler to force access to the new mip level
-    syncSampler();
-    updateSize();
-}
-
-bool GL45Texture::derezable() const {
-    if (_external) {
-        return false;
     }
-    auto maxMinMip = _sparseInfo.sparse ? _sparseInfo.maxSparseLevel : _maxMip;
-    return _transferrable && (_targetMinMip < maxMinMip);
+    (void)CHECK_GL_ERROR();
+    _size = _committedPages * _pageBytes;
+    Backend::textureResourceCommittedPageCount.update(oldCommittedPages, _committedPages);
+    Backend::textureResourceGPUMemSize.update(oldSize, _size);
 }
 
-size_t GL45Texture::getMipByteCount(uint16_t mip) const {
-    if (!_sparseInfo.sparse) {
-        return Parent::getMipByteCount(mip);
-    }
-
-    auto dimensions = _gpuObject.evalMipDimensions(_targetMinMip);
-    return _sparseInfo.getPageCount(dimensions) * _sparseInfo.pageBytes;
-}
-
-std::pair<size_t, bool> GL45Texture::preDerez() {
-    assert(!_sparseInfo.sparse || _targetMinMip < _sparseInfo.maxSparseLevel);
-    size_t freedMemory = getMipByteCount(_targetMinMip);
-    bool liveMip = _populatedMip != INVALID_MIP && _populatedMip <= _targetMinMip;
-    ++_targetMinMip;
-    return { freedMemory, liveMip };
+void GL45SparseResourceTexture::syncSampler() const {
+    Parent::syncSampler();
+    glTextureParameteri(_id, GL_TEXTURE_BASE_LEVEL, _populatedMip);
 }
 
-void GL45Texture::derez() {
-    if (_sparseInfo.sparse) {
-        assert(_minMip < _sparseInfo.maxSparseLevel);
-    }
-    assert(_minMip < _maxMip);
-    assert(_transferrable);
-    stripToMip(_minMip + 1);
-}
+size_t GL45SparseResourceTexture::promote() {
+    PROFILE_RANGE(render_gpu_gl, __FUNCTION__);
+    Q_ASSERT(_allocatedMip > 0);
 
-size_t GL45Texture::getCurrentGpuSize() const {
-    if (!_sparseInfo.sparse) {
-        return Parent::getCurrentGpuSize();
-    }
+    uint16_t targetAllocatedMip = _allocatedMip - std::min<uint16_t>(_allocatedMip, 2);
+    targetAllocatedMip = std::max<uint16_t>(_minAllocatedMip, targetAllocatedMip);
 
-    return _sparseInfo.getSize();
+    // The mips already there stay where they are, only the pages of the new ones get committed
+    auto oldSize = _size;
+    commitMips(targetAllocatedMip, _allocatedMip, true);
+    _allocatedMip = targetAllocatedMip;
+    return (_size - oldSize);
 }
 
-size_t GL45Texture::getTargetGpuSize() const {
-    if (!_sparseInfo.sparse) {
-        return Parent::getTargetGpuSize();
-    }
-
-    size_t result = 0;
-    for (auto mip = _targetMinMip; mip <= _sparseInfo.maxSparseLevel; ++mip) {
-        result += (_sparseInfo.pageBytes * _sparseInfo.getPageCount(_gpuObject.evalMipDimensions(mip)));
-    }
-
-    return result;
-}
+size_t GL45SparseResourceTexture::demote() {
+    PROFILE_RANGE(render_gpu_gl, __FUNCTION__);
+    Q_ASSERT(_allocatedMip < _maxAllocatedMip);
+    auto oldSize = _size;
+    auto oldPopulatedMip = _populatedMip;
 
-GL45Texture::~GL45Texture() {
-    if (_sparseInfo.sparse) {
-        uint8_t maxFace = (uint8_t)((_target == GL_TEXTURE_CUBE_MAP) ? GLTexture::CUBE_NUM_FACES : 1);
-        auto maxSparseMip = std::min<uint16_t>(_maxMip, _sparseInfo.maxSparseLevel);
-        for (uint16_t mipLevel = _minMip; mipLevel <= maxSparseMip; ++mipLevel) {
-            auto mipDimensions = _gpuObject.evalMipDimensions(mipLevel);
-            glTexturePageCommitmentEXT(_texture, mipLevel, 0, 0, 0, mipDimensions.x, mipDimensions.y, maxFace, GL_FALSE);
-            auto deallocatedPages = _sparseInfo.getPageCount(mipDimensions) * maxFace;
-            assert(deallocatedPages <= _sparseInfo.allocatedPages);
-            _sparseInfo.allocatedPages -= deallocatedPages;
-        }
+    // Stop sampling the mip before its pages go away
+    _allocatedMip++;
+    _populatedMip = std::max(_populatedMip, _allocatedMip);
+    syncSampler();
+    commitMips(_allocatedMip - 1, _allocatedMip, false);
 
-        if (0 != _sparseInfo.allocatedPages) {
-            qCWarning(gpugl45logging) << "Allocated pages remaining " << _id << " " << _sparseInfo.allocatedPages;
-        }
-        Backend::decrementTextureGPUSparseCount();
-    }
-}
-GL45Texture::GL45Texture(const std::weak_ptr<GLBackend>& backend, const Texture& texture)
-    : GLTexture(backend, texture, allocate(texture)), _sparseInfo(*this), _targetMinMip(_minMip)
-{
-
-    auto theBackend = _backend.lock();
-    if (_transferrable && theBackend && theBackend->isTextureManagementSparseEnabled()) {
-        _sparseInfo.maybeMakeSparse();
-        if (_sparseInfo.sparse) {
-            Backend::incrementTextureGPUSparseCount();
-        }
+    if (oldPopulatedMip != _populatedMip) {
+        decrementPopulatedSize(_gpuObject.evalMipSize(oldPopulatedMip));
     }
+    return (oldSize - _size);
 }
-#endif
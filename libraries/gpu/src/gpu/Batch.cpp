@@ -90,6 +90,7 @@ void Batch::clear() {
     _pipelines.clear();
     _profileRanges.clear();
     _queries.clear();
+    _readPixelsHandlers.clear();
     _swapChains.clear();
     _streamFormats.clear();
     _textures.clear();
@@ -434,6 +435,17 @@ void Batch::generateTextureMipsWithPipeline(const TexturePointer& texture, int n
     _params.emplace_back(numMips);
 }
 
+void Batch::readPixels(const FramebufferPointer& framebuffer, const Vec4i& rect, const ReadPixelsHandler& handler) {
+    ADD_COMMAND(readPixels);
+
+    _params.emplace_back(_framebuffers.cache(framebuffer));
+    _params.emplace_back(rect.x);
+    _params.emplace_back(rect.y);
+    _params.emplace_back(rect.z);
+    _params.emplace_back(rect.w);
+    _params.emplace_back(_readPixelsHandlers.cache(handler));
+}
+
 void Batch::beginQuery(const QueryPointer& query) {
     ADD_COMMAND(beginQuery);
 
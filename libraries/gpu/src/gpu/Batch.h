@@ -229,6 +229,12 @@ public:
     // Generate the mips for a texture using the current pipeline
     void generateTextureMipsWithPipeline(const TexturePointer& destTexture, int numMips = -1);
 
+    // Read the red channel of a rect region of the first color buffer of a framebuffer back as floats, row by row
+    // from the bottom. The read doesn't wait for the gpu, the handler is called on the gpu thread once the pixels
+    // have arrived, usually a frame or two later.
+    using ReadPixelsHandler = std::function<void(const std::vector<float>& pixels)>;
+    void readPixels(const FramebufferPointer& framebuffer, const Vec4i& rect, const ReadPixelsHandler& handler);
+
     // Query Section
     void beginQuery(const QueryPointer& query);
     void endQuery(const QueryPointer& query);
@@ -329,6 +335,7 @@ public:
         COMMAND_blit,
         COMMAND_generateTextureMips,
         COMMAND_generateTextureMipsWithPipeline,
+        COMMAND_readPixels,
 
         COMMAND_advance,
 
@@ -463,6 +470,7 @@ public:
     typedef Cache<QueryPointer>::Vector QueryCaches;
     typedef Cache<std::string>::Vector StringCaches;
     typedef Cache<std::function<void()>>::Vector LambdaCache;
+    typedef Cache<ReadPixelsHandler>::Vector ReadPixelsHandlerCache;
 
     // Cache Data in a byte array if too big to fit in Param
     // FOr example Mat4s are going there
@@ -518,6 +526,7 @@ public:
     SwapChainCaches _swapChains;
     QueryCaches _queries;
     LambdaCache _lambdas;
+    ReadPixelsHandlerCache _readPixelsHandlers;
     StringCaches _profileRanges;
     StringCaches _names;
 
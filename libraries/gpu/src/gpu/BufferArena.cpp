@@ -0,0 +1,120 @@
+//
+//  BufferArena.cpp
+//  libraries/gpu/src/gpu
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BufferArena.h"
+
+#include <algorithm>
+#include <iterator>
+
+using namespace gpu;
+
+// the data larger than this part of a block gets a buffer of its own
+static const Size MAX_ALLOCATION_FRACTION = 4;
+
+static Size alignSize(Size size) {
+    return (size + BufferArena::ALIGNMENT - 1) & ~(BufferArena::ALIGNMENT - 1);
+}
+
+BufferArena::Allocation::Allocation(BufferArena& arena, const BufferPointer& buffer, Offset offset, Size size) :
+    _arena(arena),
+    _buffer(buffer),
+    _offset(offset),
+    _size(size) {
+}
+
+BufferArena::Allocation::~Allocation() {
+    _arena.free(_buffer.get(), _offset, _size);
+}
+
+BufferArena::BufferArena(Size blockSize) : _blockSize(alignSize(blockSize)) {
+}
+
+BufferArena::AllocationPointer BufferArena::allocate(Size size, const Byte* data) {
+    if (size == 0 || size > _blockSize / MAX_ALLOCATION_FRACTION) {
+        return AllocationPointer();
+    }
+    Size alignedSize = alignSize(size);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    Block* block = nullptr;
+    std::map<Offset, Size>::iterator freeRange;
+    for (auto& candidate : _blocks) {
+        freeRange = std::find_if(candidate.freeRanges.begin(), candidate.freeRanges.end(),
+            [&](const std::pair<const Offset, Size>& range) { return range.second >= alignedSize; });
+        if (freeRange != candidate.freeRanges.end()) {
+            block = &candidate;
+            break;
+        }
+    }
+    if (!block) {
+        _blocks.emplace_back();
+        block = &_blocks.back();
+        block->buffer = std::make_shared<Buffer>();
+        block->buffer->resize(_blockSize);
+        freeRange = block->freeRanges.emplace(0, _blockSize).first;
+    }
+
+    Offset offset = freeRange->first;
+    Size remainingSize = freeRange->second - alignedSize;
+    block->freeRanges.erase(freeRange);
+    if (remainingSize > 0) {
+        block->freeRanges.emplace(offset + alignedSize, remainingSize);
+    }
+    block->allocatedSize += alignedSize;
+    ++_numAllocations;
+
+    if (data) {
+        block->buffer->setSubData(offset, size, data);
+    }
+    return AllocationPointer(new Allocation(*this, block->buffer, offset, alignedSize));
+}
+
+void BufferArena::free(const Buffer* buffer, Offset offset, Size size) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto block = std::find_if(_blocks.begin(), _blocks.end(), [&](const Block& block) { return block.buffer.get() == buffer; });
+    if (block == _blocks.end()) {
+        return;
+    }
+    --_numAllocations;
+    block->allocatedSize -= size;
+
+    // the last block stays, so that a model that reloads doesn't make a new one
+    if (block->allocatedSize == 0 && _blocks.size() > 1) {
+        _blocks.erase(block);
+        return;
+    }
+
+    auto& freeRanges = block->freeRanges;
+    auto next = freeRanges.lower_bound(offset);
+    if (next != freeRanges.end() && offset + size == next->first) {
+        size += next->second;
+        next = freeRanges.erase(next);
+    }
+    if (next != freeRanges.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == offset) {
+            previous->second += size;
+            return;
+        }
+    }
+    freeRanges.emplace_hint(next, offset, size);
+}
+
+BufferArena::Stats BufferArena::getStats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Stats stats;
+    stats.numBlocks = (int)_blocks.size();
+    stats.numAllocations = _numAllocations;
+    stats.blocksSize = _blocks.size() * _blockSize;
+    for (const auto& block : _blocks) {
+        stats.allocatedSize += block.allocatedSize;
+    }
+    return stats;
+}
@@ -0,0 +1,91 @@
+//
+//  BufferArena.h
+//  libraries/gpu/src/gpu
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_gpu_BufferArena_h
+#define hifi_gpu_BufferArena_h
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Buffer.h"
+
+namespace gpu {
+
+// Sub-allocates the data of many small buffers from a few large blocks, so that the vertices and the indices of the
+// meshes of a scene are ranges of a few buffer objects rather than a buffer object each.  A range is freed when its
+// allocation is destroyed, the free ranges next to each other merge back together and a block that has nothing left
+// in it is released.  The ranges are handed out from the first blocks first, so that the last ones empty out as the
+// data that was in them unloads.
+//
+// The blocks are written as they are allocated from, which must happen on the thread that records the frames so that
+// the updates they send to the backend don't miss a write.  Allocations may be freed from any thread, and the arena
+// must outlive them.
+class BufferArena {
+public:
+    static const Size DEFAULT_BLOCK_SIZE = 8 * 1024 * 1024;
+    // the offsets of the ranges, enough for any vertex or index element
+    static const Size ALIGNMENT = 16;
+
+    class Allocation {
+    public:
+        ~Allocation();
+
+        const BufferPointer& getBuffer() const { return _buffer; }
+        Offset getOffset() const { return _offset; }
+        Size getSize() const { return _size; }
+
+    private:
+        friend class BufferArena;
+        Allocation(BufferArena& arena, const BufferPointer& buffer, Offset offset, Size size);
+
+        BufferArena& _arena;
+        const BufferPointer _buffer;
+        const Offset _offset;
+        const Size _size;
+    };
+    using AllocationPointer = std::shared_ptr<Allocation>;
+
+    struct Stats {
+        int numBlocks { 0 };
+        int numAllocations { 0 };
+        Size blocksSize { 0 };
+        Size allocatedSize { 0 };
+    };
+
+    explicit BufferArena(Size blockSize = DEFAULT_BLOCK_SIZE);
+
+    // copies the data to a range of one of the blocks, or returns null for data too large to share a block with much
+    // else, that is better off in a buffer of its own
+    AllocationPointer allocate(Size size, const Byte* data);
+
+    Stats getStats() const;
+
+private:
+    struct Block {
+        BufferPointer buffer;
+        // the sizes of the free ranges by their offset
+        std::map<Offset, Size> freeRanges;
+        Size allocatedSize { 0 };
+    };
+
+    void free(const Buffer* buffer, Offset offset, Size size);
+
+    const Size _blockSize;
+
+    mutable std::mutex _mutex;
+    std::vector<Block> _blocks;
+    int _numAllocations { 0 };
+};
+
+};
+
+#endif
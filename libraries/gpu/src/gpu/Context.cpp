@@ -12,6 +12,7 @@
 #include "Context.h"
 
 #include <shared/GlobalAppProperties.h>
+#include <TBBHelpers.h>
 
 #include "Frame.h"
 #include "GPULogging.h"
@@ -41,6 +42,8 @@ void ContextStats::evalDelta(const ContextStats& begin, const ContextStats& end)
     _DSNumTriangles= subWrap<uint32_t>(end._DSNumTriangles, begin._DSNumTriangles);
 
     _PSNumSetPipelines = subWrap<uint32_t>(end._PSNumSetPipelines, begin._PSNumSetPipelines);
+    _PSNumProgramBinaryHits = subWrap<uint32_t>(end._PSNumProgramBinaryHits, begin._PSNumProgramBinaryHits);
+    _PSNumProgramBinaryMisses = subWrap<uint32_t>(end._PSNumProgramBinaryMisses, begin._PSNumProgramBinaryMisses);
 }
 
 
@@ -285,6 +288,10 @@ ContextMetricSize  Backend::texturePendingGPUTransferMemSize;
 ContextMetricSize  Backend::textureResourcePopulatedGPUMemSize;
 ContextMetricSize  Backend::textureResourceIdealGPUMemSize;
 
+ContextMetricCount Backend::textureResourceCommittedPageCount;
+ContextMetricCount Backend::textureResourceEvictionCount;
+ContextMetricSize  Backend::textureTransferredGPUMemSize;
+
 Size Context::getFreeGPUMemSize() {
     return Backend::freeGPUMemSize.getValue();
 }
@@ -359,6 +366,18 @@ Size Context::getTextureResourceIdealGPUMemSize() {
     return Backend::textureResourceIdealGPUMemSize.getValue();
 }
 
+uint32_t Context::getTextureResourceCommittedPageCount() {
+    return Backend::textureResourceCommittedPageCount.getValue();
+}
+
+uint32_t Context::getTextureResourceEvictionCount() {
+    return Backend::textureResourceEvictionCount.getValue();
+}
+
+Size Context::getTextureTransferredGPUMemSize() {
+    return Backend::textureTransferredGPUMemSize.getValue();
+}
+
 void Context::pushProgramsToSync(const std::vector<uint32_t>& programIDs, std::function<void()> callback, size_t rate) {
     std::vector<gpu::ShaderPointer> programs;
     for (auto programID : programIDs) {
@@ -434,3 +453,22 @@ void gpu::doInBatch(const char* name,
     f(*batch);
     context->appendFrameBatch(batch);
 }
+
+void gpu::doInBatches(const char* name,
+                      const std::shared_ptr<gpu::Context>& context,
+                      size_t count,
+                      const std::function<void(size_t index, Batch& batch)>& f) {
+    std::vector<BatchPointer> batches;
+    batches.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        batches.push_back(Context::acquireBatch(name));
+    }
+
+    tbb::parallel_for((size_t)0, count, [&](size_t index) {
+        f(index, *batches[index]);
+    });
+
+    for (auto& batch : batches) {
+        context->appendFrameBatch(batch);
+    }
+}
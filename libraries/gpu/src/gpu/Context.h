@@ -45,6 +45,8 @@ public:
     uint32_t _DSNumTriangles { 0 };
 
     uint32_t _PSNumSetPipelines { 0 };
+    uint32_t _PSNumProgramBinaryHits { 0 };
+    uint32_t _PSNumProgramBinaryMisses { 0 };
 
     ContextStats() {}
     ContextStats(const ContextStats& stats) = default;
@@ -70,6 +72,9 @@ public:
 
     virtual bool supportedTextureFormat(const gpu::Element& format) = 0;
 
+    // true if multiDrawIndirect() and multiDrawIndexedIndirect() are drawn with the instance offsets of their commands
+    virtual bool supportsMultiDrawIndirect() const { return false; }
+
     // Shared header between C++ and GLSL
 #include "TransformCamera_shared.slh"
 
@@ -118,6 +123,11 @@ public:
     static ContextMetricSize textureResourcePopulatedGPUMemSize;
     static ContextMetricSize textureResourceIdealGPUMemSize;
 
+    // The pages committed to the sparse resource textures, the demotes and the texture bytes uploaded so far
+    static ContextMetricCount textureResourceCommittedPageCount;
+    static ContextMetricCount textureResourceEvictionCount;
+    static ContextMetricSize textureTransferredGPUMemSize;
+
     virtual bool isStereo() const {
         return _stereo.isStereo();
     }
@@ -256,6 +266,10 @@ public:
     static Size getTextureResourcePopulatedGPUMemSize();
     static Size getTextureResourceIdealGPUMemSize();
 
+    static uint32_t getTextureResourceCommittedPageCount();
+    static uint32_t getTextureResourceEvictionCount();
+    static Size getTextureTransferredGPUMemSize();
+
     struct ProgramsToSync {
         ProgramsToSync(const std::vector<gpu::ShaderPointer>& programs, std::function<void()> callback, size_t rate) :
             programs(programs), callback(callback), rate(rate) {}
@@ -302,6 +316,12 @@ typedef std::shared_ptr<Context> ContextPointer;
 
 void doInBatch(const char* name, const std::shared_ptr<gpu::Context>& context, const std::function<void(Batch& batch)>& f);
 
+// Records count batches concurrently on the TBB workers, f gets the index of the batch it is recording.
+// The batches are appended to the frame in index order, as if they had been recorded one after the other with doInBatch().
+// They don't share any state, each one has to set up its own view, pipelines and resources.
+void doInBatches(const char* name, const std::shared_ptr<gpu::Context>& context, size_t count,
+                 const std::function<void(size_t index, Batch& batch)>& f);
+
 };  // namespace gpu
 
 #endif
@@ -44,6 +44,11 @@ namespace gpu {
 
         std::queue<std::tuple<std::function<void(const QImage&)>, float, bool>> snapshotOperators;
 
+        /// When the application started simulating the frame, and started and finished recording it, in usecs
+        uint64_t simulationStartTime{ 0 };
+        uint64_t recordStartTime{ 0 };
+        uint64_t recordEndTime{ 0 };
+
     protected:
         friend class Deserializer;
 
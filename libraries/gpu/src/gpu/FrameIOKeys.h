@@ -170,6 +170,7 @@ constexpr const char*  COMMAND_NAMES[] = {
     "blit",
     "generateTextureMips",
     "generateTextureMipsWithPipeline",
+    "readPixels",
 
     "advance",
 
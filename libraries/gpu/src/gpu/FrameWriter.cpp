@@ -291,6 +291,7 @@ json Serializer::writeBatch(const Batch& batch) {
     }
 
     //    LambdaCache _lambdas;
+    //    ReadPixelsHandlerCache _readPixelsHandlers;
 
     return batchNode;
 }
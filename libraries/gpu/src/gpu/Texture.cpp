@@ -19,6 +19,7 @@
 #include <QtCore/QDebug>
 #include <QtCore/QThread>
 #include <Trace.h>
+#include <SharedUtil.h>
 
 #include <ktx/KTX.h>
 #include <NumericalConstants.h>
@@ -909,6 +910,25 @@ bool Texture::incremementMinMip(uint16 count) {
     return setMinMip(_minMip + count);
 }
 
+// the largest footprint reported within this window wins, so a texture shared by near and far items stays sharp
+static const uint64_t SCREEN_FOOTPRINT_WINDOW_USECS = USECS_PER_SECOND / 2;
+
+void Texture::reportScreenFootprint(float texels) const {
+    uint64_t now = usecTimestampNow();
+    uint64_t lastTime = _screenFootprintTime.load(std::memory_order_relaxed);
+    if (now - lastTime >= SCREEN_FOOTPRINT_WINDOW_USECS || texels > _screenFootprint.load(std::memory_order_relaxed)) {
+        _screenFootprint.store(texels, std::memory_order_relaxed);
+        _screenFootprintTime.store(now, std::memory_order_relaxed);
+    }
+}
+
+float Texture::getScreenFootprint() const {
+    if (usecTimestampNow() - _screenFootprintTime.load(std::memory_order_relaxed) >= SCREEN_FOOTPRINT_WINDOW_USECS) {
+        return 0.0f;
+    }
+    return _screenFootprint.load(std::memory_order_relaxed);
+}
+
 Vec3u Texture::evalMipDimensions(uint16 level) const { 
     auto dimensions = getDimensions();
     dimensions >>= level; 
@@ -13,6 +13,7 @@
 
 #include <algorithm> //min max and more
 #include <bitset>
+#include <atomic>
 
 #include <QMetaType>
 #include <QUrl>
@@ -514,6 +515,12 @@ public:
     uint16 getMinMip() const { return _minMip; }
     uint16 usedMipLevels() const { return (getNumMips() - _minMip); }
 
+    // How many texels across the texture was last seen to cover on screen, reported by the render items using it
+    // and read by the backend to decide which textures get their detail streamed in first.
+    // Returns 0 when the texture wasn't reported recently.
+    void reportScreenFootprint(float texels) const;
+    float getScreenFootprint() const;
+
     // Generate the sub mips automatically for the texture
     // If the storage version is not available (from CPU memory)
     // Only works for the standard formats
@@ -623,6 +630,9 @@ protected:
     uint16 _maxMipLevel { 0 };
 
     uint16 _minMip { 0 };
+
+    mutable std::atomic<float> _screenFootprint { 0.0f };
+    mutable std::atomic<uint64_t> _screenFootprintTime { 0 };
  
     Type _type { TEX_1D };
 
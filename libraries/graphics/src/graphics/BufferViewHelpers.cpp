@@ -456,9 +456,11 @@ template<> gpu::BufferView newFromVector<QVariant>(const QVector<QVariant>& _ele
 
 
 gpu::BufferView clone(const gpu::BufferView& input) {
+    // only the range of the view is copied, the buffer may be a block of an arena that holds other meshes
+    auto size = std::min(input._size, input._buffer->getSize() - input._offset);
     return gpu::BufferView(
-        std::make_shared<gpu::Buffer>(input._buffer->getSize(), input._buffer->getData()),
-        input._offset, input._size, input._stride, input._element
+        std::make_shared<gpu::Buffer>(size, input._buffer->getData() + input._offset),
+        0, input._size, input._stride, input._element
     );
 }
 
@@ -471,7 +473,8 @@ gpu::BufferView resized(const gpu::BufferView& input, glm::uint32 numElements) {
     std::unique_ptr<gpu::Byte[]> data{ new gpu::Byte[vsize] };
     memset(data.get(), 0, vsize);
     auto buffer = new gpu::Buffer(vsize, data.get());
-    memcpy(data.get(), input._buffer->getData(), std::min(vsize, (glm::uint32)input._buffer->getSize()));
+    memcpy(data.get(), input._buffer->getData() + input._offset,
+        std::min(vsize, (glm::uint32)(input._buffer->getSize() - input._offset)));
     auto output = gpu::BufferView(buffer, input._element);
 #ifdef DEBUG_BUFFERVIEW_HELPERS
     qCDebug(bufferhelper_logging) << "resized output" << output.getNumElements() << output._buffer->getSize();
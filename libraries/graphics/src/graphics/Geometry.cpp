@@ -11,6 +11,8 @@
 
 #include "Geometry.h"
 
+#include <unordered_map>
+
 #include <glm/gtc/packing.hpp>
 
 using namespace graphics;
@@ -26,7 +28,8 @@ Mesh::Mesh(const Mesh& mesh) :
     _vertexBuffer(mesh._vertexBuffer),
     _attributeBuffers(mesh._attributeBuffers),
     _indexBuffer(mesh._indexBuffer),
-    _partBuffer(mesh._partBuffer) {
+    _partBuffer(mesh._partBuffer),
+    _arenaAllocations(mesh._arenaAllocations) {
 }
 
 Mesh::~Mesh() {
@@ -108,6 +111,50 @@ void Mesh::setPartBuffer(const BufferView& buffer) {
     _partBuffer = buffer;
 }
 
+void Mesh::moveBuffersToArena(gpu::BufferArena& arena) {
+    // the stream and the views share their buffers, each is moved once.  The map holds on to the buffers, so that a new
+    // block can't take the address of one that was moved.
+    std::unordered_map<gpu::BufferPointer, gpu::BufferArena::AllocationPointer> allocations;
+    auto moveBuffer = [&](const gpu::BufferPointer& buffer) {
+        auto allocation = allocations.find(buffer);
+        if (allocation == allocations.end()) {
+            auto arenaAllocation = buffer ? arena.allocate(buffer->getSize(), buffer->getData()) : gpu::BufferArena::AllocationPointer();
+            if (arenaAllocation) {
+                _arenaAllocations.push_back(arenaAllocation);
+            }
+            allocation = allocations.emplace(buffer, arenaAllocation).first;
+        }
+        return allocation->second;
+    };
+    auto moveView = [&](BufferView& view) {
+        auto allocation = moveBuffer(view._buffer);
+        if (allocation) {
+            view._buffer = allocation->getBuffer();
+            view._offset += allocation->getOffset();
+        }
+    };
+
+    moveView(_vertexBuffer);
+    for (auto& attribute : _attributeBuffers) {
+        moveView(attribute.second);
+    }
+    moveView(_indexBuffer);
+
+    gpu::BufferStream vertexStream;
+    for (size_t i = 0; i < _vertexStream.getNumBuffers(); ++i) {
+        const auto& buffer = _vertexStream.getBuffers()[i];
+        auto offset = _vertexStream.getOffsets()[i];
+        auto stride = _vertexStream.getStrides()[i];
+        auto allocation = moveBuffer(buffer);
+        if (allocation) {
+            vertexStream.addBuffer(allocation->getBuffer(), offset + allocation->getOffset(), stride);
+        } else {
+            vertexStream.addBuffer(buffer, offset, stride);
+        }
+    }
+    _vertexStream = vertexStream;
+}
+
 Box Mesh::evalPartBound(int partNum) const {
     Box box;
     if (partNum < _partBuffer.getNum<Part>()) {
@@ -15,6 +15,7 @@
 
 #include <AABox.h>
 
+#include <gpu/BufferArena.h>
 #include <gpu/Resource.h>
 #include <gpu/Stream.h>
 
@@ -134,12 +135,21 @@ public:
     const BufferView& getPartBuffer() const { return _partBuffer; }
     size_t getNumParts() const { return _partBuffer.getNumElements(); }
 
+    // the parts of the simplified levels of detail, from the most detailed, each has as many parts as the mesh
+    void setLODPartBuffers(const std::vector<BufferView>& buffers) { _lodPartBuffers = buffers; }
+    const std::vector<BufferView>& getLODPartBuffers() const { return _lodPartBuffers; }
+    size_t getNumLODs() const { return _lodPartBuffers.size(); }
+
     // evaluate the bounding box of A part
     Box evalPartBound(int partNum) const;
     // evaluate the bounding boxes of the parts in the range [start, end]
     // the returned box is the bounding box of ALL the evaluated parts bound.
     Box evalPartsBound(int partStart, int partEnd) const;
 
+    // copies the vertices and the indices to ranges of the blocks of the arena, and points the views and the stream at
+    // them, on the thread that records the frames.  The data too large for the arena stays where it is.
+    void moveBuffersToArena(gpu::BufferArena& arena);
+
     static gpu::Primitive topologyToPrimitive(Topology topo) { return static_cast<gpu::Primitive>(topo); }
 
     // create a copy of this mesh after passing its vertices, normals, and indexes though the provided functions
@@ -170,6 +180,10 @@ protected:
     BufferView _indexBuffer;
 
     BufferView _partBuffer;
+    std::vector<BufferView> _lodPartBuffers;
+
+    // the ranges of the arena the buffers were moved to, freed with the mesh
+    std::vector<gpu::BufferArena::AllocationPointer> _arenaAllocations;
 
     void evalVertexFormat();
     void evalVertexStream();
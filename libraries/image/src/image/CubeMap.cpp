@@ -594,32 +594,36 @@ void CubeMap::convolveForGGX(CubeMap& output, const std::atomic<bool>& abortProc
         params.points.resize(sampleCount);
         generateGGXSamples(params, mipRoughness, _width);
 
-        for (int face = 0; face < 6; face++) {
-            convolveMipFaceForGGX(params, output, mipLevel, face, abortProcessing);
-            if (abortProcessing.load()) {
-                return;
-            }
+        convolveMipForGGX(params, output, mipLevel, abortProcessing);
+        if (abortProcessing.load()) {
+            return;
         }
     }
 }
 
-void CubeMap::convolveMipFaceForGGX(const GGXSamples& samples, CubeMap& output, gpu::uint16 mipLevel, int face, const std::atomic<bool>& abortProcessing) const {
-    const glm::vec3* faceNormals = FACE_NORMALS + face * 4;
-    const glm::vec3 deltaYNormalLo = faceNormals[2] - faceNormals[0];
-    const glm::vec3 deltaYNormalHi = faceNormals[3] - faceNormals[1];
+void CubeMap::convolveMipForGGX(const GGXSamples& samples, CubeMap& output, gpu::uint16 mipLevel, const std::atomic<bool>& abortProcessing) const {
     const auto mipDimensions = output.getMipDimensions(mipLevel);
     const auto outputLineStride = output.getMipLineStride(mipLevel);
-    auto outputFacePixels = output.editFace(mipLevel, face);
 
-    tbb::parallel_for(tbb::blocked_range2d<int, int>(0, mipDimensions.y, 32, 0, mipDimensions.x, 32), [&](const tbb::blocked_range2d<int, int>& range) {
+    // The rows of the 6 faces are split up together: the small mips, which take the most samples per pixel,
+    // would otherwise be a single block per face and be convolved one face after the other.
+    const int rowGrain = std::max(1, std::min(32, mipDimensions.y / 4));
+    tbb::parallel_for(tbb::blocked_range2d<int, int>(0, 6 * mipDimensions.y, rowGrain, 0, mipDimensions.x, 32), [&](const tbb::blocked_range2d<int, int>& range) {
         auto rowRange = range.rows();
         auto colRange = range.cols();
 
-        for (auto y = rowRange.begin(); y < rowRange.end(); y++) {
+        for (auto faceRow = rowRange.begin(); faceRow < rowRange.end(); faceRow++) {
             if (abortProcessing.load()) {
                 break;
             }
 
+            const int face = faceRow / mipDimensions.y;
+            const int y = faceRow % mipDimensions.y;
+            const glm::vec3* faceNormals = FACE_NORMALS + face * 4;
+            const glm::vec3 deltaYNormalLo = faceNormals[2] - faceNormals[0];
+            const glm::vec3 deltaYNormalHi = faceNormals[3] - faceNormals[1];
+            auto outputFacePixels = output.editFace(mipLevel, face);
+
             const float yAlpha = (y + 0.5f) / mipDimensions.y;
             const glm::vec3 normalXLo = faceNormals[0] + deltaYNormalLo * yAlpha;
             const glm::vec3 normalXHi = faceNormals[1] + deltaYNormalHi * yAlpha;
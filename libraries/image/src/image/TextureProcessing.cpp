@@ -11,6 +11,8 @@
 
 #include "TextureProcessing.h"
 
+#include <thread>
+
 #include <glm/gtc/packing.hpp>
 
 #include <QtCore/QtGlobal>
@@ -23,6 +25,7 @@
 #include <Profile.h>
 #include <StatTracker.h>
 #include <GLMHelpers.h>
+#include <TBBHelpers.h>
 
 #include "TGAReader.h"
 #if !defined(Q_OS_ANDROID)
@@ -253,7 +256,33 @@ std::function<glm::vec3(gpu::uint32)> getHDRUnpackingFunction() {
     return getHDRUnpackingFunction(GPU_CUBEMAP_HDR_FORMAT);
 }
 
-Image processRawImageData(QIODevice& content, const std::string& filename) {
+// The size of the image downscaled to fit within maxNumPixels, keeping its aspect ratio
+static QSize getSizeWithinMaxNumPixels(int imageWidth, int imageHeight, int maxNumPixels) {
+    if (imageWidth * imageHeight <= maxNumPixels) {
+        return QSize(imageWidth, imageHeight);
+    }
+    float scaleFactor = sqrtf(maxNumPixels / (float)(imageWidth * imageHeight));
+    return QSize((int)(scaleFactor * (float)imageWidth + 0.5f), (int)(scaleFactor * (float)imageHeight + 0.5f));
+}
+
+static Image readImage(QImageReader& imageReader, int maxNumPixels) {
+    // The JPEG decoder scales down while it decodes (DCT scaling), so a large image is never decoded at its full
+    // size only to be downscaled afterwards.  The other decoders decode at full size and scale, like we would.
+    auto format = imageReader.format();
+    if (format == "jpeg" || format == "jpg") {
+        QSize size = imageReader.size();
+        if (size.isValid()) {
+            QSize scaledSize = getSizeWithinMaxNumPixels(size.width(), size.height(), maxNumPixels);
+            if (scaledSize != size) {
+                imageReader.setScaledSize(scaledSize);
+                qCDebug(imagelogging).nospace() << "Decoding downscaled (" << size << " to " << scaledSize << ")";
+            }
+        }
+    }
+    return Image(imageReader.read());
+}
+
+Image processRawImageData(QIODevice& content, const std::string& filename, int maxNumPixels) {
     // Help the Image loader by extracting the image file format from the url filename ext.
     // Some tga are not created properly without it.
     auto filenameExtension = filename.substr(filename.find_last_of('.') + 1);
@@ -284,7 +313,7 @@ Image processRawImageData(QIODevice& content, const std::string& filename) {
     QImageReader imageReader(&content, filenameExtension.c_str());
 
     if (imageReader.canRead()) {
-        return Image(imageReader.read());
+        return readImage(imageReader, maxNumPixels);
     } else {
         // Extension could be incorrect, try to detect the format from the content
         QImageReader newImageReader;
@@ -293,7 +322,7 @@ Image processRawImageData(QIODevice& content, const std::string& filename) {
         newImageReader.setDevice(&content);
 
         if (newImageReader.canRead()) {
-            return Image(newImageReader.read());
+            return readImage(newImageReader, maxNumPixels);
         }
     }
 
@@ -338,11 +367,9 @@ void mapToRedChannel(Image& image, ColorChannel sourceChannel) {
     }
 }
 
-gpu::TexturePointer processImage(std::shared_ptr<QIODevice> content, const std::string& filename, ColorChannel sourceChannel,
-                                 int maxNumPixels, TextureUsage::Type textureType,
-                                 bool compress, BackendTarget target, const std::atomic<bool>& abortProcessing) {
-
-    Image image = processRawImageData(*content.get(), filename);
+Image loadSourceImage(std::shared_ptr<QIODevice> content, const std::string& filename, ColorChannel sourceChannel,
+                      int maxNumPixels) {
+    Image image = processRawImageData(*content.get(), filename, maxNumPixels);
     // Texture content can take up a lot of memory. Here we release our ownership of that content
     // in case it can be released.
     content.reset();
@@ -354,16 +381,16 @@ gpu::TexturePointer processImage(std::shared_ptr<QIODevice> content, const std::
     if (imageWidth == 0 || imageHeight == 0 || image.getFormat() == Image::Format_Invalid) {
         QString reason(image.getFormat() == Image::Format_Invalid ? "(Invalid Format)" : "(Size is invalid)");
         qCWarning(imagelogging) << "Failed to load:" << qPrintable(reason);
-        return nullptr;
+        return Image();
     }
 
     // Validate the image is less than _maxNumPixels, and downscale if necessary
     if (imageWidth * imageHeight > maxNumPixels) {
-        float scaleFactor = sqrtf(maxNumPixels / (float)(imageWidth * imageHeight));
         int originalWidth = imageWidth;
         int originalHeight = imageHeight;
-        imageWidth = (int)(scaleFactor * (float)imageWidth + 0.5f);
-        imageHeight = (int)(scaleFactor * (float)imageHeight + 0.5f);
+        QSize scaledSize = getSizeWithinMaxNumPixels(imageWidth, imageHeight, maxNumPixels);
+        imageWidth = scaledSize.width();
+        imageHeight = scaledSize.height();
         image = image.getScaled(glm::uvec2(imageWidth, imageHeight), Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
         qCDebug(imagelogging).nospace() << "Downscaled " << " (" <<
             QSize(originalWidth, originalHeight) << " to " <<
@@ -375,12 +402,28 @@ gpu::TexturePointer processImage(std::shared_ptr<QIODevice> content, const std::
         mapToRedChannel(image, sourceChannel);
     }
 
+    return image;
+}
+
+gpu::TexturePointer processImage(Image&& image, const std::string& filename, TextureUsage::Type textureType,
+                                 bool compress, BackendTarget target, const std::atomic<bool>& abortProcessing) {
+    if (image.isNull()) {
+        return nullptr;
+    }
+
     auto loader = TextureUsage::getTextureLoaderForType(textureType);
     auto texture = loader(std::move(image), filename, compress, target, abortProcessing);
 
     return texture;
 }
 
+gpu::TexturePointer processImage(std::shared_ptr<QIODevice> content, const std::string& filename, ColorChannel sourceChannel,
+                                 int maxNumPixels, TextureUsage::Type textureType,
+                                 bool compress, BackendTarget target, const std::atomic<bool>& abortProcessing) {
+    return processImage(loadSourceImage(std::move(content), filename, sourceChannel, maxNumPixels), filename, textureType,
+                        compress, target, abortProcessing);
+}
+
 Image processSourceImage(Image&& srcImage, bool cubemap, BackendTarget target) {
     PROFILE_RANGE(resource_parse, "processSourceImage");
 
@@ -501,21 +544,20 @@ struct MyErrorHandler : public nvtt::ErrorHandler {
 };
 
 #if defined(NVTT_API)
-class SequentialTaskDispatcher : public nvtt::TaskDispatcher {
+// nvtt splits the compression of a mip in tasks over its blocks, they run on the TBB workers along with this thread
+class ParallelTaskDispatcher : public nvtt::TaskDispatcher {
 public:
-    SequentialTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {
+    ParallelTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {
     }
 
     const std::atomic<bool>& _abortProcessing;
 
     void dispatch(nvtt::Task* task, void* context, int count) override {
-        for (int i = 0; i < count; i++) {
+        tbb::parallel_for(0, count, [&](int i) {
             if (!_abortProcessing.load()) {
                 task(context, i);
-            } else {
-                break;
             }
-        }
+        });
     }
 };
 #endif
@@ -622,7 +664,7 @@ void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
     surface.setAlphaMode(nvtt::AlphaMode_None);
     surface.setWrapMode(nvtt::WrapMode_Mirror);
 
-    SequentialTaskDispatcher dispatcher(abortProcessing);
+    ParallelTaskDispatcher dispatcher(abortProcessing);
     nvtt::Compressor compressor;
     context.setTaskDispatcher(&dispatcher);
 
@@ -759,8 +801,9 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
         MyErrorHandler errorHandler;
         outputOptions.setErrorHandler(&errorHandler);
 
-        SequentialTaskDispatcher dispatcher(abortProcessing);
+        ParallelTaskDispatcher dispatcher(abortProcessing);
         nvtt::Compressor context;
+        context.setTaskDispatcher(&dispatcher);
 
         context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
         if (buildMips) {
@@ -807,7 +850,7 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
 
         const Etc::ErrorMetric errorMetric = Etc::ErrorMetric::RGBA;
         const float effort = 1.0f;
-        const int numEncodeThreads = 4;
+        const int numEncodeThreads = std::max((int)std::thread::hardware_concurrency(), 1);
         int encodingTime;
 
         if (localCopy.getFormat() != Image::Format_RGBAF) {
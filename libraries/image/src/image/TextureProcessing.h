@@ -125,6 +125,12 @@ gpu::TexturePointer processImage(std::shared_ptr<QIODevice> content, const std::
                                  int maxNumPixels, TextureUsage::Type textureType,
                                  bool compress, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false);
 
+// The two halves of processImage, so that several textures can be made out of a single decode of the content.
+// loadSourceImage returns a null image if the content could not be decoded.
+Image loadSourceImage(std::shared_ptr<QIODevice> content, const std::string& url, ColorChannel sourceChannel, int maxNumPixels);
+gpu::TexturePointer processImage(Image&& image, const std::string& url, TextureUsage::Type textureType,
+                                 bool compress, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false);
+
 void convertToTextureWithMips(gpu::Texture* texture, Image&& image, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false, int face = -1);
 void convertToTexture(gpu::Texture* texture, Image&& image, gpu::BackendTarget target, const std::atomic<bool>& abortProcessing = false, int face = -1, int mipLevel = 0);
 
@@ -10,6 +10,7 @@
 //
 #include "KTX.h"
 
+#include <tbb/parallel_for.h>
 
 #include <QtGlobal>
 #include <QtCore/QDebug>
@@ -29,15 +30,29 @@ namespace ktx {
         const std::string _explanation;
     };
 
+    // Below this many bytes of images, copying them is cheaper than dispatching the copies to other threads
+    static const size_t MIN_PARALLEL_IMAGES_SIZE = 1024 * 1024;
+
     std::unique_ptr<KTX> KTX::create(const Header& header, const Images& images, const KeyValues& keyValues) {
         StoragePointer storagePointer;
+        Images destImages;
         {
             auto storageSize = ktx::KTX::evalStorageSize(header, images, keyValues);
             auto memoryStorage = new storage::MemoryStorage(storageSize);
-            ktx::KTX::write(memoryStorage->data(), memoryStorage->size(), header, images, keyValues);
+            ktx::KTX::write(memoryStorage->data(), memoryStorage->size(), header, images, keyValues, destImages);
             storagePointer.reset(memoryStorage);
         }
-        return create(storagePointer);
+
+        // The storage was just written from the source images, so it doesn't need to be validated and parsed
+        // again as create(storage) does with data from elsewhere
+        if (destImages.size() != header.getNumberOfLevels()) {
+            return nullptr;
+        }
+        std::unique_ptr<KTX> result(new KTX());
+        result->resetStorage(storagePointer);
+        result->_keyValues = keyValues;
+        result->_images = std::move(destImages);
+        return result;
     }
 
     std::unique_ptr<KTX> KTX::createBare(const Header& header, const KeyValues& keyValues) {
@@ -95,6 +110,12 @@ namespace ktx {
     }
 
     size_t KTX::write(Byte* destBytes, size_t destByteSize, const Header& header, const Images& srcImages, const KeyValues& keyValues) {
+        Images destImages;
+        return write(destBytes, destByteSize, header, srcImages, keyValues, destImages);
+    }
+
+    size_t KTX::write(Byte* destBytes, size_t destByteSize, const Header& header, const Images& srcImages,
+                      const KeyValues& keyValues, Images& destImages) {
         // Check again that we have enough destination capacity
         if (!destBytes || (destByteSize < evalStorageSize(header, srcImages, keyValues))) {
             return 0;
@@ -116,8 +137,7 @@ namespace ktx {
         currentDestPtr += destHeader->bytesOfKeyValueData;
 
         // Images
-        auto destImages = writeImages(currentDestPtr, destByteSize - sizeof(Header) - destHeader->bytesOfKeyValueData, srcImages);
-        // We chould check here that the amoutn of dest IMages generated is the same as the source
+        destImages = writeImages(currentDestPtr, destByteSize - sizeof(Header) - destHeader->bytesOfKeyValueData, srcImages);
 
         return destByteSize;
     }
@@ -208,6 +228,15 @@ namespace ktx {
         size_t currentDataSize = 0;
         auto currentPtr = imagesDataPtr;
 
+        // The layout is laid out first, then the faces of every mip are copied to it, in parallel when they are big
+        struct FaceCopy {
+            Byte* dest;
+            const Byte* src;
+            size_t size;
+        };
+        std::vector<FaceCopy> faceCopies;
+        size_t faceCopiesSize = 0;
+
         for (uint32_t l = 0; l < srcImages.size(); l++) {
             if (currentDataSize + sizeof(uint32_t) < allocatedImagesDataSize) {
                 uint32_t imageOffset = currentPtr - destBytes;
@@ -223,14 +252,14 @@ namespace ktx {
 
                     // Single face vs cubes
                     if (srcImages[l]._numFaces == 1) {
-                        memcpy(currentPtr, srcImages[l]._faceBytes[0], imageSize);
+                        faceCopies.push_back({ currentPtr, srcImages[l]._faceBytes[0], imageSize });
                         destImages.emplace_back(Image(imageOffset, (uint32_t) imageSize, padding, currentPtr));
                         currentPtr += imageSize;
                     } else {
                         Image::FaceBytes faceBytes(NUM_CUBEMAPFACES);
                         auto faceSize = srcImages[l]._faceSize;
                         for (uint32_t face = 0; face < NUM_CUBEMAPFACES; face++) {
-                             memcpy(currentPtr, srcImages[l]._faceBytes[face], faceSize);
+                             faceCopies.push_back({ currentPtr, srcImages[l]._faceBytes[face], faceSize });
                              faceBytes[face] = currentPtr;
                              currentPtr += faceSize;
                         }
@@ -239,10 +268,21 @@ namespace ktx {
 
                     currentPtr += padding;
                     currentDataSize += imageSize + padding;
+                    faceCopiesSize += imageSize;
                 }
             }
         }
-           
+
+        if (faceCopiesSize < MIN_PARALLEL_IMAGES_SIZE) {
+            for (const auto& copy : faceCopies) {
+                memcpy(copy.dest, copy.src, copy.size);
+            }
+        } else {
+            tbb::parallel_for((size_t)0, faceCopies.size(), [&](size_t i) {
+                memcpy(faceCopies[i].dest, faceCopies[i].src, faceCopies[i].size);
+            });
+        }
+
         return destImages;
     }
 
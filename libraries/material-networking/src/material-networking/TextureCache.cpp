@@ -50,6 +50,7 @@
 #include <StatTracker.h>
 
 #include <TextureMeta.h>
+#include <ResourceRequestObserver.h>
 
 #include <OwningBuffer.h>
 
@@ -98,7 +99,8 @@ static const float SKYBOX_LOAD_PRIORITY { 10.0f }; // Make sure skybox loads fir
 static const float HIGH_MIPS_LOAD_PRIORITY { 9.0f }; // Make sure high mips loads after skybox but before models
 
 TextureCache::TextureCache() {
-    _ktxCache->initialize();
+    // the textures that are requested before the persisted ones are found wait for them
+    _ktxCache->initializeAsync();
 #if defined(DISABLE_KTX_CACHE)
     _ktxCache->wipe();
 #endif
@@ -469,6 +471,12 @@ void NetworkTexture::setImage(gpu::TexturePointer texture, int originalWidth,
         _height = texture->getHeight();
         setSize(texture->getStoredSize());
         finishedLoading(true);
+
+        if (_ktxRequestStartTime != 0 && DependencyManager::isSet<ResourceRequestObserver>()) {
+            qint64 elapsed = (qint64)((usecTimestampNow() - _ktxRequestStartTime) / USECS_PER_MSEC);
+            DependencyManager::get<ResourceRequestObserver>()->updateTiming(_activeUrl, "NetworkTexture::firstMip", elapsed);
+        }
+        _ktxRequestStartTime = 0;
     } else {
         _width = _height = 0;
         finishedLoading(false);
@@ -543,6 +551,9 @@ void NetworkTexture::makeRequest() {
 
     if (_ktxResourceState == PENDING_INITIAL_LOAD) {
         _ktxResourceState = LOADING_INITIAL_DATA;
+        if (_ktxRequestStartTime == 0) {
+            _ktxRequestStartTime = usecTimestampNow();
+        }
 
         // Add a fragment to the base url so we can identify the section of the ktx being requested when debugging
         // The actual requested url is _activeUrl and will not contain the fragment
@@ -1149,6 +1160,7 @@ void NetworkTexture::refresh() {
     }
 
     _ktxResourceState = PENDING_INITIAL_LOAD;
+    _ktxRequestStartTime = 0;
     Resource::refresh();
 }
 
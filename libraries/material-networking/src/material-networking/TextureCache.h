@@ -127,6 +127,9 @@ private:
     QByteArray _ktxHeaderData;
     QByteArray _ktxHighMipData;
 
+    // when the ktx header was first requested, until the first mips are usable
+    quint64 _ktxRequestStartTime { 0 };
+
     uint16_t _lowestRequestedMipLevel { NULL_MIP_LEVEL };
     uint16_t _lowestKnownPopulatedMip { NULL_MIP_LEVEL };
 
@@ -0,0 +1,762 @@
+//
+//  BakedModelBlob.cpp
+//  model-baker/src/model-baker
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakedModelBlob.h"
+
+#include <type_traits>
+
+#include <QtCore/QDataStream>
+
+#include "ModelBakerLogging.h"
+
+namespace {
+    // "HFMB", ahead of the version
+    const uint32_t BLOB_MAGIC = 0x424d4648;
+
+    // Plain values, glm types included, are kept as they are laid out in memory. The blobs never leave the machine
+    // they were written on, so neither the endianness nor the padding need to be portable
+    template <typename T>
+    using IsPlain = std::is_trivially_copyable<T>;
+
+    template <typename T, typename std::enable_if<IsPlain<T>::value, int>::type = 0>
+    void writeValue(QDataStream& out, const T& value) {
+        out.writeRawData((const char*)&value, sizeof(T));
+    }
+
+    template <typename T, typename std::enable_if<IsPlain<T>::value, int>::type = 0>
+    void readValue(QDataStream& in, T& value) {
+        if (in.readRawData((char*)&value, sizeof(T)) != (int)sizeof(T)) {
+            in.setStatus(QDataStream::ReadPastEnd);
+        }
+    }
+
+    // Damaged counts must not get to allocate more than what is left of the blob
+    bool hasBytes(QDataStream& in, quint64 size) {
+        if (in.status() != QDataStream::Ok || size > (quint64)in.device()->bytesAvailable()) {
+            in.setStatus(QDataStream::ReadCorruptData);
+            return false;
+        }
+        return true;
+    }
+
+    void writeValue(QDataStream& out, const QString& value) { out << value; }
+    void readValue(QDataStream& in, QString& value) { in >> value; }
+    void writeValue(QDataStream& out, const QByteArray& value) { out << value; }
+    void readValue(QDataStream& in, QByteArray& value) { in >> value; }
+    void writeValue(QDataStream& out, const std::string& value) { out << QByteArray::fromStdString(value); }
+    void readValue(QDataStream& in, std::string& value) {
+        QByteArray bytes;
+        in >> bytes;
+        value = bytes.toStdString();
+    }
+
+    void writeValue(QDataStream& out, const Transform& value);
+    void readValue(QDataStream& in, Transform& value);
+    void writeValue(QDataStream& out, const gpu::Element& value);
+    void readValue(QDataStream& in, gpu::Element& value);
+    void writeValue(QDataStream& out, const gpu::BufferView& value);
+    void readValue(QDataStream& in, gpu::BufferView& value);
+    void writeValue(QDataStream& out, const graphics::MeshPointer& value);
+    void readValue(QDataStream& in, graphics::MeshPointer& value);
+    void writeValue(QDataStream& out, const graphics::MaterialPointer& value);
+    void readValue(QDataStream& in, graphics::MaterialPointer& value);
+    void writeValue(QDataStream& out, const hfm::Blendshape& value);
+    void readValue(QDataStream& in, hfm::Blendshape& value);
+    void writeValue(QDataStream& out, const hfm::JointShapeInfo& value);
+    void readValue(QDataStream& in, hfm::JointShapeInfo& value);
+    void writeValue(QDataStream& out, const hfm::Joint& value);
+    void readValue(QDataStream& in, hfm::Joint& value);
+    void writeValue(QDataStream& out, const hfm::Cluster& value);
+    void readValue(QDataStream& in, hfm::Cluster& value);
+    void writeValue(QDataStream& out, const hfm::SkinDeformer& value);
+    void readValue(QDataStream& in, hfm::SkinDeformer& value);
+    void writeValue(QDataStream& out, const hfm::Texture& value);
+    void readValue(QDataStream& in, hfm::Texture& value);
+    void writeValue(QDataStream& out, const hfm::MeshPart& value);
+    void readValue(QDataStream& in, hfm::MeshPart& value);
+    void writeValue(QDataStream& out, const hfm::Material& value);
+    void readValue(QDataStream& in, hfm::Material& value);
+    void writeValue(QDataStream& out, const hfm::TriangleListMesh& value);
+    void readValue(QDataStream& in, hfm::TriangleListMesh& value);
+    void writeValue(QDataStream& out, const hfm::Mesh& value);
+    void readValue(QDataStream& in, hfm::Mesh& value);
+    void writeValue(QDataStream& out, const hfm::AnimationFrame& value);
+    void readValue(QDataStream& in, hfm::AnimationFrame& value);
+    template <typename T>
+    void writeValue(QDataStream& out, const std::vector<T>& values);
+    template <typename T>
+    void readValue(QDataStream& in, std::vector<T>& values);
+    template <typename T>
+    void writeValue(QDataStream& out, const QVector<T>& values);
+    template <typename T>
+    void readValue(QDataStream& in, QVector<T>& values);
+
+    // Arrays of plain values are copied in one block, the others value by value
+    template <typename T>
+    void writeArray(QDataStream& out, const T* values, uint32_t count, std::true_type) {
+        writeValue(out, count);
+        out.writeRawData((const char*)values, (int)(count * sizeof(T)));
+    }
+
+    template <typename T>
+    void writeArray(QDataStream& out, const T* values, uint32_t count, std::false_type) {
+        writeValue(out, count);
+        for (uint32_t i = 0; i < count; ++i) {
+            writeValue(out, values[i]);
+        }
+    }
+
+    template <typename T, typename Array>
+    void readArray(QDataStream& in, Array& values, std::true_type) {
+        uint32_t count = 0;
+        readValue(in, count);
+        if (!hasBytes(in, (quint64)count * sizeof(T))) {
+            return;
+        }
+        values.resize(count);
+        in.readRawData((char*)values.data(), (int)(count * sizeof(T)));
+    }
+
+    template <typename T, typename Array>
+    void readArray(QDataStream& in, Array& values, std::false_type) {
+        uint32_t count = 0;
+        readValue(in, count);
+        // every value takes a byte at least
+        if (!hasBytes(in, count)) {
+            return;
+        }
+        values.resize(count);
+        for (auto& value : values) {
+            readValue(in, value);
+            if (in.status() != QDataStream::Ok) {
+                return;
+            }
+        }
+    }
+
+    template <typename T>
+    void writeValue(QDataStream& out, const std::vector<T>& values) {
+        writeArray(out, values.data(), (uint32_t)values.size(), IsPlain<T>());
+    }
+
+    template <typename T>
+    void readValue(QDataStream& in, std::vector<T>& values) {
+        readArray<T>(in, values, IsPlain<T>());
+    }
+
+    template <typename T>
+    void writeValue(QDataStream& out, const QVector<T>& values) {
+        writeArray(out, values.constData(), (uint32_t)values.size(), IsPlain<T>());
+    }
+
+    template <typename T>
+    void readValue(QDataStream& in, QVector<T>& values) {
+        readArray<T>(in, values, IsPlain<T>());
+    }
+
+    void writeValue(QDataStream& out, const Transform& value) {
+        writeValue(out, value.getRotation());
+        writeValue(out, value.getScale());
+        writeValue(out, value.getTranslation());
+    }
+
+    void readValue(QDataStream& in, Transform& value) {
+        glm::quat rotation;
+        glm::vec3 scale;
+        glm::vec3 translation;
+        readValue(in, rotation);
+        readValue(in, scale);
+        readValue(in, translation);
+        value.setRotation(rotation);
+        value.setScale(scale);
+        value.setTranslation(translation);
+    }
+
+    void writeValue(QDataStream& out, const gpu::Element& value) {
+        writeValue(out, (uint8_t)value.getDimension());
+        writeValue(out, (uint8_t)value.getType());
+        writeValue(out, (uint8_t)value.getSemantic());
+    }
+
+    void readValue(QDataStream& in, gpu::Element& value) {
+        uint8_t dimension = 0;
+        uint8_t type = 0;
+        uint8_t semantic = 0;
+        readValue(in, dimension);
+        readValue(in, type);
+        readValue(in, semantic);
+        if (dimension >= gpu::NUM_DIMENSIONS || type >= gpu::NUM_TYPES || semantic >= gpu::NUM_SEMANTICS) {
+            in.setStatus(QDataStream::ReadCorruptData);
+            return;
+        }
+        value = gpu::Element((gpu::Dimension)dimension, (gpu::Type)type, (gpu::Semantic)semantic);
+    }
+
+    void writeBuffer(QDataStream& out, const gpu::BufferPointer& buffer) {
+        writeValue(out, (bool)buffer);
+        if (buffer) {
+            writeValue(out, QByteArray::fromRawData((const char*)buffer->getData(), (int)buffer->getSize()));
+        }
+    }
+
+    void readBuffer(QDataStream& in, gpu::BufferPointer& buffer) {
+        bool hasBuffer = false;
+        readValue(in, hasBuffer);
+        if (hasBuffer) {
+            QByteArray bytes;
+            readValue(in, bytes);
+            buffer = std::make_shared<gpu::Buffer>(bytes.size(), (const gpu::Byte*)bytes.constData());
+        }
+    }
+
+    void writeValue(QDataStream& out, const gpu::BufferView& value) {
+        writeBuffer(out, value._buffer);
+        writeValue(out, (uint64_t)value._offset);
+        writeValue(out, (uint64_t)value._size);
+        writeValue(out, value._stride);
+        writeValue(out, value._element);
+    }
+
+    void readValue(QDataStream& in, gpu::BufferView& value) {
+        gpu::BufferPointer buffer;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint16_t stride = 0;
+        gpu::Element element;
+        readBuffer(in, buffer);
+        readValue(in, offset);
+        readValue(in, size);
+        readValue(in, stride);
+        readValue(in, element);
+        if (buffer) {
+            value = gpu::BufferView(buffer, offset, size, stride, element);
+        }
+    }
+
+    // The graphics meshes of BuildGraphicsMeshTask only come from their format, their vertex streams, and their
+    // index and part buffers
+    void writeValue(QDataStream& out, const graphics::MeshPointer& value) {
+        writeValue(out, (bool)value);
+        if (!value) {
+            return;
+        }
+
+        const auto& format = value->getVertexFormat();
+        const auto& attributes = format ? format->getAttributes() : gpu::Stream::Format::AttributeMap();
+        writeValue(out, (uint32_t)attributes.size());
+        for (const auto& slotAndAttribute : attributes) {
+            const auto& attribute = slotAndAttribute.second;
+            writeValue(out, attribute._slot);
+            writeValue(out, attribute._channel);
+            writeValue(out, attribute._element);
+            writeValue(out, (uint64_t)attribute._offset);
+            writeValue(out, attribute._frequency);
+        }
+
+        const auto& stream = value->getVertexStream();
+        writeValue(out, (uint32_t)stream.getNumBuffers());
+        for (size_t i = 0; i < stream.getNumBuffers(); ++i) {
+            writeBuffer(out, stream.getBuffers()[i]);
+            writeValue(out, (uint64_t)stream.getOffsets()[i]);
+            writeValue(out, (uint64_t)stream.getStrides()[i]);
+        }
+
+        writeValue(out, value->getIndexBuffer());
+        writeValue(out, value->getPartBuffer());
+        const auto& lodPartBuffers = value->getLODPartBuffers();
+        writeValue(out, (uint32_t)lodPartBuffers.size());
+        for (const auto& lodPartBuffer : lodPartBuffers) {
+            writeValue(out, lodPartBuffer);
+        }
+        writeValue(out, value->modelName);
+        writeValue(out, value->displayName);
+    }
+
+    void readValue(QDataStream& in, graphics::MeshPointer& value) {
+        bool hasMesh = false;
+        readValue(in, hasMesh);
+        if (!hasMesh) {
+            value.reset();
+            return;
+        }
+
+        auto format = std::make_shared<gpu::Stream::Format>();
+        uint32_t numAttributes = 0;
+        readValue(in, numAttributes);
+        for (uint32_t i = 0; i < numAttributes && in.status() == QDataStream::Ok; ++i) {
+            gpu::Stream::Slot slot = 0;
+            gpu::Stream::Slot channel = 0;
+            gpu::Element element;
+            uint64_t offset = 0;
+            uint32_t frequency = 0;
+            readValue(in, slot);
+            readValue(in, channel);
+            readValue(in, element);
+            readValue(in, offset);
+            readValue(in, frequency);
+            format->setAttribute(slot, channel, element, offset, (gpu::Stream::Frequency)frequency);
+        }
+
+        auto stream = std::make_shared<gpu::BufferStream>();
+        uint32_t numBuffers = 0;
+        readValue(in, numBuffers);
+        for (uint32_t i = 0; i < numBuffers && in.status() == QDataStream::Ok; ++i) {
+            gpu::BufferPointer buffer;
+            uint64_t offset = 0;
+            uint64_t stride = 0;
+            readBuffer(in, buffer);
+            readValue(in, offset);
+            readValue(in, stride);
+            stream->addBuffer(buffer, offset, stride);
+        }
+
+        gpu::BufferView indexBuffer;
+        gpu::BufferView partBuffer;
+        readValue(in, indexBuffer);
+        readValue(in, partBuffer);
+
+        uint32_t numLODs = 0;
+        readValue(in, numLODs);
+        std::vector<gpu::BufferView> lodPartBuffers;
+        for (uint32_t i = 0; i < numLODs && in.status() == QDataStream::Ok; ++i) {
+            gpu::BufferView lodPartBuffer;
+            readValue(in, lodPartBuffer);
+            lodPartBuffers.push_back(lodPartBuffer);
+        }
+
+        value = std::make_shared<graphics::Mesh>();
+        value->setVertexFormatAndStream(format, stream);
+        value->setIndexBuffer(indexBuffer);
+        value->setPartBuffer(partBuffer);
+        value->setLODPartBuffers(lodPartBuffers);
+        readValue(in, value->modelName);
+        readValue(in, value->displayName);
+    }
+
+    // The serializers only give values to the graphics materials, NetworkMaterial adds their textures
+    void writeValue(QDataStream& out, const graphics::MaterialPointer& value) {
+        writeValue(out, (bool)value);
+        if (!value) {
+            return;
+        }
+        writeValue(out, value->getEmissive(false));
+        writeValue(out, value->getKey().isAlbedo());
+        writeValue(out, value->getAlbedo(false));
+        writeValue(out, value->getOpacity());
+        writeValue(out, value->getRoughness());
+        writeValue(out, value->getMetallic());
+        writeValue(out, value->isUnlit());
+    }
+
+    void readValue(QDataStream& in, graphics::MaterialPointer& value) {
+        bool hasMaterial = false;
+        readValue(in, hasMaterial);
+        if (!hasMaterial) {
+            value.reset();
+            return;
+        }
+        glm::vec3 emissive;
+        bool isAlbedo = false;
+        glm::vec3 albedo;
+        float opacity = 0.0f;
+        float roughness = 0.0f;
+        float metallic = 0.0f;
+        bool isUnlit = false;
+        readValue(in, emissive);
+        readValue(in, isAlbedo);
+        readValue(in, albedo);
+        readValue(in, opacity);
+        readValue(in, roughness);
+        readValue(in, metallic);
+        readValue(in, isUnlit);
+
+        value = std::make_shared<graphics::Material>();
+        value->setEmissive(emissive, false);
+        if (isAlbedo) {
+            value->setAlbedo(albedo, false);
+        }
+        value->setOpacity(opacity);
+        value->setRoughness(roughness);
+        value->setMetallic(metallic);
+        value->setUnlit(isUnlit);
+    }
+
+    void writeValue(QDataStream& out, const hfm::Blendshape& value) {
+        writeValue(out, value.indices);
+        writeValue(out, value.vertices);
+        writeValue(out, value.normals);
+        writeValue(out, value.tangents);
+    }
+
+    void readValue(QDataStream& in, hfm::Blendshape& value) {
+        readValue(in, value.indices);
+        readValue(in, value.vertices);
+        readValue(in, value.normals);
+        readValue(in, value.tangents);
+    }
+
+    void writeValue(QDataStream& out, const hfm::JointShapeInfo& value) {
+        writeValue(out, value.avgPoint);
+        writeValue(out, value.dots);
+        writeValue(out, value.points);
+        writeValue(out, value.debugLines);
+    }
+
+    void readValue(QDataStream& in, hfm::JointShapeInfo& value) {
+        readValue(in, value.avgPoint);
+        readValue(in, value.dots);
+        readValue(in, value.points);
+        readValue(in, value.debugLines);
+    }
+
+    void writeValue(QDataStream& out, const hfm::Joint& value) {
+        writeValue(out, value.shapeInfo);
+        writeValue(out, value.parentIndex);
+        writeValue(out, value.distanceToParent);
+        writeValue(out, value.translation);
+        writeValue(out, value.preTransform);
+        writeValue(out, value.preRotation);
+        writeValue(out, value.rotation);
+        writeValue(out, value.postRotation);
+        writeValue(out, value.postTransform);
+        writeValue(out, value.transform);
+        writeValue(out, value.rotationMin);
+        writeValue(out, value.rotationMax);
+        writeValue(out, value.inverseDefaultRotation);
+        writeValue(out, value.inverseBindRotation);
+        writeValue(out, value.bindTransform);
+        writeValue(out, value.name);
+        writeValue(out, value.isSkeletonJoint);
+        writeValue(out, value.bindTransformFoundInCluster);
+        writeValue(out, value.geometricOffset);
+        writeValue(out, value.localTransform);
+        writeValue(out, value.globalTransform);
+    }
+
+    void readValue(QDataStream& in, hfm::Joint& value) {
+        readValue(in, value.shapeInfo);
+        readValue(in, value.parentIndex);
+        readValue(in, value.distanceToParent);
+        readValue(in, value.translation);
+        readValue(in, value.preTransform);
+        readValue(in, value.preRotation);
+        readValue(in, value.rotation);
+        readValue(in, value.postRotation);
+        readValue(in, value.postTransform);
+        readValue(in, value.transform);
+        readValue(in, value.rotationMin);
+        readValue(in, value.rotationMax);
+        readValue(in, value.inverseDefaultRotation);
+        readValue(in, value.inverseBindRotation);
+        readValue(in, value.bindTransform);
+        readValue(in, value.name);
+        readValue(in, value.isSkeletonJoint);
+        readValue(in, value.bindTransformFoundInCluster);
+        readValue(in, value.geometricOffset);
+        readValue(in, value.localTransform);
+        readValue(in, value.globalTransform);
+    }
+
+    void writeValue(QDataStream& out, const hfm::Cluster& value) {
+        writeValue(out, value.jointIndex);
+        writeValue(out, value.inverseBindMatrix);
+        writeValue(out, value.inverseBindTransform);
+    }
+
+    void readValue(QDataStream& in, hfm::Cluster& value) {
+        readValue(in, value.jointIndex);
+        readValue(in, value.inverseBindMatrix);
+        readValue(in, value.inverseBindTransform);
+    }
+
+    void writeValue(QDataStream& out, const hfm::SkinDeformer& value) {
+        writeValue(out, value.clusters);
+    }
+
+    void readValue(QDataStream& in, hfm::SkinDeformer& value) {
+        readValue(in, value.clusters);
+    }
+
+    void writeValue(QDataStream& out, const hfm::Texture& value) {
+        writeValue(out, value.id);
+        writeValue(out, value.name);
+        writeValue(out, value.filename);
+        writeValue(out, value.content);
+        writeValue(out, value.sourceChannel);
+        writeValue(out, value.transform);
+        writeValue(out, value.maxNumPixels);
+        writeValue(out, value.texcoordSet);
+        writeValue(out, value.texcoordSetName);
+        writeValue(out, value.isBumpmap);
+    }
+
+    void readValue(QDataStream& in, hfm::Texture& value) {
+        readValue(in, value.id);
+        readValue(in, value.name);
+        readValue(in, value.filename);
+        readValue(in, value.content);
+        readValue(in, value.sourceChannel);
+        readValue(in, value.transform);
+        readValue(in, value.maxNumPixels);
+        readValue(in, value.texcoordSet);
+        readValue(in, value.texcoordSetName);
+        readValue(in, value.isBumpmap);
+    }
+
+    void writeValue(QDataStream& out, const hfm::MeshPart& value) {
+        writeValue(out, value.quadIndices);
+        writeValue(out, value.quadTrianglesIndices);
+        writeValue(out, value.triangleIndices);
+    }
+
+    void readValue(QDataStream& in, hfm::MeshPart& value) {
+        readValue(in, value.quadIndices);
+        readValue(in, value.quadTrianglesIndices);
+        readValue(in, value.triangleIndices);
+    }
+
+    void writeValue(QDataStream& out, const hfm::Material& value) {
+        writeValue(out, value.diffuseColor);
+        writeValue(out, value.diffuseFactor);
+        writeValue(out, value.specularColor);
+        writeValue(out, value.specularFactor);
+        writeValue(out, value.emissiveColor);
+        writeValue(out, value.emissiveFactor);
+        writeValue(out, value.shininess);
+        writeValue(out, value.opacity);
+        writeValue(out, value.metallic);
+        writeValue(out, value.roughness);
+        writeValue(out, value.emissiveIntensity);
+        writeValue(out, value.ambientFactor);
+        writeValue(out, value.bumpMultiplier);
+        writeValue(out, value.materialID);
+        writeValue(out, value.name);
+        writeValue(out, value.shadingModel);
+        writeValue(out, value._material);
+        writeValue(out, value.normalTexture);
+        writeValue(out, value.albedoTexture);
+        writeValue(out, value.opacityTexture);
+        writeValue(out, value.glossTexture);
+        writeValue(out, value.roughnessTexture);
+        writeValue(out, value.specularTexture);
+        writeValue(out, value.metallicTexture);
+        writeValue(out, value.emissiveTexture);
+        writeValue(out, value.occlusionTexture);
+        writeValue(out, value.scatteringTexture);
+        writeValue(out, value.lightmapTexture);
+        writeValue(out, value.lightmapParams);
+        writeValue(out, value.isPBSMaterial);
+        writeValue(out, value.useNormalMap);
+        writeValue(out, value.useAlbedoMap);
+        writeValue(out, value.useOpacityMap);
+        writeValue(out, value.useRoughnessMap);
+        writeValue(out, value.useSpecularMap);
+        writeValue(out, value.useMetallicMap);
+        writeValue(out, value.useEmissiveMap);
+        writeValue(out, value.useOcclusionMap);
+    }
+
+    void readValue(QDataStream& in, hfm::Material& value) {
+        readValue(in, value.diffuseColor);
+        readValue(in, value.diffuseFactor);
+        readValue(in, value.specularColor);
+        readValue(in, value.specularFactor);
+        readValue(in, value.emissiveColor);
+        readValue(in, value.emissiveFactor);
+        readValue(in, value.shininess);
+        readValue(in, value.opacity);
+        readValue(in, value.metallic);
+        readValue(in, value.roughness);
+        readValue(in, value.emissiveIntensity);
+        readValue(in, value.ambientFactor);
+        readValue(in, value.bumpMultiplier);
+        readValue(in, value.materialID);
+        readValue(in, value.name);
+        readValue(in, value.shadingModel);
+        readValue(in, value._material);
+        readValue(in, value.normalTexture);
+        readValue(in, value.albedoTexture);
+        readValue(in, value.opacityTexture);
+        readValue(in, value.glossTexture);
+        readValue(in, value.roughnessTexture);
+        readValue(in, value.specularTexture);
+        readValue(in, value.metallicTexture);
+        readValue(in, value.emissiveTexture);
+        readValue(in, value.occlusionTexture);
+        readValue(in, value.scatteringTexture);
+        readValue(in, value.lightmapTexture);
+        readValue(in, value.lightmapParams);
+        readValue(in, value.isPBSMaterial);
+        readValue(in, value.useNormalMap);
+        readValue(in, value.useAlbedoMap);
+        readValue(in, value.useOpacityMap);
+        readValue(in, value.useRoughnessMap);
+        readValue(in, value.useSpecularMap);
+        readValue(in, value.useMetallicMap);
+        readValue(in, value.useEmissiveMap);
+        readValue(in, value.useOcclusionMap);
+    }
+
+    void writeValue(QDataStream& out, const hfm::TriangleListMesh& value) {
+        writeValue(out, value.vertices);
+        writeValue(out, value.indices);
+        writeValue(out, value.parts);
+        writeValue(out, value.partExtents);
+    }
+
+    void readValue(QDataStream& in, hfm::TriangleListMesh& value) {
+        readValue(in, value.vertices);
+        readValue(in, value.indices);
+        readValue(in, value.parts);
+        readValue(in, value.partExtents);
+    }
+
+    void writeValue(QDataStream& out, const hfm::Mesh& value) {
+        writeValue(out, value.parts);
+        writeValue(out, value.vertices);
+        writeValue(out, value.normals);
+        writeValue(out, value.tangents);
+        writeValue(out, value.colors);
+        writeValue(out, value.texCoords);
+        writeValue(out, value.texCoords1);
+        writeValue(out, value.meshExtents);
+        writeValue(out, value.modelTransform);
+        writeValue(out, value.clusterIndices);
+        writeValue(out, value.clusterWeights);
+        writeValue(out, value.clusterWeightsPerVertex);
+        writeValue(out, value.blendshapes);
+        writeValue(out, value.triangleListMesh);
+        writeValue(out, value.originalIndices);
+        writeValue(out, value.meshIndex);
+        writeValue(out, value._mesh);
+        writeValue(out, value.wasCompressed);
+    }
+
+    void readValue(QDataStream& in, hfm::Mesh& value) {
+        readValue(in, value.parts);
+        readValue(in, value.vertices);
+        readValue(in, value.normals);
+        readValue(in, value.tangents);
+        readValue(in, value.colors);
+        readValue(in, value.texCoords);
+        readValue(in, value.texCoords1);
+        readValue(in, value.meshExtents);
+        readValue(in, value.modelTransform);
+        readValue(in, value.clusterIndices);
+        readValue(in, value.clusterWeights);
+        readValue(in, value.clusterWeightsPerVertex);
+        readValue(in, value.blendshapes);
+        readValue(in, value.triangleListMesh);
+        readValue(in, value.originalIndices);
+        readValue(in, value.meshIndex);
+        readValue(in, value._mesh);
+        readValue(in, value.wasCompressed);
+    }
+
+    void writeValue(QDataStream& out, const hfm::AnimationFrame& value) {
+        writeValue(out, value.rotations);
+        writeValue(out, value.translations);
+    }
+
+    void readValue(QDataStream& in, hfm::AnimationFrame& value) {
+        readValue(in, value.rotations);
+        readValue(in, value.translations);
+    }
+}
+
+namespace baker {
+
+hifi::ByteArray writeBakedModelBlob(const hfm::Model& hfmModel) {
+    hifi::ByteArray blob;
+    QDataStream out(&blob, QIODevice::WriteOnly);
+    writeValue(out, BLOB_MAGIC);
+    writeValue(out, BAKED_MODEL_BLOB_VERSION);
+
+    writeValue(out, hfmModel.originalURL);
+    writeValue(out, hfmModel.author);
+    writeValue(out, hfmModel.applicationName);
+    writeValue(out, hfmModel.shapes);
+    writeValue(out, hfmModel.meshes);
+    writeValue(out, hfmModel.materials);
+    writeValue(out, hfmModel.skinDeformers);
+    writeValue(out, hfmModel.joints);
+    out << hfmModel.jointIndices;
+    writeValue(out, hfmModel.hasSkeletonJoints);
+    out << hfmModel.scripts;
+    writeValue(out, hfmModel.offset);
+    writeValue(out, hfmModel.neckPivot);
+    writeValue(out, hfmModel.bindExtents);
+    writeValue(out, hfmModel.meshExtents);
+    writeValue(out, hfmModel.animationFrames);
+    out << hfmModel.meshIndicesToModelNames;
+    out << hfmModel.blendshapeChannelNames;
+
+    writeValue(out, (uint32_t)hfmModel.jointRotationOffsets.size());
+    for (auto offset = hfmModel.jointRotationOffsets.cbegin(); offset != hfmModel.jointRotationOffsets.cend(); ++offset) {
+        writeValue(out, offset.key());
+        writeValue(out, offset.value());
+    }
+    writeValue(out, hfmModel.shapeVertices);
+    out << hfmModel.flowData._physicsConfig;
+    out << hfmModel.flowData._collisionsConfig;
+    return blob;
+}
+
+hfm::Model::Pointer readBakedModelBlob(const hifi::ByteArray& blob) {
+    QDataStream in(blob);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    readValue(in, magic);
+    readValue(in, version);
+    if (in.status() != QDataStream::Ok || magic != BLOB_MAGIC || version != BAKED_MODEL_BLOB_VERSION) {
+        return hfm::Model::Pointer();
+    }
+
+    auto hfmModel = std::make_shared<hfm::Model>();
+    readValue(in, hfmModel->originalURL);
+    readValue(in, hfmModel->author);
+    readValue(in, hfmModel->applicationName);
+    readValue(in, hfmModel->shapes);
+    readValue(in, hfmModel->meshes);
+    readValue(in, hfmModel->materials);
+    readValue(in, hfmModel->skinDeformers);
+    readValue(in, hfmModel->joints);
+    in >> hfmModel->jointIndices;
+    readValue(in, hfmModel->hasSkeletonJoints);
+    in >> hfmModel->scripts;
+    readValue(in, hfmModel->offset);
+    readValue(in, hfmModel->neckPivot);
+    readValue(in, hfmModel->bindExtents);
+    readValue(in, hfmModel->meshExtents);
+    readValue(in, hfmModel->animationFrames);
+    in >> hfmModel->meshIndicesToModelNames;
+    in >> hfmModel->blendshapeChannelNames;
+
+    uint32_t numJointRotationOffsets = 0;
+    readValue(in, numJointRotationOffsets);
+    for (uint32_t i = 0; i < numJointRotationOffsets && in.status() == QDataStream::Ok; ++i) {
+        int jointIndex = 0;
+        glm::quat rotation;
+        readValue(in, jointIndex);
+        readValue(in, rotation);
+        hfmModel->jointRotationOffsets[jointIndex] = rotation;
+    }
+    readValue(in, hfmModel->shapeVertices);
+    in >> hfmModel->flowData._physicsConfig;
+    in >> hfmModel->flowData._collisionsConfig;
+
+    if (in.status() != QDataStream::Ok || !in.atEnd()) {
+        qCWarning(model_baker) << "Ignoring a damaged baked model blob of" << hfmModel->originalURL;
+        return hfm::Model::Pointer();
+    }
+    return hfmModel;
+}
+
+}
@@ -0,0 +1,30 @@
+//
+//  BakedModelBlob.h
+//  model-baker/src/model-baker
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakedModelBlob_h
+#define hifi_BakedModelBlob_h
+
+#include <hfm/HFM.h>
+#include <shared/HifiTypes.h>
+
+namespace baker {
+    // Whenever hfm::Model, the graphics meshes built by BuildGraphicsMeshTask or the layout below change,
+    // this value should be incremented.  Blobs of other versions are then ignored
+    static const uint32_t BAKED_MODEL_BLOB_VERSION = 2;
+
+    // A binary copy of a baked model and its graphics meshes, to keep it between sessions.
+    // The graphics materials only hold the values the serializers give them, their textures are not part of it.
+    hifi::ByteArray writeBakedModelBlob(const hfm::Model& hfmModel);
+
+    // The model of the blob, or null if the blob is of another version or damaged
+    hfm::Model::Pointer readBakedModelBlob(const hifi::ByteArray& blob);
+};
+
+#endif // hifi_BakedModelBlob_h
@@ -23,6 +23,7 @@
 #include "CalculateTransformedExtentsTask.h"
 #include "BuildDracoMeshTask.h"
 #include "ParseFlowDataTask.h"
+#include "SimplifyMeshesTask.h"
 #include <hfm/HFMModelMath.h>
 
 namespace baker {
@@ -190,8 +191,11 @@ namespace baker {
             // Build the slim triangle list mesh for each hfm::mesh
             const auto triangleListMeshes = model.addJob<BuildMeshTriangleListTask>("BuildMeshTriangleListTask", meshesIn);
 
+            // Build the simplified levels of detail of each hfm::Mesh
+            const auto lodsPerMesh = model.addJob<SimplifyMeshesTask>("SimplifyMeshes", meshesIn);
+
             // Build the graphics::MeshPointer for each hfm::Mesh
-            const auto buildGraphicsMeshInputs = BuildGraphicsMeshTask::Input(meshesIn, url, meshIndicesToModelNames, normalsPerMesh, tangentsPerMesh, shapesIn, skinDeformersIn).asVarying();
+            const auto buildGraphicsMeshInputs = BuildGraphicsMeshTask::Input(meshesIn, url, meshIndicesToModelNames, normalsPerMesh, tangentsPerMesh, shapesIn, skinDeformersIn, lodsPerMesh).asVarying();
             const auto graphicsMeshes = model.addJob<BuildGraphicsMeshTask>("BuildGraphicsMesh", buildGraphicsMeshInputs);
 
             // Prepare joint information
@@ -260,6 +264,12 @@ namespace baker {
         return _engine->getOutput().get<BakerEngineBuilder::Output>().get1();
     }
 
+    MaterialMapping Baker::parseMaterialMapping(const hifi::VariantHash& mapping, const hifi::URL& materialMappingBaseURL) {
+        MaterialMapping materialMapping;
+        ParseMaterialMappingTask().run(std::make_shared<BakeContext>(), ParseMaterialMappingTask::Input(mapping, materialMappingBaseURL), materialMapping);
+        return materialMapping;
+    }
+
     const std::vector<hifi::ByteArray>& Baker::getDracoMeshes() const {
         return _engine->getOutput().get<BakerEngineBuilder::Output>().get2();
     }
@@ -37,6 +37,9 @@ namespace baker {
         // This is a ByteArray and not a std::string because the character sequence can contain the null character (particularly for FBX materials)
         std::vector<std::vector<hifi::ByteArray>> getDracoMaterialLists() const;
 
+        // The material mapping of a model that does not need to be baked again, as getMaterialMapping() would give it
+        static MaterialMapping parseMaterialMapping(const hifi::VariantHash& mapping, const hifi::URL& materialMappingBaseURL);
+
     protected:
         EnginePointer _engine;
     };
@@ -37,6 +37,11 @@ namespace baker {
 
     using MeshIndicesToModelNames = QHash<int, QString>;
 
+    // the triangle indices of each part of a simplified level of detail of a mesh
+    using LODPartIndices = std::vector<std::vector<int>>;
+    using MeshLODs = std::vector<LODPartIndices>;
+    using LODsPerMesh = std::vector<MeshLODs>;
+
     class ReweightedDeformers {
     public:
         std::vector<uint16_t> indices;
@@ -28,7 +28,7 @@ glm::vec3 normalizeDirForPacking(const glm::vec3& dir) {
     return dir;
 }
 
-void buildGraphicsMesh(const hfm::Mesh& hfmMesh, graphics::MeshPointer& graphicsMeshPointer, const baker::MeshNormals& meshNormals, const baker::MeshTangents& meshTangentsIn, uint16_t numDeformerControllers) {
+void buildGraphicsMesh(const hfm::Mesh& hfmMesh, graphics::MeshPointer& graphicsMeshPointer, const baker::MeshNormals& meshNormals, const baker::MeshTangents& meshTangentsIn, uint16_t numDeformerControllers, const baker::MeshLODs& meshLODs) {
     auto graphicsMesh = std::make_shared<graphics::Mesh>();
 
     // Fill tangents with a dummy value to force tangents to be present if there are normals
@@ -313,8 +313,14 @@ void buildGraphicsMesh(const hfm::Mesh& hfmMesh, graphics::MeshPointer& graphics
     foreach(const HFMMeshPart& part, hfmMesh.parts) {
         totalIndices += (part.quadTrianglesIndices.size() + part.triangleIndices.size());
     }
+    unsigned int totalFullDetailIndices = totalIndices;
+    for (const auto& lodPartIndices : meshLODs) {
+        for (const auto& indices : lodPartIndices) {
+            totalIndices += (unsigned int)indices.size();
+        }
+    }
 
-    if (!totalIndices) {
+    if (!totalFullDetailIndices) {
         HIFI_FCDEBUG_ID(model_baker(), repeatMessageID, "BuildGraphicsMeshTask failed -- no indices");
         return;
     }
@@ -366,6 +372,24 @@ void buildGraphicsMesh(const hfm::Mesh& hfmMesh, graphics::MeshPointer& graphics
         return;
     }
 
+    // the levels of detail follow the full detail parts in the index buffer, with a part buffer each
+    std::vector<gpu::BufferView> lodPartBuffers;
+    for (const auto& lodPartIndices : meshLODs) {
+        std::vector<graphics::Mesh::Part> lodParts;
+        for (const auto& indices : lodPartIndices) {
+            lodParts.emplace_back(indexNum, (graphics::Index)indices.size(), 0, graphics::Mesh::TRIANGLES);
+            if (!indices.empty()) {
+                indexBuffer->setSubData(offset, indices.size() * sizeof(int), (const gpu::Byte*)indices.data());
+                offset += (int)(indices.size() * sizeof(int));
+                indexNum += (int)indices.size();
+            }
+        }
+        auto lodPartBuffer = std::make_shared<gpu::Buffer>();
+        lodPartBuffer->setData(lodParts.size() * sizeof(graphics::Mesh::Part), (const gpu::Byte*)lodParts.data());
+        lodPartBuffers.emplace_back(lodPartBuffer, gpu::Element(gpu::VEC4, gpu::UINT32, gpu::XYZW));
+    }
+    graphicsMesh->setLODPartBuffers(lodPartBuffers);
+
     graphicsMesh->evalPartBound(0);
 
     graphicsMeshPointer = graphicsMesh;
@@ -379,6 +403,7 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
     const auto& tangentsPerMesh = input.get4();
     const auto& shapes = input.get5();
     const auto& skinDeformers = input.get6();
+    const auto& lodsPerMesh = input.get7();
 
     // Currently, there is only (at most) one skinDeformer per mesh
     // An undefined shape.skinDeformer has the value hfm::UNDEFINED_KEY
@@ -404,7 +429,7 @@ void BuildGraphicsMeshTask::run(const baker::BakeContextPointer& context, const
         }
 
         // Try to create the graphics::Mesh
-        buildGraphicsMesh(meshes[i], graphicsMesh, baker::safeGet(normalsPerMesh, i), baker::safeGet(tangentsPerMesh, i), numDeformerControllers);
+        buildGraphicsMesh(meshes[i], graphicsMesh, baker::safeGet(normalsPerMesh, i), baker::safeGet(tangentsPerMesh, i), numDeformerControllers, baker::safeGet(lodsPerMesh, i));
 
         // Choose a name for the mesh
         if (graphicsMesh) {
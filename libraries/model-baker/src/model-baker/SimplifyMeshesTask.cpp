@@ -0,0 +1,361 @@
+//
+//  SimplifyMeshesTask.cpp
+//  model-baker/src/model-baker
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SimplifyMeshesTask.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <TBBHelpers.h>
+
+// the fraction of the triangles of the full detail mesh kept by each level of detail
+static const std::vector<float> LOD_TRIANGLE_RATIOS { 0.5f, 0.25f };
+
+// a level that can't get rid of enough triangles isn't worth its indices
+static const float MAX_LOD_TRIANGLE_RATIO = 0.8f;
+static const size_t MIN_TRIANGLES_TO_SIMPLIFY = 512;
+
+// the distance a vertex can move away from the surface around it, relative to the size of the mesh
+static const double MAX_RELATIVE_ERROR = 0.01;
+
+// a collapse can't turn a triangle further away than this from the way it faced
+static const float MIN_NORMAL_DOT = 0.25f;
+
+static const int MAX_COLLAPSE_PASSES = 16;
+
+namespace {
+
+// The sum of the planes of the triangles around a vertex, the error of a position is the sum of its squared
+// distances to those planes.
+class Quadric {
+public:
+    void addPlane(const glm::dvec3& normal, double distance) {
+        double plane[4] = { normal.x, normal.y, normal.z, distance };
+        int k = 0;
+        for (int i = 0; i < 4; i++) {
+            for (int j = i; j < 4; j++) {
+                _a[k++] += plane[i] * plane[j];
+            }
+        }
+    }
+
+    void add(const Quadric& other) {
+        for (int i = 0; i < NUM_COEFFICIENTS; i++) {
+            _a[i] += other._a[i];
+        }
+    }
+
+    double evaluate(const glm::dvec3& p) const {
+        return _a[0] * p.x * p.x + 2.0 * _a[1] * p.x * p.y + 2.0 * _a[2] * p.x * p.z + 2.0 * _a[3] * p.x +
+            _a[4] * p.y * p.y + 2.0 * _a[5] * p.y * p.z + 2.0 * _a[6] * p.y +
+            _a[7] * p.z * p.z + 2.0 * _a[8] * p.z + _a[9];
+    }
+
+    double evaluate(const Quadric& other, const glm::dvec3& p) const {
+        return evaluate(p) + other.evaluate(p);
+    }
+
+private:
+    static const int NUM_COEFFICIENTS = 10;
+    double _a[NUM_COEFFICIENTS] {};
+};
+
+class MeshSimplifier {
+public:
+    explicit MeshSimplifier(const hfm::Mesh& mesh);
+
+    size_t getNumTriangles() const { return _numTriangles; }
+
+    // collapses edges until there are no more than targetTriangles or every collapse left moves too far from the surface
+    void simplify(size_t targetTriangles);
+
+    baker::LODPartIndices getPartIndices() const;
+
+private:
+    struct Triangle {
+        int vertices[3];
+        int part;
+        bool removed { false };
+    };
+
+    struct Collapse {
+        double cost;
+        int from;
+        int to;
+        bool operator<(const Collapse& other) const { return cost < other.cost; }
+    };
+
+    static uint64_t edgeKey(int a, int b) {
+        return ((uint64_t)std::min(a, b) << 32) | (uint64_t)(uint32_t)std::max(a, b);
+    }
+
+    bool containsVertex(const Triangle& triangle, int vertex) const;
+    bool canCollapse(int from, int to) const;
+    void collapse(int from, int to);
+
+    const QVector<glm::vec3>& _positions;
+    int _numParts { 0 };
+    std::vector<Triangle> _triangles;
+    std::vector<std::vector<int>> _vertexTriangles;
+    std::vector<Quadric> _quadrics;
+    std::vector<bool> _locked;
+    size_t _numTriangles { 0 };
+    double _maxError { 0.0 };
+};
+
+MeshSimplifier::MeshSimplifier(const hfm::Mesh& mesh) :
+    _positions(mesh.vertices),
+    _numParts(mesh.parts.size())
+{
+    int numVertices = _positions.size();
+    _vertexTriangles.resize(numVertices);
+    _quadrics.resize(numVertices);
+    _locked.resize(numVertices, false);
+
+    // the triangles keep the order of the index buffer of the part
+    auto addTriangles = [&](const QVector<int>& indices, int part) {
+        for (int i = 0; i + 2 < indices.size(); i += 3) {
+            Triangle triangle;
+            triangle.part = part;
+            bool isValid = true;
+            for (int j = 0; j < 3; j++) {
+                triangle.vertices[j] = indices[i + j];
+                isValid = isValid && triangle.vertices[j] >= 0 && triangle.vertices[j] < numVertices;
+            }
+            if (isValid && triangle.vertices[0] != triangle.vertices[1] && triangle.vertices[1] != triangle.vertices[2] &&
+                    triangle.vertices[2] != triangle.vertices[0]) {
+                _triangles.push_back(triangle);
+            }
+        }
+    };
+    for (int part = 0; part < _numParts; part++) {
+        addTriangles(mesh.parts[part].quadTrianglesIndices, part);
+        addTriangles(mesh.parts[part].triangleIndices, part);
+    }
+    _numTriangles = _triangles.size();
+
+    std::unordered_map<uint64_t, int> edgeUses;
+    for (int t = 0; t < (int)_triangles.size(); t++) {
+        const auto& vertices = _triangles[t].vertices;
+        glm::dvec3 p0(_positions[vertices[0]]);
+        glm::dvec3 normal = glm::cross(glm::dvec3(_positions[vertices[1]]) - p0, glm::dvec3(_positions[vertices[2]]) - p0);
+        double length = glm::length(normal);
+        if (length > 0.0) {
+            normal /= length;
+        }
+        for (int j = 0; j < 3; j++) {
+            _vertexTriangles[vertices[j]].push_back(t);
+            _quadrics[vertices[j]].addPlane(normal, -glm::dot(normal, p0));
+            edgeUses[edgeKey(vertices[j], vertices[(j + 1) % 3])]++;
+        }
+    }
+
+    // An edge of a single triangle is on a border, or on a seam where the vertices are split for their attributes.
+    // Those, and the ones of the edges of more than two triangles, would open holes if they moved.
+    for (const auto& edge : edgeUses) {
+        if (edge.second != 2) {
+            _locked[(int)(edge.first >> 32)] = true;
+            _locked[(int)(edge.first & 0xffffffff)] = true;
+        }
+    }
+
+    glm::vec3 minimum = _positions.empty() ? glm::vec3() : _positions[0];
+    glm::vec3 maximum = minimum;
+    for (const auto& position : _positions) {
+        minimum = glm::min(minimum, position);
+        maximum = glm::max(maximum, position);
+    }
+    double maxDistance = MAX_RELATIVE_ERROR * glm::length(glm::dvec3(maximum - minimum));
+    _maxError = maxDistance * maxDistance;
+}
+
+bool MeshSimplifier::containsVertex(const Triangle& triangle, int vertex) const {
+    return triangle.vertices[0] == vertex || triangle.vertices[1] == vertex || triangle.vertices[2] == vertex;
+}
+
+bool MeshSimplifier::canCollapse(int from, int to) const {
+    // the vertices that neighbour both can only be the third ones of the triangles that the collapse removes,
+    // else the surface would fold onto itself
+    std::vector<int> fromNeighbours;
+    int numShared = 0;
+    for (int t : _vertexTriangles[from]) {
+        const auto& triangle = _triangles[t];
+        if (triangle.removed) {
+            continue;
+        }
+        if (containsVertex(triangle, to)) {
+            numShared++;
+        }
+        for (int vertex : triangle.vertices) {
+            if (vertex != from && vertex != to) {
+                fromNeighbours.push_back(vertex);
+            }
+        }
+    }
+    std::sort(fromNeighbours.begin(), fromNeighbours.end());
+    fromNeighbours.erase(std::unique(fromNeighbours.begin(), fromNeighbours.end()), fromNeighbours.end());
+
+    std::vector<int> commonNeighbours;
+    for (int t : _vertexTriangles[to]) {
+        const auto& triangle = _triangles[t];
+        if (triangle.removed) {
+            continue;
+        }
+        for (int vertex : triangle.vertices) {
+            if (vertex != from && vertex != to && std::binary_search(fromNeighbours.begin(), fromNeighbours.end(), vertex)) {
+                commonNeighbours.push_back(vertex);
+            }
+        }
+    }
+    std::sort(commonNeighbours.begin(), commonNeighbours.end());
+    commonNeighbours.erase(std::unique(commonNeighbours.begin(), commonNeighbours.end()), commonNeighbours.end());
+    if (numShared == 0 || (int)commonNeighbours.size() > numShared) {
+        return false;
+    }
+
+    // the triangles that are left around the vertex can't flip
+    for (int t : _vertexTriangles[from]) {
+        const auto& triangle = _triangles[t];
+        if (triangle.removed || containsVertex(triangle, to)) {
+            continue;
+        }
+        glm::vec3 oldPositions[3];
+        glm::vec3 newPositions[3];
+        for (int j = 0; j < 3; j++) {
+            oldPositions[j] = _positions[triangle.vertices[j]];
+            newPositions[j] = _positions[triangle.vertices[j] == from ? to : triangle.vertices[j]];
+        }
+        glm::vec3 oldNormal = glm::cross(oldPositions[1] - oldPositions[0], oldPositions[2] - oldPositions[0]);
+        glm::vec3 newNormal = glm::cross(newPositions[1] - newPositions[0], newPositions[2] - newPositions[0]);
+        float oldLength = glm::length(oldNormal);
+        float newLength = glm::length(newNormal);
+        if (newLength <= 0.0f || (oldLength > 0.0f && glm::dot(oldNormal, newNormal) < MIN_NORMAL_DOT * oldLength * newLength)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void MeshSimplifier::collapse(int from, int to) {
+    for (int t : _vertexTriangles[from]) {
+        auto& triangle = _triangles[t];
+        if (triangle.removed) {
+            continue;
+        }
+        if (containsVertex(triangle, to)) {
+            triangle.removed = true;
+            _numTriangles--;
+        } else {
+            for (int& vertex : triangle.vertices) {
+                if (vertex == from) {
+                    vertex = to;
+                }
+            }
+            _vertexTriangles[to].push_back(t);
+        }
+    }
+    _vertexTriangles[from].clear();
+    _quadrics[to].add(_quadrics[from]);
+}
+
+void MeshSimplifier::simplify(size_t targetTriangles) {
+    std::vector<Collapse> collapses;
+    std::vector<bool> touched;
+    for (int pass = 0; pass < MAX_COLLAPSE_PASSES && _numTriangles > targetTriangles; pass++) {
+        collapses.clear();
+        for (const auto& triangle : _triangles) {
+            if (triangle.removed) {
+                continue;
+            }
+            for (int j = 0; j < 3; j++) {
+                int a = triangle.vertices[j];
+                int b = triangle.vertices[(j + 1) % 3];
+                if (!_locked[a]) {
+                    double cost = _quadrics[a].evaluate(_quadrics[b], glm::dvec3(_positions[b]));
+                    if (cost <= _maxError) {
+                        collapses.push_back({ cost, a, b });
+                    }
+                }
+                if (!_locked[b]) {
+                    double cost = _quadrics[a].evaluate(_quadrics[b], glm::dvec3(_positions[a]));
+                    if (cost <= _maxError) {
+                        collapses.push_back({ cost, b, a });
+                    }
+                }
+            }
+        }
+        if (collapses.empty()) {
+            break;
+        }
+        std::sort(collapses.begin(), collapses.end());
+
+        // the costs of a pass are stale around the vertices that have moved, they wait for the next one
+        touched.assign(_positions.size(), false);
+        bool hasCollapsed = false;
+        for (const auto& candidate : collapses) {
+            if (_numTriangles <= targetTriangles) {
+                break;
+            }
+            if (touched[candidate.from] || touched[candidate.to] || !canCollapse(candidate.from, candidate.to)) {
+                continue;
+            }
+            for (int t : _vertexTriangles[candidate.from]) {
+                for (int vertex : _triangles[t].vertices) {
+                    touched[vertex] = true;
+                }
+            }
+            collapse(candidate.from, candidate.to);
+            hasCollapsed = true;
+        }
+        if (!hasCollapsed) {
+            break;
+        }
+    }
+}
+
+baker::LODPartIndices MeshSimplifier::getPartIndices() const {
+    baker::LODPartIndices partIndices(_numParts);
+    for (const auto& triangle : _triangles) {
+        if (!triangle.removed) {
+            auto& indices = partIndices[triangle.part];
+            indices.insert(indices.end(), std::begin(triangle.vertices), std::end(triangle.vertices));
+        }
+    }
+    return partIndices;
+}
+
+}
+
+void SimplifyMeshesTask::run(const baker::BakeContextPointer& context, const Input& input, Output& output) {
+    const auto& meshes = input;
+    auto& lodsPerMesh = output;
+
+    // the meshes are independent of each other
+    lodsPerMesh.clear();
+    lodsPerMesh.resize(meshes.size());
+    tbb::parallel_for((size_t)0, meshes.size(), [&](size_t i) {
+        MeshSimplifier simplifier(meshes[i]);
+        size_t numTriangles = simplifier.getNumTriangles();
+        if (numTriangles < MIN_TRIANGLES_TO_SIMPLIFY) {
+            return;
+        }
+
+        // each level continues from the previous one
+        size_t previousTriangles = numTriangles;
+        for (float ratio : LOD_TRIANGLE_RATIOS) {
+            simplifier.simplify((size_t)(ratio * (float)numTriangles));
+            if ((float)simplifier.getNumTriangles() > MAX_LOD_TRIANGLE_RATIO * (float)previousTriangles) {
+                break;
+            }
+            previousTriangles = simplifier.getNumTriangles();
+            lodsPerMesh[i].push_back(simplifier.getPartIndices());
+        }
+    });
+}
@@ -0,0 +1,32 @@
+//
+//  SimplifyMeshesTask.h
+//  model-baker/src/model-baker
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SimplifyMeshesTask_h
+#define hifi_SimplifyMeshesTask_h
+
+#include <hfm/HFM.h>
+
+#include "Engine.h"
+#include "BakerTypes.h"
+
+// Builds the simplified levels of detail of the meshes with quadric error edge collapses.  A collapse moves a vertex
+// onto one of its neighbours, so the levels only have new indices and share the vertices of the full detail mesh,
+// which keeps their normals, texture coordinates, skinning and blendshapes.  The vertices on the borders and the
+// seams of the mesh stay where they are.
+class SimplifyMeshesTask {
+public:
+    using Input = std::vector<hfm::Mesh>;
+    using Output = baker::LODsPerMesh;
+    using JobModel = baker::Job::ModelIO<SimplifyMeshesTask, Input, Output>;
+
+    void run(const baker::BakeContextPointer& context, const Input& input, Output& output);
+};
+
+#endif // hifi_SimplifyMeshesTask_h
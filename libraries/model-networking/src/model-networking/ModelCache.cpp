@@ -17,6 +17,8 @@
 #include <gpu/Stream.h>
 
 #include <QThreadPool>
+#include <QJsonDocument>
+#include <QJsonObject>
 
 #include <Gzip.h>
 
@@ -28,6 +30,7 @@
 #include <OBJSerializer.h>
 #include <GLTFSerializer.h>
 #include <model-baker/Baker.h>
+#include <model-baker/BakedModelBlob.h>
 
 Q_LOGGING_CATEGORY(trace_resource_parse_geometry, "trace.resource.parse.geometry")
 
@@ -85,6 +88,8 @@ namespace std {
     };
 }
 
+static const QString BAKED_MODEL_ARTIFACT_TYPE = "hfm";
+
 class GeometryReader : public QRunnable {
 public:
     GeometryReader(const ModelLoader& modelLoader, QWeakPointer<Resource>& resource, const QUrl& url, const GeometryMappingPair& mapping,
@@ -144,6 +149,28 @@ void GeometryReader::run() {
         serializerMapping["combineParts"] = _combineParts;
         serializerMapping["deduplicateIndices"] = true;
 
+        // The same content under the same url and mapping always bakes to the same model, so a blob of an earlier bake
+        // skips both the serializer and the baker. The json of the mapping keeps its keys in the same order every time.
+        auto artifactCache = ResourceCache::getArtifactCache();
+        QString artifactType = BAKED_MODEL_ARTIFACT_TYPE + QString::number(baker::BAKED_MODEL_BLOB_VERSION) + ":" +
+            _url.toString() + ":" + _webMediaType + ":" +
+            QJsonDocument(QJsonObject::fromVariantHash(serializerMapping)).toJson(QJsonDocument::Compact);
+        for (const auto& script : serializerMapping.values(SCRIPT_FIELD)) {
+            artifactType += ":" + script.toString();
+        }
+        auto artifactKey = ResourceArtifactCache::getArtifactKey(_data, artifactType);
+        if (artifactCache) {
+            QByteArray blob;
+            auto blobFile = artifactCache->mapArtifact(artifactKey, blob);
+            auto bakedModel = blobFile ? baker::readBakedModelBlob(blob) : HFMModel::Pointer();
+            if (bakedModel) {
+                auto materialMapping = baker::Baker::parseMaterialMapping(_mapping.second, _mapping.first);
+                QMetaObject::invokeMethod(resource.data(), "setGeometryDefinition",
+                        Q_ARG(HFMModel::Pointer, bakedModel), Q_ARG(MaterialMapping, materialMapping));
+                return;
+            }
+        }
+
         if (_url.path().toLower().endsWith(".gz")) {
             QByteArray uncompressedData;
             if (!gunzip(_data, uncompressedData)) {
@@ -181,6 +208,10 @@ void GeometryReader::run() {
         auto processedHFMModel = modelBaker.getHFMModel();
         auto materialMapping = modelBaker.getMaterialMapping();
 
+        if (artifactCache && processedHFMModel) {
+            artifactCache->writeArtifact(artifactKey, baker::writeBakedModelBlob(*processedHFMModel));
+        }
+
         QMetaObject::invokeMethod(resource.data(), "setGeometryDefinition",
                 Q_ARG(HFMModel::Pointer, processedHFMModel), Q_ARG(MaterialMapping, materialMapping));
     } catch (const std::exception&) {
@@ -329,7 +360,12 @@ void ModelResource::setGeometryDefinition(HFMModel::Pointer hfmModel, const Mate
 
     std::shared_ptr<GeometryMeshes> meshes = std::make_shared<GeometryMeshes>();
     int meshID = 0;
+    auto& meshBufferArena = ModelCache::getMeshBufferArena();
     for (const HFMMesh& mesh : _hfmModel->meshes) {
+        // nothing draws the meshes yet, they are moved to the arena before their buffers ever become buffer objects
+        if (mesh._mesh) {
+            mesh._mesh->moveBuffersToArena(meshBufferArena);
+        }
         // Copy mesh pointers
         meshes->emplace_back(mesh._mesh);
         meshID++;
@@ -367,6 +403,12 @@ ModelCache::ModelCache() {
     modelFormatRegistry->addFormat(GLTFSerializer());
 }
 
+gpu::BufferArena& ModelCache::getMeshBufferArena() {
+    // leaked, so that the meshes that outlive the statics can still free their ranges
+    static gpu::BufferArena* arena = new gpu::BufferArena();
+    return *arena;
+}
+
 QSharedPointer<Resource> ModelCache::createResource(const QUrl& url) {
     return QSharedPointer<Resource>(new ModelResource(url, _modelLoader), &ModelResource::deleter);
 }
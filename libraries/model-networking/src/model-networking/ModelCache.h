@@ -15,6 +15,7 @@
 #include <DependencyManager.h>
 #include <ResourceCache.h>
 
+#include <gpu/BufferArena.h>
 #include <graphics/Asset.h>
 
 #include "FBXSerializer.h"
@@ -164,6 +165,9 @@ public:
                                                                  GeometryMappingPair(QUrl(), QVariantHash()),
                                                            const QUrl& textureBaseUrl = QUrl());
 
+    // the blocks the vertices and the indices of the meshes of the loaded models are sub-allocated from
+    static gpu::BufferArena& getMeshBufferArena();
+
 protected:
     friend class ModelResource;
 
@@ -45,6 +45,7 @@ AssetClient::AssetClient() {
 
     packetReceiver.registerListener(PacketType::AssetMappingOperationReply, this, "handleAssetMappingOperationReply");
     packetReceiver.registerListener(PacketType::AssetGetInfoReply, this, "handleAssetGetInfoReply");
+    packetReceiver.registerListener(PacketType::AssetGetChunksReply, this, "handleAssetGetChunksReply");
     packetReceiver.registerListener(PacketType::AssetGetReply, this, "handleAssetGetReply", true);
     packetReceiver.registerListener(PacketType::AssetUploadReply, this, "handleAssetUploadReply");
 
@@ -532,6 +533,74 @@ void AssetClient::handleAssetGetInfoReply(QSharedPointer<ReceivedMessage> messag
     }
 }
 
+MessageID AssetClient::getAssetChunks(const QString& hash, GetChunksCallback callback) {
+    Q_ASSERT(QThread::currentThread() == thread());
+
+    auto nodeList = DependencyManager::get<LimitedNodeList>();
+    SharedNodePointer assetServer = nodeList->soloNodeOfType(NodeType::AssetServer);
+
+    if (assetServer) {
+        auto messageID = ++_currentID;
+
+        auto payloadSize = sizeof(messageID) + AssetUtils::SHA256_HASH_LENGTH;
+        auto packet = NLPacket::create(PacketType::AssetGetChunks, payloadSize, true);
+
+        packet->writePrimitive(messageID);
+        packet->write(QByteArray::fromHex(hash.toLatin1()));
+
+        if (nodeList->sendPacket(std::move(packet), *assetServer) != -1) {
+            _pendingChunksRequests[assetServer][messageID] = callback;
+
+            return messageID;
+        }
+    }
+
+    callback(false, AssetUtils::AssetServerError::NoError, AssetUtils::AssetChunks());
+    return INVALID_MESSAGE_ID;
+}
+
+void AssetClient::handleAssetGetChunksReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
+    Q_ASSERT(QThread::currentThread() == thread());
+
+    MessageID messageID;
+    message->readPrimitive(&messageID);
+    message->read(AssetUtils::SHA256_HASH_LENGTH);
+
+    AssetUtils::AssetServerError error;
+    message->readPrimitive(&error);
+
+    AssetUtils::AssetChunks chunks;
+    if (error == AssetUtils::AssetServerError::NoError) {
+        uint32_t numChunks { 0 };
+        message->readPrimitive(&numChunks);
+
+        // the chunks follow each other, only their sizes are sent
+        AssetUtils::DataOffset offset = 0;
+        for (uint32_t i = 0; i < numChunks && message->getBytesLeftToRead() > 0; ++i) {
+            uint32_t size;
+            message->readPrimitive(&size);
+            chunks.push_back({ offset, (AssetUtils::DataOffset)size, message->read(AssetUtils::SHA256_HASH_LENGTH) });
+            offset += size;
+        }
+        if (chunks.size() != numChunks) {
+            error = AssetUtils::AssetServerError::InvalidByteRange;
+            chunks.clear();
+        }
+    }
+
+    auto messageMapIt = _pendingChunksRequests.find(senderNode);
+    if (messageMapIt != _pendingChunksRequests.end()) {
+        auto& messageCallbackMap = messageMapIt->second;
+
+        auto requestIt = messageCallbackMap.find(messageID);
+        if (requestIt != messageCallbackMap.end()) {
+            auto callback = requestIt->second;
+            messageCallbackMap.erase(requestIt);
+            callback(true, error, chunks);
+        }
+    }
+}
+
 void AssetClient::handleAssetGetReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
     Q_ASSERT(QThread::currentThread() == thread());
 
@@ -547,6 +616,9 @@ void AssetClient::handleAssetGetReply(QSharedPointer<ReceivedMessage> message, S
     AssetUtils::DataOffset length = 0;
     if (!error) {
         message->readHeadPrimitive(&length);
+
+        // the rest of the reply is the asset, let the message preallocate it and hand it to us without a copy
+        message->expectBytesLeftToRead(length);
     } else {
         qCWarning(asset_client) << "Failure getting asset: " << error;
     }
@@ -697,7 +769,7 @@ MessageID AssetClient::getAssetMapping(const AssetUtils::AssetPath& path, Mappin
     return INVALID_MESSAGE_ID;
 }
 
-MessageID AssetClient::getAllAssetMappings(MappingOperationCallback callback) {
+MessageID AssetClient::getAllAssetMappings(const AssetUtils::AssetPath& startAfterPath, MappingOperationCallback callback) {
     Q_ASSERT(QThread::currentThread() == thread());
 
     auto nodeList = DependencyManager::get<LimitedNodeList>();
@@ -710,6 +782,8 @@ MessageID AssetClient::getAllAssetMappings(MappingOperationCallback callback) {
         packetList->writePrimitive(messageID);
 
         packetList->writePrimitive(AssetUtils::AssetMappingOperationType::GetAll);
+        packetList->writeString(startAfterPath);
+        packetList->writePrimitive(AssetUtils::MAX_MAPPINGS_PER_PAGE);
 
         if (nodeList->sendPacketList(std::move(packetList), *assetServer) != -1) {
             _pendingMappingRequests[assetServer][messageID] = callback;
@@ -859,6 +933,17 @@ bool AssetClient::cancelGetAssetInfoRequest(MessageID id) {
     return false;
 }
 
+bool AssetClient::cancelGetAssetChunksRequest(MessageID id) {
+    Q_ASSERT(QThread::currentThread() == thread());
+
+    for (auto& kv : _pendingChunksRequests) {
+        if (kv.second.erase(id)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool AssetClient::cancelGetAssetRequest(MessageID id) {
     Q_ASSERT(QThread::currentThread() == thread());
 
@@ -1023,6 +1108,16 @@ void AssetClient::forceFailureOfPendingRequests(SharedNodePointer node) {
         }
     }
 
+    {
+        auto messageMapIt = _pendingChunksRequests.find(node);
+        if (messageMapIt != _pendingChunksRequests.end()) {
+            for (const auto& value : messageMapIt->second) {
+                value.second(false, AssetUtils::AssetServerError::NoError, AssetUtils::AssetChunks());
+            }
+            messageMapIt->second.clear();
+        }
+    }
+
     {
         auto messageMapIt = _pendingMappingRequests.find(node);
         if (messageMapIt != _pendingMappingRequests.end()) {
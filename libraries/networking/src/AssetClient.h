@@ -16,6 +16,8 @@
 #include <QtQml/QJSEngine>
 #include <QString>
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 
 #include <DependencyManager.h>
@@ -45,9 +47,14 @@ struct AssetInfo {
 using MappingOperationCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, QSharedPointer<ReceivedMessage> message)>;
 using ReceivedAssetCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, const QByteArray& data)>;
 using GetInfoCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, AssetInfo info)>;
+using GetChunksCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, const AssetUtils::AssetChunks& chunks)>;
 using UploadResultCallback = std::function<void(bool responseReceived, AssetUtils::AssetServerError serverError, const QString& hash)>;
 using ProgressCallback = std::function<void(qint64 totalReceived, qint64 total)>;
 
+// the ranges missing from a large asset are split to at most this size, to be downloaded concurrently
+const int64_t MAX_ASSET_RANGE_SIZE = 1024 * 1024;
+const int DEFAULT_MAX_CONCURRENT_RANGES = 4;
+
 class AssetClient : public QObject, public Dependency {
     Q_OBJECT
 public:
@@ -63,6 +70,10 @@ public:
     Q_INVOKABLE AssetUpload* createUpload(const QString& filename);
     Q_INVOKABLE AssetUpload* createUpload(const QByteArray& data);
 
+    // how many ranges of a large asset are downloaded at once
+    int getMaxConcurrentRanges() const { return _maxConcurrentRanges; }
+    void setMaxConcurrentRanges(int maxConcurrentRanges) { _maxConcurrentRanges = std::max(maxConcurrentRanges, 1); }
+
 public slots:
     void initCaching();
 
@@ -76,6 +87,7 @@ public slots:
 private slots:
     void handleAssetMappingOperationReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleAssetGetInfoReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
+    void handleAssetGetChunksReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleAssetGetReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleAssetUploadReply(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
 
@@ -84,19 +96,21 @@ private slots:
 
 private:
     MessageID getAssetMapping(const AssetUtils::AssetHash& hash, MappingOperationCallback callback);
-    MessageID getAllAssetMappings(MappingOperationCallback callback);
+    MessageID getAllAssetMappings(const AssetUtils::AssetPath& startAfterPath, MappingOperationCallback callback);
     MessageID setAssetMapping(const QString& path, const AssetUtils::AssetHash& hash, MappingOperationCallback callback);
     MessageID deleteAssetMappings(const AssetUtils::AssetPathList& paths, MappingOperationCallback callback);
     MessageID renameAssetMapping(const AssetUtils::AssetPath& oldPath, const AssetUtils::AssetPath& newPath, MappingOperationCallback callback);
     MessageID setBakingEnabled(const AssetUtils::AssetPathList& paths, bool enabled, MappingOperationCallback callback);
 
     MessageID getAssetInfo(const QString& hash, GetInfoCallback callback);
+    MessageID getAssetChunks(const QString& hash, GetChunksCallback callback);
     MessageID getAsset(const QString& hash, AssetUtils::DataOffset start, AssetUtils::DataOffset end,
                   ReceivedAssetCallback callback, ProgressCallback progressCallback);
     MessageID uploadAsset(const QByteArray& data, UploadResultCallback callback);
 
     bool cancelMappingRequest(MessageID id);
     bool cancelGetAssetInfoRequest(MessageID id);
+    bool cancelGetAssetChunksRequest(MessageID id);
     bool cancelGetAssetRequest(MessageID id);
     bool cancelUploadAssetRequest(MessageID id);
 
@@ -115,10 +129,13 @@ private:
     std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, MappingOperationCallback>> _pendingMappingRequests;
     std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, GetAssetRequestData>> _pendingRequests;
     std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, GetInfoCallback>> _pendingInfoRequests;
+    std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, GetChunksCallback>> _pendingChunksRequests;
     std::unordered_map<SharedNodePointer, std::unordered_map<MessageID, UploadResultCallback>> _pendingUploads;
 
     QString _cacheDir;
 
+    std::atomic<int> _maxConcurrentRanges { DEFAULT_MAX_CONCURRENT_RANGES };
+
     friend class AssetRequest;
     friend class AssetUpload;
     friend class MappingRequest;
@@ -38,6 +38,10 @@ AssetRequest::~AssetRequest() {
     if (_assetRequestID) {
         assetClient->cancelGetAssetRequest(_assetRequestID);
     }
+    if (_assetChunksRequestID) {
+        assetClient->cancelGetAssetChunksRequest(_assetChunksRequestID);
+    }
+    cancelRangeRequests();
 }
 
 void AssetRequest::start() {
@@ -75,6 +79,215 @@ void AssetRequest::start() {
 
     _state = WaitingForData;
 
+    if (_byteRange.isSet()) {
+        requestData();
+    } else {
+        requestChunks();
+    }
+}
+
+static QUrl getChunkUrl(const QByteArray& chunkHash) {
+    return QUrl(ATP_SCHEME + "chunks/" + chunkHash.toHex());
+}
+
+void AssetRequest::requestChunks() {
+    auto assetClient = DependencyManager::get<AssetClient>();
+    auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
+
+    _assetChunksRequestID = assetClient->getAssetChunks(_hash,
+        [this, that](bool responseReceived, AssetUtils::AssetServerError serverError, const AssetUtils::AssetChunks& chunks) {
+        if (!that) {
+            return;
+        }
+        _assetChunksRequestID = INVALID_MESSAGE_ID;
+
+        if (!responseReceived) {
+            _error = NetworkError;
+        } else if (serverError == AssetUtils::AssetServerError::AssetNotFound) {
+            _error = NotFound;
+        } else {
+            // a small asset, or chunks that couldn't be listed, is downloaded whole
+            _chunks = chunks;
+            if (serverError != AssetUtils::AssetServerError::NoError || _chunks.empty()) {
+                requestData();
+            } else {
+                requestMissingChunks();
+            }
+            return;
+        }
+
+        qCWarning(asset_client) << "Got error retrieving chunks of asset" << _hash << "- error code" << _error;
+        _state = Finished;
+        emit finished(this);
+    });
+}
+
+void AssetRequest::requestMissingChunks() {
+    const auto& lastChunk = _chunks.back();
+    _data = QByteArray((int)(lastChunk.offset + lastChunk.size), Qt::Uninitialized);
+
+    // The cache keeps, for each chunk of a downloaded asset, the hash of that asset and where the chunk is in it,
+    // so the chunks that are the same as in another version of the asset are copied from it.
+    QHash<QByteArray, QByteArray> cachedAssets;
+    std::vector<ByteRange> missingRanges;
+    for (const auto& chunk : _chunks) {
+        bool found = false;
+        QByteArray chunkLocation = AssetUtils::loadFromCache(getChunkUrl(chunk.hash));
+        if (chunkLocation.size() == (int)(AssetUtils::SHA256_HASH_LENGTH + sizeof(AssetUtils::DataOffset))) {
+            QByteArray cachedHash = chunkLocation.left(AssetUtils::SHA256_HASH_LENGTH);
+            AssetUtils::DataOffset cachedOffset;
+            memcpy(&cachedOffset, chunkLocation.constData() + AssetUtils::SHA256_HASH_LENGTH, sizeof(cachedOffset));
+
+            auto it = cachedAssets.find(cachedHash);
+            if (it == cachedAssets.end()) {
+                it = cachedAssets.insert(cachedHash, AssetUtils::loadFromCache(AssetUtils::getATPUrl(cachedHash.toHex())));
+            }
+            if (cachedOffset >= 0 && it->size() >= cachedOffset + chunk.size) {
+                memcpy(_data.data() + chunk.offset, it->constData() + cachedOffset, chunk.size);
+                found = true;
+            } else {
+                // the asset it was in was evicted from the cache
+                AssetUtils::removeFromCache(getChunkUrl(chunk.hash));
+            }
+        }
+
+        if (!found) {
+            if (!missingRanges.empty() && missingRanges.back().toExclusive == chunk.offset) {
+                missingRanges.back().toExclusive += chunk.size;
+            } else {
+                missingRanges.push_back({ chunk.offset, chunk.offset + chunk.size });
+            }
+        }
+    }
+
+    _totalMissing = 0;
+    for (const auto& range : missingRanges) {
+        _totalMissing += range.size();
+    }
+    qCDebug(asset_client) << "Reusing" << _data.size() - _totalMissing << "of" << _data.size() << "bytes of" << _hash
+        << "from the cache";
+
+    if (missingRanges.empty()) {
+        finishChunks();
+        return;
+    }
+
+    // large ranges are split, so that a stall or the congestion window of one request doesn't hold up the download
+    _missingRanges.clear();
+    for (const auto& range : missingRanges) {
+        for (auto offset = range.fromInclusive; offset < range.toExclusive; offset += MAX_ASSET_RANGE_SIZE) {
+            _missingRanges.push_back({ offset, std::min(offset + MAX_ASSET_RANGE_SIZE, range.toExclusive) });
+        }
+    }
+    _rangeRequestIDs.assign(_missingRanges.size(), INVALID_MESSAGE_ID);
+    _rangesReceived.assign(_missingRanges.size(), 0);
+    _nextMissingRange = 0;
+
+    requestNextRanges();
+}
+
+void AssetRequest::requestNextRanges() {
+    int maxConcurrentRanges = DependencyManager::get<AssetClient>()->getMaxConcurrentRanges();
+    while (_state != Finished && _numPendingRequests < maxConcurrentRanges && _nextMissingRange < _missingRanges.size()) {
+        requestRange(_nextMissingRange++);
+    }
+}
+
+void AssetRequest::requestRange(size_t rangeIndex) {
+    auto assetClient = DependencyManager::get<AssetClient>();
+    auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
+    auto range = _missingRanges[rangeIndex];
+
+    _numPendingRequests++;
+    auto rangeRequestID = assetClient->getAsset(_hash, range.fromInclusive, range.toExclusive,
+        [this, that, range, rangeIndex](bool responseReceived, AssetUtils::AssetServerError serverError, const QByteArray& data) {
+        if (!that || _state == Finished) {
+            return;
+        }
+        _numPendingRequests--;
+        _rangeRequestIDs[rangeIndex] = INVALID_MESSAGE_ID;
+
+        if (!responseReceived) {
+            _error = NetworkError;
+        } else if (serverError != AssetUtils::AssetServerError::NoError || data.size() != range.size()) {
+            _error = serverError == AssetUtils::AssetServerError::AssetNotFound ? NotFound : InvalidByteRange;
+        } else {
+            memcpy(_data.data() + range.fromInclusive, data.constData(), data.size());
+            _totalReceived += data.size() - _rangesReceived[rangeIndex];
+            _rangesReceived[rangeIndex] = data.size();
+            emit progress(_totalReceived, _totalMissing);
+
+            if (_numPendingRequests == 0 && _nextMissingRange == _missingRanges.size()) {
+                _rangeRequestIDs.clear();
+                finishChunks();
+            } else {
+                requestNextRanges();
+            }
+            return;
+        }
+
+        qCWarning(asset_client) << "Got error retrieving a range of asset" << _hash << "- error code" << _error;
+        cancelRangeRequests();
+        _data.clear();
+        _state = Finished;
+        emit finished(this);
+    }, [this, that, rangeIndex](qint64 totalReceived, qint64 total) {
+        if (!that || _state == Finished) {
+            return;
+        }
+        // the progress of the ranges in flight streams into the progress of the whole asset
+        qint64 rangeReceived = std::min(totalReceived, (qint64)_missingRanges[rangeIndex].size());
+        if (rangeReceived > _rangesReceived[rangeIndex]) {
+            _totalReceived += rangeReceived - _rangesReceived[rangeIndex];
+            _rangesReceived[rangeIndex] = rangeReceived;
+            emit progress(_totalReceived, _totalMissing);
+        }
+    });
+
+    if (_state != Finished) {
+        _rangeRequestIDs[rangeIndex] = rangeRequestID;
+    }
+}
+
+void AssetRequest::finishChunks() {
+    if (AssetUtils::hashData(_data).toHex() != _hash) {
+        // a chunk from the cache wasn't what it should be, fall back to the whole asset
+        qCWarning(asset_client) << "Chunks of asset" << _hash << "don't match its hash, downloading it whole";
+        for (const auto& chunk : _chunks) {
+            AssetUtils::removeFromCache(getChunkUrl(chunk.hash));
+        }
+        _data.clear();
+        requestData();
+        return;
+    }
+
+    AssetUtils::saveToCache(getUrl(), _data);
+    saveChunksToCache();
+
+    _state = Finished;
+    emit finished(this);
+}
+
+void AssetRequest::saveChunksToCache() {
+    QByteArray hash = QByteArray::fromHex(_hash.toLatin1());
+    for (const auto& chunk : _chunks) {
+        QByteArray chunkLocation = hash;
+        chunkLocation.append(reinterpret_cast<const char*>(&chunk.offset), sizeof(chunk.offset));
+        AssetUtils::saveToCache(getChunkUrl(chunk.hash), chunkLocation);
+    }
+}
+
+void AssetRequest::cancelRangeRequests() {
+    auto assetClient = DependencyManager::get<AssetClient>();
+    for (auto rangeRequestID : _rangeRequestIDs) {
+        if (rangeRequestID != INVALID_MESSAGE_ID) {
+            assetClient->cancelGetAssetRequest(rangeRequestID);
+        }
+    }
+    _rangeRequestIDs.clear();
+}
+
+void AssetRequest::requestData() {
     auto assetClient = DependencyManager::get<AssetClient>();
     auto that = QPointer<AssetRequest>(this); // Used to track the request's lifetime
     auto hash = _hash;
@@ -116,6 +329,7 @@ void AssetRequest::start() {
 
                 if (!_byteRange.isSet()) {
                     AssetUtils::saveToCache(getUrl(), data);
+                    saveChunksToCache();
                 }
             }
         }
@@ -12,6 +12,8 @@
 #ifndef hifi_AssetRequest_h
 #define hifi_AssetRequest_h
 
+#include <vector>
+
 #include <QByteArray>
 #include <QObject>
 #include <QString>
@@ -62,6 +64,17 @@ signals:
     void progress(qint64 totalReceived, qint64 total);
 
 private:
+    // a whole asset is downloaded by chunks, and only the ones that aren't in the cache, when it is large
+    void requestChunks();
+    void requestMissingChunks();
+    // keeps up to the concurrency of the asset client of the missing ranges in flight
+    void requestNextRanges();
+    void requestRange(size_t rangeIndex);
+    void finishChunks();
+    void saveChunksToCache();
+    void cancelRangeRequests();
+    void requestData();
+
     int _requestID;
     State _state = NotStarted;
     Error _error = NoError;
@@ -70,6 +83,13 @@ private:
     QByteArray _data;
     int _numPendingRequests { 0 };
     MessageID _assetRequestID { INVALID_MESSAGE_ID };
+    MessageID _assetChunksRequestID { INVALID_MESSAGE_ID };
+    std::vector<ByteRange> _missingRanges;
+    std::vector<MessageID> _rangeRequestIDs; // one per missing range, invalid once it is done
+    std::vector<qint64> _rangesReceived; // one per missing range, what came in so far
+    size_t _nextMissingRange { 0 };
+    AssetUtils::AssetChunks _chunks;
+    int64_t _totalMissing { 0 };
     const ByteRange _byteRange;
     bool _loadedFromCache { false };
 };
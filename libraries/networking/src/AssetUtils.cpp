@@ -11,6 +11,8 @@
 
 #include "AssetUtils.h"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 
 #include <QtCore/QCryptographicHash>
@@ -62,6 +64,60 @@ QByteArray hashData(const QByteArray& data) {
     return QCryptographicHash::hash(data, QCryptographicHash::Sha256);
 }
 
+// Content defined chunking with a gear hash: a window of the last 64 bytes ends a chunk when the top bits
+// of its hash are zero, which on random data is 256KB on average past the minimum size of a chunk.
+static const DataOffset MIN_CHUNK_SIZE = 64 * 1024;
+static const DataOffset MAX_CHUNK_SIZE = 1024 * 1024;
+static const uint64_t CHUNK_BOUNDARY_MASK = 0x3ffffULL << 46;
+
+// the same on every client and server, so they can't be random
+static const std::array<uint64_t, 256>& getGearTable() {
+    static const std::array<uint64_t, 256> GEAR_TABLE = [] {
+        std::array<uint64_t, 256> table;
+        uint64_t state = 0x9e3779b97f4a7c15ULL;
+        for (auto& value : table) {
+            // splitmix64
+            state += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            value = z ^ (z >> 31);
+        }
+        return table;
+    }();
+    return GEAR_TABLE;
+}
+
+AssetChunks chunkData(const char* data, DataOffset size) {
+    AssetChunks chunks;
+    if (size < MIN_CHUNKED_ASSET_SIZE) {
+        return chunks;
+    }
+
+    const auto& gearTable = getGearTable();
+    auto bytes = reinterpret_cast<const uint8_t*>(data);
+    DataOffset start = 0;
+    while (start < size) {
+        DataOffset end = std::min(start + MAX_CHUNK_SIZE, size);
+        if (end - start > MIN_CHUNK_SIZE) {
+            uint64_t hash = 0;
+            for (DataOffset i = start + MIN_CHUNK_SIZE; i < end; ++i) {
+                hash = (hash << 1) + gearTable[bytes[i]];
+                if ((hash & CHUNK_BOUNDARY_MASK) == 0) {
+                    end = i + 1;
+                    break;
+                }
+            }
+        }
+
+        QByteArray chunkHash = QCryptographicHash::hash(QByteArray::fromRawData(data + start, (int)(end - start)),
+                                                        QCryptographicHash::Sha256);
+        chunks.push_back({ start, end - start, chunkHash });
+        start = end;
+    }
+    return chunks;
+}
+
 QByteArray loadFromCache(const QUrl& url) {
     if (auto cache = NetworkAccessManager::getInstance().cache()) {
 
@@ -96,6 +152,12 @@ bool saveToCache(const QUrl& url, const QByteArray& file) {
     return false;
 }
 
+void removeFromCache(const QUrl& url) {
+    if (auto cache = NetworkAccessManager::getInstance().cache()) {
+        cache->remove(url);
+    }
+}
+
 bool isValidFilePath(const AssetPath& filePath) {
     QRegExp filePathRegex { ASSET_FILE_PATH_REGEX_STRING };
     return filePathRegex.exactMatch(filePath);
@@ -15,6 +15,7 @@
 #include <cstdint>
 
 #include <map>
+#include <vector>
 
 #include <QtCore/QByteArray>
 #include <QtCore/QUrl>
@@ -37,6 +38,9 @@ const QString ASSET_HASH_REGEX_STRING = QString("^[a-fA-F0-9]{%1}$").arg(SHA256_
 
 const QString HIDDEN_BAKED_CONTENT_FOLDER = "/.baked/";
 
+// the mappings of a GetAll operation come in pages, which each read the baking status of their assets
+const uint32_t MAX_MAPPINGS_PER_PAGE = 5000;
+
 enum AssetServerError : uint8_t {
     NoError = 0,
     AssetNotFound,
@@ -76,6 +80,21 @@ struct MappingInfo {
 using AssetMappings = std::map<AssetPath, MappingInfo>;
 using Mappings = std::map<AssetPath, AssetHash>;
 
+// A range of an asset whose bounds depend on its contents only, so an edit of a large asset leaves most of its
+// chunks the same and a client only downloads the ones it doesn't already have from another version.
+struct AssetChunk {
+    DataOffset offset;
+    DataOffset size;
+    QByteArray hash; // SHA-256 of the chunk, not in hex
+};
+
+using AssetChunks = std::vector<AssetChunk>;
+
+// assets smaller than this are a single chunk, and are always downloaded whole
+const DataOffset MIN_CHUNKED_ASSET_SIZE = 1024 * 1024;
+
+AssetChunks chunkData(const char* data, DataOffset size);
+
 QUrl getATPUrl(const QString& input);
 AssetHash extractAssetHash(const QString& input);
 
@@ -83,6 +102,7 @@ QByteArray hashData(const QByteArray& data);
 
 QByteArray loadFromCache(const QUrl& url);
 bool saveToCache(const QUrl& url, const QByteArray& file);
+void removeFromCache(const QUrl& url);
 
 bool isValidFilePath(const AssetPath& path);
 bool isValidPath(const AssetPath& path);
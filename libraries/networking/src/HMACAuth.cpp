@@ -15,9 +15,13 @@
 #include <openssl/hmac.h>
 
 #include <QUuid>
+#include <QtCore/QtEndian>
 #include "NetworkLogging.h"
 #include <cassert>
 
+static const int SIPHASH_KEY_SIZE = 16;
+static const int SIPHASH_HASH_SIZE = 16;
+
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
 HMACAuth::HMACAuth(AuthMethod authMethod)
     : _hmacContext(HMAC_CTX_new())
@@ -42,10 +46,35 @@ HMACAuth::~HMACAuth() {
 }
 #endif
 
+quint8 HMACAuth::getPacketAuthMethods() {
+    return (1 << MD5) | (1 << SIPHASH);
+}
+
+HMACAuth::AuthMethod HMACAuth::negotiatePacketAuthMethod(quint8 packetAuthMethodsA, quint8 packetAuthMethodsB) {
+    if (packetAuthMethodsA & packetAuthMethodsB & (1 << SIPHASH)) {
+        return SIPHASH;
+    }
+    return MD5;
+}
+
+void HMACAuth::setAuthMethod(AuthMethod authMethod) {
+    QMutexLocker lock(&_lock);
+    _authMethod = authMethod;
+    _sipHashData.clear();
+}
+
 bool HMACAuth::setKey(const char* keyValue, int keyLen) {
     const EVP_MD* sslStruct = nullptr;
 
     switch (_authMethod) {
+    case SIPHASH:
+        if (keyLen != SIPHASH_KEY_SIZE) {
+            return false;
+        }
+        _sipHashKey0 = qFromLittleEndian<quint64>(keyValue);
+        _sipHashKey1 = qFromLittleEndian<quint64>(keyValue + sizeof(quint64));
+        return true;
+
     case MD5:
         sslStruct = EVP_md5();
         break;
@@ -81,6 +110,10 @@ bool HMACAuth::setKey(const QUuid& uidKey) {
 
 bool HMACAuth::addData(const char* data, int dataLen) {
     QMutexLocker lock(&_lock);
+    if (_authMethod == SIPHASH) {
+        _sipHashData.append(data, dataLen);
+        return true;
+    }
     return (bool) HMAC_Update(_hmacContext, reinterpret_cast<const unsigned char*>(data), dataLen);
 }
 
@@ -88,6 +121,13 @@ HMACAuth::HMACHash HMACAuth::result() {
     HMACHash hashValue(EVP_MAX_MD_SIZE);
     unsigned int hashLen;
     QMutexLocker lock(&_lock);
+
+    if (_authMethod == SIPHASH) {
+        hashValue.resize(SIPHASH_HASH_SIZE);
+        calculateSipHash(_sipHashKey0, _sipHashKey1, _sipHashData.constData(), _sipHashData.size(), hashValue.data());
+        _sipHashData.clear();
+        return hashValue;
+    }
     
     auto hmacResult = HMAC_Final(_hmacContext, &hashValue[0], &hashLen);
     
@@ -105,6 +145,13 @@ HMACAuth::HMACHash HMACAuth::result() {
 }
 
 bool HMACAuth::calculateHash(HMACHash& hashResult, const char* data, int dataLen) {
+    if (_authMethod == SIPHASH) {
+        // the state is on the stack, any number of threads can sign and verify at once
+        hashResult.resize(SIPHASH_HASH_SIZE);
+        calculateSipHash(_sipHashKey0, _sipHashKey1, data, dataLen, hashResult.data());
+        return true;
+    }
+
     QMutexLocker lock(&_lock);
     if (!addData(data, dataLen)) {
         qCWarning(networking) << "Error occured calling HMACAuth::addData()";
@@ -115,3 +162,54 @@ bool HMACAuth::calculateHash(HMACHash& hashResult, const char* data, int dataLen
     hashResult = result();
     return true;
 }
+
+static inline quint64 rotateLeft(quint64 value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+static inline void sipRound(quint64& v0, quint64& v1, quint64& v2, quint64& v3) {
+    v0 += v1; v1 = rotateLeft(v1, 13); v1 ^= v0; v0 = rotateLeft(v0, 32);
+    v2 += v3; v3 = rotateLeft(v3, 16); v3 ^= v2;
+    v0 += v3; v3 = rotateLeft(v3, 21); v3 ^= v0;
+    v2 += v1; v1 = rotateLeft(v1, 17); v1 ^= v2; v2 = rotateLeft(v2, 32);
+}
+
+// SipHash-2-4 with its 128 bit output, see https://131002.net/siphash/
+void HMACAuth::calculateSipHash(quint64 key0, quint64 key1, const char* data, int dataLen, unsigned char* hashOut) {
+    quint64 v0 = 0x736f6d6570736575ULL ^ key0;
+    quint64 v1 = 0x646f72616e646f6dULL ^ key1 ^ 0xee;
+    quint64 v2 = 0x6c7967656e657261ULL ^ key0;
+    quint64 v3 = 0x7465646279746573ULL ^ key1;
+
+    const int numWords = dataLen / sizeof(quint64);
+    for (int i = 0; i < numWords; i++) {
+        quint64 word = qFromLittleEndian<quint64>(data + i * sizeof(quint64));
+        v3 ^= word;
+        sipRound(v0, v1, v2, v3);
+        sipRound(v0, v1, v2, v3);
+        v0 ^= word;
+    }
+
+    // the last word has the bytes that are left and the length in its top byte
+    quint64 lastWord = (quint64)dataLen << 56;
+    const unsigned char* tail = reinterpret_cast<const unsigned char*>(data) + numWords * sizeof(quint64);
+    for (int i = 0; i < dataLen % (int)sizeof(quint64); i++) {
+        lastWord |= (quint64)tail[i] << (i * 8);
+    }
+    v3 ^= lastWord;
+    sipRound(v0, v1, v2, v3);
+    sipRound(v0, v1, v2, v3);
+    v0 ^= lastWord;
+
+    v2 ^= 0xee;
+    for (int i = 0; i < 4; i++) {
+        sipRound(v0, v1, v2, v3);
+    }
+    qToLittleEndian<quint64>(v0 ^ v1 ^ v2 ^ v3, hashOut);
+
+    v1 ^= 0xdd;
+    for (int i = 0; i < 4; i++) {
+        sipRound(v0, v1, v2, v3);
+    }
+    qToLittleEndian<quint64>(v0 ^ v1 ^ v2 ^ v3, hashOut + sizeof(quint64));
+}
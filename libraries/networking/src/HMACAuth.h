@@ -12,20 +12,33 @@
 #ifndef hifi_HMACAuth_h
 #define hifi_HMACAuth_h
 
+#include <atomic>
 #include <vector>
 #include <memory>
+#include <QtCore/QByteArray>
 #include <QtCore/QMutex>
 
 class QUuid;
 
 class HMACAuth {
 public:
-    enum AuthMethod { MD5, SHA1, SHA224, SHA256, RIPEMD160 };
+    // SIPHASH is not an HMAC but the 128 bit SipHash-2-4 keyed hash, a MAC of the same size as MD5 that needs
+    // no OpenSSL context, so it is computed without locking.  Its key must be 16 bytes.
+    enum AuthMethod { MD5, SHA1, SHA224, SHA256, RIPEMD160, SIPHASH };
     using HMACHash = std::vector<unsigned char>;
     
     explicit HMACAuth(AuthMethod authMethod = MD5);
     ~HMACAuth();
 
+    // the methods that can sign packets, which have room for 16 bytes, as a mask of (1 << AuthMethod)
+    static quint8 getPacketAuthMethods();
+    // the fastest method both sides of a connection can sign packets with, MD5 when one doesn't say
+    static AuthMethod negotiatePacketAuthMethod(quint8 packetAuthMethodsA, quint8 packetAuthMethodsB);
+
+    AuthMethod getAuthMethod() const { return _authMethod; }
+    // the key must be set again after changing the method
+    void setAuthMethod(AuthMethod authMethod);
+
     bool setKey(const char* keyValue, int keyLen);
     bool setKey(const QUuid& uidKey);
     // Calculate complete hash in one.
@@ -39,9 +52,16 @@ public:
     HMACHash result();
 
 private:
+    static void calculateSipHash(quint64 key0, quint64 key1, const char* data, int dataLen, unsigned char* hashOut);
+
     QMutex _lock { QMutex::Recursive };
     struct hmac_ctx_st* _hmacContext;
-    AuthMethod _authMethod;
+    std::atomic<AuthMethod> _authMethod;
+
+    std::atomic<quint64> _sipHashKey0 { 0 };
+    std::atomic<quint64> _sipHashKey1 { 0 };
+    // what was passed to addData() with SIPHASH
+    QByteArray _sipHashData;
 };
 
 #endif  // hifi_HMACAuth_h
@@ -21,6 +21,7 @@
 
 #include "NetworkAccessManager.h"
 #include "NetworkLogging.h"
+#include "ResourceCache.h"
 
 HTTPResourceRequest::~HTTPResourceRequest() {
     if (_reply) {
@@ -73,6 +74,8 @@ void HTTPResourceRequest::doSend() {
         networkRequest.setRawHeader("Range", byteRange.toLatin1());
     }
     networkRequest.setAttribute(QNetworkRequest::HttpPipeliningAllowedAttribute, false);
+    // negotiated over tls, all the requests to the host then share one connection instead of queuing for one of six
+    networkRequest.setAttribute(QNetworkRequest::HTTP2AllowedAttribute, true);
 
     _reply = NetworkAccessManager::getInstance().get(networkRequest);
     
@@ -147,9 +150,21 @@ void HTTPResourceRequest::onRequestFinished() {
                 } else {
                     _rangeRequestSuccessful = false;
                     _totalSizeOfResource = _data.size();
+
+                    // the host sent the whole resource, keep the range that was asked for
+                    if (_byteRange.fromInclusive < 0) {
+                        _data = _data.right(-_byteRange.fromInclusive);
+                    } else {
+                        _data = _data.mid(_byteRange.fromInclusive, _byteRange.size());
+                    }
                 }
             }
 
+            if (_reply->attribute(QNetworkRequest::HTTP2WasUsedAttribute).toBool() &&
+                DependencyManager::isSet<ResourceCacheSharedItems>()) {
+                DependencyManager::get<ResourceCacheSharedItems>()->setOriginMultiplexed(_url);
+            }
+
             {
                 auto contentTypeHeader = _reply->rawHeader("Content-Type");
                 bool success;
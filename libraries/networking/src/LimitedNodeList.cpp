@@ -18,6 +18,7 @@
 #include <QtCore/QDataStream>
 #include <QtCore/QDebug>
 #include <QtCore/QJsonDocument>
+#include <QtCore/QMutex>
 #include <QtCore/QThread>
 #include <QtCore/QUrl>
 #include <QtNetwork/QTcpSocket>
@@ -243,8 +244,11 @@ bool LimitedNodeList::packetVersionMatch(const udt::Packet& packet) {
 
     if (headerVersion != versionForPacketType(headerType)) {
 
+        // packets can be verified on the socket's receive workers, see udt::Socket::setNumReceiveWorkers
+        static QMutex versionDebugSuppressMutex;
         static QMultiHash<QUuid, PacketType> sourcedVersionDebugSuppressMap;
         static QMultiHash<HifiSockAddr, PacketType> versionDebugSuppressMap;
+        QMutexLocker versionDebugSuppressLocker(&versionDebugSuppressMutex);
 
         bool hasBeenOutput = false;
         QString senderString;
@@ -356,7 +360,9 @@ bool LimitedNodeList::packetSourceAndHashMatchAndTrackBandwidth(const udt::Packe
 
                 // check if the HMAC-md5 hash in the header matches the hash we would expect
                 if (!sourceNodeHMACAuth || packetHeaderHash != expectedHash) {
+                    static QMutex hashDebugSuppressMutex;
                     static QMultiMap<QUuid, PacketType> hashDebugSuppressMap;
+                    QMutexLocker hashDebugSuppressLocker(&hashDebugSuppressMutex);
 
                     if (!hashDebugSuppressMap.contains(sourceID, headerType)) {
                         qCDebug(networking) << "Packet hash mismatch on" << headerType << "- Sender" << sourceID;
@@ -577,17 +583,38 @@ NodeData* LimitedNodeList::getOrCreateLinkedData(SharedNodePointer node) {
 }
 
 SharedNodePointer LimitedNodeList::nodeWithUUID(const QUuid& nodeUUID) {
-    QReadLocker readLocker(&_nodeMutex);
+    auto snapshot = getNodeSnapshot();
 
-    NodeHash::const_iterator it = _nodeHash.find(nodeUUID);
-    return it == _nodeHash.cend() ? SharedNodePointer() : it->second;
+    auto it = snapshot->nodesByUUID.find(nodeUUID);
+    return it == snapshot->nodesByUUID.cend() ? SharedNodePointer() : it->second;
  }
 
 SharedNodePointer LimitedNodeList::nodeWithLocalID(Node::LocalID localID) const {
-    QReadLocker readLocker(&_nodeMutex);
+    auto snapshot = getNodeSnapshot();
 
-    LocalIDMapping::const_iterator idIter = _localIDMap.find(localID);
-    return idIter == _localIDMap.cend() ? nullptr : idIter->second;
+    auto idIter = snapshot->nodesByLocalID.find(localID);
+    return idIter == snapshot->nodesByLocalID.cend() ? nullptr : idIter->second;
+}
+
+void LimitedNodeList::publishNodeSnapshot() {
+    std::lock_guard<std::mutex> lock(_nodeSnapshotMutex);
+
+    // rebuild from the hash rather than patching the previous snapshot,
+    // this is only paid when nodes come and go and keeps the snapshot exactly in sync with the hash
+    auto snapshot = std::make_shared<NodeSnapshot>();
+    snapshot->nodes.reserve(_nodeHash.size());
+    snapshot->nodesByUUID.reserve(_nodeHash.size());
+    for (const auto& pair : _nodeHash) {
+        snapshot->nodes.push_back(pair.second);
+        snapshot->nodesByUUID.insert({ pair.first, pair.second });
+    }
+
+    snapshot->nodesByLocalID.reserve(_localIDMap.size());
+    for (const auto& pair : _localIDMap) {
+        snapshot->nodesByLocalID.insert({ pair.first, pair.second });
+    }
+
+    std::atomic_store(&_nodeSnapshot, NodeSnapshotPointer(std::move(snapshot)));
 }
 
 void LimitedNodeList::eraseAllNodes(QString reason) {
@@ -608,6 +635,7 @@ void LimitedNodeList::eraseAllNodes(QString reason) {
         }
         _localIDMap.clear();
         _nodeHash.clear();
+        publishNodeSnapshot();
     }
 
     foreach(const SharedNodePointer& killedNode, killedNodes) {
@@ -633,6 +661,7 @@ bool LimitedNodeList::killNodeWithUUID(const QUuid& nodeUUID, ConnectionID newCo
             QWriteLocker writeLocker(&_nodeMutex);
             _localIDMap.unsafe_erase(matchingNode->getLocalID());
             _nodeHash.unsafe_erase(matchingNode->getUUID());
+            publishNodeSnapshot();
         }
 
         handleNodeKill(matchingNode, newConnectionID);
@@ -673,13 +702,14 @@ void LimitedNodeList::handleNodeKill(const SharedNodePointer& node, ConnectionID
 SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t nodeType,
                                                    const HifiSockAddr& publicSocket, const HifiSockAddr& localSocket,
                                                    Node::LocalID localID, bool isReplicated, bool isUpstream,
-                                                   const QUuid& connectionSecret, const NodePermissions& permissions) {
+                                                   const QUuid& connectionSecret, const NodePermissions& permissions,
+                                                   HMACAuth::AuthMethod authMethod) {
     auto matchingNode = nodeWithUUID(uuid);
     if (matchingNode) {
         matchingNode->setPublicSocket(publicSocket);
         matchingNode->setLocalSocket(localSocket);
         matchingNode->setPermissions(permissions);
-        matchingNode->setConnectionSecret(connectionSecret);
+        matchingNode->setConnectionSecret(connectionSecret, authMethod);
         matchingNode->setIsReplicated(isReplicated);
         matchingNode->setIsUpstream(isUpstream || NodeType::isUpstream(nodeType));
         matchingNode->setLocalID(localID);
@@ -693,6 +723,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
                 QWriteLocker writeLocker(&_nodeMutex);
                 _localIDMap.unsafe_erase(node->getLocalID());
                 _nodeHash.unsafe_erase(node->getUUID());
+                publishNodeSnapshot();
             }
             handleNodeKill(node);
         }
@@ -718,7 +749,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
     Node* newNode = new Node(uuid, nodeType, publicSocket, localSocket);
     newNode->setIsReplicated(isReplicated);
     newNode->setIsUpstream(isUpstream || NodeType::isUpstream(nodeType));
-    newNode->setConnectionSecret(connectionSecret);
+    newNode->setConnectionSecret(connectionSecret, authMethod);
     newNode->setPermissions(permissions);
     newNode->setLocalID(localID);
 
@@ -737,6 +768,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
         // insert the new node and release our read lock
         _nodeHash.insert({ newNode->getUUID(), newNodePointer });
         _localIDMap.insert({ localID, newNodePointer });
+        publishNodeSnapshot();
     }
 
     qCDebug(networking) << "Added" << *newNode;
@@ -774,7 +806,7 @@ void LimitedNodeList::addNewNode(NewNodeInfo info) {
 
     SharedNodePointer node = addOrUpdateNode(info.uuid, info.type, info.publicSocket, info.localSocket,
                                              info.sessionLocalID, info.isReplicated, false,
-                                             info.connectionSecretUUID, info.permissions);
+                                             info.connectionSecretUUID, info.permissions, info.authMethod);
 
     ++_nodesAddedInCurrentTimeSlice;
 }
@@ -1285,23 +1317,23 @@ void LimitedNodeList::sendPeerQueryToIceServer(const HifiSockAddr& iceServerSock
 }
 
 SharedNodePointer LimitedNodeList::findNodeWithAddr(const HifiSockAddr& addr) {
-    QReadLocker locker(&_nodeMutex);
-    auto it = std::find_if(std::begin(_nodeHash), std::end(_nodeHash), [&addr](const UUIDNodePair& pair) {
-        return pair.second->getPublicSocket() == addr
-            || pair.second->getLocalSocket() == addr
-            || pair.second->getSymmetricSocket() == addr;
+    auto snapshot = getNodeSnapshot();
+    auto it = std::find_if(snapshot->nodes.cbegin(), snapshot->nodes.cend(), [&addr](const SharedNodePointer& node) {
+        return node->getPublicSocket() == addr
+            || node->getLocalSocket() == addr
+            || node->getSymmetricSocket() == addr;
     });
-    return (it != std::end(_nodeHash)) ? it->second : SharedNodePointer();
+    return (it != snapshot->nodes.cend()) ? *it : SharedNodePointer();
 }
 
 bool LimitedNodeList::sockAddrBelongsToNode(const HifiSockAddr& sockAddr) {
-    QReadLocker locker(&_nodeMutex);
-    auto it = std::find_if(std::begin(_nodeHash), std::end(_nodeHash), [&sockAddr](const UUIDNodePair& pair) {
-        return pair.second->getPublicSocket() == sockAddr
-            || pair.second->getLocalSocket() == sockAddr
-            || pair.second->getSymmetricSocket() == sockAddr;
+    auto snapshot = getNodeSnapshot();
+    auto it = std::find_if(snapshot->nodes.cbegin(), snapshot->nodes.cend(), [&sockAddr](const SharedNodePointer& node) {
+        return node->getPublicSocket() == sockAddr
+            || node->getLocalSocket() == sockAddr
+            || node->getSymmetricSocket() == sockAddr;
     });
-    return it != std::end(_nodeHash);
+    return it != snapshot->nodes.cend();
 }
 
 void LimitedNodeList::sendPacketToIceServer(PacketType packetType, const HifiSockAddr& iceServerSockAddr,
@@ -104,8 +104,12 @@ void GetMappingRequest::doStart() {
 };
 
 void GetAllMappingsRequest::doStart() {
+    requestPage(AssetUtils::AssetPath());
+}
+
+void GetAllMappingsRequest::requestPage(const AssetUtils::AssetPath& startAfterPath) {
     auto assetClient = DependencyManager::get<AssetClient>();
-    _mappingRequestID = assetClient->getAllAssetMappings(
+    _mappingRequestID = assetClient->getAllAssetMappings(startAfterPath,
             [this, assetClient](bool responseReceived, AssetUtils::AssetServerError error, QSharedPointer<ReceivedMessage> message) {
 
         _mappingRequestID = INVALID_MESSAGE_ID;
@@ -127,8 +131,9 @@ void GetAllMappingsRequest::doStart() {
         if (!_error) {
             uint32_t numberOfMappings;
             message->readPrimitive(&numberOfMappings);
+            AssetUtils::AssetPath path;
             for (uint32_t i = 0; i < numberOfMappings; ++i) {
-                auto path = message->readString();
+                path = message->readString();
                 auto hash = message->read(AssetUtils::SHA256_HASH_LENGTH).toHex();
                 AssetUtils::BakingStatus status;
                 QString lastBakeErrors;
@@ -138,6 +143,13 @@ void GetAllMappingsRequest::doStart() {
                 }
                 _mappings[path] = { hash, status, lastBakeErrors };
             }
+
+            quint8 hasMoreMappings { false };
+            message->readPrimitive(&hasMoreMappings);
+            if (hasMoreMappings && numberOfMappings > 0) {
+                requestPage(path);
+                return;
+            }
         }
         emit finished(this);
     });
@@ -128,6 +128,9 @@ signals:
 private:
     virtual void doStart() override;
 
+    // the mappings after startAfterPath, empty for the first page
+    void requestPage(const AssetUtils::AssetPath& startAfterPath);
+
     AssetUtils::AssetMappings _mappings;
 };
 
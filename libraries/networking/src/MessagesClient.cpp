@@ -59,8 +59,15 @@ void MessagesClient::decodeMessagesPacket(QSharedPointer<ReceivedMessage> receiv
     }
 }
 
+QString MessagesClient::decodeMessagesChannel(QSharedPointer<ReceivedMessage> receivedMessage) {
+    quint16 channelLength;
+    receivedMessage->readPrimitive(&channelLength);
+    return QString::fromUtf8(receivedMessage->read(channelLength));
+}
+
 std::unique_ptr<NLPacketList> MessagesClient::encodeMessagesPacket(QString channel, QString message, QUuid senderID) {
     auto packetList = NLPacketList::create(PacketType::MessagesData, QByteArray(), true, true);
+    packetList->setPriorityWeight(udt::PacketList::LATENCY_SENSITIVE_PRIORITY_WEIGHT);
 
     auto channelUtf8 = channel.toUtf8();
     quint16 channelLength = channelUtf8.length();
@@ -82,6 +89,7 @@ std::unique_ptr<NLPacketList> MessagesClient::encodeMessagesPacket(QString chann
 
 std::unique_ptr<NLPacketList> MessagesClient::encodeMessagesDataPacket(QString channel, QByteArray data, QUuid senderID) {
     auto packetList = NLPacketList::create(PacketType::MessagesData, QByteArray(), true, true);
+    packetList->setPriorityWeight(udt::PacketList::LATENCY_SENSITIVE_PRIORITY_WEIGHT);
 
     auto channelUtf8 = channel.toUtf8();
     quint16 channelLength = channelUtf8.length();
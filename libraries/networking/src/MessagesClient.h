@@ -103,7 +103,8 @@ public:
      * @function Messages.sendData
      * @param {string} channel - The channel to send the data on.
      * @param {object} data - The data to send. The data is handled as a byte stream, for example, as may be provided via a 
-     *     JavaScript <code>Int8Array</code> object.
+     *     JavaScript <code>ArrayBuffer</code> object. A typed array or <code>DataView</code>, e.g., a 
+     *     <code>Float32Array</code>, sends the bytes it views without being converted.
      * @param {boolean} [localOnly=false] - If <code>false</code> then the message is sent to all Interface, client entity,
      *     server entity, and assignment client scripts in the domain.
      *     <p>If <code>true</code> then: if sent from an Interface or client entity script it is received by all Interface and
@@ -163,6 +164,8 @@ public:
 
     static void decodeMessagesPacket(QSharedPointer<ReceivedMessage> receivedMessage, QString& channel, 
                                            bool& isText, QString& message, QByteArray& data, QUuid& senderID);
+    // reads only the channel, which is at the start of the message
+    static QString decodeMessagesChannel(QSharedPointer<ReceivedMessage> receivedMessage);
 
     static std::unique_ptr<NLPacketList> encodeMessagesPacket(QString channel, QString message, QUuid senderID);
     static std::unique_ptr<NLPacketList> encodeMessagesDataPacket(QString channel, QByteArray data, QUuid senderID);
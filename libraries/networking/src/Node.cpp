@@ -207,13 +207,16 @@ QDebug operator<<(QDebug debug, const Node& node) {
     return debug.nospace();
 }
 
-void Node::setConnectionSecret(const QUuid& connectionSecret) {
-    if (_connectionSecret == connectionSecret) {
+void Node::setConnectionSecret(const QUuid& connectionSecret, HMACAuth::AuthMethod authMethod) {
+    if (_connectionSecret == connectionSecret && _authenticateHash && _authenticateHash->getAuthMethod() == authMethod) {
         return;
     }
 
     if (!_authenticateHash) {
-        _authenticateHash.reset(new HMACAuth());
+        _authenticateHash.reset(new HMACAuth(authMethod));
+    } else if (_authenticateHash->getAuthMethod() != authMethod) {
+        // the hash is in use by the threads that send and receive, it is switched over rather than replaced
+        _authenticateHash->setAuthMethod(authMethod);
     }
 
     _connectionSecret = connectionSecret;
@@ -457,6 +457,9 @@ void NodeList::sendDomainServerCheckIn() {
 
             packetStream << previousConnectionUptime;
 
+            // the domain-server picks how we sign the packets to each node from what both of us can do
+            packetStream << HMACAuth::getPacketAuthMethods();
+
         }
 
         packetStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
@@ -820,6 +823,11 @@ void NodeList::parseNodeFromPacketStream(QDataStream& packetStream) {
                  >> info.sessionLocalID
                  >> info.connectionSecretUUID;
 
+    quint8 authMethod;
+    packetStream >> authMethod;
+    // only the methods that can sign packets
+    info.authMethod = authMethod == HMACAuth::SIPHASH ? HMACAuth::SIPHASH : HMACAuth::MD5;
+
     // if the public socket address is 0 then it's reachable at the same IP
     // as the domain server
     if (info.publicSocket.getAddress().isNull()) {
@@ -0,0 +1,38 @@
+//
+//  PacketProcessingStats.cpp
+//  libraries/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketProcessingStats.h"
+
+#include <QtCore/QMetaEnum>
+
+QJsonObject PacketProcessingStats::sample() {
+    QMetaObject metaObject = PacketTypeEnum::staticMetaObject;
+    QMetaEnum metaEnum = metaObject.enumerator(metaObject.enumeratorOffset());
+
+    QJsonObject statsObject;
+    for (size_t i = 0; i < _stats.size(); ++i) {
+        uint32_t numQueueWaits;
+        auto queueWaitObject = _stats[i].queueWait.sample(numQueueWaits);
+
+        uint32_t numHandled;
+        auto handlerTimeObject = _stats[i].handlerTime.sample(numHandled);
+
+        if (numHandled > 0) {
+            QJsonObject typeObject;
+            typeObject["num_handled"] = (double)numHandled;
+            if (numQueueWaits > 0) {
+                typeObject["queue_wait"] = queueWaitObject;
+            }
+            typeObject["handler_time"] = handlerTimeObject;
+            statsObject[metaEnum.valueToKey((int)i)] = typeObject;
+        }
+    }
+    return statsObject;
+}
@@ -0,0 +1,42 @@
+//
+//  PacketProcessingStats.h
+//  libraries/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PacketProcessingStats_h
+#define hifi_PacketProcessingStats_h
+
+#include <array>
+
+#include <QtCore/QJsonObject>
+
+#include <LatencyHistogram.h>
+
+#include "udt/PacketHeaders.h"
+
+// Per packet type latency histograms of the messages dispatched by PacketReceiver.
+//   Queue wait runs from the receipt of the first packet of a message to the start of its listener,
+//   handler time covers the listener itself. Recording is done on whichever thread runs the listener.
+class PacketProcessingStats {
+public:
+    void recordQueueWait(PacketType type, quint64 usecs) { _stats[(uint8_t)type].queueWait.record(usecs); }
+    void recordHandlerTime(PacketType type, quint64 usecs) { _stats[(uint8_t)type].handlerTime.record(usecs); }
+
+    // the histograms of every packet type that was dispatched since the last call, keyed by packet type name
+    QJsonObject sample();
+
+private:
+    struct TypeStats {
+        LatencyHistogram queueWait;
+        LatencyHistogram handlerTime;
+    };
+
+    std::array<TypeStats, (size_t)PacketType::NUM_PACKET_TYPE> _stats;
+};
+
+#endif // hifi_PacketProcessingStats_h
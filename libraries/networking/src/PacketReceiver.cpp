@@ -12,7 +12,13 @@
 
 #include "PacketReceiver.h"
 
+#include <chrono>
+
 #include <QMutexLocker>
+#include <QThread>
+
+#include <PortableHighResolutionClock.h>
+#include <Profile.h>
 
 #include "DependencyManager.h"
 #include "NetworkLogging.h"
@@ -250,6 +256,36 @@ void PacketReceiver::handleMessageFailure(HifiSockAddr from, udt::Packet::Messag
     }
 }
 
+static bool invokeListenerMethod(QObject* object, const QMetaMethod& metaMethod, Qt::ConnectionType connectionType,
+                                 const QSharedPointer<ReceivedMessage>& receivedMessage, const SharedNodePointer& matchingNode) {
+    static const QByteArray QSHAREDPOINTER_NODE_NORMALIZED = QMetaObject::normalizedType("QSharedPointer<Node>");
+    static const QByteArray SHARED_NODE_NORMALIZED = QMetaObject::normalizedType("SharedNodePointer");
+
+    if (metaMethod.parameterTypes().contains(SHARED_NODE_NORMALIZED)) {
+        return metaMethod.invoke(object,
+                                 connectionType,
+                                 Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
+                                 Q_ARG(SharedNodePointer, matchingNode));
+
+    } else if (metaMethod.parameterTypes().contains(QSHAREDPOINTER_NODE_NORMALIZED)) {
+        return metaMethod.invoke(object,
+                                 connectionType,
+                                 Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
+                                 Q_ARG(QSharedPointer<Node>, matchingNode));
+
+    } else {
+        return metaMethod.invoke(object,
+                                 connectionType,
+                                 Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage));
+    }
+}
+
+static quint64 usecsSinceClockEpoch() {
+    using namespace std::chrono;
+    // the same clock and epoch as the receive times of packets
+    return duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count();
+}
+
 void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> receivedMessage, bool justReceived) {
     auto nodeList = DependencyManager::get<LimitedNodeList>();
     
@@ -280,27 +316,39 @@ void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> recei
 
         QMetaMethod metaMethod = listener.method;
 
-        static const QByteArray QSHAREDPOINTER_NODE_NORMALIZED = QMetaObject::normalizedType("QSharedPointer<Node>");
-        static const QByteArray SHARED_NODE_NORMALIZED = QMetaObject::normalizedType("SharedNodePointer");
-
         // one final check on the QPointer before we go to invoke
         if (listener.object) {
-            if (metaMethod.parameterTypes().contains(SHARED_NODE_NORMALIZED)) {
-                success = metaMethod.invoke(listener.object,
-                                            connectionType,
-                                            Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
-                                            Q_ARG(SharedNodePointer, matchingNode));
-
-            } else if (metaMethod.parameterTypes().contains(QSHAREDPOINTER_NODE_NORMALIZED)) {
-                success = metaMethod.invoke(listener.object,
-                                            connectionType,
-                                            Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage),
-                                            Q_ARG(QSharedPointer<Node>, matchingNode));
-
+            // time the listener where it runs, so that queued listeners include their wait in their thread's event queue
+            QPointer<QObject> object = listener.object;
+            auto processingStats = _processingStats;
+            auto invokeAndRecord = [object, metaMethod, receivedMessage, matchingNode, processingStats]() -> bool {
+                if (!object) {
+                    return false;
+                }
+
+                auto type = receivedMessage->getType();
+                PROFILE_RANGE(network, nameForPacketType(type));
+                auto handlerStart = usecsSinceClockEpoch();
+                auto firstPacketReceiveTime = receivedMessage->getFirstPacketReceiveTime();
+                if (firstPacketReceiveTime > 0 && handlerStart >= (quint64)firstPacketReceiveTime) {
+                    processingStats->recordQueueWait(type, handlerStart - firstPacketReceiveTime);
+                }
+
+                bool success = invokeListenerMethod(object, metaMethod, Qt::DirectConnection, receivedMessage, matchingNode);
+
+                processingStats->recordHandlerTime(type, usecsSinceClockEpoch() - handlerStart);
+                return success;
+            };
+
+            if (connectionType == Qt::DirectConnection || listener.object->thread() == QThread::currentThread()) {
+                success = invokeAndRecord();
             } else {
-                success = metaMethod.invoke(listener.object,
-                                            connectionType,
-                                            Q_ARG(QSharedPointer<ReceivedMessage>, receivedMessage));
+                auto type = receivedMessage->getType();
+                success = QMetaObject::invokeMethod(listener.object, [invokeAndRecord, type]() {
+                    if (!invokeAndRecord()) {
+                        qCDebug(networking).nospace() << "Error delivering queued packet " << type << " to listener";
+                    }
+                }, Qt::QueuedConnection);
             }
         } else {
             qCDebug(networking).nospace() << "Listener for packet " << receivedMessage->getType()
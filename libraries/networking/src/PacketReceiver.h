@@ -13,6 +13,7 @@
 #ifndef hifi_PacketReceiver_h
 #define hifi_PacketReceiver_h
 
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
@@ -25,6 +26,7 @@
 
 #include "NLPacket.h"
 #include "NLPacketList.h"
+#include "PacketProcessingStats.h"
 #include "ReceivedMessage.h"
 #include "udt/PacketHeaders.h"
 
@@ -62,6 +64,9 @@ public:
     void handleVerifiedPacket(std::unique_ptr<udt::Packet> packet);
     void handleVerifiedMessagePacket(std::unique_ptr<udt::Packet> message);
     void handleMessageFailure(HifiSockAddr from, udt::Packet::MessageNumber messageNumber);
+
+    // per packet type queue wait and handler time histograms since the last call
+    QJsonObject sampleProcessingStats() { return _processingStats->sample(); }
     
 private:
     struct Listener {
@@ -88,6 +93,9 @@ private:
     QSet<QObject*> _directlyConnectedObjects;
 
     std::unordered_map<std::pair<HifiSockAddr, udt::Packet::MessageNumber>, QSharedPointer<ReceivedMessage>> _pendingMessages;
+
+    // shared with the listener invocations queued to other threads
+    std::shared_ptr<PacketProcessingStats> _processingStats { std::make_shared<PacketProcessingStats>() };
     
     friend class EntityEditPacketSender;
     friend class OctreePacketProcessor;
@@ -77,6 +77,17 @@ void ReceivedMessage::appendPacket(NLPacket& packet) {
 
     ++_numPackets;
 
+    qint64 payloadOffset = _expectedPayloadOffset.exchange(-1);
+    if (payloadOffset >= _dataOffset && payloadOffset <= getSize()) {
+        // move what we have of the payload to a buffer allocated once for all of it,
+        // so that the rest of the message is not copied again as our buffer grows
+        QByteArray payload;
+        payload.reserve((int)(_expectedPayloadSize + packet.getPayloadSize()));
+        payload.append(_data.constData() + (payloadOffset - _dataOffset), (int)(getSize() - payloadOffset));
+        _data = payload;
+        _dataOffset = payloadOffset;
+    }
+
     _data.append(packet.getPayload(), packet.getPayloadSize());
 
     if (_numPackets % EMIT_PROGRESS_EVERY_X_PACKETS == 0) {
@@ -95,17 +106,29 @@ void ReceivedMessage::appendPacket(NLPacket& packet) {
     }
 }
 
+void ReceivedMessage::expectBytesLeftToRead(qint64 size) {
+    // picked up by appendPacket, on the thread receiving the message
+    _expectedPayloadSize = size;
+    _expectedPayloadOffset = _position.load();
+}
+
+const char* ReceivedMessage::dataAtPosition() const {
+    Q_ASSERT_X(_position >= _dataOffset, "ReceivedMessage::dataAtPosition",
+               "Bytes before the expected payload can only be read with readHead");
+    return _data.constData() + (_position - _dataOffset);
+}
+
 qint64 ReceivedMessage::peek(char* data, qint64 size) {
-    size_t bytesLeft = _data.size() - _position;
+    size_t bytesLeft = getBytesLeftToRead();
     size_t sizeRead = std::min((size_t)size, bytesLeft);
-    memcpy(data, _data.constData() + _position, sizeRead);
+    memcpy(data, dataAtPosition(), sizeRead);
     return sizeRead;
 }
 
 qint64 ReceivedMessage::read(char* data, qint64 size) {
-    size_t bytesLeft = _data.size() - _position;
+    size_t bytesLeft = getBytesLeftToRead();
     size_t sizeRead = std::min((size_t)size, bytesLeft);
-    memcpy(data, _data.constData() + _position, sizeRead);
+    memcpy(data, dataAtPosition(), sizeRead);
     _position += sizeRead;
     return sizeRead;
 }
@@ -119,11 +142,12 @@ qint64 ReceivedMessage::readHead(char* data, qint64 size) {
 }
 
 QByteArray ReceivedMessage::peek(qint64 size) {
-    return _data.mid(_position, size);
+    return _data.mid(_position - _dataOffset, size);
 }
 
 QByteArray ReceivedMessage::read(qint64 size) {
-    auto data = _data.mid(_position, size);
+    // when the read covers all of _data, as readAll does after expectBytesLeftToRead, this shares it without a copy
+    auto data = _data.mid(_position - _dataOffset, size);
     _position += size;
     return data;
 }
@@ -142,13 +166,13 @@ QString ReceivedMessage::readString() {
     uint32_t size;
     readPrimitive(&size);
     //Q_ASSERT(size <= _size - _position);
-    auto string = QString::fromUtf8(_data.constData() + _position, size);
+    auto string = QString::fromUtf8(dataAtPosition(), size);
     _position += size;
     return string;
 }
 
 QByteArray ReceivedMessage::readWithoutCopy(qint64 size) {
-    QByteArray data { QByteArray::fromRawData(_data.constData() + _position, size) };
+    QByteArray data { QByteArray::fromRawData(dataAtPosition(), size) };
     _position += size;
     return data;
 }
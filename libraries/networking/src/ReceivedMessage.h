@@ -27,6 +27,7 @@ public:
     ReceivedMessage(QByteArray byteArray, PacketType packetType, PacketVersion packetVersion,
                     const HifiSockAddr& senderSockAddr, NLPacket::LocalID sourceID = NLPacket::NULL_LOCAL_ID);
 
+    // Once expectBytesLeftToRead has taken effect these only hold the expected payload
     QByteArray getMessage() const { return _data; }
     const char* getRawMessage() const { return _data.constData(); }
 
@@ -37,6 +38,11 @@ public:
 
     void appendPacket(NLPacket& packet);
 
+    // Hint, while the message is still being received, that it has size bytes left after the current position.
+    // The packets still to come are then reassembled into a buffer preallocated for exactly that payload,
+    // which readAll() hands out without copying. Bytes before the current position remain available through readHead.
+    void expectBytesLeftToRead(qint64 size);
+
     bool failed() const { return _failed; }
     bool isComplete() const { return _isComplete; }
 
@@ -50,9 +56,9 @@ public:
 
     qint64 getFirstPacketReceiveTime() const { return _firstPacketReceiveTime; }
 
-    qint64 getSize() const { return _data.size(); }
+    qint64 getSize() const { return _dataOffset + _data.size(); }
 
-    qint64 getBytesLeftToRead() const { return _data.size() -  _position; }
+    qint64 getBytesLeftToRead() const { return getSize() -  _position; }
 
     void seek(qint64 position) { _position = position; }
 
@@ -89,9 +95,15 @@ private slots:
     void onComplete();
 
 private:
+    const char* dataAtPosition() const;
+
     QByteArray _data;
     QByteArray _headData;
 
+    qint64 _dataOffset { 0 }; // position in the message of the first byte of _data
+    std::atomic<qint64> _expectedPayloadOffset { -1 };
+    std::atomic<qint64> _expectedPayloadSize { 0 };
+
     std::atomic<qint64> _position { 0 };
     std::atomic<qint64> _numPackets { 0 };
     std::atomic<quint64> _firstPacketReceiveTime { 0 };
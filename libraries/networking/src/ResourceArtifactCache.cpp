@@ -0,0 +1,77 @@
+//
+//  ResourceArtifactCache.cpp
+//  libraries/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ResourceArtifactCache.h"
+
+#include <QtCore/QCryptographicHash>
+
+#include <SettingHandle.h>
+
+const int ResourceArtifactCache::CURRENT_VERSION = 0x01;
+const int ResourceArtifactCache::INVALID_VERSION = 0x00;
+const char* ResourceArtifactCache::SETTING_VERSION_NAME = "hifi.artifact.cache_version";
+
+ResourceArtifactCache::ResourceArtifactCache(const std::string& dir, const std::string& ext) :
+    FileCache(dir, ext) { }
+
+void ResourceArtifactCache::initialize() {
+    FileCache::initialize();
+    Setting::Handle<int> cacheVersionHandle(SETTING_VERSION_NAME, INVALID_VERSION);
+    auto cacheVersion = cacheVersionHandle.get();
+    if (cacheVersion != CURRENT_VERSION) {
+        wipe();
+        cacheVersionHandle.set(CURRENT_VERSION);
+    }
+}
+
+cache::FileCache::Key ResourceArtifactCache::getArtifactKey(const QByteArray& content, const QString& artifactType) {
+    // the key is also the file name, and the cache only keeps what comes before the first dot of it
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(artifactType.toUtf8());
+    hash.addData(content);
+    return hash.result().toHex().toStdString();
+}
+
+bool ResourceArtifactCache::readArtifact(const Key& key, QByteArray& artifact) {
+    auto file = getFile(key);
+    if (!file) {
+        return false;
+    }
+
+    QFile artifactFile(file->getFilepath().c_str());
+    if (!artifactFile.open(QIODevice::ReadOnly) || artifactFile.size() != (qint64)file->getLength()) {
+        return false;
+    }
+    artifact = artifactFile.readAll();
+    return artifact.size() == (int)file->getLength();
+}
+
+std::shared_ptr<QFile> ResourceArtifactCache::mapArtifact(const Key& key, QByteArray& artifact) {
+    auto file = getFile(key);
+    if (!file || file->getLength() == 0) {
+        return std::shared_ptr<QFile>();
+    }
+
+    auto artifactFile = std::make_shared<QFile>(file->getFilepath().c_str());
+    if (!artifactFile->open(QIODevice::ReadOnly) || artifactFile->size() != (qint64)file->getLength()) {
+        return std::shared_ptr<QFile>();
+    }
+    auto bytes = artifactFile->map(0, artifactFile->size());
+    if (!bytes) {
+        return std::shared_ptr<QFile>();
+    }
+    artifact = QByteArray::fromRawData(reinterpret_cast<const char*>(bytes), (int)artifactFile->size());
+    return artifactFile;
+}
+
+void ResourceArtifactCache::writeArtifact(const Key& key, const QByteArray& artifact) {
+    // the cache keeps the file for the next sessions once it is released
+    writeFile(artifact.constData(), Metadata(key, artifact.size()));
+}
@@ -0,0 +1,46 @@
+//
+//  ResourceArtifactCache.h
+//  libraries/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ResourceArtifactCache_h
+#define hifi_ResourceArtifactCache_h
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+#include <shared/FileCache.h>
+
+// Keeps what the resource caches make out of downloaded content, such as decoded audio, on disk across sessions.
+// Artifacts are keyed by a hash of the content they were made from, so the same content under another url is a hit,
+// and changed content at the same url a miss.
+class ResourceArtifactCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    // Whenever a change is made to the way artifacts are keyed that isn't backward compatible,
+    // this value should be incremented.  This will force the artifact cache to be wiped
+    static const int CURRENT_VERSION;
+    static const int INVALID_VERSION;
+    static const char* SETTING_VERSION_NAME;
+
+    ResourceArtifactCache(const std::string& dir, const std::string& ext);
+
+    void initialize() override;
+
+    // the artifact type names the format of the artifact, and should change whenever that format does
+    static Key getArtifactKey(const QByteArray& content, const QString& artifactType);
+
+    bool readArtifact(const Key& key, QByteArray& artifact);
+    // for the large artifacts that are parsed right away, the artifact bytes are only valid while the mapped file is kept
+    std::shared_ptr<QFile> mapArtifact(const Key& key, QByteArray& artifact);
+    void writeArtifact(const Key& key, const QByteArray& artifact);
+};
+
+#endif // hifi_ResourceArtifactCache_h
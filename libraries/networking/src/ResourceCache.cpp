@@ -12,6 +12,7 @@
 #include "ResourceCache.h"
 #include "ResourceRequestObserver.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <assert.h>
@@ -20,6 +21,7 @@
 #include <QTimer>
 
 #include <SharedUtil.h>
+#include <shared/FrameBudget.h>
 #include <shared/QtHelpers.h>
 #include <Trace.h>
 #include <Profile.h>
@@ -28,17 +30,121 @@
 #include "NetworkLogging.h"
 #include "NodeList.h"
 
+static const std::string ARTIFACT_CACHE_DIRNAME = "artifact_cache";
+static const std::string ARTIFACT_CACHE_EXT = "bin";
+
+// an http/1.1 host serves about this many requests at once before queuing them itself, as browsers assume
+static const uint32_t DEFAULT_HTTP_HOST_REQUEST_LIMIT = 6;
+
+ResourceCacheSharedItems::ResourceCacheSharedItems() {
+    _schemeRequestLimits.insert(HIFI_URL_SCHEME_HTTP, DEFAULT_HTTP_HOST_REQUEST_LIMIT);
+    _schemeRequestLimits.insert(HIFI_URL_SCHEME_HTTPS, DEFAULT_HTTP_HOST_REQUEST_LIMIT);
+}
+
+bool ResourceCacheSharedItems::PendingKey::operator<(const PendingKey& other) const {
+    if (isFile != other.isFile) {
+        return isFile;
+    }
+    if (priority != other.priority) {
+        return priority > other.priority;
+    }
+    return sequence > other.sequence;
+}
+
+QString ResourceCacheSharedItems::getRequestOrigin(const QUrl& url) {
+    // atp urls have no host, they all go to the asset server of the domain
+    return url.scheme() + "://" + url.authority(QUrl::RemoveUserInfo);
+}
+
+ResourceCacheSharedItems::Origins::iterator ResourceCacheSharedItems::findOrigin(const QUrl& url) {
+    QString name = getRequestOrigin(url);
+    auto origin = _origins.find(name);
+    if (origin == _origins.end()) {
+        origin = _origins.insert(name, Origin());
+        origin->scheme = url.scheme();
+        origin->multiplexed = _multiplexedOrigins.contains(name);
+    }
+    return origin;
+}
+
+void ResourceCacheSharedItems::insertPendingRequest(const QSharedPointer<Resource>& resource, Origins::iterator origin,
+                                                    uint64_t sequence) {
+    PendingKey key { resource->getURL().scheme() == HIFI_URL_SCHEME_FILE, resource->getLoadPriority(), sequence };
+    auto position = origin->pending.insert({ key, resource }).first;
+    _pendingRequests.insert(resource.data(), { origin.key(), position });
+}
+
+void ResourceCacheSharedItems::erasePendingRequest(PendingRequests::iterator request) {
+    auto origin = _origins.find(request->origin);
+    if (origin != _origins.end()) {
+        origin->pending.erase(request->position);
+        releaseOrigin(origin);
+    }
+    _pendingRequests.erase(request);
+}
+
+void ResourceCacheSharedItems::releaseOrigin(Origins::iterator origin) {
+    if (origin->pending.empty() && origin->loading == 0) {
+        _origins.erase(origin);
+    }
+}
+
+uint32_t ResourceCacheSharedItems::getOriginRequestLimit(const Origin& origin) const {
+    if (origin.multiplexed) {
+        return _requestLimit;
+    }
+    return std::min(_schemeRequestLimits.value(origin.scheme, _requestLimit), _requestLimit);
+}
+
 bool ResourceCacheSharedItems::appendRequest(QWeakPointer<Resource> resource) {
     Lock lock(_mutex);
-    if ((uint32_t)_loadingRequests.size() < _requestLimit) {
-        _loadingRequests.append(resource);
+    auto locked = resource.lock();
+    if (!locked) {
+        return false;
+    }
+
+    // a freed resource may have left its pending request at the same address
+    auto pending = _pendingRequests.find(locked.data());
+    if (pending != _pendingRequests.end()) {
+        if (pending->position->second.lock() == locked) {
+            return false;
+        }
+        erasePendingRequest(pending);
+    }
+
+    auto origin = findOrigin(locked->getURL());
+    if ((uint32_t)_loadingRequests.size() < _requestLimit && origin->loading < getOriginRequestLimit(*origin)) {
+        origin->loading++;
+        _loadingRequests.append({ resource, origin.key() });
         return true;
     } else {
-        _pendingRequests.append(resource);
+        insertPendingRequest(locked, origin, _nextSequence++);
         return false;
     }
 }
 
+void ResourceCacheSharedItems::updatePendingRequest(QWeakPointer<Resource> resource) {
+    Lock lock(_mutex);
+    auto pending = _pendingRequests.find(resource.data());
+    if (pending == _pendingRequests.end()) {
+        return;
+    }
+    auto locked = pending->position->second.lock();
+    if (!locked) {
+        return;
+    }
+
+    // move the request to its new place, after the requests of the same priority that came before it
+    float priority = locked->getLoadPriority();
+    PendingKey key = pending->position->first;
+    if (priority != key.priority) {
+        auto origin = _origins.find(pending->origin);
+        origin->pending.erase(pending->position);
+        _pendingRequests.erase(pending);
+        insertPendingRequest(locked, origin, key.sequence);
+    }
+}
+
 void ResourceCacheSharedItems::setRequestLimit(uint32_t limit) {
     Lock lock(_mutex);
     _requestLimit = limit;
@@ -49,12 +155,32 @@ uint32_t ResourceCacheSharedItems::getRequestLimit() const {
     return _requestLimit;
 }
 
+void ResourceCacheSharedItems::setSchemeRequestLimit(const QString& scheme, uint32_t limit) {
+    Lock lock(_mutex);
+    _schemeRequestLimits.insert(scheme, limit);
+}
+
+uint32_t ResourceCacheSharedItems::getSchemeRequestLimit(const QString& scheme) const {
+    Lock lock(_mutex);
+    return std::min(_schemeRequestLimits.value(scheme, _requestLimit), _requestLimit);
+}
+
+void ResourceCacheSharedItems::setOriginMultiplexed(const QUrl& url) {
+    Lock lock(_mutex);
+    QString name = getRequestOrigin(url);
+    _multiplexedOrigins.insert(name);
+    auto origin = _origins.find(name);
+    if (origin != _origins.end()) {
+        origin->multiplexed = true;
+    }
+}
+
 QList<QSharedPointer<Resource>> ResourceCacheSharedItems::getPendingRequests() const {
     QList<QSharedPointer<Resource>> result;
     Lock lock(_mutex);
 
-    foreach (QWeakPointer<Resource> resource, _pendingRequests) {
-        auto locked = resource.lock();
+    foreach (const PendingRequest& request, _pendingRequests) {
+        auto locked = request.position->second.lock();
         if (locked) {
             result.append(locked);
         }
@@ -72,8 +198,8 @@ QList<QSharedPointer<Resource>> ResourceCacheSharedItems::getLoadingRequests() c
     QList<QSharedPointer<Resource>> result;
     Lock lock(_mutex);
 
-    foreach(QWeakPointer<Resource> resource, _loadingRequests) {
-        auto locked = resource.lock();
+    foreach(const LoadingRequest& request, _loadingRequests) {
+        auto locked = request.resource.lock();
         if (locked) {
             result.append(locked);
         }
@@ -87,6 +213,17 @@ uint32_t ResourceCacheSharedItems::getLoadingRequestsCount() const {
     return _loadingRequests.size();
 }
 
+QList<ResourceCacheSharedItems::OriginStats> ResourceCacheSharedItems::getOriginStats() const {
+    QList<OriginStats> result;
+    Lock lock(_mutex);
+
+    for (auto origin = _origins.begin(); origin != _origins.end(); ++origin) {
+        result.append({ origin.key(), (uint32_t)origin->pending.size(), origin->loading, getOriginRequestLimit(*origin) });
+    }
+
+    return result;
+}
+
 void ResourceCacheSharedItems::removeRequest(QWeakPointer<Resource> resource) {
     Lock lock(_mutex);
 
@@ -94,9 +231,14 @@ void ResourceCacheSharedItems::removeRequest(QWeakPointer<Resource> resource) {
     // QWeakPointer has no operator== implementation for two weak ptrs, so
     // manually loop in case resource has been freed.
     for (int i = 0; i < _loadingRequests.size();) {
-        auto request = _loadingRequests.at(i);
+        const auto& request = _loadingRequests.at(i);
         // Clear our resource and any freed resources
-        if (!request || request.data() == resource.data()) {
+        if (!request.resource || request.resource.data() == resource.data()) {
+            auto origin = _origins.find(request.origin);
+            if (origin != _origins.end()) {
+                origin->loading--;
+                releaseOrigin(origin);
+            }
             _loadingRequests.removeAt(i);
             continue;
         }
@@ -105,43 +247,61 @@ void ResourceCacheSharedItems::removeRequest(QWeakPointer<Resource> resource) {
 }
 
 QSharedPointer<Resource> ResourceCacheSharedItems::getHighestPendingRequest() {
-    // look for the highest priority pending request
-    int highestIndex = -1;
-    float highestPriority = -FLT_MAX;
-    QSharedPointer<Resource> highestResource;
     Lock lock(_mutex);
 
-    bool currentHighestIsFile = false;
+    while (true) {
+        // the highest priority request among the origins that are below their limit
+        auto highestOrigin = _origins.end();
+        for (auto origin = _origins.begin(); origin != _origins.end(); ++origin) {
+            if (origin->pending.empty() || origin->loading >= getOriginRequestLimit(*origin)) {
+                continue;
+            }
+            if (highestOrigin == _origins.end() || origin->pending.begin()->first < highestOrigin->pending.begin()->first) {
+                highestOrigin = origin;
+            }
+        }
+        if (highestOrigin == _origins.end()) {
+            return QSharedPointer<Resource>();
+        }
+
+        auto position = highestOrigin->pending.begin();
+        PendingKey key = position->first;
+        auto resource = position->second.lock();
 
-    for (int i = 0; i < _pendingRequests.size();) {
-        // Clear any freed resources
-        auto resource = _pendingRequests.at(i).lock();
+        // Clear any freed resources, their address may already be pending again
+        auto request = _pendingRequests.find(position->second.data());
+        if (request != _pendingRequests.end() && request->position == position) {
+            _pendingRequests.erase(request);
+        }
+        highestOrigin->pending.erase(position);
         if (!resource) {
-            _pendingRequests.removeAt(i);
+            releaseOrigin(highestOrigin);
             continue;
         }
 
-        // Check load priority
-        float priority = resource->getLoadPriority();
-        bool isFile = resource->getURL().scheme() == HIFI_URL_SCHEME_FILE;
-        if (priority >= highestPriority && (isFile || !currentHighestIsFile)) {
-            highestPriority = priority;
-            highestIndex = i;
-            highestResource = resource;
-            currentHighestIsFile = isFile;
+        // the owners that went away without clearing their priority are only noticed here
+        if (resource->getLoadPriority() != key.priority) {
+            insertPendingRequest(resource, highestOrigin, key.sequence);
+            continue;
         }
-        i++;
-    }
 
-    if (highestIndex >= 0) {
-        _pendingRequests.takeAt(highestIndex);
+        releaseOrigin(highestOrigin);
+        return resource;
     }
+}
 
-    return highestResource;
+std::shared_ptr<ResourceArtifactCache> ResourceCacheSharedItems::getArtifactCache() {
+    Lock lock(_mutex);
+    if (!_artifactCache) {
+        _artifactCache = std::make_shared<ResourceArtifactCache>(ARTIFACT_CACHE_DIRNAME, ARTIFACT_CACHE_EXT);
+        _artifactCache->initialize();
+    }
+    return _artifactCache;
 }
 
 void ResourceCacheSharedItems::clear() {
     Lock lock(_mutex);
+    _origins.clear();
     _pendingRequests.clear();
     _loadingRequests.clear();
 }
@@ -344,8 +504,16 @@ void ResourceCache::setRequestLimit(uint32_t limit) {
     sharedItems->setRequestLimit(limit);
 
     // Now go fill any new request spots
-    while (sharedItems->getLoadingRequestsCount() < limit && sharedItems->getPendingRequestsCount() > 0) {
-        attemptHighestPriorityRequest();
+    while (sharedItems->getLoadingRequestsCount() < limit && attemptHighestPriorityRequest()) {
+    }
+}
+
+void ResourceCache::setSchemeRequestLimit(const QString& scheme, uint32_t limit) {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    sharedItems->setSchemeRequestLimit(scheme, limit);
+
+    // Now go fill any new request spots
+    while (sharedItems->getLoadingRequestsCount() < sharedItems->getRequestLimit() && attemptHighestPriorityRequest()) {
     }
 }
 
@@ -529,6 +697,14 @@ uint32_t ResourceCache::getLoadingRequestCount() {
     return DependencyManager::get<ResourceCacheSharedItems>()->getLoadingRequestsCount();
 }
 
+QList<ResourceCacheSharedItems::OriginStats> ResourceCache::getRequestOriginStats() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getOriginStats();
+}
+
+std::shared_ptr<ResourceArtifactCache> ResourceCache::getArtifactCache() {
+    return DependencyManager::get<ResourceCacheSharedItems>()->getArtifactCache();
+}
+
 bool ResourceCache::attemptRequest(QSharedPointer<Resource> resource) {
     Q_ASSERT(!resource.isNull());
 
@@ -545,12 +721,15 @@ void ResourceCache::requestCompleted(QWeakPointer<Resource> resource) {
 
     sharedItems->removeRequest(resource);
 
-    // Now go fill any new request spots
-    while (sharedItems->getLoadingRequestsCount() < sharedItems->getRequestLimit() && sharedItems->getPendingRequestsCount() > 0) {
-        attemptHighestPriorityRequest();
+    // Now go fill any new request spots, the pending requests of the origins at their limit keep waiting
+    while (sharedItems->getLoadingRequestsCount() < sharedItems->getRequestLimit() && attemptHighestPriorityRequest()) {
     }
 }
 
+void ResourceCache::requestPriorityChanged(QWeakPointer<Resource> resource) {
+    DependencyManager::get<ResourceCacheSharedItems>()->updatePendingRequest(resource);
+}
+
 bool ResourceCache::attemptHighestPriorityRequest() {
     auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
     auto resource = sharedItems->getHighestPendingRequest();
@@ -606,6 +785,7 @@ void Resource::ensureLoading() {
 void Resource::setLoadPriority(const QPointer<QObject>& owner, float priority) {
     if (!_failedToLoad) {
         _loadPriorities.insert(owner, priority);
+        ResourceCache::requestPriorityChanged(_self);
     }
 }
 
@@ -617,11 +797,13 @@ void Resource::setLoadPriorities(const QHash<QPointer<QObject>, float>& prioriti
             it != priorities.constEnd(); it++) {
         _loadPriorities.insert(it.key(), it.value());
     }
+    ResourceCache::requestPriorityChanged(_self);
 }
 
 void Resource::clearLoadPriority(const QPointer<QObject>& owner) {
     if (!_failedToLoad) {
         _loadPriorities.remove(owner);
+        ResourceCache::requestPriorityChanged(_self);
     }
 }
 
@@ -722,6 +904,18 @@ void Resource::finishedLoading(bool success) {
     } else {
         _failedToLoad = true;
     }
+
+    // what the resources do once they are loaded can wait for the next frame when this one has no time left
+    auto frameBudget = DependencyManager::get<FrameBudget>();
+    if (frameBudget && !frameBudget->hasTime()) {
+        frameBudget->defer(FrameBudget::RESOURCE_FINISHED, this, [this, success] {
+            // unless it was refreshed in the meantime
+            if (success ? _loaded : _failedToLoad) {
+                emit finished(success);
+            }
+        });
+        return;
+    }
     emit finished(success);
 }
 
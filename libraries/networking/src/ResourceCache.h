@@ -13,6 +13,7 @@
 #define hifi_ResourceCache_h
 
 #include <atomic>
+#include <map>
 #include <mutex>
 
 #include <QtCore/QHash>
@@ -24,6 +25,7 @@
 #include <QtCore/QWeakPointer>
 #include <QtCore/QReadWriteLock>
 #include <QtCore/QQueue>
+#include <QtCore/QSet>
 
 #include <QtNetwork/QNetworkReply>
 #include <QtNetwork/QNetworkRequest>
@@ -32,6 +34,7 @@
 
 #include <DependencyManager.h>
 
+#include "ResourceArtifactCache.h"
 #include "ResourceManager.h"
 
 Q_DECLARE_METATYPE(size_t)
@@ -66,25 +69,81 @@ class ResourceCacheSharedItems : public Dependency  {
     using Lock = std::unique_lock<Mutex>;
 
 public:
+    // The requests of one origin, a scheme and host such as an http host or the asset server
+    struct OriginStats {
+        QString origin;
+        uint32_t pending;
+        uint32_t loading;
+        uint32_t limit;
+    };
+
     bool appendRequest(QWeakPointer<Resource> newRequest);
     void removeRequest(QWeakPointer<Resource> doneRequest);
+    void updatePendingRequest(QWeakPointer<Resource> request);
     void setRequestLimit(uint32_t limit);
     uint32_t getRequestLimit() const;
+    void setSchemeRequestLimit(const QString& scheme, uint32_t limit);
+    uint32_t getSchemeRequestLimit(const QString& scheme) const;
+    void setOriginMultiplexed(const QUrl& url);
     QList<QSharedPointer<Resource>> getPendingRequests() const;
     QSharedPointer<Resource> getHighestPendingRequest();
     uint32_t getPendingRequestsCount() const;
     QList<QSharedPointer<Resource>> getLoadingRequests() const;
     uint32_t getLoadingRequestsCount() const;
+    QList<OriginStats> getOriginStats() const;
+    std::shared_ptr<ResourceArtifactCache> getArtifactCache();
     void clear();
 
 private:
-    ResourceCacheSharedItems() = default;
+    ResourceCacheSharedItems();
+
+    // file requests go first, then the highest priorities, then the latest requests
+    struct PendingKey {
+        bool isFile;
+        float priority;
+        uint64_t sequence;
+
+        bool operator<(const PendingKey& other) const;
+    };
+    using PendingQueue = std::map<PendingKey, QWeakPointer<Resource>>;
+
+    struct Origin {
+        QString scheme;
+        bool multiplexed { false };
+        PendingQueue pending;
+        uint32_t loading { 0 };
+    };
+    using Origins = QHash<QString, Origin>;
+
+    struct PendingRequest {
+        QString origin;
+        PendingQueue::iterator position;
+    };
+    using PendingRequests = QHash<Resource*, PendingRequest>;
+
+    struct LoadingRequest {
+        QWeakPointer<Resource> resource;
+        QString origin;
+    };
+
+    static QString getRequestOrigin(const QUrl& url);
+
+    Origins::iterator findOrigin(const QUrl& url);
+    void insertPendingRequest(const QSharedPointer<Resource>& resource, Origins::iterator origin, uint64_t sequence);
+    void erasePendingRequest(PendingRequests::iterator request);
+    void releaseOrigin(Origins::iterator origin);
+    uint32_t getOriginRequestLimit(const Origin& origin) const;
 
     mutable Mutex _mutex;
-    QList<QWeakPointer<Resource>> _pendingRequests;
-    QList<QWeakPointer<Resource>> _loadingRequests;
+    Origins _origins;
+    PendingRequests _pendingRequests;
+    QList<LoadingRequest> _loadingRequests;
+    uint64_t _nextSequence { 0 };
     const uint32_t DEFAULT_REQUEST_LIMIT = 10;
     uint32_t _requestLimit { DEFAULT_REQUEST_LIMIT };
+    QHash<QString, uint32_t> _schemeRequestLimits;
+    QSet<QString> _multiplexedOrigins;
+    std::shared_ptr<ResourceArtifactCache> _artifactCache;
 };
 
 /// Wrapper to expose resources to JS/QML
@@ -211,6 +270,12 @@ public:
 
     static void setRequestLimit(uint32_t limit);
     static uint32_t getRequestLimit() { return DependencyManager::get<ResourceCacheSharedItems>()->getRequestLimit(); }
+
+    /// Limits the concurrent downloads from each host of the scheme, within the overall limit
+    static void setSchemeRequestLimit(const QString& scheme, uint32_t limit);
+    static uint32_t getSchemeRequestLimit(const QString& scheme) {
+        return DependencyManager::get<ResourceCacheSharedItems>()->getSchemeRequestLimit(scheme);
+    }
     
     void setUnusedResourceCacheSize(qint64 unusedResourcesMaxSize);
     qint64 getUnusedResourceCacheSize() const { return _unusedResourcesMaxSize; }
@@ -218,6 +283,10 @@ public:
     static QList<QSharedPointer<Resource>> getLoadingRequests();
     static uint32_t getPendingRequestCount();
     static uint32_t getLoadingRequestCount();
+    static QList<ResourceCacheSharedItems::OriginStats> getRequestOriginStats();
+
+    /// The disk cache the subclasses keep their decoded resources in, keyed by the downloaded content
+    static std::shared_ptr<ResourceArtifactCache> getArtifactCache();
 
     ResourceCache(QObject* parent = nullptr);
     virtual ~ResourceCache();
@@ -270,6 +339,7 @@ protected:
     static bool attemptRequest(QSharedPointer<Resource> resource);
     static void requestCompleted(QWeakPointer<Resource> resource);
     static bool attemptHighestPriorityRequest();
+    static void requestPriorityChanged(QWeakPointer<Resource> resource);
 
 private:
     friend class Resource;
@@ -11,8 +11,11 @@
 
 #include "SequenceNumberStats.h"
 
+#include <algorithm>
 #include <limits>
 
+#include <QtCore/QtAlgorithms>
+
 #include <LogHandler.h>
 
 #include "NetworkLogging.h"
@@ -23,17 +26,18 @@ float PacketStreamStats::getLostRate() const {
 
 SequenceNumberStats::SequenceNumberStats(int statsHistoryLength, bool canDetectOutOfSync)
     : _lastReceivedSequence(0),
-    _missingSet(),
     _stats(),
     _lastSenderID(NULL_LOCAL_ID),
     _statsHistory(statsHistoryLength),
     _lastUnreasonableSequence(0),
     _consecutiveUnreasonableOnTime(0)
 {
+    static_assert(MISSING_WINDOW_SIZE > MAX_REASONABLE_SEQUENCE_GAP, "the window must cover the reasonable gaps");
+    clearMissing();
 }
 
 void SequenceNumberStats::reset() {
-    _missingSet.clear();
+    clearMissing();
     _stats = PacketStreamStats();
     _lastSenderID = NULL_LOCAL_ID;
     _statsHistory.clear();
@@ -65,6 +69,8 @@ SequenceNumberStats::ArrivalInfo SequenceNumberStats::sequenceNumberReceived(qui
     if (incoming == expected) { // on time
         arrivalInfo._status = OnTime;
         _lastReceivedSequence = incoming;
+        // its bit is the one of the sequence number a window before it
+        takeMissing(incoming);
         _stats._expectedReceived++;
 
     } else { // out of order
@@ -116,16 +122,9 @@ SequenceNumberStats::ArrivalInfo SequenceNumberStats::sequenceNumberReceived(qui
             _stats._expectedReceived += (skipped + 1);
             _lastReceivedSequence = incoming;
 
-            // add all sequence numbers that were skipped to the missing sequence numbers list
-            for (int missingInt = expectedInt; missingInt < incomingInt; missingInt++) {
-                _missingSet.insert((quint16)(missingInt < 0 ? missingInt + UINT16_RANGE : missingInt));
-            }
-
-            // prune missing sequence list if it gets too big; sequence numbers that are older than MAX_REASONABLE_SEQUENCE_GAP
-            // will be removed.
-            if (_missingSet.size() > MAX_REASONABLE_SEQUENCE_GAP) {
-                pruneMissingSet(wantExtraDebugging);
-            }
+            // mark all sequence numbers that were skipped as missing, which overwrites the ones that left the window
+            markMissing(expected, skipped);
+            takeMissing(incoming);
         } else { // late
             if (wantExtraDebugging) {
                 qCDebug(networking) << "this packet is later than expected...";
@@ -136,11 +135,11 @@ SequenceNumberStats::ArrivalInfo SequenceNumberStats::sequenceNumberReceived(qui
             // do not update _lastReceived; it shouldn't become smaller
 
             // remove this from missing sequence number if it's in there
-            if (_missingSet.remove(incoming)) {
+            if (takeMissing(incoming)) {
                 arrivalInfo._status = Recovered;
 
                 if (wantExtraDebugging) {
-                    qCDebug(networking) << "found it in _missingSet";
+                    qCDebug(networking) << "found it in the missing sequence numbers";
                 }
                 if (_stats._lost > 0) {
                     _stats._lost--;
@@ -183,7 +182,7 @@ void SequenceNumberStats::receivedUnreasonable(quint16 incoming) {
             // the seq num sender.  update our state to get back in sync with the sender.
 
             _lastReceivedSequence = incoming;
-            _missingSet.clear();
+            clearMissing();
 
             _stats._received = CONSECUTIVE_UNREASONABLE_ON_TIME_THRESHOLD;
             _stats._unreasonable = 0;
@@ -203,54 +202,43 @@ void SequenceNumberStats::receivedUnreasonable(quint16 incoming) {
     }
 }
 
-void SequenceNumberStats::pruneMissingSet(const bool wantExtraDebugging) {
-    if (wantExtraDebugging) {
-        qCDebug(networking) << "pruning _missingSet! size:" << _missingSet.size();
+void SequenceNumberStats::markMissing(quint16 first, int count) {
+    int bit = first % MISSING_WINDOW_SIZE;
+    while (count > 0) {
+        int bitInWord = bit % BITS_PER_MISSING_WORD;
+        int numBits = std::min(count, BITS_PER_MISSING_WORD - bitInWord);
+        quint64 mask = numBits == BITS_PER_MISSING_WORD ? ~(quint64)0 : (((quint64)1 << numBits) - 1) << bitInWord;
+        _missingBits[bit / BITS_PER_MISSING_WORD] |= mask;
+        count -= numBits;
+        bit = (bit + numBits) % MISSING_WINDOW_SIZE;
     }
+}
 
-    // some older sequence numbers may be from before a rollover point; this must be handled.
-    // some sequence numbers in this list may be larger than _incomingLastSequence, indicating that they were received
-    // before the most recent rollover.
-    int cutoff = (int)_lastReceivedSequence - MAX_REASONABLE_SEQUENCE_GAP;
-    if (cutoff >= 0) {
-        quint16 nonRolloverCutoff = (quint16)cutoff;
-        QSet<quint16>::iterator i = _missingSet.begin();
-        while (i != _missingSet.end()) {
-            quint16 missing = *i;
-            if (wantExtraDebugging) {
-                qCDebug(networking) << "checking item:" << missing << "is it in need of pruning?";
-                qCDebug(networking) << "old age cutoff:" << nonRolloverCutoff;
-            }
-
-            if (missing > _lastReceivedSequence || missing < nonRolloverCutoff) {
-                i = _missingSet.erase(i);
-                if (wantExtraDebugging) {
-                    qCDebug(networking) << "pruning really old missing sequence:" << missing;
-                }
-            } else {
-                i++;
-            }
-        }
-    } else {
-        quint16 rolloverCutoff = (quint16)(cutoff + UINT16_RANGE);
-        QSet<quint16>::iterator i = _missingSet.begin();
-        while (i != _missingSet.end()) {
-            quint16 missing = *i;
-            if (wantExtraDebugging) {
-                qCDebug(networking) << "checking item:" << missing << "is it in need of pruning?";
-                qCDebug(networking) << "old age cutoff:" << rolloverCutoff;
-            }
+bool SequenceNumberStats::takeMissing(quint16 sequence) {
+    int bit = sequence % MISSING_WINDOW_SIZE;
+    quint64 mask = (quint64)1 << (bit % BITS_PER_MISSING_WORD);
+    quint64& word = _missingBits[bit / BITS_PER_MISSING_WORD];
+    bool wasMissing = (word & mask) != 0;
+    word &= ~mask;
+    return wasMissing;
+}
 
-            if (missing > _lastReceivedSequence && missing < rolloverCutoff) {
-                i = _missingSet.erase(i);
-                if (wantExtraDebugging) {
-                    qCDebug(networking) << "pruning really old missing sequence:" << missing;
-                }
-            } else {
-                i++;
+QSet<quint16> SequenceNumberStats::getMissingSet() const {
+    QSet<quint16> missingSet;
+    for (int wordIndex = 0; wordIndex < (int)_missingBits.size(); wordIndex++) {
+        quint64 word = _missingBits[wordIndex];
+        while (word) {
+            int bit = wordIndex * BITS_PER_MISSING_WORD + (int)qCountTrailingZeroBits(word);
+            word &= word - 1;
+
+            // the bit is for the sequence number within a window before the last one
+            int age = ((int)_lastReceivedSequence - bit) & (MISSING_WINDOW_SIZE - 1);
+            if (age > 0 && age <= MAX_REASONABLE_SEQUENCE_GAP) {
+                missingSet.insert(_lastReceivedSequence - (quint16)age);
             }
         }
     }
+    return missingSet;
 }
 
 PacketStreamStats SequenceNumberStats::getStatsForHistoryWindow() const {
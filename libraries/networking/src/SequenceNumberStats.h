@@ -12,6 +12,10 @@
 #ifndef hifi_SequenceNumberStats_h
 #define hifi_SequenceNumberStats_h
 
+#include <array>
+
+#include <QtCore/QSet>
+
 #include "SharedUtil.h"
 #include "RingBufferHistory.h"
 #include "UUID.h"
@@ -74,7 +78,6 @@ public:
 
     void reset();
     ArrivalInfo sequenceNumberReceived(quint16 incoming, NetworkLocalID senderID = NULL_LOCAL_ID, const bool wantExtraDebugging = false);
-    void pruneMissingSet(const bool wantExtraDebugging = false);
     void pushStatsToHistory() { _statsHistory.insert(_stats); }
 
     quint32 getReceived() const { return _stats._received; }
@@ -89,14 +92,26 @@ public:
     const PacketStreamStats& getStats() const { return _stats; }
     PacketStreamStats getStatsForHistoryWindow() const;
     PacketStreamStats getStatsForLastHistoryInterval() const;
-    const QSet<quint16>& getMissingSet() const { return _missingSet; }
+    // the sequence numbers that were skipped among the MAX_REASONABLE_SEQUENCE_GAP before the last one received,
+    // older ones can't be recovered and are dropped
+    QSet<quint16> getMissingSet() const;
 
 private:
     void receivedUnreasonable(quint16 incoming);
 
+    void markMissing(quint16 first, int count);
+    void clearMissing() { _missingBits.fill(0); }
+    // clears the bit of the sequence number, true if it was missing
+    bool takeMissing(quint16 sequence);
+
 private:
+    // a bit per sequence number modulo the size of the window, for the late packets to find their place without
+    // allocating.  It divides the range of the sequence numbers so that it follows them through rollovers.
+    static const int MISSING_WINDOW_SIZE = 1024;
+    static const int BITS_PER_MISSING_WORD = 64;
+
     quint16 _lastReceivedSequence;
-    QSet<quint16> _missingSet;
+    std::array<quint64, MISSING_WINDOW_SIZE / BITS_PER_MISSING_WORD> _missingBits;
 
     PacketStreamStats _stats;
 
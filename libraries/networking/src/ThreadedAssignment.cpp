@@ -11,6 +11,8 @@
 
 #include "ThreadedAssignment.h"
 
+#include <thread>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
@@ -18,10 +20,15 @@
 #include <QtCore/QTimer>
 
 #include <LogHandler.h>
+#include <NumericalConstants.h>
+#include <Trace.h>
+#include <UUID.h>
 #include <shared/QtHelpers.h>
 
 #include <platform/Platform.h>
 #include "NetworkLogging.h"
+#include "udt/PacketBufferPool.h"
+#include "udt/SendScheduler.h"
 
 ThreadedAssignment::ThreadedAssignment(ReceivedMessage& message) :
     Assignment(message),
@@ -104,6 +111,34 @@ void ThreadedAssignment::commonInit(const QString& targetName, NodeType_t nodeTy
 
     // stop sending stats if we disconnect
     connect(&nodeList->getDomainHandler(), &DomainHandler::disconnectedFromDomain, &_statsTimer, &QTimer::stop);
+
+    nodeList->getPacketReceiver().registerListener(PacketType::NodeTraceRequest, this, "handleNodeTraceRequest");
+}
+
+void ThreadedAssignment::handleNodeTraceRequest(QSharedPointer<ReceivedMessage> message) {
+    auto nodeList = DependencyManager::get<NodeList>();
+    HifiSockAddr domainSockAddr = nodeList->getDomainHandler().getSockAddr();
+
+    // the request isn't sourced, only take it from our domain-server
+    if (message->getSenderSockAddr() != domainSockAddr || !DependencyManager::isSet<tracing::Tracer>()) {
+        return;
+    }
+
+    QUuid requestID = QUuid::fromRfc4122(message->read(NUM_BYTES_RFC4122_UUID));
+    quint32 seconds;
+    message->readPrimitive(&seconds);
+
+    static const quint32 MAX_TRACE_SECONDS = 60;
+    int64_t windowUsecs = (int64_t)std::min(seconds, MAX_TRACE_SECONDS) * USECS_PER_SECOND;
+
+    // serializing and compressing the trace takes long enough to stall a mixer frame, so it isn't done on our thread
+    auto tracer = DependencyManager::get<tracing::Tracer>();
+    std::thread([nodeList, tracer, requestID, windowUsecs, domainSockAddr] {
+        auto replyPacketList = NLPacketList::create(PacketType::NodeTraceReply, QByteArray(), true, true);
+        replyPacketList->write(requestID.toRfc4122());
+        replyPacketList->write(tracer->snapshot(windowUsecs));
+        nodeList->sendPacketList(std::move(replyPacketList), domainSockAddr);
+    }).detach();
 }
 
 void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObject) {
@@ -119,8 +154,20 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
     ioStats["outbound_kbps"] = nodeList->getOutboundKbps();
     ioStats["outbound_pps"] = nodeList->getOutboundPPS();
 
+    auto packetBufferStats = udt::PacketBufferPool::sampleStats();
+    ioStats["packet_buffer_pool_hits"] = (double)packetBufferStats.hits;
+    ioStats["packet_buffer_pool_misses"] = (double)packetBufferStats.misses;
+
+    auto sendSchedulerStats = udt::SendScheduler::getInstance().sampleStats();
+    ioStats["send_scheduler_threads"] = sendSchedulerStats.numThreads;
+    ioStats["send_scheduler_steps"] = (double)sendSchedulerStats.numSteps;
+    ioStats["send_scheduler_average_lag_usecs"] = (double)sendSchedulerStats.averageLagUsecs;
+    ioStats["send_scheduler_max_lag_usecs"] = (double)sendSchedulerStats.maxLagUsecs;
+
     statsObject["io_stats"] = ioStats;
 
+    statsObject["packet_processing"] = nodeList->getPacketReceiver().sampleProcessingStats();
+
     QJsonObject assignmentStats;
     assignmentStats["numQueuedCheckIns"] = _numQueuedCheckIns;
 
@@ -0,0 +1,276 @@
+//
+//  BBRCC.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BBRCC.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtCore/QtGlobal>
+
+using namespace udt;
+using namespace std::chrono;
+
+static const double USECS_PER_SECOND = 1000000.0;
+
+// 2 / ln(2), the smallest gain that doubles the delivery rate every round
+static const double STARTUP_GAIN = 2.885;
+static const double PROBE_BANDWIDTH_CONGESTION_WINDOW_GAIN = 2.0;
+
+// pacing gain cycle while probing for bandwidth, each phase lasts one min RTT
+static const double PROBE_BANDWIDTH_GAINS[] = { 1.25, 0.75, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+static const int PROBE_BANDWIDTH_CYCLE_LENGTH = sizeof(PROBE_BANDWIDTH_GAINS) / sizeof(PROBE_BANDWIDTH_GAINS[0]);
+
+// the pipe is considered full once the bandwidth estimate grows by less than 25% for 3 rounds
+static const double FULL_BANDWIDTH_GROWTH = 1.25;
+static const int FULL_BANDWIDTH_ROUNDS = 3;
+
+static const int BANDWIDTH_WINDOW_ROUNDS = 10;
+static const auto MIN_RTT_WINDOW = seconds(10);
+static const auto PROBE_RTT_DURATION = milliseconds(200);
+
+static const int INITIAL_CONGESTION_WINDOW_PACKETS = 10;
+static const int MIN_CONGESTION_WINDOW_PACKETS = 4;
+
+BBRCC::BBRCC() :
+    _pacingGain(STARTUP_GAIN),
+    _congestionWindowGain(STARTUP_GAIN)
+{
+    // we don't pace until we have our first bandwidth sample
+    _packetSendPeriod = 0.0;
+    _congestionWindowSize = INITIAL_CONGESTION_WINDOW_PACKETS;
+}
+
+bool BBRCC::onACK(SequenceNumber ack, p_high_resolution_clock::time_point receiveTime) {
+    int newlyDelivered = seqoff(_lastACK, ack);
+
+    if (newlyDelivered <= 0) {
+        // the model is driven by deliveries only, but we still fall back to Reno's fast re-transmit on duplicate ACKs
+        static const int RENO_FAST_RETRANSMIT_DUPLICATE_COUNT = 3;
+
+        if (ack == _lastACK && ++_duplicateACKCount == RENO_FAST_RETRANSMIT_DUPLICATE_COUNT) {
+            _duplicateACKCount = 0;
+            return true;
+        }
+
+        return false;
+    }
+
+    _duplicateACKCount = 0;
+    _lastACK = ack;
+    _delivered += newlyDelivered;
+    _deliveredTime = receiveTime;
+
+    // pop all of the packets covered by this ACK, keeping the most recently sent one to take our samples from
+    bool hasSample = false;
+    bool wasAnyResent = false;
+    SentPacketData sample;
+    while (!_sentPacketDatas.empty() && seqoff(_sentPacketDatas.front().sequenceNumber, ack) >= 0) {
+        sample = _sentPacketDatas.front();
+        wasAnyResent = wasAnyResent || sample.wasResent;
+        hasSample = true;
+        _sentPacketDatas.pop_front();
+    }
+
+    _isRoundStart = false;
+
+    if (hasSample) {
+        // an RTT sample is only unambiguous if none of the covered packets were re-sent
+        if (!wasAnyResent) {
+            updateRTT((int)duration_cast<microseconds>(receiveTime - sample.timePoint).count(), receiveTime);
+        }
+
+        updateRound(sample);
+
+        // the delivery rate over the time it took this packet to be ACKed
+        // intervals shorter than the min RTT come from compressed ACKs and would over-estimate the bandwidth
+        auto interval = duration_cast<microseconds>(receiveTime - sample.deliveredTime).count();
+        if (interval > 0 && interval >= _minRTT) {
+            updateBandwidth((double)(_delivered - sample.delivered) * USECS_PER_SECOND / interval);
+        }
+    }
+
+    updateMode(receiveTime);
+    updateControlParameters();
+
+    return false;
+}
+
+void BBRCC::onTimeout() {
+    // conserve packets until the next delivery brings our window back to the model
+    _congestionWindowSize = MIN_CONGESTION_WINDOW_PACKETS;
+}
+
+void BBRCC::onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    if (_sentPacketDatas.empty()) {
+        // nothing is in flight, start measuring deliveries from now so that idle time is not counted against the rate
+        _deliveredTime = timePoint;
+    }
+
+    SentPacketData packetData;
+    packetData.sequenceNumber = seqNum;
+    packetData.timePoint = timePoint;
+    packetData.delivered = _delivered;
+    packetData.deliveredTime = _deliveredTime;
+    _sentPacketDatas.push_back(packetData);
+}
+
+void BBRCC::onPacketReSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    auto it = std::find_if(_sentPacketDatas.begin(), _sentPacketDatas.end(), [seqNum](SentPacketData& sentPacketData){
+        return sentPacketData.sequenceNumber == seqNum;
+    });
+
+    // mark the packet as re-sent so we know it cannot be used for RTT calculations
+    if (it != _sentPacketDatas.end()) {
+        it->wasResent = true;
+    }
+}
+
+int BBRCC::estimatedTimeout() const {
+    return _ewmaRTT == -1 ? DEFAULT_SYN_INTERVAL : _ewmaRTT + _rttVariance * 4;
+}
+
+void BBRCC::updateRTT(int lastRTT, p_high_resolution_clock::time_point receiveTime) {
+    const int MAX_RTT_SAMPLE_MICROSECONDS = 10000000;
+    lastRTT = std::max(1, std::min(lastRTT, MAX_RTT_SAMPLE_MICROSECONDS));
+
+    // the smoothed RTT is only used for our timeout estimate, with the same gains as TCPVegasCC
+    if (_ewmaRTT == -1) {
+        _ewmaRTT = lastRTT;
+        _rttVariance = lastRTT / 2;
+    } else {
+        static const int RTT_ESTIMATION_ALPHA = 8;
+        static const int RTT_ESTIMATION_VARIANCE_ALPHA = 4;
+
+        _ewmaRTT = (_ewmaRTT * (RTT_ESTIMATION_ALPHA - 1) + lastRTT) / RTT_ESTIMATION_ALPHA;
+        _rttVariance = (_rttVariance * (RTT_ESTIMATION_VARIANCE_ALPHA - 1)
+                        + abs(lastRTT - _ewmaRTT)) / RTT_ESTIMATION_VARIANCE_ALPHA;
+    }
+
+    _isMinRTTExpired = _minRTT != -1 && receiveTime - _minRTTTimestamp > MIN_RTT_WINDOW;
+    if (_minRTT == -1 || lastRTT <= _minRTT || _isMinRTTExpired) {
+        _minRTT = lastRTT;
+        _minRTTTimestamp = receiveTime;
+    }
+}
+
+void BBRCC::updateBandwidth(double bandwidth) {
+    while (!_bandwidthSamples.empty() && _bandwidthSamples.back().bandwidth <= bandwidth) {
+        _bandwidthSamples.pop_back();
+    }
+    _bandwidthSamples.push_back({ _roundCount, bandwidth });
+
+    while (_bandwidthSamples.front().round + BANDWIDTH_WINDOW_ROUNDS <= _roundCount) {
+        _bandwidthSamples.pop_front();
+    }
+}
+
+void BBRCC::updateRound(const SentPacketData& packetData) {
+    // a round ends once a packet sent after the start of the round is delivered
+    if (packetData.delivered >= _nextRoundDelivered) {
+        _nextRoundDelivered = _delivered;
+        ++_roundCount;
+        _isRoundStart = true;
+    }
+}
+
+void BBRCC::updateMode(p_high_resolution_clock::time_point receiveTime) {
+    if (_mode == Mode::Startup && _isRoundStart) {
+        double bandwidth = getBottleneckBandwidth();
+        if (bandwidth >= _fullBandwidth * FULL_BANDWIDTH_GROWTH) {
+            _fullBandwidth = bandwidth;
+            _fullBandwidthCount = 0;
+        } else if (++_fullBandwidthCount >= FULL_BANDWIDTH_ROUNDS) {
+            _isPipeFilled = true;
+            _mode = Mode::Drain;
+            _pacingGain = 1.0 / STARTUP_GAIN;
+            _congestionWindowGain = STARTUP_GAIN;
+        }
+    }
+
+    if (_mode == Mode::Drain && packetsInFlight() <= getBandwidthDelayProduct()) {
+        enterProbeBandwidth(receiveTime);
+    }
+
+    if (_mode == Mode::ProbeBandwidth && receiveTime - _cycleTimestamp > microseconds(_minRTT)) {
+        _cycleIndex = (_cycleIndex + 1) % PROBE_BANDWIDTH_CYCLE_LENGTH;
+        _cycleTimestamp = receiveTime;
+        _pacingGain = PROBE_BANDWIDTH_GAINS[_cycleIndex];
+    }
+
+    if (_isMinRTTExpired && _mode != Mode::ProbeRTT) {
+        _mode = Mode::ProbeRTT;
+        _pacingGain = 1.0;
+        _congestionWindowGain = 1.0;
+        _probeRTTDoneTime = p_high_resolution_clock::time_point();
+    }
+
+    if (_mode == Mode::ProbeRTT) {
+        if (_probeRTTDoneTime == p_high_resolution_clock::time_point()) {
+            // wait for the window to drain down before starting the clock
+            if (packetsInFlight() <= MIN_CONGESTION_WINDOW_PACKETS) {
+                _probeRTTDoneTime = receiveTime + PROBE_RTT_DURATION;
+                _isProbeRTTRoundDone = false;
+                _nextRoundDelivered = _delivered;
+            }
+        } else {
+            _isProbeRTTRoundDone = _isProbeRTTRoundDone || _isRoundStart;
+
+            if (_isProbeRTTRoundDone && receiveTime > _probeRTTDoneTime) {
+                _isMinRTTExpired = false;
+                _minRTTTimestamp = receiveTime;
+
+                if (_isPipeFilled) {
+                    enterProbeBandwidth(receiveTime);
+                } else {
+                    _mode = Mode::Startup;
+                    _pacingGain = STARTUP_GAIN;
+                    _congestionWindowGain = STARTUP_GAIN;
+                }
+            }
+        }
+    }
+}
+
+void BBRCC::enterProbeBandwidth(p_high_resolution_clock::time_point receiveTime) {
+    // start cruising, the probing phase comes around once the cycle wraps
+    _mode = Mode::ProbeBandwidth;
+    _cycleIndex = 2;
+    _cycleTimestamp = receiveTime;
+    _pacingGain = PROBE_BANDWIDTH_GAINS[_cycleIndex];
+    _congestionWindowGain = PROBE_BANDWIDTH_CONGESTION_WINDOW_GAIN;
+}
+
+void BBRCC::updateControlParameters() {
+    double bandwidth = getBottleneckBandwidth();
+    if (bandwidth <= 0.0 || _minRTT == -1) {
+        // no model yet, keep sending with our initial window
+        return;
+    }
+
+    setPacketSendPeriod(USECS_PER_SECOND / (_pacingGain * bandwidth));
+
+    if (_mode == Mode::ProbeRTT) {
+        _congestionWindowSize = MIN_CONGESTION_WINDOW_PACKETS;
+    } else {
+        double congestionWindow = std::ceil(_congestionWindowGain * getBandwidthDelayProduct());
+        _congestionWindowSize = (int)std::min(std::max(congestionWindow, (double)MIN_CONGESTION_WINDOW_PACKETS),
+                                              (double)udt::MAX_PACKETS_IN_FLIGHT);
+    }
+}
+
+int BBRCC::packetsInFlight() const {
+    return std::max(0, seqoff(_lastACK, _sendCurrSeqNum));
+}
+
+double BBRCC::getBandwidthDelayProduct() const {
+    return _minRTT == -1 ? (double)INITIAL_CONGESTION_WINDOW_PACKETS
+                         : getBottleneckBandwidth() * _minRTT / USECS_PER_SECOND;
+}
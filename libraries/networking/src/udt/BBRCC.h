@@ -0,0 +1,112 @@
+//
+//  BBRCC.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BBRCC_h
+#define hifi_BBRCC_h
+
+#include <deque>
+
+#include "CongestionControl.h"
+#include "Constants.h"
+
+namespace udt {
+
+// Model based congestion control, after BBR (Cardwell et al., "BBR: Congestion-Based Congestion Control").
+//   Rather than reacting to loss or to queueing delay, it keeps running estimates of the bottleneck bandwidth
+//   (windowed max of the delivery rate) and of the propagation delay (windowed min of the RTT), paces packets
+//   at a gain over the bandwidth estimate and caps the packets in flight at a multiple of their product.
+class BBRCC : public CongestionControl {
+public:
+    BBRCC();
+
+    virtual bool onACK(SequenceNumber ackNum, p_high_resolution_clock::time_point receiveTime) override;
+    virtual void onTimeout() override;
+
+    virtual void onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+    virtual void onPacketReSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+
+    virtual int estimatedTimeout() const override;
+
+protected:
+    virtual void setInitialSendSequenceNumber(SequenceNumber seqNum) override { _lastACK = seqNum - 1; }
+
+private:
+    enum class Mode {
+        Startup, // exponential search for the bottleneck bandwidth
+        Drain, // drain the queue built up during startup
+        ProbeBandwidth, // steady state, cycle the pacing gain to probe for more bandwidth
+        ProbeRTT // briefly shrink the window to re-measure the propagation delay
+    };
+
+    struct SentPacketData {
+        SequenceNumber sequenceNumber;
+        p_high_resolution_clock::time_point timePoint;
+        int64_t delivered; // packets delivered when this packet was sent
+        p_high_resolution_clock::time_point deliveredTime; // time of the last delivery when this packet was sent
+        bool wasResent { false };
+    };
+
+    struct BandwidthSample {
+        int64_t round;
+        double bandwidth; // packets per second
+    };
+
+    void updateRTT(int lastRTT, p_high_resolution_clock::time_point receiveTime);
+    void updateBandwidth(double bandwidth);
+    void updateRound(const SentPacketData& packetData);
+    void updateMode(p_high_resolution_clock::time_point receiveTime);
+    void enterProbeBandwidth(p_high_resolution_clock::time_point receiveTime);
+    void updateControlParameters();
+
+    int packetsInFlight() const;
+    double getBottleneckBandwidth() const { return _bandwidthSamples.empty() ? 0.0 : _bandwidthSamples.front().bandwidth; }
+    double getBandwidthDelayProduct() const;
+
+    std::deque<SentPacketData> _sentPacketDatas; // sent packets awaiting an ACK, in sequence order
+
+    // windowed max filter of the delivery rate over the last rounds, kept as a decreasing monotonic deque
+    std::deque<BandwidthSample> _bandwidthSamples;
+
+    Mode _mode { Mode::Startup };
+    double _pacingGain;
+    double _congestionWindowGain;
+
+    SequenceNumber _lastACK; // Sequence number of last packet that was ACKed
+
+    int64_t _delivered { 0 }; // Total number of packets delivered
+    p_high_resolution_clock::time_point _deliveredTime; // Time of the last delivery
+
+    int64_t _roundCount { 0 }; // Number of round trips elapsed
+    int64_t _nextRoundDelivered { 0 }; // Delivered count that marks the end of the current round
+    bool _isRoundStart { false };
+
+    double _fullBandwidth { 0.0 }; // Bandwidth estimate at the last significant growth during startup
+    int _fullBandwidthCount { 0 }; // Number of rounds without significant growth
+    bool _isPipeFilled { false };
+
+    int _minRTT { -1 }; // Windowed min RTT, in microseconds
+    p_high_resolution_clock::time_point _minRTTTimestamp;
+    bool _isMinRTTExpired { false }; // The min RTT was not refreshed in its window and needs to be re-measured
+
+    p_high_resolution_clock::time_point _probeRTTDoneTime;
+    bool _isProbeRTTRoundDone { false };
+
+    int _cycleIndex { 0 }; // Current phase of the ProbeBandwidth gain cycle
+    p_high_resolution_clock::time_point _cycleTimestamp;
+
+    int _ewmaRTT { -1 }; // Exponential weighted moving average RTT
+    int _rttVariance { 0 }; // Variance in collected RTT values
+
+    int _duplicateACKCount { 0 }; // Counter for duplicate ACKs received
+};
+
+}
+
+#endif // hifi_BBRCC_h
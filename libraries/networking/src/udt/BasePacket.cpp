@@ -12,6 +12,7 @@
 #include "BasePacket.h"
 
 #include "../NetworkLogging.h"
+#include "PacketBufferPool.h"
 
 using namespace udt;
 
@@ -35,13 +36,13 @@ std::unique_ptr<BasePacket> BasePacket::create(qint64 size) {
     return packet;
 }
 
-std::unique_ptr<BasePacket> BasePacket::fromReceivedPacket(std::unique_ptr<char[]> data,
-                                                           qint64 size, const HifiSockAddr& senderSockAddr) {
+std::unique_ptr<BasePacket> BasePacket::fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
+                                                           const HifiSockAddr& senderSockAddr, bool isBufferPooled) {
     // Fail with invalid size
     Q_ASSERT(size >= 0);
     
     // allocate memory
-    auto packet = std::unique_ptr<BasePacket>(new BasePacket(std::move(data), size, senderSockAddr));
+    auto packet = std::unique_ptr<BasePacket>(new BasePacket(std::move(data), size, senderSockAddr, isBufferPooled));
     
     packet->open(QIODevice::ReadOnly);
     
@@ -60,15 +61,24 @@ BasePacket::BasePacket(qint64 size) {
     Q_ASSERT(size >= 0 || size < maxPayload);
     
     _packetSize = size;
-    _packet.reset(new char[_packetSize]());
+    if (_packetSize == MAX_PACKET_SIZE) {
+        // full size packets are by far the most common, recycle their buffers
+        _packet = PacketBufferPool::acquire();
+        memset(_packet.get(), 0, _packetSize);
+        _isBufferPooled = true;
+    } else {
+        _packet.reset(new char[_packetSize]());
+    }
     _payloadCapacity = _packetSize;
     _payloadSize = 0;
     _payloadStart = _packet.get();
 }
 
-BasePacket::BasePacket(std::unique_ptr<char[]> data, qint64 size, const HifiSockAddr& senderSockAddr) :
+BasePacket::BasePacket(std::unique_ptr<char[]> data, qint64 size, const HifiSockAddr& senderSockAddr,
+                       bool isBufferPooled) :
     _packetSize(size),
     _packet(std::move(data)),
+    _isBufferPooled(isBufferPooled),
     _payloadStart(_packet.get()),
     _payloadCapacity(size),
     _payloadSize(size),
@@ -77,9 +87,19 @@ BasePacket::BasePacket(std::unique_ptr<char[]> data, qint64 size, const HifiSock
     
 }
 
+BasePacket::~BasePacket() {
+    if (_isBufferPooled) {
+        PacketBufferPool::release(std::move(_packet));
+    }
+}
+
 BasePacket& BasePacket::operator=(const BasePacket& other) {
+    if (_isBufferPooled) {
+        PacketBufferPool::release(std::move(_packet));
+    }
     _packetSize = other._packetSize;
-    _packet = std::unique_ptr<char[]>(new char[_packetSize]);
+    _isBufferPooled = _packetSize <= MAX_PACKET_SIZE;
+    _packet = _isBufferPooled ? PacketBufferPool::acquire() : std::unique_ptr<char[]>(new char[_packetSize]);
     memcpy(_packet.get(), other._packet.get(), _packetSize);
     
     _payloadStart = _packet.get() + (other._payloadStart - other._packet.get());
@@ -103,8 +123,13 @@ BasePacket::BasePacket(BasePacket&& other) {
 }
 
 BasePacket& BasePacket::operator=(BasePacket&& other) {
+    if (_isBufferPooled) {
+        PacketBufferPool::release(std::move(_packet));
+    }
     _packetSize = other._packetSize;
     _packet = std::move(other._packet);
+    _isBufferPooled = other._isBufferPooled;
+    other._isBufferPooled = false;
     
     _payloadStart = other._payloadStart;
     _payloadCapacity = other._payloadCapacity;
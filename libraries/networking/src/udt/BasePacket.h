@@ -30,8 +30,9 @@ public:
     static const qint64 PACKET_WRITE_ERROR;
     
     static std::unique_ptr<BasePacket> create(qint64 size = -1);
+    // isBufferPooled means data came from PacketBufferPool::acquire, and goes back to it with the packet
     static std::unique_ptr<BasePacket> fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size,
-                                                          const HifiSockAddr& senderSockAddr);
+                                                          const HifiSockAddr& senderSockAddr, bool isBufferPooled = false);
     
     // Current level's header size
     static int localHeaderSize();
@@ -39,6 +40,8 @@ public:
     static int totalHeaderSize();
     // The maximum payload size this packet can use to fit in MTU
     static int maxPayloadSize();
+
+    virtual ~BasePacket();
     
     // Payload direct access to the payload, use responsibly!
     char* getPayload() { return _payloadStart; }
@@ -87,7 +90,7 @@ public:
     
 protected:
     BasePacket(qint64 size);
-    BasePacket(std::unique_ptr<char[]> data, qint64 size, const HifiSockAddr& senderSockAddr);
+    BasePacket(std::unique_ptr<char[]> data, qint64 size, const HifiSockAddr& senderSockAddr, bool isBufferPooled = false);
     BasePacket(const BasePacket& other) : ExtendedIODevice() { *this = other; }
     BasePacket& operator=(const BasePacket& other);
     BasePacket(BasePacket&& other);
@@ -101,6 +104,7 @@ protected:
     
     qint64 _packetSize = 0;        // Total size of the allocated memory
     std::unique_ptr<char[]> _packet; // Allocated memory
+    bool _isBufferPooled = false;  // Allocated memory came from, and goes back to, the PacketBufferPool
     
     char* _payloadStart = nullptr; // Start of the payload
     qint64 _payloadCapacity = 0;          // Total capacity of the payload
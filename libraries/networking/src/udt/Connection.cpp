@@ -12,8 +12,7 @@
 #include "Connection.h"
 
 #include <random>
-
-#include <QtCore/QThread>
+#include <vector>
 
 #include <NumericalConstants.h>
 
@@ -30,6 +29,11 @@
 using namespace udt;
 using namespace std::chrono;
 
+// the number of received ranges past the first loss that an ACK carries
+static const int MAX_SELECTIVE_ACK_RANGES = 4;
+// a hole is considered lost, and fast re-transmitted, once this many packets after it were selectively ACKed
+static const int SELECTIVE_ACK_FAST_RETRANSMIT_THRESHOLD = 3;
+
 Connection::Connection(Socket* parentSocket, HifiSockAddr destination, std::unique_ptr<CongestionControl> congestionControl) :
     _parentSocket(parentSocket),
     _destination(destination),
@@ -41,7 +45,7 @@ Connection::Connection(Socket* parentSocket, HifiSockAddr destination, std::uniq
     _congestionControl->init();
 
     // Setup packets
-    static const int ACK_PACKET_PAYLOAD_BYTES = sizeof(SequenceNumber);
+    static const int ACK_PACKET_PAYLOAD_BYTES = sizeof(SequenceNumber) * (1 + 2 * MAX_SELECTIVE_ACK_RANGES);
     static const int HANDSHAKE_ACK_PAYLOAD_BYTES = sizeof(SequenceNumber);
 
     _ackPacket = ControlPacket::create(ControlPacket::ACK, ACK_PACKET_PAYLOAD_BYTES);
@@ -67,21 +71,11 @@ Connection::~Connection() {
 }
 
 void Connection::stopSendQueue() {
-    if (auto sendQueue = _sendQueue.release()) {
-        // grab the send queue thread so we can wait on it
-        QThread* sendQueueThread = sendQueue->thread();
-        
-        // tell the send queue to stop and be deleted
-        
+    if (auto sendQueue = std::move(_sendQueue)) {
+        // tell the send queue to stop, deleting it waits for a step that is running on a sender thread
         sendQueue->stop();
 
         _lastMessageNumber = sendQueue->getCurrentMessageNumber();
-
-        sendQueue->deleteLater();
-        
-        // wait on the send queue thread so we know the send queue is gone
-        sendQueueThread->quit();
-        sendQueueThread->wait();
     }
 }
 
@@ -138,7 +132,9 @@ void Connection::queueInactive() {
 #endif
 }
 
-void Connection::queueTimeout() {
+void Connection::queueTimeout(int numRetransmitPackets) {
+    _stats.recordTimeoutRetransmitPackets(numRetransmitPackets);
+
     updateCongestionControlAndSendQueue([this] {
         _congestionControl->onTimeout();
     });
@@ -219,6 +215,9 @@ void Connection::sendACK() {
     // pack in the ACK number
     _ackPacket->writePrimitive(nextACKNumber);
 
+    // past the first loss, let the sender know what did make it so that it only re-sends what is missing
+    _lossList.writeReceivedRanges(*_ackPacket, _lastReceivedSequenceNumber, MAX_SELECTIVE_ACK_RANGES);
+
     // have the socket send off our packet
     _parentSocket->writeBasePacket(*_ackPacket, _destination);
     
@@ -348,17 +347,61 @@ void Connection::processACK(ControlPacketPointer controlPacket) {
         getSendQueue().ack(ack);
     }
 
+    // peers that predate selective ACKs send the ACK number alone
+    if (controlPacket->bytesLeftToRead() >= (qint64)(2 * sizeof(SequenceNumber))) {
+        processSelectiveACKs(ack, *controlPacket);
+    }
+
     // give this ACK to the congestion control and update the send queue parameters
     updateCongestionControlAndSendQueue([this, ack, &controlPacket] {
         if (_congestionControl->onACK(ack, controlPacket->getReceiveTime())) {
             // the congestion control has told us it needs a fast re-transmit of ack + 1, add that now
             _sendQueue->fastRetransmit(ack + 1);
+            _stats.recordFastRetransmitPackets(1);
         }
     });
     
     _stats.record(ConnectionStats::Stats::ProcessedACK);
 }
 
+void Connection::processSelectiveACKs(SequenceNumber ack, ControlPacket& controlPacket) {
+    using Range = std::pair<SequenceNumber, SequenceNumber>;
+    std::vector<Range> ranges;
+    ranges.reserve(MAX_SELECTIVE_ACK_RANGES);
+
+    SequenceNumber currentSequenceNumber = getSendQueue().getCurrentSequenceNumber();
+    SequenceNumber previousEnd = ack;
+    while (controlPacket.bytesLeftToRead() >= (qint64)(2 * sizeof(SequenceNumber))
+           && ranges.size() < (size_t)MAX_SELECTIVE_ACK_RANGES) {
+        Range range;
+        controlPacket.readPrimitive(&range.first);
+        controlPacket.readPrimitive(&range.second);
+
+        // ranges come lowest first, each separated from the last (or the ACK) by at least one missing packet
+        if (range.first <= previousEnd + 1 || range.second < range.first || range.second > currentSequenceNumber) {
+            break;
+        }
+
+        ranges.push_back(range);
+        previousEnd = range.second;
+    }
+
+    // walk down from the highest range, so that we know how many packets made it past each hole
+    int numReceivedAbove = 0;
+    for (auto it = ranges.rbegin(); it != ranges.rend(); ++it) {
+        _sendQueue->selectiveAck(it->first, it->second);
+        numReceivedAbove += seqlen(it->first, it->second);
+
+        if (numReceivedAbove >= SELECTIVE_ACK_FAST_RETRANSMIT_THRESHOLD) {
+            auto next = std::next(it);
+            SequenceNumber holeStart = (next != ranges.rend()) ? next->second + 1 : ack + 1;
+            SequenceNumber holeEnd = it->first - 1;
+
+            _stats.recordFastRetransmitPackets(_sendQueue->fastRetransmitRange(holeStart, holeEnd));
+        }
+    }
+}
+
 void Connection::processHandshake(ControlPacketPointer controlPacket) {
     SequenceNumber initialSequenceNumber;
     controlPacket->readPrimitive(&initialSequenceNumber);
@@ -89,12 +89,13 @@ private slots:
     void recordRetransmission(int wireSize, int payloadSize, SequenceNumber sequenceNumber, p_high_resolution_clock::time_point timePoint);
 
     void queueInactive();
-    void queueTimeout();
+    void queueTimeout(int numRetransmitPackets);
     
 private:
     void sendACK();
     
     void processACK(ControlPacketPointer controlPacket);
+    void processSelectiveACKs(SequenceNumber ack, ControlPacket& controlPacket);
     void processHandshake(ControlPacketPointer controlPacket);
     void processHandshakeACK(ControlPacketPointer controlPacket);
     
@@ -70,6 +70,14 @@ void ConnectionStats::recordDuplicatePackets(int payload, int total) {
     _currentSample.duplicateBytes += total;
 }
 
+void ConnectionStats::recordFastRetransmitPackets(int count) {
+    _currentSample.fastRetransmitPackets += count;
+}
+
+void ConnectionStats::recordTimeoutRetransmitPackets(int count) {
+    _currentSample.timeoutRetransmitPackets += count;
+}
+
 void ConnectionStats::recordUnreliableSentPackets(int payload, int total) {
     ++_currentSample.sentUnreliablePackets;
     _currentSample.sentUnreliableUtilBytes += payload;
@@ -102,6 +110,8 @@ QDebug& operator<<(QDebug&& debug, const udt::ConnectionStats::Stats& stats) {
 
     debug << "    Sent packets: " << stats.sentPackets;
     debug << "\n    Retransmitted packets: " << stats.retransmittedPackets;
+    debug << "\n     Fast retransmit packets: " << stats.fastRetransmitPackets;
+    debug << "\n     Timeout retransmit packets: " << stats.timeoutRetransmitPackets;
     debug << "\n     Received packets: " << stats.receivedPackets;
     debug << "\n     Duplicate packets: " << stats.duplicatePackets;
     debug << "\n     Sent util bytes: " << stats.sentUtilBytes;
@@ -44,6 +44,10 @@ public:
         uint32_t retransmittedPackets { 0 };
         uint32_t duplicatePackets { 0 };
 
+        // packets queued for a re-send, by what detected their loss
+        uint32_t fastRetransmitPackets { 0 }; // duplicate or selective ACKs
+        uint32_t timeoutRetransmitPackets { 0 }; // the retransmit timeout
+
         uint64_t sentUtilBytes { 0 };
         uint64_t receivedUtilBytes { 0 };
         uint64_t retransmittedUtilBytes { 0 };
@@ -87,6 +91,9 @@ public:
 
     void recordRetransmittedPackets(int payload, int total);
     void recordDuplicatePackets(int payload, int total);
+
+    void recordFastRetransmitPackets(int count);
+    void recordTimeoutRetransmitPackets(int count);
     
     void recordUnreliableSentPackets(int payload, int total);
     void recordUnreliableReceivedPackets(int payload, int total);
@@ -182,3 +182,23 @@ void LossList::write(ControlPacket& packet, int maxPairs) {
         }
     }
 }
+
+void LossList::writeReceivedRanges(ControlPacket& packet, SequenceNumber lastReceived, int maxPairs) {
+    int writtenPairs = 0;
+
+    for (auto it = _lossList.begin(); it != _lossList.end() && writtenPairs < maxPairs; ++it) {
+        // everything between the end of this loss and the start of the next one was received
+        auto next = std::next(it);
+        SequenceNumber start = it->second + 1;
+        SequenceNumber end = (next != _lossList.end()) ? next->first - 1 : lastReceived;
+
+        if (end < start) {
+            break;
+        }
+
+        packet.writePrimitive(start);
+        packet.writePrimitive(end);
+
+        ++writtenPairs;
+    }
+}
@@ -42,6 +42,9 @@ public:
     SequenceNumber popFirstSequenceNumber();
     
     void write(ControlPacket& packet, int maxPairs = -1);
+
+    // writes the ranges received in between, and after, the losses (up to lastReceived) as pairs, lowest first
+    void writeReceivedRanges(ControlPacket& packet, SequenceNumber lastReceived, int maxPairs);
     
 private:
     std::list<std::pair<SequenceNumber, SequenceNumber>> _lossList;
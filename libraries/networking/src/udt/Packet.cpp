@@ -61,12 +61,13 @@ std::unique_ptr<Packet> Packet::create(qint64 size, bool isReliable, bool isPart
     return packet;
 }
 
-std::unique_ptr<Packet> Packet::fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size, const HifiSockAddr& senderSockAddr) {
+std::unique_ptr<Packet> Packet::fromReceivedPacket(std::unique_ptr<char[]> data, qint64 size, const HifiSockAddr& senderSockAddr,
+                                                   bool isBufferPooled) {
     // Fail with invalid size
     Q_ASSERT(size >= 0);
 
     // allocate memory
-    auto packet = std::unique_ptr<Packet>(new Packet(std::move(data), size, senderSockAddr));
+    auto packet = std::unique_ptr<Packet>(new Packet(std::move(data), size, senderSockAddr, isBufferPooled));
 
     packet->open(QIODevice::ReadOnly);
 
@@ -87,8 +88,8 @@ Packet::Packet(qint64 size, bool isReliable, bool isPartOfMessage) :
     writeHeader();
 }
 
-Packet::Packet(std::unique_ptr<char[]> data, qint64 size, const HifiSockAddr& senderSockAddr) :
-    BasePacket(std::move(data), size, senderSockAddr)
+Packet::Packet(std::unique_ptr<char[]> data, qint64 size, const HifiSockAddr& senderSockAddr, bool isBufferPooled) :
+    BasePacket(std::move(data), size, senderSockAddr, isBufferPooled)
 {
     readHeader();
 
@@ -0,0 +1,75 @@
+//
+//  PacketBufferPool.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketBufferPool.h"
+
+#include <atomic>
+#include <vector>
+
+#include <TBBHelpers.h>
+
+#include "Constants.h"
+
+using namespace udt;
+
+namespace {
+
+const size_t MAX_THREAD_BUFFERS = 64;
+const int MAX_SHARED_BUFFERS = 4096;
+
+thread_local std::vector<std::unique_ptr<char[]>> threadBuffers;
+
+tbb::concurrent_queue<char*> sharedBuffers;
+std::atomic<int> numSharedBuffers { 0 };
+
+std::atomic<uint64_t> numHits { 0 };
+std::atomic<uint64_t> numMisses { 0 };
+
+} // anonymous namespace
+
+std::unique_ptr<char[]> PacketBufferPool::acquire() {
+    if (!threadBuffers.empty()) {
+        auto buffer = std::move(threadBuffers.back());
+        threadBuffers.pop_back();
+        numHits.fetch_add(1, std::memory_order_relaxed);
+        return buffer;
+    }
+
+    char* sharedBuffer;
+    if (sharedBuffers.try_pop(sharedBuffer)) {
+        --numSharedBuffers;
+        numHits.fetch_add(1, std::memory_order_relaxed);
+        return std::unique_ptr<char[]>(sharedBuffer);
+    }
+
+    numMisses.fetch_add(1, std::memory_order_relaxed);
+    return std::unique_ptr<char[]>(new char[MAX_PACKET_SIZE]);
+}
+
+void PacketBufferPool::release(std::unique_ptr<char[]> buffer) {
+    if (!buffer) {
+        return;
+    }
+
+    if (threadBuffers.size() < MAX_THREAD_BUFFERS) {
+        threadBuffers.push_back(std::move(buffer));
+    } else if (numSharedBuffers < MAX_SHARED_BUFFERS) {
+        ++numSharedBuffers;
+        sharedBuffers.push(buffer.release());
+    }
+    // otherwise let the buffer go, the pool already holds more than enough
+}
+
+PacketBufferPool::Stats PacketBufferPool::sampleStats() {
+    Stats stats;
+    stats.hits = numHits.exchange(0);
+    stats.misses = numMisses.exchange(0);
+    return stats;
+}
@@ -0,0 +1,41 @@
+//
+//  PacketBufferPool.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PacketBufferPool_h
+#define hifi_PacketBufferPool_h
+
+#include <cstdint>
+#include <memory>
+
+namespace udt {
+
+// Recycles the MAX_PACKET_SIZE buffers that packets are built in, rather than allocating one for every packet.
+//   Each thread keeps a small free list of its own. Buffers released past that overflow into a shared list,
+//   which threads that mostly allocate (like the one reading the socket) refill from.
+class PacketBufferPool {
+public:
+    struct Stats {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+    };
+
+    // a MAX_PACKET_SIZE buffer, not initialized
+    static std::unique_ptr<char[]> acquire();
+
+    // return a buffer that came from acquire
+    static void release(std::unique_ptr<char[]> buffer);
+
+    // the number of acquires served from the pool, and the number that had to allocate, since the last call
+    static Stats sampleStats();
+};
+
+} // namespace udt
+
+#endif // hifi_PacketBufferPool_h
@@ -13,6 +13,7 @@
 
 #include <math.h>
 #include <mutex>
+#include <vector>
 
 #include <QtCore/QDataStream>
 #include <QtCore/QDebug>
@@ -27,7 +28,7 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::StunResponse:
             return 17;
         case PacketType::DomainList:
-            return static_cast<PacketVersion>(DomainListVersion::HasConnectReason);
+            return static_cast<PacketVersion>(DomainListVersion::HasPacketAuthMethod);
         case PacketType::EntityAdd:
         case PacketType::EntityClone:
         case PacketType::EntityEdit:
@@ -35,13 +36,15 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::EntityPhysics:
             return static_cast<PacketVersion>(EntityVersion::LAST_PACKET_TYPE);
         case PacketType::EntityQuery:
-            return static_cast<PacketVersion>(EntityQueryPacketVersion::ConicalFrustums);
+            return static_cast<PacketVersion>(EntityQueryPacketVersion::CompressionDictionary);
+        case PacketType::OctreeStats:
+            return static_cast<PacketVersion>(OctreeStatsVersion::CompressionStats);
         case PacketType::AvatarIdentity:
         case PacketType::AvatarData:
-            return static_cast<PacketVersion>(AvatarMixerPacketVersion::ARKitBlendshapes);
+            return static_cast<PacketVersion>(AvatarMixerPacketVersion::JointDeltas);
         case PacketType::BulkAvatarData:
         case PacketType::KillAvatar:
-            return static_cast<PacketVersion>(AvatarMixerPacketVersion::ARKitBlendshapes);
+            return static_cast<PacketVersion>(AvatarMixerPacketVersion::JointDeltas);
         case PacketType::MessagesData:
             return static_cast<PacketVersion>(MessageDataVersion::TextOrBinaryData);
         // ICE packets
@@ -64,7 +67,9 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::AssetGetInfo:
         case PacketType::AssetGet:
         case PacketType::AssetUpload:
-            return static_cast<PacketVersion>(AssetServerPacketVersion::BakingTextureMeta);
+        case PacketType::AssetGetChunks:
+        case PacketType::AssetGetChunksReply:
+            return static_cast<PacketVersion>(AssetServerPacketVersion::PaginatedMappings);
         case PacketType::NodeIgnoreRequest:
             return 18; // Introduction of node ignore request (which replaced an unused packet tpye)
 
@@ -72,10 +77,10 @@ PacketVersion versionForPacketType(PacketType packetType) {
             return static_cast<PacketVersion>(DomainConnectionDeniedVersion::IncludesExtraInfo);
 
         case PacketType::DomainConnectRequest:
-            return static_cast<PacketVersion>(DomainConnectRequestVersion::HasCompressedSystemInfo);
+            return static_cast<PacketVersion>(DomainConnectRequestVersion::HasPacketAuthMethods);
 
         case PacketType::DomainServerAddedNode:
-            return static_cast<PacketVersion>(DomainServerAddedNodeVersion::PermissionsGrid);
+            return static_cast<PacketVersion>(DomainServerAddedNodeVersion::HasPacketAuthMethod);
 
         case PacketType::EntityScriptCallMethod:
             return static_cast<PacketVersion>(EntityScriptCallMethodVersion::ClientCallable);
@@ -87,7 +92,7 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::MicrophoneAudioWithEcho:
         case PacketType::AudioStreamStats:
         case PacketType::StopInjector:
-            return static_cast<PacketVersion>(AudioVersion::StopInjectors);
+            return static_cast<PacketVersion>(AudioVersion::AmbientInjectors);
         case PacketType::DomainSettings:
             return 18;  // replace min_avatar_scale and max_avatar_scale with min_avatar_height and max_avatar_height
         case PacketType::Ping:
@@ -98,7 +103,7 @@ PacketVersion versionForPacketType(PacketType packetType) {
             return static_cast<PacketVersion>(EntityVersion::ParticleSpin);
         case PacketType::BulkAvatarTraitsAck:
         case PacketType::BulkAvatarTraits:
-            return static_cast<PacketVersion>(AvatarMixerPacketVersion::AvatarTraitsAck);
+            return static_cast<PacketVersion>(AvatarMixerPacketVersion::AvatarTraitDeltas);
         default:
             return 22;
     }
@@ -119,6 +124,20 @@ QDebug operator<<(QDebug debug, const PacketType& type) {
     return debug.space();
 }
 
+const QString& nameForPacketType(PacketType type) {
+    // built once, so that the names can be used for every packet
+    static const std::vector<QString> PACKET_TYPE_NAMES = [] {
+        QMetaEnum metaEnum = PacketTypeEnum::staticMetaObject.enumerator(PacketTypeEnum::staticMetaObject.enumeratorOffset());
+        std::vector<QString> names;
+        for (int i = 0; i < (int)PacketType::NUM_PACKET_TYPE; i++) {
+            names.push_back(metaEnum.valueToKey(i));
+        }
+        return names;
+    }();
+    static const QString UNKNOWN_NAME = "Unknown";
+    return (uint8_t)type < PACKET_TYPE_NAMES.size() ? PACKET_TYPE_NAMES[(uint8_t)type] : UNKNOWN_NAME;
+}
+
 #if (PR_BUILD || DEV_BUILD)
 static bool sendWrongProtocolVersion = false;
 void sendWrongProtocolVersionsSignature(bool sendWrongVersion) {
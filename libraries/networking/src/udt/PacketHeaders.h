@@ -136,6 +136,10 @@ public:
         BulkAvatarTraitsAck,
         StopInjector,
         AvatarZonePresence,
+        AssetGetChunks,
+        AssetGetChunksReply,
+        NodeTraceRequest,
+        NodeTraceReply,
         NUM_PACKET_TYPE
     };
 
@@ -187,7 +191,8 @@ public:
             << PacketTypeEnum::Value::ReplicatedMicrophoneAudioWithEcho << PacketTypeEnum::Value::ReplicatedInjectAudio
             << PacketTypeEnum::Value::ReplicatedSilentAudioFrame << PacketTypeEnum::Value::ReplicatedAvatarIdentity
             << PacketTypeEnum::Value::ReplicatedKillAvatar << PacketTypeEnum::Value::ReplicatedBulkAvatarData
-            << PacketTypeEnum::Value::AvatarZonePresence;
+            << PacketTypeEnum::Value::AvatarZonePresence << PacketTypeEnum::Value::NodeTraceRequest
+            << PacketTypeEnum::Value::NodeTraceReply;
         return NON_SOURCED_PACKETS;
     }
 
@@ -224,6 +229,7 @@ void sendWrongProtocolVersionsSignature(bool sendWrongVersion); /// for debuggin
 
 uint qHash(const PacketType& key, uint seed);
 QDebug operator<<(QDebug debug, const PacketType& type);
+const QString& nameForPacketType(PacketType type);
 
 // Due to the different legacy behaviour, we need special processing for domains that were created before
 // the zone inheritance modes were added.  These have version numbers up to 80
@@ -295,14 +301,21 @@ enum class EntityQueryPacketVersion: PacketVersion {
     ConnectionIdentifier = 20,
     RemovedJurisdictions = 21,
     MultiFrustumQuery = 22,
-    ConicalFrustums = 23
+    ConicalFrustums = 23,
+    CompressionDictionary = 24
+};
+
+enum class OctreeStatsVersion : PacketVersion {
+    CompressionStats = 23
 };
 
 enum class AssetServerPacketVersion: PacketVersion {
     VegasCongestionControl = 19,
     RangeRequestSupport,
     RedirectedMappings,
-    BakingTextureMeta
+    BakingTextureMeta,
+    ChunkedAssets,
+    PaginatedMappings
 };
 
 enum class AvatarMixerPacketVersion : PacketVersion {
@@ -343,7 +356,9 @@ enum class AvatarMixerPacketVersion : PacketVersion {
     FBXJointOrderChange,
     HandControllerSection,
     SendVerificationFailed,
-    ARKitBlendshapes
+    ARKitBlendshapes,
+    JointDeltas,
+    AvatarTraitDeltas
 };
 
 enum class DomainConnectRequestVersion : PacketVersion {
@@ -356,7 +371,8 @@ enum class DomainConnectRequestVersion : PacketVersion {
     HasTimestamp,
     HasReason,
     HasSystemInfo,
-    HasCompressedSystemInfo
+    HasCompressedSystemInfo,
+    HasPacketAuthMethods
 };
 
 enum class DomainConnectionDeniedVersion : PacketVersion {
@@ -367,7 +383,8 @@ enum class DomainConnectionDeniedVersion : PacketVersion {
 
 enum class DomainServerAddedNodeVersion : PacketVersion {
     PrePermissionsGrid = 17,
-    PermissionsGrid
+    PermissionsGrid,
+    HasPacketAuthMethod
 };
 
 enum class DomainListVersion : PacketVersion {
@@ -377,7 +394,8 @@ enum class DomainListVersion : PacketVersion {
     GetMachineFingerprintFromUUIDSupport,
     AuthenticationOptional,
     HasTimestamp,
-    HasConnectReason
+    HasConnectReason,
+    HasPacketAuthMethod
 };
 
 enum class AudioVersion : PacketVersion {
@@ -388,7 +406,8 @@ enum class AudioVersion : PacketVersion {
     SpaceBubbleChanges,
     HasPersonalMute,
     HighDynamicRangeVolume,
-    StopInjectors
+    StopInjectors,
+    AmbientInjectors
 };
 
 enum class MessageDataVersion : PacketVersion {
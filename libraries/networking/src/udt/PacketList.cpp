@@ -49,6 +49,7 @@ PacketList::PacketList(PacketList&& other) :
     _packets(std::move(other._packets)),
     _isOrdered(other._isOrdered),
     _isReliable(other._isReliable),
+    _priorityWeight(other._priorityWeight),
     _extendedHeader(std::move(other._extendedHeader))
 {
 }
@@ -12,6 +12,7 @@
 #ifndef hifi_PacketList_h
 #define hifi_PacketList_h
 
+#include <algorithm>
 #include <memory>
 
 #include "../ExtendedIODevice.h"
@@ -29,6 +30,10 @@ class PacketList : public ExtendedIODevice {
 public:
     using MessageNumber = uint32_t;
     using PacketPointer = std::unique_ptr<Packet>;
+
+    static const int DEFAULT_PRIORITY_WEIGHT = 1;
+    // for the small reliable messages that shouldn't wait for the bulk transfers, like traits and messages-mixer data
+    static const int LATENCY_SENSITIVE_PRIORITY_WEIGHT = 4;
     
     static std::unique_ptr<PacketList> create(PacketType packetType, QByteArray extendedHeader = QByteArray(),
                                               bool isReliable = false, bool isOrdered = false);
@@ -37,6 +42,11 @@ public:
     PacketType getType() const { return _packetType; }
     bool isReliable() const { return _isReliable; }
     bool isOrdered() const { return _isOrdered; }
+
+    // how many packets of this reliable list are sent each time the send queue comes around to it, the lists of a
+    // higher weight are also queued ahead of the ones of a lower weight
+    int getPriorityWeight() const { return _priorityWeight; }
+    void setPriorityWeight(int priorityWeight) { _priorityWeight = std::max(priorityWeight, 1); }
     
     size_t getNumPackets() const { return _packets.size() + (_currentPacket ? 1 : 0); }
     size_t getDataSize() const;
@@ -96,6 +106,7 @@ private:
     
     Packet::MessageNumber _messageNumber;
     bool _isReliable = false;
+    int _priorityWeight { DEFAULT_PRIORITY_WEIGHT };
     
     std::unique_ptr<Packet> _currentPacket;
     
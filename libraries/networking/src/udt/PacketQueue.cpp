@@ -11,12 +11,14 @@
 
 #include "PacketQueue.h"
 
+#include <algorithm>
+
 #include "PacketList.h"
 
 using namespace udt;
 
 PacketQueue::PacketQueue(MessageNumber messageNumber) : _currentMessageNumber(messageNumber) {
-    _channels.emplace_front(new std::list<PacketPointer>());
+    _channels.emplace_front(new RawChannel { {}, PacketList::DEFAULT_PRIORITY_WEIGHT });
     _currentChannel = _channels.begin();
 }
 
@@ -30,7 +32,7 @@ bool PacketQueue::isEmpty() const {
     LockGuard locker(_packetsLock);
 
     // Only the main channel and it is empty
-    return _channels.size() == 1 && _channels.front()->empty();
+    return _channels.size() == 1 && _channels.front()->packets.empty();
 }
 
 PacketQueue::PacketPointer PacketQueue::takePacket() {
@@ -41,8 +43,9 @@ PacketQueue::PacketPointer PacketQueue::takePacket() {
     }
 
     // handle the case where we are looking at the first channel and it is empty
-    if (_currentChannel == _channels.begin() && (*_currentChannel)->empty()) {
+    if (_currentChannel == _channels.begin() && (*_currentChannel)->packets.empty()) {
         ++_currentChannel;
+        _packetsTakenFromCurrentChannel = 0;
     }
 
     // at this point the current channel should always not be at the end and should also not be empty
@@ -50,19 +53,24 @@ PacketQueue::PacketPointer PacketQueue::takePacket() {
 
     auto& channel = *_currentChannel;
 
-    Q_ASSERT(!channel->empty());
+    Q_ASSERT(!channel->packets.empty());
 
     // Take front packet
-    auto packet = std::move(channel->front());
-    channel->pop_front();
+    auto packet = std::move(channel->packets.front());
+    channel->packets.pop_front();
+    ++_packetsTakenFromCurrentChannel;
 
     // Remove now empty channel (Don't remove the main channel)
-    if (channel->empty() && _currentChannel != _channels.begin()) {
+    if (channel->packets.empty() && _currentChannel != _channels.begin()) {
         // erase the current channel and slide the iterator to the next channel
         _currentChannel = _channels.erase(_currentChannel);
+    } else if (_packetsTakenFromCurrentChannel < channel->priorityWeight && !channel->packets.empty()) {
+        // the channel gets more than one packet each time around
+        return packet;
     } else {
         ++_currentChannel;
     }
+    _packetsTakenFromCurrentChannel = 0;
 
     // push forward our number of channels taken from
     ++_channelsVisitedCount;
@@ -81,7 +89,7 @@ PacketQueue::PacketPointer PacketQueue::takePacket() {
 
 void PacketQueue::queuePacket(PacketPointer packet) {
     LockGuard locker(_packetsLock);
-    _channels.front()->push_back(std::move(packet));
+    _channels.front()->packets.push_back(std::move(packet));
 }
 
 void PacketQueue::queuePacketList(PacketListPointer packetList) {
@@ -89,7 +97,15 @@ void PacketQueue::queuePacketList(PacketListPointer packetList) {
         packetList->preparePackets(getNextMessageNumber());
     }
 
+    Channel channel { new RawChannel { {}, packetList->getPriorityWeight() } };
+    channel->packets.swap(packetList->_packets);
+
     LockGuard locker(_packetsLock);
-    _channels.emplace_back(new std::list<PacketPointer>());
-    _channels.back()->swap(packetList->_packets);
+
+    // the lists of a higher weight go ahead of those already queued, so that they are among the channels that are
+    // sent concurrently rather than waiting for the lists ahead of them to be done
+    auto it = std::find_if(std::next(_channels.begin()), _channels.end(), [&](const Channel& queuedChannel) {
+        return queuedChannel->priorityWeight < channel->priorityWeight;
+    });
+    _channels.insert(it, std::move(channel));
 }
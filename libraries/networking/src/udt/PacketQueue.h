@@ -30,7 +30,10 @@ class PacketQueue {
     using LockGuard = std::lock_guard<Mutex>;
     using PacketPointer = std::unique_ptr<Packet>;
     using PacketListPointer = std::unique_ptr<PacketList>;
-    using RawChannel = std::list<PacketPointer>;
+    struct RawChannel {
+        std::list<PacketPointer> packets;
+        int priorityWeight; // packets taken each time around
+    };
     using Channel = std::unique_ptr<RawChannel>;
     using Channels = std::list<Channel>;
     
@@ -52,10 +55,11 @@ private:
     MessageNumber _currentMessageNumber { 0 };
     
     mutable Mutex _packetsLock; // Protects the packets to be sent.
-    Channels _channels; // One channel per packet list + Main channel
+    Channels _channels; // One channel per packet list, by decreasing priority weight + Main channel
 
     Channels::iterator _currentChannel;
     unsigned int _channelsVisitedCount { 0 };
+    int _packetsTakenFromCurrentChannel { 0 };
 };
 
 }
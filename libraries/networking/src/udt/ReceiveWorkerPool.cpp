@@ -0,0 +1,84 @@
+//
+//  ReceiveWorkerPool.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ReceiveWorkerPool.h"
+
+using namespace udt;
+
+ReceiveWorkerPool::ReceiveWorkerPool(int numWorkers, FilterOperator filterOperator, WakeOperator wakeOperator) :
+    _filterOperator(filterOperator),
+    _wakeOperator(wakeOperator)
+{
+    _workers.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        _workers.emplace_back(new Worker());
+    }
+    for (auto& worker : _workers) {
+        Worker* rawWorker = worker.get();
+        worker->thread = std::thread([this, rawWorker] { run(*rawWorker); });
+    }
+}
+
+ReceiveWorkerPool::~ReceiveWorkerPool() {
+    stop();
+
+    Packet* packet;
+    while (_verified.try_pop(packet)) {
+        delete packet;
+    }
+}
+
+void ReceiveWorkerPool::stop() {
+    // a null packet tells a worker to stop, once it has gone through what was queued before it
+    for (auto& worker : _workers) {
+        if (worker->thread.joinable()) {
+            worker->inbound.push(nullptr);
+        }
+    }
+    for (auto& worker : _workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+void ReceiveWorkerPool::push(std::unique_ptr<Packet> packet) {
+    size_t shard = std::hash<HifiSockAddr>()(packet->getSenderSockAddr()) % _workers.size();
+    _workers[shard]->inbound.push(packet.release());
+}
+
+void ReceiveWorkerPool::drainVerified(const PacketHandler& handler) {
+    // clear the flag first, so a packet verified while we drain causes another wake rather than being stranded
+    _isWakePending = false;
+
+    Packet* packet;
+    while (_verified.try_pop(packet)) {
+        handler(std::unique_ptr<Packet>(packet));
+    }
+}
+
+void ReceiveWorkerPool::run(Worker& worker) {
+    while (true) {
+        Packet* packet;
+        worker.inbound.pop(packet);
+        if (!packet) {
+            return;
+        }
+
+        if (!_filterOperator || _filterOperator(*packet)) {
+            _verified.push(packet);
+            if (!_isWakePending.exchange(true)) {
+                _wakeOperator();
+            }
+        } else {
+            delete packet;
+        }
+    }
+}
@@ -0,0 +1,68 @@
+//
+//  ReceiveWorkerPool.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ReceiveWorkerPool_h
+#define hifi_ReceiveWorkerPool_h
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <TBBHelpers.h>
+
+#include "Packet.h"
+
+namespace udt {
+
+// Verifies received packets on a set of worker threads, off the thread that reads the socket.
+//   Packets are sharded across the workers by sender, so that the packets of any one sender are verified,
+//   and come back out, in the order they were received. Verified packets are collected in a lock-free queue
+//   for the socket thread to dispatch, and the wake operator is called when that queue stops being empty.
+class ReceiveWorkerPool {
+public:
+    using FilterOperator = std::function<bool(const Packet&)>;
+    using WakeOperator = std::function<void()>;
+    using PacketHandler = std::function<void(std::unique_ptr<Packet>)>;
+
+    ReceiveWorkerPool(int numWorkers, FilterOperator filterOperator, WakeOperator wakeOperator);
+    ~ReceiveWorkerPool();
+
+    // wait for the workers to go through everything pushed so far, and stop them
+    void stop();
+
+    int numWorkers() const { return (int)_workers.size(); }
+
+    // hand a received packet off to the worker for its sender, callable from the socket thread only
+    void push(std::unique_ptr<Packet> packet);
+
+    // call handler with every packet verified so far, callable from the socket thread only
+    void drainVerified(const PacketHandler& handler);
+
+private:
+    struct Worker {
+        tbb::concurrent_bounded_queue<Packet*> inbound;
+        std::thread thread;
+    };
+
+    void run(Worker& worker);
+
+    FilterOperator _filterOperator;
+    WakeOperator _wakeOperator;
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    tbb::concurrent_queue<Packet*> _verified;
+    std::atomic<bool> _isWakePending { false };
+};
+
+} // namespace udt
+
+#endif // hifi_ReceiveWorkerPool_h
@@ -12,12 +12,10 @@
 #include "SendQueue.h"
 
 #include <algorithm>
-#include <thread>
+#include <vector>
 
-#include <QtCore/QCoreApplication>
 #include <QtCore/QDateTime>
 #include <QtCore/QJsonObject>
-#include <QtCore/QThread>
 
 #include <LogHandler.h>
 #include <NumericalConstants.h>
@@ -71,19 +69,9 @@ std::unique_ptr<SendQueue> SendQueue::create(Socket* socket, HifiSockAddr destin
     auto queue = std::unique_ptr<SendQueue>(new SendQueue(socket, destination, currentSequenceNumber,
                                                           currentMessageNumber, hasReceivedHandshakeACK));
 
-    // Setup queue private thread
-    QThread* thread = new QThread;
-    thread->setObjectName("Networking: SendQueue " + destination.objectName()); // Name thread for easier debug
-    
-    connect(thread, &QThread::started, queue.get(), &SendQueue::run);
-    
-    connect(queue.get(), &QObject::destroyed, thread, &QThread::quit); // Thread auto cleanup
-    connect(thread, &QThread::finished, thread, &QThread::deleteLater); // Thread auto cleanup
-    
-    // Move queue to private thread and start it
-    queue->moveToThread(thread);
-    
-    thread->start();
+    // the queue is stepped on the shared sender threads, the first step starts the handshake
+    SendQueue* rawQueue = queue.get();
+    queue->_schedulerID = SendScheduler::getInstance().add([rawQueue] { return rawQueue->step(); });
     
     return queue;
 }
@@ -100,44 +88,45 @@ SendQueue::SendQueue(Socket* socket, HifiSockAddr dest, SequenceNumber currentSe
     _lastACKSequenceNumber = uint32_t(_currentSequenceNumber);
 
     _hasReceivedHandshakeACK = hasReceivedHandshakeACK;
+
+    _nextPacketTimestamp = p_high_resolution_clock::now();
 }
 
 SendQueue::~SendQueue() {
+    // waits for a step that is running on one of the sender threads
+    SendScheduler::getInstance().remove(_schedulerID);
 }
 
 void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
     _packets.queuePacket(std::move(packet));
     
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
-    
-    if (!thread()->isRunning() && _state == State::NotStarted) {
-        thread()->start();
-    }
+    // wake the queue in case it is waiting for packets
+    wake();
 }
 
 void SendQueue::queuePacketList(std::unique_ptr<PacketList> packetList) {
     _packets.queuePacketList(std::move(packetList));
     
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
-    
-    if (!thread()->isRunning() && _state == State::NotStarted) {
-        thread()->start();
-    }
+    // wake the queue in case it is waiting for packets
+    wake();
 }
 
 void SendQueue::stop() {
     
     _state = State::Stopped;
     
-    // Notify all conditions in case we're waiting somewhere
-    _handshakeACKCondition.notify_one();
-    _emptyCondition.notify_one();
+    // wake the queue so that it is no longer stepped
+    wake();
+}
+
+void SendQueue::wake() {
+    _wasWoken = true;
+    SendScheduler::getInstance().wake(_schedulerID);
 }
     
 int SendQueue::sendPacket(const Packet& packet) {
-    _lastPacketSentAt = std::chrono::high_resolution_clock::now();
+    _lastPacketSentAt = p_high_resolution_clock::now();
+    std::lock_guard<std::mutex> destinationLocker(_destinationLock);
     return _socket->writeDatagram(packet.getData(), packet.getDataSize(), _destination);
 }
     
@@ -164,8 +153,8 @@ void SendQueue::ack(SequenceNumber ack) {
     
     _lastACKSequenceNumber = (uint32_t) ack;
 
-    // call notify_one on the condition_variable_any in case the send thread is sleeping with a full congestion window
-    _emptyCondition.notify_one();
+    // wake the queue in case it is waiting with a full congestion window
+    wake();
 }
 
 void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
@@ -174,8 +163,53 @@ void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
         _naks.insert(ack, ack);
     }
 
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for losses to re-send
-    _emptyCondition.notify_one();
+    // wake the queue in case it is waiting for losses to re-send
+    wake();
+}
+
+void SendQueue::selectiveAck(SequenceNumber start, SequenceNumber end) {
+    int numReleased = 0;
+    {
+        QWriteLocker locker(&_sentLock);
+        for (auto seq = start; seq <= end; ++seq) {
+            numReleased += (int)_sentPackets.erase(seq);
+        }
+    }
+
+    if (numReleased > 0) {
+        // they may have been queued for a re-send by a timeout already
+        std::lock_guard<std::mutex> nakLocker(_naksLock);
+        _naks.remove(start, end);
+    }
+}
+
+int SendQueue::fastRetransmitRange(SequenceNumber start, SequenceNumber end) {
+    std::vector<SequenceNumber> resendNumbers;
+    {
+        QWriteLocker locker(&_sentLock);
+        for (auto seq = start; seq <= end; ++seq) {
+            auto it = _sentPackets.find(seq);
+            if (it != _sentPackets.end() && !it->second.wasFastRetransmitted) {
+                // every later ACK reports the same hole, only the first should trigger a re-send
+                it->second.wasFastRetransmitted = true;
+                resendNumbers.push_back(seq);
+            }
+        }
+    }
+
+    if (!resendNumbers.empty()) {
+        {
+            std::lock_guard<std::mutex> nakLocker(_naksLock);
+            for (auto seq : resendNumbers) {
+                _naks.insert(seq, seq);
+            }
+        }
+
+        // wake the queue in case it is waiting for losses to re-send
+        wake();
+    }
+
+    return (int)resendNumbers.size();
 }
 
 void SendQueue::sendHandshake() {
@@ -187,11 +221,8 @@ void SendQueue::sendHandshake() {
         SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
         auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
         handshakePacket->writePrimitive(initialSequenceNumber);
+        std::lock_guard<std::mutex> destinationLocker(_destinationLock);
         _socket->writeBasePacket(*handshakePacket, _destination);
-        
-        // we wait for the ACK or the re-send interval to expire
-        static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
-        _handshakeACKCondition.wait_for(handshakeLock, HANDSHAKE_RESEND_INTERVAL);
     }
 }
 
@@ -201,8 +232,8 @@ void SendQueue::handshakeACK() {
         _hasReceivedHandshakeACK = true;
     }
 
-    // Notify on the handshake ACK condition
-    _handshakeACKCondition.notify_one();
+    // wake the queue so it starts sending rather than waiting to re-send the handshake
+    wake();
 }
 
 SequenceNumber SendQueue::getNextSequenceNumber() {
@@ -226,8 +257,9 @@ bool SendQueue::sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket,
         // Insert the packet we have just sent in the sent list
         QWriteLocker locker(&_sentLock);
         auto& entry = _sentPackets[newPacket->getSequenceNumber()];
-        entry.first = 0; // No resend
-        entry.second.swap(newPacket);
+        entry.numResends = 0; // No resend
+        entry.wasFastRetransmitted = false;
+        entry.packet.swap(newPacket);
     }
     Q_ASSERT_X(!newPacket, "SendQueue::sendNewPacketAndAddToSentList()", "Overriden packet in sent list");
 
@@ -246,113 +278,117 @@ bool SendQueue::sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket,
     }
 }
 
-void SendQueue::run() {
+SendScheduler::TimePoint SendQueue::step() {
     if (_state == State::Stopped) {
-        // we've already been asked to stop before we even got a chance to start
-        // don't start now
+        // we've been asked to stop, possibly before we even got a chance to start
 #ifdef UDT_CONNECTION_DEBUG
-        qCDebug(networking) << "SendQueue asked to run after being told to stop. Will not run.";
+        qCDebug(networking) << "SendQueue stepped after being told to stop. Will not step again.";
 #endif
-        return;
-    } else if (_state == State::Running) {
-#ifdef UDT_CONNECTION_DEBUG
-        qCDebug(networking) << "SendQueue asked to run but is already running (according to state). Will not re-run.";
-#endif
-        return;
+        return SendScheduler::never();
     }
     
     _state = State::Running;
+
+    bool wasWoken = _wasWoken.exchange(false);
+    auto now = p_high_resolution_clock::now();
     
     // Wait for handshake to be complete
-    while (_state == State::Running && !_hasReceivedHandshakeACK) {
-        sendHandshake();
+    if (!_hasReceivedHandshakeACK) {
+        // re-send the handshake every interval, the handshake ACK wakes us as soon as it comes in.
+        // No packets will be sent if no handshake ACK has been received.
+        static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
+        if (now >= _nextHandshakeAt) {
+            sendHandshake();
+            _nextHandshakeAt = now + HANDSHAKE_RESEND_INTERVAL;
+        }
+        return _nextHandshakeAt;
+    }
 
-        // Keep processing events
-        QCoreApplication::sendPostedEvents(this);
-        
-        // Once we're here we've either received the handshake ACK or it's going to be time to re-send a handshake.
-        // Either way let's continue processing - no packets will be sent if no handshake ACK has been received.
+    if (!_hasStartedSending) {
+        // Keep an HRC to know when the next packet should have been
+        _hasStartedSending = true;
+        _nextPacketTimestamp = now;
+    } else if (now < _pacedUntil) {
+        // an event woke us before the next packet is due, it will be handled then
+        return _pacedUntil;
+    }
+
+    bool attemptedToSendPacket = maybeResendPacket();
+    
+    // if we didn't find a packet to re-send AND we think we can fit a new packet on the wire
+    // (this is according to the current flow window size) then we send out a new packet
+    auto newPacketCount = 0;
+    if (!attemptedToSendPacket) {
+        newPacketCount = maybeSendNewPacket();
+        attemptedToSendPacket = (newPacketCount > 0);
+    }
+    
+    // check now if we were just told to stop while we were sending
+    if (_state != State::Running) {
+        return SendScheduler::never();
     }
 
-    // Keep an HRC to know when the next packet should have been
-    auto nextPacketTimestamp = p_high_resolution_clock::now();
+    if (!attemptedToSendPacket) {
+        return stepInactive(now, wasWoken);
+    }
+    _inactiveDeadline = p_high_resolution_clock::time_point();
 
-    while (_state == State::Running) {
-        bool attemptedToSendPacket = maybeResendPacket();
-        
-        // if we didn't find a packet to re-send AND we think we can fit a new packet on the wire
-        // (this is according to the current flow window size) then we send out a new packet
-        auto newPacketCount = 0;
-        if (!attemptedToSendPacket) {
-            newPacketCount = maybeSendNewPacket();
-            attemptedToSendPacket = (newPacketCount > 0);
-        }
-        
-        // since we're a while loop, give the thread a chance to process events
-        QCoreApplication::sendPostedEvents(this);
-        
-        // we just processed events so check now if we were just told to stop
-        // If the send queue has been innactive, skip the sleep for
-        // Either _isRunning will have been set to false and we'll break
-        // Or something happened and we'll keep going
-        if (_state != State::Running || isInactive(attemptedToSendPacket)) {
-            return;
-        }
+    if (_packetSendPeriod <= 0) {
+        return now;
+    }
 
-        if (_packetSendPeriod > 0) {
-            // push the next packet timestamp forwards by the current packet send period
-            auto nextPacketDelta = (newPacketCount == 2 ? 2 : 1) * _packetSendPeriod;
-            nextPacketTimestamp += std::chrono::microseconds(nextPacketDelta);
+    // push the next packet timestamp forwards by the current packet send period
+    auto nextPacketDelta = (newPacketCount == 2 ? 2 : 1) * _packetSendPeriod;
+    _nextPacketTimestamp += std::chrono::microseconds(nextPacketDelta);
 
-            // sleep as long as we need for next packet send, if we can
-            auto now = p_high_resolution_clock::now();
+    // wait as long as we need for next packet send, if we can
+    now = p_high_resolution_clock::now();
 
-            auto timeToSleep = duration_cast<microseconds>(nextPacketTimestamp - now);
+    auto timeToSleep = duration_cast<microseconds>(_nextPacketTimestamp - now);
 
-            // we use nextPacketTimestamp so that we don't fall behind, not to force long sleeps
-            // we'll never allow nextPacketTimestamp to force us to sleep for more than nextPacketDelta
-            // so cap it to that value
-            if (timeToSleep > std::chrono::microseconds(nextPacketDelta)) {
-                // reset the nextPacketTimestamp so that it is correct next time we come around
-                nextPacketTimestamp = now + std::chrono::microseconds(nextPacketDelta);
+    // we use nextPacketTimestamp so that we don't fall behind, not to force long waits
+    // we'll never allow nextPacketTimestamp to force us to wait for more than nextPacketDelta
+    // so cap it to that value
+    if (timeToSleep > std::chrono::microseconds(nextPacketDelta)) {
+        // reset the nextPacketTimestamp so that it is correct next time we come around
+        _nextPacketTimestamp = now + std::chrono::microseconds(nextPacketDelta);
 
-                timeToSleep = std::chrono::microseconds(nextPacketDelta);
-            }
+        timeToSleep = std::chrono::microseconds(nextPacketDelta);
+    }
 
-            // we're seeing SendQueues sleep for a long period of time here,
-            // which can lock the NodeList if it's attempting to clear connections
-            // for now we guard this by capping the time this thread and sleep for
-
-            const microseconds MAX_SEND_QUEUE_SLEEP_USECS { 2000000 };
-            if (timeToSleep > MAX_SEND_QUEUE_SLEEP_USECS) {
-                qWarning() << "udt::SendQueue wanted to sleep for" << timeToSleep.count() << "microseconds";
-                qWarning() << "Capping sleep to" << MAX_SEND_QUEUE_SLEEP_USECS.count();
-                qWarning() << "PSP:" << _packetSendPeriod << "NPD:" << nextPacketDelta
-                << "NPT:" << nextPacketTimestamp.time_since_epoch().count()
-                << "NOW:" << now.time_since_epoch().count();
-
-                // alright, we're in a weird state
-                // we want to know why this is happening so we can implement a better fix than this guard
-                // send some details up to the API (if the user allows us) that indicate how we could such a large timeToSleep
-                static const QString SEND_QUEUE_LONG_SLEEP_ACTION = "sendqueue-sleep";
-
-                // setup a json object with the details we want
-                QJsonObject longSleepObject;
-                longSleepObject["timeToSleep"] = qint64(timeToSleep.count());
-                longSleepObject["packetSendPeriod"] = _packetSendPeriod.load();
-                longSleepObject["nextPacketDelta"] = nextPacketDelta;
-                longSleepObject["nextPacketTimestamp"] = qint64(nextPacketTimestamp.time_since_epoch().count());
-                longSleepObject["then"] = qint64(now.time_since_epoch().count());
-
-                // hopefully send this event using the user activity logger
-                UserActivityLogger::getInstance().logAction(SEND_QUEUE_LONG_SLEEP_ACTION, longSleepObject);
-                
-                timeToSleep = MAX_SEND_QUEUE_SLEEP_USECS;
-            }
-            
-            std::this_thread::sleep_for(timeToSleep);
-        }
+    // we're seeing SendQueues wait for a long period of time here,
+    // which can hold up the NodeList if it's attempting to clear connections
+    // for now we guard this by capping the time this queue can wait
+
+    const microseconds MAX_SEND_QUEUE_SLEEP_USECS { 2000000 };
+    if (timeToSleep > MAX_SEND_QUEUE_SLEEP_USECS) {
+        qWarning() << "udt::SendQueue wanted to sleep for" << timeToSleep.count() << "microseconds";
+        qWarning() << "Capping sleep to" << MAX_SEND_QUEUE_SLEEP_USECS.count();
+        qWarning() << "PSP:" << _packetSendPeriod << "NPD:" << nextPacketDelta
+        << "NPT:" << _nextPacketTimestamp.time_since_epoch().count()
+        << "NOW:" << now.time_since_epoch().count();
+
+        // alright, we're in a weird state
+        // we want to know why this is happening so we can implement a better fix than this guard
+        // send some details up to the API (if the user allows us) that indicate how we could such a large timeToSleep
+        static const QString SEND_QUEUE_LONG_SLEEP_ACTION = "sendqueue-sleep";
+
+        // setup a json object with the details we want
+        QJsonObject longSleepObject;
+        longSleepObject["timeToSleep"] = qint64(timeToSleep.count());
+        longSleepObject["packetSendPeriod"] = _packetSendPeriod.load();
+        longSleepObject["nextPacketDelta"] = nextPacketDelta;
+        longSleepObject["nextPacketTimestamp"] = qint64(_nextPacketTimestamp.time_since_epoch().count());
+        longSleepObject["then"] = qint64(now.time_since_epoch().count());
+
+        // hopefully send this event using the user activity logger
+        UserActivityLogger::getInstance().logAction(SEND_QUEUE_LONG_SLEEP_ACTION, longSleepObject);
+        
+        timeToSleep = MAX_SEND_QUEUE_SLEEP_USECS;
     }
+
+    _pacedUntil = now + timeToSleep;
+    return _pacedUntil;
 }
 
 int SendQueue::maybeSendNewPacket() {
@@ -401,10 +437,11 @@ bool SendQueue::maybeResendPacket() {
 
                 auto& entry = it->second;
                 // we found the packet - grab it
-                auto& resendPacket = *(entry.second);
-                ++entry.first; // Add 1 resend
+                auto& resendPacket = *(entry.packet);
+                ++entry.numResends; // Add 1 resend
 
-                Packet::ObfuscationLevel level = (Packet::ObfuscationLevel)(entry.first < 2 ? 0 : (entry.first - 2) % 4);
+                Packet::ObfuscationLevel level =
+                    (Packet::ObfuscationLevel)(entry.numResends < 2 ? 0 : (entry.numResends - 2) % 4);
 
                 auto wireSize = resendPacket.getWireSize();
                 auto payloadSize = resendPacket.getPayloadSize();
@@ -463,88 +500,96 @@ bool SendQueue::maybeResendPacket() {
     return false;
 }
 
-bool SendQueue::isInactive(bool attemptedToSendPacket) {
-    // check for connection timeout first
+SendScheduler::TimePoint SendQueue::stepInactive(p_high_resolution_clock::time_point now, bool wasWoken) {
+    // During our processing above we didn't send any packets
+    
+    // If that is still the case we wait for an event that gives us data to handle, or a timeout.
+    // To confirm that the queue of packets and the NAKs list are still both empty we'll need to use the DoubleLock
+    using DoubleLock = DoubleLock<std::recursive_mutex, std::mutex>;
+    DoubleLock doubleLock(_packets.getLock(), _naksLock);
+    DoubleLock::Lock locker(doubleLock, std::try_to_lock);
+    
+    if (!locker.owns_lock() || !((_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty())) {
+        // there is something to send after all, step again right away
+        _inactiveDeadline = p_high_resolution_clock::time_point();
+        return now;
+    }
+    
+    // The packets queue and loss list mutexes are now both locked and they're both empty
+    bool isAllACKed = uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber);
 
-    if (!attemptedToSendPacket) {
-        // During our processing above we didn't send any packets
-        
-        // If that is still the case we should use a condition_variable_any to sleep until we have data to handle.
-        // To confirm that the queue of packets and the NAKs list are still both empty we'll need to use the DoubleLock
-        using DoubleLock = DoubleLock<std::recursive_mutex, std::mutex>;
-        DoubleLock doubleLock(_packets.getLock(), _naksLock);
-        DoubleLock::Lock locker(doubleLock, std::try_to_lock);
-        
-        if (locker.owns_lock() && (_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty()) {
-            // The packets queue and loss list mutexes are now both locked and they're both empty
-            
-            if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
-                // we've sent the client as much data as we have (and they've ACKed it)
-                // either wait for new data to send or 5 seconds before cleaning up the queue
-                static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = std::chrono::seconds(5);
-                
-                // use our condition_variable_any to wait
-                auto cvStatus = _emptyCondition.wait_for(locker, EMPTY_QUEUES_INACTIVE_TIMEOUT);
-                
-                if (cvStatus == std::cv_status::timeout && (_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty()) {
+    microseconds inactiveTimeout;
+    if (isAllACKed) {
+        // we've sent the client as much data as we have (and they've ACKed it)
+        // either wait for new data to send or 5 seconds before cleaning up the queue
+        static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = std::chrono::seconds(5);
+        inactiveTimeout = EMPTY_QUEUES_INACTIVE_TIMEOUT;
+    } else {
+        // We think the client is still waiting for data (based on the sequence number gap)
+        // Let's wait either for a response from the client or until the estimated timeout
+        // (plus the sync interval to allow the client to respond) has elapsed
+
+        // Clamp timeout beween 10 ms and 5 s
+        inactiveTimeout = std::min(MAXIMUM_ESTIMATED_TIMEOUT, std::max(MINIMUM_ESTIMATED_TIMEOUT, microseconds(_estimatedTimeout)));
+    }
 
+    bool isWaiting = _inactiveDeadline != p_high_resolution_clock::time_point();
+    if (isWaiting && !wasWoken && now < _inactiveDeadline) {
+        // stepped early without an event, keep waiting
+        return _inactiveDeadline;
+    }
+    bool hasTimedOut = isWaiting && !wasWoken;
+
+    if (isWaiting && isAllACKed && hasTimedOut) {
 #ifdef UDT_CONNECTION_DEBUG
-                    qCDebug(networking) << "SendQueue to" << _destination << "has been empty for"
-                        << EMPTY_QUEUES_INACTIVE_TIMEOUT.count()
-                        << "seconds and receiver has ACKed all packets."
-                        << "The queue is now inactive and will be stopped.";
+        qCDebug(networking) << "SendQueue to" << _destination << "has been empty for"
+            << inactiveTimeout.count() << "microseconds and receiver has ACKed all packets."
+            << "The queue is now inactive and will be stopped.";
 #endif
 
-                    // we have the lock again - Make sure to unlock it
-                    locker.unlock();
-                    
-                    // Deactivate queue
-                    deactivate();
-                    return true;
-                }
+        // we have the lock - Make sure to unlock it
+        locker.unlock();
+        
+        // Deactivate queue
+        deactivate();
+        return SendScheduler::never();
+    }
 
-            } else {
-                // We think the client is still waiting for data (based on the sequence number gap)
-                // Let's wait either for a response from the client or until the estimated timeout
-                // (plus the sync interval to allow the client to respond) has elapsed
-
-                auto estimatedTimeout = std::chrono::microseconds(_estimatedTimeout);
-
-                // Clamp timeout beween 10 ms and 5 s
-                estimatedTimeout = std::min(MAXIMUM_ESTIMATED_TIMEOUT, std::max(MINIMUM_ESTIMATED_TIMEOUT, estimatedTimeout));
-
-                // use our condition_variable_any to wait
-                auto cvStatus = _emptyCondition.wait_for(locker, estimatedTimeout);
-
-                // when we wake-up check if we're "stuck" either if we've slept for the estimated timeout
-                // or it has been that long since the last time we sent a packet
-
-                // we are stuck if all of the following are true
-                // - there are no new packets to send or the flow window is full and we can't send any new packets
-                // - there are no packets to resend
-                // - the client has yet to ACK some sent packets
-                auto now = std::chrono::high_resolution_clock::now();
-
-                if ((cvStatus == std::cv_status::timeout || (now - _lastPacketSentAt > estimatedTimeout))
-                    && (_packets.isEmpty() || isFlowWindowFull())
-                    && _naks.isEmpty()
-                    && SequenceNumber(_lastACKSequenceNumber) < _currentSequenceNumber) {
-                    // after a timeout if we still have sent packets that the client hasn't ACKed we
-                    // add them to the loss list
-                    
-                    // Note that thanks to the DoubleLock we have the _naksLock right now
-                    _naks.append(SequenceNumber(_lastACKSequenceNumber) + 1, _currentSequenceNumber);
-
-                    // we have the lock again - time to unlock it
-                    locker.unlock();
-                    
-                    emit timeout();
-                }
-            }
+    // when we wake-up check if we're "stuck" either if we've waited for the estimated timeout
+    // or it has been that long since the last time we sent a packet
+
+    // we are stuck if all of the following are true
+    // - there are no new packets to send or the flow window is full and we can't send any new packets
+    // - there are no packets to resend
+    // - the client has yet to ACK some sent packets
+    if (isWaiting && !isAllACKed && (hasTimedOut || now - _lastPacketSentAt > inactiveTimeout)
+        && SequenceNumber(_lastACKSequenceNumber) < _currentSequenceNumber) {
+        // after a timeout if we still have sent packets that the client hasn't ACKed we
+        // add them to the loss list
+        
+        // Note that thanks to the DoubleLock we have the _naksLock right now
+        _naks.append(SequenceNumber(_lastACKSequenceNumber) + 1, _currentSequenceNumber);
+
+        // we have the lock - time to unlock it
+        locker.unlock();
+
+        // the selectively ACKed packets in that range were already released, and will be skipped
+        int numRetransmitPackets = 0;
+        {
+            QReadLocker sentLocker(&_sentLock);
+            numRetransmitPackets = (int)_sentPackets.size();
         }
+
+        emit timeout(numRetransmitPackets);
+
+        // re-send them right away
+        _inactiveDeadline = p_high_resolution_clock::time_point();
+        return now;
     }
-    
-    return false;
+
+    // start waiting, or wait again after an event that didn't give us anything to send
+    _inactiveDeadline = now + inactiveTimeout;
+    return _inactiveDeadline;
 }
 
 void SendQueue::deactivate() {
@@ -559,5 +604,6 @@ bool SendQueue::isFlowWindowFull() const {
 }
 
 void SendQueue::updateDestinationAddress(HifiSockAddr newAddress) {
+    std::lock_guard<std::mutex> destinationLocker(_destinationLock);
     _destination = newAddress;
 }
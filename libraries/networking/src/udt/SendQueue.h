@@ -13,7 +13,6 @@
 #define hifi_SendQueue_h
 
 #include <atomic>
-#include <condition_variable>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -29,6 +28,7 @@
 
 #include "Constants.h"
 #include "PacketQueue.h"
+#include "SendScheduler.h"
 #include "SequenceNumber.h"
 #include "LossList.h"
 
@@ -74,6 +74,11 @@ public slots:
     
     void ack(SequenceNumber ack);
     void fastRetransmit(SequenceNumber ack);
+
+    // release the sent packets in a selectively ACKed range, so they are never re-sent
+    void selectiveAck(SequenceNumber start, SequenceNumber end);
+    // re-send the packets in this range that have not been fast re-transmitted yet, returns how many that was
+    int fastRetransmitRange(SequenceNumber start, SequenceNumber end);
     void handshakeACK();
     void updateDestinationAddress(HifiSockAddr newAddress);
 
@@ -83,10 +88,7 @@ signals:
     
     void queueInactive();
 
-    void timeout();
-    
-private slots:
-    void run();
+    void timeout(int numRetransmitPackets);
     
 private:
     SendQueue(Socket* socket, HifiSockAddr dest, SequenceNumber currentSequenceNumber,
@@ -94,6 +96,12 @@ private:
     SendQueue(SendQueue& other) = delete;
     SendQueue(SendQueue&& other) = delete;
     
+    // sends what the pacing and the flow window allow, and returns when the queue is due to be stepped again
+    SendScheduler::TimePoint step();
+
+    // step the queue now, an event may have given it something to do
+    void wake();
+
     void sendHandshake();
     
     int sendPacket(const Packet& packet);
@@ -102,7 +110,8 @@ private:
     int maybeSendNewPacket(); // Figures out what packet to send next
     bool maybeResendPacket(); // Determines whether to resend a packet and which one
     
-    bool isInactive(bool attemptedToSendPacket);
+    // when nothing was sent, returns when to step again to time out or deactivate the queue
+    SendScheduler::TimePoint stepInactive(p_high_resolution_clock::time_point now, bool wasWoken);
     void deactivate(); // makes the queue inactive and cleans it up
 
     bool isFlowWindowFull() const;
@@ -131,16 +140,29 @@ private:
     LossList _naks; // Sequence numbers of packets to resend
     
     mutable QReadWriteLock _sentLock; // Protects the sent packet list
-    using PacketResendPair = std::pair<uint8_t, std::unique_ptr<Packet>>; // Number of resend + packet ptr
-    std::unordered_map<SequenceNumber, PacketResendPair> _sentPackets; // Packets waiting for ACK.
+    struct SentPacket {
+        uint8_t numResends { 0 };
+        bool wasFastRetransmitted { false }; // Already queued for a fast re-transmit by selective ACKs
+        std::unique_ptr<Packet> packet;
+    };
+    std::unordered_map<SequenceNumber, SentPacket> _sentPackets; // Packets waiting for ACK.
     
-    std::mutex _handshakeMutex; // Protects the handshake ACK condition_variable
+    std::mutex _handshakeMutex; // Protects the handshake ACK flag while a handshake is sent
     std::atomic<bool> _hasReceivedHandshakeACK { false }; // flag for receipt of handshake ACK from client
-    std::condition_variable _handshakeACKCondition;
-    
-    std::condition_variable_any _emptyCondition;
 
-    std::chrono::high_resolution_clock::time_point _lastPacketSentAt;
+    SendScheduler::ID _schedulerID { 0 };
+    std::atomic<bool> _wasWoken { false }; // an event happened since the last step
+
+    // only touched by the steps, which the scheduler runs one at a time
+    bool _hasStartedSending { false };
+    p_high_resolution_clock::time_point _nextHandshakeAt;
+    p_high_resolution_clock::time_point _nextPacketTimestamp; // when the next packet should have been sent
+    p_high_resolution_clock::time_point _pacedUntil; // the next step isn't due before this
+    p_high_resolution_clock::time_point _inactiveDeadline; // the end of the wait for an event, unset when not waiting
+
+    p_high_resolution_clock::time_point _lastPacketSentAt;
+
+    std::mutex _destinationLock; // Protects the destination, it is changed from the connection's thread
 
     static const std::chrono::microseconds MAXIMUM_ESTIMATED_TIMEOUT;
     static const std::chrono::microseconds MINIMUM_ESTIMATED_TIMEOUT;
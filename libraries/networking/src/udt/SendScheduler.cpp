@@ -0,0 +1,154 @@
+//
+//  SendScheduler.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SendScheduler.h"
+
+#include <algorithm>
+
+using namespace udt;
+using namespace std::chrono;
+
+static const int MAX_SENDER_THREADS = 4;
+
+SendScheduler& SendScheduler::getInstance() {
+    // leaked, so that the queues of sockets that outlive the statics can still be removed from it
+    static SendScheduler* instance = new SendScheduler(
+        std::max(1, std::min(MAX_SENDER_THREADS, (int)std::thread::hardware_concurrency() / 2)));
+    return *instance;
+}
+
+SendScheduler::SendScheduler(int numThreads) {
+    _threads.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        _threads.emplace_back([this] { run(); });
+    }
+}
+
+SendScheduler::~SendScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopping = true;
+    }
+    _dueCondition.notify_all();
+
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+SendScheduler::ID SendScheduler::add(StepOperator step) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ID id = _nextID++;
+    auto& entry = _entries[id];
+    entry.step = step;
+    scheduleLocked(id, entry, p_high_resolution_clock::now());
+    return id;
+}
+
+void SendScheduler::wake(ID id) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(id);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    if (it->second.isStepping) {
+        // the running step may have looked before the event, it is stepped again once it returns
+        it->second.isWoken = true;
+    } else {
+        scheduleLocked(id, it->second, p_high_resolution_clock::now());
+    }
+}
+
+void SendScheduler::remove(ID id) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto it = _entries.find(id);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    // the entries are never moved, only the one we remove is erased
+    auto& entry = it->second;
+    _steppedCondition.wait(lock, [&] { return !entry.isStepping; });
+    _entries.erase(id);
+}
+
+SendScheduler::Stats SendScheduler::sampleStats() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Stats stats;
+    stats.numThreads = numThreads();
+    stats.numSteps = _numSteps;
+    stats.averageLagUsecs = _numSteps > 0 ? _totalLagUsecs / _numSteps : 0;
+    stats.maxLagUsecs = _maxLagUsecs;
+
+    _numSteps = 0;
+    _totalLagUsecs = 0;
+    _maxLagUsecs = 0;
+    return stats;
+}
+
+void SendScheduler::scheduleLocked(ID id, Entry& entry, TimePoint at) {
+    if (at >= entry.dueAt) {
+        return;
+    }
+
+    entry.dueAt = at;
+    ++entry.generation;
+    _due.push({ at, id, entry.generation });
+    _dueCondition.notify_one();
+}
+
+void SendScheduler::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_isStopping) {
+        if (_due.empty()) {
+            _dueCondition.wait(lock);
+            continue;
+        }
+
+        Due due = _due.top();
+        auto now = p_high_resolution_clock::now();
+        if (due.at > now) {
+            _dueCondition.wait_for(lock, due.at - now);
+            continue;
+        }
+        _due.pop();
+
+        auto it = _entries.find(due.id);
+        if (it == _entries.end() || it->second.generation != due.generation) {
+            continue;
+        }
+
+        auto& entry = it->second;
+        entry.dueAt = never();
+        entry.isStepping = true;
+        entry.isWoken = false;
+
+        uint64_t lagUsecs = (uint64_t)duration_cast<microseconds>(now - due.at).count();
+        ++_numSteps;
+        _totalLagUsecs += lagUsecs;
+        _maxLagUsecs = std::max(_maxLagUsecs, lagUsecs);
+
+        // remove waits for the step, so the entry stays put while we're unlocked
+        lock.unlock();
+        TimePoint next = entry.step();
+        lock.lock();
+
+        entry.isStepping = false;
+        if (entry.isWoken) {
+            entry.isWoken = false;
+            next = std::min(next, p_high_resolution_clock::now());
+        }
+        if (next != never()) {
+            scheduleLocked(due.id, entry, next);
+        }
+        _steppedCondition.notify_all();
+    }
+}
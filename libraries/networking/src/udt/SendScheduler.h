@@ -0,0 +1,109 @@
+//
+//  SendScheduler.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SendScheduler_h
+#define hifi_SendScheduler_h
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <PortableHighResolutionClock.h>
+
+namespace udt {
+
+// Steps the send queues of every connection on a fixed set of sender threads, rather than on a thread per queue.
+//   A step sends what the pacing and the congestion window of its queue allow, and returns when the queue is due
+//   to be stepped again. Queues that are woken by an event (a queued packet, an ACK) are stepped as soon as a
+//   thread is free, and a queue is never stepped by two threads at once.
+class SendScheduler {
+public:
+    using TimePoint = p_high_resolution_clock::time_point;
+    using StepOperator = std::function<TimePoint()>;
+    using ID = uint64_t;
+
+    struct Stats {
+        int numThreads { 0 };
+        uint64_t numSteps { 0 };
+        // how long after they were due the steps ran
+        uint64_t averageLagUsecs { 0 };
+        uint64_t maxLagUsecs { 0 };
+    };
+
+    // a step that returns this is only stepped again once it is woken
+    static TimePoint never() { return TimePoint::max(); }
+
+    // the scheduler shared by every socket of the process
+    static SendScheduler& getInstance();
+
+    explicit SendScheduler(int numThreads);
+    ~SendScheduler();
+
+    // start stepping, the first step is due right away
+    ID add(StepOperator step);
+
+    // step again as soon as a thread is free, or right after the step that is running now
+    void wake(ID id);
+
+    // stop stepping, waits for the step that is running now, must not be called from a step
+    void remove(ID id);
+
+    int numThreads() const { return (int)_threads.size(); }
+
+    // the steps and their lag since the last call
+    Stats sampleStats();
+
+private:
+    struct Entry {
+        StepOperator step;
+        TimePoint dueAt { never() };
+        uint64_t generation { 0 };
+        bool isStepping { false };
+        bool isWoken { false };
+    };
+
+    struct Due {
+        TimePoint at;
+        ID id;
+        uint64_t generation;
+
+        bool operator>(const Due& other) const { return at > other.at; }
+    };
+
+    // makes the entry due at that time if it isn't due before it, with _mutex locked
+    void scheduleLocked(ID id, Entry& entry, TimePoint at);
+
+    void run();
+
+    std::mutex _mutex;
+    std::condition_variable _dueCondition;
+    std::condition_variable _steppedCondition;
+
+    std::unordered_map<ID, Entry> _entries;
+    // an entry that was made due again leaves its earlier time behind, with a stale generation
+    std::priority_queue<Due, std::vector<Due>, std::greater<Due>> _due;
+    ID _nextID { 1 };
+    bool _isStopping { false };
+
+    uint64_t _numSteps { 0 };
+    uint64_t _totalLagUsecs { 0 };
+    uint64_t _maxLagUsecs { 0 };
+
+    std::vector<std::thread> _threads;
+};
+
+} // namespace udt
+
+#endif // hifi_SendScheduler_h
@@ -11,10 +11,15 @@
 
 #include "Socket.h"
 
-#ifdef Q_OS_ANDROID
+#if defined(Q_OS_ANDROID) || defined(UDT_BATCHED_IO)
 #include <sys/socket.h>
 #endif
 
+#ifdef UDT_BATCHED_IO
+#include <errno.h>
+#include <string.h>
+#endif
+
 #include <QtCore/QThread>
 
 #include <shared/QtHelpers.h>
@@ -27,6 +32,7 @@
 #include "../NLPacket.h"
 #include "../NLPacketList.h"
 #include "PacketList.h"
+#include "PacketBufferPool.h"
 #include <Trace.h>
 
 using namespace udt;
@@ -38,6 +44,80 @@ using namespace udt;
 #include <netinet/in.h>
 #endif
 
+#ifdef UDT_BATCHED_IO
+
+namespace {
+
+const int MAX_DATAGRAMS_PER_BATCH = 32;
+
+// the message headers and storage for one recvmmsg or sendmmsg call
+struct DatagramBatch {
+    mmsghdr headers[MAX_DATAGRAMS_PER_BATCH];
+    iovec iovecs[MAX_DATAGRAMS_PER_BATCH];
+    sockaddr_storage addresses[MAX_DATAGRAMS_PER_BATCH];
+    char buffers[MAX_DATAGRAMS_PER_BATCH][MAX_PACKET_SIZE];
+};
+
+// the writes queued by the current thread, see Socket::WriteBatch
+struct PendingWrites {
+    DatagramBatch batch;
+    int socketDescriptor { -1 };
+    int numDatagrams { 0 };
+};
+
+thread_local int writeBatchDepth { 0 };
+thread_local std::unique_ptr<PendingWrites> pendingWrites;
+
+void flushPendingWrites() {
+    if (!pendingWrites || pendingWrites->numDatagrams == 0) {
+        return;
+    }
+
+    auto& batch = pendingWrites->batch;
+    int numSent = 0;
+    while (numSent < pendingWrites->numDatagrams) {
+        int result = sendmmsg(pendingWrites->socketDescriptor, &batch.headers[numSent],
+                              pendingWrites->numDatagrams - numSent, 0);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            // like the unbatched path, the datagrams that could not be written are dropped
+            static std::atomic<int> previousError(0);
+            int error = errno;
+            QString errorString;
+            QDebug(&errorString) << "udt::Socket sendmmsg error -" << error << "(" << strerror(error) << ") dropped"
+                << (pendingWrites->numDatagrams - numSent) << "datagrams";
+            if (previousError.exchange(error) != error) {
+                qCDebug(networking).noquote() << errorString;
+            } else {
+                HIFI_FCDEBUG(networking(), errorString.toLatin1().constData());
+            }
+            break;
+        }
+        numSent += result;
+    }
+
+    pendingWrites->numDatagrams = 0;
+}
+
+} // anonymous namespace
+
+#endif // UDT_BATCHED_IO
+
+Socket::WriteBatch::WriteBatch() {
+#ifdef UDT_BATCHED_IO
+    ++writeBatchDepth;
+#endif
+}
+
+Socket::WriteBatch::~WriteBatch() {
+#ifdef UDT_BATCHED_IO
+    if (--writeBatchDepth == 0) {
+        flushPendingWrites();
+    }
+#endif
+}
 
 Socket::Socket(QObject* parent, bool shouldChangeSocketOptions) :
     QObject(parent),
@@ -243,6 +323,13 @@ qint64 Socket::writeDatagram(const QByteArray& datagram, const HifiSockAddr& soc
         qCDebug(networking) << "Attempt to writeDatagram when in unbound state to" << sockAddr;
         return -1;
     }
+
+#ifdef UDT_BATCHED_IO
+    if (writeBatchDepth > 0 && queueBatchedDatagram(datagram, sockAddr)) {
+        return datagram.size();
+    }
+#endif
+
     qint64 bytesWritten = _udpSocket.writeDatagram(datagram, sockAddr.getAddress(), sockAddr.getPort());
     int pending = _udpSocket.bytesToWrite();
     if (bytesWritten < 0 || pending) {
@@ -270,6 +357,48 @@ qint64 Socket::writeDatagram(const QByteArray& datagram, const HifiSockAddr& soc
     return bytesWritten;
 }
 
+#ifdef UDT_BATCHED_IO
+
+bool Socket::queueBatchedDatagram(const QByteArray& datagram, const HifiSockAddr& sockAddr) {
+    if (datagram.size() > MAX_PACKET_SIZE || sockAddr.getAddress().protocol() != QAbstractSocket::IPv4Protocol) {
+        // leave anything unusual to QUdpSocket
+        return false;
+    }
+
+    int socketDescriptor = (int)_udpSocket.socketDescriptor();
+    if (!pendingWrites) {
+        pendingWrites.reset(new PendingWrites());
+    } else if (pendingWrites->socketDescriptor != socketDescriptor ||
+               pendingWrites->numDatagrams == MAX_DATAGRAMS_PER_BATCH) {
+        flushPendingWrites();
+    }
+    pendingWrites->socketDescriptor = socketDescriptor;
+
+    // the caller's data is not guaranteed to outlive this call, so it is copied into the batch
+    auto& batch = pendingWrites->batch;
+    int index = pendingWrites->numDatagrams++;
+    memcpy(batch.buffers[index], datagram.constData(), datagram.size());
+    batch.iovecs[index].iov_base = batch.buffers[index];
+    batch.iovecs[index].iov_len = datagram.size();
+
+    sockaddr_in* address = reinterpret_cast<sockaddr_in*>(&batch.addresses[index]);
+    memset(address, 0, sizeof(sockaddr_in));
+    address->sin_family = AF_INET;
+    address->sin_port = htons(sockAddr.getPort());
+    address->sin_addr.s_addr = htonl(sockAddr.getAddress().toIPv4Address());
+
+    msghdr& header = batch.headers[index].msg_hdr;
+    memset(&header, 0, sizeof(msghdr));
+    header.msg_name = address;
+    header.msg_namelen = sizeof(sockaddr_in);
+    header.msg_iov = &batch.iovecs[index];
+    header.msg_iovlen = 1;
+
+    return true;
+}
+
+#endif // UDT_BATCHED_IO
+
 Connection* Socket::findOrCreateConnection(const HifiSockAddr& sockAddr, bool filterCreate) {
     Lock connectionsLock(_connectionsHashMutex);
     auto it = _connectionsHash.find(sockAddr);
@@ -394,7 +523,9 @@ void Socket::readPendingDatagrams() {
         HifiSockAddr senderSockAddr;
 
         // setup a buffer to read the packet into
-        auto buffer = std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
+        bool isBufferPooled = packetSizeWithHeader <= MAX_PACKET_SIZE;
+        auto buffer = isBufferPooled ? PacketBufferPool::acquire()
+                                     : std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
 
         // pull the datagram
         auto sizeRead = _udpSocket.readDatagram(buffer.get(), packetSizeWithHeader,
@@ -410,78 +541,200 @@ void Socket::readPendingDatagrams() {
             continue;
         }
 
-        auto it = _unfilteredHandlers.find(senderSockAddr);
+        processDatagram(std::move(buffer), packetSizeWithHeader, senderSockAddr, receiveTime, isBufferPooled);
 
-        if (it != _unfilteredHandlers.end()) {
-            // we have a registered unfiltered handler for this HifiSockAddr - call that and return
-            if (it->second) {
-                auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-                basePacket->setReceiveTime(receiveTime);
-                it->second(std::move(basePacket));
-            }
+#ifdef UDT_BATCHED_IO
+        // reading through QUdpSocket re-enabled its read notification, anything else already queued is pulled in batches
+        readBatchedDatagrams(abortTime);
+#endif
+    }
+}
 
-            continue;
+#ifdef UDT_BATCHED_IO
+
+void Socket::readBatchedDatagrams(std::chrono::system_clock::time_point abortTime) {
+    // only ever used on the Socket thread
+    thread_local std::unique_ptr<DatagramBatch> readBatch;
+    if (!readBatch) {
+        readBatch.reset(new DatagramBatch());
+    }
+    auto& batch = *readBatch;
+
+    int socketDescriptor = (int)_udpSocket.socketDescriptor();
+    while (std::chrono::system_clock::now() <= abortTime) {
+        for (int i = 0; i < MAX_DATAGRAMS_PER_BATCH; ++i) {
+            batch.iovecs[i].iov_base = batch.buffers[i];
+            batch.iovecs[i].iov_len = MAX_PACKET_SIZE;
+
+            msghdr& header = batch.headers[i].msg_hdr;
+            memset(&header, 0, sizeof(msghdr));
+            header.msg_name = &batch.addresses[i];
+            header.msg_namelen = sizeof(sockaddr_storage);
+            header.msg_iov = &batch.iovecs[i];
+            header.msg_iovlen = 1;
+        }
+
+        int numRead = recvmmsg(socketDescriptor, batch.headers, MAX_DATAGRAMS_PER_BATCH, MSG_DONTWAIT, nullptr);
+        if (numRead <= 0) {
+            // nothing left to read (EAGAIN), or an error that QUdpSocket will report on its next read
+            return;
         }
 
-        // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+        _readyReadBackupTimer->start();
+        auto receiveTime = p_high_resolution_clock::now();
 
-        if (isControlPacket) {
-            // setup a control packet from the data we just read
-            auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            controlPacket->setReceiveTime(receiveTime);
+        for (int i = 0; i < numRead; ++i) {
+            int sizeRead = (int)batch.headers[i].msg_len;
+            HifiSockAddr senderSockAddr(reinterpret_cast<const sockaddr*>(&batch.addresses[i]));
 
-            // move this control packet to the matching connection, if there is one
-            auto connection = findOrCreateConnection(senderSockAddr, true);
+            _lastPacketSizeRead = sizeRead;
+            _lastPacketSockAddr = senderSockAddr;
 
-            if (connection) {
-                connection->processControl(move(controlPacket));
+            if (sizeRead <= 0 || (batch.headers[i].msg_hdr.msg_flags & MSG_TRUNC)) {
+                // empty, or larger than any packet we send - drop it
+                continue;
             }
 
-        } else {
-            // setup a Packet from the data we just read
-            auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            packet->setReceiveTime(receiveTime);
+            auto buffer = PacketBufferPool::acquire();
+            memcpy(buffer.get(), batch.buffers[i], sizeRead);
+            processDatagram(std::move(buffer), sizeRead, senderSockAddr, receiveTime, true);
+        }
 
-            // save the sequence number in case this is the packet that sticks readyRead
-            _lastReceivedSequenceNumber = packet->getSequenceNumber();
+        if (numRead < MAX_DATAGRAMS_PER_BATCH) {
+            // the socket has been drained
+            return;
+        }
+    }
+}
 
-            // call our verification operator to see if this packet is verified
-            if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
-                auto connection = findOrCreateConnection(senderSockAddr, true);
+#endif // UDT_BATCHED_IO
+
+void Socket::processDatagram(std::unique_ptr<char[]> buffer, int packetSizeWithHeader, const HifiSockAddr& senderSockAddr,
+                             p_high_resolution_clock::time_point receiveTime, bool isBufferPooled) {
+    auto it = _unfilteredHandlers.find(senderSockAddr);
+
+    if (it != _unfilteredHandlers.end()) {
+        // we have a registered unfiltered handler for this HifiSockAddr - call that and return
+        if (it->second) {
+            auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr,
+                                                             isBufferPooled);
+            basePacket->setReceiveTime(receiveTime);
+            it->second(std::move(basePacket));
+        }
+
+        return;
+    }
+
+    // check if this was a control packet or a data packet
+    bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
 
-                if (packet->isReliable()) {
-                    // if this was a reliable packet then signal the matching connection with the sequence number
+    if (isControlPacket) {
+        // setup a control packet from the data we just read
+        auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr,
+                                                              isBufferPooled);
+        controlPacket->setReceiveTime(receiveTime);
 
-                    if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
-                                                                                  packet->getDataSize(),
-                                                                                  packet->getPayloadSize())) {
-                        // the connection could not be created or indicated that we should not continue processing this packet
+        // move this control packet to the matching connection, if there is one
+        auto connection = findOrCreateConnection(senderSockAddr, true);
+
+        if (connection) {
+            connection->processControl(move(controlPacket));
+        }
+
+    } else {
+        // setup a Packet from the data we just read
+        auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr, isBufferPooled);
+        packet->setReceiveTime(receiveTime);
+
+        // save the sequence number in case this is the packet that sticks readyRead
+        _lastReceivedSequenceNumber = packet->getSequenceNumber();
+
+        if (_receiveWorkers && !packet->isReliable() && !packet->isPartOfMessage()) {
+            // this packet has no connection state to update before it is verified, leave that to the workers
+            _receiveWorkers->push(std::move(packet));
+            return;
+        }
+
+        // call our verification operator to see if this packet is verified
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            auto connection = findOrCreateConnection(senderSockAddr, true);
+
+            if (packet->isReliable()) {
+                // if this was a reliable packet then signal the matching connection with the sequence number
+
+                if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
+                                                                              packet->getDataSize(),
+                                                                              packet->getPayloadSize())) {
+                    // the connection could not be created or indicated that we should not continue processing this packet
 #ifdef UDT_CONNECTION_DEBUG
-                        qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
-                            << ", type" << NLPacket::typeInHeader(*packet);
+                    qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
+                        << ", type" << NLPacket::typeInHeader(*packet);
 #endif
-                        continue;
-                    }
-                } else if (connection) {
-                    connection->recordReceivedUnreliablePackets(packet->getWireSize(),
-                                                                packet->getPayloadSize());
+                    return;
                 }
+            } else if (connection) {
+                connection->recordReceivedUnreliablePackets(packet->getWireSize(),
+                                                            packet->getPayloadSize());
+            }
 
-                if (packet->isPartOfMessage()) {
-                    auto connection = findOrCreateConnection(senderSockAddr, true);
-                    if (connection) {
-                        connection->queueReceivedMessagePacket(std::move(packet));
-                    }
-                } else if (_packetHandler) {
-                    // call the verified packet callback to let it handle this packet
-                    _packetHandler(std::move(packet));
+            if (packet->isPartOfMessage()) {
+                auto connection = findOrCreateConnection(senderSockAddr, true);
+                if (connection) {
+                    connection->queueReceivedMessagePacket(std::move(packet));
                 }
+            } else if (_packetHandler) {
+                // call the verified packet callback to let it handle this packet
+                _packetHandler(std::move(packet));
             }
         }
     }
 }
 
+void Socket::processVerifiedPackets() {
+    if (!_receiveWorkers) {
+        return;
+    }
+
+    _receiveWorkers->drainVerified([this](std::unique_ptr<Packet> packet) {
+        auto connection = findOrCreateConnection(packet->getSenderSockAddr(), true);
+        if (connection) {
+            connection->recordReceivedUnreliablePackets(packet->getWireSize(), packet->getPayloadSize());
+        }
+
+        if (_packetHandler) {
+            _packetHandler(std::move(packet));
+        }
+    });
+}
+
+void Socket::setNumReceiveWorkers(int numReceiveWorkers) {
+    if (QThread::currentThread() != thread()) {
+        BLOCKING_INVOKE_METHOD(this, "setNumReceiveWorkers", Q_ARG(int, numReceiveWorkers));
+        return;
+    }
+
+    numReceiveWorkers = std::max(numReceiveWorkers, 0);
+    int currentNumReceiveWorkers = _receiveWorkers ? _receiveWorkers->numWorkers() : 0;
+    if (numReceiveWorkers == currentNumReceiveWorkers) {
+        return;
+    }
+
+    if (_receiveWorkers) {
+        // let the current workers finish what they were handed, and dispatch it, so nothing is lost or reordered
+        _receiveWorkers->stop();
+        processVerifiedPackets();
+        _receiveWorkers.reset();
+    }
+
+    if (numReceiveWorkers > 0) {
+        _receiveWorkers.reset(new ReceiveWorkerPool(numReceiveWorkers,
+            [this](const Packet& packet) { return !_packetFilterOperator || _packetFilterOperator(packet); },
+            [this] { QMetaObject::invokeMethod(this, "processVerifiedPackets", Qt::QueuedConnection); }));
+    }
+
+    qCDebug(networking) << "Socket is verifying received packets on" << numReceiveWorkers << "receive workers";
+}
+
 void Socket::connectToSendSignal(const HifiSockAddr& destinationAddr, QObject* receiver, const char* slot) {
     Lock connectionsLock(_connectionsHashMutex);
     auto it = _connectionsHash.find(destinationAddr);
@@ -491,6 +744,9 @@ void Socket::connectToSendSignal(const HifiSockAddr& destinationAddr, QObject* r
 }
 
 void Socket::setCongestionControlFactory(std::unique_ptr<CongestionControlVirtualFactory> ccFactory) {
+    // connections are created with the factory under the connections lock, this can be called from another thread
+    Lock connectionsLock(_connectionsHashMutex);
+
     // swap the current unique_ptr for the new factory
     _ccFactory.swap(ccFactory);
 }
@@ -14,6 +14,7 @@
 #ifndef hifi_Socket_h
 #define hifi_Socket_h
 
+#include <chrono>
 #include <functional>
 #include <unordered_map>
 #include <mutex>
@@ -26,9 +27,15 @@
 #include "../HifiSockAddr.h"
 #include "TCPVegasCC.h"
 #include "Connection.h"
+#include "ReceiveWorkerPool.h"
 
 //#define UDT_CONNECTION_DEBUG
 
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+// read and write datagrams in batches with recvmmsg/sendmmsg, rather than one syscall per datagram through QUdpSocket
+#define UDT_BATCHED_IO
+#endif
+
 class UDTTest;
 
 namespace udt {
@@ -54,6 +61,18 @@ class Socket : public QObject {
 
 public:
     using StatsVector = std::vector<std::pair<HifiSockAddr, ConnectionStats::Stats>>;
+
+    // While a WriteBatch is alive, datagrams written by its thread are queued and sent together with a single
+    //   sendmmsg, once the batch fills up or goes out of scope. Batches nest, only the outermost one flushes.
+    //   Without UDT_BATCHED_IO this does nothing, and datagrams are written immediately.
+    class WriteBatch {
+    public:
+        WriteBatch();
+        ~WriteBatch();
+
+        WriteBatch(const WriteBatch&) = delete;
+        WriteBatch& operator=(const WriteBatch&) = delete;
+    };
     
     Socket(QObject* object = 0, bool shouldChangeSocketOptions = true);
     
@@ -84,6 +103,10 @@ public:
     void setCongestionControlFactory(std::unique_ptr<CongestionControlVirtualFactory> ccFactory);
     void setConnectionMaxBandwidth(int maxBandwidth);
 
+    // Verify unreliable, single packet messages on this many worker threads rather than on the socket thread.
+    //   0 (the default) verifies everything on the socket thread.
+    Q_INVOKABLE void setNumReceiveWorkers(int numReceiveWorkers);
+
     void messageReceived(std::unique_ptr<Packet> packet);
     void messageFailed(Connection* connection, Packet::MessageNumber messageNumber);
     
@@ -103,6 +126,7 @@ public slots:
 
 private slots:
     void readPendingDatagrams();
+    void processVerifiedPackets();
     void checkForReadyReadBackup();
 
     void handleSocketError(QAbstractSocket::SocketError socketError);
@@ -110,6 +134,13 @@ private slots:
 
 private:
     void setSystemBufferSizes();
+    void processDatagram(std::unique_ptr<char[]> buffer, int packetSizeWithHeader, const HifiSockAddr& senderSockAddr,
+                         p_high_resolution_clock::time_point receiveTime, bool isBufferPooled);
+#ifdef UDT_BATCHED_IO
+    void readBatchedDatagrams(std::chrono::system_clock::time_point abortTime);
+    bool queueBatchedDatagram(const QByteArray& datagram, const HifiSockAddr& sockAddr);
+#endif
+
     Connection* findOrCreateConnection(const HifiSockAddr& sockAddr, bool filterCreation = false);
    
     // privatized methods used by UDTTest - they are private since they must be called on the Socket thread
@@ -139,6 +170,8 @@ private:
 
     int _maxBandwidth { -1 };
 
+    std::unique_ptr<ReceiveWorkerPool> _receiveWorkers;
+
     std::unique_ptr<CongestionControlVirtualFactory> _ccFactory { new CongestionControlFactory<TCPVegasCC>() };
 
     bool _shouldChangeSocketOptions { true };
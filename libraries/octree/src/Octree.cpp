@@ -46,13 +46,14 @@
 #include <PathUtils.h>
 #include <ViewFrustum.h>
 
+#include "OctreeBinaryPersist.h"
 #include "OctreeConstants.h"
 #include "OctreeLogging.h"
 #include "OctreeQueryNode.h"
 #include "OctreeUtils.h"
 #include "OctreeEntitiesFileParser.h"
 
-QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz"};
+QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz", "bin"};
 
 Octree::Octree(bool shouldReaverage) :
     _rootElement(NULL),
@@ -84,7 +85,8 @@ void Octree::recurseElementWithOperation(const OctreeElementPointer& element, co
 
     if (operation(element, extraData)) {
         for (int i = 0; i < NUMBER_OF_CHILDREN; i++) {
-            OctreeElementPointer child = element->getChildAtIndex(i);
+            // the operations only look at the tree, so the child stays in the element while they recurse into it
+            const OctreeElementPointer& child = element->getChildAtIndex(i);
             if (child) {
                 recurseElementWithOperation(child, operation, extraData, recursionCount + 1);
             }
@@ -109,7 +111,7 @@ bool Octree::recurseElementWithOperationSorted(const OctreeElementPointer& eleme
 
     std::vector<SortedChild> sortedChildren;
     for (int i = 0; i < NUMBER_OF_CHILDREN; i++) {
-        OctreeElementPointer child = element->getChildAtIndex(i);
+        const OctreeElementPointer& child = element->getChildAtIndex(i);
         if (child) {
             float priority = sortingOperation(child, extraData);
             if (priority < FLT_MAX) {
@@ -682,6 +684,13 @@ bool Octree::readFromFile(const char* fileName) {
         return false;
     }
 
+    if (qFileName.endsWith(".bin")) {
+        // replacement content from the domain server is gzipped JSON, until our next persist converts it
+        bool isBinary = OctreeUtils::isBinaryPersistData(file.peek(OctreeUtils::BINARY_PERSIST_HEADER_SIZE));
+        file.close();
+        return isBinary ? readFromBinaryFile(qFileName) : readJSONFromGzippedFile(qFileName);
+    }
+
     QDataStream fileInputStream(&file);
     QFileInfo fileInfo(qFileName);
     uint64_t fileLength = fileInfo.size();
@@ -865,6 +874,8 @@ bool Octree::writeToFile(const char* fileName, const OctreeElementPointer& eleme
         success = writeToJSONFile(cFileName, element);
     } else if (persistAsFileType == "json.gz") {
         success = writeToJSONFile(cFileName, element, true);
+    } else if (persistAsFileType == "bin") {
+        success = writeToBinaryFile(cFileName, element);
     } else {
         qCDebug(octree) << "unable to write octree to file of type" << persistAsFileType;
     }
@@ -970,6 +981,91 @@ bool Octree::writeToJSONFile(const char* fileName, const OctreeElementPointer& e
     return success;
 }
 
+bool Octree::writeToBinaryFile(const char* fileName, const OctreeElementPointer& element) {
+    qCDebug(octree, "Saving binary SVO to file %s...", fileName);
+
+    OctreeUtils::BinaryPersistWriter writer(_persistID, _persistDataVersion, expectedDataPacketType());
+    if (!writeToBinary(writer, element)) {
+        return false;
+    }
+    QByteArray dataForFile = writer.finish();
+
+    QSaveFile persistFile(fileName);
+    bool success = false;
+    if (persistFile.open(QIODevice::WriteOnly)) {
+        if (persistFile.write(dataForFile) != -1) {
+            success = persistFile.commit();
+            if (!success) {
+                qCritical() << "Failed to commit to binary save file:" << persistFile.errorString();
+            }
+        } else {
+            qCritical("Failed to write to binary file.");
+        }
+    } else {
+        qCritical("Failed to open binary file for writing.");
+    }
+
+    return success;
+}
+
+bool Octree::readFromBinaryFile(QString qFileName) {
+    QFile file(qFileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCritical() << "Cannot open binary file for reading: " << qFileName;
+        return false;
+    }
+
+    // map the file so the entities are decoded in place, falling back to reading it if the platform can't map it
+    QByteArray fileData;
+    const char* data = (const char*)file.map(0, file.size());
+    if (!data) {
+        fileData = file.readAll();
+        data = fileData.constData();
+    }
+
+    OctreeUtils::BinaryPersistReader reader(data, file.size());
+    if (!reader.isValid()) {
+        qCritical() << "Binary file was written by another version: " << qFileName;
+        return false;
+    }
+
+    // the changes persisted since the file was written are replayed on top of it
+    QFile journalFile(qFileName + OctreeUtils::BINARY_PERSIST_JOURNAL_EXTENSION);
+    QByteArray journalFileData;
+    std::vector<OctreeUtils::BinaryPersistReader> journal;
+    if (journalFile.open(QIODevice::ReadOnly) && journalFile.size() > 0) {
+        const char* journalData = (const char*)journalFile.map(0, journalFile.size());
+        if (!journalData) {
+            journalFileData = journalFile.readAll();
+            journalData = journalFileData.constData();
+        }
+        journal = OctreeUtils::readBinaryPersistJournal(journalData, journalFile.size(), reader);
+    }
+
+    qCDebug(octree) << "Reading from binary SVO file length:" << file.size() << "journal records:" << journal.size();
+    return readFromBinary(reader, journal);
+}
+
+bool Octree::appendToBinaryJournal(const char* fileName, quint64 changedSince) {
+    OctreeUtils::BinaryPersistWriter writer(_persistID, _persistDataVersion, expectedDataPacketType());
+    if (!writeChangesToBinary(writer, changedSince)) {
+        return false;
+    }
+    QByteArray record = OctreeUtils::toBinaryPersistJournalRecord(writer.finish());
+
+    // a record torn by a crash is dropped when the journal is read, along with anything after it
+    QFile journalFile(QString(fileName) + OctreeUtils::BINARY_PERSIST_JOURNAL_EXTENSION);
+    if (!journalFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCritical() << "Failed to open binary journal for writing:" << journalFile.errorString();
+        return false;
+    }
+    if (journalFile.write(record) != record.size() || !journalFile.flush()) {
+        qCritical() << "Failed to write to binary journal:" << journalFile.errorString();
+        return false;
+    }
+    return true;
+}
+
 uint64_t Octree::getOctreeElementsCount() {
     uint64_t nodeCount = 0;
     recurseTreeWithOperation(countOctreeElementsOperation, &nodeCount);
@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <set>
+#include <vector>
 #include <stdint.h>
 
 #include <QHash>
@@ -35,6 +36,10 @@ class Octree;
 class OctreeElement;
 class OctreePacketData;
 class Shape;
+namespace OctreeUtils {
+    class BinaryPersistReader;
+    class BinaryPersistWriter;
+}
 using OctreePointer = std::shared_ptr<Octree>;
 
 extern QVector<QString> PERSIST_EXTENSIONS;
@@ -213,6 +218,14 @@ public:
     virtual bool writeToMap(QVariantMap& entityDescription, OctreeElementPointer element, bool skipDefaultValues,
                             bool skipThoseWithBadParents) = 0;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) = 0;
+    bool writeToBinaryFile(const char* filename, const OctreeElementPointer& element = nullptr);
+    virtual bool writeToBinary(OctreeUtils::BinaryPersistWriter& writer, const OctreeElementPointer& element) { return false; }
+
+    // Appends what changed since the given time to the journal of a binary file, see OctreeBinaryPersist.h.
+    // Trees that support journals need to be told to record their deletes while they are in use.
+    bool appendToBinaryJournal(const char* filename, quint64 changedSince);
+    virtual bool writeChangesToBinary(OctreeUtils::BinaryPersistWriter& writer, quint64 changedSince) { return false; }
+    virtual void setRecordsDeletesForJournal(bool recordsDeletes) { }
 
     // Octree importers
     bool readFromFile(const char* filename);
@@ -222,6 +235,9 @@ public:
     bool readJSONFromStream(uint64_t streamLength, QDataStream& inputStream, const QString& marketplaceID="");
     bool readJSONFromGzippedFile(QString qFileName);
     virtual bool readFromMap(QVariantMap& entityDescription) = 0;
+    bool readFromBinaryFile(QString qFileName);
+    virtual bool readFromBinary(const OctreeUtils::BinaryPersistReader& reader,
+                                const std::vector<OctreeUtils::BinaryPersistReader>& journal) { return false; }
 
     uint64_t getOctreeElementsCount();
 
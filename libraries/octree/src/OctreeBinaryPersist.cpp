@@ -0,0 +1,175 @@
+//
+//  OctreeBinaryPersist.cpp
+//  libraries/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeBinaryPersist.h"
+
+#include <cstring>
+
+#include <UUID.h>
+
+static const char BINARY_PERSIST_MAGIC[] = { 'H', 'F', 'O', 'B' };
+static const int CHUNK_HEADER_SIZE = sizeof(quint32) * 2;
+
+bool OctreeUtils::isBinaryPersistData(const QByteArray& data) {
+    return data.size() >= (int)sizeof(BINARY_PERSIST_MAGIC) &&
+        memcmp(data.constData(), BINARY_PERSIST_MAGIC, sizeof(BINARY_PERSIST_MAGIC)) == 0;
+}
+
+OctreeUtils::BinaryPersistWriter::BinaryPersistWriter(const QUuid& id, int64_t dataVersion, PacketType dataPacketType) {
+    _data.reserve(BINARY_PERSIST_HEADER_SIZE + BINARY_PERSIST_CHUNK_SIZE);
+
+    _data.append(BINARY_PERSIST_MAGIC, sizeof(BINARY_PERSIST_MAGIC));
+    _data.append((const char*)&BINARY_PERSIST_FORMAT_VERSION, sizeof(BINARY_PERSIST_FORMAT_VERSION));
+    _data.append((char)dataPacketType);
+    _data.append(versionForPacketType(dataPacketType));
+    _data.append(id.toRfc4122());
+    _data.append((const char*)&dataVersion, sizeof(dataVersion));
+
+    Q_ASSERT(_data.size() == BINARY_PERSIST_HEADER_SIZE);
+}
+
+void OctreeUtils::BinaryPersistWriter::appendItem(const QByteArray& item) {
+    if (_chunkStart != -1 && _data.size() - _chunkStart >= BINARY_PERSIST_CHUNK_SIZE) {
+        endChunk();
+    }
+
+    if (_chunkStart == -1) {
+        // the header is filled in once we know what went into the chunk
+        _chunkStart = _data.size();
+        _data.append(CHUNK_HEADER_SIZE, 0);
+    }
+
+    quint32 itemSize = item.size();
+    _data.append((const char*)&itemSize, sizeof(itemSize));
+    _data.append(item);
+    ++_chunkItems;
+}
+
+void OctreeUtils::BinaryPersistWriter::endChunk() {
+    quint32 chunkSize = _data.size() - _chunkStart - CHUNK_HEADER_SIZE;
+    memcpy(_data.data() + _chunkStart, &_chunkItems, sizeof(_chunkItems));
+    memcpy(_data.data() + _chunkStart + sizeof(_chunkItems), &chunkSize, sizeof(chunkSize));
+
+    _chunkStart = -1;
+    _chunkItems = 0;
+}
+
+QByteArray OctreeUtils::BinaryPersistWriter::finish() {
+    if (_chunkStart != -1) {
+        endChunk();
+    }
+    return std::move(_data);
+}
+
+OctreeUtils::BinaryPersistReader::BinaryPersistReader(const char* data, qint64 size) :
+    _data(data),
+    _size(size)
+{
+    if (size < BINARY_PERSIST_HEADER_SIZE || memcmp(data, BINARY_PERSIST_MAGIC, sizeof(BINARY_PERSIST_MAGIC)) != 0) {
+        return;
+    }
+
+    const char* dataAt = data + sizeof(BINARY_PERSIST_MAGIC);
+
+    quint16 formatVersion;
+    memcpy(&formatVersion, dataAt, sizeof(formatVersion));
+    dataAt += sizeof(formatVersion);
+
+    _dataPacketType = (PacketType)(quint8)*dataAt++;
+    PacketVersion dataPacketVersion = *dataAt++;
+
+    _id = QUuid::fromRfc4122(QByteArray::fromRawData(dataAt, NUM_BYTES_RFC4122_UUID));
+    dataAt += NUM_BYTES_RFC4122_UUID;
+
+    memcpy(&_dataVersion, dataAt, sizeof(_dataVersion));
+
+    // the items are bitstream encoded, so they can only be read back by the protocol version that wrote them
+    _isValid = formatVersion == BINARY_PERSIST_FORMAT_VERSION && _dataPacketType < PacketType::NUM_PACKET_TYPE &&
+        dataPacketVersion == versionForPacketType(_dataPacketType);
+}
+
+bool OctreeUtils::BinaryPersistReader::forEachItem(const std::function<bool(const char* data, int size)>& visitor) const {
+    if (!_isValid) {
+        return false;
+    }
+
+    qint64 offset = BINARY_PERSIST_HEADER_SIZE;
+    while (offset < _size) {
+        if (_size - offset < CHUNK_HEADER_SIZE) {
+            return false;
+        }
+
+        quint32 numItems;
+        quint32 chunkSize;
+        memcpy(&numItems, _data + offset, sizeof(numItems));
+        memcpy(&chunkSize, _data + offset + sizeof(numItems), sizeof(chunkSize));
+        offset += CHUNK_HEADER_SIZE;
+
+        qint64 chunkEnd = offset + chunkSize;
+        if (chunkEnd > _size) {
+            return false;
+        }
+
+        for (quint32 i = 0; i < numItems; ++i) {
+            quint32 itemSize;
+            if (chunkEnd - offset < (qint64)sizeof(itemSize)) {
+                return false;
+            }
+            memcpy(&itemSize, _data + offset, sizeof(itemSize));
+            offset += sizeof(itemSize);
+
+            if (chunkEnd - offset < itemSize || !visitor(_data + offset, itemSize)) {
+                return false;
+            }
+            offset += itemSize;
+        }
+
+        if (offset != chunkEnd) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+QByteArray OctreeUtils::toBinaryPersistJournalRecord(const QByteArray& data) {
+    QByteArray record;
+    quint32 recordSize = data.size();
+    record.reserve(sizeof(recordSize) + data.size());
+    record.append((const char*)&recordSize, sizeof(recordSize));
+    record.append(data);
+    return record;
+}
+
+std::vector<OctreeUtils::BinaryPersistReader> OctreeUtils::readBinaryPersistJournal(const char* data, qint64 size,
+                                                                                   const BinaryPersistReader& snapshot) {
+    std::vector<BinaryPersistReader> records;
+    int64_t lastDataVersion = snapshot.getDataVersion();
+
+    qint64 offset = 0;
+    while (size - offset >= (qint64)sizeof(quint32)) {
+        quint32 recordSize;
+        memcpy(&recordSize, data + offset, sizeof(recordSize));
+        offset += sizeof(recordSize);
+        if (size - offset < recordSize) {
+            break;
+        }
+
+        BinaryPersistReader record(data + offset, recordSize);
+        offset += recordSize;
+
+        // records from before the snapshot was written are left over from a compaction that didn't get to remove them
+        if (record.isValid() && record.getID() == snapshot.getID() && record.getDataVersion() > lastDataVersion) {
+            lastDataVersion = record.getDataVersion();
+            records.push_back(record);
+        }
+    }
+    return records;
+}
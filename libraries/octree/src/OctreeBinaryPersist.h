@@ -0,0 +1,91 @@
+//
+//  OctreeBinaryPersist.h
+//  libraries/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeBinaryPersist_h
+#define hifi_OctreeBinaryPersist_h
+
+#include <functional>
+#include <vector>
+
+#include <QByteArray>
+#include <QUuid>
+
+#include <udt/PacketHeaders.h>
+
+namespace OctreeUtils {
+
+// Binary persist file layout, all values in host byte order:
+//   header   magic "HFOB", uint16 format version, uint8 data packet type, uint8 data packet version,
+//            16 byte RFC 4122 id, int64 data version
+//   chunks   uint32 item count, uint32 byte size, then the items, each prefixed with its uint32 byte size
+// Chunks are closed once they grow past BINARY_PERSIST_CHUNK_SIZE, so a reader can stream or map the file a chunk
+// at a time. The items are opaque to this format, their encoding belongs to the tree for the data packet type.
+const int BINARY_PERSIST_HEADER_SIZE = 32;
+const int BINARY_PERSIST_CHUNK_SIZE = 64 * 1024;
+const quint16 BINARY_PERSIST_FORMAT_VERSION = 1;
+
+// true if the data starts with the header of a binary persist file, of any version
+bool isBinaryPersistData(const QByteArray& data);
+
+class BinaryPersistWriter {
+public:
+    BinaryPersistWriter(const QUuid& id, int64_t dataVersion, PacketType dataPacketType);
+
+    void appendItem(const QByteArray& item);
+
+    // closes the last chunk and hands over the file contents
+    QByteArray finish();
+
+private:
+    void endChunk();
+
+    QByteArray _data;
+    int _chunkStart { -1 };
+    quint32 _chunkItems { 0 };
+};
+
+class BinaryPersistReader {
+public:
+    // the data has to outlive the reader, the items handed to the visitor point into it
+    BinaryPersistReader(const char* data, qint64 size);
+
+    // false if the header is missing, or the data was written by another format or data packet version
+    bool isValid() const { return _isValid; }
+
+    const QUuid& getID() const { return _id; }
+    int64_t getDataVersion() const { return _dataVersion; }
+    PacketType getDataPacketType() const { return _dataPacketType; }
+
+    // visits every item in file order, stops early and returns false if the visitor does or the data is truncated
+    bool forEachItem(const std::function<bool(const char* data, int size)>& visitor) const;
+
+private:
+    const char* _data;
+    qint64 _size;
+
+    bool _isValid { false };
+    QUuid _id;
+    int64_t _dataVersion { -1 };
+    PacketType _dataPacketType { PacketType::Unknown };
+};
+
+// The journal next to a binary persist file holds the changes persisted since that file was written, as a sequence of
+// records each prefixed with its uint32 byte size. Every record is binary persist data of its own, tagged with the
+// data version it brought the tree to.
+const char BINARY_PERSIST_JOURNAL_EXTENSION[] = ".journal";
+
+QByteArray toBinaryPersistJournalRecord(const QByteArray& data);
+
+// the records that apply on top of the snapshot, in order, ending at the first record that was torn by a crash
+std::vector<BinaryPersistReader> readBinaryPersistJournal(const char* data, qint64 size, const BinaryPersistReader& snapshot);
+
+}
+
+#endif // hifi_OctreeBinaryPersist_h
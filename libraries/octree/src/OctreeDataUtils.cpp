@@ -9,6 +9,7 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 
 #include "OctreeDataUtils.h"
+#include "OctreeBinaryPersist.h"
 #include "OctreeEntitiesFileParser.h"
 
 #include <Gzip.h>
@@ -30,6 +31,19 @@ bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromMap(const QVariantMap& ma
 }
 
 bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromData(QByteArray data) {
+    if (isBinaryPersistData(data)) {
+        // only the header is needed, the entities of binary data are read straight into the tree
+        BinaryPersistReader reader(data.constData(), data.size());
+        if (!reader.isValid()) {
+            qWarning() << "Binary octree data was written by another version";
+            return false;
+        }
+        id = reader.getID();
+        dataVersion = reader.getDataVersion();
+        version = versionForPacketType(reader.getDataPacketType());
+        return true;
+    }
+
     QByteArray jsonData;
     if (gunzip(data, jsonData)) {
         data = jsonData;
@@ -55,7 +69,8 @@ bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromFile(QString path) {
         return false;
     }
 
-    QByteArray data = file.readAll();
+    QByteArray data = isBinaryPersistData(file.peek(BINARY_PERSIST_HEADER_SIZE)) ?
+        file.read(BINARY_PERSIST_HEADER_SIZE) : file.readAll();
 
     return readOctreeDataInfoFromData(data);
 }
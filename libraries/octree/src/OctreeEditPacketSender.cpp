@@ -253,6 +253,8 @@ void OctreeEditPacketSender::queueOctreeEditMessage(PacketType type, QByteArray&
 }
 
 void OctreeEditPacketSender::releaseQueuedMessages() {
+    queueHeldEditMessages();
+
     // if we don't yet have servers then we can't actually release messages yet because we don't
     // know where to send them to. Instead, just remember this request and when we eventually get servers
     // call release again at that time.
@@ -316,6 +318,9 @@ std::unique_ptr<NLPacket> OctreeEditPacketSender::initializePacket(PacketType ty
 }
 
 bool OctreeEditPacketSender::process() {
+    // edits that were held back for longer than a send interval go out with the next packets
+    queueHeldEditMessages();
+
     // if we have servers, and we have pending pre-servers exist packets, then process those
     // before doing our normal process step. This processPreServerExistPackets()
     if (serversExist() && (!_preServerEdits.empty() || !_preServerSingleMessagePackets.empty() )) {
@@ -74,6 +74,9 @@ public slots:
 protected:
     using EditMessagePair = std::pair<PacketType, QByteArray>;
 
+    // subclasses that hold edits back to merge them queue them here, before the queued messages are released
+    virtual void queueHeldEditMessages() { }
+
     void queuePacketToNode(const QUuid& nodeID, std::unique_ptr<NLPacket> packet);
     void queuePacketListToNode(const QUuid& nodeUUID, std::unique_ptr<NLPacketList> packetList);
 
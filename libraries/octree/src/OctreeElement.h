@@ -12,9 +12,6 @@
 #ifndef hifi_OctreeElement_h
 #define hifi_OctreeElement_h
 
-//#define SIMPLE_CHILD_ARRAY
-#define SIMPLE_EXTERNAL_CHILDREN
-
 #include <atomic>
 
 #include <QReadWriteLock>
@@ -109,7 +106,8 @@ public:
 
     // Base class methods you don't need to implement
     const unsigned char* getOctalCode() const { return (_octcodePointer) ? _octalCode.pointer : &_octalCode.buffer[0]; }
-    OctreeElementPointer getChildAtIndex(int childIndex) const;
+    // a reference to the child for the traversals that only look at it, copy it to hold on to it
+    const OctreeElementPointer& getChildAtIndex(int childIndex) const { return _children[childIndex]; }
     void deleteChildAtIndex(int childIndex);
     OctreeElementPointer removeChildAtIndex(int childIndex);
     bool isParentOf(const OctreeElementPointer& possibleChild) const;
@@ -162,15 +160,13 @@ public:
 
     static quint64 getOctreeMemoryUsage() { return _octreeMemoryUsage; }
     static quint64 getOctcodeMemoryUsage() { return _octcodeMemoryUsage; }
-    static quint64 getExternalChildrenMemoryUsage() { return _externalChildrenMemoryUsage; }
-    static quint64 getTotalMemoryUsage() { return _octreeMemoryUsage + _octcodeMemoryUsage + _externalChildrenMemoryUsage; }
+    static quint64 getTotalMemoryUsage() { return _octreeMemoryUsage + _octcodeMemoryUsage; }
 
     static quint64 getGetChildAtIndexTime() { return _getChildAtIndexTime; }
     static quint64 getGetChildAtIndexCalls() { return _getChildAtIndexCalls; }
     static quint64 getSetChildAtIndexTime() { return _setChildAtIndexTime; }
     static quint64 getSetChildAtIndexCalls() { return _setChildAtIndexCalls; }
 
-    static quint64 getExternalChildrenCount() { return _externalChildrenCount; }
     static quint64 getChildrenCount(int childCount) { return _childrenCount[childCount]; }
 
     enum ChildIndex {
@@ -227,17 +223,8 @@ protected:
     quint64 _lastChanged; /// Client and server, timestamp this node was last changed, 8 bytes
     uint64_t _lastChangedContent { 0 };
 
-    /// Client and server, pointers to child nodes, various encodings
-#ifdef SIMPLE_CHILD_ARRAY
-    OctreeElementPointer _simpleChildArray[8]; /// Only used when SIMPLE_CHILD_ARRAY is enabled
-#endif
-
-#ifdef SIMPLE_EXTERNAL_CHILDREN
-    // union children_t {
-    OctreeElementPointer _childrenSingle;
-    OctreeElementPointer _externalChildren[NUMBER_OF_CHILDREN];
-    // } _children;
-#endif
+    /// Client and server, pointers to child nodes, indexed by child index, _childBitmask has the ones that are set
+    OctreeElementPointer _children[NUMBER_OF_CHILDREN];
 
     uint16_t _sourceUUIDKey; /// Client only, stores node id of voxel server that sent his voxel, 2 bytes
 
@@ -254,22 +241,19 @@ protected:
          _isDirty : 1, /// Client only, has this voxel changed since being rendered, 1 bit
          _shouldRender : 1, /// Client only, should this voxel render at this time, 1 bit
          _octcodePointer : 1, /// Client and Server only, is this voxel's octal code a pointer or buffer, 1 bit
-         _unknownBufferIndex : 1,
-         _childrenExternal : 1; /// Client only, is this voxel's VBO buffer the unknown buffer index, 1 bit
+         _unknownBufferIndex : 1; /// Client only, is this voxel's VBO buffer the unknown buffer index, 1 bit
 
     static AtomicUIntStat _voxelNodeCount;
     static AtomicUIntStat _voxelNodeLeafCount;
 
     static AtomicUIntStat _octreeMemoryUsage;
     static AtomicUIntStat _octcodeMemoryUsage;
-    static AtomicUIntStat _externalChildrenMemoryUsage;
 
     static AtomicUIntStat _getChildAtIndexTime;
     static AtomicUIntStat _getChildAtIndexCalls;
     static AtomicUIntStat _setChildAtIndexTime;
     static AtomicUIntStat _setChildAtIndexCalls;
 
-    static AtomicUIntStat _externalChildrenCount;
     static AtomicUIntStat _childrenCount[NUMBER_OF_CHILDREN + 1];
 };
 
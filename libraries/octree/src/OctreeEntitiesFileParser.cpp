@@ -11,13 +11,17 @@
 
 #include "OctreeEntitiesFileParser.h"
 
+#include <atomic>
 #include <sstream>
 #include <cctype>
+#include <vector>
 
 #include <QUuid>
 #include <QJsonDocument>
 #include <QJsonObject>
 
+#include <shared/ParallelFor.h>
+
 
 using std::string;
 
@@ -219,6 +223,8 @@ bool OctreeEntitiesFileParser::readEntitiesArray(QVariantList& entitiesArray) {
         return false;
     }
 
+    // only find where each entity starts and ends here, the entities themselves are parsed in parallel below
+    std::vector<std::pair<int, int>> entityExtents;
     while (true) {
         if (nextToken() != '{') {
             _errorString = "Entity array item is not an object";
@@ -230,23 +236,42 @@ bool OctreeEntitiesFileParser::readEntitiesArray(QVariantList& entitiesArray) {
             return false;
         }
 
-        QByteArray jsonEntity = _entitiesContents.mid(_position - 1, matchingBrace - _position + 1);
-        QJsonDocument entity = QJsonDocument::fromJson(jsonEntity);
-        if (entity.isNull()) {
-            _errorString = "Ill-formed entity";
-            return false;
-        }
-
-        entitiesArray.append(entity.object());
+        entityExtents.emplace_back(_position - 1, matchingBrace - _position + 1);
         _position = matchingBrace;
         char c = nextToken();
         if (c == ']') {
-            return true;
+            break;
         } else if (c != ',') {
             _errorString = "Entity array item incorrectly terminated";
             return false;
         }
     }
+
+    const int MIN_ENTITIES_PER_THREAD = 256;
+    std::vector<QJsonObject> entities(entityExtents.size());
+    std::atomic<bool> isWellFormed { true };
+    parallelForRanges((int)entityExtents.size(), MIN_ENTITIES_PER_THREAD, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            QByteArray jsonEntity = QByteArray::fromRawData(_entitiesContents.constData() + entityExtents[i].first,
+                                                            entityExtents[i].second);
+            QJsonDocument entity = QJsonDocument::fromJson(jsonEntity);
+            if (entity.isNull()) {
+                isWellFormed = false;
+                return;
+            }
+            entities[i] = entity.object();
+        }
+    });
+
+    if (!isWellFormed) {
+        _errorString = "Ill-formed entity";
+        return false;
+    }
+
+    entitiesArray.reserve(entitiesArray.size() + (int)entities.size());
+    for (auto& entity : entities) {
+        entitiesArray.append(entity);
+    }
     return true;
 }
 
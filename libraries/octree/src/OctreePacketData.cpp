@@ -12,6 +12,7 @@
 #include "OctreePacketData.h"
 
 #include <GLMHelpers.h>
+#include <Gzip.h>
 #include <PerfStat.h>
 
 #include "OctreeLogging.h"
@@ -605,9 +606,14 @@ bool OctreePacketData::compressContent() {
     const uchar* uncompressedData = &_uncompressed[0];
     int uncompressedSize = _bytesInUse;
 
-    QByteArray compressedData = qCompress(uncompressedData, uncompressedSize, MAX_COMPRESSION);
+    QByteArray compressedData;
+    if (_useCompressionDictionary) {
+        deflateWithDictionary(uncompressedData, uncompressedSize, getCompressionDictionary(), compressedData, MAX_COMPRESSION);
+    } else {
+        compressedData = qCompress(uncompressedData, uncompressedSize, MAX_COMPRESSION);
+    }
 
-    if (compressedData.size() < _compressedByteArray.size()) {
+    if (!compressedData.isEmpty() && compressedData.size() < _compressedByteArray.size()) {
         _compressedBytes = compressedData.size();
         memcpy(_compressed, compressedData.constData(), _compressedBytes);
         _dirty = false;
@@ -629,11 +635,19 @@ void OctreePacketData::loadFinalizedContent(const unsigned char* data, int lengt
             _compressedBytes = length;
             memcpy(_compressed, data, _compressedBytes);
 
-            QByteArray compressedData;
-            compressedData.resize(_compressedBytes);
-            memcpy(compressedData.data(), data, _compressedBytes);
+            QByteArray uncompressedData;
+            if (needsDictionaryToInflate(data, length)) {
+                if (!inflateWithDictionary(data, length, getCompressionDictionary(), uncompressedData)) {
+                    qCWarning(octree) << "OctreePacketData::loadFinalizedContent -- could not inflate with the compression dictionary";
+                }
+            } else {
+                QByteArray compressedData;
+                compressedData.resize(_compressedBytes);
+                memcpy(compressedData.data(), data, _compressedBytes);
+
+                uncompressedData = qUncompress(compressedData);
+            }
 
-            QByteArray uncompressedData = qUncompress(compressedData);
             if (uncompressedData.size() > _bytesAvailable) {
                 int moreNeeded = uncompressedData.size() - _bytesAvailable;
                 _uncompressedByteArray.resize(_uncompressedByteArray.size() + moreNeeded);
@@ -794,3 +808,40 @@ int OctreePacketData::unpackDataFromBytes(const unsigned char* dataBytes, QRect&
     memcpy(&result, dataBytes, sizeof(result));
     return sizeof(result);
 }
+
+const QByteArray& OctreePacketData::getCompressionDictionary() {
+    // zlib finds matches in the dictionary best towards its end, so the most common strings go last.
+    // Changing any of this breaks the decoding of every receiver that has the previous dictionary.
+    static const char* const DICTIONARY_STRINGS[] = {
+        "\"textures\":{", "\"materials\":[", "\"materialVersion\":1,", "\"model\":\"hifi_pbr\",", "\"albedo\":[",
+        "\"albedoMap\":\"", "\"normalMap\":\"", "\"roughness\":", "\"metallic\":", "\"emissive\":[", "\"opacity\":",
+        "\"unlit\":true", "\"scattering\":", "\"keyLight\":{", "\"color\":{\"red\":", ",\"green\":", ",\"blue\":",
+        "\"x\":", ",\"y\":", ",\"z\":", "\"w\":", "\"position\":{", "\"rotation\":{", "\"dimensions\":{",
+        "\"jointName\":\"", "\"offset\":{", "\"equipHotspots\":[", "\"wearable\":{", "\"joints\":{",
+        "\"triggerable\":", "\"grabbable\":", "\"grabbableKey\":{", "\"kinematic\":false", "\"ignoreIK\":false",
+        "\"soundURL\":\"", "\"volume\":", "\"loop\":true", "\"version\":", "\"type\":\"", "\"name\":\"",
+        "\"id\":\"", "\"url\":\"", "\"userData\":", "\"actionData\":", "\"serverScripts\":",
+        "\"ParentID\":\"{", "\"currentProperties\":", "\"originalTextures\":", "\"grabKey\":{",
+        "Script.setInterval(", "Script.setTimeout(", "Script.resolvePath(", "Script.include(", "Entities.callEntityMethod(",
+        "Entities.editEntity(", "Entities.addEntity(", "Entities.getEntityProperties(", "Entities.deleteEntity(",
+        "Messages.sendMessage(", "Messages.subscribe(", "MyAvatar.position", "AvatarList.getAvatar(", "Audio.playSound(",
+        "SoundCache.getSound(", "Vec3.distance(", "Vec3.sum(", "Vec3.multiply(", "Quat.fromPitchYawRollDegrees(",
+        "JSON.stringify(", "JSON.parse(", "this.preload = function(entityID) {", "this.unload = function() {",
+        "this.enterEntity = function(entityID) {", "this.leaveEntity = function(entityID) {",
+        "this.clickDownOnEntity = function(entityID, mouseEvent) {", "this.startNearGrab = function(entityID, args) {",
+        "this.remotelyCallable = [", "function(", "var ", "return ", "true", "false", "null", "undefined",
+        "(function() {", "return new ", "});", "    ", "\r\n", "\n",
+        ".json", ".jpg", ".png", ".ktx", ".wav", ".mp3", ".svo.json", ".fst", ".obj", ".js?", ".js", ".fbx",
+        "file:///~/", "qrc:///", "atp:/", "https://hifi-public.s3.amazonaws.com/", "https://hifi-content.s3.amazonaws.com/",
+        "https://mpassets.highfidelity.com/", "https://cdn.highfidelity.com/", "http://", "https://",
+    };
+
+    static const QByteArray dictionary = [] {
+        QByteArray result;
+        for (const char* dictionaryString : DICTIONARY_STRINGS) {
+            result.append(dictionaryString);
+        }
+        return result;
+    }();
+    return dictionary;
+}
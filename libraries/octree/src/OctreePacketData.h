@@ -240,6 +240,13 @@ public:
     
     /// returns whether or not zlib compression enabled on finalization
     bool isCompressed() const { return _enableCompression; }
+
+    /// compress with the preset dictionary of strings common in entity data, only for receivers that asked for it
+    void setUseCompressionDictionary(bool useCompressionDictionary) { _useCompressionDictionary = useCompressionDictionary; }
+    bool getUseCompressionDictionary() const { return _useCompressionDictionary; }
+
+    /// the preset zlib dictionary, receivers find it from the stream header so it must only change with the protocol
+    static const QByteArray& getCompressionDictionary();
     
     /// returns the target uncompressed size
     unsigned int getTargetSize() const { return _targetSize; }
@@ -297,6 +304,7 @@ private:
 
     unsigned int _targetSize;
     bool _enableCompression;
+    bool _useCompressionDictionary { false };
     
     QByteArray _uncompressedByteArray;
     unsigned char* _uncompressed { nullptr };
@@ -33,6 +33,7 @@
 #include <PathUtils.h>
 #include <Gzip.h>
 
+#include "OctreeBinaryPersist.h"
 #include "OctreeLogging.h"
 #include "OctreeUtils.h"
 #include "OctreeDataUtils.h"
@@ -40,11 +41,13 @@
 constexpr std::chrono::seconds OctreePersistThread::DEFAULT_PERSIST_INTERVAL { 30 };
 constexpr std::chrono::milliseconds TIME_BETWEEN_PROCESSING { 10 };
 
+constexpr std::chrono::minutes MAX_TIME_BETWEEN_JOURNAL_COMPACTIONS { 10 };
+
 constexpr int MAX_OCTREE_REPLACEMENT_BACKUP_FILES_COUNT { 20 };
 constexpr int64_t MAX_OCTREE_REPLACEMENT_BACKUP_FILES_SIZE_BYTES { 50 * 1000 * 1000 };
 
 OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& filename, std::chrono::milliseconds persistInterval,
-                                         bool debugTimestampNow, QString persistAsFileType) :
+                                         bool debugTimestampNow, QString persistAsFileType, bool journalEdits) :
     _tree(tree),
     _filename(filename),
     _persistInterval(persistInterval),
@@ -53,7 +56,8 @@ OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& file
     _loadTimeUSecs(0),
     _debugTimestampNow(debugTimestampNow),
     _lastTimeDebug(0),
-    _persistAsFileType(persistAsFileType)
+    _persistAsFileType(persistAsFileType),
+    _journalEdits(journalEdits && persistAsFileType == "bin")
 {
     // in case the persist filename has an extension that doesn't match the file type
     QString sansExt = fileNameWithoutExtension(_filename, PERSIST_EXTENSIONS);
@@ -75,13 +79,21 @@ void OctreePersistThread::start() {
     qCDebug(octree) << "Reading octree data from" << _filename;
     QFile file(_filename);
     if (file.open(QIODevice::ReadOnly)) {
-        QByteArray jsonData(file.readAll());
-        file.close();
-        if (!gunzip(jsonData, _cachedJSONData)) {
-            _cachedJSONData = jsonData;
+        QByteArray octreeData;
+        if (OctreeUtils::isBinaryPersistData(file.peek(OctreeUtils::BINARY_PERSIST_HEADER_SIZE))) {
+            // binary data is read straight from the file once we load it, only its header is needed here
+            octreeData = file.read(OctreeUtils::BINARY_PERSIST_HEADER_SIZE);
+        } else {
+            QByteArray jsonData(file.readAll());
+            if (!gunzip(jsonData, _cachedJSONData)) {
+                _cachedJSONData = jsonData;
+            }
+            octreeData = _cachedJSONData;
         }
+        file.close();
 
-        if (data.readOctreeDataInfoFromData(_cachedJSONData)) {
+        // binary data written by another protocol version is reported as missing, so the DS sends us its JSON copy
+        if (data.readOctreeDataInfoFromData(octreeData)) {
             qCDebug(octree) << "Current octree data: ID(" << data.id << ") DataVersion(" << data.dataVersion << ")";
             packet->writePrimitive(true);
             auto id = data.id.toRfc4122();
@@ -114,7 +126,8 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     bool hasValidOctreeData { false };
     if (includesNewData) {
         _cachedJSONData.clear();
-        replacementData = message->readAll();
+        // the data is written out before we return, so it can reference the message instead of copying it
+        replacementData = message->readWithoutCopy(message->getBytesLeftToRead());
         replaceData(replacementData);
         hasValidOctreeData = data.readOctreeDataInfoFromFile(_filename);
         qDebug() << "Got OctreeDataFileReply, new data sent";
@@ -123,19 +136,23 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
         
         OctreeUtils::RawEntityData data;
         qCDebug(octree) << "Reading octree data from" << _filename;
-        if (data.readOctreeDataInfoFromData(_cachedJSONData)) {
+        bool hasJSONData = !_cachedJSONData.isEmpty();
+        if (hasJSONData ? data.readOctreeDataInfoFromData(_cachedJSONData) : data.readOctreeDataInfoFromFile(_filename)) {
             hasValidOctreeData = true;
             if (data.id.isNull()) {
                 qCDebug(octree) << "Current octree data has a null id, updating";
                 data.resetIdAndVersion();
 
-                QFile file(_filename);
-                if (file.open(QIODevice::WriteOnly)) {
-                    auto entityData = data.toGzippedByteArray();
-                    file.write(entityData);
-                    file.close();
-                } else {
-                    qCDebug(octree) << "Failed to update octree data";
+                // binary data can't be rewritten from its header alone, our next persist writes the new id instead
+                if (hasJSONData) {
+                    QFile file(_filename);
+                    if (file.open(QIODevice::WriteOnly)) {
+                        auto entityData = data.toGzippedByteArray();
+                        file.write(entityData);
+                        file.close();
+                    } else {
+                        qCDebug(octree) << "Failed to update octree data";
+                    }
                 }
             }
         }
@@ -191,6 +208,12 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     // Since we just loaded the persistent file, we can consider ourselves as having just persisted
     _lastPersistCheck = std::chrono::steady_clock::now();
 
+    // our first persist compacts whatever journal we loaded, so we never append after a record torn by a crash
+    if (_journalEdits) {
+        _tree->setRecordsDeletesForJournal(true);
+        _needsCompaction = true;
+    }
+
     if (replacementData.isNull()) {
         sendLatestEntityDataToDS();
     }
@@ -204,7 +227,7 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
 QString OctreePersistThread::getPersistFileMimeType() const {
     if (_persistAsFileType == "json") {
         return "application/json";
-    } if (_persistAsFileType == "json.gz") {
+    } if (_persistAsFileType == "json.gz" || _persistAsFileType == "bin") {
         return "application/zip";
     }
     return "";
@@ -213,6 +236,9 @@ QString OctreePersistThread::getPersistFileMimeType() const {
 void OctreePersistThread::replaceData(QByteArray data) {
     backupCurrentFile();
 
+    // the journal holds changes to the content being replaced
+    QFile::remove(getJournalFilename());
+
     QFile currentFile { _filename };
     if (currentFile.open(QIODevice::WriteOnly)) {
         currentFile.write(data);
@@ -258,12 +284,23 @@ void OctreePersistThread::process() {
 
 void OctreePersistThread::aboutToFinish() {
     qCDebug(octree) << "Persist thread about to finish...";
+    // leave a full snapshot behind, which also brings the DS copy up to date
+    _needsCompaction = true;
     persist();
     qCDebug(octree) << "Persist thread done with about to finish...";
 }
 
 QByteArray OctreePersistThread::getPersistFileContents() const {
     QByteArray fileContents;
+
+    // the binary format is tied to our protocol version, so downloads get the same gzipped JSON we send the DS
+    if (_persistAsFileType == "bin") {
+        if (!_tree->toJSON(&fileContents, nullptr, true)) {
+            fileContents.clear();
+        }
+        return fileContents;
+    }
+
     QFile file(_filename);
     if (file.open(QIODevice::ReadOnly)) {
         fileContents = file.readAll();
@@ -312,10 +349,35 @@ void OctreePersistThread::persist() {
 
         _tree->incrementPersistDataVersion();
 
+        // changes made while we write are written again next time, which replays to the same result
+        quint64 persistStarted = usecTimestampNow();
+
+        if (_journalEdits && !shouldCompactJournal()) {
+            qCDebug(octree) << "Appending Octree changes to:" << getJournalFilename();
+            if (_tree->appendToBinaryJournal(_filename.toLocal8Bit().constData(), _lastPersistTime)) {
+                _tree->clearDirtyBit(); // tree is clean after saving
+                _lastPersistTime = persistStarted;
+            } else {
+                qCWarning(octree) << "Failed to append Octree changes to" << getJournalFilename();
+                _needsCompaction = true;
+            }
+
+            // the DS copy is brought up to date when we compact
+            return;
+        }
+
         qCDebug(octree) << "Saving Octree data to:" << _filename;
         if (_tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
             _tree->clearDirtyBit(); // tree is clean after saving
+            _lastPersistTime = persistStarted;
             qCDebug(octree) << "DONE persisting Octree data to" << _filename;
+
+            if (_journalEdits) {
+                // a journal left behind by a crash here only holds records older than the snapshot, which are skipped
+                QFile::remove(getJournalFilename());
+                _needsCompaction = false;
+                _lastCompaction = std::chrono::steady_clock::now();
+            }
         } else {
             qCWarning(octree) << "Failed to persist Octree data to" << _filename;
         }
@@ -324,6 +386,19 @@ void OctreePersistThread::persist() {
     }
 }
 
+QString OctreePersistThread::getJournalFilename() const {
+    return _filename + OctreeUtils::BINARY_PERSIST_JOURNAL_EXTENSION;
+}
+
+bool OctreePersistThread::shouldCompactJournal() const {
+    if (_needsCompaction || std::chrono::steady_clock::now() - _lastCompaction > MAX_TIME_BETWEEN_JOURNAL_COMPACTIONS) {
+        return true;
+    }
+
+    // replaying a journal as large as the snapshot costs more than loading a fresh snapshot
+    return QFileInfo(getJournalFilename()).size() >= QFileInfo(_filename).size();
+}
+
 void OctreePersistThread::sendLatestEntityDataToDS() {
     qDebug() << "Sending latest entity data to DS";
     auto nodeList = DependencyManager::get<NodeList>();
@@ -36,7 +36,8 @@ public:
                         const QString& filename,
                         std::chrono::milliseconds persistInterval = DEFAULT_PERSIST_INTERVAL,
                         bool debugTimestampNow = false,
-                        QString persistAsFileType = "json.gz");
+                        QString persistAsFileType = "json.gz",
+                        bool journalEdits = false);
 
     bool isInitialLoadComplete() const { return _initialLoadComplete; }
     quint64 getLoadElapsedTime() const { return _loadTimeUSecs; }
@@ -65,6 +66,9 @@ protected:
     void replaceData(QByteArray data);
     void sendLatestEntityDataToDS();
 
+    QString getJournalFilename() const;
+    bool shouldCompactJournal() const;
+
 private:
     OctreePointer _tree;
     QString _filename;
@@ -79,6 +83,12 @@ private:
 
     QString _persistAsFileType;
     QByteArray _cachedJSONData;
+
+    // with a journal, only the changes since the last persist are written until the journal is compacted into a snapshot
+    bool _journalEdits;
+    bool _needsCompaction { true };
+    quint64 _lastPersistTime { 0 };
+    std::chrono::steady_clock::time_point _lastCompaction;
 };
 
 #endif // hifi_OctreePersistThread_h
@@ -56,6 +56,10 @@ public:
     bool wantReportInitialCompletion() const { return _reportInitialCompletion; }
     void setReportInitialCompletion(bool reportInitialCompletion) { _reportInitialCompletion = reportInitialCompletion; }
 
+    // whether the client can inflate octree data compressed with OctreePacketData's preset dictionary
+    bool wantCompressionDictionary() const { return _wantCompressionDictionary; }
+    void setWantCompressionDictionary(bool wantCompressionDictionary) { _wantCompressionDictionary = wantCompressionDictionary; }
+
 signals:
     void incomingConnectionIDChanged();
 
@@ -78,11 +82,12 @@ protected:
     QJsonObject _jsonParameters;
     QReadWriteLock _jsonParametersLock;
     
-    enum OctreeQueryFlags : uint16_t { NoFlags = 0x0, WantInitialCompletion = 0x1 };
+    enum OctreeQueryFlags : uint16_t { NoFlags = 0x0, WantInitialCompletion = 0x1, WantCompressionDictionary = 0x2 };
     friend OctreeQuery::OctreeQueryFlags operator|=(OctreeQuery::OctreeQueryFlags& lhs, const int rhs);
 
     bool _hasReceivedFirstQuery { false };
     bool _reportInitialCompletion { false };
+    bool _wantCompressionDictionary { true }; // every OctreePacketData can inflate it, the server decides to use it
 };
 
 #endif // hifi_OctreeQuery_h
@@ -228,6 +228,7 @@ void OctreeQueryNode::parseNackPacket(ReceivedMessage& message) {
         OCTREE_PACKET_SEQUENCE sequenceNumber;
         message.readPrimitive(&sequenceNumber);
         _nackedSequenceNumbers.enqueue(sequenceNumber);
+        ++_numNackedPackets;
     }
 }
 
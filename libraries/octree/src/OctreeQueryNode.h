@@ -12,6 +12,7 @@
 #ifndef hifi_OctreeQueryNode_h
 #define hifi_OctreeQueryNode_h
 
+#include <atomic>
 #include <iostream>
 
 #include <qqueue.h>
@@ -80,6 +81,9 @@ public:
     bool hasNextNackedPacket() const;
     const NLPacket* getNextNackedPacket();
 
+    // the number of packets the client reported lost since the last call
+    int takeNumNackedPackets() { return _numNackedPackets.exchange(0); }
+
     // call only from OctreeSendThread for the given node
     bool haveJSONParametersChanged();
 
@@ -112,6 +116,7 @@ private:
 
     SentPacketHistory _sentPacketHistory;
     QQueue<OCTREE_PACKET_SEQUENCE> _nackedSequenceNumbers;
+    std::atomic<int> _numNackedPackets { 0 };
 
     std::array<char, udt::MAX_PACKET_SIZE> _lastOctreePayload;
 
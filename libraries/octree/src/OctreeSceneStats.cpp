@@ -66,6 +66,10 @@ void OctreeSceneStats::copyFromOther(const OctreeSceneStats& other) {
     _bytes = other._bytes;
     _passes = other._passes;
 
+    _uncompressedBytes = other._uncompressedBytes;
+    _compressedBytes = other._compressedBytes;
+    _totalCompressTime = other._totalCompressTime;
+
     _totalElements = other._totalElements;
     _totalInternal = other._totalInternal;
     _totalLeaves = other._totalLeaves;
@@ -165,6 +169,10 @@ void OctreeSceneStats::reset() {
     _bytes = 0;
     _passes = 0;
 
+    _uncompressedBytes = 0;
+    _compressedBytes = 0;
+    _totalCompressTime = 0;
+
     _totalElements = 0;
     _totalInternal = 0;
     _totalLeaves = 0;
@@ -207,6 +215,12 @@ void OctreeSceneStats::reset() {
     _treesRemoved = 0;
 }
 
+void OctreeSceneStats::sectionCompressed(int uncompressedBytes, int compressedBytes, quint64 usecs) {
+    _uncompressedBytes += uncompressedBytes;
+    _compressedBytes += compressedBytes;
+    _totalCompressTime += usecs;
+}
+
 void OctreeSceneStats::packetSent(int bytes) {
     _packets++;
     _bytes += bytes;
@@ -336,6 +350,10 @@ int OctreeSceneStats::packIntoPacket() {
     _statsPacket->writePrimitive(_existsInPacketBitsWritten);
     _statsPacket->writePrimitive(_treesRemoved);
 
+    _statsPacket->writePrimitive(_uncompressedBytes);
+    _statsPacket->writePrimitive(_compressedBytes);
+    _statsPacket->writePrimitive(_totalCompressTime);
+
     return _statsPacket->getPayloadSize();
 }
 
@@ -398,6 +416,10 @@ int OctreeSceneStats::unpackFromPacket(ReceivedMessage& packet) {
     packet.readPrimitive(&_existsInPacketBitsWritten);
     packet.readPrimitive(&_treesRemoved);
 
+    packet.readPrimitive(&_uncompressedBytes);
+    packet.readPrimitive(&_compressedBytes);
+    packet.readPrimitive(&_totalCompressTime);
+
     // running averages
     _elapsedAverage.updateAverage((float)_elapsed);
     unsigned long total = _existsInPacketBitsWritten + _colorSent;
@@ -473,6 +495,7 @@ OctreeSceneStats::ItemInfo OctreeSceneStats::_ITEMS[] = {
     { "Skipped - Occluded", YELLOWISH, 3, "Total,Internal,Leaves" },
     { "Didn't fit in packet", GREYISH, 4, "Total,Internal,Leaves,Removed" },
     { "Mode", GREENISH, 4, "Moving,Stationary,Partial,Full" },
+    { "Compression", YELLOWISH, 3, "Saved,Ratio,Time" },
 };
 
 const char* OctreeSceneStats::getItemValue(Item item) {
@@ -596,6 +619,14 @@ const char* OctreeSceneStats::getItemValue(Item item) {
                     (_isMoving ? "Moving" : "Stationary"));
             break;
         }
+        case ITEM_COMPRESSION: {
+            quint64 savedBytes = _uncompressedBytes > _compressedBytes ? _uncompressedBytes - _compressedBytes : 0;
+            float ratio = _uncompressedBytes == 0 ? 0.0f : (float)_compressedBytes / (float)_uncompressedBytes;
+            sprintf(_itemValueBuffer, "%lu bytes saved (%.0f%% of %lu bytes) in %llu usecs",
+                    (long unsigned int)savedBytes, (double)(ratio * 100.0f), (long unsigned int)_uncompressedBytes,
+                    (long long unsigned int)_totalCompressTime);
+            break;
+        }
         default:
             break;
     }
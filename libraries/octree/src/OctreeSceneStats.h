@@ -49,6 +49,9 @@ public:
     /// Track that a packet was sent as part of the scene.
     void packetSent(int bytes);
 
+    /// Track the compression of a section of octree data sent as part of the scene, and the time it took.
+    void sectionCompressed(int uncompressedBytes, int compressedBytes, quint64 usecs);
+
     /// Tracks the beginning of an encode pass during scene calculation.
     void encodeStarted();
 
@@ -120,6 +123,7 @@ public:
         ITEM_SKIPPED_OCCLUDED,
         ITEM_DIDNT_FIT,
         ITEM_MODE,
+        ITEM_COMPRESSION,
         ITEM_COUNT
     };
 
@@ -152,6 +156,10 @@ public:
     quint32 getLastFullTotalPackets() const { return _lastFullTotalPackets; }
     quint64 getLastFullTotalBytes() const { return _lastFullTotalBytes; }
 
+    quint64 getUncompressedBytes() const { return _uncompressedBytes; }
+    quint64 getCompressedBytes() const { return _compressedBytes; }
+    quint64 getTotalCompressTime() const { return _totalCompressTime; }
+
     // Used in client implementations to track individual octree packets
     void trackIncomingOctreePacket(ReceivedMessage& message, bool wasStatsPacket, qint64 nodeClockSkewUsec);
 
@@ -250,6 +258,11 @@ private:
     quint64 _bytes;
     quint32  _passes;
 
+    // compression of the octree data in the scene's packets
+    quint64 _uncompressedBytes;
+    quint64 _compressedBytes;
+    quint64 _totalCompressTime;
+
     // incoming packets stats
     quint32 _incomingPacket;
     quint64 _incomingBytes;
@@ -11,6 +11,8 @@
 
 #include "CharacterController.h"
 
+#include <mutex>
+
 #include <AvatarConstants.h>
 #include <NumericalConstants.h>
 #include <PhysicsCollisionGroups.h>
@@ -36,6 +38,9 @@ static TemporaryPairwiseCollisionFilter _pairwiseFilter;
 bool applyPairwiseFilter(btManifoldPoint& cp,
         const btCollisionObjectWrapper* colObj0Wrap, int partId0, int index0,
         const btCollisionObjectWrapper* colObj1Wrap, int partId1, int index1) {
+    // the narrowphase may add the contacts of MyAvatar from several threads at once, see PhysicsEngine::setMultithreaded()
+    static std::mutex filterMutex;
+    std::lock_guard<std::mutex> lock(filterMutex);
     static int32_t numCalls = 0;
     ++numCalls;
     // This callback is ONLY called on objects with btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK flag
@@ -214,8 +219,23 @@ void CharacterController::addToWorld() {
 bool CharacterController::checkForSupport(btCollisionWorld* collisionWorld) {
     bool pushing = _targetVelocity.length2() > FLT_EPSILON;
 
-    btDispatcher* dispatcher = collisionWorld->getDispatcher();
-    int numManifolds = dispatcher->getNumManifolds();
+    // the manifolds of the character are among those of the objects overlapping the ghost, which saves walking
+    // all the manifolds of the world every substep
+    _manifolds.resize(0);
+    if (_ghost.isInWorld()) {
+        _ghost.getOverlappingManifolds(_rigidBody, _manifolds);
+    } else {
+        btDispatcher* dispatcher = collisionWorld->getDispatcher();
+        int numWorldManifolds = dispatcher->getNumManifolds();
+        for (int i = 0; i < numWorldManifolds; i++) {
+            btPersistentManifold* contactManifold = dispatcher->getManifoldByIndexInternal(i);
+            if (_rigidBody == contactManifold->getBody1() || _rigidBody == contactManifold->getBody0()) {
+                _manifolds.push_back(contactManifold);
+            }
+        }
+    }
+    int numManifolds = _manifolds.size();
+    _queryStats.numManifolds += numManifolds;
     bool hasFloor = false;
     bool probablyStuck = _isStuck && _appliedStuckRecoveryStrategy;
 
@@ -227,54 +247,52 @@ bool CharacterController::checkForSupport(btCollisionWorld* collisionWorld) {
 
     _netCollisionImpulse = btVector3(0.0f, 0.0f, 0.0f);
     for (int i = 0; i < numManifolds; i++) {
-        btPersistentManifold* contactManifold = dispatcher->getManifoldByIndexInternal(i);
-        if (_rigidBody == contactManifold->getBody1() || _rigidBody == contactManifold->getBody0()) {
-            bool characterIsFirst = _rigidBody == contactManifold->getBody0();
-            int numContacts = contactManifold->getNumContacts();
-            int stepContactIndex = -1;
-            bool stepValid = true;
-            float highestStep = _minStepHeight;
-            for (int j = 0; j < numContacts; j++) {
-                // check for "floor"
-                btManifoldPoint& contact = contactManifold->getContactPoint(j);
-                btVector3 pointOnCharacter = characterIsFirst ? contact.m_localPointA : contact.m_localPointB; // object-local-frame
-                btVector3 normal = characterIsFirst ? contact.m_normalWorldOnB : -contact.m_normalWorldOnB; // points toward character
-                btScalar hitHeight = _halfHeight + _radius + pointOnCharacter.dot(_currentUp);
-
-                float distance = contact.getDistance();
-                if (distance < deepestDistance) {
-                    deepestDistance = distance;
-                }
-                float impulse = contact.getAppliedImpulse();
-                _netCollisionImpulse += impulse * normal;
-                if (impulse > strongestImpulse) {
-                    strongestImpulse = impulse;
-                }
+        btPersistentManifold* contactManifold = _manifolds[i];
+        bool characterIsFirst = _rigidBody == contactManifold->getBody0();
+        int numContacts = contactManifold->getNumContacts();
+        int stepContactIndex = -1;
+        bool stepValid = true;
+        float highestStep = _minStepHeight;
+        for (int j = 0; j < numContacts; j++) {
+            // check for "floor"
+            btManifoldPoint& contact = contactManifold->getContactPoint(j);
+            btVector3 pointOnCharacter = characterIsFirst ? contact.m_localPointA : contact.m_localPointB; // object-local-frame
+            btVector3 normal = characterIsFirst ? contact.m_normalWorldOnB : -contact.m_normalWorldOnB; // points toward character
+            btScalar hitHeight = _halfHeight + _radius + pointOnCharacter.dot(_currentUp);
+
+            float distance = contact.getDistance();
+            if (distance < deepestDistance) {
+                deepestDistance = distance;
+            }
+            float impulse = contact.getAppliedImpulse();
+            _netCollisionImpulse += impulse * normal;
+            if (impulse > strongestImpulse) {
+                strongestImpulse = impulse;
+            }
 
-                if (hitHeight < _maxStepHeight && normal.dot(_currentUp) > _minFloorNormalDotUp) {
+            if (hitHeight < _maxStepHeight && normal.dot(_currentUp) > _minFloorNormalDotUp) {
+                hasFloor = true;
+            }
+            if (stepValid && pushing && _targetVelocity.dot(normal) < 0.0f) {
+                // remember highest step obstacle
+                if (!_stepUpEnabled || hitHeight > _maxStepHeight) {
+                    // this manifold is invalidated by point that is too high
+                    stepValid = false;
+                } else if (hitHeight > highestStep && normal.dot(_targetVelocity) < 0.0f ) {
+                    highestStep = hitHeight;
+                    stepContactIndex = j;
                     hasFloor = true;
                 }
-                if (stepValid && pushing && _targetVelocity.dot(normal) < 0.0f) {
-                    // remember highest step obstacle
-                    if (!_stepUpEnabled || hitHeight > _maxStepHeight) {
-                        // this manifold is invalidated by point that is too high
-                        stepValid = false;
-                    } else if (hitHeight > highestStep && normal.dot(_targetVelocity) < 0.0f ) {
-                        highestStep = hitHeight;
-                        stepContactIndex = j;
-                        hasFloor = true;
-                    }
-                }
-            }
-            if (stepValid && stepContactIndex > -1 && highestStep > _stepHeight) {
-                // remember step info for later
-                btManifoldPoint& contact = contactManifold->getContactPoint(stepContactIndex);
-                btVector3 pointOnCharacter = characterIsFirst ? contact.m_localPointA : contact.m_localPointB; // object-local-frame
-                _stepNormal = characterIsFirst ? contact.m_normalWorldOnB : -contact.m_normalWorldOnB; // points toward character
-                _stepHeight = highestStep;
-                _stepPoint = rotation * pointOnCharacter; // rotate into world-frame
             }
         }
+        if (stepValid && stepContactIndex > -1 && highestStep > _stepHeight) {
+            // remember step info for later
+            btManifoldPoint& contact = contactManifold->getContactPoint(stepContactIndex);
+            btVector3 pointOnCharacter = characterIsFirst ? contact.m_localPointA : contact.m_localPointB; // object-local-frame
+            _stepNormal = characterIsFirst ? contact.m_normalWorldOnB : -contact.m_normalWorldOnB; // points toward character
+            _stepHeight = highestStep;
+            _stepPoint = rotation * pointOnCharacter; // rotate into world-frame
+        }
     }
 
     // If there's deep penetration and big impulse we're probably stuck.
@@ -332,12 +350,33 @@ void CharacterController::preStep(btCollisionWorld* collisionWorld) {
     btScalar rayLength = _radius + FLOOR_PROXIMITY_THRESHOLD;
     btVector3 rayEnd = rayStart - rayLength * _currentUp;
 
-    // scan down for nearby floor
-    ClosestNotMe rayCallback(_rigidBody);
-    rayCallback.m_closestHitFraction = 1.0f;
-    collisionWorld->rayTest(rayStart, rayEnd, rayCallback);
-    if (rayCallback.hasHit()) {
-        _floorDistance = rayLength * rayCallback.m_closestHitFraction - _radius;
+    // the hips haven't moved since the last scan and nothing around them moves: the floor is where it was
+    const btScalar MIN_FLOOR_PROBE_MOVEMENT = 0.01f * _radius;
+    const btScalar MIN_FLOOR_PROBE_MOVEMENT_SQUARED = MIN_FLOOR_PROBE_MOVEMENT * MIN_FLOOR_PROBE_MOVEMENT;
+    bool useGhost = _ghost.isInWorld() && computeCollisionMask() != BULLET_COLLISION_MASK_COLLISIONLESS;
+    if (useGhost && _floorProbe.valid &&
+            rayStart.distance2(_floorProbe.start) < MIN_FLOOR_PROBE_MOVEMENT_SQUARED &&
+            rayEnd.distance2(_floorProbe.end) < MIN_FLOOR_PROBE_MOVEMENT_SQUARED &&
+            !_ghost.overlapsActiveObject(_rigidBody)) {
+        ++_queryStats.numReusedRayTests;
+    } else {
+        // scan down for nearby floor, among the objects overlapping the ghost when it can see them
+        ClosestNotMe rayCallback(_rigidBody);
+        rayCallback.m_closestHitFraction = 1.0f;
+        if (useGhost) {
+            _ghost.rayTest(rayStart, rayEnd, rayCallback);
+        } else {
+            collisionWorld->rayTest(rayStart, rayEnd, rayCallback);
+        }
+        ++_queryStats.numRayTests;
+        _floorProbe.valid = useGhost;
+        _floorProbe.start = rayStart;
+        _floorProbe.end = rayEnd;
+        _floorProbe.hasHit = rayCallback.hasHit();
+        _floorProbe.hitFraction = rayCallback.m_closestHitFraction;
+    }
+    if (_floorProbe.hasHit) {
+        _floorDistance = rayLength * _floorProbe.hitFraction - _radius;
     }
 }
 
@@ -894,6 +933,7 @@ void CharacterController::updateState() {
     ClosestNotMe rayCallback(_rigidBody);
     rayCallback.m_closestHitFraction = 1.0f;
     _physicsEngine->getDynamicsWorld()->rayTest(rayStart, rayEnd, rayCallback);
+    ++_queryStats.numRayTests;
     bool rayHasHit = rayCallback.hasHit();
     quint64 now = usecTimestampNow();
     if (rayHasHit) {
@@ -1028,6 +1068,8 @@ void CharacterController::preSimulation() {
     if (_rigidBody) {
         // slam body transform and remember velocity
         _rigidBody->setWorldTransform(btTransform(btTransform(_rotation, _position)));
+        // the overlaps of the ghost are refreshed before the first substep queries them
+        _ghost.setWorldTransform(_rigidBody->getWorldTransform());
         _preSimulationVelocity = _rigidBody->getLinearVelocity();
 
         updateState();
@@ -148,6 +148,15 @@ public:
 
     void resetStuckCounter() { _numStuckSubsteps = 0; }
 
+    // how much the character asked of the collision world since the last reset
+    struct QueryStats {
+        uint32_t numRayTests { 0 };
+        uint32_t numReusedRayTests { 0 }; // floor scans answered by the previous one
+        uint32_t numManifolds { 0 }; // contact manifolds checked for support
+    };
+    const QueryStats& getQueryStats() const { return _queryStats; }
+    void resetQueryStats() { _queryStats = QueryStats(); }
+
 protected:
 #ifdef DEBUG_STATE_CHANGE
     void setState(State state, const char* reason);
@@ -172,6 +181,18 @@ protected:
 
     std::vector<CharacterMotor> _motors;
     CharacterGhostObject _ghost;
+    btManifoldArray _manifolds;
+
+    // the last scan for nearby floor of preStep()
+    struct FloorProbe {
+        btVector3 start { 0.0f, 0.0f, 0.0f };
+        btVector3 end { 0.0f, 0.0f, 0.0f };
+        btScalar hitFraction { 1.0f };
+        bool hasHit { false };
+        bool valid { false };
+    };
+    FloorProbe _floorProbe;
+    QueryStats _queryStats;
     btVector3 _currentUp;
     btVector3 _targetVelocity;
     btVector3 _parentVelocity;
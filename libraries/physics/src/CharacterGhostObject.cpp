@@ -67,13 +67,48 @@ void CharacterGhostObject::setCollisionWorld(btCollisionWorld* world) {
 
 bool CharacterGhostObject::rayTest(const btVector3& start,
         const btVector3& end,
-        CharacterRayResult& result) const {
+        btCollisionWorld::RayResultCallback& result) const {
     if (_world && _inWorld) {
         btGhostObject::rayTest(start, end, result);
     }
     return result.hasHit();
 }
 
+void CharacterGhostObject::getOverlappingManifolds(btCollisionObject* body, btManifoldArray& manifolds) {
+    manifolds.resize(0);
+    if (!_world || !_inWorld || !body->getBroadphaseHandle()) {
+        return;
+    }
+    btOverlappingPairCache* pairCache = _world->getPairCache();
+    btManifoldArray pairManifolds;
+    int numObjects = getNumOverlappingObjects();
+    for (int i = 0; i < numObjects; ++i) {
+        btCollisionObject* object = getOverlappingObject(i);
+        if (object == body || !object->getBroadphaseHandle()) {
+            continue;
+        }
+        btBroadphasePair* pair = pairCache->findPair(body->getBroadphaseHandle(), object->getBroadphaseHandle());
+        if (pair && pair->m_algorithm) {
+            pairManifolds.resize(0);
+            pair->m_algorithm->getAllContactManifolds(pairManifolds);
+            for (int j = 0; j < pairManifolds.size(); ++j) {
+                manifolds.push_back(pairManifolds[j]);
+            }
+        }
+    }
+}
+
+bool CharacterGhostObject::overlapsActiveObject(const btCollisionObject* body) const {
+    int numObjects = getNumOverlappingObjects();
+    for (int i = 0; i < numObjects; ++i) {
+        const btCollisionObject* object = getOverlappingObject(i);
+        if (object != body && !object->isStaticObject() && object->isActive()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void CharacterGhostObject::refreshOverlappingPairCache() {
     assert(_world && _inWorld);
     btVector3 minAabb, maxAabb;
@@ -38,9 +38,19 @@ public:
 
     void setCollisionWorld(btCollisionWorld* world);
 
+    bool isInWorld() const { return _inWorld; }
+
+    // only tests the objects overlapping the ghost, so the ray must stay inside of its Aabb
     bool rayTest(const btVector3& start,
             const btVector3& end,
-            CharacterRayResult& result) const;
+            btCollisionWorld::RayResultCallback& result) const;
+
+    // the contact manifolds between the body and the objects overlapping the ghost, found in the pair cache of the world
+    // rather than among all the manifolds of the dispatcher
+    void getOverlappingManifolds(btCollisionObject* body, btManifoldArray& manifolds);
+
+    // true if any object overlapping the ghost, but the body, may move during the next substep
+    bool overlapsActiveObject(const btCollisionObject* body) const;
 
     void refreshOverlappingPairCache();
 
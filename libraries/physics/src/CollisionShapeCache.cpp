@@ -0,0 +1,83 @@
+//
+//  CollisionShapeCache.cpp
+//  libraries/physics/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CollisionShapeCache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QFile>
+
+#include <LinearMath/btScalar.h>
+
+#include <SettingHandle.h>
+
+const int CollisionShapeCache::CURRENT_VERSION = 0x01;
+const int CollisionShapeCache::INVALID_VERSION = 0x00;
+const char* CollisionShapeCache::SETTING_VERSION_NAME = "hifi.shapecache.version";
+
+CollisionShapeCache::CollisionShapeCache(const std::string& dir, const std::string& ext) :
+    FileCache(dir, ext) { }
+
+void CollisionShapeCache::initialize() {
+    FileCache::initialize();
+    Setting::Handle<int> cacheVersionHandle(SETTING_VERSION_NAME, INVALID_VERSION);
+    auto cacheVersion = cacheVersionHandle.get();
+    if (cacheVersion != CURRENT_VERSION) {
+        wipe();
+        cacheVersionHandle.set(CURRENT_VERSION);
+    }
+}
+
+cache::FileCache::Key CollisionShapeCache::getShapeKey(const ShapeInfo& info) {
+    // the key is also the file name, and the cache only keeps what comes before the first dot of it
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    auto addValue = [&hash](const void* value, size_t size) {
+        hash.addData(reinterpret_cast<const char*>(value), (int)size);
+    };
+
+    // the data Bullet builds differs with its version and precision
+    int bulletVersion = btGetVersion();
+    int scalarSize = (int)sizeof(btScalar);
+    addValue(&bulletVersion, sizeof(bulletVersion));
+    addValue(&scalarSize, sizeof(scalarSize));
+
+    int type = info.getType();
+    glm::vec3 halfExtents = info.getHalfExtents();
+    glm::vec3 offset = info.getOffset();
+    addValue(&type, sizeof(type));
+    addValue(&halfExtents, sizeof(halfExtents));
+    addValue(&offset, sizeof(offset));
+    for (const auto& points : info.getPointCollection()) {
+        uint32_t numPoints = (uint32_t)points.size();
+        addValue(&numPoints, sizeof(numPoints));
+        addValue(points.data(), points.size() * sizeof(glm::vec3));
+    }
+    const auto& triangleIndices = info.getTriangleIndices();
+    addValue(triangleIndices.data(), triangleIndices.size() * sizeof(int32_t));
+    return hash.result().toHex().toStdString();
+}
+
+bool CollisionShapeCache::readShapeData(const Key& key, QByteArray& data) {
+    auto file = getFile(key);
+    if (!file) {
+        return false;
+    }
+
+    QFile shapeFile(file->getFilepath().c_str());
+    if (!shapeFile.open(QIODevice::ReadOnly) || shapeFile.size() != (qint64)file->getLength()) {
+        return false;
+    }
+    data = shapeFile.readAll();
+    return data.size() == (int)file->getLength();
+}
+
+void CollisionShapeCache::writeShapeData(const Key& key, const QByteArray& data) {
+    // the cache keeps the file for the next sessions once it is released
+    writeFile(data.constData(), Metadata(key, data.size()));
+}
@@ -0,0 +1,43 @@
+//
+//  CollisionShapeCache.h
+//  libraries/physics/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CollisionShapeCache_h
+#define hifi_CollisionShapeCache_h
+
+#include <QtCore/QByteArray>
+
+#include <shared/FileCache.h>
+#include <ShapeInfo.h>
+
+// Keeps what is slow to build for a collision shape, such as the bounding volume hierarchy of a static mesh,
+// on disk across sessions.
+class CollisionShapeCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    // Whenever a change is made to the way shapes are built or kept that isn't backward compatible,
+    // this value should be incremented.  This will force the shape cache to be wiped
+    static const int CURRENT_VERSION;
+    static const int INVALID_VERSION;
+    static const char* SETTING_VERSION_NAME;
+
+    CollisionShapeCache(const std::string& dir, const std::string& ext);
+
+    void initialize() override;
+
+    // A hash of everything the shape is built from. ShapeInfo::getHash() leaves the points of meshes out,
+    // which is fine within a session but not once the model behind a url can change.
+    static Key getShapeKey(const ShapeInfo& info);
+
+    bool readShapeData(const Key& key, QByteArray& data);
+    void writeShapeData(const Key& key, const QByteArray& data);
+};
+
+#endif // hifi_CollisionShapeCache_h
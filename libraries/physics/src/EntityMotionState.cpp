@@ -28,6 +28,16 @@
 const uint8_t LOOPS_FOR_SIMULATION_ORPHAN = 50;
 const quint64 USECS_BETWEEN_OWNERSHIP_BIDS = USECS_PER_SECOND / 5;
 
+// static
+uint8_t minimumBidPriority = 0;
+void EntityMotionState::setMinimumBidPriority(uint8_t priority) {
+    minimumBidPriority = priority;
+}
+
+// static
+uint8_t EntityMotionState::getMinimumBidPriority() {
+    return minimumBidPriority;
+}
 
 EntityMotionState::EntityMotionState(btCollisionShape* shape, EntityItemPointer entity) :
     ObjectMotionState(nullptr),
@@ -290,6 +300,7 @@ void EntityMotionState::setWorldTransform(const btTransform& worldTrans) {
 
 
 const uint8_t MAX_NUM_INACTIVE_UPDATES = 20;
+const float INACTIVE_UPDATE_PERIOD = 0.5f;
 
 bool EntityMotionState::remoteSimulationOutOfSync(uint32_t simulationStep) {
     // NOTE: this method is only ever called when the entity simulation is locally owned
@@ -312,7 +323,6 @@ bool EntityMotionState::remoteSimulationOutOfSync(uint32_t simulationStep) {
         // we resend the inactive update with a growing delay: every INACTIVE_UPDATE_PERIOD * _numInactiveUpdates
         // until it is removed from the owned list
         // (which happens when we no longer own the simulation)
-        const float INACTIVE_UPDATE_PERIOD = 0.5f;
         return (dt > INACTIVE_UPDATE_PERIOD * (float)_numInactiveUpdates);
     }
 
@@ -401,6 +411,22 @@ bool EntityMotionState::remoteSimulationOutOfSync(uint32_t simulationStep) {
     return false;
 }
 
+bool EntityMotionState::isAsleep(uint32_t simulationStep) const {
+    // the whole island goes to sleep at once and is woken at once, until then none of its bodies move
+    if (!_body || _body->getActivationState() != ISLAND_SLEEPING) {
+        return false;
+    }
+    // the inactive update went out, but it is resent with a growing delay
+    if (_numInactiveUpdates == 0 || _numInactiveUpdates > MAX_NUM_INACTIVE_UPDATES) {
+        return false;
+    }
+    if (_entity->dynamicDataNeedsTransmit() || _entity->shouldSuppressLocationEdits()) {
+        return false;
+    }
+    float dt = (float)(simulationStep - _lastStep) * PHYSICS_ENGINE_FIXED_SUBSTEP;
+    return dt <= INACTIVE_UPDATE_PERIOD * (float)_numInactiveUpdates;
+}
+
 bool EntityMotionState::shouldSendUpdate(uint32_t simulationStep) {
     // NOTE: this method is only ever called when the entity simulation is locally owned
     DETAILED_PROFILE_RANGE(simulation_physics, "ShouldSend");
@@ -748,7 +774,8 @@ bool EntityMotionState::shouldSendBid() const {
     return _body->isActive()
         && (_region == workload::Region::R1)
         && _ownershipState != EntityMotionState::OwnershipState::Unownable
-        && glm::max(glm::max(VOLUNTEER_SIMULATION_PRIORITY, _bumpedPriority), _entity->getScriptSimulationPriority()) >= _entity->getSimulationPriority()
+        && glm::max(glm::max(glm::max(VOLUNTEER_SIMULATION_PRIORITY, minimumBidPriority), _bumpedPriority),
+                _entity->getScriptSimulationPriority()) >= _entity->getSimulationPriority()
         && !_entity->getLocked()
         && (!_body->isStaticOrKinematicObject() || _entity->stillHasMyGrab());
 }
@@ -764,7 +791,8 @@ void EntityMotionState::setRigidBody(btRigidBody* body) {
 
 uint8_t EntityMotionState::computeFinalBidPriority() const {
     return (_region == workload::Region::R1) ?
-        glm::max(glm::max(VOLUNTEER_SIMULATION_PRIORITY, _bumpedPriority), _entity->getScriptSimulationPriority()) : 0;
+        glm::max(glm::max(glm::max(VOLUNTEER_SIMULATION_PRIORITY, minimumBidPriority), _bumpedPriority),
+            _entity->getScriptSimulationPriority()) : 0;
 }
 
 bool EntityMotionState::isLocallyOwned() const {
@@ -33,6 +33,11 @@ public:
         Unownable
     };
 
+    // Every bid of this simulation is made at least at this priority (e.g. AUTHORITATIVE_SIMULATION_PRIORITY
+    // for a simulation that is the authority over its entities), it is global like the statics of ObjectMotionState
+    static void setMinimumBidPriority(uint8_t priority);
+    static uint8_t getMinimumBidPriority();
+
     EntityMotionState() = delete;
     EntityMotionState(btCollisionShape* shape, EntityItemPointer item);
     virtual ~EntityMotionState();
@@ -52,6 +57,9 @@ public:
     virtual void setWorldTransform(const btTransform& worldTrans) override;
 
     bool shouldSendUpdate(uint32_t simulationStep);
+    // true while the island of the body sleeps and no resend of its inactive update is due before the step,
+    // shouldSendUpdate() need not be polled until then
+    bool isAsleep(uint32_t simulationStep) const;
     void sendBid(OctreeEditPacketSender* packetSender, uint32_t step);
     void sendUpdate(OctreeEditPacketSender* packetSender, uint32_t step);
 
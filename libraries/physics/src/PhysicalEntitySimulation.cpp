@@ -12,6 +12,7 @@
 
 #include "PhysicalEntitySimulation.h"
 
+#include <PerfStat.h>
 #include <Profile.h>
 
 #include "PhysicsHelpers.h"
@@ -43,7 +44,7 @@ void PhysicalEntitySimulation::init(
 void PhysicalEntitySimulation::addEntityToInternalLists(EntityItemPointer entity) {
     EntitySimulation::addEntityToInternalLists(entity);
     entity->deserializeActions(); // TODO: do this elsewhere
-    uint8_t region = _space->getRegion(entity->getSpaceIndex());
+    uint8_t region = getRegion(entity);
     bool maybeShouldBePhysical = (region < workload::Region::R3 || region == workload::Region::UNKNOWN) && entity->shouldBePhysical();
     bool canBeKinematic = region <= workload::Region::R3;
     if (maybeShouldBePhysical) {
@@ -117,7 +118,7 @@ void PhysicalEntitySimulation::processChangedEntity(const EntityItemPointer& ent
 
     // queue incoming changes: from external sources (script, EntityServer, etc) to physics engine
     EntityMotionState* motionState = static_cast<EntityMotionState*>(entity->getPhysicsInfo());
-    uint8_t region = _space->getRegion(entity->getSpaceIndex());
+    uint8_t region = getRegion(entity);
     bool shouldBePhysical = region < workload::Region::R3 && entity->shouldBePhysical();
     bool canBeKinematic = region <= workload::Region::R3;
     if (motionState) {
@@ -259,12 +260,19 @@ void PhysicalEntitySimulation::removeDeadEntities() {
 }
 // end EntitySimulation overrides
 
+uint8_t PhysicalEntitySimulation::getRegion(const EntityItemPointer& entity) const {
+    if (_regionOperator) {
+        return _regionOperator(entity);
+    }
+    return _space->getRegion(entity->getSpaceIndex());
+}
+
 void PhysicalEntitySimulation::buildMotionStatesForEntitiesThatNeedThem() {
     // this lambda for when we decide to actually build the motionState
     auto buildMotionState = [&](btCollisionShape* shape, EntityItemPointer entity) {
         EntityMotionState* motionState = new EntityMotionState(shape, entity);
         entity->setPhysicsInfo(static_cast<void*>(motionState));
-        motionState->setRegion(_space->getRegion(entity->getSpaceIndex()));
+        motionState->setRegion(getRegion(entity));
         _physicalObjects.insert(motionState);
         _incomingChanges.insert(motionState);
     };
@@ -352,7 +360,7 @@ void PhysicalEntitySimulation::buildMotionStatesForEntitiesThatNeedThem() {
             continue;
         }
 
-        uint8_t region = _space->getRegion(entity->getSpaceIndex());
+        uint8_t region = getRegion(entity);
         if (region == workload::Region::UNKNOWN) {
             // the workload hasn't categorized it yet --> skip for later
             ++entityItr;
@@ -392,6 +400,7 @@ void PhysicalEntitySimulation::buildMotionStatesForEntitiesThatNeedThem() {
 }
 
 void PhysicalEntitySimulation::buildPhysicsTransaction(PhysicsEngine::Transaction& transaction) {
+    PerformanceTimer perfTimer("buildPhysicsTransaction");
     QMutexLocker lock(&_mutex);
     // entities being removed
     for (auto entity : _entitiesToRemoveFromPhysics) {
@@ -411,9 +420,14 @@ void PhysicalEntitySimulation::buildPhysicsTransaction(PhysicsEngine::Transactio
     _entitiesToRemoveFromPhysics.clear();
 
     // entities to add
-    buildMotionStatesForEntitiesThatNeedThem();
+    {
+        PerformanceTimer perfTimer("buildMotionStates");
+        buildMotionStatesForEntitiesThatNeedThem();
+    }
 
     // motionStates with changed entities: delete, add, or change
+    PerformanceTimer changesTimer("incomingChanges");
+    SetOfEntityMotionStates deferredChanges;
     for (auto& object : _incomingChanges) {
         uint32_t unhandledFlags = object->getIncomingDirtyFlags();
 
@@ -424,6 +438,11 @@ void PhysicalEntitySimulation::buildPhysicsTransaction(PhysicsEngine::Transactio
             transaction.objectsToRemove.push_back(object);
             continue;
         }
+        if (!isInPhysicsSimulation && transaction.objectsToAdd.size() >= _maxNumObjectsToAddPerFrame) {
+            // a big wake-up (e.g. a domain just loaded) is spread over several frames: the rest waits for the next
+            deferredChanges.insert(object);
+            continue;
+        }
 
         bool needsNewShape = object->needsNewShape();
         if (needsNewShape) {
@@ -486,7 +505,7 @@ void PhysicalEntitySimulation::buildPhysicsTransaction(PhysicsEngine::Transactio
         }
         object->clearIncomingDirtyFlags(handledFlags);
     }
-    _incomingChanges.clear();
+    _incomingChanges.swap(deferredChanges);
 }
 
 void PhysicalEntitySimulation::handleProcessedPhysicsTransaction(PhysicsEngine::Transaction& transaction) {
@@ -501,6 +520,7 @@ void PhysicalEntitySimulation::handleProcessedPhysicsTransaction(PhysicsEngine::
 }
 
 void PhysicalEntitySimulation::handleDeactivatedMotionStates(const VectorOfMotionStates& motionStates) {
+    PerformanceTimer perfTimer("handleDeactivatedMotionStates");
     bool serverlessMode = getEntityTree()->isServerlessMode();
     for (auto stateItr : motionStates) {
         ObjectMotionState* state = &(*stateItr);
@@ -533,6 +553,7 @@ void PhysicalEntitySimulation::handleDeactivatedMotionStates(const VectorOfMotio
 
 void PhysicalEntitySimulation::handleChangedMotionStates(const VectorOfMotionStates& motionStates) {
     PROFILE_RANGE_EX(simulation_physics, "ChangedEntities", 0x00000000, (uint64_t)motionStates.size());
+    PerformanceTimer perfTimer("handleChangedMotionStates");
     QMutexLocker lock(&_mutex);
 
     for (auto stateItr : motionStates) {
@@ -629,6 +650,7 @@ void PhysicalEntitySimulation::sendOwnedUpdates(uint32_t numSubsteps) {
         return;
     }
     PROFILE_RANGE_EX(simulation_physics, "Update", 0x00000000, (uint64_t)_owned.size());
+    PerformanceTimer perfTimer("sendOwnedUpdates");
     uint32_t i = 0;
     while (i < _owned.size()) {
         if (!_owned[i]->isLocallyOwned()) {
@@ -638,6 +660,9 @@ void PhysicalEntitySimulation::sendOwnedUpdates(uint32_t numSubsteps) {
                 _owned[i]->clearOwnershipState();
             }
             _owned.remove(i);
+        } else if (_owned[i]->isAsleep(numSubsteps)) {
+            // nothing moves on a sleeping island, there is nothing to check until it wakes up
+            ++i;
         } else {
             if (_owned[i]->shouldSendUpdate(numSubsteps)) {
                 _owned[i]->sendUpdate(_entityPacketSender, numSubsteps);
@@ -13,6 +13,7 @@
 #define hifi_PhysicalEntitySimulation_h
 
 #include <stdint.h>
+#include <functional>
 #include <map>
 #include <set>
 
@@ -31,6 +32,8 @@ class PhysicalEntitySimulation;
 using PhysicalEntitySimulationPointer = std::shared_ptr<PhysicalEntitySimulation>;
 using SetOfEntityMotionStates = QSet<EntityMotionState*>;
 
+const uint32_t DEFAULT_MAX_NUM_OBJECTS_TO_ADD_PER_FRAME = 256;
+
 class VectorOfEntityMotionStates: public std::vector<EntityMotionState*> {
 public:
     void remove(uint32_t index) {
@@ -59,6 +62,10 @@ public:
     void init(EntityTreePointer tree, PhysicsEnginePointer engine, EntityEditPacketSender* packetSender);
     void setWorkloadSpace(const workload::SpacePointer space) { _space = space; }
 
+    // Where there is no workload to sort the entities, the operator gives their regions instead
+    using RegionOperator = std::function<uint8_t(const EntityItemPointer& entity)>;
+    void setRegionOperator(const RegionOperator& regionOperator) { _regionOperator = regionOperator; }
+
     void addDynamic(EntityDynamicPointer dynamic) override;
     void removeDynamic(const QUuid dynamicID) override;
     void applyDynamicChanges() override;
@@ -99,8 +106,13 @@ public:
     void sendOwnershipBids(uint32_t numSubsteps);
     void sendOwnedUpdates(uint32_t numSubsteps);
 
+    // the objects added to the physics engine by one transaction, the others wait for the next ones
+    void setMaxNumObjectsToAddPerFrame(uint32_t maxNumObjects) { _maxNumObjectsToAddPerFrame = glm::max(maxNumObjects, 1u); }
+    uint32_t getMaxNumObjectsToAddPerFrame() const { return _maxNumObjectsToAddPerFrame; }
+
 private:
     void buildMotionStatesForEntitiesThatNeedThem();
+    uint8_t getRegion(const EntityItemPointer& entity) const;
 
     class ShapeRequest {
     public:
@@ -132,9 +144,11 @@ private:
     QMutex _dynamicsMutex { QMutex::Recursive };
 
     workload::SpacePointer _space;
+    RegionOperator _regionOperator;
     uint64_t _nextBidExpiry;
     uint32_t _lastStepSendPackets { 0 };
     uint32_t _lastWorkDeliveryCount { 0 };
+    uint32_t _maxNumObjectsToAddPerFrame { DEFAULT_MAX_NUM_OBJECTS_TO_ADD_PER_FRAME };
 };
 
 
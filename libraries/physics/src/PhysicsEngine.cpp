@@ -18,7 +18,9 @@
 #include <PerfStat.h>
 #include <PhysicsCollisionGroups.h>
 #include <Profile.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
 #include <BulletCollision/CollisionShapes/btTriangleShape.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
 
 #include "CharacterController.h"
 #include "ObjectMotionState.h"
@@ -34,21 +36,31 @@ PhysicsEngine::PhysicsEngine(const glm::vec3& offset) :
 
 PhysicsEngine::~PhysicsEngine() {
     _myAvatarController = nullptr;
+    setMultithreaded(false);
     delete _collisionConfig;
     delete _collisionDispatcher;
     delete _broadphaseFilter;
     delete _constraintSolver;
+    delete _constraintSolverMt;
     delete _dynamicsWorld;
     delete _ghostPairCallback;
 }
 
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
+        // the world is built for Bullet's task scheduler, which stays the sequential one until setMultithreaded(true)
+        _taskScheduler.reset(new PhysicsTaskScheduler());
+        if (!btGetTaskScheduler()) {
+            btSetTaskScheduler(btGetSequentialTaskScheduler());
+        }
+
         _collisionConfig = new btDefaultCollisionConfiguration();
-        _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
+        _collisionDispatcher = new btCollisionDispatcherMt(_collisionConfig);
         _broadphaseFilter = new btDbvtBroadphase();
-        _constraintSolver = new btSequentialImpulseConstraintSolver;
-        _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver, _collisionConfig);
+        _constraintSolver = new btConstraintSolverPoolMt(_taskScheduler->getMaxNumThreads());
+        _constraintSolverMt = new btSequentialImpulseConstraintSolverMt();
+        _dynamicsWorld = new ThreadSafeDynamicsWorld(_collisionDispatcher, _broadphaseFilter, _constraintSolver,
+                                                     _constraintSolverMt, _collisionConfig);
         _physicsDebugDraw.reset(new PhysicsDebugDraw());
 
         // hook up debug draw renderer
@@ -819,6 +831,22 @@ void PhysicsEngine::setShowBulletConstraintLimits(bool value) {
     }
 }
 
+void PhysicsEngine::setMultithreaded(bool value) {
+    if (!_taskScheduler) {
+        return;
+    }
+    // Bullet only lets the scheduler change on the thread that steps the world, between steps
+    if (value) {
+        btSetTaskScheduler(_taskScheduler.get());
+    } else if (btGetTaskScheduler() == _taskScheduler.get()) {
+        btSetTaskScheduler(btGetSequentialTaskScheduler());
+    }
+}
+
+bool PhysicsEngine::isMultithreaded() const {
+    return _taskScheduler && btGetTaskScheduler() == _taskScheduler.get();
+}
+
 void PhysicsEngine::setContactAddedCallback(PhysicsEngine::ContactAddedCallback newCb) {
     // gContactAddedCallback is a special feature hook in Bullet
     // if non-null AND one of the colliding objects has btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK flag set
@@ -26,6 +26,9 @@
 #include "ThreadSafeDynamicsWorld.h"
 #include "ObjectAction.h"
 #include "ObjectConstraint.h"
+#include "PhysicsTaskScheduler.h"
+
+class btSequentialImpulseConstraintSolverMt;
 
 const float HALF_SIMULATION_EXTENT = 512.0f; // meters
 
@@ -150,6 +153,11 @@ public:
     void setShowBulletConstraints(bool value);
     void setShowBulletConstraintLimits(bool value);
 
+    // runs the narrowphase, the islands and the motion integration of the next steps on the TBB workers, or back on
+    // this thread only
+    void setMultithreaded(bool value);
+    bool isMultithreaded() const;
+
     // Function for getting colliding objects in the world of specified type
     // See PhysicsCollisionGroups.h for mask flags.
     std::vector<ContactTestResult> contactTest(uint16_t mask, const ShapeInfo& regionShapeInfo, const Transform& regionTransform, uint16_t group = USER_COLLISION_GROUP_DYNAMIC, float threshold = 0.0f) const;
@@ -172,7 +180,9 @@ private:
     btDefaultCollisionConfiguration* _collisionConfig = NULL;
     btCollisionDispatcher* _collisionDispatcher = NULL;
     btBroadphaseInterface* _broadphaseFilter = NULL;
-    btSequentialImpulseConstraintSolver* _constraintSolver = NULL;
+    btConstraintSolverPoolMt* _constraintSolver = NULL;
+    btSequentialImpulseConstraintSolverMt* _constraintSolverMt = NULL;
+    std::unique_ptr<PhysicsTaskScheduler> _taskScheduler;
     ThreadSafeDynamicsWorld* _dynamicsWorld = NULL;
     btGhostPairCallback* _ghostPairCallback = NULL;
     std::unique_ptr<PhysicsDebugDraw> _physicsDebugDraw;
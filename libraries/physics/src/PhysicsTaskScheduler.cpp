@@ -0,0 +1,54 @@
+//
+//  PhysicsTaskScheduler.cpp
+//  libraries/physics/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsTaskScheduler.h"
+
+#include <algorithm>
+#include <functional>
+
+#include <LinearMath/btQuickprof.h>
+
+PhysicsTaskScheduler::PhysicsTaskScheduler() : btITaskScheduler("TBB") {
+    setNumThreads(getMaxNumThreads());
+}
+
+int PhysicsTaskScheduler::getMaxNumThreads() const {
+    return std::min((int)BT_MAX_THREAD_COUNT, tbb::task_scheduler_init::default_num_threads());
+}
+
+void PhysicsTaskScheduler::setNumThreads(int numThreads) {
+    _numThreads = std::max(1, std::min(numThreads, getMaxNumThreads()));
+    _arena.reset(new tbb::task_arena(_numThreads));
+}
+
+void PhysicsTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) {
+    BT_PROFILE("parallelFor_TBB");
+    btPushThreadsAreRunning();
+    _arena->execute([&] {
+        tbb::parallel_for(tbb::blocked_range<int>(iBegin, iEnd, grainSize), [&](const tbb::blocked_range<int>& range) {
+            body.forLoop(range.begin(), range.end());
+        }, tbb::simple_partitioner());
+    });
+    btPopThreadsAreRunning();
+}
+
+btScalar PhysicsTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) {
+    BT_PROFILE("parallelSum_TBB");
+    btPushThreadsAreRunning();
+    btScalar sum = btScalar(0);
+    _arena->execute([&] {
+        sum = tbb::parallel_reduce(tbb::blocked_range<int>(iBegin, iEnd, grainSize), btScalar(0),
+            [&](const tbb::blocked_range<int>& range, btScalar partialSum) {
+                return partialSum + body.sumLoop(range.begin(), range.end());
+            }, std::plus<btScalar>(), tbb::simple_partitioner());
+    });
+    btPopThreadsAreRunning();
+    return sum;
+}
@@ -13,6 +13,8 @@
 
 #include <glm/gtx/norm.hpp>
 
+#include <BulletCollision/CollisionShapes/btOptimizedBvh.h>
+
 #include <SharedUtil.h> // for MILLIMETERS_PER_METER
 
 #include "BulletUtil.h"
@@ -27,7 +29,45 @@ public:
         assert(_dataArray);
     }
 
+    // with the bounding volume hierarchy that was built for the same data before, see serializeBvh()
+    StaticMeshShape(btTriangleIndexVertexArray* dataArray, const QByteArray& serializedBvh)
+    :   btBvhTriangleMeshShape(dataArray, true, false), _dataArray(dataArray) {
+        assert(_dataArray);
+        // Bullet maps the hierarchy in place, the buffer has to be aligned and to live as long as the shape
+        _bvhBuffer = btAlignedAlloc(serializedBvh.size(), 16);
+        memcpy(_bvhBuffer, serializedBvh.constData(), serializedBvh.size());
+        _bvh = btOptimizedBvh::deSerializeInPlace(_bvhBuffer, (unsigned int)serializedBvh.size(), false);
+        if (_bvh) {
+            setOptimizedBvh(_bvh);
+        } else {
+            btAlignedFree(_bvhBuffer);
+            _bvhBuffer = nullptr;
+            buildOptimizedBvh();
+        }
+    }
+
+    QByteArray serializeBvh() const {
+        const btOptimizedBvh* bvh = m_bvh;
+        if (!bvh) {
+            return QByteArray();
+        }
+        unsigned int size = bvh->calculateSerializeBufferSize();
+        void* buffer = btAlignedAlloc(size, 16);
+        QByteArray serializedBvh;
+        if (bvh->serializeInPlace(buffer, size, false)) {
+            serializedBvh = QByteArray(static_cast<const char*>(buffer), (int)size);
+        }
+        btAlignedFree(buffer);
+        return serializedBvh;
+    }
+
     ~StaticMeshShape() {
+        if (_bvh) {
+            // the hierarchy lives in _bvhBuffer and does not own any of its arrays
+            m_bvh = nullptr;
+            _bvh->~btOptimizedBvh();
+            btAlignedFree(_bvhBuffer);
+        }
         assert(_dataArray);
         IndexedMeshArray& meshes = _dataArray->getIndexedMeshArray();
         for (int32_t i = 0; i < meshes.size(); ++i) {
@@ -47,6 +87,8 @@ public:
 private:
     // the StaticMeshShape owns its vertex/index data
     btTriangleIndexVertexArray* _dataArray;
+    void* _bvhBuffer { nullptr };
+    btOptimizedBvh* _bvh { nullptr };
 };
 
 // the dataArray must be created before we create the StaticMeshShape
@@ -270,7 +312,7 @@ btTriangleIndexVertexArray* createStaticMeshArray(const ShapeInfo& info) {
     return dataArray;
 }
 
-const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info) {
+const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info, CollisionShapeCache* shapeCache) {
     btCollisionShape* shape = nullptr;
     int type = info.getType();
     switch(type) {
@@ -430,7 +472,21 @@ const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info)
         break;
         case SHAPE_TYPE_STATIC_MESH: {
             btTriangleIndexVertexArray* dataArray = createStaticMeshArray(info);
-            if (dataArray) {
+            if (dataArray && shapeCache) {
+                // building the hierarchy of a large mesh takes much longer than reading it back
+                auto key = CollisionShapeCache::getShapeKey(info);
+                QByteArray serializedBvh;
+                if (shapeCache->readShapeData(key, serializedBvh)) {
+                    shape = new StaticMeshShape(dataArray, serializedBvh);
+                } else {
+                    auto meshShape = new StaticMeshShape(dataArray);
+                    serializedBvh = meshShape->serializeBvh();
+                    if (!serializedBvh.isEmpty()) {
+                        shapeCache->writeShapeData(key, serializedBvh);
+                    }
+                    shape = meshShape;
+                }
+            } else if (dataArray) {
                 shape = new StaticMeshShape(dataArray);
             }
         }
@@ -489,6 +545,6 @@ void ShapeFactory::deleteShape(const btCollisionShape* shape) {
 }
 
 void ShapeFactory::Worker::run() {
-    shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+    shape = ShapeFactory::createShapeFromInfo(shapeInfo, shapeCache.get());
     emit submitWork(this);
 }
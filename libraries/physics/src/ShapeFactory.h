@@ -19,10 +19,13 @@
 
 #include <ShapeInfo.h>
 
+#include "CollisionShapeCache.h"
+
 // The ShapeFactory assembles and correctly disassembles btCollisionShapes.
 
 namespace ShapeFactory {
-    const btCollisionShape* createShapeFromInfo(const ShapeInfo& info);
+    // with a shapeCache the bounding volume hierarchy of a static mesh is read from it, or kept in it once built
+    const btCollisionShape* createShapeFromInfo(const ShapeInfo& info, CollisionShapeCache* shapeCache = nullptr);
     void deleteShape(const btCollisionShape* shape);
 
     class Worker : public QObject, public QRunnable {
@@ -31,6 +34,7 @@ namespace ShapeFactory {
         Worker(const ShapeInfo& info) : shapeInfo(info), shape(nullptr) {}
         void run() override;
         ShapeInfo shapeInfo;
+        std::shared_ptr<CollisionShapeCache> shapeCache;
         const btCollisionShape* shape;
     signals:
         void submitWork(Worker*);
@@ -74,6 +74,9 @@ public:
     uint32_t getWorkRequestCount() const { return _workRequestCount; }
     uint32_t getWorkDeliveryCount() const { return _workDeliveryCount; }
 
+    // the static meshes built from now on read their bounding volume hierarchies from it, or keep them in it
+    void setShapeCache(const std::shared_ptr<CollisionShapeCache>& shapeCache) { _shapeCache = shapeCache; }
+
 protected slots:
     void acceptWork(ShapeFactory::Worker* worker);
 
@@ -103,6 +106,7 @@ private:
     std::vector<uint64_t> _pendingMeshShapes;
     std::vector<KeyExpiry> _orphans;
     ShapeFactory::Worker* _deadWorker { nullptr };
+    std::shared_ptr<CollisionShapeCache> _shapeCache;
     TimePoint _nextOrphanExpiry;
     uint32_t _ringIndex { 0 };
     std::atomic_uint _workRequestCount { 0 };
@@ -16,6 +16,10 @@ class Encoder {
 public:
     virtual ~Encoder() { }
     virtual void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) = 0;
+
+    // the loss rate of the stream and the RTT of the connection it is sent on (0 when unknown), for codecs that
+    // adapt their bitrate and their redundancy to the network
+    virtual void setNetworkConditions(float lossRate, int rttMsecs) { }
 };
 
 class Decoder {
@@ -24,6 +28,10 @@ public:
     virtual void decode(const QByteArray& encodedBuffer, QByteArray& decodedBuffer) = 0;
 
     virtual void lostFrame(QByteArray& decodedBuffer) = 0;
+
+    // the frame lost right before the encoded one, which codecs that send redundant data of the previous frame
+    // can recover, the others interpolate it like lostFrame() does
+    virtual void recoverFrame(const QByteArray& nextEncodedBuffer, QByteArray& decodedBuffer) { lostFrame(decodedBuffer); }
 };
 
 class CodecPlugin : public Plugin {
@@ -32,4 +40,13 @@ public:
     virtual Decoder* createDecoder(int sampleRate, int numChannels) = 0;
     virtual void releaseEncoder(Encoder* encoder) = 0;
     virtual void releaseDecoder(Decoder* decoder) = 0;
+
+    // encode one frame for each of a batch of encoders created by this plugin
+    // codecs that can share work across streams should override this, the default encodes them one at a time
+    virtual void encodeBatch(Encoder* const* encoders, const QByteArray* decodedBuffers, QByteArray* encodedBuffers,
+                             int numBuffers) {
+        for (int i = 0; i < numBuffers; i++) {
+            encoders[i]->encode(decodedBuffers[i], encodedBuffers[i]);
+        }
+    }
 };
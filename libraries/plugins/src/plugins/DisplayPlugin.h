@@ -194,6 +194,9 @@ public:
     // Hardware specific stats
     virtual QJsonObject getHardwareStats() const { return QJsonObject(); }
 
+    // Where the time went for the last presented frames, oldest first, one map of timestamps per frame
+    virtual QVariantList getFrameTimeline() const { return QVariantList(); }
+
     virtual void copyTextureToQuickFramebuffer(NetworkTexturePointer source, QOpenGLFramebufferObject* target, GLsync* fenceSync) = 0;
 
     uint32_t presentCount() const { return _presentedFrameIndex; }
@@ -91,6 +91,10 @@ int PluginManager::instantiate() {
     return std::count_if(loaders.begin(), loaders.end(), [](const auto& loader) { return (bool)loader->instance(); });
 }
 
+void PluginManager::loadPlugins() const {
+    getLoadedPlugins();
+}
+
  auto PluginManager::getLoadedPlugins() const -> const LoaderList& {
     static std::once_flag once;
     static LoaderList loadedPlugins;
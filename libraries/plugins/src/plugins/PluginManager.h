@@ -42,6 +42,9 @@ public:
     int instantiate();
     void shutdown();
 
+    // loads the libraries of the runtime plugins without creating them, it can run on any thread
+    void loadPlugins() const;
+
     // Application that have statically linked plugins can expose them to the plugin manager with these function
     void setDisplayPluginProvider(const DisplayPluginProvider& provider);
     void setInputPluginProvider(const InputPluginProvider& provider);
@@ -39,6 +39,11 @@ static const QString CHANNELS_KEY = "channels";
 static const std::string PROCEDURAL_BLOCK = "//PROCEDURAL_BLOCK";
 static const std::string PROCEDURAL_VERSION = "//PROCEDURAL_VERSION";
 
+// The programs of the procedurals, by their sources, so that the many entities that use the same shader share one
+// program and it's compiled once rather than once per entity
+static std::mutex programCacheMutex;
+static std::unordered_map<std::string, std::weak_ptr<gpu::Shader>> programCache;
+
 bool operator==(const ProceduralData& a, const ProceduralData& b) {
     return ((a.version == b.version) &&
             (a.fragmentShaderUrl == b.fragmentShaderUrl) &&
@@ -276,37 +281,60 @@ void Procedural::prepare(gpu::Batch& batch,
 
         gpu::Shader::Source& fragmentSource = (key.isTransparent() && _transparentFragmentSource.valid()) ? _transparentFragmentSource : _opaqueFragmentSource;
 
-        // Build the fragment shader
-        fragmentSource.replacements.clear();
-        fragmentSource.replacements[PROCEDURAL_VERSION] = "#define PROCEDURAL_V" + std::to_string(_data.version);
-        fragmentSource.replacements[PROCEDURAL_BLOCK] = _fragmentShaderSource.toStdString();
-
-        // Set any userdata specified uniforms (if any)
-        if (!_data.uniforms.empty()) {
-            // First grab all the possible dialect/variant/Reflections
-            std::vector<shader::Reflection*> allReflections;
-            for (auto dialectIt = fragmentSource.dialectSources.begin(); dialectIt != fragmentSource.dialectSources.end(); ++dialectIt) {
-                for (auto variantIt = (*dialectIt).second.variantSources.begin(); variantIt != (*dialectIt).second.variantSources.end(); ++variantIt) {
-                    allReflections.push_back(&(*variantIt).second.reflection);
+        // everything the program is made from, the values of the uniforms don't change it
+        std::string programKey = vertexSource.name + "|" + fragmentSource.name + "|" + std::to_string(_data.version) + "|" +
+            _data.uniforms.keys().join(",").toStdString() + "|" + _fragmentShaderSource.toStdString();
+
+        std::lock_guard<std::mutex> cacheLock(programCacheMutex);
+        gpu::ShaderPointer program;
+        auto cachedProgram = programCache.find(programKey);
+        if (cachedProgram != programCache.end()) {
+            program = cachedProgram->second.lock();
+        }
+
+        if (!program) {
+            // Build the fragment shader
+            fragmentSource.replacements.clear();
+            fragmentSource.replacements[PROCEDURAL_VERSION] = "#define PROCEDURAL_V" + std::to_string(_data.version);
+            fragmentSource.replacements[PROCEDURAL_BLOCK] = _fragmentShaderSource.toStdString();
+
+            // Set any userdata specified uniforms (if any)
+            if (!_data.uniforms.empty()) {
+                // First grab all the possible dialect/variant/Reflections
+                std::vector<shader::Reflection*> allReflections;
+                for (auto dialectIt = fragmentSource.dialectSources.begin(); dialectIt != fragmentSource.dialectSources.end(); ++dialectIt) {
+                    for (auto variantIt = (*dialectIt).second.variantSources.begin(); variantIt != (*dialectIt).second.variantSources.end(); ++variantIt) {
+                        allReflections.push_back(&(*variantIt).second.reflection);
+                    }
                 }
-            }
-            // Then fill in every reflections the new custom bindings
-            int customSlot = procedural::slot::uniform::Custom;
-            for (const auto& key : _data.uniforms.keys()) {
-                std::string uniformName = key.toLocal8Bit().data();
-                for (auto reflection : allReflections) {
-                    reflection->uniforms[uniformName] = customSlot;
+                // Then fill in every reflections the new custom bindings
+                int customSlot = procedural::slot::uniform::Custom;
+                for (const auto& key : _data.uniforms.keys()) {
+                    std::string uniformName = key.toLocal8Bit().data();
+                    for (auto reflection : allReflections) {
+                        reflection->uniforms[uniformName] = customSlot;
+                    }
+                    ++customSlot;
                 }
-                ++customSlot;
             }
-        }
 
-        // Leave this here for debugging
-        //qCDebug(proceduralLog) << "FragmentShader:\n" << fragmentSource.getSource(shader::Dialect::glsl450, shader::Variant::Mono).c_str();
+            // Leave this here for debugging
+            //qCDebug(proceduralLog) << "FragmentShader:\n" << fragmentSource.getSource(shader::Dialect::glsl450, shader::Variant::Mono).c_str();
+
+            gpu::ShaderPointer vertexShader = gpu::Shader::createVertex(vertexSource);
+            gpu::ShaderPointer fragmentShader = gpu::Shader::createPixel(fragmentSource);
+            program = gpu::Shader::createProgram(vertexShader, fragmentShader);
 
-        gpu::ShaderPointer vertexShader = gpu::Shader::createVertex(vertexSource);
-        gpu::ShaderPointer fragmentShader = gpu::Shader::createPixel(fragmentSource);
-        gpu::ShaderPointer program = gpu::Shader::createProgram(vertexShader, fragmentShader);
+            // the programs no procedural uses anymore go as the cache grows
+            for (auto itr = programCache.begin(); itr != programCache.end();) {
+                if (itr->second.expired()) {
+                    itr = programCache.erase(itr);
+                } else {
+                    ++itr;
+                }
+            }
+            programCache[programKey] = program;
+        }
 
         _proceduralPipelines[key] = gpu::Pipeline::create(program, key.isTransparent() ? _transparentState : _opaqueState);
 
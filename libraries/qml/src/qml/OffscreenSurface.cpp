@@ -7,10 +7,12 @@
 //
 #include "OffscreenSurface.h"
 
+#include <mutex>
 #include <unordered_set>
 #include <unordered_map>
 
 #include <QtCore/QThread>
+#include <QtCore/QTimer>
 #include <QtQml/QtQml>
 #include <QtQml/QQmlEngine>
 #include <QtQml/QQmlComponent>
@@ -20,6 +22,8 @@
 #include <QtQuick/QQuickRenderControl>
 
 #include <GLMHelpers.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
 
 #include <gl/OffscreenGLCanvas.h>
 #include <shared/ReadWriteLockable.h>
@@ -34,6 +38,27 @@
 using namespace hifi::qml;
 using namespace hifi::qml::impl;
 
+static std::mutex firstLoadDurationsMutex;
+static QHash<QUrl, uint64_t> firstLoadDurations;
+
+static void recordFirstLoad(const QUrl& url, uint64_t startTime) {
+    uint64_t duration = usecTimestampNow() - startTime;
+    {
+        std::unique_lock<std::mutex> lock(firstLoadDurationsMutex);
+        if (firstLoadDurations.contains(url)) {
+            return;
+        }
+        firstLoadDurations.insert(url, duration);
+    }
+    qCDebug(qmlLogging) << "First load of" << url << "took" << (float)duration / USECS_PER_MSEC << "ms";
+    PROFILE_INSTANT(app, "first QML load", "t", { { "url", url.toString() }, { "usecs", (qulonglong)duration } });
+}
+
+QHash<QUrl, uint64_t> OffscreenSurface::getFirstLoadDurations() {
+    std::unique_lock<std::mutex> lock(firstLoadDurationsMutex);
+    return firstLoadDurations;
+}
+
 QmlUrlValidator OffscreenSurface::validator = [](const QUrl& url) -> bool { 
     if (url.isRelative()) {
         return true;
@@ -268,6 +293,14 @@ bool OffscreenSurface::isPaused() const {
     return _sharedObject->isPaused();
 }
 
+uint64_t OffscreenSurface::getLastRenderDuration() const {
+    return _sharedObject->getLastRenderDuration();
+}
+
+uint64_t OffscreenSurface::takeTotalRenderDuration() {
+    return SharedObject::takeTotalRenderDuration();
+}
+
 void OffscreenSurface::setProxyWindow(QWindow* window) {
     _sharedObject->setProxyWindow(window);
 }
@@ -324,6 +357,7 @@ void OffscreenSurface::loadInternal(const QUrl& qmlSource,
                                     const QmlContextObjectCallback& callback,
                                     const QmlContextCallback& contextCallback) {
     PROFILE_RANGE_EX(app, "OffscreenSurface::loadInternal", 0xffff00ff, 0, { std::make_pair("url", qmlSource.toDisplayString()) });
+    uint64_t loadStartTime = usecTimestampNow();
     if (QThread::currentThread() != thread()) {
         qFatal("Called load on a non-surface thread");
     }
@@ -345,10 +379,7 @@ void OffscreenSurface::loadInternal(const QUrl& qmlSource,
         _sharedObject->create(this);
     }
 
-    QUrl finalQmlSource = qmlSource;
-    if ((qmlSource.isRelative() && !qmlSource.isEmpty()) || qmlSource.scheme() == QLatin1String("file")) {
-        finalQmlSource = getSurfaceContext()->resolvedUrl(qmlSource);
-    }
+    QUrl finalQmlSource = resolveQmlSource(qmlSource);
 
     if (!getRootItem()) {
         _sharedObject->setObjectName(finalQmlSource.toString());
@@ -361,6 +392,7 @@ void OffscreenSurface::loadInternal(const QUrl& qmlSource,
         PROFILE_RANGE(app, "new QQmlComponent");
         qmlComponent = new QQmlComponent(getSurfaceContext()->engine(), finalQmlSource, QQmlComponent::PreferSynchronous);
     }
+    _loadStartTimes.insert(qmlComponent, loadStartTime);
     if (qmlComponent->isLoading()) {
         connect(qmlComponent, &QQmlComponent::statusChanged, this,
                 [=](QQmlComponent::Status) { finishQmlLoad(qmlComponent, targetContext, parent, callback); });
@@ -370,12 +402,118 @@ void OffscreenSurface::loadInternal(const QUrl& qmlSource,
     finishQmlLoad(qmlComponent, targetContext, parent, callback);
 }
 
+void OffscreenSurface::precompile(const QList<QUrl>& qmlSources) {
+    if (QThread::currentThread() != thread()) {
+        qFatal("Called precompile on a non-surface thread");
+    }
+    if (!getRootItem()) {
+        qCWarning(qmlLogging) << "Cannot precompile QML before the surface is created";
+        return;
+    }
+
+    for (const auto& qmlSource : qmlSources) {
+        if (!validator(qmlSource)) {
+            qCWarning(qmlLogging) << "Unauthorized QML URL found" << qmlSource;
+            continue;
+        }
+
+        QUrl finalQmlSource = resolveQmlSource(qmlSource);
+
+        // the component is kept so that the engine doesn't trim what it compiled from its cache
+        auto qmlComponent = new QQmlComponent(getSurfaceContext()->engine(), finalQmlSource, QQmlComponent::Asynchronous, this);
+        auto reportErrors = [qmlComponent] {
+            for (const auto& error : qmlComponent->errors()) {
+                qCWarning(qmlLogging) << error.url() << error.line() << error;
+            }
+        };
+        if (qmlComponent->isLoading()) {
+            connect(qmlComponent, &QQmlComponent::statusChanged, this, reportErrors);
+        } else {
+            reportErrors();
+        }
+    }
+}
+
+void OffscreenSurface::warmUp(const QList<QUrl>& qmlSources) {
+    if (QThread::currentThread() != thread()) {
+        qFatal("Called warmUp on a non-surface thread");
+    }
+    bool isIdle = _warmUpSources.isEmpty();
+    _warmUpSources << qmlSources;
+    if (isIdle && !_warmUpSources.isEmpty()) {
+        QTimer::singleShot(0, this, &OffscreenSurface::warmUpNext);
+    }
+}
+
+void OffscreenSurface::warmUpNext() {
+    if (_warmUpSources.isEmpty()) {
+        return;
+    }
+    if (!getRootItem()) {
+        qCWarning(qmlLogging) << "Cannot warm up QML before the surface is created";
+        _warmUpSources.clear();
+        return;
+    }
+
+    const QUrl qmlSource = _warmUpSources.takeFirst();
+    auto next = [this] {
+        if (!_warmUpSources.isEmpty()) {
+            QTimer::singleShot(0, this, &OffscreenSurface::warmUpNext);
+        }
+    };
+    if (!validator(qmlSource)) {
+        qCWarning(qmlLogging) << "Unauthorized QML URL found" << qmlSource;
+        next();
+        return;
+    }
+
+    PROFILE_RANGE_EX(app, "OffscreenSurface::warmUp", 0xffff00ff, 0, { std::make_pair("url", qmlSource.toDisplayString()) });
+    QUrl finalQmlSource = resolveQmlSource(qmlSource);
+    // the component is kept like the precompiled ones, only what it creates is destroyed
+    auto qmlComponent = new QQmlComponent(getSurfaceContext()->engine(), finalQmlSource, QQmlComponent::Asynchronous, this);
+    auto createHidden = [this, qmlComponent, next] {
+        if (qmlComponent->isLoading()) {
+            return;
+        }
+        disconnect(qmlComponent, &QQmlComponent::statusChanged, this, 0);
+        if (qmlComponent->isReady()) {
+            auto qmlContext = contextForUrl(qmlComponent->url(), nullptr, true);
+            QObject* newObject = qmlComponent->beginCreate(qmlContext);
+            if (newObject) {
+                newObject->setProperty("visible", false);
+                qmlComponent->completeCreate();
+                newObject->deleteLater();
+            }
+            if (qmlContext != getSurfaceContext()) {
+                qmlContext->deleteLater();
+            }
+        }
+        for (const auto& error : qmlComponent->errors()) {
+            qCWarning(qmlLogging) << error.url() << error.line() << error;
+        }
+        next();
+    };
+    if (qmlComponent->isLoading()) {
+        connect(qmlComponent, &QQmlComponent::statusChanged, this, createHidden);
+    } else {
+        createHidden();
+    }
+}
+
+QUrl OffscreenSurface::resolveQmlSource(const QUrl& qmlSource) {
+    if ((qmlSource.isRelative() && !qmlSource.isEmpty()) || qmlSource.scheme() == QLatin1String("file")) {
+        return getSurfaceContext()->resolvedUrl(qmlSource);
+    }
+    return qmlSource;
+}
+
 void OffscreenSurface::finishQmlLoad(QQmlComponent* qmlComponent,
                                      QQmlContext* qmlContext,
                                      QQuickItem* parent,
                                      const QmlContextObjectCallback& callback) {
     PROFILE_RANGE(app, "finishQmlLoad");
     disconnect(qmlComponent, &QQmlComponent::statusChanged, this, 0);
+    uint64_t loadStartTime = _loadStartTimes.take(qmlComponent);
     if (qmlComponent->isError()) {
         for (const auto& error : qmlComponent->errors()) {
             qCWarning(qmlLogging) << error.url() << error.line() << error;
@@ -453,6 +591,9 @@ void OffscreenSurface::finishQmlLoad(QQmlComponent* qmlComponent,
         callback(qmlContext, newItem);
     }
     qmlComponent->completeCreate();
+    if (loadStartTime != 0) {
+        recordFirstLoad(qmlComponent->url(), loadStartTime);
+    }
     qmlComponent->deleteLater();
 }
 
@@ -14,6 +14,8 @@
 #include <map>
 #include <functional>
 
+#include <QtCore/QHash>
+#include <QtCore/QList>
 #include <QtCore/QUrl>
 #include <QtCore/QSize>
 #include <QtCore/QPointF>
@@ -73,6 +75,11 @@ public:
     void resume();
     bool isPaused() const;
 
+    // the time taken to render the last frame of this surface, in usecs
+    uint64_t getLastRenderDuration() const;
+    // the time taken to render all the surfaces since the last call, in usecs
+    static uint64_t takeTotalRenderDuration();
+
     QQuickItem* getRootItem();
     QQuickWindow* getWindow();
     QObject* getEventHandler();
@@ -103,6 +110,19 @@ public:
                                       const QmlContextObjectCallback& callback = DEFAULT_CONTEXT_OBJECT_CALLBACK,
                                       const QmlContextCallback& contextCallback = DEFAULT_CONTEXT_CALLBACK);
 
+    // Compiles QML files on the loader thread of the engine without creating them, so that they are in its
+    // cache when they are loaded.  The surface must have been created.
+    void precompile(const QList<QUrl>& qmlSources);
+
+    // Creates QML files hidden and destroys them again, one per pass of the event loop, so that the first time
+    // they are loaded doesn't also build their types.  Their Component.onCompleted handlers do run, and what
+    // they send to scripts goes nowhere.  The surface must have been created.
+    void warmUp(const QList<QUrl>& qmlSources);
+
+    // how long the first load of each QML file took, from the call to load until it was created, in usecs.
+    // The loads of warmUp don't count, so that this shows what the warm up saves.
+    static QHash<QUrl, uint64_t> getFirstLoadDurations();
+
 public slots:
     virtual void onFocusObjectChanged(QObject* newFocus) {}
 
@@ -133,7 +153,13 @@ protected:
     virtual QQmlContext* contextForUrl(const QUrl& qmlSource, QQuickItem* parent, bool forceNewContext);
 
 private:
+    QUrl resolveQmlSource(const QUrl& qmlSource);
+    void warmUpNext();
+
     MouseTranslator _mouseTranslator{ [](const QPointF& p) { return p.toPoint(); } };
+    QList<QUrl> _warmUpSources;
+    // when the loads that are compiling started, for getFirstLoadDurations
+    QHash<QQmlComponent*, uint64_t> _loadStartTimes;
     friend class hifi::qml::impl::SharedObject;
     impl::SharedObject* const _sharedObject;
 };
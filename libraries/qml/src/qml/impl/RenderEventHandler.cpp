@@ -138,6 +138,7 @@ void RenderEventHandler::qmlRender(bool sceneGraphSync) {
 
     if (_currentSize != QSize()) {
         PROFILE_RANGE(render_qml_gl, "render");
+        uint64_t start = usecTimestampNow();
         GLuint texture = SharedObject::getTextureCache().acquireTexture(_currentSize);
         glBindFramebuffer(GL_DRAW_FRAMEBUFFER, _fbo);
         glFramebufferTexture(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0);
@@ -158,6 +159,7 @@ void RenderEventHandler::qmlRender(bool sceneGraphSync) {
             }
         }
         _shared->_lastRenderTime = usecTimestampNow();
+        _shared->recordRenderDuration(_shared->_lastRenderTime - start);
         glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
         glBindTexture(GL_TEXTURE_2D, texture);
         glGenerateMipmap(GL_TEXTURE_2D);
@@ -36,6 +36,8 @@
 // This has the effect of capping the framerate at 200
 static const int MIN_TIMER_MS = 5;
 
+static std::atomic<uint64_t> totalRenderDuration { 0 };
+
 using namespace hifi::qml;
 using namespace hifi::qml::impl;
 
@@ -532,3 +534,12 @@ void SharedObject::resume() {
 bool SharedObject::isPaused() const {
     return _paused;
 }
+
+void SharedObject::recordRenderDuration(uint64_t duration) {
+    _lastRenderDuration = duration;
+    totalRenderDuration += duration;
+}
+
+uint64_t SharedObject::takeTotalRenderDuration() {
+    return totalRenderDuration.exchange(0);
+}
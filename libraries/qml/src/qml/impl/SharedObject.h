@@ -14,6 +14,8 @@
 #include <QtCore/QMutex>
 #include <QtCore/QSize>
 
+#include <atomic>
+
 #include "TextureCache.h"
 
 class QWindow;
@@ -63,6 +65,10 @@ public:
     void pause();
     void resume();
     bool isPaused() const;
+    // the time taken to render the last frame of this surface, in usecs
+    uint64_t getLastRenderDuration() const { return _lastRenderDuration; }
+    // the time taken to render all the surfaces since the last call, in usecs
+    static uint64_t takeTotalRenderDuration();
     bool fetchTexture(TextureAndFence& textureAndFence);
     void addToDeletionList(QObject* object);
 
@@ -75,6 +81,7 @@ private:
     void initializeRenderControl(QOpenGLContext* context);
     void releaseTextureAndFence();
     void setRenderTarget(uint32_t fbo, const QSize& size);
+    void recordRenderDuration(uint64_t duration);
 
     QQmlEngine* acquireEngine(OffscreenSurface* surface);
     void releaseEngine(QQmlEngine* engine);
@@ -109,6 +116,7 @@ private:
 #endif
 
     uint64_t _lastRenderTime { 0 };
+    std::atomic<uint64_t> _lastRenderDuration { 0 };
     QSize _size { 100, 100 };
     uint8_t _maxFps { 60 };
 
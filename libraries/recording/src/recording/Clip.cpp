@@ -13,6 +13,10 @@
 
 #include "impl/FileClip.h"
 #include "impl/BufferClip.h"
+#include "impl/PointerClip.h"
+
+#include <limits>
+#include <vector>
 
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
@@ -90,6 +94,29 @@ bool writeFrame(QIODevice& output, const Frame& frame, bool compressed = true) {
     return true;
 }
 
+// written so that readers without the index see an empty frame of an invalid type, see PointerClip
+struct FrameIndexData {
+    FrameType type;
+    FrameSize size;
+    uint32_t fileOffset;
+};
+
+struct FrameIndexTrailerData {
+    uint32_t magic;
+    uint32_t count;
+};
+
+template <typename T>
+bool writeFrameIndexEntry(QIODevice& output, Frame::Time timeOffset, const T& data) {
+    static_assert(sizeof(T) == PointerClip::FRAME_INDEX_ENTRY_SIZE - PointerClip::MINIMUM_FRAME_SIZE, "Invalid index entry");
+    FrameType type = Frame::TYPE_INVALID;
+    FrameSize size = sizeof(T);
+    return output.write((char*)&type, sizeof(FrameType)) == sizeof(FrameType) &&
+        output.write((char*)&timeOffset, sizeof(Frame::Time)) == sizeof(Frame::Time) &&
+        output.write((char*)&size, sizeof(FrameSize)) == sizeof(FrameSize) &&
+        output.write((const char*)&data, sizeof(T)) == sizeof(T);
+}
+
 const QString Clip::FRAME_TYPE_MAP = QStringLiteral("frameTypes");
 const QString Clip::FRAME_COMREPSSION_FLAG = QStringLiteral("compressed");
 
@@ -105,17 +132,48 @@ bool Clip::write(QIODevice& output) {
     // Always mark new files as compressed
     rootObject.insert(FRAME_COMREPSSION_FLAG, true);
     QByteArray headerFrameData = QJsonDocument(rootObject).toBinaryData();
+
+    struct IndexEntry {
+        FrameType type;
+        Frame::Time timeOffset;
+        FrameSize size;
+        qint64 fileOffset;
+    };
+    std::vector<IndexEntry> index;
+    index.reserve(frameCount() + 1);
+    auto writeIndexedFrame = [&](const Frame& frame, bool compressed) {
+        qint64 frameOffset = output.pos();
+        if (!writeFrame(output, frame, compressed)) {
+            return false;
+        }
+        if (frame.type != Frame::TYPE_INVALID) {
+            qint64 dataOffset = frameOffset + PointerClip::MINIMUM_FRAME_SIZE;
+            index.push_back({ frame.type, frame.timeOffset, (FrameSize)(output.pos() - dataOffset), dataOffset });
+        }
+        return true;
+    };
+
     // Never compress the header frame
-    if (!writeFrame(output, Frame({ Frame::TYPE_HEADER, 0, headerFrameData }), false)) {
+    if (!writeIndexedFrame(Frame({ Frame::TYPE_HEADER, 0, headerFrameData }), false)) {
         return false;
     }
 
     seek(0);
 
     for (auto frame = nextFrame(); frame; frame = nextFrame()) {
-        if (!writeFrame(output, *frame)) {
+        if (!writeIndexedFrame(*frame, true)) {
             return false;
         }
     }
-    return true;
+
+    // the index stores 32 bit offsets, larger files are read by walking their frames
+    if (output.pos() > std::numeric_limits<uint32_t>::max()) {
+        return true;
+    }
+    for (const auto& entry : index) {
+        if (!writeFrameIndexEntry(output, entry.timeOffset, FrameIndexData { entry.type, entry.size, (uint32_t)entry.fileOffset })) {
+            return false;
+        }
+    }
+    return writeFrameIndexEntry(output, 0, FrameIndexTrailerData { PointerClip::FRAME_INDEX_MAGIC, (uint32_t)index.size() });
 }
@@ -8,6 +8,12 @@
 
 #include "ClipCache.h"
 
+#include <mutex>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
 #include <QThread>
 
 #include <shared/QtHelpers.h>
@@ -26,11 +32,69 @@ NetworkClipLoader::NetworkClipLoader(const QUrl& url) :
     }
 }
 
+static std::mutex sharedDirectoryMutex;
+static QString sharedDirectory;
+
+void NetworkClip::setSharedDirectory(const QString& directory) {
+    std::lock_guard<std::mutex> lock(sharedDirectoryMutex);
+    sharedDirectory = directory;
+}
+
+NetworkClip::~NetworkClip() {
+    Locker lock(_mutex);
+    if (_sharedFile.isOpen()) {
+        _sharedFile.unmap(_data);
+        _sharedFile.close();
+    }
+    reset();
+}
+
 void NetworkClip::init(const QByteArray& clipData) {
+    if (initShared(clipData)) {
+        return;
+    }
     _clipData = clipData;
     PointerClip::init((uchar*)_clipData.data(), _clipData.size());
 }
 
+bool NetworkClip::initShared(const QByteArray& clipData) {
+    QString directory;
+    {
+        std::lock_guard<std::mutex> lock(sharedDirectoryMutex);
+        directory = sharedDirectory;
+    }
+    if (directory.isEmpty() || clipData.isEmpty()) {
+        return false;
+    }
+
+    QString hash = QCryptographicHash::hash(clipData, QCryptographicHash::Sha1).toHex();
+    QString filePath = QDir(directory).absoluteFilePath(hash + ".hfr");
+
+    // another process may have written it already, or be playing it, so it is only replaced as a whole
+    if (QFileInfo(filePath).size() != clipData.size()) {
+        QSaveFile saveFile(filePath);
+        if (!QDir().mkpath(directory) || !saveFile.open(QIODevice::WriteOnly) ||
+            saveFile.write(clipData) != clipData.size() || !saveFile.commit()) {
+            if (QFileInfo(filePath).size() != clipData.size()) {
+                qCWarning(recordingLog) << "Unable to write the shared copy of" << _url << "to" << filePath;
+                return false;
+            }
+        }
+    }
+
+    _sharedFile.setFileName(filePath);
+    if (!_sharedFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    uchar* data = _sharedFile.map(0, _sharedFile.size());
+    if (!data) {
+        _sharedFile.close();
+        return false;
+    }
+    PointerClip::init(data, _sharedFile.size());
+    return true;
+}
+
 void NetworkClipLoader::downloadFinished(const QByteArray& data) {
     _clip->init(data);
     finishedLoading(true);
@@ -9,6 +9,8 @@
 #ifndef hifi_Recording_ClipCache_h
 #define hifi_Recording_ClipCache_h
 
+#include <QtCore/QFile>
+
 #include <ResourceCache.h>
 
 #include "Forward.h"
@@ -21,11 +23,19 @@ public:
     using Pointer = std::shared_ptr<NetworkClip>;
 
     NetworkClip(const QUrl& url) : _url(url) {}
+    virtual ~NetworkClip();
     virtual void init(const QByteArray& clipData);
     virtual QString getName() const override { return _url.toString(); }
 
+    // When set, the downloaded clips are written to files named by their hash in this directory and played from
+    // a read-only mapping of them, so that the processes playing the same clip share a single copy of it.
+    static void setSharedDirectory(const QString& directory);
+
 private:
+    bool initShared(const QByteArray& clipData);
+
     QByteArray _clipData;
+    QFile _sharedFile;
     QUrl _url;
 };
 
@@ -74,6 +74,48 @@ PointerFrameHeaderList parseFrameHeaders(uchar* const start, const size_t& size)
     return results;
 }
 
+// Read the frame headers from the index at the end of the data, false if there is none or it doesn't fit
+bool parseFrameIndex(uchar* const start, const size_t& size, PointerFrameHeaderList& results) {
+    const size_t ENTRY_SIZE = PointerClip::FRAME_INDEX_ENTRY_SIZE;
+    if (size < ENTRY_SIZE) {
+        return false;
+    }
+
+    auto trailer = start + size - ENTRY_SIZE;
+    FrameType type;
+    FrameSize entrySize;
+    uint32_t magic;
+    uint32_t count;
+    memcpy(&type, trailer, sizeof(FrameType));
+    memcpy(&entrySize, trailer + sizeof(FrameType) + sizeof(Frame::Time), sizeof(FrameSize));
+    memcpy(&magic, trailer + PointerClip::MINIMUM_FRAME_SIZE, sizeof(uint32_t));
+    memcpy(&count, trailer + PointerClip::MINIMUM_FRAME_SIZE + sizeof(uint32_t), sizeof(uint32_t));
+    if (type != Frame::TYPE_INVALID || entrySize != ENTRY_SIZE - PointerClip::MINIMUM_FRAME_SIZE ||
+        magic != PointerClip::FRAME_INDEX_MAGIC || (size_t)count >= size / ENTRY_SIZE) {
+        return false;
+    }
+
+    auto indexStart = trailer - count * ENTRY_SIZE;
+    auto current = indexStart;
+    for (uint32_t i = 0; i < count; ++i, current += ENTRY_SIZE) {
+        PointerFrameHeader header;
+        uint32_t fileOffset;
+        memcpy(&(header.timeOffset), current + sizeof(FrameType), sizeof(Frame::Time));
+        memcpy(&(header.type), current + PointerClip::MINIMUM_FRAME_SIZE, sizeof(FrameType));
+        memcpy(&(header.size), current + PointerClip::MINIMUM_FRAME_SIZE + sizeof(FrameType), sizeof(FrameSize));
+        memcpy(&fileOffset, current + PointerClip::MINIMUM_FRAME_SIZE + sizeof(FrameType) + sizeof(FrameSize),
+               sizeof(uint32_t));
+        header.fileOffset = fileOffset;
+        if (fileOffset + (size_t)header.size > (size_t)(indexStart - start)) {
+            results.clear();
+            return false;
+        }
+        results.push_back(header);
+    }
+    qDebug(recordingLog) << "Read the index of " << results.size() << " frames";
+    return true;
+}
+
 void PointerClip::reset() {
     _frames.clear();
     _data = nullptr;
@@ -87,7 +129,11 @@ void PointerClip::init(uchar* data, size_t size) {
     _data = data;
     _size = size;
 
-    auto parsedFrameHeaders = parseFrameHeaders(data, size);
+    PointerFrameHeaderList parsedFrameHeaders;
+    if (!parseFrameIndex(data, size, parsedFrameHeaders)) {
+        // written before the files had an index
+        parsedFrameHeaders = parseFrameHeaders(data, size);
+    }
     // Verify that at least one frame exists and that the first frame is a header
     if (0 == parsedFrameHeaders.size()) {
         qWarning() << "No frames found, invalid file";
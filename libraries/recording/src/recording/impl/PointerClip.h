@@ -44,6 +44,12 @@ public:
 
     // FIXME move to frame?
     static const qint64 MINIMUM_FRAME_SIZE = sizeof(FrameType) + sizeof(Frame::Time) + sizeof(FrameSize);
+
+    // Files end with an index of their frames, so that opening them doesn't walk every frame of the file.
+    // Each entry is stored as a frame of TYPE_INVALID, which readers without the index skip, whose data is the
+    // type, size and 32 bit file offset of a frame.  The last one holds FRAME_INDEX_MAGIC and the number of entries.
+    static const qint64 FRAME_INDEX_ENTRY_SIZE = MINIMUM_FRAME_SIZE + sizeof(FrameType) + sizeof(FrameSize) + sizeof(uint32_t);
+    static const uint32_t FRAME_INDEX_MAGIC = 0x49524648; // "HFRI"
 protected:
     void reset() override;
     virtual FrameConstPointer readFrame(size_t index) const override;
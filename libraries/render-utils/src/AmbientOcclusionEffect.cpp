@@ -36,6 +36,7 @@ gpu::PipelinePointer AmbientOcclusionEffect::_bilateralBlurPipeline;
 gpu::PipelinePointer AmbientOcclusionEffect::_mipCreationPipeline;
 gpu::PipelinePointer AmbientOcclusionEffect::_gatherPipeline;
 gpu::PipelinePointer AmbientOcclusionEffect::_buildNormalsPipeline;
+gpu::PipelinePointer AmbientOcclusionEffect::_temporalPipeline;
 
 AmbientOcclusionFramebuffer::AmbientOcclusionFramebuffer() {
 }
@@ -75,6 +76,11 @@ void AmbientOcclusionFramebuffer::clear() {
     _occlusionBlurredTexture.reset();
     _normalFramebuffer.reset();
     _normalTexture.reset();
+    for (int i = 0; i < 2; i++) {
+        _occlusionHistoryFramebuffers[i].reset();
+        _occlusionHistoryTextures[i].reset();
+    }
+    _resultHistoryIndex = -1;
 }
 
 gpu::TexturePointer AmbientOcclusionFramebuffer::getLinearDepthTexture() {
@@ -101,6 +107,12 @@ void AmbientOcclusionFramebuffer::allocate() {
         _occlusionBlurredTexture = gpu::Texture::createRenderBuffer(occlusionformat, width, height, gpu::Texture::SINGLE_MIP, sampler);
         _occlusionBlurredFramebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("occlusionBlurred"));
         _occlusionBlurredFramebuffer->setRenderBuffer(0, _occlusionBlurredTexture);
+
+        for (int i = 0; i < 2; i++) {
+            _occlusionHistoryTextures[i] = gpu::Texture::createRenderBuffer(occlusionformat, width, height, gpu::Texture::SINGLE_MIP, sampler);
+            _occlusionHistoryFramebuffers[i] = gpu::FramebufferPointer(gpu::Framebuffer::create("occlusionHistory"));
+            _occlusionHistoryFramebuffers[i]->setRenderBuffer(0, _occlusionHistoryTextures[i]);
+        }
     }
 
     // Lower res frame
@@ -204,6 +216,29 @@ gpu::TexturePointer AmbientOcclusionFramebuffer::getNormalTexture() {
     return _normalTexture;
 }
 
+gpu::FramebufferPointer AmbientOcclusionFramebuffer::getOcclusionHistoryFramebuffer(int index) {
+    assert(index >= 0 && index < 2);
+    if (!_occlusionHistoryFramebuffers[index]) {
+        allocate();
+    }
+    return _occlusionHistoryFramebuffers[index];
+}
+
+gpu::TexturePointer AmbientOcclusionFramebuffer::getOcclusionHistoryTexture(int index) {
+    assert(index >= 0 && index < 2);
+    if (!_occlusionHistoryTextures[index]) {
+        allocate();
+    }
+    return _occlusionHistoryTextures[index];
+}
+
+gpu::TexturePointer AmbientOcclusionFramebuffer::getOcclusionResultTexture() {
+    if (_resultHistoryIndex >= 0) {
+        return getOcclusionHistoryTexture(_resultHistoryIndex);
+    }
+    return getOcclusionTexture();
+}
+
 AmbientOcclusionEffectConfig::AmbientOcclusionEffectConfig() :
     render::GPUJobConfig::Persistent(QStringList() << "Render" << "Engine" << "Ambient Occlusion"),
     perspectiveScale{ 1.0f },
@@ -226,7 +261,9 @@ AmbientOcclusionEffectConfig::AmbientOcclusionEffectConfig() :
     ditheringEnabled{ true },
     borderingEnabled{ true },
     fetchMipsEnabled{ true },
-    jitterEnabled{ false }{
+    jitterEnabled{ false },
+    temporalEnabled{ false },
+    temporalBlend{ 0.1f } {
 }
 
 void AmbientOcclusionEffectConfig::setSSAORadius(float newRadius) {
@@ -287,6 +324,11 @@ void AmbientOcclusionEffectConfig::setBlurRadius(int radius) {
     emit dirty(); 
 }
 
+void AmbientOcclusionEffectConfig::setTemporalBlend(float blend) {
+    temporalBlend = std::max(0.01f, std::min(blend, 1.0f));
+    emit dirty();
+}
+
 AmbientOcclusionEffect::AOParameters::AOParameters() {
     _resolutionInfo = glm::vec4{ 0.0f };
     _radiusInfo = glm::vec4{ 0.0f };
@@ -300,13 +342,23 @@ AmbientOcclusionEffect::BlurParameters::BlurParameters() {
 }
 
 AmbientOcclusionEffect::AmbientOcclusionEffect() {
+    // without a relative depth difference of 5% the reprojected history is taken to be the same surface
+    _temporalParametersBuffer.edit()._temporalInfo = glm::vec4(0.1f, 0.05f, 0.0f, 0.0f);
 }
 
 void AmbientOcclusionEffect::configure(const Config& config) {
     bool shouldUpdateBlurs = false;
     bool shouldUpdateTechnique = false;
 
-    _isJitterEnabled = config.jitterEnabled;
+    // the temporal accumulation needs the samples to rotate from one frame to the next to converge
+    _isJitterEnabled = config.jitterEnabled || config.temporalEnabled;
+    if (_isTemporalEnabled != config.temporalEnabled) {
+        _isTemporalEnabled = config.temporalEnabled;
+        _isHistoryValid = false;
+    }
+    if (config.temporalBlend != _temporalParametersBuffer->_temporalInfo.x) {
+        _temporalParametersBuffer.edit()._temporalInfo.x = config.temporalBlend;
+    }
 
     if (!_framebuffer) {
         _framebuffer = std::make_shared<AmbientOcclusionFramebuffer>();
@@ -564,6 +616,19 @@ const gpu::PipelinePointer& AmbientOcclusionEffect::getGatherPipeline() {
     return _gatherPipeline;
 }
 
+const gpu::PipelinePointer& AmbientOcclusionEffect::getTemporalPipeline() {
+    if (!_temporalPipeline) {
+        gpu::ShaderPointer program = gpu::Shader::createProgram(shader::render_utils::program::ssao_temporal);
+        gpu::StatePointer state = gpu::StatePointer(new gpu::State());
+
+        state->setColorWriteMask(true, true, true, false);
+
+        // Good to go add the brand new pipeline
+        _temporalPipeline = gpu::Pipeline::create(program, state);
+    }
+    return _temporalPipeline;
+}
+
 const gpu::PipelinePointer& AmbientOcclusionEffect::getBuildNormalsPipeline() {
     if (!_buildNormalsPipeline) {
         gpu::ShaderPointer program = gpu::Shader::createProgram(shader::render_utils::program::ssao_buildNormals);
@@ -608,6 +673,7 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
 
     const auto& frameTransform = input.get1();
     const auto& linearDepthFramebuffer = input.get3();
+    const auto& velocityFramebuffer = input.get4();
     
     const int resolutionLevel = _aoParametersBuffer->getResolutionLevel();
     const auto depthResolutionLevel = getDepthResolutionLevel();
@@ -622,6 +688,9 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
 
     if (!_gpuTimer) {
         _gpuTimer = std::make_shared < gpu::RangeTimer>(__FUNCTION__);
+        _occlusionGPUTimer = std::make_shared<gpu::RangeTimer>("AmbientOcclusionEffect::occlusion");
+        _blurGPUTimer = std::make_shared<gpu::RangeTimer>("AmbientOcclusionEffect::blur");
+        _temporalGPUTimer = std::make_shared<gpu::RangeTimer>("AmbientOcclusionEffect::temporal");
     }
 
     if (!_framebuffer) {
@@ -635,7 +704,29 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
     if (_framebuffer->update(fullResDepthTexture, resolutionLevel, depthResolutionLevel, args->isStereo())) {
         updateBlurParameters();
         updateFramebufferSizes();
+        _isHistoryValid = false;
+    }
+
+    // The blurred occlusion of this frame is blended with the history of the previous ones where it reprojects
+    // to the same surface, the history of this frame is what the lighting reads
+    gpu::TexturePointer velocityTexture = velocityFramebuffer ? velocityFramebuffer->getVelocityTexture() : nullptr;
+    const bool isTemporal = _isTemporalEnabled && velocityTexture;
+    gpu::FramebufferPointer historyFBO;
+    gpu::TexturePointer previousHistoryTexture;
+    if (isTemporal) {
+        _historyIndex = 1 - _historyIndex;
+        historyFBO = _framebuffer->getOcclusionHistoryFramebuffer(_historyIndex);
+        previousHistoryTexture = _framebuffer->getOcclusionHistoryTexture(1 - _historyIndex);
+        if (_temporalParametersBuffer->_temporalInfo.z != (float)_isHistoryValid) {
+            _temporalParametersBuffer.edit()._temporalInfo.z = (float)_isHistoryValid;
+        }
+        _framebuffer->setResultHistoryIndex(_historyIndex);
+        _isHistoryValid = true;
+    } else {
+        _framebuffer->setResultHistoryIndex(-1);
+        _isHistoryValid = false;
     }
+    auto temporalPipeline = getTemporalPipeline();
     
     auto occlusionFBO = _framebuffer->getOcclusionFramebuffer();
     auto occlusionBlurredFBO = _framebuffer->getOcclusionBlurredFramebuffer();
@@ -667,6 +758,7 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
 		batch.enableStereo(false);
 
         _gpuTimer->begin(batch);
+        _occlusionGPUTimer->begin(batch);
 
         batch.resetViewTransform();
 
@@ -770,7 +862,9 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
             batch.popProfileRange();
         }
 #endif
+        _occlusionGPUTimer->end(batch);
 
+        _blurGPUTimer->begin(batch);
         {
             PROFILE_RANGE_BATCH(batch, "Bilateral Blur");
             // Blur 1st pass
@@ -818,6 +912,24 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
             batch.draw(gpu::TRIANGLE_STRIP, 4);
             batch.popProfileRange();
         }
+        _blurGPUTimer->end(batch);
+
+        _temporalGPUTimer->begin(batch);
+        if (isTemporal) {
+            PROFILE_RANGE_BATCH(batch, "Temporal");
+            batch.setModelTransform(Transform());
+            batch.setViewportTransform(sourceViewport);
+            batch.setFramebuffer(historyFBO);
+            batch.setPipeline(temporalPipeline);
+            batch.setUniformBuffer(render_utils::slot::buffer::SsaoTemporalParams, _temporalParametersBuffer);
+            batch.setResourceTexture(render_utils::slot::texture::SsaoOcclusion, occlusionFBO->getRenderBuffer(0));
+            batch.setResourceTexture(render_utils::slot::texture::SsaoHistory, previousHistoryTexture);
+            batch.setResourceTexture(render_utils::slot::texture::SsaoVelocity, velocityTexture);
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+            batch.setResourceTexture(render_utils::slot::texture::SsaoHistory, nullptr);
+            batch.setResourceTexture(render_utils::slot::texture::SsaoVelocity, nullptr);
+        }
+        _temporalGPUTimer->end(batch);
 
         batch.setResourceTexture(render_utils::slot::texture::SsaoDepth, nullptr);
         batch.setResourceTexture(render_utils::slot::texture::SsaoNormal, nullptr);
@@ -829,6 +941,7 @@ void AmbientOcclusionEffect::run(const render::RenderContextPointer& renderConte
     // Update the timer
     auto config = std::static_pointer_cast<Config>(renderContext->jobConfig);
     config->setGPUBatchRunTime(_gpuTimer->getGPUAverage(), _gpuTimer->getBatchAverage());
+    config->setStageGPUTimes(_occlusionGPUTimer->getGPUAverage(), _blurGPUTimer->getGPUAverage(), _temporalGPUTimer->getGPUAverage());
 }
 
 DebugAmbientOcclusion::DebugAmbientOcclusion() {
@@ -21,6 +21,7 @@
 #include "DeferredFrameTransform.h"
 #include "DeferredFramebuffer.h"
 #include "SurfaceGeometryPass.h"
+#include "VelocityBufferPass.h"
 
 #include "ssao_shared.h"
 
@@ -37,6 +38,14 @@ public:
     gpu::FramebufferPointer getNormalFramebuffer();
     gpu::TexturePointer getNormalTexture();
 
+    // The temporal accumulation ping pongs between two history targets, the one of the current frame is the result
+    gpu::FramebufferPointer getOcclusionHistoryFramebuffer(int index);
+    gpu::TexturePointer getOcclusionHistoryTexture(int index);
+
+    // The occlusion the lighting uses, the accumulated one when the temporal accumulation ran this frame
+    gpu::TexturePointer getOcclusionResultTexture();
+    void setResultHistoryIndex(int index) { _resultHistoryIndex = index; }
+
 #if SSAO_USE_QUAD_SPLIT
     gpu::FramebufferPointer getOcclusionSplitFramebuffer(int index);
     gpu::TexturePointer getOcclusionSplitTexture();
@@ -64,6 +73,10 @@ protected:
     gpu::FramebufferPointer _normalFramebuffer;
     gpu::TexturePointer _normalTexture;
 
+    gpu::FramebufferPointer _occlusionHistoryFramebuffers[2];
+    gpu::TexturePointer _occlusionHistoryTextures[2];
+    int _resultHistoryIndex{ -1 };
+
 #if SSAO_USE_QUAD_SPLIT
     gpu::FramebufferPointer _occlusionSplitFramebuffers[SSAO_SPLIT_COUNT*SSAO_SPLIT_COUNT];
     gpu::TexturePointer _occlusionSplitTexture;
@@ -84,6 +97,8 @@ class AmbientOcclusionEffectConfig : public render::GPUJobConfig::Persistent {
     Q_PROPERTY(bool borderingEnabled MEMBER borderingEnabled NOTIFY dirty)
     Q_PROPERTY(bool fetchMipsEnabled MEMBER fetchMipsEnabled NOTIFY dirty)
     Q_PROPERTY(bool jitterEnabled MEMBER jitterEnabled NOTIFY dirty)
+    Q_PROPERTY(bool temporalEnabled MEMBER temporalEnabled NOTIFY dirty)
+    Q_PROPERTY(float temporalBlend MEMBER temporalBlend WRITE setTemporalBlend)
 
     Q_PROPERTY(int resolutionLevel MEMBER resolutionLevel WRITE setResolutionLevel)
     Q_PROPERTY(float edgeSharpness MEMBER edgeSharpness WRITE setEdgeSharpness)
@@ -102,6 +117,11 @@ class AmbientOcclusionEffectConfig : public render::GPUJobConfig::Persistent {
     Q_PROPERTY(float hbaoFalloffAngle MEMBER hbaoFalloffAngle WRITE setHBAOFalloffAngle)
     Q_PROPERTY(int hbaoNumSamples MEMBER hbaoNumSamples WRITE setHBAONumSamples)
 
+    // The GPU time of each stage, in ms
+    Q_PROPERTY(double occlusionGPUTime READ getOcclusionGPUTime)
+    Q_PROPERTY(double blurGPUTime READ getBlurGPUTime)
+    Q_PROPERTY(double temporalGPUTime READ getTemporalGPUTime)
+
 public:
     AmbientOcclusionEffectConfig();
 
@@ -123,6 +143,17 @@ public:
     void setHBAOFalloffAngle(float bias);
     void setHBAONumSamples(int samples);
 
+    void setTemporalBlend(float blend);
+
+    void setStageGPUTimes(double occlusion, double blur, double temporal) {
+        _occlusionGPUTime = occlusion;
+        _blurGPUTime = blur;
+        _temporalGPUTime = temporal;
+    }
+    double getOcclusionGPUTime() const { return _occlusionGPUTime; }
+    double getBlurGPUTime() const { return _blurGPUTime; }
+    double getTemporalGPUTime() const { return _temporalGPUTime; }
+
     float perspectiveScale;
     float edgeSharpness;
     int blurRadius; // 0 means no blurring
@@ -144,16 +175,23 @@ public:
     bool borderingEnabled; // avoid evaluating information from non existing pixels out of the frame, should always be true
     bool fetchMipsEnabled; // fetch taps in sub mips to otpimize cache, should always be true
     bool jitterEnabled; // Add small jittering to AO samples at each frame
+    bool temporalEnabled; // Accumulate the jittered AO of the previous frames, reprojected with the velocity buffer
+    float temporalBlend; // Weight of the current frame in the accumulated AO
 
 signals:
     void dirty();
+
+private:
+    double _occlusionGPUTime{ 0.0 };
+    double _blurGPUTime{ 0.0 };
+    double _temporalGPUTime{ 0.0 };
 };
 
 #define SSAO_RANDOM_SAMPLE_COUNT 16
 
 class AmbientOcclusionEffect {
 public:
-    using Input = render::VaryingSet4<LightingModelPointer, DeferredFrameTransformPointer, DeferredFramebufferPointer, LinearDepthFramebufferPointer>;
+    using Input = render::VaryingSet5<LightingModelPointer, DeferredFrameTransformPointer, DeferredFramebufferPointer, LinearDepthFramebufferPointer, VelocityFramebufferPointer>;
     using Output = render::VaryingSet2<AmbientOcclusionFramebufferPointer, gpu::BufferView>;
     using Config = AmbientOcclusionEffectConfig;
     using JobModel = render::Job::ModelIO<AmbientOcclusionEffect, Input, Output, Config>;
@@ -200,6 +238,8 @@ private:
     };
     using BlurParametersBuffer = gpu::StructBuffer<BlurParameters>;
 
+    using TemporalParametersBuffer = gpu::StructBuffer<AmbientOcclusionTemporalParams>;
+
     using FrameParametersBuffer = gpu::StructBuffer< AmbientOcclusionFrameParams>;
 
     void updateBlurParameters();
@@ -214,25 +254,34 @@ private:
     BlurParametersBuffer _vblurParametersBuffer;
     BlurParametersBuffer _hblurParametersBuffer;
     float _blurEdgeSharpness{ 0.0f };
+    TemporalParametersBuffer _temporalParametersBuffer;
 
     static const gpu::PipelinePointer& getOcclusionPipeline();
     static const gpu::PipelinePointer& getBilateralBlurPipeline();
     static const gpu::PipelinePointer& getMipCreationPipeline();
     static const gpu::PipelinePointer& getGatherPipeline();
     static const gpu::PipelinePointer& getBuildNormalsPipeline();
+    static const gpu::PipelinePointer& getTemporalPipeline();
 
     static gpu::PipelinePointer _occlusionPipeline;
     static gpu::PipelinePointer _bilateralBlurPipeline;
     static gpu::PipelinePointer _mipCreationPipeline;
     static gpu::PipelinePointer _gatherPipeline;
     static gpu::PipelinePointer _buildNormalsPipeline;
+    static gpu::PipelinePointer _temporalPipeline;
 
     AmbientOcclusionFramebufferPointer _framebuffer;
     std::array<float, SSAO_RANDOM_SAMPLE_COUNT * SSAO_SPLIT_COUNT*SSAO_SPLIT_COUNT> _randomSamples;
     int _frameId{ 0 };
     bool _isJitterEnabled{ true };
+    bool _isTemporalEnabled{ false };
+    int _historyIndex{ 0 };
+    bool _isHistoryValid{ false };
     
     gpu::RangeTimerPointer _gpuTimer;
+    gpu::RangeTimerPointer _occlusionGPUTimer;
+    gpu::RangeTimerPointer _blurGPUTimer;
+    gpu::RangeTimerPointer _temporalGPUTimer;
 
     friend class DebugAmbientOcclusion;
 };
@@ -42,6 +42,8 @@ void BloomThreshold::run(const render::RenderContextPointer& renderContext, cons
         bloom = bloomStage->getBloom(bloomFrame->_blooms.front());
     }
     if (!bloom || (lightingModel && !lightingModel->isBloomEnabled())) {
+        // so that the tone mapping doesn't add the bloom of an earlier frame
+        outputs.edit0().reset();
         renderContext->taskFlow.abortTask();
         return;
     }
@@ -151,43 +153,6 @@ void BloomApply::run(const render::RenderContextPointer& renderContext, const In
     });
 }
 
-void BloomDraw::run(const render::RenderContextPointer& renderContext, const Inputs& inputs) {
-    assert(renderContext->args);
-    assert(renderContext->args->hasViewFrustum());
-    RenderArgs* args = renderContext->args;
-
-    const auto frameBuffer = inputs.get0();
-    const auto bloomFrameBuffer = inputs.get1();
-
-    if (frameBuffer && bloomFrameBuffer) {
-        const auto framebufferSize = frameBuffer->getSize();
-
-        if (!_pipeline) {
-            gpu::ShaderPointer program = gpu::Shader::createProgram(shader::gpu::program::drawTransformUnitQuadTextureOpaque);
-            gpu::StatePointer state = gpu::StatePointer(new gpu::State());
-            state->setDepthTest(gpu::State::DepthTest(false, false));
-            state->setBlendFunction(true, gpu::State::ONE, gpu::State::BLEND_OP_ADD, gpu::State::ONE,
-                                    gpu::State::ZERO, gpu::State::BLEND_OP_ADD, gpu::State::ONE);
-            _pipeline = gpu::Pipeline::create(program, state);
-        }
-
-        gpu::doInBatch("BloomDraw::run", args->_context, [&](gpu::Batch& batch) {
-            batch.enableStereo(false);
-
-            batch.setFramebuffer(frameBuffer);
-
-            batch.setViewportTransform(args->_viewport);
-            batch.setProjectionTransform(glm::mat4());
-            batch.resetViewTransform();
-            batch.setPipeline(_pipeline);
-
-            batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(framebufferSize, args->_viewport));
-            batch.setResourceTexture(0, bloomFrameBuffer->getRenderBuffer(0));
-            batch.draw(gpu::TRIANGLE_STRIP, 4);
-        });
-    }
-}
-
 void DebugBloomConfig::setMode(int mode) {
     _mode = std::min((int)DebugBloomConfig::MODE_COUNT, std::max(0, mode));
     emit dirty();
@@ -315,9 +280,8 @@ void BloomEffect::build(JobModel& task, const render::Varying& inputs, render::V
     const auto bloom = bloomOutputs.getN<BloomThreshold::Outputs>(2);
     const auto applyInput = BloomApply::Inputs(blurInputBuffer, blurFB0, blurFB1, blurFB2, bloom).asVarying();
     task.addJob<BloomApply>("BloomApply", applyInput);
-    // And then blend result in additive manner on top of final color buffer
-    const auto drawInput = BloomDraw::Inputs(frameBuffer, blurInputBuffer).asVarying();
-    task.addJob<BloomDraw>("BloomDraw", drawInput);
+    // The tone mapping then adds the result on top of the final color
+    outputs = blurInputBuffer;
 
     const auto debugInput = DebugBloom::Inputs(frameBuffer, blurFB0, blurFB1, blurFB2, blurInputBuffer).asVarying();
     task.addJob<DebugBloom>("DebugBloom", debugInput);
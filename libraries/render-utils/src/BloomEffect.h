@@ -72,20 +72,6 @@ private:
     gpu::StructBuffer<Parameters> _parameters;
 };
 
-class BloomDraw {
-public:
-    using Inputs = render::VaryingSet2<gpu::FramebufferPointer, gpu::FramebufferPointer>;
-    using JobModel = render::Job::ModelI<BloomDraw, Inputs>;
-
-    BloomDraw() {}
-
-    void run(const render::RenderContextPointer& renderContext, const Inputs& inputs);
-
-private:
-
-    gpu::PipelinePointer _pipeline;
-};
-
 class DebugBloomConfig : public render::Job::Config {
     Q_OBJECT
     Q_PROPERTY(int mode READ getMode WRITE setMode NOTIFY dirty)
@@ -133,8 +119,11 @@ private:
 class BloomEffect {
 public:
     using Inputs = render::VaryingSet4<DeferredFrameTransformPointer, gpu::FramebufferPointer, BloomStage::FramePointer, LightingModelPointer>;
+    // The bloom at a quarter of the resolution, null when there is none.  The tone mapping adds it to the lighting as it
+    // reads it, rather than it being blended into the lighting buffer in a pass of its own.
+    using Outputs = gpu::FramebufferPointer;
     using Config = BloomConfig;
-    using JobModel = render::Task::ModelI<BloomEffect, Inputs, Config>;
+    using JobModel = render::Task::ModelIO<BloomEffect, Inputs, Outputs, Config>;
 
     BloomEffect();
 
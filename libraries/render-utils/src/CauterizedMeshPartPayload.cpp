@@ -22,45 +22,27 @@ CauterizedMeshPartPayload::CauterizedMeshPartPayload(ModelPointer model, int mes
                                                      const Transform& transform, const Transform& offsetTransform, const uint64_t& created)
     : ModelMeshPartPayload(model, meshIndex, partIndex, shapeIndex, transform, offsetTransform, created) {}
 
-void CauterizedMeshPartPayload::updateClusterBuffer(const std::vector<glm::mat4>& clusterMatrices,
-                                                    const std::vector<glm::mat4>& cauterizedClusterMatrices) {
-    ModelMeshPartPayload::updateClusterBuffer(clusterMatrices);
+void CauterizedMeshPartPayload::updateRenderItem(const Model::RenderItemsUpdate& update) {
+    ModelMeshPartPayload::updateRenderItem(update);
 
-    if (cauterizedClusterMatrices.size() > 1) {
-        if (!_cauterizedClusterBuffer) {
-            _cauterizedClusterBuffer = std::make_shared<gpu::Buffer>(cauterizedClusterMatrices.size() * sizeof(glm::mat4),
-                (const gpu::Byte*) cauterizedClusterMatrices.data());
-        } else {
-            _cauterizedClusterBuffer->setSubData(0, cauterizedClusterMatrices.size() * sizeof(glm::mat4),
-                (const gpu::Byte*) cauterizedClusterMatrices.data());
-        }
-    }
-}
-
-void CauterizedMeshPartPayload::updateClusterBuffer(const std::vector<Model::TransformDualQuaternion>& clusterDualQuaternions,
-                                                    const std::vector<Model::TransformDualQuaternion>& cauterizedClusterDualQuaternions) {
-    ModelMeshPartPayload::updateClusterBuffer(clusterDualQuaternions);
-
-    if (cauterizedClusterDualQuaternions.size() > 1) {
-        if (!_cauterizedClusterBuffer) {
-            _cauterizedClusterBuffer = std::make_shared<gpu::Buffer>(cauterizedClusterDualQuaternions.size() * sizeof(Model::TransformDualQuaternion),
-                (const gpu::Byte*) cauterizedClusterDualQuaternions.data());
-        } else {
-            _cauterizedClusterBuffer->setSubData(0, cauterizedClusterDualQuaternions.size() * sizeof(Model::TransformDualQuaternion),
-                (const gpu::Byte*) cauterizedClusterDualQuaternions.data());
-        }
+    if (_deformerIndex != hfm::UNDEFINED_KEY) {
+        _cauterizedClusterBuffers = update.cauterizedClusterBuffers;
+        _cauterizedClusterFrame = update.cauterizedClusterFrame;
+        _cauterizedTransform = update.modelTransform;
+    } else {
+        _cauterizedTransform = update.modelTransform.worldTransform(update.rootFromJointTransforms[_shapeID]);
     }
-}
-
-void CauterizedMeshPartPayload::updateTransformForCauterizedMesh(const Transform& renderTransform) {
-    _cauterizedTransform = renderTransform;
+    _enableCauterization = update.enableCauterization;
 }
 
 void CauterizedMeshPartPayload::bindTransform(gpu::Batch& batch, RenderArgs::RenderMode renderMode) const {
     bool useCauterizedMesh = (renderMode != RenderArgs::RenderMode::SHADOW_RENDER_MODE && renderMode != RenderArgs::RenderMode::SECONDARY_CAMERA_RENDER_MODE) && _enableCauterization;
     if (useCauterizedMesh) {
-        if (_cauterizedClusterBuffer) {
-            batch.setUniformBuffer(graphics::slot::buffer::Skinning, _cauterizedClusterBuffer);
+        if (_cauterizedClusterBuffers) {
+            const auto& clusterBuffer = _cauterizedClusterBuffers->getBuffer(_cauterizedClusterFrame, _deformerIndex);
+            if (clusterBuffer) {
+                batch.setUniformBuffer(graphics::slot::buffer::Skinning, clusterBuffer);
+            }
         }
         batch.setModelTransform(_cauterizedTransform);
     } else {
@@ -15,22 +15,13 @@ class CauterizedMeshPartPayload : public ModelMeshPartPayload {
 public:
     CauterizedMeshPartPayload(ModelPointer model, int meshIndex, int partIndex, int shapeIndex, const Transform& transform, const Transform& offsetTransform, const uint64_t& created);
 
-    // matrix palette skinning
-    void updateClusterBuffer(const std::vector<glm::mat4>& clusterMatrices,
-                             const std::vector<glm::mat4>& cauterizedClusterMatrices);
-
-    // dual quaternion skinning
-    void updateClusterBuffer(const std::vector<Model::TransformDualQuaternion>& clusterDualQuaternions,
-                             const std::vector<Model::TransformDualQuaternion>& cauterizedClusterQuaternions);
-
-    void updateTransformForCauterizedMesh(const Transform& renderTransform);
+    void updateRenderItem(const Model::RenderItemsUpdate& update) override;
 
     void bindTransform(gpu::Batch& batch, RenderArgs::RenderMode renderMode) const override;
 
-    void setEnableCauterization(bool enableCauterization) { _enableCauterization = enableCauterization; }
-
 private:
-    gpu::BufferPointer _cauterizedClusterBuffer;
+    Model::ClusterBuffersPointer _cauterizedClusterBuffers;
+    uint32_t _cauterizedClusterFrame { 0 };
     Transform _cauterizedTransform;
     bool _enableCauterization { false };
 };
@@ -11,7 +11,6 @@
 #include <PerfStat.h>
 #include <DualQuaternion.h>
 
-#include "AbstractViewStateInterface.h"
 #include "MeshPartPayload.h"
 #include "CauterizedMeshPartPayload.h"
 #include "RenderUtilsLogging.h"
@@ -26,6 +25,7 @@ CauterizedModel::~CauterizedModel() {
 void CauterizedModel::deleteGeometry() {
     Model::deleteGeometry();
     _cauterizeMeshStates.clear();
+    _cauterizedClusterBuffers.reset();
 }
 
 bool CauterizedModel::updateGeometry() {
@@ -158,100 +158,13 @@ void CauterizedModel::updateClusterMatrices() {
     }
 }
 
-void CauterizedModel::updateRenderItems() {
+void CauterizedModel::updateClusterBuffers(RenderItemsUpdate& update) {
+    Model::updateClusterBuffers(update);
     if (_isCauterized) {
-        if (!_addedToScene) {
-            return;
-        }
-        _needsUpdateClusterMatrices = true;
-        _renderItemsNeedUpdate = false;
-
-        // queue up this work for later processing, at the end of update and just before rendering.
-        // the application will ensure only the last lambda is actually invoked.
-        void* key = (void*)this;
-        std::weak_ptr<CauterizedModel> weakSelf = std::dynamic_pointer_cast<CauterizedModel>(shared_from_this());
-        AbstractViewStateInterface::instance()->pushPostUpdateLambda(key, [weakSelf]() {
-            // do nothing, if the model has already been destroyed.
-            auto self = weakSelf.lock();
-            if (!self || !self->isLoaded()) {
-                return;
-            }
-
-            // lazy update of cluster matrices used for rendering.  We need to update them here, so we can correctly update the bounding box.
-            self->updateClusterMatrices();
-
-            render::ScenePointer scene = AbstractViewStateInterface::instance()->getMain3DScene();
-
-            Transform modelTransform;
-            modelTransform.setTranslation(self->getTranslation());
-            modelTransform.setRotation(self->getRotation());
-
-            PrimitiveMode primitiveMode = self->getPrimitiveMode();
-            auto renderItemKeyGlobalFlags = self->getRenderItemKeyGlobalFlags();
-            bool enableCauterization = self->getEnableCauterization();
-
-            render::Transaction transaction;
-            for (int i = 0; i < (int)self->_modelMeshRenderItemIDs.size(); i++) {
-                auto itemID = self->_modelMeshRenderItemIDs[i];
-
-                const auto& shapeState = self->getShapeState(i);
-
-                auto skinDeformerIndex = shapeState._skinDeformerIndex;
-
-                bool invalidatePayloadShapeKey = self->shouldInvalidatePayloadShapeKey(shapeState._meshIndex);
-                bool useDualQuaternionSkinning = self->getUseDualQuaternionSkinning();
-
-                if (skinDeformerIndex != hfm::UNDEFINED_KEY) {
-
-                    const auto& meshState = self->getMeshState(skinDeformerIndex);
-                    const auto& cauterizedMeshState = self->getCauterizeMeshState(skinDeformerIndex);
-
-                    transaction.updateItem<ModelMeshPartPayload>(itemID,
-                        [modelTransform, shapeState, meshState, useDualQuaternionSkinning, cauterizedMeshState, invalidatePayloadShapeKey,
-                            primitiveMode, renderItemKeyGlobalFlags, enableCauterization](ModelMeshPartPayload& mmppData) {
-                        CauterizedMeshPartPayload& data = static_cast<CauterizedMeshPartPayload&>(mmppData);
-                        if (useDualQuaternionSkinning) {
-                            data.updateClusterBuffer(meshState.clusterDualQuaternions, cauterizedMeshState.clusterDualQuaternions);
-                        } else {
-                            data.updateClusterBuffer(meshState.clusterMatrices, cauterizedMeshState.clusterMatrices);
-                        }
-
-                        Transform renderTransform = modelTransform;
-                       // if (meshState.clusterMatrices.size() <= 2) {
-                       //     renderTransform = modelTransform.worldTransform(shapeState._rootFromJointTransform);
-                       // }
-                        data.updateTransform(renderTransform);
-                        data.updateTransformForCauterizedMesh(renderTransform);
-                        data.updateTransformAndBound(modelTransform.worldTransform(shapeState._rootFromJointTransform));
-
-                        data.setEnableCauterization(enableCauterization);
-                        data.updateKey(renderItemKeyGlobalFlags);
-                        data.setShapeKey(invalidatePayloadShapeKey, primitiveMode, useDualQuaternionSkinning);
-                    });
-                } else {
-                    transaction.updateItem<ModelMeshPartPayload>(itemID,
-                        [modelTransform, shapeState, invalidatePayloadShapeKey, primitiveMode, renderItemKeyGlobalFlags, enableCauterization]
-                             (ModelMeshPartPayload& mmppData) {
-                        CauterizedMeshPartPayload& data = static_cast<CauterizedMeshPartPayload&>(mmppData);
-
-                        Transform renderTransform = modelTransform;
-
-                        renderTransform = modelTransform.worldTransform(shapeState._rootFromJointTransform);
-                        data.updateTransform(renderTransform);
-                        data.updateTransformForCauterizedMesh(renderTransform);
-
-                        data.setEnableCauterization(enableCauterization);
-                        data.updateKey(renderItemKeyGlobalFlags);
-                        data.setShapeKey(invalidatePayloadShapeKey, primitiveMode, false);
-                    });
-                    
-                }
-            }
-
-            scene->enqueueTransaction(transaction);
-        });
-    } else {
-        Model::updateRenderItems();
+        ClusterBuffers::update(_cauterizedClusterBuffers, _cauterizeMeshStates, update.useDualQuaternionSkinning);
+        update.cauterizedClusterBuffers = _cauterizedClusterBuffers;
+        update.cauterizedClusterFrame = _cauterizedClusterBuffers->getFrame();
+        update.enableCauterization = getEnableCauterization();
     }
 }
 
@@ -34,13 +34,15 @@ public:
     void createRenderItemSet() override;
     
     virtual void updateClusterMatrices() override;
-    void updateRenderItems() override;
 
     const Model::MeshState& getCauterizeMeshState(int index) const;
 
 protected:
     std::unordered_set<int> _cauterizeBoneSet;
     std::vector<Model::MeshState> _cauterizeMeshStates;
+    ClusterBuffersPointer _cauterizedClusterBuffers;
+
+    void updateClusterBuffers(RenderItemsUpdate& update) override;
     bool _isCauterized { false };
     bool _enableCauterization { false };
 };
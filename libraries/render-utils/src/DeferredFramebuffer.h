@@ -17,6 +17,11 @@
 
 
 // DeferredFramebuffer is  a helper class gathering in one place the GBuffer (Framebuffer) and lighting framebuffer
+// The layout of the GBuffer, written by DeferredBufferWrite.slh and read by DeferredBufferRead.slh:
+//   0 color     SRGBA8   albedo, and the shading mode packed with the metallic in alpha (see DeferredBuffer.slh)
+//   1 normal    RGBA8    octahedral normal in 2x12 bits over rgb (see gpu/PackedNormal.slh), roughness in alpha
+//   2 specular  RGBA8    emissive, lightmap or scattering in rgb, occlusion in alpha
+//   3 lighting  R11G11B10F  the lighting texture itself, the emissive and unlit colors go straight to it
 class DeferredFramebuffer {
 public:
     DeferredFramebuffer();
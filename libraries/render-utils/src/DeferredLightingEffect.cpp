@@ -346,7 +346,7 @@ void RenderDeferredSetup::run(const render::RenderContextPointer& renderContext,
         
         // FIXME: Different render modes should have different tasks
         if (lightingModel->isAmbientOcclusionEnabled() && ambientOcclusionFramebuffer) {
-            batch.setResourceTexture(ru::Texture::DeferredObscurance, ambientOcclusionFramebuffer->getOcclusionTexture());
+            batch.setResourceTexture(ru::Texture::DeferredObscurance, ambientOcclusionFramebuffer->getOcclusionResultTexture());
         } else {
             // need to assign the white texture if ao is off
             batch.setResourceTexture(ru::Texture::DeferredObscurance, textureCache->getWhiteTexture());
@@ -0,0 +1,97 @@
+//
+//  DepthPyramidPass.cpp
+//  libraries/render-utils/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DepthPyramidPass.h"
+
+#include <gpu/Context.h>
+#include <shaders/Shaders.h>
+
+#include "render-utils/ShaderConstants.h"
+
+namespace ru {
+    using render_utils::slot::texture::Texture;
+}
+
+// about as many source texels under a texel as the downsample shader loops over
+static const int SOURCE_TEXELS_PER_TEXEL = 32;
+static const int MIN_WIDTH = 128;
+
+void BuildDepthPyramid::run(const render::RenderContextPointer& renderContext, const Inputs& inputs) {
+    assert(renderContext->args);
+    assert(renderContext->args->hasViewFrustum());
+    RenderArgs* args = renderContext->args;
+
+    const auto& deferredFramebuffer = inputs.get0();
+    const auto& feedback = inputs.get1();
+
+    // the cull only tests a single view
+    if (!deferredFramebuffer || !feedback || args->isStereo()) {
+        return;
+    }
+
+    auto depthBuffer = deferredFramebuffer->getPrimaryDepthTexture();
+    glm::ivec4 viewport = args->_viewport;
+    if (!depthBuffer || viewport.z <= 0 || viewport.w <= 0) {
+        return;
+    }
+
+    int width = std::max(MIN_WIDTH, (viewport.z + SOURCE_TEXELS_PER_TEXEL - 1) / SOURCE_TEXELS_PER_TEXEL);
+    int height = std::max((viewport.w * width + viewport.z - 1) / viewport.z,
+                          (viewport.w + SOURCE_TEXELS_PER_TEXEL - 1) / SOURCE_TEXELS_PER_TEXEL);
+    if (!_framebuffer || _framebuffer->getWidth() != (uint16)width || _framebuffer->getHeight() != (uint16)height) {
+        auto sampler = gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_POINT);
+        auto depthTexture = gpu::Texture::createRenderBuffer(gpu::Element(gpu::SCALAR, gpu::FLOAT, gpu::RED), width, height,
+                                                             gpu::Texture::SINGLE_MIP, sampler);
+        _framebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("depthPyramid"));
+        _framebuffer->setRenderBuffer(0, depthTexture);
+    }
+
+    const auto& pipeline = getDownsamplePipeline();
+    auto framebuffer = _framebuffer;
+    glm::ivec2 depthFrameSize = deferredFramebuffer->getFrameSize();
+
+    const auto& frustum = args->getViewFrustum();
+    glm::mat4 viewProjection = frustum.getProjection() * glm::inverse(frustum.getView());
+    glm::vec3 eyePosition = frustum.getPosition();
+    glm::vec3 eyeDirection = frustum.getDirection();
+    std::weak_ptr<render::DepthPyramidFeedback> weakFeedback = feedback;
+
+    gpu::doInBatch("BuildDepthPyramid::run", args->_context, [&](gpu::Batch& batch) {
+        batch.enableStereo(false);
+
+        batch.setViewportTransform(glm::ivec4(0, 0, width, height));
+        batch.setProjectionTransform(glm::mat4());
+        batch.resetViewTransform();
+        batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(depthFrameSize, viewport));
+
+        batch.setFramebuffer(framebuffer);
+        batch.setPipeline(pipeline);
+        batch.setResourceTexture(ru::Texture::DepthPyramidSource, depthBuffer);
+        batch.draw(gpu::TRIANGLE_STRIP, 4);
+        batch.setResourceTexture(ru::Texture::DepthPyramidSource, nullptr);
+
+        batch.readPixels(framebuffer, glm::ivec4(0, 0, width, height), [=](const std::vector<float>& pixels) {
+            auto feedback = weakFeedback.lock();
+            if (feedback) {
+                feedback->setLatest(std::make_shared<render::DepthPyramid>(pixels, width, height, viewProjection,
+                                                                           eyePosition, eyeDirection));
+            }
+        });
+    });
+}
+
+const gpu::PipelinePointer& BuildDepthPyramid::getDownsamplePipeline() {
+    if (!_downsamplePipeline) {
+        gpu::ShaderPointer program = gpu::Shader::createProgram(shader::render_utils::program::depthPyramid_downsample);
+        gpu::StatePointer state = gpu::StatePointer(new gpu::State());
+        _downsamplePipeline = gpu::Pipeline::create(program, state);
+    }
+    return _downsamplePipeline;
+}
@@ -0,0 +1,35 @@
+//
+//  DepthPyramidPass.h
+//  libraries/render-utils/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DepthPyramidPass_h
+#define hifi_DepthPyramidPass_h
+
+#include <render/DrawTask.h>
+#include <render/DepthPyramid.h>
+
+#include "DeferredFramebuffer.h"
+
+// Downsamples the depth of the opaque pass to the farthest depth over a low resolution grid and reads it back, the
+// cull of the next frames tests their bounds against it. The read back lands a frame or two late.
+class BuildDepthPyramid {
+public:
+    using Inputs = render::VaryingSet2<DeferredFramebufferPointer, render::DepthPyramidFeedbackPointer>;
+    using JobModel = render::Job::ModelI<BuildDepthPyramid, Inputs>;
+
+    void run(const render::RenderContextPointer& renderContext, const Inputs& inputs);
+
+private:
+    const gpu::PipelinePointer& getDownsamplePipeline();
+
+    gpu::FramebufferPointer _framebuffer;
+    gpu::PipelinePointer _downsamplePipeline;
+};
+
+#endif // hifi_DepthPyramidPass_h
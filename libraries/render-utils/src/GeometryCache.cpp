@@ -36,6 +36,7 @@
 #include "FadeEffect.h"
 
 #include "DeferredLightingEffect.h"
+#include "RenderPipelines.h"
 
 namespace gr {
     using graphics::slot::texture::Texture;
@@ -2316,6 +2317,45 @@ void GeometryCache::renderWireShapeInstance(RenderArgs* args, gpu::Batch& batch,
     renderInstances(args, batch, color, true, pipeline, shape);
 }
 
+bool GeometryCache::renderMaterialShapeInstance(RenderArgs* args, gpu::Batch& batch, GeometryCache::Shape shape,
+                                                graphics::MultiMaterial& materials) {
+    const render::ShapePipelinePointer& pipeline = args->_shapePipeline;
+    assert(pipeline != nullptr);
+
+    // the parameters of the materials are compared by value, their maps by material
+    const auto& schema = materials.getSchemaBuffer().get<graphics::MultiMaterial::Schema>();
+    size_t materialHash = std::hash<std::string>()(std::string((const char*)&schema, sizeof(schema)));
+    graphics::MaterialKey drawMaterialKey = materials.getMaterialKey();
+    for (int i = 0; i < graphics::Material::MapChannel::NUM_MAP_CHANNELS; i++) {
+        if (drawMaterialKey.isMapChannel(graphics::Material::MapChannel(i))) {
+            if (materials.size() != 1) {
+                return false;
+            }
+            materialHash ^= std::hash<graphics::MaterialPointer>()(materials.top().material);
+            break;
+        }
+    }
+
+    std::string instanceName = "material_shapes_" + std::to_string(shape) + "_" + std::to_string(std::hash<render::ShapePipelinePointer>()(pipeline)) +
+        "_" + std::to_string(materialHash);
+
+    {
+        gpu::BufferPointer instanceColorBuffer = batch.getNamedBuffer(instanceName, INSTANCE_COLOR_BUFFER);
+        auto compactColor = toCompactColor(glm::vec4(1.0f));
+        instanceColorBuffer->append(compactColor);
+    }
+
+    batch.setupNamedCalls(instanceName, [args, pipeline, shape, materials](gpu::Batch& batch, gpu::Batch::NamedBatchData& data) mutable {
+        batch.setPipeline(pipeline->pipeline);
+        pipeline->prepare(batch, args);
+        if (RenderPipelines::bindMaterials(materials, batch, args->_renderMode, args->_enableTexturing)) {
+            args->_details._materialSwitches++;
+        }
+        DependencyManager::get<GeometryCache>()->renderShapeInstances(batch, shape, data.count(), data.buffers[INSTANCE_COLOR_BUFFER]);
+    });
+    return true;
+}
+
 void GeometryCache::renderSolidFadeShapeInstance(RenderArgs* args, gpu::Batch& batch, GeometryCache::Shape shape, const glm::vec4& color,
     int fadeCategory, float fadeThreshold, const glm::vec3& fadeNoiseOffset, const glm::vec3& fadeBaseOffset, const glm::vec3& fadeBaseInvSize,
     const render::ShapePipelinePointer& pipeline) {
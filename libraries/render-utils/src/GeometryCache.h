@@ -198,6 +198,11 @@ public:
         renderWireShapeInstance(args, batch, shape, glm::vec4(color, 1.0f), pipeline);
     }
 
+    // Draws the shape with materials through the current pipeline of args, as one instanced draw with the other
+    // shapes of the batch that have the same materials.  Returns false and draws nothing when the materials
+    // can't be shared: maps on more than one layer.
+    bool renderMaterialShapeInstance(RenderArgs* args, gpu::Batch& batch, Shape shape, graphics::MultiMaterial& materials);
+
     void renderSolidFadeShapeInstance(RenderArgs* args, gpu::Batch& batch, Shape shape, const glm::vec4& color, int fadeCategory, float fadeThreshold,
         const glm::vec3& fadeNoiseOffset, const glm::vec3& fadeBaseOffset, const glm::vec3& fadeBaseInvSize,
         const render::ShapePipelinePointer& pipeline);
@@ -10,7 +10,7 @@
 //
 #include "HighlightEffect.h"
 
-#include <sstream>
+#include <limits>
 
 #include <graphics/ShaderConstants.h>
 #include <render/FilterTask.h>
@@ -38,6 +38,8 @@ namespace gr {
 }
 
 #define OUTLINE_STENCIL_MASK    1
+// set by the shapes that wrote their group
+#define SHAPE_STENCIL_MASK      2
 
 extern void initZPassPipelines(ShapePlumber& plumber, gpu::StatePointer state, const render::ShapePipeline::BatchSetter& batchSetter, const render::ShapePipeline::ItemSetter& itemSetter);
 
@@ -77,7 +79,10 @@ void HighlightResources::allocateColorBuffer(const gpu::FramebufferPointer& prim
 void HighlightResources::allocateDepthBuffer(const gpu::FramebufferPointer& primaryFrameBuffer) {
     auto depthFormat = gpu::Element(gpu::SCALAR, gpu::UINT32, gpu::DEPTH_STENCIL);
     _depthStencilTexture = gpu::TexturePointer(gpu::Texture::createRenderBuffer(depthFormat, _frameSize.x, _frameSize.y));
+    _idTexture = gpu::TexturePointer(gpu::Texture::createRenderBuffer(gpu::Element::COLOR_R_8, _frameSize.x, _frameSize.y,
+        gpu::Texture::SINGLE_MIP, gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_POINT)));
     _depthFrameBuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("highlightDepth"));
+    _depthFrameBuffer->setRenderBuffer(0, _idTexture);
     _depthFrameBuffer->setDepthStencilBuffer(_depthStencilTexture, depthFormat);
 }
 
@@ -90,6 +95,10 @@ gpu::TexturePointer HighlightResources::getDepthTexture() {
     return _depthStencilTexture;
 }
 
+gpu::TexturePointer HighlightResources::getIdTexture() {
+    return _idTexture;
+}
+
 gpu::FramebufferPointer HighlightResources::getColorFramebuffer() {
     assert(_colorFrameBuffer);
     return _colorFrameBuffer;
@@ -116,19 +125,20 @@ void PrepareDrawHighlight::run(const render::RenderContextPointer& renderContext
 
 gpu::PipelinePointer DrawHighlightMask::_stencilMaskPipeline;
 gpu::PipelinePointer DrawHighlightMask::_stencilMaskFillPipeline;
+gpu::PipelinePointer DrawHighlightMask::_idFillPipeline;
 
-DrawHighlightMask::DrawHighlightMask(unsigned int highlightIndex, render::ShapePlumberPointer shapePlumber,
-    HighlightSharedParametersPointer parameters) : _highlightPassIndex(highlightIndex), _shapePlumber(shapePlumber), _sharedParameters(parameters) {}
+DrawHighlightMask::DrawHighlightMask(render::ShapePlumberPointer shapePlumber, HighlightSharedParametersPointer parameters) :
+    _shapePlumber(shapePlumber), _sharedParameters(parameters) {}
 
 void DrawHighlightMask::run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
-    auto& inShapes = inputs.get0();
+    const auto& groupShapes = inputs.get0();
 
     const int BOUNDS_SLOT = 0;
     const int PARAMETERS_SLOT = 0;
 
-    if (!_stencilMaskPipeline || !_stencilMaskFillPipeline) {
+    if (!_stencilMaskPipeline || !_stencilMaskFillPipeline || !_idFillPipeline) {
         gpu::StatePointer state = std::make_shared<gpu::State>();
         state->setDepthTest(true, false, gpu::LESS_EQUAL);
         state->setStencilTest(true, 0xFF, gpu::State::StencilTest(OUTLINE_STENCIL_MASK, 0xFF, gpu::NOT_EQUAL, gpu::State::STENCIL_OP_KEEP, gpu::State::STENCIL_OP_KEEP, gpu::State::STENCIL_OP_REPLACE));
@@ -141,9 +151,20 @@ void DrawHighlightMask::run(const render::RenderContextPointer& renderContext, c
         fillState->setColorWriteMask(false, false, false, false);
         fillState->setCullMode(gpu::State::CULL_FRONT);
 
+        // Writes the group in the bounds of the items that didn't, where no other shape did
+        gpu::StatePointer idState = std::make_shared<gpu::State>();
+        idState->setDepthTest(false, false, gpu::LESS_EQUAL);
+        idState->setStencilTest(true, 0x00, gpu::State::StencilTest(0, SHAPE_STENCIL_MASK, gpu::EQUAL));
+        idState->setBlendFunction(true, gpu::State::FACTOR_COLOR, gpu::State::BLEND_OP_ADD, gpu::State::ZERO);
+        idState->setColorWriteMask(true, false, false, false);
+        idState->setCullMode(gpu::State::CULL_FRONT);
+
         gpu::ShaderPointer program = gpu::Shader::createProgram(shader::render_utils::program::highlight_aabox);
         _stencilMaskPipeline = gpu::Pipeline::create(program, state);
         _stencilMaskFillPipeline = gpu::Pipeline::create(program, fillState);
+
+        gpu::ShaderPointer idProgram = gpu::Shader::createProgram(shader::render_utils::program::highlight_aabox_id);
+        _idFillPipeline = gpu::Pipeline::create(idProgram, idState);
     }
 
     if (!_boundsBuffer) {
@@ -151,11 +172,17 @@ void DrawHighlightMask::run(const render::RenderContextPointer& renderContext, c
     }
 
     auto highlightStage = renderContext->_scene->getStage<render::HighlightStage>(render::HighlightStage::getName());
-    auto highlightId = _sharedParameters->_highlightIds[_highlightPassIndex];
 
-    if (!inShapes.empty() && !render::HighlightStage::isIndexInvalid(highlightId)) {
+    std::vector<int> passIndices;
+    for (int i = 0; i < HighlightSharedParameters::MAX_PASS_COUNT; i++) {
+        auto highlightId = _sharedParameters->_highlightIds[i];
+        if (!render::HighlightStage::isIndexInvalid(highlightId) && !groupShapes[i].get<render::ShapeBounds>().empty()) {
+            passIndices.push_back(i);
+        }
+    }
+
+    if (!passIndices.empty()) {
         auto resources = inputs.get1();
-        auto& highlight = highlightStage->getHighlight(highlightId);
 
         RenderArgs* args = renderContext->args;
 
@@ -168,12 +195,16 @@ void DrawHighlightMask::run(const render::RenderContextPointer& renderContext, c
         gpu::doInBatch("DrawHighlightMask::run::begin", args->_context, [&](gpu::Batch& batch) {
             batch.enableStereo(false);
             batch.setFramebuffer(resources->getDepthFramebuffer());
-            batch.clearDepthStencilFramebuffer(1.0f, 0);
+            batch.clearFramebuffer(gpu::Framebuffer::BUFFER_COLOR0 | gpu::Framebuffer::BUFFER_DEPTH | gpu::Framebuffer::BUFFER_STENCIL,
+                glm::vec4(0.0f), 1.0f, 0);
         });
 
         const auto jitter = inputs.get2();
 
         render::ItemBounds itemBounds;
+        std::array<std::pair<size_t, size_t>, HighlightSharedParameters::MAX_PASS_COUNT> groupBounds;
+        std::array<bool, HighlightSharedParameters::MAX_PASS_COUNT> hasOwnPipelineShapes;
+        hasOwnPipelineShapes.fill(false);
 
         gpu::doInBatch("DrawHighlightMask::run", args->_context, [&](gpu::Batch& batch) {
             args->_batch = &batch;
@@ -188,57 +219,19 @@ void DrawHighlightMask::run(const render::RenderContextPointer& renderContext, c
             batch.setProjectionJitter(jitter.x, jitter.y);
             batch.setViewTransform(viewMat);
 
-            const std::vector<ShapeKey::Builder> keys = {
-                ShapeKey::Builder(), ShapeKey::Builder().withFade(),
-                ShapeKey::Builder().withDeformed(), ShapeKey::Builder().withDeformed().withFade(),
-                ShapeKey::Builder().withDeformed().withDualQuatSkinned(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withFade(),
-                ShapeKey::Builder().withOwnPipeline(), ShapeKey::Builder().withOwnPipeline().withFade(),
-                ShapeKey::Builder().withDeformed().withOwnPipeline(), ShapeKey::Builder().withDeformed().withOwnPipeline().withFade(),
-                ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline().withFade(),
-            };
-            std::vector<std::vector<ShapeKey>> sortedShapeKeys(keys.size());
-
-            const int OWN_PIPELINE_INDEX = 6;
-            for (const auto& items : inShapes) {
-                itemBounds.insert(itemBounds.end(), items.second.begin(), items.second.end());
-
-                int index = items.first.hasOwnPipeline() ? OWN_PIPELINE_INDEX : 0;
-                if (items.first.isDeformed()) {
-                    index += 2;
-                    if (items.first.isDualQuatSkinned()) {
-                        index += 2;
-                    }
+            for (auto i : passIndices) {
+                const auto& inShapes = groupShapes[i].get<render::ShapeBounds>();
+                size_t start = itemBounds.size();
+                for (const auto& items : inShapes) {
+                    itemBounds.insert(itemBounds.end(), items.second.begin(), items.second.end());
+                    hasOwnPipelineShapes[i] = hasOwnPipelineShapes[i] || items.first.hasOwnPipeline();
                 }
+                groupBounds[i] = { start, itemBounds.size() - start };
 
-                if (items.first.isFaded()) {
-                    index += 1;
-                }
-
-                sortedShapeKeys[index].push_back(items.first);
-            }
-
-            // Render non-withOwnPipeline things
-            for (size_t i = 0; i < OWN_PIPELINE_INDEX; i++) {
-                auto& shapeKeys = sortedShapeKeys[i];
-                if (shapeKeys.size() > 0) {
-                    const auto& shapePipeline = _shapePlumber->pickPipeline(args, keys[i]);
-                    args->_shapePipeline = shapePipeline;
-                    for (const auto& key : shapeKeys) {
-                        renderShapes(renderContext, _shapePlumber, inShapes.at(key));
-                    }
-                }
-            }
-
-            // Render withOwnPipeline things
-            for (size_t i = OWN_PIPELINE_INDEX; i < keys.size(); i++) {
-                auto& shapeKeys = sortedShapeKeys[i];
-                if (shapeKeys.size() > 0) {
-                    args->_shapePipeline = nullptr;
-                    for (const auto& key : shapeKeys) {
-                        args->_itemShapeKey = key._flags.to_ulong();
-                        renderShapes(renderContext, _shapePlumber, inShapes.at(key));
-                    }
-                }
+                // The shape pipelines blend their white with the factor, which writes the group
+                float groupId = HighlightSharedParameters::getGroupIdValue(i);
+                batch.setStateBlendFactor(glm::vec4(groupId, groupId, groupId, 1.0f));
+                renderShapes(renderContext, inShapes);
             }
 
             args->_shapePipeline = nullptr;
@@ -248,22 +241,43 @@ void DrawHighlightMask::run(const render::RenderContextPointer& renderContext, c
         _boundsBuffer->setData(itemBounds.size() * sizeof(render::ItemBound), (const gpu::Byte*) itemBounds.data());
 
         const auto securityMargin = 2.0f;
-        const float blurPixelWidth = 2.0f * securityMargin * HighlightSharedParameters::getBlurPixelWidth(highlight._style, args->_viewport.w);
         const auto framebufferSize = resources->getSourceFrameSize();
-        const glm::vec2 highlightWidth = { blurPixelWidth / framebufferSize.x, blurPixelWidth / framebufferSize.y };
+        for (auto i : passIndices) {
+            auto& highlight = highlightStage->getHighlight(_sharedParameters->_highlightIds[i]);
+            const float blurPixelWidth = 2.0f * securityMargin * HighlightSharedParameters::getBlurPixelWidth(highlight._style, args->_viewport.w);
+            const glm::vec2 highlightWidth = { blurPixelWidth / framebufferSize.x, blurPixelWidth / framebufferSize.y };
 
-        if (highlightWidth != _outlineWidth.get()) {
-            _outlineWidth.edit() = highlightWidth;
+            if (highlightWidth != _outlineWidths[i].get()) {
+                _outlineWidths[i].edit() = highlightWidth;
+            }
         }
 
         gpu::doInBatch("DrawHighlightMask::run::end", args->_context, [&](gpu::Batch& batch) {
-            // Draw stencil mask with object bounding boxes
-            auto stencilPipeline = highlight._style.isFilled() ? _stencilMaskFillPipeline : _stencilMaskPipeline;
-            batch.setPipeline(stencilPipeline);
-            batch.setResourceBuffer(BOUNDS_SLOT, _boundsBuffer);
-            batch.setUniformBuffer(PARAMETERS_SLOT, _outlineWidth);
             static const int NUM_VERTICES_PER_CUBE = 36;
-            batch.draw(gpu::TRIANGLES, NUM_VERTICES_PER_CUBE * (gpu::uint32) itemBounds.size(), 0);
+            batch.setResourceBuffer(BOUNDS_SLOT, _boundsBuffer);
+
+            // The items with their own pipeline wrote whatever color they draw, so their group is written
+            // again in their bounds.  This must come before the stencil mask which overwrites the shape bit.
+            batch.setPipeline(_idFillPipeline);
+            for (auto i : passIndices) {
+                if (hasOwnPipelineShapes[i]) {
+                    float groupId = HighlightSharedParameters::getGroupIdValue(i);
+                    batch.setStateBlendFactor(glm::vec4(groupId, groupId, groupId, 1.0f));
+                    batch.setUniformBuffer(PARAMETERS_SLOT, _outlineWidths[i]);
+                    batch.draw(gpu::TRIANGLES, NUM_VERTICES_PER_CUBE * (gpu::uint32)groupBounds[i].second,
+                        NUM_VERTICES_PER_CUBE * (gpu::uint32)groupBounds[i].first);
+                }
+            }
+
+            // Draw stencil mask with object bounding boxes
+            for (auto i : passIndices) {
+                auto& highlight = highlightStage->getHighlight(_sharedParameters->_highlightIds[i]);
+                auto stencilPipeline = highlight._style.isFilled() ? _stencilMaskFillPipeline : _stencilMaskPipeline;
+                batch.setPipeline(stencilPipeline);
+                batch.setUniformBuffer(PARAMETERS_SLOT, _outlineWidths[i]);
+                batch.draw(gpu::TRIANGLES, NUM_VERTICES_PER_CUBE * (gpu::uint32)groupBounds[i].second,
+                    NUM_VERTICES_PER_CUBE * (gpu::uint32)groupBounds[i].first);
+            }
         });
     } else {
         // Highlight rect should be null as there are no highlighted shapes
@@ -271,11 +285,67 @@ void DrawHighlightMask::run(const render::RenderContextPointer& renderContext, c
     }
 }
 
+void DrawHighlightMask::renderShapes(const render::RenderContextPointer& renderContext, const render::ShapeBounds& inShapes) {
+    RenderArgs* args = renderContext->args;
+
+    const std::vector<ShapeKey::Builder> keys = {
+        ShapeKey::Builder(), ShapeKey::Builder().withFade(),
+        ShapeKey::Builder().withDeformed(), ShapeKey::Builder().withDeformed().withFade(),
+        ShapeKey::Builder().withDeformed().withDualQuatSkinned(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withFade(),
+        ShapeKey::Builder().withOwnPipeline(), ShapeKey::Builder().withOwnPipeline().withFade(),
+        ShapeKey::Builder().withDeformed().withOwnPipeline(), ShapeKey::Builder().withDeformed().withOwnPipeline().withFade(),
+        ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline().withFade(),
+    };
+    std::vector<std::vector<ShapeKey>> sortedShapeKeys(keys.size());
+
+    const int OWN_PIPELINE_INDEX = 6;
+    for (const auto& items : inShapes) {
+        int index = items.first.hasOwnPipeline() ? OWN_PIPELINE_INDEX : 0;
+        if (items.first.isDeformed()) {
+            index += 2;
+            if (items.first.isDualQuatSkinned()) {
+                index += 2;
+            }
+        }
+
+        if (items.first.isFaded()) {
+            index += 1;
+        }
+
+        sortedShapeKeys[index].push_back(items.first);
+    }
+
+    // Render non-withOwnPipeline things
+    for (size_t i = 0; i < OWN_PIPELINE_INDEX; i++) {
+        auto& shapeKeys = sortedShapeKeys[i];
+        if (shapeKeys.size() > 0) {
+            const auto& shapePipeline = _shapePlumber->pickPipeline(args, keys[i]);
+            args->_shapePipeline = shapePipeline;
+            for (const auto& key : shapeKeys) {
+                render::renderShapes(renderContext, _shapePlumber, inShapes.at(key));
+            }
+        }
+    }
+
+    // Render withOwnPipeline things
+    for (size_t i = OWN_PIPELINE_INDEX; i < keys.size(); i++) {
+        auto& shapeKeys = sortedShapeKeys[i];
+        if (shapeKeys.size() > 0) {
+            args->_shapePipeline = nullptr;
+            for (const auto& key : shapeKeys) {
+                args->_itemShapeKey = key._flags.to_ulong();
+                render::renderShapes(renderContext, _shapePlumber, inShapes.at(key));
+            }
+        }
+    }
+}
+
+static_assert(HIGHLIGHT_MAX_GROUP_COUNT == HighlightSharedParameters::MAX_PASS_COUNT, "A highlight group is drawn per pass");
+
 gpu::PipelinePointer DrawHighlight::_pipeline;
-gpu::PipelinePointer DrawHighlight::_pipelineFilled;
 
-DrawHighlight::DrawHighlight(unsigned int highlightIndex, HighlightSharedParametersPointer parameters) :
-    _highlightPassIndex(highlightIndex), _sharedParameters(parameters) {
+DrawHighlight::DrawHighlight(HighlightSharedParametersPointer parameters) :
+    _sharedParameters(parameters) {
 }
 
 void DrawHighlight::run(const render::RenderContextPointer& renderContext, const Inputs& inputs) {
@@ -293,56 +363,77 @@ void DrawHighlight::run(const render::RenderContextPointer& renderContext, const
             auto args = renderContext->args;
 
             auto highlightStage = renderContext->_scene->getStage<render::HighlightStage>(render::HighlightStage::getName());
-            auto highlightId = _sharedParameters->_highlightIds[_highlightPassIndex];
-            if (!render::HighlightStage::isIndexInvalid(highlightId)) {
-                auto& highlight = highlightStage->getHighlight(highlightId);
-                auto pipeline = getPipeline(highlight._style);
-                {
-                    auto& shaderParameters = _configuration.edit();
-
-                    shaderParameters._outlineUnoccludedColor = highlight._style._outlineUnoccluded.color;
-                    shaderParameters._outlineUnoccludedAlpha = highlight._style._outlineUnoccluded.alpha * (highlight._style._isOutlineSmooth ? 2.0f : 1.0f);
-                    shaderParameters._outlineOccludedColor = highlight._style._outlineOccluded.color;
-                    shaderParameters._outlineOccludedAlpha = highlight._style._outlineOccluded.alpha * (highlight._style._isOutlineSmooth ? 2.0f : 1.0f);
-                    shaderParameters._fillUnoccludedColor = highlight._style._fillUnoccluded.color;
-                    shaderParameters._fillUnoccludedAlpha = highlight._style._fillUnoccluded.alpha;
-                    shaderParameters._fillOccludedColor = highlight._style._fillOccluded.color;
-                    shaderParameters._fillOccludedAlpha = highlight._style._fillOccluded.alpha;
-
-                    shaderParameters._threshold = highlight._style._isOutlineSmooth ? 1.0f : 1e-3f;
-                    shaderParameters._blurKernelSize = std::min(7, std::max(2, (int)floorf(highlight._style._outlineWidth * 3 + 0.5f)));
+            {
+                auto& shaderParameters = _configuration.edit();
+                auto& kernel = shaderParameters._kernel;
+                kernel._groupCount = 0;
+                kernel._size = glm::vec2(0.0f);
+                glm::vec2 deltaUv(std::numeric_limits<float>::max());
+
+                for (int i = 0; i < HighlightSharedParameters::MAX_PASS_COUNT; i++) {
+                    auto highlightId = _sharedParameters->_highlightIds[i];
+                    if (render::HighlightStage::isIndexInvalid(highlightId)) {
+                        continue;
+                    }
+                    auto& highlight = highlightStage->getHighlight(highlightId);
+                    auto& groupParameters = shaderParameters._groups[i];
+
+                    groupParameters._outlineUnoccludedColor = highlight._style._outlineUnoccluded.color;
+                    groupParameters._outlineUnoccludedAlpha = highlight._style._outlineUnoccluded.alpha * (highlight._style._isOutlineSmooth ? 2.0f : 1.0f);
+                    groupParameters._outlineOccludedColor = highlight._style._outlineOccluded.color;
+                    groupParameters._outlineOccludedAlpha = highlight._style._outlineOccluded.alpha * (highlight._style._isOutlineSmooth ? 2.0f : 1.0f);
+                    groupParameters._fillUnoccludedColor = highlight._style._fillUnoccluded.color;
+                    groupParameters._fillUnoccludedAlpha = highlight._style._fillUnoccluded.alpha;
+                    groupParameters._fillOccludedColor = highlight._style._fillOccluded.color;
+                    groupParameters._fillOccludedAlpha = highlight._style._fillOccluded.alpha;
+                    groupParameters._isFilled = highlight._style.isFilled() ? 1 : 0;
+
+                    groupParameters._threshold = highlight._style._isOutlineSmooth ? 1.0f : 1e-3f;
+                    int blurKernelSize = std::min(7, std::max(2, (int)floorf(highlight._style._outlineWidth * 3 + 0.5f)));
                     // Size is in normalized screen height. We decide that for highlight width = 1, this is equal to 1/400.
                     auto size = highlight._style._outlineWidth / 400.0f;
-                    shaderParameters._size.x = (size * framebufferSize.y) / framebufferSize.x;
-                    shaderParameters._size.y = size;
+                    groupParameters._size.x = (size * framebufferSize.y) / framebufferSize.x;
+                    groupParameters._size.y = size;
+
+                    kernel._groupCount = i + 1;
+                    kernel._size = glm::max(kernel._size, groupParameters._size);
+                    deltaUv = glm::min(deltaUv, groupParameters._size / (float)blurKernelSize);
                 }
 
-                auto primaryFramebuffer = inputs.get4();
-                gpu::doInBatch("DrawHighlight::run", args->_context, [&](gpu::Batch& batch) {
-                    batch.enableStereo(false);
-                    batch.setFramebuffer(destinationFrameBuffer);
-
-                    batch.setViewportTransform(args->_viewport);
-                    batch.setProjectionTransform(glm::mat4());
-                    batch.resetViewTransform();
-                    batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(framebufferSize, args->_viewport));
-                    batch.setPipeline(pipeline);
-
-                    batch.setUniformBuffer(ru::Buffer::HighlightParams, _configuration);
-                    batch.setUniformBuffer(ru::Buffer::DeferredFrameTransform, frameTransform->getFrameTransformBuffer());
-                    batch.setResourceTexture(ru::Texture::HighlightSceneDepth, sceneDepthBuffer->getPrimaryDepthTexture());
-                    batch.setResourceTexture(ru::Texture::HighlightDepth, highlightedDepthTexture);
-                    batch.draw(gpu::TRIANGLE_STRIP, 4);
-
-                    // Reset the framebuffer for overlay drawing
-                    batch.setFramebuffer(primaryFramebuffer);
-                });
+                // The samples are as close as those of the finest group, as far as the widest group, and no more than
+                // twice the samples of one group per line
+                const int MAX_BLUR_KERNEL_SIZE = 14;
+                int blurKernelSize = (kernel._groupCount > 0 && deltaUv.y > 0.0f) ? (int)ceilf(kernel._size.y / deltaUv.y - 1e-3f) : 2;
+                kernel._blurKernelSize = std::min(MAX_BLUR_KERNEL_SIZE, std::max(2, blurKernelSize));
+                kernel._deltaUv = kernel._size / (float)kernel._blurKernelSize;
             }
+
+            auto primaryFramebuffer = inputs.get4();
+            gpu::doInBatch("DrawHighlight::run", args->_context, [&](gpu::Batch& batch) {
+                batch.enableStereo(false);
+                batch.setFramebuffer(destinationFrameBuffer);
+
+                batch.setViewportTransform(args->_viewport);
+                batch.setProjectionTransform(glm::mat4());
+                batch.resetViewTransform();
+                batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(framebufferSize, args->_viewport));
+                batch.setPipeline(getPipeline());
+
+                batch.setUniformBuffer(ru::Buffer::HighlightParams, _configuration);
+                batch.setUniformBuffer(ru::Buffer::DeferredFrameTransform, frameTransform->getFrameTransformBuffer());
+                batch.setResourceTexture(ru::Texture::HighlightSceneDepth, sceneDepthBuffer->getPrimaryDepthTexture());
+                batch.setResourceTexture(ru::Texture::HighlightDepth, highlightedDepthTexture);
+                batch.setResourceTexture(ru::Texture::HighlightId, highlightFrameBuffer->getIdTexture());
+                batch.draw(gpu::TRIANGLE_STRIP, 4);
+
+                // Reset the framebuffer for overlay drawing
+                batch.setFramebuffer(primaryFramebuffer);
+            });
         }
     }
 }
 
-const gpu::PipelinePointer& DrawHighlight::getPipeline(const render::HighlightStyle& style) {
+const gpu::PipelinePointer& DrawHighlight::getPipeline() {
     if (!_pipeline) {
         gpu::StatePointer state = std::make_shared<gpu::State>();
         state->setDepthTest(gpu::State::DepthTest(false, false));
@@ -352,11 +443,8 @@ const gpu::PipelinePointer& DrawHighlight::getPipeline(const render::HighlightSt
 
         auto program = gpu::Shader::createProgram(shader::render_utils::program::highlight);
         _pipeline = gpu::Pipeline::create(program, state);
-
-        program = gpu::Shader::createProgram(shader::render_utils::program::highlight_filled);
-        _pipelineFilled = gpu::Pipeline::create(program, state);
     }
-    return style.isFilled() ? _pipelineFilled : _pipeline;
+    return _pipeline;
 }
 
 DebugHighlight::DebugHighlight() {
@@ -508,10 +596,12 @@ void DrawHighlightTask::build(JobModel& task, const render::Varying& inputs, ren
     // Prepare the ShapePipeline
     auto shapePlumber = std::make_shared<ShapePlumber>();
     {
+        // The shapes write their group by blending the white of the shadow shaders with the factor
         auto state = std::make_shared<gpu::State>();
         state->setDepthTest(true, true, gpu::LESS_EQUAL);
-        state->setColorWriteMask(false, false, false, false);
-
+        state->setStencilTest(true, SHAPE_STENCIL_MASK, gpu::State::StencilTest(SHAPE_STENCIL_MASK, 0xFF, gpu::ALWAYS, gpu::State::STENCIL_OP_KEEP, gpu::State::STENCIL_OP_KEEP, gpu::State::STENCIL_OP_REPLACE));
+        state->setBlendFunction(true, gpu::State::FACTOR_COLOR, gpu::State::BLEND_OP_ADD, gpu::State::ZERO);
+        state->setColorWriteMask(true, false, false, false);
 
         auto fadeEffect = DependencyManager::get<FadeEffect>();
         initZPassPipelines(*shapePlumber, state, fadeEffect->getBatchSetter(), fadeEffect->getItemUniformSetter());
@@ -522,7 +612,7 @@ void DrawHighlightTask::build(JobModel& task, const render::Varying& inputs, ren
 
     // Prepare for highlight group rendering.
     const auto highlightResources = task.addJob<PrepareDrawHighlight>("PrepareHighlight", primaryFramebuffer);
-    render::Varying highlight0Rect;
+    DrawHighlightMask::ShapeBoundsArray groupShapes;
 
     for (auto i = 0; i < HighlightSharedParameters::MAX_PASS_COUNT; i++) {
         const auto selectionName = task.addJob<ExtractSelectionName>("ExtractSelectionName", highlightSelectionNames, i);
@@ -532,33 +622,19 @@ void DrawHighlightTask::build(JobModel& task, const render::Varying& inputs, ren
 
         // Sort
         const auto sortedPipelines = task.addJob<render::PipelineSortShapes>("HighlightPipelineSort", highlightedItems);
-        const auto sortedBounds = task.addJob<render::DepthSortShapes>("HighlightDepthSort", sortedPipelines);
-
-        // Draw depth of highlighted objects in separate buffer
-        std::string name;
-        {
-            std::ostringstream stream;
-            stream << "HighlightMask" << i;
-            name = stream.str();
-        }
-        const auto drawMaskInputs = DrawHighlightMask::Inputs(sortedBounds, highlightResources, jitter).asVarying();
-        const auto highlightedRect = task.addJob<DrawHighlightMask>(name, drawMaskInputs, i, shapePlumber, sharedParameters);
-        if (i == 0) {
-            highlight0Rect = highlightedRect;
-        }
-
-        // Draw highlight
-        {
-            std::ostringstream stream;
-            stream << "HighlightEffect" << i;
-            name = stream.str();
-        }
-        const auto drawHighlightInputs = DrawHighlight::Inputs(deferredFrameTransform, highlightResources, sceneFrameBuffer, highlightedRect, primaryFramebuffer).asVarying();
-        task.addJob<DrawHighlight>(name, drawHighlightInputs, i, sharedParameters);
+        groupShapes[i] = task.addJob<render::DepthSortShapes>("HighlightDepthSort", sortedPipelines);
     }
 
+    // Draw depth and group of all the highlighted objects in separate buffers
+    const auto drawMaskInputs = DrawHighlightMask::Inputs(groupShapes, highlightResources, jitter).asVarying();
+    const auto highlightedRect = task.addJob<DrawHighlightMask>("HighlightMask", drawMaskInputs, shapePlumber, sharedParameters);
+
+    // Draw highlight
+    const auto drawHighlightInputs = DrawHighlight::Inputs(deferredFrameTransform, highlightResources, sceneFrameBuffer, highlightedRect, primaryFramebuffer).asVarying();
+    task.addJob<DrawHighlight>("HighlightEffect", drawHighlightInputs, sharedParameters);
+
     // Debug highlight
-    const auto debugInputs = DebugHighlight::Inputs(highlightResources, const_cast<const render::Varying&>(highlight0Rect), jitter, primaryFramebuffer).asVarying();
+    const auto debugInputs = DebugHighlight::Inputs(highlightResources, highlightedRect, jitter, primaryFramebuffer).asVarying();
     task.addJob<DebugHighlight>("HighlightDebug", debugInputs);
 }
 
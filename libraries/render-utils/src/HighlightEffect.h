@@ -25,6 +25,8 @@ public:
 
     gpu::FramebufferPointer getDepthFramebuffer();
     gpu::TexturePointer getDepthTexture();
+    // the group of each highlighted pixel, drawn along with the depth
+    gpu::TexturePointer getIdTexture();
 
     gpu::FramebufferPointer getColorFramebuffer();
 
@@ -37,6 +39,7 @@ protected:
     gpu::FramebufferPointer _depthFrameBuffer;
     gpu::FramebufferPointer _colorFrameBuffer;
     gpu::TexturePointer _depthStencilTexture;
+    gpu::TexturePointer _idTexture;
 
     glm::ivec2 _frameSize;
 
@@ -57,6 +60,8 @@ public:
 
     std::array<render::HighlightStage::Index, MAX_PASS_COUNT> _highlightIds;
 
+    // the value the mask writes in the id texture for the group of a pass
+    static float getGroupIdValue(int highlightPassIndex) { return (highlightPassIndex + 1) / 255.0f; }
     static float getBlurPixelWidth(const render::HighlightStyle& style, int frameBufferHeight);
 };
 
@@ -110,25 +115,30 @@ private:
 
 };
 
+// Draws the depth and the group of the items of every highlight pass in the same buffers, so that a single
+// DrawHighlight resolves the outlines of all of them.
 class DrawHighlightMask {
 public:
-    using Inputs = render::VaryingSet3<render::ShapeBounds, HighlightResourcesPointer, glm::vec2>;
+    using ShapeBoundsArray = render::VaryingArray<render::ShapeBounds, HighlightSharedParameters::MAX_PASS_COUNT>;
+    using Inputs = render::VaryingSet3<ShapeBoundsArray, HighlightResourcesPointer, glm::vec2>;
     using Outputs = glm::ivec4;
     using JobModel = render::Job::ModelIO<DrawHighlightMask, Inputs, Outputs>;
 
-    DrawHighlightMask(unsigned int highlightIndex, render::ShapePlumberPointer shapePlumber, HighlightSharedParametersPointer parameters);
+    DrawHighlightMask(render::ShapePlumberPointer shapePlumber, HighlightSharedParametersPointer parameters);
 
     void run(const render::RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs);
 
 protected:
-    unsigned int _highlightPassIndex;
+    void renderShapes(const render::RenderContextPointer& renderContext, const render::ShapeBounds& inShapes);
+
     render::ShapePlumberPointer _shapePlumber;
     HighlightSharedParametersPointer _sharedParameters;
     gpu::BufferPointer _boundsBuffer;
-    gpu::StructBuffer<glm::vec2> _outlineWidth;
+    std::array<gpu::StructBuffer<glm::vec2>, HighlightSharedParameters::MAX_PASS_COUNT> _outlineWidths;
 
     static gpu::PipelinePointer _stencilMaskPipeline;
     static gpu::PipelinePointer _stencilMaskFillPipeline;
+    static gpu::PipelinePointer _idFillPipeline;
 };
 
 class DrawHighlight {
@@ -138,7 +148,7 @@ public:
     using Config = render::Job::Config;
     using JobModel = render::Job::ModelI<DrawHighlight, Inputs, Config>;
 
-    DrawHighlight(unsigned int highlightIndex, HighlightSharedParametersPointer parameters);
+    DrawHighlight(HighlightSharedParametersPointer parameters);
 
     void run(const render::RenderContextPointer& renderContext, const Inputs& inputs);
 
@@ -146,15 +156,17 @@ private:
 
 #include "Highlight_shared.slh"
 
-    using HighlightConfigurationBuffer = gpu::StructBuffer<HighlightParameters>;
+    struct HighlightGroupsParameters {
+        HighlightKernel _kernel;
+        HighlightParameters _groups[HIGHLIGHT_MAX_GROUP_COUNT];
+    };
 
-    static const gpu::PipelinePointer& getPipeline(const render::HighlightStyle& style);
+    using HighlightConfigurationBuffer = gpu::StructBuffer<HighlightGroupsParameters>;
+
+    static const gpu::PipelinePointer& getPipeline();
 
     static gpu::PipelinePointer _pipeline;
-    static gpu::PipelinePointer _pipelineFilled;
 
-    unsigned int _highlightPassIndex;
-    HighlightParameters _parameters;
     HighlightSharedParametersPointer _sharedParameters;
     HighlightConfigurationBuffer _configuration;
 };
@@ -13,6 +13,7 @@
 #include <gpu/Context.h>
 #include <shaders/Shaders.h>
 #include <graphics/ShaderConstants.h>
+#include <TBBHelpers.h>
 
 #include "RenderUtilsLogging.h"
 #include "render-utils/ShaderConstants.h"
@@ -254,66 +255,61 @@ uint32_t scanLightVolumeBox(FrustumGrid& grid, const FrustumGrid::Planes planes[
     return numClustersTouched;
 }
 
-uint32_t scanLightVolumeSphere(FrustumGrid& grid, const FrustumGrid::Planes planes[3], int zMin, int zMax, int yMin, int yMax, int xMin, int xMax, LightClusters::LightID lightId, const glm::vec4& eyePosRadius,
+uint32_t scanLightVolumeSphereSlice(FrustumGrid& grid, const FrustumGrid::Planes planes[3], int z, int yMin, int yMax, int xMin, int xMax,
+    const glm::ivec3& centerCluster, LightClusters::LightID lightId, const glm::vec4& eyePosRadius,
     std::vector< std::vector<LightClusters::LightIndex>>& clusterGrid) {
-    glm::ivec3 gridPosToOffset(1, grid.dims.x, grid.dims.x * grid.dims.y);
     uint32_t numClustersTouched = 0;
     const auto& xPlanes = planes[0];
     const auto& yPlanes = planes[1];
     const auto& zPlanes = planes[2];
 
-    // FInd the light origin cluster
-    auto centerCluster = grid.frustumGrid_eyeToClusterPos(glm::vec3(eyePosRadius));
-
     int center_z = centerCluster.z;
     int center_y = centerCluster.y;
 
-    for (auto z = zMin; (z <= zMax); z++) {
-        auto zSphere = eyePosRadius;
-        if (z != center_z) {
-            auto plane = (z < center_z) ? zPlanes[z + 1] : -zPlanes[z];
-            if (!reduceSphereToPlane(zSphere, plane, zSphere)) {
+    auto zSphere = eyePosRadius;
+    if (z != center_z) {
+        auto plane = (z < center_z) ? zPlanes[z + 1] : -zPlanes[z];
+        if (!reduceSphereToPlane(zSphere, plane, zSphere)) {
+            // pass this slice!
+            return 0;
+        }
+    }
+    for (auto y = yMin; (y <= yMax); y++) {
+        auto ySphere = zSphere;
+        if (y != center_y) {
+            auto plane = (y < center_y) ? yPlanes[y + 1] : -yPlanes[y];
+            if (!reduceSphereToPlane(ySphere, plane, ySphere)) {
                 // pass this slice!
                 continue;
             }
         }
-        for (auto y = yMin; (y <= yMax); y++) {
-            auto ySphere = zSphere;
-            if (y != center_y) {
-                auto plane = (y < center_y) ? yPlanes[y + 1] : -yPlanes[y];
-                if (!reduceSphereToPlane(ySphere, plane, ySphere)) {
-                    // pass this slice!
-                    continue;
-                }
-            }
 
-            glm::vec3 spherePoint(ySphere);
+        glm::vec3 spherePoint(ySphere);
 
-            auto x = xMin;
-            for (; (x < xMax); ++x) {
-                const auto& plane = xPlanes[x + 1];
-                auto testDistance = distanceToPlane(spherePoint, plane) + ySphere.w;
-                if (testDistance >= 0.0f) {
-                    break;
-                }
+        auto x = xMin;
+        for (; (x < xMax); ++x) {
+            const auto& plane = xPlanes[x + 1];
+            auto testDistance = distanceToPlane(spherePoint, plane) + ySphere.w;
+            if (testDistance >= 0.0f) {
+                break;
             }
-            auto xs = xMax;
-            for (; (xs >= x); --xs) {
-                auto plane = -xPlanes[xs];
-                auto testDistance = distanceToPlane(spherePoint, plane) + ySphere.w;
-                if (testDistance >= 0.0f) {
-                    break;
-                }
+        }
+        auto xs = xMax;
+        for (; (xs >= x); --xs) {
+            auto plane = -xPlanes[xs];
+            auto testDistance = distanceToPlane(spherePoint, plane) + ySphere.w;
+            if (testDistance >= 0.0f) {
+                break;
             }
+        }
 
-            for (; (x <= xs); x++) {
-                auto index = grid.frustumGrid_clusterToIndex(ivec3(x, y, z));
-                if (index < (int)clusterGrid.size()) {
-                    clusterGrid[index].emplace_back(lightId);
-                    numClustersTouched++;
-                } else {
-                    qCDebug(renderutils) << "WARNING: LightClusters::scanLightVolumeSphere invalid index found ? numClusters = " << clusterGrid.size() << " index = " << index << " found from cluster xyz = " << x << " " << y << " " << z;
-                }
+        for (; (x <= xs); x++) {
+            auto index = grid.frustumGrid_clusterToIndex(ivec3(x, y, z));
+            if (index < (int)clusterGrid.size()) {
+                clusterGrid[index].emplace_back(lightId);
+                numClustersTouched++;
+            } else {
+                qCDebug(renderutils) << "WARNING: LightClusters::scanLightVolumeSphereSlice invalid index found ? numClusters = " << clusterGrid.size() << " index = " << index << " found from cluster xyz = " << x << " " << y << " " << z;
             }
         }
     }
@@ -321,6 +317,21 @@ uint32_t scanLightVolumeSphere(FrustumGrid& grid, const FrustumGrid::Planes plan
     return numClustersTouched;
 }
 
+// The clusters a light was found to overlap, before they are scanned slice by slice
+struct LightVolume {
+    LightClusters::LightID lightId;
+    bool isSpot;
+    bool beyondFar;
+    glm::vec4 eyePosRadius;
+    glm::ivec3 centerCluster;
+    int zMin;
+    int zMax;
+    int yMin;
+    int yMax;
+    int xMin;
+    int xMax;
+};
+
 glm::ivec3 LightClusters::updateClusters() {
     // Make sure resource are in good shape
     updateClusterResource();
@@ -328,8 +339,15 @@ glm::ivec3 LightClusters::updateClusters() {
     // Clean up last info
     uint32_t numClusters = (uint32_t)_clusterGrid.size();
 
-    std::vector< std::vector< LightIndex > > clusterGridPoint(numClusters);
-    std::vector< std::vector< LightIndex > > clusterGridSpot(numClusters);
+    // The lists of the clusters are kept from frame to frame so that they don't reallocate
+    auto& clusterGridPoint = _clusterGridPoint;
+    auto& clusterGridSpot = _clusterGridSpot;
+    clusterGridPoint.resize(numClusters);
+    clusterGridSpot.resize(numClusters);
+    for (uint32_t i = 0; i < numClusters; ++i) {
+        clusterGridPoint[i].clear();
+        clusterGridSpot[i].clear();
+    }
 
     _clusterGrid.clear();
     _clusterGrid.resize(numClusters, EMPTY_CLUSTER);
@@ -346,6 +364,8 @@ glm::ivec3 LightClusters::updateClusters() {
     uint32_t numClusterTouched = 0;
     uint32_t numLightsIn = _visibleLightIndices[0];
     uint32_t numClusteredLights = 0;
+    std::vector<LightVolume> lightVolumes;
+    lightVolumes.reserve(_visibleLightIndices.size());
     for (size_t lightNum = 1; lightNum < _visibleLightIndices.size(); ++lightNum) {
         auto lightId = _visibleLightIndices[lightNum];
         auto light = _lightStage->getLight(lightId);
@@ -472,17 +492,45 @@ glm::ivec3 LightClusters::updateClusters() {
             assert(yMin <= yMax);
         }
 
-        // now voxelize
-        auto& clusterGrid = (isSpot ? clusterGridSpot : clusterGridPoint);
-        if (beyondFar) {
-            numClusterTouched += scanLightVolumeBoxSlice(theFrustumGrid, _gridPlanes, zMin, yMin, yMax, xMin, xMax, lightId, glm::vec4(glm::vec3(eyeOri), radius), clusterGrid);
-        } else {
-            numClusterTouched += scanLightVolumeSphere(theFrustumGrid, _gridPlanes, zMin, zMax, yMin, yMax, xMin, xMax, lightId, glm::vec4(glm::vec3(eyeOri), radius), clusterGrid);
-        }
+        // Beyond the far plane a light only fills its box in the first slice
+        auto eyePosRadius = glm::vec4(glm::vec3(eyeOri), radius);
+        auto centerCluster = theFrustumGrid.frustumGrid_eyeToClusterPos(glm::vec3(eyePosRadius));
+        lightVolumes.push_back({ lightId, isSpot, beyondFar, eyePosRadius, centerCluster, zMin, beyondFar ? zMin : zMax,
+                                 yMin, yMax, xMin, xMax });
 
         numClusteredLights++;
     }
 
+    // now voxelize, a slice only writes to its own clusters so they are filled in parallel, each in light order
+    int numSlices = 0;
+    for (const auto& volume : lightVolumes) {
+        numSlices = std::max(numSlices, volume.zMax + 1);
+    }
+    std::vector<uint32_t> sliceNumClustersTouched(numSlices, 0);
+    auto scanSlice = [&](int z) {
+        for (const auto& volume : lightVolumes) {
+            if (z < volume.zMin || z > volume.zMax) {
+                continue;
+            }
+            auto& clusterGrid = (volume.isSpot ? clusterGridSpot : clusterGridPoint);
+            if (volume.beyondFar) {
+                sliceNumClustersTouched[z] += scanLightVolumeBoxSlice(theFrustumGrid, _gridPlanes, z, volume.yMin, volume.yMax,
+                    volume.xMin, volume.xMax, volume.lightId, volume.eyePosRadius, clusterGrid);
+            } else {
+                sliceNumClustersTouched[z] += scanLightVolumeSphereSlice(theFrustumGrid, _gridPlanes, z, volume.yMin, volume.yMax,
+                    volume.xMin, volume.xMax, volume.centerCluster, volume.lightId, volume.eyePosRadius, clusterGrid);
+            }
+        }
+    };
+    tbb::parallel_for(tbb::blocked_range<int>(0, numSlices), [&](const tbb::blocked_range<int>& range) {
+        for (int z = range.begin(); z != range.end(); ++z) {
+            scanSlice(z);
+        }
+    });
+    for (auto touched : sliceNumClustersTouched) {
+        numClusterTouched += touched;
+    }
+
     // Lights have been gathered now reexpress in terms of 2 sequential buffers
     // Start filling from near to far and stops if it overflows
     bool checkBudget = false;
@@ -105,6 +105,8 @@ public:
 
     std::vector<uint32_t> _clusterGrid;
     std::vector<LightIndex> _clusterContent;
+    std::vector< std::vector<LightIndex> > _clusterGridPoint;
+    std::vector< std::vector<LightIndex> > _clusterGridSpot;
     gpu::BufferView _clusterGridBuffer;
     gpu::BufferView _clusterContentBuffer;
     uint32_t _clusterContentBudget { 0 };
@@ -78,6 +78,11 @@ LightStage::Shadow::Cascade::Cascade() :
     _maxDistance{ 20.0f } {
 }
 
+// The margin a stable cascade is fitted with around the view, relative to its size
+static const float STABLE_CASCADE_MARGIN = 0.1f;
+// A stable cascade is refitted once the view covers less than this of it, as it would waste too much resolution
+static const float MIN_STABLE_CASCADE_COVERAGE = 0.7f;
+
 const glm::mat4& LightStage::Shadow::Cascade::getView() const {
     return _frustum->getView();
 }
@@ -86,6 +91,55 @@ const glm::mat4& LightStage::Shadow::Cascade::getProjection() const {
     return _frustum->getProjection();
 }
 
+void LightStage::Shadow::Cascade::stabilizeFrustum() {
+    auto evalLightSpaceBox = [](const ViewFrustum& frustum, const Transform& lightViewInverse, vec3& min, vec3& max) {
+        const vec3 corners[] = {
+            frustum.getNearTopLeft(), frustum.getNearTopRight(), frustum.getNearBottomLeft(), frustum.getNearBottomRight(),
+            frustum.getFarTopLeft(), frustum.getFarTopRight(), frustum.getFarBottomLeft(), frustum.getFarBottomRight()
+        };
+        min = lightViewInverse.transform(corners[0]);
+        max = min;
+        for (const auto& corner : corners) {
+            const auto lightCorner = lightViewInverse.transform(corner);
+            min = glm::min(min, lightCorner);
+            max = glm::max(max, lightCorner);
+        }
+    };
+
+    // Keep the previous frustum as long as it holds the fitted one and isn't much larger
+    if (_stableFrustum && _stableFrustum->getOrientation() == _frustum->getOrientation()) {
+        const Transform stableView{ _stableFrustum->getView() };
+        const Transform stableViewInverse{ stableView.getInverseMatrix() };
+        vec3 stableMin, stableMax;
+        vec3 fitMin, fitMax;
+        evalLightSpaceBox(*_stableFrustum, stableViewInverse, stableMin, stableMax);
+        evalLightSpaceBox(*_frustum, stableViewInverse, fitMin, fitMax);
+
+        const vec3 stableSize = stableMax - stableMin;
+        const vec3 fitSize = fitMax - fitMin;
+        if (glm::all(glm::lessThanEqual(stableMin, fitMin)) && glm::all(glm::lessThanEqual(fitMax, stableMax)) &&
+            fitSize.x >= MIN_STABLE_CASCADE_COVERAGE * stableSize.x && fitSize.y >= MIN_STABLE_CASCADE_COVERAGE * stableSize.y) {
+            *_frustum = *_stableFrustum;
+            return;
+        }
+    }
+
+    const auto margin = STABLE_CASCADE_MARGIN * glm::max(_frustum->getWidth(), _frustum->getHeight());
+    const Transform view{ _frustum->getView() };
+    const Transform viewInverse{ view.getInverseMatrix() };
+    vec3 min, max;
+    evalLightSpaceBox(*_frustum, viewInverse, min, max);
+    _frustum->setProjection(glm::ortho<float>(min.x - margin, max.x + margin, min.y - margin, max.y + margin,
+                                              -max.z - margin, -min.z + margin));
+    _frustum->calculate();
+
+    if (!_stableFrustum) {
+        _stableFrustum = std::make_shared<ViewFrustum>();
+    }
+    *_stableFrustum = *_frustum;
+    ++_frustumStamp;
+}
+
 float LightStage::Shadow::Cascade::computeFarDistance(const ViewFrustum& viewFrustum, const Transform& shadowViewInverse,
                                                       float left, float right, float bottom, float top, float viewMaxShadowDistance) const {
     // Far distance should be extended to the intersection of the infinitely extruded shadow frustum 
@@ -155,6 +209,15 @@ LightStage::Shadow::Shadow(graphics::LightPointer light, unsigned int cascadeCou
     }
 }
 
+void LightStage::Shadow::setCachingStaticCasters(bool isCaching) {
+    if (isCaching != _isCachingStaticCasters) {
+        _isCachingStaticCasters = isCaching;
+        for (auto& cascade : _cascades) {
+            cascade._stableFrustum.reset();
+        }
+    }
+}
+
 void LightStage::Shadow::setLight(graphics::LightPointer light) {
     _light = light;
     if (light) {
@@ -297,10 +360,16 @@ void LightStage::Shadow::setKeylightCascadeFrustum(unsigned int cascadeIndex, co
     // Calculate the frustum's internal state
     cascade._frustum->calculate();
 
+    if (_isCachingStaticCasters) {
+        cascade.stabilizeFrustum();
+    }
+
     // Update the buffer
+    const Transform cascadeView{ cascade._frustum->getView() };
+    const Transform cascadeViewInverse{ cascadeView.getInverseMatrix() };
     auto& schema = _schemaBuffer.edit<Schema>();
     auto& schemaCascade = schema.cascades[cascadeIndex];
-    schemaCascade.reprojection = _biasMatrix * ortho * shadowViewInverse.getMatrix();
+    schemaCascade.reprojection = _biasMatrix * cascade._frustum->getProjection() * cascadeViewInverse.getMatrix();
 }
 
 void LightStage::Shadow::setKeylightCascadeBias(unsigned int cascadeIndex, float constantBias, float slopeBias) {
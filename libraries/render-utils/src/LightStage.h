@@ -64,11 +64,18 @@ public:
             float getMinDistance() const { return _minDistance; }
             float getMaxDistance() const { return _maxDistance; }
 
+            // Changes every time the frustum of a cascade caching its static casters moves
+            uint32_t getFrustumStamp() const { return _frustumStamp; }
+
         private:
 
             std::shared_ptr<ViewFrustum> _frustum;
+            std::shared_ptr<ViewFrustum> _stableFrustum;
             float _minDistance;
             float _maxDistance;
+            uint32_t _frustumStamp { 0 };
+
+            void stabilizeFrustum();
 
             float computeFarDistance(const ViewFrustum& viewFrustum, const Transform& shadowViewInverse,
                                      float left, float right, float bottom, float top, float viewMaxShadowDistance) const;
@@ -93,6 +100,11 @@ public:
         float getMaxDistance() const { return _maxDistance; }
         void setMaxDistance(float value);
 
+        // The cascades of a shadow caching its static casters only move once the view leaves them, they are fitted
+        // with a margin around the view so that they can be kept for a while
+        void setCachingStaticCasters(bool isCaching);
+        bool isCachingStaticCasters() const { return _isCachingStaticCasters; }
+
         const graphics::LightPointer& getLight() const { return _light; }
 
         gpu::TexturePointer map;
@@ -111,6 +123,7 @@ public:
 
         graphics::LightPointer _light;
         float _maxDistance{ 0.0f };
+        bool _isCachingStaticCasters{ false };
         Cascades _cascades;
 
         UniformBufferView _schemaBuffer = nullptr;
@@ -27,6 +27,16 @@ static const QString ENABLE_MATERIAL_PROCEDURAL_SHADERS_STRING { "HIFI_ENABLE_MA
 static bool ENABLE_MATERIAL_PROCEDURAL_SHADERS = QProcessEnvironment::systemEnvironment().contains(ENABLE_MATERIAL_PROCEDURAL_SHADERS_STRING);
 
 bool MeshPartPayload::enableMaterialProceduralShaders = false;
+bool ModelMeshPartPayload::enableIndirectDraws = true;
+bool ModelMeshPartPayload::enableLODs = true;
+
+// the width of the part, as a fraction of the width of the view, under which each level of detail is drawn
+static const std::vector<float> LOD_SCREEN_SIZES { 0.2f, 0.07f };
+
+// a part only goes back to a more detailed level once it is this much larger than where it left it
+static const float LOD_HYSTERESIS = 1.15f;
+
+static const uint8_t INDIRECT_COMMAND_BUFFER = 0;
 
 using namespace render;
 
@@ -52,6 +62,13 @@ template <> const ShapeKey shapeGetShapeKey(const MeshPartPayload::Pointer& payl
     return ShapeKey::Builder::invalid();
 }
 
+template <> uint64_t shapeGetMaterialSortKey(const MeshPartPayload::Pointer& payload) {
+    if (payload) {
+        return payload->getMaterialSortKey();
+    }
+    return 0;
+}
+
 template <> void payloadRender(const MeshPartPayload::Pointer& payload, RenderArgs* args) {
     return payload->render(args);
 }
@@ -70,6 +87,12 @@ void MeshPartPayload::updateMeshPart(const std::shared_ptr<const graphics::Mesh>
         auto vertexFormat = _drawMesh->getVertexFormat();
         _hasColorAttrib = vertexFormat->hasAttribute(gpu::Stream::COLOR);
         _drawPart = _drawMesh->getPartBuffer().get<graphics::Mesh::Part>(partIndex);
+        _lodDrawParts.clear();
+        for (const auto& lodPartBuffer : _drawMesh->getLODPartBuffers()) {
+            if ((size_t)partIndex < lodPartBuffer.getNumElements()) {
+                _lodDrawParts.push_back(lodPartBuffer.get<graphics::Mesh::Part>(partIndex));
+            }
+        }
         _localBound = _drawMesh->evalPartBound(partIndex);
     }
 }
@@ -117,6 +140,11 @@ Item::Bound MeshPartPayload::getBound() const {
     return _worldBound;
 }
 
+// the top material decides the textures and the schema bound for the draw
+uint64_t MeshPartPayload::getMaterialSortKey() const {
+    return _drawMaterials.empty() ? 0 : (uint64_t)(uintptr_t)_drawMaterials.top().material.get();
+}
+
 ShapeKey MeshPartPayload::getShapeKey() const {
     ShapeKey::Builder builder;
     graphics::MaterialPointer material = _drawMaterials.empty() ? nullptr : _drawMaterials.top().material;
@@ -145,12 +173,13 @@ ShapeKey MeshPartPayload::getShapeKey() const {
     return builder.build();
 }
 
-void MeshPartPayload::drawCall(gpu::Batch& batch) const {
-    batch.drawIndexed(gpu::TRIANGLES, _drawPart._numIndices, _drawPart._startIndex);
+void MeshPartPayload::drawCall(gpu::Batch& batch, const graphics::Mesh::Part& drawPart) const {
+    batch.drawIndexed(gpu::TRIANGLES, drawPart._numIndices, drawPart._startIndex);
 }
 
 void MeshPartPayload::bindMesh(gpu::Batch& batch) {
-    batch.setIndexBuffer(gpu::UINT32, (_drawMesh->getIndexBuffer()._buffer), 0);
+    const auto& indexBuffer = _drawMesh->getIndexBuffer();
+    batch.setIndexBuffer(gpu::UINT32, indexBuffer._buffer, indexBuffer._offset);
 
     batch.setInputFormat((_drawMesh->getVertexFormat()));
 
@@ -225,6 +254,13 @@ template <> const ShapeKey shapeGetShapeKey(const ModelMeshPartPayload::Pointer&
     return ShapeKey::Builder::invalid();
 }
 
+template <> uint64_t shapeGetMaterialSortKey(const ModelMeshPartPayload::Pointer& payload) {
+    if (payload) {
+        return payload->getMaterialSortKey();
+    }
+    return 0;
+}
+
 template <> void payloadRender(const ModelMeshPartPayload::Pointer& payload, RenderArgs* args) {
     return payload->render(args);
 }
@@ -297,44 +333,21 @@ void ModelMeshPartPayload::notifyLocationChanged() {
 
 }
 
-void ModelMeshPartPayload::updateClusterBuffer(const std::vector<glm::mat4>& clusterMatrices) {
-
-    // reset cluster buffer if we change the cluster buffer type
-    if (_clusterBufferType != ClusterBufferType::Matrices) {
-        _clusterBuffer.reset();
-    }
-    _clusterBufferType = ClusterBufferType::Matrices;
-
-    // Once computed the cluster matrices, update the buffer(s)
-    if (clusterMatrices.size() > 1) {
-        if (!_clusterBuffer) {
-            _clusterBuffer = std::make_shared<gpu::Buffer>(clusterMatrices.size() * sizeof(glm::mat4),
-                (const gpu::Byte*) clusterMatrices.data());
-        } else {
-            _clusterBuffer->setSubData(0, clusterMatrices.size() * sizeof(glm::mat4),
-                (const gpu::Byte*) clusterMatrices.data());
-        }
-    }
-}
-
-void ModelMeshPartPayload::updateClusterBuffer(const std::vector<Model::TransformDualQuaternion>& clusterDualQuaternions) {
-
-    // reset cluster buffer if we change the cluster buffer type
-    if (_clusterBufferType != ClusterBufferType::DualQuaternions) {
-        _clusterBuffer.reset();
+void ModelMeshPartPayload::updateRenderItem(const Model::RenderItemsUpdate& update) {
+    const glm::mat4& rootFromJointTransform = update.rootFromJointTransforms[_shapeID];
+    bool isSkinned = _deformerIndex != hfm::UNDEFINED_KEY;
+    if (isSkinned) {
+        _clusterBuffers = update.clusterBuffers;
+        _clusterFrame = update.clusterFrame;
+        updateTransform(update.modelTransform);
+        updateTransformAndBound(update.modelTransform.worldTransform(rootFromJointTransform));
+    } else {
+        updateTransform(update.modelTransform.worldTransform(rootFromJointTransform));
     }
-    _clusterBufferType = ClusterBufferType::DualQuaternions;
 
-    // Once computed the cluster matrices, update the buffer(s)
-    if (clusterDualQuaternions.size() > 1) {
-        if (!_clusterBuffer) {
-            _clusterBuffer = std::make_shared<gpu::Buffer>(clusterDualQuaternions.size() * sizeof(Model::TransformDualQuaternion),
-                (const gpu::Byte*) clusterDualQuaternions.data());
-        } else {
-            _clusterBuffer->setSubData(0, clusterDualQuaternions.size() * sizeof(Model::TransformDualQuaternion),
-                (const gpu::Byte*) clusterDualQuaternions.data());
-        }
-    }
+    setCauterized(update.cauterized);
+    updateKey(update.renderItemKeyGlobalFlags);
+    setShapeKey(update.invalidateShapeKeys[_shapeID], update.primitiveMode, isSkinned && update.useDualQuaternionSkinning);
 }
 
 // Note that this method is called for models but not for shapes
@@ -419,7 +432,8 @@ ShapeKey ModelMeshPartPayload::getShapeKey() const {
 }
 
 void ModelMeshPartPayload::bindMesh(gpu::Batch& batch) {
-    batch.setIndexBuffer(gpu::UINT32, (_drawMesh->getIndexBuffer()._buffer), 0);
+    const auto& indexBuffer = _drawMesh->getIndexBuffer();
+    batch.setIndexBuffer(gpu::UINT32, indexBuffer._buffer, indexBuffer._offset);
     batch.setInputFormat((_drawMesh->getVertexFormat()));
     if (_meshBlendshapeBuffer) {
         batch.setResourceBuffer(0, _meshBlendshapeBuffer);
@@ -428,8 +442,11 @@ void ModelMeshPartPayload::bindMesh(gpu::Batch& batch) {
 }
 
 void ModelMeshPartPayload::bindTransform(gpu::Batch& batch, RenderArgs::RenderMode renderMode) const {
-    if (_clusterBuffer) {
-        batch.setUniformBuffer(graphics::slot::buffer::Skinning, _clusterBuffer);
+    if (_clusterBuffers) {
+        const auto& clusterBuffer = _clusterBuffers->getBuffer(_clusterFrame, _deformerIndex);
+        if (clusterBuffer) {
+            batch.setUniformBuffer(graphics::slot::buffer::Skinning, clusterBuffer);
+        }
     }
     batch.setModelTransform(_worldFromLocalTransform);
 }
@@ -441,6 +458,17 @@ void ModelMeshPartPayload::render(RenderArgs* args) {
         return;
     }
 
+    if (args->_renderMode == RenderArgs::RenderMode::DEFAULT_RENDER_MODE) {
+        reportTextureFootprints(args);
+    }
+
+    const graphics::Mesh::Part& drawPart = selectDrawPart(args);
+
+    if (canDrawIndirect(args)) {
+        drawIndirect(args, drawPart);
+        return;
+    }
+
     gpu::Batch& batch = *(args->_batch);
 
     bindTransform(batch, args->_renderMode);
@@ -476,11 +504,126 @@ void ModelMeshPartPayload::render(RenderArgs* args) {
     // Draw!
     {
         PerformanceTimer perfTimer("batch.drawIndexed()");
-        drawCall(batch);
+        drawCall(batch, drawPart);
     }
 
     const int INDICES_PER_TRIANGLE = 3;
-    args->_details._trianglesRendered += _drawPart._numIndices / INDICES_PER_TRIANGLE;
+    args->_details._trianglesRendered += drawPart._numIndices / INDICES_PER_TRIANGLE;
+}
+
+const graphics::Mesh::Part& ModelMeshPartPayload::selectDrawPart(RenderArgs* args) {
+    if (!enableLODs || _lodDrawParts.empty()) {
+        _lod = 0;
+        return _drawPart;
+    }
+
+    if (args->_renderMode == RenderArgs::RenderMode::DEFAULT_RENDER_MODE) {
+        float screenSize = computeScreenPixels(args) / std::max((float)args->_viewport.w, 1.0f);
+        int lod = 0;
+        int numLODs = (int)std::min(_lodDrawParts.size(), LOD_SCREEN_SIZES.size());
+        while (lod < numLODs) {
+            float threshold = LOD_SCREEN_SIZES[lod];
+            if (lod < _lod) {
+                threshold /= LOD_HYSTERESIS;
+            }
+            if (screenSize >= threshold) {
+                break;
+            }
+            lod++;
+        }
+        _lod = lod;
+    }
+    return _lod == 0 ? _drawPart : _lodDrawParts[std::min(_lod, (int)_lodDrawParts.size()) - 1];
+}
+
+bool ModelMeshPartPayload::canDrawIndirect(RenderArgs* args) const {
+    // The draws are deferred to the end of the batch, so only opaque shapes qualify. There is no per draw uniform or
+    // item setter in an indirect draw.
+    if (!enableIndirectDraws || !args->_shapePipeline || _isSkinned || _isBlendShaped ||
+            _clusterBuffers || _meshBlendshapeBuffer || _shapeKey.isTranslucent() || _shapeKey.isFaded()) {
+        return false;
+    }
+
+    // the parts of a group are drawn with the material of the first one
+    if (_drawMaterials.size() != 1 || !_drawMaterials.top().material || _drawMaterials.top().material->isProcedural()) {
+        return false;
+    }
+
+    return args->_context->getBackend()->supportsMultiDrawIndirect();
+}
+
+void ModelMeshPartPayload::reportTextureFootprints(RenderArgs* args) const {
+    if (_drawMaterials.empty() || !_drawMaterials.top().material) {
+        return;
+    }
+    const auto& material = _drawMaterials.top().material;
+
+    float pixels = computeScreenPixels(args);
+
+    // a texture repeated over the part covers fewer pixels with each repeat, one stretched over it more
+    const float MIN_UV_SCALE = 0.0625f;
+    glm::mat4 texCoordTransform = material->getTexCoordTransform(0);
+    float uvScale = std::max(glm::length(glm::vec3(texCoordTransform[0])), glm::length(glm::vec3(texCoordTransform[1])));
+    float texels = pixels / std::max(uvScale, MIN_UV_SCALE);
+
+    for (const auto& textureMap : material->getTextureMaps()) {
+        if (textureMap.second) {
+            auto texture = textureMap.second->getTextureView()._texture;
+            if (texture) {
+                texture->reportScreenFootprint(texels);
+            }
+        }
+    }
+}
+
+float ModelMeshPartPayload::computeScreenPixels(RenderArgs* args) const {
+    const float MIN_DISTANCE = 0.01f;
+    const ViewFrustum& viewFrustum = args->getViewFrustum();
+    float radius = 0.5f * glm::length(_worldBound.getScale());
+    float distance = glm::distance(_worldBound.calcCenter(), viewFrustum.getPosition());
+    float halfViewTan = tanf(0.5f * glm::radians(viewFrustum.getFieldOfView()));
+    return (float)args->_viewport.w * radius / (std::max(distance - radius, MIN_DISTANCE) * halfViewTan);
+}
+
+void ModelMeshPartPayload::drawIndirect(RenderArgs* args, const graphics::Mesh::Part& drawPart) {
+    gpu::Batch& batch = *(args->_batch);
+    auto& pipeline = args->_shapePipeline;
+    const auto& material = _drawMaterials.top().material;
+
+    std::string instanceName = "static_mesh_parts_" + std::to_string(std::hash<const graphics::Mesh*>()(_drawMesh.get())) +
+        "_" + std::to_string(std::hash<render::ShapePipelinePointer>()(pipeline)) +
+        "_" + std::to_string(std::hash<graphics::MaterialPointer>()(material));
+
+    // The command of the nth part starts at instance n, which picks its draw call info, and its transform, from the
+    // instanced draw call info attribute of the named call. In stereo both eyes are drawn by the one command: the
+    // instances are doubled like those of the other draws and the divisor of the draw call info gives them the same
+    // one, the shader picks the eye from the instance.
+    bool isStereo = args->isStereo() && batch.isStereoEnabled();
+    gpu::BufferPointer commandBuffer = batch.getNamedBuffer(instanceName, INDIRECT_COMMAND_BUFFER);
+    gpu::Batch::DrawIndexedIndirectCommand command;
+    command._count = (gpu::uint32)drawPart._numIndices;
+    command._instanceCount = isStereo ? 2 : 1;
+    command._firstIndex = (gpu::uint32)drawPart._startIndex;
+    command._baseInstance = (gpu::uint32)(commandBuffer->getSize() / sizeof(command));
+    commandBuffer->append(command);
+
+    batch.setModelTransform(_worldFromLocalTransform);
+    auto renderMode = args->_renderMode;
+    bool enableTexturing = args->_enableTexturing;
+    batch.setupNamedCalls(instanceName, [this, args, pipeline, renderMode, enableTexturing](gpu::Batch& batch,
+                                                                                             gpu::Batch::NamedBatchData& data) {
+        batch.setPipeline(pipeline->pipeline);
+        pipeline->prepare(batch, args);
+
+        RenderPipelines::bindMaterials(_drawMaterials, batch, renderMode, enableTexturing);
+        bindMesh(batch);
+
+        batch.setIndirectBuffer(data.buffers[INDIRECT_COMMAND_BUFFER], 0, sizeof(gpu::Batch::DrawIndexedIndirectCommand));
+        batch.multiDrawIndexedIndirect((gpu::uint32)data.count(), gpu::TRIANGLES);
+    });
+
+    const int INDICES_PER_TRIANGLE = 3;
+    args->_details._trianglesRendered += drawPart._numIndices / INDICES_PER_TRIANGLE;
 }
 
 void ModelMeshPartPayload::setBlendshapeBuffer(const std::unordered_map<int, gpu::BufferPointer>& blendshapeBuffers, const QVector<int>& blendedMeshSizes) {
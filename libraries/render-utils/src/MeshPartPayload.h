@@ -45,10 +45,12 @@ public:
     virtual render::ItemKey getKey() const;
     virtual render::Item::Bound getBound() const;
     virtual render::ShapeKey getShapeKey() const; // shape interface
+    uint64_t getMaterialSortKey() const;
     virtual void render(RenderArgs* args);
 
     // ModelMeshPartPayload functions to perform render
-    void drawCall(gpu::Batch& batch) const;
+    void drawCall(gpu::Batch& batch) const { drawCall(batch, _drawPart); }
+    void drawCall(gpu::Batch& batch, const graphics::Mesh::Part& drawPart) const;
     virtual void bindMesh(gpu::Batch& batch);
     virtual void bindTransform(gpu::Batch& batch, RenderArgs::RenderMode renderMode) const;
 
@@ -63,6 +65,7 @@ public:
 
     graphics::MultiMaterial _drawMaterials;
     graphics::Mesh::Part _drawPart;
+    std::vector<graphics::Mesh::Part> _lodDrawParts;
 
     size_t getVerticesCount() const { return _drawMesh ? _drawMesh->getNumVertices() : 0; }
     size_t getMaterialTextureSize() { return _drawMaterials.getTextureSize(); }
@@ -83,6 +86,7 @@ namespace render {
     template <> const ItemKey payloadGetKey(const MeshPartPayload::Pointer& payload);
     template <> const Item::Bound payloadGetBound(const MeshPartPayload::Pointer& payload);
     template <> const ShapeKey shapeGetShapeKey(const MeshPartPayload::Pointer& payload);
+    template <> uint64_t shapeGetMaterialSortKey(const MeshPartPayload::Pointer& payload);
     template <> void payloadRender(const MeshPartPayload::Pointer& payload, RenderArgs* args);
 }
 
@@ -97,11 +101,8 @@ public:
 
     void updateKey(const render::ItemKey& key) override;
 
-    // matrix palette skinning
-    void updateClusterBuffer(const std::vector<glm::mat4>& clusterMatrices);
-
-    // dual quaternion skinning
-    void updateClusterBuffer(const std::vector<Model::TransformDualQuaternion>& clusterDualQuaternions);
+    // the transforms, skinning and keys of a frame, from the update the model shares with all its parts
+    virtual void updateRenderItem(const Model::RenderItemsUpdate& update);
 
     // Render Item interface
     render::ShapeKey getShapeKey() const override; // shape interface
@@ -114,10 +115,15 @@ public:
     void bindMesh(gpu::Batch& batch) override;
     void bindTransform(gpu::Batch& batch, RenderArgs::RenderMode renderMode) const override;
 
-    gpu::BufferPointer _clusterBuffer;
+    // static parts that share a mesh, a pipeline and a material are drawn with one multiDrawIndexedIndirect() per batch
+    static bool enableIndirectDraws;
+
+    // the parts that are small on screen are drawn with the simplified levels of detail of their mesh
+    static bool enableLODs;
 
-    enum class ClusterBufferType { Matrices, DualQuaternions };
-    ClusterBufferType _clusterBufferType { ClusterBufferType::Matrices };
+    // the buffers of the model, read at the frame of the last update
+    Model::ClusterBuffersPointer _clusterBuffers;
+    uint32_t _clusterFrame { 0 };
 
     int _meshIndex;
     int _shapeID;
@@ -132,10 +138,21 @@ public:
 private:
     void initCache(const ModelPointer& model);
 
+    bool canDrawIndirect(RenderArgs* args) const;
+    void drawIndirect(RenderArgs* args, const graphics::Mesh::Part& drawPart);
+    void reportTextureFootprints(RenderArgs* args) const;
+
+    // the pixels across the bounding sphere of the part, as seen from the view
+    float computeScreenPixels(RenderArgs* args) const;
+
+    // picks the level of detail in the main view, the other views draw the one it picked last
+    const graphics::Mesh::Part& selectDrawPart(RenderArgs* args);
+
     gpu::BufferPointer _meshBlendshapeBuffer;
     int _meshNumVertices;
     render::ShapeKey _shapeKey { render::ShapeKey::Builder::invalid() };
     bool _cauterized { false };
+    int _lod { 0 };
 
 };
 
@@ -143,6 +160,7 @@ namespace render {
     template <> const ItemKey payloadGetKey(const ModelMeshPartPayload::Pointer& payload);
     template <> const Item::Bound payloadGetBound(const ModelMeshPartPayload::Pointer& payload);
     template <> const ShapeKey shapeGetShapeKey(const ModelMeshPartPayload::Pointer& payload);
+    template <> uint64_t shapeGetMaterialSortKey(const ModelMeshPartPayload::Pointer& payload);
     template <> void payloadRender(const ModelMeshPartPayload::Pointer& payload, RenderArgs* args);
 }
 
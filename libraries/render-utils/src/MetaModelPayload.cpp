@@ -12,7 +12,8 @@
 #include "AbstractViewStateInterface.h"
 #include "MeshPartPayload.h"
 
-void MetaModelPayload::setBlendedVertices(int blendNumber, const QVector<BlendshapeOffset>& blendshapeOffsets, const QVector<int>& blendedMeshSizes, const render::ItemIDs& subRenderItems) {
+void MetaModelPayload::setBlendedVertices(int blendNumber, const QVector<BlendshapeOffset>& blendshapeOffsets, const QVector<int>& blendedMeshSizes,
+                                          const QVector<int>& blendedMeshRanges, const render::ItemIDs& subRenderItems) {
     PROFILE_RANGE(render, __FUNCTION__);
     if (blendNumber < _appliedBlendNumber) {
         return;
@@ -34,15 +35,22 @@ void MetaModelPayload::setBlendedVertices(int blendNumber, const QVector<Blendsh
             continue;
         }
 
-        const auto& buffer = _blendshapeBuffers.find(i);
+        // the offsets out of the blended range are zero, they are only set when the buffer is made
+        auto& buffer = _blendshapeBuffers[i];
         const auto blendShapeBufferSize = numVertices * sizeof(BlendshapeOffset);
-        if (buffer == _blendshapeBuffers.end()) {
-            _blendshapeBuffers[i] = std::make_shared<gpu::Buffer>(blendShapeBufferSize, (gpu::Byte*) blendshapeOffsets.constData() + index * sizeof(BlendshapeOffset), blendShapeBufferSize);
-        } else {
-            buffer->second->setData(blendShapeBufferSize, (gpu::Byte*) blendshapeOffsets.constData() + index * sizeof(BlendshapeOffset));
+        if (!buffer || buffer->getSize() != blendShapeBufferSize) {
+            std::vector<BlendshapeOffset> zeros(numVertices, BlendshapeOffset { glm::uvec4(0) });
+            buffer = std::make_shared<gpu::Buffer>(blendShapeBufferSize, (const gpu::Byte*)zeros.data(), blendShapeBufferSize);
         }
 
-        index += numVertices;
+        int firstVertex = blendedMeshRanges.at(2 * i);
+        int numBlendedVertices = blendedMeshRanges.at(2 * i + 1);
+        if (numBlendedVertices > 0) {
+            buffer->setSubData(firstVertex * sizeof(BlendshapeOffset), numBlendedVertices * sizeof(BlendshapeOffset),
+                               (const gpu::Byte*)(blendshapeOffsets.constData() + index));
+        }
+
+        index += numBlendedVertices;
     }
 
     render::Transaction transaction;
@@ -204,6 +204,10 @@ void Model::updateRenderItems() {
     }
 
     _needsUpdateClusterMatrices = true;
+    if (_renderItemsNeedUpdate) {
+        // something other than the pose changed, the render items are updated even if the model didn't re-pose
+        _renderItemsUpdate.reset();
+    }
     _renderItemsNeedUpdate = false;
 
     // queue up this work for later processing, at the end of update and just before rendering.
@@ -221,59 +225,135 @@ void Model::updateRenderItems() {
         // lazy update of cluster matrices used for rendering.
         // We need to update them here so we can correctly update the bounding box.
         self->updateClusterMatrices();
+        self->postRenderItemsUpdate();
+    });
+}
 
-        Transform modelTransform = self->getTransform();
-        modelTransform.setScale(glm::vec3(1.0f));
+void Model::postRenderItemsUpdate() {
+    auto update = std::make_shared<RenderItemsUpdate>();
+    update->modelTransform = getTransform();
+    update->modelTransform.setScale(glm::vec3(1.0f));
+    update->primitiveMode = getPrimitiveMode();
+    update->renderItemKeyGlobalFlags = getRenderItemKeyGlobalFlags();
+    update->useDualQuaternionSkinning = getUseDualQuaternionSkinning();
+    update->cauterized = isCauterized();
 
-        PrimitiveMode primitiveMode = self->getPrimitiveMode();
-        auto renderItemKeyGlobalFlags = self->getRenderItemKeyGlobalFlags();
-        bool cauterized = self->isCauterized();
+    update->rootFromJointTransforms.reserve(_shapeStates.size());
+    update->invalidateShapeKeys.reserve(_shapeStates.size());
+    for (const auto& shapeState : _shapeStates) {
+        update->rootFromJointTransforms.push_back(shapeState._rootFromJointTransform);
+        update->invalidateShapeKeys.push_back(shouldInvalidatePayloadShapeKey(shapeState._meshIndex));
+    }
 
-        render::Transaction transaction;
-        for (int i = 0; i < (int) self->_modelMeshRenderItemIDs.size(); i++) {
-            auto itemID = self->_modelMeshRenderItemIDs[i];
+    updateClusterBuffers(*update);
 
-            const auto& shapeState = self->getShapeState(i);
+    // the buffers only make a new frame current when the clusters moved, so this is a model that didn't re-pose
+    if (_renderItemsUpdate && *_renderItemsUpdate == *update) {
+        return;
+    }
+    _renderItemsUpdate = update;
 
-            auto skinDeformerIndex = shapeState._skinDeformerIndex;
+    // one functor for all the parts, they find what is theirs in the update by their shape and deformer
+    RenderItemsUpdatePointer sharedUpdate = update;
+    auto functor = std::make_shared<render::UpdateFunctor<ModelMeshPartPayload>>([sharedUpdate](ModelMeshPartPayload& data) {
+        data.updateRenderItem(*sharedUpdate);
+    });
 
-            bool invalidatePayloadShapeKey = self->shouldInvalidatePayloadShapeKey(shapeState._meshIndex);
+    render::Transaction transaction;
+    for (auto itemID : _modelMeshRenderItemIDs) {
+        transaction.updateItem(itemID, functor);
+    }
+    AbstractViewStateInterface::instance()->getMain3DScene()->enqueueTransaction(transaction);
+}
 
-            if (skinDeformerIndex != hfm::UNDEFINED_KEY) {
-                const auto& meshState = self->getMeshState(skinDeformerIndex);
-                bool useDualQuaternionSkinning = self->getUseDualQuaternionSkinning();
+void Model::updateClusterBuffers(RenderItemsUpdate& update) {
+    ClusterBuffers::update(_clusterBuffers, _meshStates, update.useDualQuaternionSkinning);
+    update.clusterBuffers = _clusterBuffers;
+    update.clusterFrame = _clusterBuffers->getFrame();
+}
 
-                transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, shapeState, meshState, useDualQuaternionSkinning,
-                                                                      invalidatePayloadShapeKey, primitiveMode, renderItemKeyGlobalFlags, cauterized](ModelMeshPartPayload& data) {
-                    if (useDualQuaternionSkinning) {
-                        data.updateClusterBuffer(meshState.clusterDualQuaternions);
-                    } else {
-                        data.updateClusterBuffer(meshState.clusterMatrices);
-                    }
+bool Model::RenderItemsUpdate::operator==(const RenderItemsUpdate& other) const {
+    return modelTransform == other.modelTransform && rootFromJointTransforms == other.rootFromJointTransforms &&
+        invalidateShapeKeys == other.invalidateShapeKeys &&
+        clusterBuffers == other.clusterBuffers && clusterFrame == other.clusterFrame &&
+        cauterizedClusterBuffers == other.cauterizedClusterBuffers && cauterizedClusterFrame == other.cauterizedClusterFrame &&
+        primitiveMode == other.primitiveMode && renderItemKeyGlobalFlags == other.renderItemKeyGlobalFlags &&
+        useDualQuaternionSkinning == other.useDualQuaternionSkinning && cauterized == other.cauterized &&
+        enableCauterization == other.enableCauterization;
+}
 
-                    Transform renderTransform = modelTransform;
-                    data.updateTransform(renderTransform);
-                    data.updateTransformAndBound(modelTransform.worldTransform(shapeState._rootFromJointTransform));
+Model::ClusterBuffers::ClusterBuffers(const std::vector<MeshState>& meshStates, bool useDualQuaternionSkinning) :
+    _useDualQuaternionSkinning(useDualQuaternionSkinning) {
+    for (auto& frameBuffers : _buffers) {
+        frameBuffers.reserve(meshStates.size());
+        for (const auto& meshState : meshStates) {
+            gpu::Size size;
+            const gpu::Byte* data = getData(meshState, size);
+            // a single cluster is drawn without skinning
+            frameBuffers.push_back(meshState.clusterMatrices.size() > 1 ? std::make_shared<gpu::Buffer>(size, data) : nullptr);
+        }
+    }
+}
 
-                    data.setCauterized(cauterized);
-                    data.updateKey(renderItemKeyGlobalFlags);
-                    data.setShapeKey(invalidatePayloadShapeKey, primitiveMode, useDualQuaternionSkinning);
-                });
-            } else {
-                transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, shapeState, invalidatePayloadShapeKey, primitiveMode, renderItemKeyGlobalFlags](ModelMeshPartPayload& data) {
-                    
-                    Transform renderTransform = modelTransform;
-                    renderTransform = modelTransform.worldTransform(shapeState._rootFromJointTransform);
-                    data.updateTransform(renderTransform);
-
-                    data.updateKey(renderItemKeyGlobalFlags);
-                    data.setShapeKey(invalidatePayloadShapeKey, primitiveMode, false);
-                }); 
-            }
+void Model::ClusterBuffers::update(ClusterBuffersPointer& buffers, const std::vector<MeshState>& meshStates,
+                                   bool useDualQuaternionSkinning) {
+    if (!buffers || !buffers->fits(meshStates, useDualQuaternionSkinning)) {
+        // the payloads that still point to the old buffers keep them alive until they are updated
+        buffers = std::make_shared<ClusterBuffers>(meshStates, useDualQuaternionSkinning);
+    } else {
+        buffers->write(meshStates);
+    }
+}
+
+bool Model::ClusterBuffers::fits(const std::vector<MeshState>& meshStates, bool useDualQuaternionSkinning) const {
+    if (useDualQuaternionSkinning != _useDualQuaternionSkinning || meshStates.size() != _buffers[_frame].size()) {
+        return false;
+    }
+    for (size_t i = 0; i < meshStates.size(); i++) {
+        gpu::Size size;
+        getData(meshStates[i], size);
+        const auto& buffer = _buffers[_frame][i];
+        if (buffer && buffer->getSize() != size) {
+            return false;
         }
+    }
+    return true;
+}
 
-        AbstractViewStateInterface::instance()->getMain3DScene()->enqueueTransaction(transaction);
-    });
+void Model::ClusterBuffers::write(const std::vector<MeshState>& meshStates) {
+    // the buffers of the current frame keep their sysmem copy, so comparing with them costs no readback
+    bool changed = false;
+    for (size_t i = 0; i < meshStates.size() && !changed; i++) {
+        const auto& buffer = _buffers[_frame][i];
+        if (buffer) {
+            gpu::Size size;
+            const gpu::Byte* data = getData(meshStates[i], size);
+            changed = memcmp(buffer->getData(), data, size) != 0;
+        }
+    }
+    if (!changed) {
+        return;
+    }
+
+    // every buffer of the other frame is written, it holds the clusters of two frames ago
+    _frame = 1 - _frame;
+    for (size_t i = 0; i < meshStates.size(); i++) {
+        const auto& buffer = _buffers[_frame][i];
+        if (buffer) {
+            gpu::Size size;
+            const gpu::Byte* data = getData(meshStates[i], size);
+            buffer->setSubData(0, size, data);
+        }
+    }
+}
+
+const gpu::Byte* Model::ClusterBuffers::getData(const MeshState& meshState, gpu::Size& size) const {
+    if (_useDualQuaternionSkinning) {
+        size = meshState.clusterDualQuaternions.size() * sizeof(TransformDualQuaternion);
+        return (const gpu::Byte*) meshState.clusterDualQuaternions.data();
+    }
+    size = meshState.clusterMatrices.size() * sizeof(glm::mat4);
+    return (const gpu::Byte*) meshState.clusterMatrices.data();
 }
 
 void Model::setRenderItemsNeedUpdate() {
@@ -1034,6 +1114,7 @@ void Model::removeFromScene(const render::ScenePointer& scene, render::Transacti
     _modelMeshRenderItems.clear();
     _modelMeshMaterialNames.clear();
     _priorityMap.clear();
+    _renderItemsUpdate.reset();
 
     _addedToScene = false;
 
@@ -1435,6 +1516,8 @@ void Model::deleteGeometry() {
     _deleteGeometryCounter++;
     _shapeStates.clear();
     _meshStates.clear();
+    _clusterBuffers.reset();
+    _renderItemsUpdate.reset();
     _rig.destroyAnimGraph();
     _blendedBlendshapeCoefficients.clear();
     _renderGeometry.reset();
@@ -1760,17 +1843,27 @@ Blender::Blender(ModelPointer model, HFMModel::ConstPointer hfmModel, int blendN
 
 void Blender::run() {
     DETAILED_PROFILE_RANGE_EX(simulation_animation, __FUNCTION__, 0xFFFF0000, 0, { { "url", _model->getURL().toString() } });
+    // Only the range between the first and the last vertex that a blendshape of a mesh moves is blended and sent,
+    // the other vertices of the mesh keep a zero offset.  That is often small part of a mesh, like the face of a body.
     int numBlendshapeOffsets = 0;  // number of offsets required for all meshes.
-    int maxBlendshapeOffsets = 0;  // number of offsets in the largest mesh.
-    int numMeshes = 0;  // number of meshes in this model.
+    int maxBlendshapeOffsets = 0;  // number of offsets in the largest range.
+    int numMeshes = _hfmModel->meshes.size();  // number of meshes in this model.
+    QVector<int> blendedMeshRanges;  // first vertex and number of vertices, for each mesh
+    blendedMeshRanges.reserve(2 * numMeshes);
     for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
-        numMeshes++;
-        if (meshIter->blendshapes.isEmpty()) {
-            continue;
+        int firstVertex = meshIter->vertices.size();
+        int lastVertex = -1;
+        for (const auto& blendshape : meshIter->blendshapes) {
+            for (int index : blendshape.indices) {
+                firstVertex = std::min(firstVertex, index);
+                lastVertex = std::max(lastVertex, index);
+            }
         }
-        int numVertsInMesh = meshIter->vertices.size();
-        numBlendshapeOffsets += numVertsInMesh;
-        maxBlendshapeOffsets = std::max(maxBlendshapeOffsets, numVertsInMesh);
+        int numBlendedVertices = std::max(lastVertex - firstVertex + 1, 0);
+        blendedMeshRanges.push_back(numBlendedVertices > 0 ? firstVertex : 0);
+        blendedMeshRanges.push_back(numBlendedVertices);
+        numBlendshapeOffsets += numBlendedVertices;
+        maxBlendshapeOffsets = std::max(maxBlendshapeOffsets, numBlendedVertices);
     }
 
     // allocate the required sizes
@@ -1784,16 +1877,18 @@ void Blender::run() {
     unpackedBlendshapeOffsets.resize(maxBlendshapeOffsets);    // reuse for all meshes
 
     int offset = 0;
-    for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter) {
+    int meshIndex = 0;
+    for (auto meshIter = _hfmModel->meshes.cbegin(); meshIter != _hfmModel->meshes.cend(); ++meshIter, ++meshIndex) {
         if (meshIter->blendshapes.isEmpty()) {
             blendedMeshSizes.push_back(0);
             continue;
         }
-        int numVertsInMesh = meshIter->vertices.size();
-        blendedMeshSizes.push_back(numVertsInMesh);
+        blendedMeshSizes.push_back(meshIter->vertices.size());
+        int firstVertex = blendedMeshRanges.at(2 * meshIndex);
+        int numBlendedVertices = blendedMeshRanges.at(2 * meshIndex + 1);
 
         // initialize offsets to zero
-        memset(unpackedBlendshapeOffsets.data(), 0, numVertsInMesh * sizeof(BlendshapeOffsetUnpacked));
+        memset(unpackedBlendshapeOffsets.data(), 0, numBlendedVertices * sizeof(BlendshapeOffsetUnpacked));
 
         // for each blendshape in this mesh, accumulate the offsets into unpackedBlendshapeOffsets.
         const float NORMAL_COEFFICIENT_SCALE = 0.01f;
@@ -1807,7 +1902,7 @@ void Blender::run() {
             float normalCoefficient = vertexCoefficient * NORMAL_COEFFICIENT_SCALE;
             const HFMBlendshape& blendshape = meshIter->blendshapes.at(i);
             for (int j = 0; j < blendshape.indices.size(); ++j) {
-                int index = blendshape.indices.at(j);
+                int index = blendshape.indices.at(j) - firstVertex;
 
                 auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[index];
                 currentBlendshapeOffset.positionOffset += blendshape.vertices.at(j) * vertexCoefficient;
@@ -1821,9 +1916,9 @@ void Blender::run() {
         // convert unpackedBlendshapeOffsets into packedBlendshapeOffsets for the gpu.
         auto unpacked = unpackedBlendshapeOffsets.data();
         auto packed = packedBlendshapeOffsets.data() + offset;
-        packBlendshapeOffsets(unpacked, packed, numVertsInMesh);
+        packBlendshapeOffsets(unpacked, packed, numBlendedVertices);
 
-        offset += numVertsInMesh;
+        offset += numBlendedVertices;
     }
     Q_ASSERT(offset == numBlendshapeOffsets);
 
@@ -1831,7 +1926,8 @@ void Blender::run() {
     QMetaObject::invokeMethod(DependencyManager::get<ModelBlender>().data(), "setBlendedVertices",
                               Q_ARG(ModelPointer, _model), Q_ARG(int, _blendNumber),
                               Q_ARG(QVector<BlendshapeOffset>, packedBlendshapeOffsets),
-                              Q_ARG(QVector<int>, blendedMeshSizes));
+                              Q_ARG(QVector<int>, blendedMeshSizes),
+                              Q_ARG(QVector<int>, blendedMeshRanges));
 }
 
 bool Model::maybeStartBlender() {
@@ -1871,11 +1967,12 @@ void ModelBlender::noteRequiresBlend(ModelPointer model) {
     }
 }
 
-void ModelBlender::setBlendedVertices(ModelPointer model, int blendNumber, QVector<BlendshapeOffset> blendshapeOffsets, QVector<int> blendedMeshSizes) {
+void ModelBlender::setBlendedVertices(ModelPointer model, int blendNumber, QVector<BlendshapeOffset> blendshapeOffsets, QVector<int> blendedMeshSizes,
+                                      QVector<int> blendedMeshRanges) {
     if (model) {
         auto blendshapeOperator = model->getModelBlendshapeOperator();
         if (blendshapeOperator) {
-            blendshapeOperator(blendNumber, blendshapeOffsets, blendedMeshSizes, model->fetchRenderItemIDs());
+            blendshapeOperator(blendNumber, blendshapeOffsets, blendedMeshSizes, blendedMeshRanges, model->fetchRenderItemIDs());
         }
     }
 
@@ -17,6 +17,7 @@
 #include <QUrl>
 #include <QMutex>
 
+#include <array>
 #include <unordered_map>
 #include <unordered_set>
 #include <functional>
@@ -87,7 +88,9 @@ struct BlendshapeOffsetUnpacked {
 };
 
 using BlendshapeOffset = BlendshapeOffsetPacked;
-using BlendShapeOperator = std::function<void(int, const QVector<BlendshapeOffset>&, const QVector<int>&, const render::ItemIDs&)>;
+// The blendshape offsets, the number of vertices of each mesh, and the first vertex and number of vertices of the range
+// of each mesh that the offsets are for.  The offsets out of that range are zero.
+using BlendShapeOperator = std::function<void(int, const QVector<BlendshapeOffset>&, const QVector<int>&, const QVector<int>&, const render::ItemIDs&)>;
 
 /// A generic 3D model displaying geometry loaded from a URL.
 class Model : public QObject, public std::enable_shared_from_this<Model>, public scriptable::ModelProvider {
@@ -354,6 +357,57 @@ public:
     };
     const MeshState& getMeshState(int index) { return _meshStates.at(index); }
 
+    // The cluster data of the skin deformers, in a buffer per deformer that every part skinned by it reads.  There are
+    // two frames of buffers: the model writes one frame while the other may still be drawn.
+    class ClusterBuffers {
+    public:
+        ClusterBuffers(const std::vector<MeshState>& meshStates, bool useDualQuaternionSkinning);
+
+        // writes the cluster data to the buffers, and makes a new frame current only if the data changed.  The
+        // buffers are replaced when they don't fit the mesh states anymore.
+        static void update(std::shared_ptr<ClusterBuffers>& buffers, const std::vector<MeshState>& meshStates,
+                           bool useDualQuaternionSkinning);
+
+        uint32_t getFrame() const { return _frame; }
+
+        // null when the deformer has a single cluster
+        const gpu::BufferPointer& getBuffer(uint32_t frame, uint32_t skinDeformerIndex) const { return _buffers[frame][skinDeformerIndex]; }
+
+    private:
+        bool fits(const std::vector<MeshState>& meshStates, bool useDualQuaternionSkinning) const;
+        void write(const std::vector<MeshState>& meshStates);
+
+        const gpu::Byte* getData(const MeshState& meshState, gpu::Size& size) const;
+
+        std::array<std::vector<gpu::BufferPointer>, 2> _buffers;
+        uint32_t _frame { 0 };
+        bool _useDualQuaternionSkinning;
+    };
+    using ClusterBuffersPointer = std::shared_ptr<ClusterBuffers>;
+
+    // What the parts of the model need to be drawn in a frame, one of these is shared by the updates of all the parts
+    class RenderItemsUpdate {
+    public:
+        bool operator==(const RenderItemsUpdate& other) const;
+
+        Transform modelTransform;
+        // per shape
+        std::vector<glm::mat4> rootFromJointTransforms;
+        std::vector<bool> invalidateShapeKeys;
+
+        ClusterBuffersPointer clusterBuffers;
+        uint32_t clusterFrame { 0 };
+        ClusterBuffersPointer cauterizedClusterBuffers;
+        uint32_t cauterizedClusterFrame { 0 };
+
+        PrimitiveMode primitiveMode { PrimitiveMode::SOLID };
+        render::ItemKey renderItemKeyGlobalFlags;
+        bool useDualQuaternionSkinning { false };
+        bool cauterized { false };
+        bool enableCauterization { false };
+    };
+    using RenderItemsUpdatePointer = std::shared_ptr<const RenderItemsUpdate>;
+
     uint32_t getGeometryCounter() const { return _deleteGeometryCounter; }
 
     BlendShapeOperator getModelBlendshapeOperator() const { return _modelBlendshapeOperator; }
@@ -435,6 +489,12 @@ protected:
     void updateShapeStatesFromRig();
 
     std::vector<MeshState> _meshStates;
+    ClusterBuffersPointer _clusterBuffers;
+
+    // what the render items were last updated with, the models that didn't re-pose since don't update them
+    RenderItemsUpdatePointer _renderItemsUpdate;
+    void postRenderItemsUpdate();
+    virtual void updateClusterBuffers(RenderItemsUpdate& update);
 
     virtual void initJointStates();
 
@@ -545,7 +605,8 @@ public:
     bool shouldComputeBlendshapes() { return _computeBlendshapes; }
 
 public slots:
-    void setBlendedVertices(ModelPointer model, int blendNumber, QVector<BlendshapeOffset> blendshapeOffsets, QVector<int> blendedMeshSizes);
+    void setBlendedVertices(ModelPointer model, int blendNumber, QVector<BlendshapeOffset> blendshapeOffsets, QVector<int> blendedMeshSizes,
+                            QVector<int> blendedMeshRanges);
     void setComputeBlendshapes(bool computeBlendshapes) { _computeBlendshapes = computeBlendshapes; }
 
 private:
@@ -40,6 +40,7 @@
 #include "DeferredLightingEffect.h"
 #include "SurfaceGeometryPass.h"
 #include "VelocityBufferPass.h"
+#include "DepthPyramidPass.h"
 #include "FramebufferCache.h"
 #include "TextureCache.h"
 #include "ZoneRenderer.h"
@@ -162,6 +163,10 @@ void RenderDeferredTask::build(JobModel& task, const render::Varying& input, ren
     const auto opaqueInputs = DrawStateSortDeferred::Inputs(opaques, lightingModel, jitter).asVarying();
     task.addJob<DrawStateSortDeferred>("DrawOpaqueDeferred", opaqueInputs, shapePlumber);
 
+    // Read the opaque depth back for the occlusion cull of the next frames
+    const auto depthPyramidInputs = BuildDepthPyramid::Inputs(deferredFramebuffer, fetchedItems[2]).asVarying();
+    task.addJob<BuildDepthPyramid>("BuildDepthPyramid", depthPyramidInputs);
+
     // Opaque all rendered
 
     // Linear Depth Pass
@@ -180,17 +185,17 @@ void RenderDeferredTask::build(JobModel& task, const render::Varying& input, ren
     // Simply update the scattering resource
     const auto scatteringResource = task.addJob<SubsurfaceScattering>("Scattering");
 
+    // Velocity, before the AO which reprojects its history with it
+    const auto velocityBufferInputs = VelocityBufferPass::Inputs(deferredFrameTransform, deferredFramebuffer).asVarying();
+    const auto velocityBufferOutputs = task.addJob<VelocityBufferPass>("VelocityBuffer", velocityBufferInputs);
+    const auto velocityBuffer = velocityBufferOutputs.getN<VelocityBufferPass::Outputs>(0);
+
     // AO job
-    const auto ambientOcclusionInputs = AmbientOcclusionEffect::Input(lightingModel, deferredFrameTransform, deferredFramebuffer, linearDepthTarget).asVarying();
+    const auto ambientOcclusionInputs = AmbientOcclusionEffect::Input(lightingModel, deferredFrameTransform, deferredFramebuffer, linearDepthTarget, velocityBuffer).asVarying();
     const auto ambientOcclusionOutputs = task.addJob<AmbientOcclusionEffect>("AmbientOcclusion", ambientOcclusionInputs);
     const auto ambientOcclusionFramebuffer = ambientOcclusionOutputs.getN<AmbientOcclusionEffect::Output>(0);
     const auto ambientOcclusionUniforms = ambientOcclusionOutputs.getN<AmbientOcclusionEffect::Output>(1);
 
-    // Velocity
-    const auto velocityBufferInputs = VelocityBufferPass::Inputs(deferredFrameTransform, deferredFramebuffer).asVarying();
-    const auto velocityBufferOutputs = task.addJob<VelocityBufferPass>("VelocityBuffer", velocityBufferInputs);
-    const auto velocityBuffer = velocityBufferOutputs.getN<VelocityBufferPass::Outputs>(0);
-
     // Light Clustering
     // Create the cluster grid of lights, cpu job for now
     const auto lightClusteringPassInputs = LightClusteringPass::Input(deferredFrameTransform, lightingModel, lightFrame, linearDepthTarget).asVarying();
@@ -228,12 +233,12 @@ void RenderDeferredTask::build(JobModel& task, const render::Varying& input, ren
 
     // Add bloom
     const auto bloomInputs = BloomEffect::Inputs(deferredFrameTransform, lightingFramebuffer, bloomFrame, lightingModel).asVarying();
-    task.addJob<BloomEffect>("Bloom", bloomInputs);
+    const auto bloomFramebuffer = task.addJob<BloomEffect>("Bloom", bloomInputs);
 
     const auto destFramebuffer = static_cast<gpu::FramebufferPointer>(nullptr);
 
     // Lighting Buffer ready for tone mapping
-    const auto toneMappingInputs = ToneMapAndResample::Input(lightingFramebuffer, destFramebuffer).asVarying();
+    const auto toneMappingInputs = ToneMapAndResample::Input(lightingFramebuffer, destFramebuffer, bloomFramebuffer).asVarying();
     const auto toneMappedBuffer = task.addJob<ToneMapAndResample>("ToneMapping", toneMappingInputs);
 
     // Debugging task is happening in the "over" layer after tone mapping and just before HUD
@@ -533,18 +538,16 @@ void DrawStateSortDeferred::run(const RenderContextPointer& renderContext, const
 
     RenderArgs* args = renderContext->args;
 
-    gpu::doInBatch("DrawStateSortDeferred::run", args->_context, [&](gpu::Batch& batch) {
-        args->_batch = &batch;
+    glm::mat4 projMat;
+    Transform viewMat;
+    args->getViewFrustum().evalProjectionMatrix(projMat);
+    args->getViewFrustum().evalViewTransform(viewMat);
 
+    auto setupBatch = [&](gpu::Batch& batch) {
         // Setup camera, projection and viewport for all items
         batch.setViewportTransform(args->_viewport);
         batch.setStateScissorRect(args->_viewport);
 
-        glm::mat4 projMat;
-        Transform viewMat;
-        args->getViewFrustum().evalProjectionMatrix(projMat);
-        args->getViewFrustum().evalViewTransform(viewMat);
-
         batch.setProjectionTransform(projMat);
         batch.setProjectionJitter(jitter.x, jitter.y);
         batch.setViewTransform(viewMat);
@@ -552,24 +555,43 @@ void DrawStateSortDeferred::run(const RenderContextPointer& renderContext, const
         // Setup lighting model for all items;
         batch.setUniformBuffer(ru::Buffer::LightModel, lightingModel->getParametersBuffer());
         batch.setResourceTexture(ru::Texture::AmbientFresnel, lightingModel->getAmbientFresnelLUT());
+    };
 
-        // From the lighting model define a global shapeKey ORED with individiual keys
-        ShapeKey::Builder keyBuilder;
-        if (lightingModel->isWireframeEnabled()) {
-            keyBuilder.withWireframe();
-        }
+    // From the lighting model define a global shapeKey ORED with individiual keys
+    ShapeKey::Builder keyBuilder;
+    if (lightingModel->isWireframeEnabled()) {
+        keyBuilder.withWireframe();
+    }
 
-        ShapeKey globalKey = keyBuilder.build();
+    ShapeKey globalKey = keyBuilder.build();
+
+    if (_stateSort && _numRecordingBatches > 1) {
+        args->_globalShapeKey = globalKey._flags.to_ulong();
+        auto recordTime = renderStateSortShapesInBatches(renderContext, _shapePlumber, inItems, _maxDrawn, globalKey,
+                                                         "DrawStateSortDeferred::run", _numRecordingBatches, setupBatch, _batchArgs,
+                                                         _materialSort);
+        args->_globalShapeKey = 0;
+
+        config->setRecordTime(recordTime);
+        config->setNumDrawn((int)inItems.size());
+        return;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    gpu::doInBatch("DrawStateSortDeferred::run", args->_context, [&](gpu::Batch& batch) {
+        args->_batch = &batch;
+        setupBatch(batch);
         args->_globalShapeKey = globalKey._flags.to_ulong();
 
         if (_stateSort) {
-            renderStateSortShapes(renderContext, _shapePlumber, inItems, _maxDrawn, globalKey);
+            renderStateSortShapes(renderContext, _shapePlumber, inItems, _maxDrawn, globalKey, _materialSort);
         } else {
             renderShapes(renderContext, _shapePlumber, inItems, _maxDrawn, globalKey);
         }
         args->_batch = nullptr;
         args->_globalShapeKey = 0;
     });
+    config->setRecordTime(std::chrono::high_resolution_clock::now() - start);
 
     config->setNumDrawn((int)inItems.size());
 }
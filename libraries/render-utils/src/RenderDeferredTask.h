@@ -63,6 +63,9 @@ class DrawStateSortConfig : public render::Job::Config {
     Q_PROPERTY(int numDrawn READ getNumDrawn NOTIFY numDrawnChanged)
     Q_PROPERTY(int maxDrawn MEMBER maxDrawn NOTIFY dirty)
     Q_PROPERTY(bool stateSort MEMBER stateSort NOTIFY dirty)
+    Q_PROPERTY(bool materialSort MEMBER materialSort NOTIFY dirty)
+    Q_PROPERTY(int numRecordingBatches MEMBER numRecordingBatches NOTIFY dirty)
+    Q_PROPERTY(double recordTime READ getRecordTime NOTIFY newStats) //ms
 public:
     int getNumDrawn() { return numDrawn; }
     void setNumDrawn(int num) {
@@ -70,15 +73,27 @@ public:
         emit numDrawnChanged();
     }
 
+    double getRecordTime() const { return recordTime; }
+    void setRecordTime(const std::chrono::nanoseconds& time) {
+        recordTime = std::chrono::duration<double, std::milli>(time).count();
+    }
+
     int maxDrawn{ -1 };
     bool stateSort{ true };
 
+    // the shapes of a pipeline are also grouped by material, which saves rebinding their textures and parameters
+    bool materialSort{ true };
+
+    // more than one records the sorted shapes into that many batches on worker threads
+    int numRecordingBatches{ 1 };
+
 signals:
     void numDrawnChanged();
     void dirty();
 
 protected:
     int numDrawn{ 0 };
+    double recordTime{ 0.0 };
 };
 
 class DrawStateSortDeferred {
@@ -95,6 +110,8 @@ public:
     void configure(const Config& config) {
         _maxDrawn = config.maxDrawn;
         _stateSort = config.stateSort;
+        _materialSort = config.materialSort;
+        _numRecordingBatches = config.numRecordingBatches;
     }
     void run(const render::RenderContextPointer& renderContext, const Inputs& inputs);
 
@@ -102,6 +119,9 @@ protected:
     render::ShapePlumberPointer _shapePlumber;
     int _maxDrawn;  // initialized by Config
     bool _stateSort;
+    bool _materialSort;
+    int _numRecordingBatches;
+    std::vector<RenderArgs> _batchArgs; // kept until the next frame for the named calls of the recording batches
 };
 
 class SetSeparateDeferredDepthBuffer {
@@ -33,6 +33,7 @@
 #include "TextureCache.h"
 #include "RenderCommonTask.h"
 #include "RenderHUDLayerTask.h"
+#include "DeferredLightingEffect.h"
 
 namespace ru {
     using render_utils::slot::texture::Texture;
@@ -114,6 +115,12 @@ void RenderForwardTask::build(JobModel& task, const render::Varying& input, rend
     // Prepare deferred, generate the shared Deferred Frame Transform. Only valid with the scaled frame buffer
     const auto deferredFrameTransform = task.addJob<GenerateDeferredFrameTransform>("DeferredFrameTransform");
 
+    // Cluster the local lights, there is no G-buffer to light so the forward shaders fetch the lights of the
+    // cluster of each fragment. The clustering only needs the frustum, not the linear depth.
+    const auto nullLinearDepth = Varying(LinearDepthFramebufferPointer());
+    const auto lightClusteringPassInputs = LightClusteringPass::Input(deferredFrameTransform, lightingModel, lightFrame, nullLinearDepth).asVarying();
+    const auto lightClusters = task.addJob<LightClusteringPass>("LightClustering", lightClusteringPassInputs);
+
     // Prepare Forward Framebuffer pass 
     const auto prepareForwardInputs = PrepareForward::Inputs(scaledPrimaryFramebuffer, lightFrame).asVarying();
     task.addJob<PrepareForward>("PrepareForward", prepareForwardInputs);
@@ -122,7 +129,7 @@ void RenderForwardTask::build(JobModel& task, const render::Varying& input, rend
     task.addJob<PrepareStencil>("PrepareStencil", scaledPrimaryFramebuffer);
 
     // Draw opaques forward
-    const auto opaqueInputs = DrawForward::Inputs(opaques, lightingModel, hazeFrame).asVarying();
+    const auto opaqueInputs = DrawForward::Inputs(opaques, lightingModel, hazeFrame, lightClusters).asVarying();
     task.addJob<DrawForward>("DrawOpaques", opaqueInputs, shapePlumber, true);
 
     // Similar to light stage, background stage has been filled by several potential render items and resolved for the frame in this job
@@ -130,7 +137,7 @@ void RenderForwardTask::build(JobModel& task, const render::Varying& input, rend
     task.addJob<DrawBackgroundStage>("DrawBackgroundForward", backgroundInputs);
 
     // Draw transparent objects forward
-    const auto transparentInputs = DrawForward::Inputs(transparents, lightingModel, hazeFrame).asVarying();
+    const auto transparentInputs = DrawForward::Inputs(transparents, lightingModel, hazeFrame, lightClusters).asVarying();
     task.addJob<DrawForward>("DrawTransparents", transparentInputs, shapePlumber, false);
 
      // Layered
@@ -158,7 +165,8 @@ void RenderForwardTask::build(JobModel& task, const render::Varying& input, rend
 
     const auto destFramebuffer = static_cast<gpu::FramebufferPointer>(nullptr);
 
-    const auto toneMappingInputs = ToneMapAndResample::Input(resolvedFramebuffer, destFramebuffer).asVarying();
+    const auto noBloomFramebuffer = static_cast<gpu::FramebufferPointer>(nullptr);
+    const auto toneMappingInputs = ToneMapAndResample::Input(resolvedFramebuffer, destFramebuffer, noBloomFramebuffer).asVarying();
     const auto toneMappedBuffer = task.addJob<ToneMapAndResample>("ToneMapping", toneMappingInputs);
     // HUD Layer
     const auto renderHUDLayerInputs = RenderHUDLayerTask::Input(toneMappedBuffer, lightingModel, hudOpaque, hudTransparent, hazeFrame).asVarying();
@@ -253,6 +261,8 @@ void DrawForward::run(const RenderContextPointer& renderContext, const Inputs& i
     const auto& inItems = inputs.get0();
     const auto& lightingModel = inputs.get1();
     const auto& hazeFrame = inputs.get2();
+    const auto& lightClusters = inputs.get3();
+    auto deferredLightingEffect = DependencyManager::get<DeferredLightingEffect>();
 
     graphics::HazePointer haze;
     const auto& hazeStage = renderContext->args->_scene->getStage<HazeStage>();
@@ -280,6 +290,10 @@ void DrawForward::run(const RenderContextPointer& renderContext, const Inputs& i
             batch.setUniformBuffer(graphics::slot::buffer::Buffer::HazeParams, haze->getHazeParametersBuffer());
         }
 
+        if (lightClusters) {
+            deferredLightingEffect->setupLocalLightsBatch(batch, lightClusters);
+        }
+
         // From the lighting model define a global shapeKey ORED with individiual keys
         ShapeKey::Builder keyBuilder;
         if (lightingModel->isWireframeEnabled()) {
@@ -297,6 +311,10 @@ void DrawForward::run(const RenderContextPointer& renderContext, const Inputs& i
 
         args->_batch = nullptr;
         args->_globalShapeKey = 0;
+
+        if (lightClusters) {
+            deferredLightingEffect->unsetLocalLightsBatch(batch);
+        }
     });
 }
 
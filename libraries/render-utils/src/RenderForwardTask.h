@@ -16,6 +16,7 @@
 #include <render/RenderFetchCullSortTask.h>
 #include "AssembleLightingStageTask.h"
 #include "LightingModel.h"
+#include "LightClusters.h"
 
 class RenderForwardTaskConfig : public render::Task::Config {
     Q_OBJECT
@@ -90,7 +91,7 @@ private:
 
 class DrawForward{
 public:
-    using Inputs = render::VaryingSet3<render::ItemBounds, LightingModelPointer, HazeStage::FramePointer>;
+    using Inputs = render::VaryingSet4<render::ItemBounds, LightingModelPointer, HazeStage::FramePointer, LightClustersPointer>;
     using JobModel = render::Job::ModelI<DrawForward, Inputs>;
 
     DrawForward(const render::ShapePlumberPointer& shapePlumber, bool opaquePass) : _shapePlumber(shapePlumber), _opaquePass(opaquePass) {}
@@ -11,7 +11,10 @@
 
 #include "RenderShadowTask.h"
 
+#include <algorithm>
+
 #include <gpu/Context.h>
+#include <shaders/Shaders.h>
 
 #include <ViewFrustum.h>
 
@@ -29,6 +32,8 @@
 
 #include "FadeEffect.h"
 
+#include "render-utils/ShaderConstants.h"
+
 // These values are used for culling the objects rendered in the shadow map
 // but are readjusted afterwards
 #define SHADOW_FRUSTUM_NEAR 1.0f
@@ -36,6 +41,10 @@
 
 using namespace render;
 
+namespace ru {
+    using render_utils::slot::texture::Texture;
+}
+
 extern void initZPassPipelines(ShapePlumber& plumber, gpu::StatePointer state, const render::ShapePipeline::BatchSetter& batchSetter, const render::ShapePipeline::ItemSetter& itemSetter);
 
 void RenderShadowTask::configure(const Config& configuration) {
@@ -203,6 +212,121 @@ static void adjustNearFar(const AABox& inShapeBounds, ViewFrustum& shadowFrustum
     }
 }
 
+static void renderShadowCasters(const render::RenderContextPointer& renderContext, const ShapePlumberPointer& shapePlumber,
+                                const ShapeBounds& inShapes) {
+    RenderArgs* args = renderContext->args;
+
+    const std::vector<ShapeKey::Builder> keys = {
+        ShapeKey::Builder(), ShapeKey::Builder().withFade(),
+        ShapeKey::Builder().withDeformed(), ShapeKey::Builder().withDeformed().withFade(),
+        ShapeKey::Builder().withDeformed().withDualQuatSkinned(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withFade(),
+        ShapeKey::Builder().withOwnPipeline(), ShapeKey::Builder().withOwnPipeline().withFade(),
+        ShapeKey::Builder().withDeformed().withOwnPipeline(), ShapeKey::Builder().withDeformed().withOwnPipeline().withFade(),
+        ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline().withFade(),
+    };
+    std::vector<std::vector<ShapeKey>> sortedShapeKeys(keys.size());
+
+    const int OWN_PIPELINE_INDEX = 6;
+    for (const auto& items : inShapes) {
+        int index = items.first.hasOwnPipeline() ? OWN_PIPELINE_INDEX : 0;
+        if (items.first.isDeformed()) {
+            index += 2;
+            if (items.first.isDualQuatSkinned()) {
+                index += 2;
+            }
+        }
+
+        if (items.first.isFaded()) {
+            index += 1;
+        }
+
+        sortedShapeKeys[index].push_back(items.first);
+    }
+
+    // Render non-withOwnPipeline things
+    for (size_t i = 0; i < OWN_PIPELINE_INDEX; i++) {
+        auto& shapeKeys = sortedShapeKeys[i];
+        if (shapeKeys.size() > 0) {
+            const auto& shapePipeline = shapePlumber->pickPipeline(args, keys[i]);
+            args->_shapePipeline = shapePipeline;
+            for (const auto& key : shapeKeys) {
+                renderShapes(renderContext, shapePlumber, inShapes.at(key));
+            }
+        }
+    }
+
+    // Render withOwnPipeline things
+    for (size_t i = OWN_PIPELINE_INDEX; i < keys.size(); i++) {
+        auto& shapeKeys = sortedShapeKeys[i];
+        if (shapeKeys.size() > 0) {
+            args->_shapePipeline = nullptr;
+            for (const auto& key : shapeKeys) {
+                args->_itemShapeKey = key._flags.to_ulong();
+                renderShapes(renderContext, shapePlumber, inShapes.at(key));
+            }
+        }
+    }
+
+    args->_shapePipeline = nullptr;
+}
+
+// How long a caster has to keep still before it goes to the static depth, so that a moving one doesn't get there
+// between two moves
+static const uint32_t MIN_STATIC_CASTER_STILL_FRAMES = 30;
+
+void RenderShadowMap::splitStaticCasters(const ShapeBounds& inShapes, ShapeBounds& staticShapes, ShapeBounds& dynamicShapes,
+                                         std::vector<ItemID>& staticCasterIDs) {
+    std::unordered_map<ItemID, CasterState> casterStates;
+    casterStates.reserve(_casterStates.size());
+
+    for (const auto& items : inShapes) {
+        const auto& key = items.first;
+        // These change their depth without moving
+        bool canBeStatic = !key.isDeformed() && !key.isFaded() && !key.hasOwnPipeline();
+
+        for (const auto& item : items.second) {
+            CasterState state { item.bound, 0 };
+            auto previousState = _casterStates.find(item.id);
+            if (previousState != _casterStates.end() && previousState->second.bound == item.bound) {
+                state.stillFrameCount = std::min(previousState->second.stillFrameCount + 1, MIN_STATIC_CASTER_STILL_FRAMES);
+            }
+            casterStates.emplace(item.id, state);
+
+            if (canBeStatic && state.stillFrameCount >= MIN_STATIC_CASTER_STILL_FRAMES) {
+                staticShapes[key].push_back(item);
+                staticCasterIDs.push_back(item.id);
+            } else {
+                dynamicShapes[key].push_back(item);
+            }
+        }
+    }
+
+    _casterStates.swap(casterStates);
+    std::sort(staticCasterIDs.begin(), staticCasterIDs.end());
+}
+
+const gpu::FramebufferPointer& RenderShadowMap::getStaticFramebuffer() {
+    if (!_staticFramebuffer) {
+        auto depthFormat = gpu::Element(gpu::SCALAR, gpu::FLOAT, gpu::DEPTH);
+        auto depthTexture = gpu::Texture::createRenderBuffer(depthFormat, LightStage::Shadow::MAP_SIZE, LightStage::Shadow::MAP_SIZE,
+                                                             gpu::Texture::SINGLE_MIP, gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_POINT));
+        _staticFramebuffer = gpu::FramebufferPointer(gpu::Framebuffer::create("staticShadowCasters"));
+        _staticFramebuffer->setDepthBuffer(depthTexture, depthFormat);
+    }
+    return _staticFramebuffer;
+}
+
+const gpu::PipelinePointer& RenderShadowMap::getRestorePipeline() {
+    if (!_restorePipeline) {
+        gpu::ShaderPointer program = gpu::Shader::createProgram(shader::render_utils::program::shadowCache_restore);
+        gpu::StatePointer state = gpu::StatePointer(new gpu::State());
+        state->setDepthTest(true, true, gpu::ALWAYS);
+        state->setColorWriteMask(false, false, false, false);
+        _restorePipeline = gpu::Pipeline::create(program, state);
+    }
+    return _restorePipeline;
+}
+
 void RenderShadowMap::run(const render::RenderContextPointer& renderContext, const Inputs& inputs) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
@@ -228,11 +352,41 @@ void RenderShadowMap::run(const render::RenderContextPointer& renderContext, con
     // Adjust the frustum near and far depths based on the rendered items bounding box to have
     // the minimal Z range.
     adjustNearFar(inShapeBounds, adjustedShadowFrustum);
+
+    bool isCaching = shadow->isCachingStaticCasters() && !inShapeBounds.isNull();
+    bool needsStaticRender = false;
+    ShapeBounds staticShapes;
+    ShapeBounds dynamicShapes;
+    if (isCaching) {
+        std::vector<ItemID> staticCasterIDs;
+        splitStaticCasters(inShapes, staticShapes, dynamicShapes, staticCasterIDs);
+
+        // The static depth holds as long as the cascade didn't move and its depth range still holds the casters
+        needsStaticRender = !_isStaticDepthValid || _staticFrustumStamp != cascade.getFrustumStamp() ||
+            staticCasterIDs != _staticCasterIDs || adjustedShadowFrustum.getNearClip() < _staticFrustum.getNearClip() ||
+            adjustedShadowFrustum.getFarClip() > _staticFrustum.getFarClip();
+        if (needsStaticRender) {
+            _staticCasterIDs.swap(staticCasterIDs);
+            _staticFrustumStamp = cascade.getFrustumStamp();
+            _staticFrustum = adjustedShadowFrustum;
+            _isStaticDepthValid = true;
+        } else {
+            adjustedShadowFrustum = _staticFrustum;
+        }
+    } else {
+        _casterStates.clear();
+        _staticCasterIDs.clear();
+        _isStaticDepthValid = false;
+    }
+
     // Reapply the frustum as it has been adjusted
     shadow->setCascadeFrustum(_cascadeIndex, adjustedShadowFrustum);
     args->popViewFrustum();
     args->pushViewFrustum(adjustedShadowFrustum);
 
+    const auto& staticFramebuffer = isCaching ? getStaticFramebuffer() : _staticFramebuffer;
+    const auto& restorePipeline = isCaching ? getRestorePipeline() : _restorePipeline;
+
     gpu::doInBatch("RenderShadowMap::run", args->_context, [&](gpu::Batch& batch) {
         args->_batch = &batch;
         batch.enableStereo(false);
@@ -241,70 +395,42 @@ void RenderShadowMap::run(const render::RenderContextPointer& renderContext, con
         batch.setViewportTransform(viewport);
         batch.setStateScissorRect(viewport);
 
-        batch.setFramebuffer(fbo);
-        batch.clearDepthFramebuffer(1.0, false);
-
-        if (!inShapeBounds.isNull()) {
-            glm::mat4 projMat;
-            Transform viewMat;
-            args->getViewFrustum().evalProjectionMatrix(projMat);
-            args->getViewFrustum().evalViewTransform(viewMat);
-
-            batch.setProjectionTransform(projMat);
-            batch.setViewTransform(viewMat, false);
-
-            const std::vector<ShapeKey::Builder> keys = {
-                ShapeKey::Builder(), ShapeKey::Builder().withFade(),
-                ShapeKey::Builder().withDeformed(), ShapeKey::Builder().withDeformed().withFade(),
-                ShapeKey::Builder().withDeformed().withDualQuatSkinned(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withFade(),
-                ShapeKey::Builder().withOwnPipeline(), ShapeKey::Builder().withOwnPipeline().withFade(),
-                ShapeKey::Builder().withDeformed().withOwnPipeline(), ShapeKey::Builder().withDeformed().withOwnPipeline().withFade(),
-                ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline(), ShapeKey::Builder().withDeformed().withDualQuatSkinned().withOwnPipeline().withFade(),
-            };
-            std::vector<std::vector<ShapeKey>> sortedShapeKeys(keys.size());
-
-            const int OWN_PIPELINE_INDEX = 6;
-            for (const auto& items : inShapes) {
-                int index = items.first.hasOwnPipeline() ? OWN_PIPELINE_INDEX : 0;
-                if (items.first.isDeformed()) {
-                    index += 2;
-                    if (items.first.isDualQuatSkinned()) {
-                        index += 2;
-                    }
-                }
+        glm::mat4 projMat;
+        Transform viewMat;
+        args->getViewFrustum().evalProjectionMatrix(projMat);
+        args->getViewFrustum().evalViewTransform(viewMat);
 
-                if (items.first.isFaded()) {
-                    index += 1;
-                }
+        if (!isCaching) {
+            batch.setFramebuffer(fbo);
+            batch.clearDepthFramebuffer(1.0, false);
 
-                sortedShapeKeys[index].push_back(items.first);
+            if (!inShapeBounds.isNull()) {
+                batch.setProjectionTransform(projMat);
+                batch.setViewTransform(viewMat, false);
+                renderShadowCasters(renderContext, _shapePlumber, inShapes);
             }
-
-            // Render non-withOwnPipeline things
-            for (size_t i = 0; i < OWN_PIPELINE_INDEX; i++) {
-                auto& shapeKeys = sortedShapeKeys[i];
-                if (shapeKeys.size() > 0) {
-                    const auto& shapePipeline = _shapePlumber->pickPipeline(args, keys[i]);
-                    args->_shapePipeline = shapePipeline;
-                    for (const auto& key : shapeKeys) {
-                        renderShapes(renderContext, _shapePlumber, inShapes.at(key));
-                    }
-                }
+        } else {
+            if (needsStaticRender) {
+                batch.setFramebuffer(staticFramebuffer);
+                batch.clearDepthFramebuffer(1.0, false);
+                batch.setProjectionTransform(projMat);
+                batch.setViewTransform(viewMat, false);
+                renderShadowCasters(renderContext, _shapePlumber, staticShapes);
             }
 
-            // Render withOwnPipeline things
-            for (size_t i = OWN_PIPELINE_INDEX; i < keys.size(); i++) {
-                auto& shapeKeys = sortedShapeKeys[i];
-                if (shapeKeys.size() > 0) {
-                    args->_shapePipeline = nullptr;
-                    for (const auto& key : shapeKeys) {
-                        args->_itemShapeKey = key._flags.to_ulong();
-                        renderShapes(renderContext, _shapePlumber, inShapes.at(key));
-                    }
-                }
-            }
+            // Start from the static depth, every texel is written so there is nothing to clear
+            batch.setFramebuffer(fbo);
+            batch.setProjectionTransform(glm::mat4());
+            batch.resetViewTransform();
+            batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(glm::ivec2(viewport.z, viewport.w), viewport));
+            batch.setPipeline(restorePipeline);
+            batch.setResourceTexture(ru::Texture::ShadowCache, staticFramebuffer->getDepthStencilBuffer());
+            batch.draw(gpu::TRIANGLE_STRIP, 4);
+            batch.setResourceTexture(ru::Texture::ShadowCache, nullptr);
 
-            args->_shapePipeline = nullptr;
+            batch.setProjectionTransform(projMat);
+            batch.setViewTransform(viewMat, false);
+            renderShadowCasters(renderContext, _shapePlumber, dynamicShapes);
         }
 
         args->_batch = nullptr;
@@ -328,6 +454,7 @@ void RenderShadowSetup::configure(const Config& config) {
     slopeBias3 = config.slopeBias3;
     biasInput = config.biasInput;
     maxDistance = config.maxDistance;
+    cacheStaticCasters = config.cacheStaticCasters;
 }
 
 void RenderShadowSetup::calculateBiases(float biasInput) {
@@ -389,6 +516,7 @@ void RenderShadowSetup::run(const render::RenderContextPointer& renderContext, c
         _globalShadowObject = std::make_shared<LightStage::Shadow>(currentKeyLight, SHADOW_CASCADE_MAX_COUNT);
     }
     _globalShadowObject->setLight(currentKeyLight);
+    _globalShadowObject->setCachingStaticCasters(cacheStaticCasters);
     _globalShadowObject->setKeylightFrustum(args->getViewFrustum(), SHADOW_FRUSTUM_NEAR, SHADOW_FRUSTUM_FAR);
 
     // Update our biases and maxDistance from the light or config
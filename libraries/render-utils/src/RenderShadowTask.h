@@ -12,9 +12,13 @@
 #ifndef hifi_RenderShadowTask_h
 #define hifi_RenderShadowTask_h
 
+#include <unordered_map>
+
 #include <gpu/Framebuffer.h>
 #include <gpu/Pipeline.h>
 
+#include <ViewFrustum.h>
+
 #include <render/CullTask.h>
 
 #include "Shadows_shared.slh"
@@ -22,8 +26,6 @@
 #include "LightingModel.h"
 #include "LightStage.h"
 
-class ViewFrustum;
-
 class RenderShadowMap {
 public:
     using Inputs = render::VaryingSet3<render::ShapeBounds, AABox, LightStage::ShadowFramePointer>;
@@ -35,6 +37,27 @@ public:
 protected:
     render::ShapePlumberPointer _shapePlumber;
     unsigned int _cascadeIndex;
+
+    // When the shadow caches its static casters, the casters that kept still for a while are rendered to the
+    // static depth only when they or the cascade change. Every frame starts from a copy of it and only draws the
+    // moving casters, deformed and fading ones included, on top.
+    struct CasterState {
+        AABox bound;
+        uint32_t stillFrameCount;
+    };
+    std::unordered_map<render::ItemID, CasterState> _casterStates;
+    std::vector<render::ItemID> _staticCasterIDs;
+    uint32_t _staticFrustumStamp { 0 };
+    ViewFrustum _staticFrustum;
+    bool _isStaticDepthValid { false };
+
+    gpu::FramebufferPointer _staticFramebuffer;
+    gpu::PipelinePointer _restorePipeline;
+
+    void splitStaticCasters(const render::ShapeBounds& inShapes, render::ShapeBounds& staticShapes,
+                            render::ShapeBounds& dynamicShapes, std::vector<render::ItemID>& staticCasterIDs);
+    const gpu::FramebufferPointer& getStaticFramebuffer();
+    const gpu::PipelinePointer& getRestorePipeline();
 };
 
 //class RenderShadowTaskConfig : public render::Task::Config::Persistent {
@@ -87,6 +110,7 @@ class RenderShadowSetupConfig : public render::Job::Config {
     Q_PROPERTY(float slopeBias3 MEMBER slopeBias3 NOTIFY dirty)
     Q_PROPERTY(float biasInput MEMBER biasInput NOTIFY dirty)
     Q_PROPERTY(float maxDistance MEMBER maxDistance NOTIFY dirty)
+    Q_PROPERTY(bool cacheStaticCasters MEMBER cacheStaticCasters NOTIFY dirty)
 
 public:
     // Set to > 0 to experiment with these values
@@ -100,6 +124,7 @@ public:
     float slopeBias3 { 0.0f };
     float biasInput { 0.0f };
     float maxDistance { 0.0f };
+    bool cacheStaticCasters { true };
 
 signals:
     void dirty();
@@ -138,6 +163,7 @@ private:
     float slopeBias3;
     float biasInput;
     float maxDistance;
+    bool cacheStaticCasters;
 
     void setConstantBias(int cascadeIndex, float value);
     void setSlopeBias(int cascadeIndex, float value);
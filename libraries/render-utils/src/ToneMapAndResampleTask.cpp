@@ -69,6 +69,8 @@ void ToneMapAndResample::run(const RenderContextPointer& renderContext, const In
 
     auto lightingBuffer = input.get0()->getRenderBuffer(0);
     auto destinationFramebuffer = input.get1();
+    auto bloomFramebuffer = input.get2();
+    auto bloomBuffer = bloomFramebuffer ? bloomFramebuffer->getRenderBuffer(0) : gpu::TexturePointer();
 
     if (!destinationFramebuffer) {
         destinationFramebuffer = args->_blitFramebuffer;
@@ -88,6 +90,11 @@ void ToneMapAndResample::run(const RenderContextPointer& renderContext, const In
 
     glm::ivec4 destViewport{ 0, 0, bufferSize.x, bufferSize.y };
 
+    int applyBloom = bloomBuffer ? 1 : 0;
+    if (_parametersBuffer.get<Parameters>()._applyBloom != applyBloom) {
+        _parametersBuffer.edit<Parameters>()._applyBloom = applyBloom;
+    }
+
     gpu::doInBatch("Resample::run", args->_context, [&](gpu::Batch& batch) {
         batch.enableStereo(false);
         batch.setFramebuffer(destinationFramebuffer);
@@ -100,6 +107,7 @@ void ToneMapAndResample::run(const RenderContextPointer& renderContext, const In
         batch.setModelTransform(gpu::Framebuffer::evalSubregionTexcoordTransform(srcBufferSize, args->_viewport));
         batch.setUniformBuffer(render_utils::slot::buffer::ToneMappingParams, _parametersBuffer);
         batch.setResourceTexture(render_utils::slot::texture::ToneMappingColor, lightingBuffer);
+        batch.setResourceTexture(render_utils::slot::texture::ToneMappingBloom, bloomBuffer);
         batch.draw(gpu::TRIANGLE_STRIP, 4);
     });
 
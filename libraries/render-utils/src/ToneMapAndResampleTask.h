@@ -60,8 +60,8 @@ public:
     void setToneCurve(ToneCurve curve);
     ToneCurve getToneCurve() const { return (ToneCurve)_parametersBuffer.get<Parameters>()._toneCurve; }
 
-    // Inputs: lightingFramebuffer, destinationFramebuffer
-    using Input = render::VaryingSet2<gpu::FramebufferPointer, gpu::FramebufferPointer>;
+    // Inputs: lightingFramebuffer, destinationFramebuffer, bloomFramebuffer (added to the lighting when there is one)
+    using Input = render::VaryingSet3<gpu::FramebufferPointer, gpu::FramebufferPointer, gpu::FramebufferPointer>;
     using Output = gpu::FramebufferPointer;
     using Config = ToneMappingConfig;
     using JobModel = render::Job::ModelIO<ToneMapAndResample, Input, Output, Config>;
@@ -89,7 +89,8 @@ private:
         float _twoPowExposure = 1.0f;
         glm::vec2 spareA;
         int _toneCurve = (int)ToneCurve::Gamma22;
-        glm::vec3 spareB;
+        int _applyBloom = 0;
+        glm::vec2 spareB;
 
         Parameters() {}
     };
@@ -80,6 +80,7 @@
 #define RENDER_UTILS_BUFFER_HIGHLIGHT_PARAMS 2
 #define RENDER_UTILS_TEXTURE_HIGHLIGHT_SCENE_DEPTH 0
 #define RENDER_UTILS_TEXTURE_HIGHLIGHT_DEPTH 1
+#define RENDER_UTILS_TEXTURE_HIGHLIGHT_ID 2
 
 // Subsurface scattering
 #define RENDER_UTILS_BUFFER_SSSC_PARAMS 13
@@ -92,9 +93,12 @@
 #define RENDER_UTILS_BUFFER_SSAO_DEBUG_PARAMS 3
 #define RENDER_UTILS_BUFFER_SSAO_BLUR_PARAMS 4
 #define RENDER_UTILS_BUFFER_SSAO_FRAME_PARAMS 5
+#define RENDER_UTILS_BUFFER_SSAO_TEMPORAL_PARAMS 6
 #define RENDER_UTILS_TEXTURE_SSAO_DEPTH 1
 #define RENDER_UTILS_TEXTURE_SSAO_NORMAL 2
 #define RENDER_UTILS_TEXTURE_SSAO_OCCLUSION 0
+#define RENDER_UTILS_TEXTURE_SSAO_HISTORY 3
+#define RENDER_UTILS_TEXTURE_SSAO_VELOCITY 4
 
 // Temporal anti-aliasing
 #define RENDER_UTILS_BUFFER_TAA_PARAMS 2
@@ -109,6 +113,12 @@
 #define RENDER_UTILS_TEXTURE_SG_DEPTH 0
 #define RENDER_UTILS_TEXTURE_SG_NORMAL 1
 
+// Depth Pyramid
+#define RENDER_UTILS_TEXTURE_DEPTH_PYRAMID_SOURCE 0
+
+// Shadow Cache
+#define RENDER_UTILS_TEXTURE_SHADOW_CACHE 0
+
 // Blur
 #define RENDER_UTILS_BUFFER_BLUR_PARAMS 0
 #define RENDER_UTILS_TEXTURE_BLUR_SOURCE 0
@@ -117,6 +127,7 @@
 // Tone Mapping
 #define RENDER_UTILS_BUFFER_TM_PARAMS 0
 #define RENDER_UTILS_TEXTURE_TM_COLOR 0
+#define RENDER_UTILS_TEXTURE_TM_BLOOM 1
 
 // Bloom
 #define RENDER_UTILS_BUFFER_BLOOM_PARAMS 1
@@ -152,6 +163,7 @@ enum Buffer {
     SsaoFrameParams = RENDER_UTILS_BUFFER_SSAO_FRAME_PARAMS,
     SsaoDebugParams = RENDER_UTILS_BUFFER_SSAO_DEBUG_PARAMS,
     SsaoBlurParams = RENDER_UTILS_BUFFER_SSAO_BLUR_PARAMS,
+    SsaoTemporalParams = RENDER_UTILS_BUFFER_SSAO_TEMPORAL_PARAMS,
     LightIndex = RENDER_UTILS_BUFFER_LIGHT_INDEX,
     TaaParams = RENDER_UTILS_BUFFER_TAA_PARAMS,
     HighlightParams = RENDER_UTILS_BUFFER_HIGHLIGHT_PARAMS,
@@ -192,14 +204,20 @@ enum Texture {
     SsaoOcclusion = RENDER_UTILS_TEXTURE_SSAO_OCCLUSION,
     SsaoDepth = RENDER_UTILS_TEXTURE_SSAO_DEPTH,
     SsaoNormal = RENDER_UTILS_TEXTURE_SSAO_NORMAL,
+    SsaoHistory = RENDER_UTILS_TEXTURE_SSAO_HISTORY,
+    SsaoVelocity = RENDER_UTILS_TEXTURE_SSAO_VELOCITY,
     HighlightSceneDepth = RENDER_UTILS_TEXTURE_HIGHLIGHT_SCENE_DEPTH,
     HighlightDepth = RENDER_UTILS_TEXTURE_HIGHLIGHT_DEPTH,
+    HighlightId = RENDER_UTILS_TEXTURE_HIGHLIGHT_ID,
     SurfaceGeometryDepth = RENDER_UTILS_TEXTURE_SG_DEPTH,
     SurfaceGeometryNormal = RENDER_UTILS_TEXTURE_SG_NORMAL,
+    DepthPyramidSource = RENDER_UTILS_TEXTURE_DEPTH_PYRAMID_SOURCE,
+    ShadowCache = RENDER_UTILS_TEXTURE_SHADOW_CACHE,
     BlurSource = RENDER_UTILS_TEXTURE_BLUR_SOURCE,
     BlurDepth = RENDER_UTILS_TEXTURE_BLUR_DEPTH,
     BloomColor = RENDER_UTILS_TEXTURE_BLOOM_COLOR,
     ToneMappingColor = RENDER_UTILS_TEXTURE_TM_COLOR,
+    ToneMappingBloom = RENDER_UTILS_TEXTURE_TM_BLOOM,
     TextFont = RENDER_UTILS_TEXTURE_TEXT_FONT,
     AmbientFresnel = RENDER_UTILS_TEXTURE_AMBIENT_FRESNEL,
     DebugTexture0 = RENDER_UTILS_DEBUG_TEXTURE0,
@@ -53,6 +53,12 @@ struct AmbientOcclusionBlurParams {
     SSAO_VEC4 _blurAxis;
 };
 
+struct AmbientOcclusionTemporalParams {
+    // x: weight of the current frame, y: relative depth difference past which the history is dropped,
+    // z: 1 when there is a history to blend with
+    SSAO_VEC4 _temporalInfo;
+};
+
 #endif // RENDER_UTILS_SHADER_CONSTANTS_H
 
 // <@if 1@>
@@ -33,6 +33,9 @@ static const int NUMBER_OF_INDICES_PER_QUAD = 6;  // 1 quad = 2 triangles
 static const int VERTICES_PER_QUAD = 4;           // 1 quad = 4 vertices (must match value in sdf_text3D.slv)
 const float DOUBLE_MAX_OFFSET_PIXELS = 20.0f;     // must match value in sdf_text3D.slh
 
+// the expired strings are only looked for once the cache has grown past this many, or twice as many as the last time
+static const size_t MIN_GLYPH_QUADS_PURGE_SIZE = 256;
+
 struct QuadBuilder {
     TextureVertex vertices[VERTICES_PER_QUAD];
 
@@ -235,6 +238,11 @@ void Font::read(QIODevice& in) {
     }
 
     _glyphs.clear();
+    {
+        // the strings laid out with the glyphs of a font that was still loading are stale
+        std::lock_guard<std::mutex> lock(_glyphQuadsMutex);
+        _glyphQuads.clear();
+    }
     glm::vec2 imageSize = toGlm(image.size());
     foreach(Glyph g, glyphs) {
         // Adjust the pixel texture coordinates into UV coordinates,
@@ -301,15 +309,9 @@ void Font::setupGPU() {
     }
 }
 
-void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows) {
-    drawInfo.verticesBuffer = std::make_shared<gpu::Buffer>();
-    drawInfo.indicesBuffer = std::make_shared<gpu::Buffer>();
-    drawInfo.indexCount = 0;
-    int numVertices = 0;
-
-    drawInfo.string = str;
-    drawInfo.bounds = bounds;
-    drawInfo.origin = origin;
+std::shared_ptr<Font::GlyphQuads> Font::buildVertices(const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows) {
+    auto quads = std::make_shared<GlyphQuads>();
+    quads->verticesBuffer = std::make_shared<gpu::Buffer>();
 
     float enlargedBoundsX = bounds.x - 0.5f * DOUBLE_MAX_OFFSET_PIXELS * float(enlargeForShadows);
 
@@ -345,38 +347,10 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
         if (!isNewLine) {
             for (auto c : token) {
                 auto glyph = _glyphs[c];
-                quint16 verticesOffset = numVertices;
 
                 QuadBuilder qd(glyph, advance - glm::vec2(0.0f, _ascent), scale, enlargeForShadows);
-                drawInfo.verticesBuffer->append(qd);
-                numVertices += VERTICES_PER_QUAD;
-
-                // Sam's recommended triangle slices
-                // Triangle tri1 = { v0, v1, v3 };
-                // Triangle tri2 = { v1, v2, v3 };
-                // NOTE: Random guy on the internet's recommended triangle slices
-                // Triangle tri1 = { v0, v1, v2 };
-                // Triangle tri2 = { v2, v3, v0 };
-
-                // The problem here being that the 4 vertices are { ll, lr, ul, ur }, a Z pattern
-                // Additionally, you want to ensure that the shared side vertices are used sequentially
-                // to improve cache locality
-                //
-                //  2 -- 3
-                //  |    |
-                //  |    |
-                //  0 -- 1
-                //
-                //  { 0, 1, 2 } -> { 2, 1, 3 }
-                quint16 indices[NUMBER_OF_INDICES_PER_QUAD];
-                indices[0] = verticesOffset + 0;
-                indices[1] = verticesOffset + 1;
-                indices[2] = verticesOffset + 2;
-                indices[3] = verticesOffset + 2;
-                indices[4] = verticesOffset + 1;
-                indices[5] = verticesOffset + 3;
-                drawInfo.indicesBuffer->append(sizeof(indices), (const gpu::Byte*)indices);
-                drawInfo.indexCount += NUMBER_OF_INDICES_PER_QUAD;
+                quads->verticesBuffer->append(qd);
+                quads->indexCount += NUMBER_OF_INDICES_PER_QUAD;
 
                 // Advance by glyph size
                 advance.x += glyph.d;
@@ -386,6 +360,71 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
             advance.x += _spaceWidth;
         }
     }
+    return quads;
+}
+
+std::shared_ptr<const Font::GlyphQuads> Font::getGlyphQuads(const QString& str, const glm::vec2& origin, const glm::vec2& bounds,
+                                                             float scale, bool enlargeForShadows) {
+    GlyphQuadsKey key(str, origin.x, origin.y, bounds.x, bounds.y, enlargeForShadows ? scale : 0.0f, enlargeForShadows);
+
+    std::lock_guard<std::mutex> lock(_glyphQuadsMutex);
+    auto& cached = _glyphQuads[key];
+    std::shared_ptr<const GlyphQuads> quads = cached.lock();
+    if (!quads) {
+        quads = buildVertices(str, origin, bounds, scale, enlargeForShadows);
+        cached = quads;
+
+        if (_glyphQuads.size() > std::max(_glyphQuadsPurgeSize, MIN_GLYPH_QUADS_PURGE_SIZE)) {
+            for (auto itr = _glyphQuads.begin(); itr != _glyphQuads.end();) {
+                if (itr->second.expired()) {
+                    itr = _glyphQuads.erase(itr);
+                } else {
+                    ++itr;
+                }
+            }
+            _glyphQuadsPurgeSize = 2 * _glyphQuads.size();
+        }
+    }
+    return quads;
+}
+
+gpu::BufferPointer Font::getQuadIndices(uint32_t numQuads) {
+    std::lock_guard<std::mutex> lock(_glyphQuadsMutex);
+    if (!_quadIndices || numQuads > _numIndexedQuads) {
+        // the batches that are still using the smaller buffer keep it
+        _numIndexedQuads = std::max(numQuads, 2 * _numIndexedQuads);
+        _quadIndices = std::make_shared<gpu::Buffer>();
+        for (uint32_t i = 0; i < _numIndexedQuads; i++) {
+            quint16 verticesOffset = (quint16)(i * VERTICES_PER_QUAD);
+
+            // Sam's recommended triangle slices
+            // Triangle tri1 = { v0, v1, v3 };
+            // Triangle tri2 = { v1, v2, v3 };
+            // NOTE: Random guy on the internet's recommended triangle slices
+            // Triangle tri1 = { v0, v1, v2 };
+            // Triangle tri2 = { v2, v3, v0 };
+
+            // The problem here being that the 4 vertices are { ll, lr, ul, ur }, a Z pattern
+            // Additionally, you want to ensure that the shared side vertices are used sequentially
+            // to improve cache locality
+            //
+            //  2 -- 3
+            //  |    |
+            //  |    |
+            //  0 -- 1
+            //
+            //  { 0, 1, 2 } -> { 2, 1, 3 }
+            quint16 indices[NUMBER_OF_INDICES_PER_QUAD];
+            indices[0] = verticesOffset + 0;
+            indices[1] = verticesOffset + 1;
+            indices[2] = verticesOffset + 2;
+            indices[3] = verticesOffset + 2;
+            indices[4] = verticesOffset + 1;
+            indices[5] = verticesOffset + 3;
+            _quadIndices->append(sizeof(indices), (const gpu::Byte*)indices);
+        }
+    }
+    return _quadIndices;
 }
 
 void Font::drawString(gpu::Batch& batch, Font::DrawInfo& drawInfo, const QString& str, const glm::vec4& color,
@@ -399,11 +438,17 @@ void Font::drawString(gpu::Batch& batch, Font::DrawInfo& drawInfo, const QString
     const int SHADOW_EFFECT = (int)TextEffect::SHADOW_EFFECT;
 
     // If we're switching to or from shadow effect mode, we need to rebuild the vertices
-    if (str != drawInfo.string || bounds != drawInfo.bounds || origin != drawInfo.origin ||
+    if (!drawInfo.quads || str != drawInfo.string || bounds != drawInfo.bounds || origin != drawInfo.origin ||
             (drawInfo.params.effect != textEffect && (textEffect == SHADOW_EFFECT || drawInfo.params.effect == SHADOW_EFFECT)) ||
-            (textEffect == SHADOW_EFFECT && scale != _scale)) {
-        _scale = scale;
-        buildVertices(drawInfo, str, origin, bounds, scale, textEffect == SHADOW_EFFECT);
+            (textEffect == SHADOW_EFFECT && scale != drawInfo.scale)) {
+        drawInfo.string = str;
+        drawInfo.bounds = bounds;
+        drawInfo.origin = origin;
+        drawInfo.scale = scale;
+        drawInfo.quads = getGlyphQuads(str, origin, bounds, scale, textEffect == SHADOW_EFFECT);
+    }
+    if (drawInfo.quads->indexCount == 0) {
+        return;
     }
 
     setupGPU();
@@ -429,9 +474,9 @@ void Font::drawString(gpu::Batch& batch, Font::DrawInfo& drawInfo, const QString
 
     batch.setPipeline(_pipelines[std::make_tuple(color.a < 1.0f, unlit, forward)]);
     batch.setInputFormat(_format);
-    batch.setInputBuffer(0, drawInfo.verticesBuffer, 0, _format->getChannels().at(0)._stride);
+    batch.setInputBuffer(0, drawInfo.quads->verticesBuffer, 0, _format->getChannels().at(0)._stride);
     batch.setResourceTexture(render_utils::slot::texture::TextFont, _texture);
     batch.setUniformBuffer(0, drawInfo.paramsBuffer, 0, sizeof(DrawParams));
-    batch.setIndexBuffer(gpu::UINT16, drawInfo.indicesBuffer, 0);
-    batch.drawIndexed(gpu::TRIANGLES, drawInfo.indexCount, 0);
+    batch.setIndexBuffer(gpu::UINT16, getQuadIndices(drawInfo.quads->indexCount / NUMBER_OF_INDICES_PER_QUAD), 0);
+    batch.drawIndexed(gpu::TRIANGLES, drawInfo.quads->indexCount, 0);
 }
@@ -10,6 +10,10 @@
 #ifndef hifi_Font_h
 #define hifi_Font_h
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 #include <QObject>
 
 #include "Glyph.h"
@@ -41,15 +45,20 @@ public:
         vec3 _spare;
     };
 
-    struct DrawInfo {
+    // the quads of a laid out string, shared by the draws of the same string with the same layout
+    struct GlyphQuads {
         gpu::BufferPointer verticesBuffer { nullptr };
-        gpu::BufferPointer indicesBuffer { nullptr };
+        uint32_t indexCount { 0 };
+    };
+
+    struct DrawInfo {
+        std::shared_ptr<const GlyphQuads> quads;
         gpu::BufferPointer paramsBuffer { nullptr };
-        uint32_t indexCount;
 
         QString string;
         glm::vec2 origin;
         glm::vec2 bounds;
+        float scale { 0.0f };
         DrawParams params;
     };
 
@@ -76,7 +85,14 @@ private:
     glm::vec2 computeTokenExtent(const QString& str) const;
 
     const Glyph& getGlyph(const QChar& c) const;
-    void buildVertices(DrawInfo& drawInfo, const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows);
+    std::shared_ptr<GlyphQuads> buildVertices(const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows);
+
+    // the quads of the strings that are still drawn somewhere, the scale is only part of the key of shadowed text
+    using GlyphQuadsKey = std::tuple<QString, float, float, float, float, float, bool>;
+    std::shared_ptr<const GlyphQuads> getGlyphQuads(const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows);
+
+    // every string uses the same indices, the buffer grows with the longest one
+    gpu::BufferPointer getQuadIndices(uint32_t numQuads);
 
     void setupGPU();
 
@@ -95,13 +111,17 @@ private:
     float _descent { 0.0f };
     float _spaceWidth { 0.0f };
 
-    float _scale { 0.0f };
-
     bool _loaded { true };
 
     gpu::TexturePointer _texture;
     gpu::BufferStreamPointer _stream;
 
+    std::mutex _glyphQuadsMutex;
+    std::map<GlyphQuadsKey, std::weak_ptr<const GlyphQuads>> _glyphQuads;
+    size_t _glyphQuadsPurgeSize { 0 };
+    gpu::BufferPointer _quadIndices;
+    uint32_t _numIndexedQuads { 0 };
+
     static std::map<std::tuple<bool, bool, bool>, gpu::PipelinePointer> _pipelines;
     static gpu::Stream::FormatPointer _format;
 };
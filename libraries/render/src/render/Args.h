@@ -37,11 +37,13 @@ namespace render {
             int _considered = 0;
             int _outOfView = 0;
             int _tooSmall = 0;
+            int _occluded = 0;
             int _rendered = 0;
         };
 
         int _materialSwitches = 0;
         int _trianglesRendered = 0;
+        int _instancedItems = 0; // items drawn along with others in a shared instanced draw
 
         Item _item;
         Item _shadow;
@@ -16,6 +16,7 @@
 
 #include <PerfStat.h>
 #include <OctreeUtils.h>
+#include <TBBHelpers.h>
 
 using namespace render;
 
@@ -175,6 +176,60 @@ void CullSpatialSelection::configure(const Config& config) {
     _skipCulling = config.skipCulling;
 }
 
+// The selection lists are culled in chunks of this many items, spread over the TBB workers
+static const size_t NUM_ITEMS_PER_CULL_CHUNK = 512;
+
+static void cullSelectedItems(Scene& scene, const ItemIDs& inItems, const ItemFilter& filter, CullTest& test,
+                              bool testFrustum, bool testSolidAngle, ItemBounds& outItems) {
+    size_t numChunks = (inItems.size() + NUM_ITEMS_PER_CULL_CHUNK - 1) / NUM_ITEMS_PER_CULL_CHUNK;
+    std::vector<ItemBounds> chunkItems(numChunks);
+    std::vector<RenderDetails::Item> chunkDetails(numChunks);
+
+    // every chunk goes into its own list, so merging them in chunk order gives the same result as a serial walk
+    auto cullChunk = [&](size_t chunk) {
+        CullTest chunkTest(test._functor, test._args, chunkDetails[chunk]);
+        size_t begin = chunk * NUM_ITEMS_PER_CULL_CHUNK;
+        size_t end = std::min(begin + NUM_ITEMS_PER_CULL_CHUNK, inItems.size());
+
+        auto& culledItems = chunkItems[chunk];
+        culledItems.reserve(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            auto id = inItems[i];
+            auto& item = scene.getItem(id);
+            if (filter.test(item.getKey())) {
+                ItemBound itemBound(id, item.getBound());
+                if ((!testFrustum || chunkTest.frustumTest(itemBound.bound)) &&
+                    (!testSolidAngle || chunkTest.solidAngleTest(itemBound.bound))) {
+                    culledItems.emplace_back(itemBound);
+                }
+            }
+        }
+    };
+
+    if (numChunks > 1) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t chunk = range.begin(); chunk != range.end(); ++chunk) {
+                cullChunk(chunk);
+            }
+        });
+    } else if (numChunks == 1) {
+        cullChunk(0);
+    }
+
+    // the sub items of meta cull groups are fetched from their payloads, which is left to the render thread
+    for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+        test._renderDetails._outOfView += chunkDetails[chunk]._outOfView;
+        test._renderDetails._tooSmall += chunkDetails[chunk]._tooSmall;
+        for (auto& itemBound : chunkItems[chunk]) {
+            outItems.emplace_back(itemBound);
+            auto& item = scene.getItem(itemBound.id);
+            if (item.getKey().isMetaCullGroup()) {
+                item.fetchMetaSubItemBounds(outItems, scene);
+            }
+        }
+    }
+}
+
 void CullSpatialSelection::run(const RenderContextPointer& renderContext,
                                const Inputs& inputs, ItemBounds& outItems) {
     assert(renderContext->args);
@@ -209,136 +264,31 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
         // filter individually against the _filter
         // visibility cull if partially selected ( octree cell contianing it was partial)
         // distance cull if was a subcell item ( octree cell is way bigger than the item bound itself, so now need to test per item)
-        if (_skipCulling) {
-            // inside & fit items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-            // inside & subcell items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-            // partial & fit items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-            // partial & subcell items: filter only, culling is disabled
-            {
-                PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
-
-        } else {
+        // with culling disabled the items only go through the filter
+        bool cull = !_skipCulling;
 
-            // inside & fit items: easy, just filter
-            {
-                PerformanceTimer perfTimer("insideFitItems");
-                for (auto id : inSelection.insideItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        outItems.emplace_back(itemBound);
-                        if (item.getKey().isMetaCullGroup()) {
-                            item.fetchMetaSubItemBounds(outItems, (*scene));
-                        }
-                    }
-                }
-            }
+        // inside & fit items: easy, just filter
+        {
+            PerformanceTimer perfTimer("insideFitItems");
+            cullSelectedItems(*scene, inSelection.insideItems, filter, test, false, false, outItems);
+        }
 
-            // inside & subcell items: filter & distance cull
-            {
-                PerformanceTimer perfTimer("insideSmallItems");
-                for (auto id : inSelection.insideSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.solidAngleTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
-                            }
-                        }
-                    }
-                }
-            }
+        // inside & subcell items: filter & distance cull
+        {
+            PerformanceTimer perfTimer("insideSmallItems");
+            cullSelectedItems(*scene, inSelection.insideSubcellItems, filter, test, false, cull, outItems);
+        }
 
-            // partial & fit items: filter & frustum cull
-            {
-                PerformanceTimer perfTimer("partialFitItems");
-                for (auto id : inSelection.partialItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            outItems.emplace_back(itemBound);
-                            if (item.getKey().isMetaCullGroup()) {
-                                item.fetchMetaSubItemBounds(outItems, (*scene));
-                            }
-                        }
-                    }
-                }
-            }
+        // partial & fit items: filter & frustum cull
+        {
+            PerformanceTimer perfTimer("partialFitItems");
+            cullSelectedItems(*scene, inSelection.partialItems, filter, test, cull, false, outItems);
+        }
 
-            // partial & subcell items:: filter & frutum cull & solidangle cull
-            {
-                PerformanceTimer perfTimer("partialSmallItems");
-                for (auto id : inSelection.partialSubcellItems) {
-                    auto& item = scene->getItem(id);
-                    if (filter.test(item.getKey())) {
-                        ItemBound itemBound(id, item.getBound());
-                        if (test.frustumTest(itemBound.bound)) {
-                            if (test.solidAngleTest(itemBound.bound)) {
-                                outItems.emplace_back(itemBound);
-                                if (item.getKey().isMetaCullGroup()) {
-                                    item.fetchMetaSubItemBounds(outItems, (*scene));
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+        // partial & subcell items:: filter & frutum cull & solidangle cull
+        {
+            PerformanceTimer perfTimer("partialSmallItems");
+            cullSelectedItems(*scene, inSelection.partialSubcellItems, filter, test, cull, cull, outItems);
         }
     }
 
@@ -352,6 +302,55 @@ void CullSpatialSelection::run(const RenderContextPointer& renderContext,
     std::static_pointer_cast<Config>(renderContext->jobConfig)->numItems = (int)outItems.size();
 }
 
+void CullOcclusion::configure(const Config& config) {
+    _skipOcclusion = config.skipOcclusion;
+    _maxEyeMotion = config.maxEyeMotion;
+    _maxEyeRotation = config.maxEyeRotation;
+}
+
+void CullOcclusion::run(const RenderContextPointer& renderContext, const Inputs& inputs, ItemBounds& outItems) {
+    assert(renderContext->args);
+    assert(renderContext->args->hasViewFrustum());
+    RenderArgs* args = renderContext->args;
+    auto& scene = renderContext->_scene;
+    const auto& inItems = inputs.get0();
+    const auto& feedback = inputs.get1();
+    auto config = std::static_pointer_cast<Config>(renderContext->jobConfig);
+
+    // the pyramids only cover mono views, and past some motion of the eye what they hid may be in sight by now
+    auto pyramid = (feedback && !_skipOcclusion && !args->isStereo()) ? feedback->getLatest() : nullptr;
+    if (pyramid) {
+        const auto& frustum = args->getViewFrustum();
+        if (glm::distance(frustum.getPosition(), pyramid->getEyePosition()) > _maxEyeMotion ||
+            glm::dot(frustum.getDirection(), pyramid->getEyeDirection()) < cosf(_maxEyeRotation)) {
+            pyramid.reset();
+        }
+    }
+
+    if (!pyramid) {
+        outItems = inItems;
+        config->numOccluded = 0;
+        return;
+    }
+
+    PerformanceTimer perfTimer("occlusion");
+    outItems.clear();
+    outItems.reserve(inItems.size());
+    int numOccluded = 0;
+    for (const auto& itemBound : inItems) {
+        if (scene->getItem(itemBound.id).getKey().isShape() && pyramid->isOccluded(itemBound.bound)) {
+            ++numOccluded;
+        } else {
+            outItems.emplace_back(itemBound);
+        }
+    }
+
+    auto& details = args->_details.edit(_detailType);
+    details._occluded += numOccluded;
+    details._rendered -= numOccluded;
+    config->numOccluded = numOccluded;
+}
+
 void CullShapeBounds::run(const RenderContextPointer& renderContext, const Inputs& inputs, Outputs& outputs) {
     assert(renderContext->args);
     assert(renderContext->args->hasViewFrustum());
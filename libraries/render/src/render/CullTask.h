@@ -14,6 +14,7 @@
 
 #include "Engine.h"
 #include "ViewFrustum.h"
+#include "DepthPyramid.h"
 
 namespace render {
 
@@ -124,6 +125,45 @@ namespace render {
         void run(const RenderContextPointer& renderContext, const Inputs& inputs, ItemBounds& outItems);
     };
 
+    class CullOcclusionConfig : public Job::Config {
+        Q_OBJECT
+        Q_PROPERTY(int numOccluded READ getNumOccluded)
+        Q_PROPERTY(bool skipOcclusion MEMBER skipOcclusion WRITE setSkipOcclusion)
+        Q_PROPERTY(float maxEyeMotion MEMBER maxEyeMotion NOTIFY dirty)
+        Q_PROPERTY(float maxEyeRotation MEMBER maxEyeRotation NOTIFY dirty)
+    public:
+        int numOccluded{ 0 };
+        int getNumOccluded() { return numOccluded; }
+
+        bool skipOcclusion{ false };
+        float maxEyeMotion{ 0.5f }; // meters
+        float maxEyeRotation{ 0.1f }; // radians
+    public slots:
+        void setSkipOcclusion(bool enabled) { skipOcclusion = enabled; emit dirty(); }
+    signals:
+        void dirty();
+    };
+
+    // Drops the shapes that were hidden behind the depth of the latest frame of the view to come back from the gpu.
+    // That frame is a few frames old, so the eye has to be about where it was then for the test to hold.
+    class CullOcclusion {
+    public:
+        using Config = CullOcclusionConfig;
+        using Inputs = render::VaryingSet2<ItemBounds, DepthPyramidFeedbackPointer>;
+        using JobModel = Job::ModelIO<CullOcclusion, Inputs, ItemBounds, Config>;
+
+        CullOcclusion(RenderDetails::Type type) : _detailType(type) {}
+
+        void configure(const Config& config);
+        void run(const RenderContextPointer& renderContext, const Inputs& inputs, ItemBounds& outItems);
+
+    private:
+        RenderDetails::Type _detailType{ RenderDetails::OTHER };
+        bool _skipOcclusion{ false };
+        float _maxEyeMotion{ 0.5f };
+        float _maxEyeRotation{ 0.1f };
+    };
+
     class CullShapeBounds {
     public:
         using Inputs = render::VaryingSet4<ShapeBounds, ItemFilter, ItemFilter, ViewFrustumPointer>;
@@ -0,0 +1,102 @@
+//
+//  DepthPyramid.cpp
+//  render/src/render
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DepthPyramid.h"
+
+#include <algorithm>
+#include <cfloat>
+
+using namespace render;
+
+// widens the covered texels a little, the frame was drawn with a jittered projection
+static const float TEXEL_MARGIN = 0.5f;
+static const int NUM_BOX_CORNERS = 8;
+
+DepthPyramid::DepthPyramid(std::vector<float> depths, int width, int height, const glm::mat4& viewProjection,
+                           const glm::vec3& eyePosition, const glm::vec3& eyeDirection) :
+    _viewProjection(viewProjection),
+    _eyePosition(eyePosition),
+    _eyeDirection(eyeDirection)
+{
+    _levels.push_back({ width, height, std::move(depths) });
+
+    // every texel of a level holds the farthest of the 2 by 2 texels under it, the odd last row and column included
+    while (_levels.back().width > 1 || _levels.back().height > 1) {
+        const Level& finer = _levels.back();
+        Level coarser { (finer.width + 1) / 2, (finer.height + 1) / 2, {} };
+        coarser.depths.resize(coarser.width * coarser.height);
+        for (int y = 0; y < coarser.height; ++y) {
+            int y0 = 2 * y;
+            int y1 = std::min(y0 + 1, finer.height - 1);
+            for (int x = 0; x < coarser.width; ++x) {
+                int x0 = 2 * x;
+                int x1 = std::min(x0 + 1, finer.width - 1);
+                coarser.depths[y * coarser.width + x] = std::max(
+                    std::max(finer.depths[y0 * finer.width + x0], finer.depths[y0 * finer.width + x1]),
+                    std::max(finer.depths[y1 * finer.width + x0], finer.depths[y1 * finer.width + x1]));
+            }
+        }
+        _levels.push_back(std::move(coarser));
+    }
+}
+
+bool DepthPyramid::isOccluded(const AABox& box) const {
+    glm::vec2 minNdc(FLT_MAX);
+    glm::vec2 maxNdc(-FLT_MAX);
+    float nearestDepth = FLT_MAX;
+    for (int i = 0; i < NUM_BOX_CORNERS; ++i) {
+        glm::vec4 clip = _viewProjection * glm::vec4(box.getVertex((BoxVertex)i), 1.0f);
+        if (clip.w <= 0.0f) {
+            return false;
+        }
+        glm::vec3 ndc = glm::vec3(clip) / clip.w;
+        minNdc = glm::min(minNdc, glm::vec2(ndc));
+        maxNdc = glm::max(maxNdc, glm::vec2(ndc));
+        nearestDepth = std::min(nearestDepth, ndc.z * 0.5f + 0.5f);
+    }
+
+    // nothing is known about what was outside of the view
+    if (minNdc.x < -1.0f || minNdc.y < -1.0f || maxNdc.x > 1.0f || maxNdc.y > 1.0f) {
+        return false;
+    }
+
+    const Level& base = _levels.front();
+    glm::vec2 baseSize(base.width, base.height);
+    glm::vec2 minTexel = (minNdc * 0.5f + 0.5f) * baseSize - TEXEL_MARGIN;
+    glm::vec2 maxTexel = (maxNdc * 0.5f + 0.5f) * baseSize + TEXEL_MARGIN;
+
+    // the level where the box spans at most a texel, so it covers 2 by 2 texels at most
+    float extent = std::max(std::max(maxTexel.x - minTexel.x, maxTexel.y - minTexel.y), 1.0f);
+    int levelIndex = std::min((int)ceilf(log2f(extent)), (int)_levels.size() - 1);
+    const Level& level = _levels[levelIndex];
+
+    int firstX = glm::clamp((int)floorf(minTexel.x) >> levelIndex, 0, level.width - 1);
+    int lastX = glm::clamp((int)floorf(maxTexel.x) >> levelIndex, 0, level.width - 1);
+    int firstY = glm::clamp((int)floorf(minTexel.y) >> levelIndex, 0, level.height - 1);
+    int lastY = glm::clamp((int)floorf(maxTexel.y) >> levelIndex, 0, level.height - 1);
+    for (int y = firstY; y <= lastY; ++y) {
+        for (int x = firstX; x <= lastX; ++x) {
+            if (nearestDepth <= level.depths[y * level.width + x]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void DepthPyramidFeedback::setLatest(const DepthPyramidPointer& pyramid) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _latest = pyramid;
+}
+
+DepthPyramidPointer DepthPyramidFeedback::getLatest() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _latest;
+}
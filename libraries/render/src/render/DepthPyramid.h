@@ -0,0 +1,66 @@
+//
+//  DepthPyramid.h
+//  render/src/render
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_render_DepthPyramid_h
+#define hifi_render_DepthPyramid_h
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <AABox.h>
+
+namespace render {
+
+    // The farthest depth of a frame over the texels of a low resolution grid, and over the coarser levels built on
+    // top of it, for telling which bounds were hidden in that frame. The depths are in the [0, 1] window range of the
+    // view projection the frame was rendered with, the rows go from the bottom of the view up.
+    class DepthPyramid {
+    public:
+        DepthPyramid(std::vector<float> depths, int width, int height, const glm::mat4& viewProjection,
+                     const glm::vec3& eyePosition, const glm::vec3& eyeDirection);
+
+        // true if the box was behind the depth of the frame everywhere it covered. A box partly out of the view,
+        // or crossing the eye plane, never is.
+        bool isOccluded(const AABox& box) const;
+
+        const glm::vec3& getEyePosition() const { return _eyePosition; }
+        const glm::vec3& getEyeDirection() const { return _eyeDirection; }
+
+    private:
+        struct Level {
+            int width;
+            int height;
+            std::vector<float> depths;
+        };
+
+        std::vector<Level> _levels;
+        glm::mat4 _viewProjection;
+        glm::vec3 _eyePosition;
+        glm::vec3 _eyeDirection;
+    };
+    using DepthPyramidPointer = std::shared_ptr<const DepthPyramid>;
+
+    // Where the depth pyramids of a view come back from the gpu thread, for the culling of its next frames
+    class DepthPyramidFeedback {
+    public:
+        void setLatest(const DepthPyramidPointer& pyramid);
+        DepthPyramidPointer getLatest() const;
+
+    private:
+        mutable std::mutex _mutex;
+        DepthPyramidPointer _latest;
+    };
+    using DepthPyramidFeedbackPointer = std::shared_ptr<DepthPyramidFeedback>;
+}
+
+#endif // hifi_render_DepthPyramid_h
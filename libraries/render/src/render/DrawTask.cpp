@@ -80,33 +80,43 @@ void render::renderShapes(const RenderContextPointer& renderContext,
     }
 }
 
-void render::renderStateSortShapes(const RenderContextPointer& renderContext,
-    const ShapePlumberPointer& shapeContext, const ItemBounds& inItems, int maxDrawnItems, const ShapeKey& globalKey) {
+// The items to draw bucketed by pipeline, in the order of the nearest item of each pipeline and in depth order within
+// a pipeline.  The items of the pipeline i go from bucketStarts[i] to the start of the next one.
+struct SortedShapes {
+    std::vector<ShapeKey> pipelines;
+    std::vector<size_t> bucketStarts;
+    std::vector<const Item*> items;
+
+    size_t getBucketEnd(size_t bucket) const {
+        return (bucket + 1 < bucketStarts.size()) ? bucketStarts[bucket + 1] : items.size();
+    }
+};
+using OwnPipelineBucket = std::vector< std::tuple<Item,ShapeKey> >;
+
+static void sortShapes(const RenderContextPointer& renderContext, const ItemBounds& inItems, int maxDrawnItems,
+                       const ShapeKey& globalKey, SortedShapes& sortedShapes, OwnPipelineBucket& ownPipelineBucket) {
     auto& scene = renderContext->_scene;
-    RenderArgs* args = renderContext->args;
 
     int numItemsToDraw = (int)inItems.size();
     if (maxDrawnItems != -1) {
         numItemsToDraw = glm::min(numItemsToDraw, maxDrawnItems);
     }
 
-    using SortedPipelines = std::vector<render::ShapeKey>;
-    using SortedShapes = std::unordered_map<render::ShapeKey, std::vector<Item>, render::ShapeKey::Hash, render::ShapeKey::KeyEqual>;
-    SortedPipelines sortedPipelines;
-    SortedShapes sortedShapes;
-    std::vector< std::tuple<Item,ShapeKey> > ownPipelineBucket;
-
+    // the index of the pipeline of each item, in the depth order of the items
+    std::unordered_map<ShapeKey, uint32_t, ShapeKey::Hash, ShapeKey::KeyEqual> pipelineIndices;
+    std::vector<std::pair<uint32_t, const Item*>> itemPipelines;
+    itemPipelines.reserve(numItemsToDraw);
     for (auto i = 0; i < numItemsToDraw; ++i) {
         auto& item = scene->getItem(inItems[i].id);
         {
             assert(item.getKey().isShape());
             auto key = item.getShapeKey() | globalKey;
             if (key.isValid() && !key.hasOwnPipeline()) {
-                auto& bucket = sortedShapes[key];
-                if (bucket.empty()) {
-                    sortedPipelines.push_back(key);
+                auto pipelineIndex = pipelineIndices.emplace(key, (uint32_t)sortedShapes.pipelines.size());
+                if (pipelineIndex.second) {
+                    sortedShapes.pipelines.push_back(key);
                 }
-                bucket.push_back(item);
+                itemPipelines.emplace_back(pipelineIndex.first->second, &item);
             } else if (key.hasOwnPipeline()) {
                 ownPipelineBucket.push_back( std::make_tuple(item, key) );
             } else {
@@ -117,26 +127,171 @@ void render::renderStateSortShapes(const RenderContextPointer& renderContext,
         }
     }
 
+    // a single pass of radix sort on the pipeline index, it is stable so the buckets keep the depth order
+    auto& bucketStarts = sortedShapes.bucketStarts;
+    bucketStarts.assign(sortedShapes.pipelines.size(), 0);
+    for (auto& itemPipeline : itemPipelines) {
+        if (itemPipeline.first + 1 < bucketStarts.size()) {
+            ++bucketStarts[itemPipeline.first + 1];
+        }
+    }
+    for (size_t bucket = 1; bucket < bucketStarts.size(); ++bucket) {
+        bucketStarts[bucket] += bucketStarts[bucket - 1];
+    }
+
+    std::vector<size_t> bucketEnds = bucketStarts;
+    sortedShapes.items.resize(itemPipelines.size());
+    for (auto& itemPipeline : itemPipelines) {
+        sortedShapes.items[bucketEnds[itemPipeline.first]++] = itemPipeline.second;
+    }
+}
+
+// the items keep their depth order between the ones with the same material
+static void sortBucketsByMaterial(SortedShapes& sortedShapes) {
+    std::vector<std::pair<uint64_t, size_t>> materialKeys;
+    std::vector<const Item*> sortedBucket;
+    for (size_t bucket = 0; bucket < sortedShapes.pipelines.size(); ++bucket) {
+        size_t bucketStart = sortedShapes.bucketStarts[bucket];
+        size_t bucketEnd = sortedShapes.getBucketEnd(bucket);
+        if (bucketEnd - bucketStart < 2) {
+            continue;
+        }
+
+        materialKeys.clear();
+        for (size_t i = bucketStart; i < bucketEnd; ++i) {
+            materialKeys.emplace_back(sortedShapes.items[i]->getMaterialSortKey(), i);
+        }
+        std::sort(materialKeys.begin(), materialKeys.end());
+
+        sortedBucket.clear();
+        for (auto& materialKey : materialKeys) {
+            sortedBucket.push_back(sortedShapes.items[materialKey.second]);
+        }
+        std::copy(sortedBucket.begin(), sortedBucket.end(), sortedShapes.items.begin() + bucketStart);
+    }
+}
+
+static void renderOwnPipelineShapes(RenderArgs* args, const OwnPipelineBucket& ownPipelineBucket) {
+    for (auto& itemAndKey : ownPipelineBucket) {
+        auto& item = std::get<0>(itemAndKey);
+        args->_itemShapeKey = std::get<1>(itemAndKey)._flags.to_ulong();
+        item.render(args);
+    }
+    args->_itemShapeKey = 0;
+}
+
+void render::renderStateSortShapes(const RenderContextPointer& renderContext,
+    const ShapePlumberPointer& shapeContext, const ItemBounds& inItems, int maxDrawnItems, const ShapeKey& globalKey,
+    bool sortByMaterial) {
+    RenderArgs* args = renderContext->args;
+
+    SortedShapes sortedShapes;
+    OwnPipelineBucket ownPipelineBucket;
+    sortShapes(renderContext, inItems, maxDrawnItems, globalKey, sortedShapes, ownPipelineBucket);
+    if (sortByMaterial) {
+        sortBucketsByMaterial(sortedShapes);
+    }
+
     // Then render
-    for (auto& pipelineKey : sortedPipelines) {
-        auto& bucket = sortedShapes[pipelineKey];
+    for (size_t bucket = 0; bucket < sortedShapes.pipelines.size(); ++bucket) {
+        auto& pipelineKey = sortedShapes.pipelines[bucket];
         args->_shapePipeline = shapeContext->pickPipeline(args, pipelineKey);
         if (!args->_shapePipeline) {
             continue;
         }
         args->_itemShapeKey = pipelineKey._flags.to_ulong();
-        for (auto& item : bucket) {
+        for (size_t i = sortedShapes.bucketStarts[bucket]; i < sortedShapes.getBucketEnd(bucket); ++i) {
+            auto& item = *sortedShapes.items[i];
             args->_shapePipeline->prepareShapeItem(args, pipelineKey, item);
             item.render(args);
         }
     }
     args->_shapePipeline = nullptr;
-    for (auto& itemAndKey : ownPipelineBucket) {
-        auto& item = std::get<0>(itemAndKey);
-        args->_itemShapeKey = std::get<1>(itemAndKey)._flags.to_ulong();
-        item.render(args);
+    renderOwnPipelineShapes(args, ownPipelineBucket);
+}
+
+std::chrono::nanoseconds render::renderStateSortShapesInBatches(const RenderContextPointer& renderContext,
+    const ShapePlumberPointer& shapeContext, const ItemBounds& inItems, int maxDrawnItems, const ShapeKey& globalKey,
+    const char* batchName, size_t numBatches, const std::function<void(gpu::Batch& batch)>& setupBatch,
+    std::vector<RenderArgs>& batchArgs, bool sortByMaterial) {
+    using Clock = std::chrono::high_resolution_clock;
+    RenderArgs* args = renderContext->args;
+
+    SortedShapes sortedShapes;
+    OwnPipelineBucket ownPipelineBucket;
+    sortShapes(renderContext, inItems, maxDrawnItems, globalKey, sortedShapes, ownPipelineBucket);
+    if (sortByMaterial) {
+        sortBucketsByMaterial(sortedShapes);
     }
-    args->_itemShapeKey = 0;
+
+    // the pipelines are built here, so the batches only look them up
+    const auto& sortedPipelines = sortedShapes.pipelines;
+    std::vector<size_t> bucketStarts;
+    std::vector<const Item*> items;
+    items.reserve(sortedShapes.items.size());
+    for (size_t bucket = 0; bucket < sortedPipelines.size(); ++bucket) {
+        bucketStarts.push_back(items.size());
+        if (shapeContext->preparePipeline(args, sortedPipelines[bucket])) {
+            items.insert(items.end(), sortedShapes.items.begin() + sortedShapes.bucketStarts[bucket],
+                sortedShapes.items.begin() + sortedShapes.getBucketEnd(bucket));
+        }
+    }
+
+    // the items are spread evenly over the batches in pipeline order, a batch picks the pipeline it starts in again
+    numBatches = std::min(numBatches, items.size());
+    batchArgs.assign(numBatches, *args);
+    std::vector<Clock::duration> batchRecordTimes(numBatches);
+    gpu::doInBatches(batchName, args->_context, numBatches, [&](size_t index, gpu::Batch& batch) {
+        auto start = Clock::now();
+
+        RenderArgs& indexArgs = batchArgs[index];
+        indexArgs._batch = &batch;
+        indexArgs._details = RenderDetails();
+        setupBatch(batch);
+
+        size_t begin = items.size() * index / numBatches;
+        size_t end = items.size() * (index + 1) / numBatches;
+        size_t bucket = std::upper_bound(bucketStarts.begin(), bucketStarts.end(), begin) - bucketStarts.begin() - 1;
+        for (size_t i = begin; i < end; ++i) {
+            bool startsBucket = i == begin;
+            while (bucket + 1 < bucketStarts.size() && bucketStarts[bucket + 1] <= i) {
+                ++bucket;
+                startsBucket = true;
+            }
+            if (startsBucket) {
+                indexArgs._shapePipeline = shapeContext->pickPipeline(&indexArgs, sortedPipelines[bucket]);
+                indexArgs._itemShapeKey = sortedPipelines[bucket]._flags.to_ulong();
+            }
+            indexArgs._shapePipeline->prepareShapeItem(&indexArgs, sortedPipelines[bucket], *items[i]);
+            items[i]->render(&indexArgs);
+        }
+        indexArgs._batch = nullptr;
+
+        batchRecordTimes[index] = Clock::now() - start;
+    });
+
+    Clock::duration recordTime { 0 };
+    for (size_t i = 0; i < numBatches; ++i) {
+        args->_details._materialSwitches += batchArgs[i]._details._materialSwitches;
+        args->_details._trianglesRendered += batchArgs[i]._details._trianglesRendered;
+        args->_details._instancedItems += batchArgs[i]._details._instancedItems;
+        recordTime += batchRecordTimes[i];
+    }
+
+    // the shapes with their own pipelines make no promise about concurrent recording, they go last in a batch of their own
+    if (!ownPipelineBucket.empty()) {
+        auto start = Clock::now();
+        gpu::doInBatch(batchName, args->_context, [&](gpu::Batch& batch) {
+            auto previousBatch = args->_batch;
+            args->_batch = &batch;
+            setupBatch(batch);
+            renderOwnPipelineShapes(args, ownPipelineBucket);
+            args->_batch = previousBatch;
+        });
+        recordTime += Clock::now() - start;
+    }
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(recordTime);
 }
 
 void DrawLight::run(const RenderContextPointer& renderContext, const ItemBounds& inLights) {
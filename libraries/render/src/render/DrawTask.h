@@ -12,13 +12,27 @@
 #ifndef hifi_render_DrawTask_h
 #define hifi_render_DrawTask_h
 
+#include <chrono>
+
 #include "Engine.h"
 
 namespace render {
 
 void renderItems(const RenderContextPointer& renderContext, const ItemBounds& inItems, int maxDrawnItems = -1);
 void renderShapes(const RenderContextPointer& renderContext, const ShapePlumberPointer& shapeContext, const ItemBounds& inItems, int maxDrawnItems = -1, const ShapeKey& globalKey = ShapeKey());
-void renderStateSortShapes(const RenderContextPointer& renderContext, const ShapePlumberPointer& shapeContext, const ItemBounds& inItems, int maxDrawnItems = -1, const ShapeKey& globalKey = ShapeKey());
+// sortByMaterial also groups the shapes of a pipeline by their material sort key, at the cost of their depth order
+void renderStateSortShapes(const RenderContextPointer& renderContext, const ShapePlumberPointer& shapeContext, const ItemBounds& inItems, int maxDrawnItems = -1, const ShapeKey& globalKey = ShapeKey(), bool sortByMaterial = false);
+
+// renderStateSortShapes() recorded into up to numBatches batches at once with gpu::doInBatches(), the sorted items split
+// evenly between them. setupBatch is called first on every batch, since they don't inherit each other's state. The shapes
+// with their own pipeline still go through the calling thread, in one more batch after the others.
+// Only for shapes whose payloads and pipeline batch setters can record concurrently. The batches record with copies of
+// the args kept in batchArgs, the named calls run with them when the frame finishes, so the caller holds on to them
+// until then. Returns the time all the batches took to record, summed over the threads.
+std::chrono::nanoseconds renderStateSortShapesInBatches(const RenderContextPointer& renderContext,
+    const ShapePlumberPointer& shapeContext, const ItemBounds& inItems, int maxDrawnItems, const ShapeKey& globalKey,
+    const char* batchName, size_t numBatches, const std::function<void(gpu::Batch& batch)>& setupBatch,
+    std::vector<RenderArgs>& batchArgs, bool sortByMaterial = false);
 
 class DrawLightConfig : public Job::Config {
     Q_OBJECT
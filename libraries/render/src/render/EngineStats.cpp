@@ -48,6 +48,14 @@ void EngineStats::run(const RenderContextPointer& renderContext) {
 
     config->textureResourcePopulatedGPUMemSize = gpu::Context::getTextureResourcePopulatedGPUMemSize();
 
+    config->textureResourceCommittedPageCount = gpu::Context::getTextureResourceCommittedPageCount();
+    auto textureEvictionCount = gpu::Context::getTextureResourceEvictionCount();
+    auto textureTransferredSize = gpu::Context::getTextureTransferredGPUMemSize();
+    config->textureEvictionRate = (textureEvictionCount - _textureEvictionCount) * frequency;
+    config->textureTransferRate = (textureTransferredSize - _textureTransferredSize) * frequency;
+    _textureEvictionCount = textureEvictionCount;
+    _textureTransferredSize = textureTransferredSize;
+
     renderContext->args->_context->getFrameStats(_gpuStats);
 
     config->frameAPIDrawcallCount = _gpuStats._DSNumAPIDrawcalls;
@@ -64,5 +72,16 @@ void EngineStats::run(const RenderContextPointer& renderContext) {
     config->frameSetPipelineCount = _gpuStats._PSNumSetPipelines;
     config->frameSetInputFormatCount = _gpuStats._ISNumFormatChanges;
 
+    config->frameProgramBinaryHitCount = _gpuStats._PSNumProgramBinaryHits;
+    config->frameProgramBinaryMissCount = _gpuStats._PSNumProgramBinaryMisses;
+
+    const auto& transactionStats = renderContext->_scene->getTransactionStats();
+    config->transactionResetCount = transactionStats.numResets;
+    config->transactionUpdateCount = transactionStats.numUpdates;
+    config->transactionRemoveCount = transactionStats.numRemoves;
+    config->transactionCoalescedCount = transactionStats.numCoalesced;
+    config->transactionPendingItemCount = transactionStats.numPendingItems;
+    config->transactionProcessTime = transactionStats.processTime;
+
     // These new stat values are notified with the "newStats" signal triggered by the timer
 }
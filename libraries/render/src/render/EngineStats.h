@@ -46,6 +46,9 @@ namespace render {
         Q_PROPERTY(quint32 texturePendingGPUTransferCount MEMBER texturePendingGPUTransferCount NOTIFY newStats)
         Q_PROPERTY(qint64 texturePendingGPUTransferSize MEMBER texturePendingGPUTransferSize NOTIFY newStats)
         Q_PROPERTY(qint64 textureResourcePopulatedGPUMemSize MEMBER textureResourcePopulatedGPUMemSize NOTIFY newStats)
+        Q_PROPERTY(quint32 textureResourceCommittedPageCount MEMBER textureResourceCommittedPageCount NOTIFY newStats)
+        Q_PROPERTY(quint32 textureEvictionRate MEMBER textureEvictionRate NOTIFY newStats)
+        Q_PROPERTY(qint64 textureTransferRate MEMBER textureTransferRate NOTIFY newStats)
 
         Q_PROPERTY(quint32 frameAPIDrawcallCount MEMBER frameAPIDrawcallCount NOTIFY newStats)
         Q_PROPERTY(quint32 frameDrawcallCount MEMBER frameDrawcallCount NOTIFY newStats)
@@ -61,6 +64,16 @@ namespace render {
         Q_PROPERTY(quint32 frameSetPipelineCount MEMBER frameSetPipelineCount NOTIFY newStats)
         Q_PROPERTY(quint32 frameSetInputFormatCount MEMBER frameSetInputFormatCount NOTIFY newStats)
 
+        Q_PROPERTY(quint32 frameProgramBinaryHitCount MEMBER frameProgramBinaryHitCount NOTIFY newStats)
+        Q_PROPERTY(quint32 frameProgramBinaryMissCount MEMBER frameProgramBinaryMissCount NOTIFY newStats)
+
+        Q_PROPERTY(quint32 transactionResetCount MEMBER transactionResetCount NOTIFY newStats)
+        Q_PROPERTY(quint32 transactionUpdateCount MEMBER transactionUpdateCount NOTIFY newStats)
+        Q_PROPERTY(quint32 transactionRemoveCount MEMBER transactionRemoveCount NOTIFY newStats)
+        Q_PROPERTY(quint32 transactionCoalescedCount MEMBER transactionCoalescedCount NOTIFY newStats)
+        Q_PROPERTY(quint32 transactionPendingItemCount MEMBER transactionPendingItemCount NOTIFY newStats)
+        Q_PROPERTY(quint64 transactionProcessTime MEMBER transactionProcessTime NOTIFY newStats)
+
 
     public:
         EngineStatsConfig() : Job::Config(true) {}
@@ -87,6 +100,11 @@ namespace render {
         qint64 texturePendingGPUTransferSize { 0 };
         qint64 textureResourcePopulatedGPUMemSize { 0 };
 
+        // pages committed to the sparse textures, the mips demoted and the bytes uploaded per second
+        quint32 textureResourceCommittedPageCount { 0 };
+        quint32 textureEvictionRate { 0 };
+        qint64 textureTransferRate { 0 };
+
         quint32 frameAPIDrawcallCount{ 0 };
         quint32 frameDrawcallCount{ 0 };
         quint32 frameDrawcallRate{ 0 };
@@ -101,11 +119,26 @@ namespace render {
         quint32 frameSetPipelineCount{ 0 };
 
         quint32 frameSetInputFormatCount{ 0 };
+
+        // programs loaded back from the binary cache, and compiled from source
+        quint32 frameProgramBinaryHitCount{ 0 };
+        quint32 frameProgramBinaryMissCount{ 0 };
+
+        // the changes processed by the scene in the frame, the ones that were dropped as useless, the new items left
+        // for the next frames and the time it took in usecs
+        quint32 transactionResetCount { 0 };
+        quint32 transactionUpdateCount { 0 };
+        quint32 transactionRemoveCount { 0 };
+        quint32 transactionCoalescedCount { 0 };
+        quint32 transactionPendingItemCount { 0 };
+        quint64 transactionProcessTime { 0 };
     };
 
     class EngineStats {
         gpu::ContextStats _gpuStats;
         QElapsedTimer _frameTimer;
+        uint32_t _textureEvictionCount { 0 };
+        gpu::Size _textureTransferredSize { 0 };
     public:
         using Config = EngineStatsConfig;
         using JobModel = Job::Model<EngineStats, Config>;
@@ -422,6 +422,14 @@ public:
     class UpdateFunctorInterface {
     public:
         virtual ~UpdateFunctorInterface() {}
+
+        // A concurrent functor only touches the payload of its item, so it can run alongside the concurrent
+        // functors of the other items
+        bool isConcurrent() const { return _isConcurrent; }
+        void setConcurrent(bool concurrent) { _isConcurrent = concurrent; }
+
+    private:
+        bool _isConcurrent { false };
     };
     typedef std::shared_ptr<UpdateFunctorInterface> UpdateFunctorPointer;
 
@@ -433,6 +441,7 @@ public:
         virtual void render(RenderArgs* args) = 0;
 
         virtual const ShapeKey getShapeKey() const = 0;
+        virtual uint64_t getMaterialSortKey() const = 0;
 
         virtual uint32_t fetchMetaSubItems(ItemIDs& subItems) const = 0;
 
@@ -482,6 +491,7 @@ public:
 
     // Shape Type Interface
     const ShapeKey getShapeKey() const;
+    uint64_t getMaterialSortKey() const { return _payload->getMaterialSortKey(); }
 
     // Meta Type Interface
     uint32_t fetchMetaSubItems(ItemIDs& subItems) const { return _payload->fetchMetaSubItems(subItems); }
@@ -532,6 +542,9 @@ template <class T> void payloadRender(const std::shared_ptr<T>& payloadData, Ren
 // When creating a new shape payload you need to create a specialized version, or the ShapeKey will be ownPipeline,
 // implying that the shape will setup its own pipeline without the use of the ShapeKey.
 template <class T> const ShapeKey shapeGetShapeKey(const std::shared_ptr<T>& payloadData) { return ShapeKey::Builder::ownPipeline(); }
+// Shapes drawn with the same material return the same key, so that the state sort can draw them one after the other and
+// skip rebinding the material. 0 when the shape doesn't tell.
+template <class T> uint64_t shapeGetMaterialSortKey(const std::shared_ptr<T>& payloadData) { return 0; }
 
 // Meta Type Interface
 // Meta items act as the grouping object for several sub items (typically shapes).
@@ -557,6 +570,7 @@ public:
 
     // Shape Type interface
     virtual const ShapeKey getShapeKey() const override { return shapeGetShapeKey<T>(_data); }
+    virtual uint64_t getMaterialSortKey() const override { return shapeGetMaterialSortKey<T>(_data); }
 
     // Meta Type Interface
     virtual uint32_t fetchMetaSubItems(ItemIDs& subItems) const override { return metaFetchMetaSubItems<T>(_data, subItems); }
@@ -27,7 +27,12 @@ void RenderFetchCullSortTask::build(JobModel& task, const Varying& input, Varyin
     const auto fetchInput = FetchSpatialTree::Inputs(filter, glm::ivec2(0,0)).asVarying();
     const auto spatialSelection = task.addJob<FetchSpatialTree>("FetchSceneSelection", fetchInput);
     const auto cullInputs = CullSpatialSelection::Inputs(spatialSelection, spatialFilter).asVarying();
-    const auto culledSpatialSelection = task.addJob<CullSpatialSelection>("CullSceneSelection", cullInputs, cullFunctor, RenderDetails::ITEM);
+    const auto frustumCulledSelection = task.addJob<CullSpatialSelection>("CullSceneSelection", cullInputs, cullFunctor, RenderDetails::ITEM);
+
+    // Drop the shapes hidden behind the depth of the previous frames
+    const auto depthPyramidFeedback = render::Varying(std::make_shared<DepthPyramidFeedback>());
+    const auto occlusionInputs = CullOcclusion::Inputs(frustumCulledSelection, depthPyramidFeedback).asVarying();
+    const auto culledSpatialSelection = task.addJob<CullOcclusion>("CullSceneOcclusion", occlusionInputs, RenderDetails::ITEM);
 
     // Layered objects are not culled
     const ItemFilter layeredFilter = ItemFilter::Builder::visibleWorldItems().withTagBits(tagBits, tagMask);
@@ -78,5 +83,5 @@ void RenderFetchCullSortTask::build(JobModel& task, const Varying& input, Varyin
     output = Output(BucketList{ opaques, transparents, lights, metas,
                     filteredLayeredOpaque.getN<FilterLayeredItems::Outputs>(0), filteredLayeredTransparent.getN<FilterLayeredItems::Outputs>(0),
                     filteredLayeredOpaque.getN<FilterLayeredItems::Outputs>(1), filteredLayeredTransparent.getN<FilterLayeredItems::Outputs>(1),
-                    background }, spatialSelection);
+                    background }, spatialSelection, depthPyramidFeedback);
 }
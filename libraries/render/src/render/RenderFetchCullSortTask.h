@@ -34,7 +34,8 @@ public:
     };
 
     using BucketList = render::VaryingArray<render::ItemBounds, Buckets::NUM_BUCKETS>;
-    using Output = render::VaryingSet2<BucketList, render::ItemSpatialTree::ItemSelection>;
+    // the depth pyramid feedback of the view, where the deferred task hands its depth back for the culling
+    using Output = render::VaryingSet3<BucketList, render::ItemSpatialTree::ItemSelection, render::DepthPyramidFeedbackPointer>;
     using JobModel = render::Task::ModelO<RenderFetchCullSortTask, Output>;
 
     RenderFetchCullSortTask() {}
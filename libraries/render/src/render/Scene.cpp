@@ -10,8 +10,16 @@
 //
 #include "Scene.h"
 
+#include <algorithm>
 #include <numeric>
+#include <unordered_set>
+
 #include <gpu/Batch.h>
+#include <NumericalConstants.h>
+#include <Profile.h>
+#include <SharedUtil.h>
+#include <shared/ParallelFor.h>
+
 #include "Logging.h"
 #include "TransitionStage.h"
 #include "HighlightStage.h"
@@ -181,6 +189,28 @@ void Transaction::clear() {
 }
 
 
+const uint64_t Scene::DEFAULT_TRANSACTION_TIME_BUDGET = 2 * USECS_PER_MSEC;
+
+// the new items processed at once while there is time left for the pending items
+static const size_t PENDING_ITEMS_BATCH_SIZE = 256;
+
+// the payloads of the items are reset concurrently in batches this big
+static const size_t PARALLEL_RESETS_MIN_COUNT = 2048;
+static const int PARALLEL_RESETS_MIN_COUNT_PER_THREAD = 512;
+
+// the concurrent updates are run concurrently when there are this many of them
+static const size_t PARALLEL_UPDATES_MIN_COUNT = 1024;
+static const int PARALLEL_UPDATES_MIN_COUNT_PER_THREAD = 256;
+
+static ItemID getChangeItemID(ItemID id) {
+    return id;
+}
+
+template <typename... T>
+ItemID getChangeItemID(const std::tuple<ItemID, T...>& change) {
+    return std::get<0>(change);
+}
+
 Scene::Scene(glm::vec3 origin, float size) :
     _masterSpatialTree(origin, size)
 {
@@ -232,6 +262,7 @@ uint32_t Scene::enqueueFrame() {
  
 void Scene::processTransactionQueue() {
     PROFILE_RANGE(render, __FUNCTION__);
+    auto start = usecTimestampNow();
 
     static TransactionFrames queuedFrames;
     {
@@ -240,12 +271,169 @@ void Scene::processTransactionQueue() {
         queuedFrames.swap(_transactionFrames);
     }
 
+    TransactionStats stats;
+
     // go through the queue of frames and process them
     for (auto& frame : queuedFrames) {
+        stats.numResets += (uint32_t)frame._resetItems.size();
+        stats.numUpdates += (uint32_t)frame._updatedItems.size();
+        stats.numRemoves += (uint32_t)frame._removedItems.size();
+        stats.numCoalesced += coalesceTransaction(frame);
+        if (_transactionTimeBudget > 0) {
+            deferNewItems(frame);
+        }
         processTransactionFrame(frame);
     }
 
     queuedFrames.clear();
+
+    // the new items get what is left of the budget, but at least one batch of them goes through every time
+    if (!_pendingItems.empty()) {
+        processPendingItems(_transactionTimeBudget > 0 ? start + _transactionTimeBudget : UINT64_MAX);
+    }
+
+    stats.numPendingItems = (uint32_t)_pendingItems.size();
+    stats.processTime = usecTimestampNow() - start;
+    _transactionStats = stats;
+    PROFILE_COUNTER_IF_CHANGED(render, "pendingItems", uint32_t, stats.numPendingItems);
+}
+
+uint32_t Scene::coalesceTransaction(Transaction& transaction) {
+    if (transaction._resetItems.size() + transaction._updatedItems.size() < 2) {
+        return 0;
+    }
+    uint32_t numCoalesced = 0;
+
+    // the resets and the updates of a frame are processed before its removes, whatever order they came in
+    std::unordered_set<ItemID> removedIDs(transaction._removedItems.begin(), transaction._removedItems.end());
+
+    // only the last reset of an item counts, and none of them if the item is removed as well
+    std::unordered_set<ItemID> resetIDs;
+    Transaction::Resets resets;
+    resets.reserve(transaction._resetItems.size());
+    for (auto itr = transaction._resetItems.rbegin(); itr != transaction._resetItems.rend(); ++itr) {
+        auto itemID = std::get<0>(*itr);
+        if (removedIDs.find(itemID) == removedIDs.end() && resetIDs.insert(itemID).second) {
+            resets.push_back(std::move(*itr));
+        } else {
+            ++numCoalesced;
+        }
+    }
+    std::reverse(resets.begin(), resets.end());
+    transaction._resetItems.swap(resets);
+
+    // an update without a functor only refreshes the key and the bound of the item, which its reset, its other updates
+    // and its removal do as well
+    std::unordered_set<ItemID> updatedIDs;
+    for (const auto& update : transaction._updatedItems) {
+        if (std::get<1>(update)) {
+            updatedIDs.insert(std::get<0>(update));
+        }
+    }
+    std::unordered_set<ItemID> refreshedIDs;
+    Transaction::Updates updates;
+    updates.reserve(transaction._updatedItems.size());
+    for (auto& update : transaction._updatedItems) {
+        auto itemID = std::get<0>(update);
+        if (!std::get<1>(update) && (resetIDs.count(itemID) > 0 || updatedIDs.count(itemID) > 0 ||
+                                     removedIDs.count(itemID) > 0 || !refreshedIDs.insert(itemID).second)) {
+            ++numCoalesced;
+            continue;
+        }
+        updates.push_back(std::move(update));
+    }
+    transaction._updatedItems.swap(updates);
+
+    return numCoalesced;
+}
+
+void Scene::deferNewItems(Transaction& transaction) {
+    // a new reset of an item that is still pending only comes after the changes that are pending for it
+    Transaction flushedItems;
+    Transaction::Resets resets;
+    resets.reserve(transaction._resetItems.size());
+    for (auto& reset : transaction._resetItems) {
+        auto itemID = std::get<0>(reset);
+        auto pendingItem = _pendingItems.find(itemID);
+        if (pendingItem != _pendingItems.end()) {
+            flushedItems.merge(std::move(pendingItem->second));
+            _pendingItems.erase(pendingItem);
+            resets.push_back(std::move(reset));
+        } else if (itemID >= _items.size() || !_items[itemID].exist()) {
+            _pendingItems[itemID]._resetItems.push_back(std::move(reset));
+            _pendingItemOrder.push_back(itemID);
+        } else {
+            resets.push_back(std::move(reset));
+        }
+    }
+    transaction._resetItems.swap(resets);
+
+    if (!flushedItems._resetItems.empty()) {
+        processTransactionFrame(flushedItems);
+    }
+    if (_pendingItems.empty()) {
+        return;
+    }
+
+    // the other changes of the pending items wait with them
+    auto movePendingChanges = [this](auto& changes, auto pendingChanges) {
+        if (changes.empty()) {
+            return;
+        }
+        typename std::remove_reference<decltype(changes)>::type remainingChanges;
+        remainingChanges.reserve(changes.size());
+        for (auto& change : changes) {
+            auto pendingItem = _pendingItems.find(getChangeItemID(change));
+            if (pendingItem != _pendingItems.end()) {
+                (pendingItem->second.*pendingChanges).push_back(std::move(change));
+            } else {
+                remainingChanges.push_back(std::move(change));
+            }
+        }
+        changes.swap(remainingChanges);
+    };
+    movePendingChanges(transaction._updatedItems, &Transaction::_updatedItems);
+    movePendingChanges(transaction._resetTransitions, &Transaction::_resetTransitions);
+    movePendingChanges(transaction._removeTransitions, &Transaction::_removeTransitions);
+    movePendingChanges(transaction._queriedTransitions, &Transaction::_queriedTransitions);
+    movePendingChanges(transaction._transitionFinishedOperators, &Transaction::_transitionFinishedOperators);
+
+    // a pending item that is removed never makes it to the scene, but what waits for the end of its transition still
+    // needs to know
+    for (auto removedID : transaction._removedItems) {
+        auto pendingItem = _pendingItems.find(removedID);
+        if (pendingItem != _pendingItems.end()) {
+            for (auto& finishedOperator : pendingItem->second._transitionFinishedOperators) {
+                auto func = std::get<1>(finishedOperator);
+                if (func) {
+                    func();
+                }
+            }
+            _pendingItems.erase(pendingItem);
+        }
+    }
+}
+
+void Scene::processPendingItems(uint64_t expiry) {
+    PROFILE_RANGE_EX(render, __FUNCTION__, 0xff00ff00, (uint64_t)_pendingItems.size());
+    do {
+        Transaction pendingItems;
+        size_t numItems = 0;
+        while (numItems < PENDING_ITEMS_BATCH_SIZE && !_pendingItemOrder.empty()) {
+            // the items that were flushed or removed since they were deferred are skipped
+            auto pendingItem = _pendingItems.find(_pendingItemOrder.front());
+            _pendingItemOrder.pop_front();
+            if (pendingItem != _pendingItems.end()) {
+                pendingItems.merge(std::move(pendingItem->second));
+                _pendingItems.erase(pendingItem);
+                ++numItems;
+            }
+        }
+        if (numItems == 0) {
+            break;
+        }
+        processTransactionFrame(pendingItems);
+    } while (usecTimestampNow() < expiry);
 }
 
 void Scene::processTransactionFrame(const Transaction& transaction) {
@@ -291,22 +479,48 @@ void Scene::processTransactionFrame(const Transaction& transaction) {
 }
 
 void Scene::resetItems(const Transaction::Resets& transactions) {
-    for (auto& reset : transactions) {
-        // Access the true item
-        auto itemId = std::get<0>(reset);
-        auto& item = _items[itemId];
-        auto oldKey = item.getKey();
-        auto oldCell = item.getCell();
+    struct ResetItem {
+        ItemKey oldKey;
+        ItemCell oldCell;
+        ItemKey newKey;
+        Item::Bound bound;
+    };
+    std::vector<ResetItem> resetItems(transactions.size());
+
+    // The resets of a frame are for different items once coalesced, so their payloads can be reset concurrently,
+    // only the containers are updated one item at a time
+    auto resetPayloads = [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            // Access the true item
+            auto& item = _items[std::get<0>(transactions[i])];
+            auto& resetItem = resetItems[i];
+            resetItem.oldKey = item.getKey();
+            resetItem.oldCell = item.getCell();
+
+            // Reset the item with a new payload
+            item.resetPayload(std::get<1>(transactions[i]));
+            resetItem.newKey = item.getKey();
+            if (resetItem.newKey.isSpatial()) {
+                resetItem.bound = item.getBound();
+            }
+        }
+    };
+    if (transactions.size() >= PARALLEL_RESETS_MIN_COUNT) {
+        parallelForRanges((int)transactions.size(), PARALLEL_RESETS_MIN_COUNT_PER_THREAD, resetPayloads);
+    } else {
+        resetPayloads(0, (int)transactions.size());
+    }
 
-        // Reset the item with a new payload
-        item.resetPayload(std::get<1>(reset));
-        auto newKey = item.getKey();
+    for (size_t i = 0; i < transactions.size(); ++i) {
+        auto itemId = std::get<0>(transactions[i]);
+        auto& item = _items[itemId];
+        const auto& resetItem = resetItems[i];
 
         // Update the item's container
-        assert((oldKey.isSpatial() == newKey.isSpatial()) || oldKey._flags.none());
-        if (newKey.isSpatial()) {
-            auto newCell = _masterSpatialTree.resetItem(oldCell, oldKey, item.getBound(), itemId, newKey);
-            item.resetCell(newCell, newKey.isSmall());
+        assert((resetItem.oldKey.isSpatial() == resetItem.newKey.isSpatial()) || resetItem.oldKey._flags.none());
+        if (resetItem.newKey.isSpatial()) {
+            auto newCell = _masterSpatialTree.resetItem(resetItem.oldCell, resetItem.oldKey, resetItem.bound, itemId, resetItem.newKey);
+            item.resetCell(newCell, resetItem.newKey.isSmall());
         } else {
             _masterNonspatialSet.insert(itemId);
         }
@@ -336,6 +550,18 @@ void Scene::removeItems(const Transaction::Removes& transactions) {
 }
 
 void Scene::updateItems(const Transaction::Updates& transactions) {
+    auto numConcurrent = std::count_if(transactions.begin(), transactions.end(), [](const Transaction::Update& update) {
+        const auto& functor = std::get<1>(update);
+        return functor && functor->isConcurrent();
+    });
+    if ((size_t)numConcurrent >= PARALLEL_UPDATES_MIN_COUNT) {
+        updateItemsConcurrently(transactions);
+    } else {
+        updateItemsSerially(transactions);
+    }
+}
+
+void Scene::updateItemsSerially(const Transaction::Updates& transactions) {
     for (auto& update : transactions) {
         auto updateID = std::get<0>(update);
         if (updateID == Item::INVALID_ITEM_ID) {
@@ -356,26 +582,107 @@ void Scene::updateItems(const Transaction::Updates& transactions) {
 
         // Update the item
         item.update(std::get<1>(update));
-        auto newKey = item.getKey();
 
-        // Update the item's container
-        if (oldKey.isSpatial() == newKey.isSpatial()) {
-            if (newKey.isSpatial()) {
-                auto newCell = _masterSpatialTree.resetItem(oldCell, oldKey, item.getBound(), updateID, newKey);
-                item.resetCell(newCell, newKey.isSmall());
-            }
+        updateItemContainer(updateID, item, oldKey, oldCell);
+    }
+}
+
+void Scene::updateItemsConcurrently(const Transaction::Updates& transactions) {
+    // The items with a functor that isn't concurrent get all of their updates in order, one item after the other
+    std::unordered_set<ItemID> serialIDs;
+    for (const auto& update : transactions) {
+        const auto& functor = std::get<1>(update);
+        if (functor && !functor->isConcurrent()) {
+            serialIDs.insert(std::get<0>(update));
+        }
+    }
+    Transaction::Updates serialUpdates;
+    std::vector<const Transaction::Update*> concurrentUpdates;
+    concurrentUpdates.reserve(transactions.size());
+    for (const auto& update : transactions) {
+        auto updateID = std::get<0>(update);
+        if (updateID == Item::INVALID_ITEM_ID) {
+            continue;
+        }
+        if (serialIDs.find(updateID) != serialIDs.end()) {
+            serialUpdates.push_back(update);
         } else {
-            if (newKey.isSpatial()) {
-                _masterNonspatialSet.erase(updateID);
+            concurrentUpdates.push_back(&update);
+        }
+    }
 
-                auto newCell = _masterSpatialTree.resetItem(oldCell, oldKey, item.getBound(), updateID, newKey);
-                item.resetCell(newCell, newKey.isSmall());
-            } else {
-                _masterSpatialTree.removeItem(oldCell, oldKey, updateID);
-                item.resetCell();
+    // The updates of an item stay together and in order, the items are updated concurrently
+    std::stable_sort(concurrentUpdates.begin(), concurrentUpdates.end(), [](const Transaction::Update* a, const Transaction::Update* b) {
+        return std::get<0>(*a) < std::get<0>(*b);
+    });
+    struct UpdatedItem {
+        ItemID id;
+        size_t begin;
+        size_t end;
+        bool exists { false };
+        ItemKey oldKey;
+        ItemCell oldCell { Item::INVALID_CELL };
+    };
+    std::vector<UpdatedItem> updatedItems;
+    for (size_t i = 0; i < concurrentUpdates.size(); ++i) {
+        auto updateID = std::get<0>(*concurrentUpdates[i]);
+        if (updatedItems.empty() || updatedItems.back().id != updateID) {
+            UpdatedItem updatedItem;
+            updatedItem.id = updateID;
+            updatedItem.begin = i;
+            updatedItems.push_back(updatedItem);
+        }
+        updatedItems.back().end = i + 1;
+    }
+
+    parallelForRanges((int)updatedItems.size(), PARALLEL_UPDATES_MIN_COUNT_PER_THREAD, [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            auto& updatedItem = updatedItems[i];
+            auto& item = _items[updatedItem.id];
 
-                _masterNonspatialSet.insert(updateID);
+            // If item doesn't exist it cannot be updated
+            if (!item.exist()) {
+                continue;
             }
+            updatedItem.exists = true;
+            updatedItem.oldKey = item.getKey();
+            updatedItem.oldCell = item.getCell();
+            for (size_t j = updatedItem.begin; j < updatedItem.end; ++j) {
+                item.update(std::get<1>(*concurrentUpdates[j]));
+            }
+        }
+    });
+
+    // only the containers are updated one item at a time
+    for (const auto& updatedItem : updatedItems) {
+        if (updatedItem.exists) {
+            updateItemContainer(updatedItem.id, _items[updatedItem.id], updatedItem.oldKey, updatedItem.oldCell);
+        }
+    }
+
+    updateItemsSerially(serialUpdates);
+}
+
+void Scene::updateItemContainer(ItemID updateID, Item& item, const ItemKey& oldKey, ItemCell oldCell) {
+    auto newKey = item.getKey();
+
+    // Update the item's container
+    if (oldKey.isSpatial() == newKey.isSpatial()) {
+        if (newKey.isSpatial()) {
+            auto newCell = _masterSpatialTree.resetItem(oldCell, oldKey, item.getBound(), updateID, newKey);
+            item.resetCell(newCell, newKey.isSmall());
+        }
+    } else {
+        if (newKey.isSpatial()) {
+            _masterNonspatialSet.erase(updateID);
+
+            auto newCell = _masterSpatialTree.resetItem(oldCell, oldKey, item.getBound(), updateID, newKey);
+            item.resetCell(newCell, newKey.isSmall());
+        } else {
+            _masterSpatialTree.removeItem(oldCell, oldKey, updateID);
+            item.resetCell();
+
+            _masterNonspatialSet.insert(updateID);
         }
     }
 }
@@ -12,6 +12,9 @@
 #ifndef hifi_render_Scene_h
 #define hifi_render_Scene_h
 
+#include <deque>
+#include <unordered_map>
+
 #include "Item.h"
 #include "SpatialTree.h"
 #include "Stage.h"
@@ -56,6 +59,13 @@ public:
     void updateItem(ItemID id, const UpdateFunctorPointer& functor);
     void updateItem(ItemID id) { updateItem(id, nullptr); }
 
+    // For the functors that only touch the payload they are given, see UpdateFunctorInterface::isConcurrent
+    template <class T> void updateItemConcurrently(ItemID id, std::function<void(T&)> func) {
+        auto functor = std::make_shared<UpdateFunctor<T>>(func);
+        functor->setConcurrent(true);
+        updateItem(id, functor);
+    }
+
     // Transition (applied to an item) transactions
     void resetTransitionOnItem(ItemID id, Transition::Type transition, ItemID boundId = render::Item::INVALID_ITEM_ID);
     void removeTransitionFromItem(ItemID id);
@@ -158,6 +168,23 @@ public:
     // Process the pending transactions queued
     void processTransactionQueue();
 
+    // The time processTransactionQueue can spend on adding new items, the ones that don't fit are added during the
+    // next calls.  0 adds all of them right away.
+    static const uint64_t DEFAULT_TRANSACTION_TIME_BUDGET; // usecs
+    void setTransactionTimeBudget(uint64_t budget) { _transactionTimeBudget = budget; }
+    uint64_t getTransactionTimeBudget() const { return _transactionTimeBudget; }
+
+    // What the last call to processTransactionQueue did
+    struct TransactionStats {
+        uint32_t numResets { 0 };
+        uint32_t numUpdates { 0 };
+        uint32_t numRemoves { 0 };
+        uint32_t numCoalesced { 0 }; // the resets and updates that other changes of the same items made useless
+        uint32_t numPendingItems { 0 }; // the new items left for the next calls
+        uint64_t processTime { 0 }; // usecs
+    };
+    const TransactionStats& getTransactionStats() const { return _transactionStats; }
+
     // Access a particular selection (empty if doesn't exist)
     // Thread safe
     Selection getSelection(const Selection::Name& name) const;
@@ -211,6 +238,22 @@ protected:
     // Process one transaction frame 
     void processTransactionFrame(const Transaction& transaction);
 
+    // Drops the resets and updates of a transaction frame that other changes of the same items make useless,
+    // returns how many were dropped
+    uint32_t coalesceTransaction(Transaction& transaction);
+
+    // Moves the resets of the new items, and the other changes of the items still pending, to the pending items
+    void deferNewItems(Transaction& transaction);
+
+    // Processes the pending items in the order they came until the expiry
+    void processPendingItems(uint64_t expiry);
+
+    // The new items and the changes that came for them since, processed once there is time for them
+    std::unordered_map<ItemID, Transaction> _pendingItems;
+    std::deque<ItemID> _pendingItemOrder;
+    uint64_t _transactionTimeBudget { DEFAULT_TRANSACTION_TIME_BUDGET };
+    TransactionStats _transactionStats;
+
     // The actual database
     // database of items is protected for editing by a mutex
     std::mutex _itemsMutex;
@@ -222,6 +265,9 @@ protected:
     void resetTransitionFinishedOperator(const Transaction::TransitionFinishedOperators& transactions);
     void removeItems(const Transaction::Removes& transactions);
     void updateItems(const Transaction::Updates& transactions);
+    void updateItemsSerially(const Transaction::Updates& transactions);
+    void updateItemsConcurrently(const Transaction::Updates& transactions);
+    void updateItemContainer(ItemID id, Item& item, const ItemKey& oldKey, ItemCell oldCell);
 
     void resetTransitionItems(const Transaction::TransitionResets& transactions);
     void removeTransitionItems(const Transaction::TransitionRemoves& transactions);
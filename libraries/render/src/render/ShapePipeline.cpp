@@ -119,6 +119,33 @@ void ShapePlumber::addPipeline(const Filter& filter, const gpu::ShaderPointer& p
     }
 }
 
+bool ShapePlumber::preparePipeline(RenderArgs* args, const Key& key) const {
+    if (_pipelineMap.find(key) != _pipelineMap.end()) {
+        return true;
+    }
+
+    // The first time we can't find a pipeline, we should try things to solve that
+    if (_missingKeys.find(key) == _missingKeys.end()) {
+        if (key.isCustom()) {
+            auto factoryIt = ShapePipeline::_globalCustomFactoryMap.find(key.getCustom());
+            if ((factoryIt != ShapePipeline::_globalCustomFactoryMap.end()) && (factoryIt)->second) {
+                // found a factory for the custom key, can now generate a shape pipeline for this case:
+                addPipelineHelper(Filter(key), key, 0, (factoryIt)->second(*this, key, args));
+
+                if (_pipelineMap.find(key) != _pipelineMap.end()) {
+                    return true;
+                }
+            } else {
+                qCDebug(renderlogging) << "ShapePlumber::Couldn't find a custom pipeline factory for " << key.getCustom() << " key is: " << key;
+            }
+        }
+
+       _missingKeys.insert(key);
+        qCDebug(renderlogging) << "ShapePlumber::Couldn't find a pipeline for" << key;
+    }
+    return false;
+}
+
 const ShapePipelinePointer ShapePlumber::pickPipeline(RenderArgs* args, const Key& key) const {
     assert(!_pipelineMap.empty());
     assert(args);
@@ -128,24 +155,10 @@ const ShapePipelinePointer ShapePlumber::pickPipeline(RenderArgs* args, const Ke
 
     auto pipelineIterator = _pipelineMap.find(key);
     if (pipelineIterator == _pipelineMap.end()) {
-        // The first time we can't find a pipeline, we should try things to solve that
-        if (_missingKeys.find(key) == _missingKeys.end()) {
-            if (key.isCustom()) {
-                auto factoryIt = ShapePipeline::_globalCustomFactoryMap.find(key.getCustom());
-                if ((factoryIt != ShapePipeline::_globalCustomFactoryMap.end()) && (factoryIt)->second) {
-                    // found a factory for the custom key, can now generate a shape pipeline for this case:
-                    addPipelineHelper(Filter(key), key, 0, (factoryIt)->second(*this, key, args));
-
-                    return pickPipeline(args, key);
-                } else {
-                    qCDebug(renderlogging) << "ShapePlumber::Couldn't find a custom pipeline factory for " << key.getCustom() << " key is: " << key;
-                }
-            }
-
-           _missingKeys.insert(key);
-            qCDebug(renderlogging) << "ShapePlumber::Couldn't find a pipeline for" << key;
+        if (!preparePipeline(args, key)) {
+            return PipelinePointer(nullptr);
         }
-        return PipelinePointer(nullptr);
+        pipelineIterator = _pipelineMap.find(key);
     }
 
     PipelinePointer shapePipeline(pipelineIterator->second);
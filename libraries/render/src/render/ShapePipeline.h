@@ -302,6 +302,10 @@ public:
 
     const PipelinePointer pickPipeline(RenderArgs* args, const Key& key) const;
 
+    // Builds the pipeline of a key that wasn't asked for yet, if it can, without touching the batch. Once it is done
+    // picking the pipeline is only a lookup, and batches can be recorded with it concurrently.
+    bool preparePipeline(RenderArgs* args, const Key& key) const;
+
 protected:
     void addPipelineHelper(const Filter& filter, Key key, int bit, const PipelinePointer& pipeline) const;
     mutable PipelineMap _pipelineMap;
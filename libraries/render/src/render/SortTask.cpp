@@ -13,6 +13,9 @@
 #include "ShapePipeline.h"
 
 #include <assert.h>
+#include <cstring>
+
+#include <Radix2InplaceSort.h>
 #include <ViewFrustum.h>
 
 using namespace render;
@@ -28,17 +31,16 @@ struct ItemBoundSort {
     ItemBoundSort(float centerDepth, float nearDepth, float farDepth, ItemID id, const AABox& bounds) : _centerDepth(centerDepth), _nearDepth(nearDepth), _farDepth(farDepth), _id(id), _bounds(bounds) {}
 };
 
-struct FrontToBackSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth < right._centerDepth);
-    }
-};
-
-struct BackToFrontSort {
-    bool operator() (const ItemBoundSort& left, const ItemBoundSort& right) {
-        return (left._centerDepth > right._centerDepth);
+// The depth in the high bits and the index of the item in the low ones, so that the keys are unique and the items at
+// the same depth keep their order.  The depths are positive, so their bits sort like the floats do.
+static uint64_t depthSortKey(float depth, bool frontToBack, size_t index) {
+    uint32_t depthBits;
+    memcpy(&depthBits, &depth, sizeof(depthBits));
+    if (!frontToBack) {
+        depthBits = ~depthBits;
     }
-};
+    return ((uint64_t)depthBits << 32) | (uint64_t)index;
+}
 
 void render::depthSortItems(const RenderContextPointer& renderContext, bool frontToBack, 
                             const ItemBounds& inItems, ItemBounds& outItems, AABox* bounds) {
@@ -56,7 +58,7 @@ void render::depthSortItems(const RenderContextPointer& renderContext, bool fron
 
     // Make a local dataset of the center distance and closest point distance
     std::vector<ItemBoundSort> itemBoundSorts;
-    itemBoundSorts.reserve(outItems.size());
+    itemBoundSorts.reserve(inItems.size());
 
     for (auto itemDetails : inItems) {
         auto item = scene->getItem(itemDetails.id);
@@ -66,19 +68,19 @@ void render::depthSortItems(const RenderContextPointer& renderContext, bool fron
         itemBoundSorts.emplace_back(ItemBoundSort(distanceSquared, distanceSquared, distanceSquared, itemDetails.id, bound));
     }
 
-    // sort against Z
-    if (frontToBack) {
-        FrontToBackSort frontToBackSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), frontToBackSort);
-    } else {
-        BackToFrontSort  backToFrontSort;
-        std::sort(itemBoundSorts.begin(), itemBoundSorts.end(), backToFrontSort);
+    // sort against Z, the keys are sorted rather than the items so that only 8 bytes are swapped
+    std::vector<uint64_t> sortKeys;
+    sortKeys.reserve(itemBoundSorts.size());
+    for (size_t i = 0; i < itemBoundSorts.size(); ++i) {
+        sortKeys.push_back(depthSortKey(itemBoundSorts[i]._centerDepth, frontToBack, i));
     }
+    radix2InplaceSort(sortKeys.begin(), sortKeys.end(), Radix2IntegerScanner<uint64_t>());
 
     // Finally once sorted result to a list of itemID and keep uniques
     render::ItemID previousID = Item::INVALID_ITEM_ID;
     if (!bounds) {
-        for (auto& item : itemBoundSorts) {
+        for (auto sortKey : sortKeys) {
+            auto& item = itemBoundSorts[(uint32_t)sortKey];
             if (item._id != previousID) {
                 outItems.emplace_back(ItemBound(item._id, item._bounds));
                 previousID = item._id;
@@ -86,9 +88,10 @@ void render::depthSortItems(const RenderContextPointer& renderContext, bool fron
         }
     } else if (!itemBoundSorts.empty()) {
         if (bounds->isNull()) {
-            *bounds = itemBoundSorts.front()._bounds;
+            *bounds = itemBoundSorts[(uint32_t)sortKeys.front()]._bounds;
         }
-        for (auto& item : itemBoundSorts) {
+        for (auto sortKey : sortKeys) {
+            auto& item = itemBoundSorts[(uint32_t)sortKey];
             if (item._id != previousID) {
                 outItems.emplace_back(ItemBound(item._id, item._bounds));
                 previousID = item._id;
@@ -174,6 +174,15 @@ void ArrayBufferClass::fromScriptValue(const QScriptValue& object, QByteArray& b
         // ArrayBuffer instance (or any JS class that supports coercion into QByteArray*)
         if (QByteArray* buffer = qscriptvalue_cast<QByteArray*>(object.data())) {
             byteArray = *buffer;
+        } else if (QByteArray* buffer = qscriptvalue_cast<QByteArray*>(object.property(BUFFER_PROPERTY_NAME).data())) {
+            // typed array or DataView, the bytes of its view of the buffer, shared when it views all of them
+            int byteOffset = object.property(BYTE_OFFSET_PROPERTY_NAME).toInt32();
+            int byteLength = object.property(BYTE_LENGTH_PROPERTY_NAME).toInt32();
+            if (byteOffset == 0 && byteLength == buffer->size()) {
+                byteArray = *buffer;
+            } else {
+                byteArray = buffer->mid(byteOffset, byteLength);
+            }
         }
     }
 }
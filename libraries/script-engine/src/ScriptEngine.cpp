@@ -15,6 +15,7 @@
 #include <thread>
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QEventLoop>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTimer>
@@ -172,6 +173,9 @@ ScriptEnginePointer scriptEngineFactory(ScriptEngine::Context context,
 }
 
 int ScriptEngine::processLevelMaxRetries { ScriptRequest::MAX_RETRIES };
+// the distinct sources of entity scripts and includes whose programs an engine keeps
+static const int MAX_CACHED_PROGRAMS = 256;
+
 ScriptEngine::ScriptEngine(Context context, const QString& scriptContents, const QString& fileNameString) :
     BaseScriptEngine(),
     _context(context),
@@ -181,6 +185,8 @@ ScriptEngine::ScriptEngine(Context context, const QString& scriptContents, const
     _arrayBufferClass(new ArrayBufferClass(this)),
     _assetScriptingInterface(new AssetScriptingInterface(this))
 {
+    _programCache.setMaxCost(MAX_CACHED_PROGRAMS);
+
     switch (_context) {
         case Context::CLIENT_SCRIPT:
             _type = Type::CLIENT;
@@ -764,6 +770,8 @@ void ScriptEngine::init() {
 
     registerGlobalObject("Entities", entityScriptingInterface.data());
     registerFunction("Entities", "getMultipleEntityProperties", EntityScriptingInterface::getMultipleEntityProperties);
+    registerFunction("Entities", "getMultipleEntityPropertyArrays", EntityScriptingInterface::getMultipleEntityPropertyArrays);
+    registerFunction("Entities", "editEntities", EntityScriptingInterface::editEntities);
     registerGlobalObject("Quat", &_quatLibrary);
     registerGlobalObject("Vec3", &_vec3Library);
     registerGlobalObject("Mat4", &_mat4Library);
@@ -1081,6 +1089,65 @@ QScriptValue ScriptEngine::evaluateInClosure(const QScriptValue& closure, const
     return BaseScriptEngine::evaluateInClosure(closure, program);
 }
 
+QString ScriptEngine::getProgramKey(const QString& sourceCode, const QString& fileName, int lineNumber) {
+    // hashes the UTF-16 of the source, without converting it
+    auto sourceBytes = QByteArray::fromRawData(reinterpret_cast<const char*>(sourceCode.constData()), sourceCode.size() * sizeof(QChar));
+    return fileName + ":" + QString::number(lineNumber) + ":" + QCryptographicHash::hash(sourceBytes, QCryptographicHash::Md5).toHex();
+}
+
+template <typename F>
+void ScriptEngine::withProfile(ScriptProfile::CallType callType, const QUrl& sandboxURL, F&& operation) {
+    // the code that runs inside of another call is counted in that one
+    if (_profileDepth > 0) {
+        operation();
+        return;
+    }
+
+    _profileDepth++;
+    auto start = p_high_resolution_clock::now();
+    operation();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(p_high_resolution_clock::now() - start);
+    _profileDepth--;
+
+    std::lock_guard<std::mutex> lock(_profilesMutex);
+    auto& profile = _profiles[sandboxURL.isEmpty() ? _fileNameString : sandboxURL.toString()];
+    profile.usecs[callType] += elapsed.count();
+    profile.numCalls[callType]++;
+}
+
+void ScriptEngine::updateProfileCounts() {
+    QHash<QString, int> numTimers;
+    for (const auto& timerData : _timerFunctionMap) {
+        numTimers[timerData.definingSandboxURL.isEmpty() ? _fileNameString : timerData.definingSandboxURL.toString()]++;
+    }
+    QHash<QString, int> numEventHandlers;
+    for (const auto& handlersOnEntity : _registeredHandlers) {
+        for (const auto& handlersForEvent : handlersOnEntity) {
+            for (const auto& handler : handlersForEvent) {
+                numEventHandlers[handler.definingSandboxURL.isEmpty() ? _fileNameString : handler.definingSandboxURL.toString()]++;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_profilesMutex);
+    for (auto it = _profiles.begin(); it != _profiles.end(); ++it) {
+        it->numTimers = numTimers.take(it.key());
+        it->numEventHandlers = numEventHandlers.take(it.key());
+    }
+    // the scripts that set up callbacks without having run any code of their own yet
+    for (auto it = numTimers.cbegin(); it != numTimers.cend(); ++it) {
+        _profiles[it.key()].numTimers = it.value();
+    }
+    for (auto it = numEventHandlers.cbegin(); it != numEventHandlers.cend(); ++it) {
+        _profiles[it.key()].numEventHandlers = it.value();
+    }
+}
+
+ScriptProfiles ScriptEngine::getProfiles() const {
+    std::lock_guard<std::mutex> lock(_profilesMutex);
+    return _profiles;
+}
+
 QScriptValue ScriptEngine::evaluate(const QString& sourceCode, const QString& fileName, int lineNumber) {
     QSharedPointer<ScriptEngines> scriptEngines(_scriptEngines);
     if (!scriptEngines || scriptEngines->isStopped()) {
@@ -1101,30 +1168,38 @@ QScriptValue ScriptEngine::evaluate(const QString& sourceCode, const QString& fi
         return result;
     }
 
-    // Check syntax
-    auto syntaxError = lintScript(sourceCode, fileName);
-    if (syntaxError.isError()) {
-        if (!isEvaluating()) {
-            syntaxError.setProperty("detail", "evaluate");
+    // a source that this engine already ran was already linted, and its program compiled
+    QString programKey = getProgramKey(sourceCode, fileName, lineNumber);
+    QScriptProgram program;
+    if (auto cachedProgram = _programCache.object(programKey)) {
+        program = cachedProgram->program;
+    } else {
+        // Check syntax
+        auto syntaxError = lintScript(sourceCode, fileName);
+        if (syntaxError.isError()) {
+            if (!isEvaluating()) {
+                syntaxError.setProperty("detail", "evaluate");
+            }
+            raiseException(syntaxError);
+            maybeEmitUncaughtException("lint");
+            return syntaxError;
         }
-        raiseException(syntaxError);
-        maybeEmitUncaughtException("lint");
-        return syntaxError;
-    }
-    QScriptProgram program { sourceCode, fileName, lineNumber };
-    if (program.isNull()) {
-        // can this happen?
-        auto err = makeError("could not create QScriptProgram for " + fileName);
-        raiseException(err);
-        maybeEmitUncaughtException("compile");
-        return err;
+        program = QScriptProgram { sourceCode, fileName, lineNumber };
+        if (program.isNull()) {
+            // can this happen?
+            auto err = makeError("could not create QScriptProgram for " + fileName);
+            raiseException(err);
+            maybeEmitUncaughtException("compile");
+            return err;
+        }
+        _programCache.insert(programKey, new CachedProgram { program });
     }
 
     QScriptValue result;
-    {
+    withProfile(ScriptProfile::EVALUATE, currentSandboxURL, [&] {
         result = BaseScriptEngine::evaluate(program);
         maybeEmitUncaughtException("evaluate");
-    }
+    });
     return result;
 }
 
@@ -1272,7 +1347,10 @@ void ScriptEngine::run() {
                 auto preUpdate = clock::now();
                 {
                     PROFILE_RANGE(script, "ScriptUpdate");
-                    emit update(deltaTime);
+                    // the update handlers are counted as the event handlers of the script
+                    withProfile(ScriptProfile::EVENT_HANDLER, QUrl(), [&] {
+                        emit update(deltaTime);
+                    });
                 }
                 auto postUpdate = clock::now();
                 auto elapsed = (postUpdate - preUpdate);
@@ -1281,6 +1359,11 @@ void ScriptEngine::run() {
         }
         _lastUpdate = now;
 
+        static const quint64 PROFILE_COUNTS_INTERVAL = USECS_PER_SECOND;
+        if (afterUsecs(_lastProfileCountsUpdate, PROFILE_COUNTS_INTERVAL)) {
+            updateProfileCounts();
+        }
+
         // only clear exceptions if we are not in the middle of evaluating
         if (!isEvaluating() && hasUncaughtException()) {
             qCWarning(scriptengine) << __FUNCTION__ << "---------- UNCAUGHT EXCEPTION --------";
@@ -1423,7 +1506,9 @@ void ScriptEngine::timerFired() {
     if (timerData.function.isValid()) {
         PROFILE_RANGE(script, __FUNCTION__);
         auto preTimer = p_high_resolution_clock::now();
-        callWithEnvironment(timerData.definingEntityIdentifier, timerData.definingSandboxURL, timerData.function, timerData.function, QScriptValueList());
+        withProfile(ScriptProfile::TIMER, timerData.definingSandboxURL, [&] {
+            callWithEnvironment(timerData.definingEntityIdentifier, timerData.definingSandboxURL, timerData.function, timerData.function, QScriptValueList());
+        });
         auto postTimer = p_high_resolution_clock::now();
         auto elapsed = (postTimer - preTimer);
         _totalTimerExecution += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
@@ -2056,7 +2141,9 @@ void ScriptEngine::forwardHandlerCall(const EntityItemID& entityID, const QStrin
             // and the entity scripts may be for entities other than the one this is a handler for.
             // Fortunately, the definingEntityIdentifier captured the entity script id (if any) when the handler was added.
             CallbackData& handler = handlersForEvent[i];
-            callWithEnvironment(handler.definingEntityIdentifier, handler.definingSandboxURL, handler.function, QScriptValue(), eventHandlerArgs);
+            withProfile(ScriptProfile::EVENT_HANDLER, handler.definingSandboxURL, [&] {
+                callWithEnvironment(handler.definingEntityIdentifier, handler.definingSandboxURL, handler.function, QScriptValue(), eventHandlerArgs);
+            });
         }
     }
 }
@@ -2301,85 +2388,98 @@ void ScriptEngine::entityScriptContentAvailable(const EntityItemID& entityID, co
         return;
     }
 
-    // SYNTAX ERRORS
-    auto syntaxError = lintScript(contents, fileName);
-    if (syntaxError.isError()) {
-        auto message = syntaxError.property("formatted").toString();
-        if (message.isEmpty()) {
-            message = syntaxError.toString();
-        }
-        setError(QString("Bad syntax (%1)").arg(message), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        syntaxError.setProperty("detail", entityID.toString());
-        emit unhandledException(syntaxError);
-        return;
-    }
-    QScriptProgram program { contents, fileName };
-    if (program.isNull()) {
-        setError("Bad program (isNull)", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(makeError("program.isNull"));
-        return; // done processing script
-    }
+    // the entity scripts of the same source share the program of the first one, which was already checked
+    QString programKey = getProgramKey(contents, fileName, 1);
+    auto cachedProgram = _programCache.object(programKey);
+    bool passedPreflight = cachedProgram && cachedProgram->passedPreflight;
 
     if (isURL) {
         setParentURL(scriptOrURL);
     }
 
-    // SANITY/PERFORMANCE CHECK USING SANDBOX
-    const int SANDBOX_TIMEOUT = 0.25 * MSECS_PER_SECOND;
-    BaseScriptEngine sandbox;
-    sandbox.setProcessEventsInterval(SANDBOX_TIMEOUT);
-    QScriptValue testConstructor, exception;
-    {
-        QTimer timeout;
-        timeout.setSingleShot(true);
-        timeout.start(SANDBOX_TIMEOUT);
-        connect(&timeout, &QTimer::timeout, [=, &sandbox]{
-                qCDebug(scriptengine) << "ScriptEngine::entityScriptContentAvailable timeout";
-
-                // Guard against infinite loops and non-performant code
-                sandbox.raiseException(
-                    sandbox.makeError(QString("Timed out (entity constructors are limited to %1ms)").arg(SANDBOX_TIMEOUT))
-                );
-        });
-
-        testConstructor = sandbox.evaluate(program);
-
-        if (sandbox.hasUncaughtException()) {
-            exception = sandbox.cloneUncaughtException(QString("(preflight %1)").arg(entityID.toString()));
-            sandbox.clearExceptions();
-        } else if (testConstructor.isError()) {
-            exception = testConstructor;
+    if (!passedPreflight) {
+        // SYNTAX ERRORS
+        auto syntaxError = cachedProgram ? QScriptValue() : lintScript(contents, fileName);
+        if (syntaxError.isError()) {
+            auto message = syntaxError.property("formatted").toString();
+            if (message.isEmpty()) {
+                message = syntaxError.toString();
+            }
+            setError(QString("Bad syntax (%1)").arg(message), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            syntaxError.setProperty("detail", entityID.toString());
+            emit unhandledException(syntaxError);
+            return;
+        }
+        QScriptProgram program = cachedProgram ? cachedProgram->program : QScriptProgram { contents, fileName };
+        if (program.isNull()) {
+            setError("Bad program (isNull)", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(makeError("program.isNull"));
+            return; // done processing script
         }
-    }
 
-    if (exception.isError()) {
-        // create a local copy using makeError to decouple from the sandbox engine
-        exception = makeError(exception);
-        setError(formatException(exception, _enableExtendedJSExceptions.get()), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(exception);
-        return;
-    }
+        // SANITY/PERFORMANCE CHECK USING SANDBOX
+        const int SANDBOX_TIMEOUT = 0.25 * MSECS_PER_SECOND;
+        BaseScriptEngine sandbox;
+        sandbox.setProcessEventsInterval(SANDBOX_TIMEOUT);
+        QScriptValue testConstructor, exception;
+        {
+            QTimer timeout;
+            timeout.setSingleShot(true);
+            timeout.start(SANDBOX_TIMEOUT);
+            connect(&timeout, &QTimer::timeout, [=, &sandbox]{
+                    qCDebug(scriptengine) << "ScriptEngine::entityScriptContentAvailable timeout";
+
+                    // Guard against infinite loops and non-performant code
+                    sandbox.raiseException(
+                        sandbox.makeError(QString("Timed out (entity constructors are limited to %1ms)").arg(SANDBOX_TIMEOUT))
+                    );
+            });
+
+            testConstructor = sandbox.evaluate(program);
 
-    // CONSTRUCTOR VIABILITY
-    if (!testConstructor.isFunction()) {
-        QString testConstructorType = QString(testConstructor.toVariant().typeName());
-        if (testConstructorType == "") {
-            testConstructorType = "empty";
+            if (sandbox.hasUncaughtException()) {
+                exception = sandbox.cloneUncaughtException(QString("(preflight %1)").arg(entityID.toString()));
+                sandbox.clearExceptions();
+            } else if (testConstructor.isError()) {
+                exception = testConstructor;
+            }
         }
-        QString testConstructorValue = testConstructor.toString();
-        if (testConstructorValue.size() > MAX_DEBUG_VALUE_LENGTH) {
-            testConstructorValue = testConstructorValue.mid(0, MAX_DEBUG_VALUE_LENGTH) + "...";
+
+        if (exception.isError()) {
+            // create a local copy using makeError to decouple from the sandbox engine
+            exception = makeError(exception);
+            setError(formatException(exception, _enableExtendedJSExceptions.get()), EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(exception);
+            return;
         }
-        auto message = QString("failed to load entity script -- expected a function, got %1, %2")
-            .arg(testConstructorType).arg(testConstructorValue);
 
-        auto err = makeError(message);
-        err.setProperty("fileName", scriptOrURL);
-        err.setProperty("detail", "(constructor " + entityID.toString() + ")");
+        // CONSTRUCTOR VIABILITY
+        if (!testConstructor.isFunction()) {
+            QString testConstructorType = QString(testConstructor.toVariant().typeName());
+            if (testConstructorType == "") {
+                testConstructorType = "empty";
+            }
+            QString testConstructorValue = testConstructor.toString();
+            if (testConstructorValue.size() > MAX_DEBUG_VALUE_LENGTH) {
+                testConstructorValue = testConstructorValue.mid(0, MAX_DEBUG_VALUE_LENGTH) + "...";
+            }
+            auto message = QString("failed to load entity script -- expected a function, got %1, %2")
+                .arg(testConstructorType).arg(testConstructorValue);
+
+            auto err = makeError(message);
+            err.setProperty("fileName", scriptOrURL);
+            err.setProperty("detail", "(constructor " + entityID.toString() + ")");
+
+            setError("Could not find constructor (" + testConstructorType + ")", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
+            emit unhandledException(err);
+            return; // done processing script
+        }
 
-        setError("Could not find constructor (" + testConstructorType + ")", EntityScriptStatus::ERROR_RUNNING_SCRIPT);
-        emit unhandledException(err);
-        return; // done processing script
+        if (!cachedProgram) {
+            _programCache.insert(programKey, new CachedProgram { program, true });
+        } else {
+            cachedProgram->passedPreflight = true;
+        }
     }
 
     // (this feeds into refreshFileScript)
@@ -2647,7 +2747,9 @@ void ScriptEngine::callEntityScriptMethod(const EntityItemID& entityID, const QS
 
             QScriptValue oldData = this->globalObject().property("Script").property("remoteCallerID");
             this->globalObject().property("Script").setProperty("remoteCallerID", remoteCallerID.toString()); // Make the remoteCallerID available to javascript as a global.
-            callWithEnvironment(entityID, details.definingSandboxURL, entityScript.property(methodName), entityScript, args);
+            withProfile(ScriptProfile::ENTITY_METHOD, details.definingSandboxURL, [&] {
+                callWithEnvironment(entityID, details.definingSandboxURL, entityScript.property(methodName), entityScript, args);
+            });
             this->globalObject().property("Script").setProperty("remoteCallerID", oldData);
         }
     }
@@ -2685,7 +2787,9 @@ void ScriptEngine::callEntityScriptMethod(const EntityItemID& entityID, const QS
             QScriptValueList args;
             args << entityID.toScriptValue(this);
             args << event.toScriptValue(this);
-            callWithEnvironment(entityID, details.definingSandboxURL, entityScript.property(methodName), entityScript, args);
+            withProfile(ScriptProfile::ENTITY_METHOD, details.definingSandboxURL, [&] {
+                callWithEnvironment(entityID, details.definingSandboxURL, entityScript.property(methodName), entityScript, args);
+            });
         }
     }
 }
@@ -2724,7 +2828,9 @@ void ScriptEngine::callEntityScriptMethod(const EntityItemID& entityID, const QS
             args << entityID.toScriptValue(this);
             args << otherID.toScriptValue(this);
             args << collisionToScriptValue(this, collision);
-            callWithEnvironment(entityID, details.definingSandboxURL, entityScript.property(methodName), entityScript, args);
+            withProfile(ScriptProfile::ENTITY_METHOD, details.definingSandboxURL, [&] {
+                callWithEnvironment(entityID, details.definingSandboxURL, entityScript.property(methodName), entityScript, args);
+            });
         }
     }
 }
@@ -12,9 +12,11 @@
 #ifndef hifi_ScriptEngine_h
 #define hifi_ScriptEngine_h
 
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
+#include <QtCore/QCache>
 #include <QtCore/QObject>
 #include <QtCore/QUrl>
 #include <QtCore/QSet>
@@ -22,6 +24,7 @@
 #include <QtCore/QStringList>
 
 #include <QtScript/QScriptEngine>
+#include <QtScript/QScriptProgram>
 
 #include <AnimationCache.h>
 #include <AnimVariant.h>
@@ -40,6 +43,7 @@
 #include "Quat.h"
 #include "Mat4.h"
 #include "ScriptCache.h"
+#include "ScriptProfile.h"
 #include "ScriptUUID.h"
 #include "Vec3.h"
 #include "ConsoleScriptingInterface.h"
@@ -674,6 +678,9 @@ public:
     bool getEntityScriptDetails(const EntityItemID& entityID, EntityScriptDetails &details) const;
     bool hasEntityScriptDetails(const EntityItemID& entityID) const;
 
+    // the time spent in the code of this engine and its entity scripts, safe to call from any thread
+    ScriptProfiles getProfiles() const;
+
     void setScriptEngines(QSharedPointer<ScriptEngines>& scriptEngines) { _scriptEngines = scriptEngines; }
 
 public slots:
@@ -908,6 +915,20 @@ protected:
     QObject* setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot);
     void stopTimer(QTimer* timer);
 
+    // A program that was linted and compiled by this engine, which the entity scripts and includes of the same
+    // source share.  The compiled code of a QScriptProgram belongs to the engine that ran it, so they aren't shared
+    // with the other engines.
+    struct CachedProgram {
+        QScriptProgram program;
+        bool passedPreflight { false };  // an entity script whose constructor was checked in a sandbox
+    };
+    static QString getProgramKey(const QString& sourceCode, const QString& fileName, int lineNumber);
+
+    // times operation in the profile of the script at sandboxURL, the engine's own script when it's empty
+    template <typename F>
+    void withProfile(ScriptProfile::CallType callType, const QUrl& sandboxURL, F&& operation);
+    void updateProfileCounts();
+
     QHash<EntityItemID, RegisteredEventHandlers> _registeredHandlers;
     void forwardHandlerCall(const EntityItemID& entityID, const QString& eventName, QScriptValueList eventHanderArgs);
 
@@ -941,6 +962,7 @@ protected:
     mutable QReadWriteLock _entityScriptsLock { QReadWriteLock::Recursive };
     QHash<EntityItemID, EntityScriptDetails> _entityScripts;
     EntityScriptContentAvailableMap _contentAvailableQueue;
+    QCache<QString, CachedProgram> _programCache;
 
     bool _isThreaded { false };
     QScriptEngineDebugger* _debugger { nullptr };
@@ -968,6 +990,11 @@ protected:
 
     std::chrono::microseconds _totalTimerExecution { 0 };
 
+    mutable std::mutex _profilesMutex;
+    ScriptProfiles _profiles;
+    int _profileDepth { 0 };
+    quint64 _lastProfileCountsUpdate { 0 };
+
     static const QString _SETTINGS_ENABLE_EXTENDED_MODULE_COMPAT;
     static const QString _SETTINGS_ENABLE_EXTENDED_EXCEPTIONS;
 
@@ -8,6 +8,8 @@
 
 #include "ScriptEngines.h"
 
+#include <algorithm>
+
 #include <QtCore/QStandardPaths>
 
 #include <QtWidgets/QApplication>
@@ -296,6 +298,51 @@ QVariantList ScriptEngines::getRunning() {
     return result;
 }
 
+ScriptProfiles ScriptEngines::getScriptProfiles() {
+    ScriptProfiles profiles;
+    QMutexLocker locker(&_allScriptsMutex);
+    for (const auto& engine : _allKnownScriptEngines) {
+        auto engineProfiles = engine->getProfiles();
+        for (auto it = engineProfiles.cbegin(); it != engineProfiles.cend(); ++it) {
+            profiles[it.key()].add(it.value());
+        }
+    }
+    return profiles;
+}
+
+/**jsdoc
+ * The time a script has spent running its code since it started, by what called into it.  The code that runs from inside
+ * of another call, e.g., a script included by a timer, is counted in the outer call.
+ * @typedef {object} ScriptDiscoveryService.ScriptProfile
+ * @property {string} url - The URL of the script, or of the entity script.
+ * @property {number} totalUsecs - The total time spent in the script, in microseconds.
+ * @property {number} evaluateUsecs - The time spent evaluating the script and its includes, in microseconds.
+ * @property {number} evaluateCalls - The number of evaluations.
+ * @property {number} timerUsecs - The time spent in timer callbacks, in microseconds.
+ * @property {number} timerCalls - The number of timer callbacks.
+ * @property {number} eventHandlerUsecs - The time spent in update and entity event handlers, in microseconds.
+ * @property {number} eventHandlerCalls - The number of event handler calls.
+ * @property {number} entityMethodUsecs - The time spent in the methods of an entity script, in microseconds.
+ * @property {number} entityMethodCalls - The number of entity method calls.
+ * @property {number} timers - The number of timers the script has running.
+ * @property {number} eventHandlers - The number of entity event handlers the script has connected.
+ */
+QVariantList ScriptEngines::getProfiles() {
+    auto profiles = getScriptProfiles();
+    QList<QString> urls = profiles.keys();
+    std::sort(urls.begin(), urls.end(), [&](const QString& a, const QString& b) {
+        return profiles.value(a).getTotalUsecs() > profiles.value(b).getTotalUsecs();
+    });
+
+    QVariantList result;
+    for (const auto& url : urls) {
+        QVariantMap profile = profiles.value(url).toVariantMap();
+        profile["url"] = url;
+        result.append(profile);
+    }
+    return result;
+}
+
 void ScriptEngines::loadDefaultScripts() {
     loadScript(DEFAULT_SCRIPTS_LOCATION);
 }
@@ -166,6 +166,22 @@ public:
     // Deprecated because there is no longer a notion of a "local" scripts folder where you would put your personal scripts.
     Q_INVOKABLE QVariantList getLocal();
 
+    /**jsdoc
+     * Gets the time that the running scripts and their entity scripts have spent running their code, to find the scripts
+     * that slow Interface down.
+     * @function ScriptDiscoveryService.getProfiles
+     * @returns {ScriptDiscoveryService.ScriptProfile[]} The profiles of the scripts, the one with the most time first.
+     * @example <caption>Report the script that has run the longest.</caption>
+     * var profiles = ScriptDiscoveryService.getProfiles();
+     * if (profiles.length > 0) {
+     *     print("Slowest script:", JSON.stringify(profiles[0]));
+     * }
+     */
+    Q_INVOKABLE QVariantList getProfiles();
+
+    // the profiles of all the engines, those of the same script added together
+    ScriptProfiles getScriptProfiles();
+
     // FIXME: Move to other Q_PROPERTY declarations.
     Q_PROPERTY(QString defaultScriptsPath READ getDefaultScriptsLocation)
 
@@ -0,0 +1,71 @@
+//
+//  ScriptProfile.h
+//  libraries/script-engine/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ScriptProfile_h
+#define hifi_ScriptProfile_h
+
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVariantMap>
+
+// The time a script spent running its code since it started, by what called into it, and what it has waiting to
+// call it back.  The code that runs from inside of another call is counted in the outer one.
+struct ScriptProfile {
+    enum CallType {
+        EVALUATE = 0,
+        TIMER,
+        EVENT_HANDLER,
+        ENTITY_METHOD,
+        NUM_CALL_TYPES
+    };
+
+    quint64 usecs[NUM_CALL_TYPES] { 0, 0, 0, 0 };
+    quint64 numCalls[NUM_CALL_TYPES] { 0, 0, 0, 0 };
+    int numTimers { 0 };
+    int numEventHandlers { 0 };
+
+    quint64 getTotalUsecs() const {
+        quint64 totalUsecs = 0;
+        for (int type = 0; type < NUM_CALL_TYPES; type++) {
+            totalUsecs += usecs[type];
+        }
+        return totalUsecs;
+    }
+
+    void add(const ScriptProfile& other) {
+        for (int type = 0; type < NUM_CALL_TYPES; type++) {
+            usecs[type] += other.usecs[type];
+            numCalls[type] += other.numCalls[type];
+        }
+        numTimers += other.numTimers;
+        numEventHandlers += other.numEventHandlers;
+    }
+
+    QVariantMap toVariantMap() const {
+        QVariantMap map;
+        map["totalUsecs"] = (double)getTotalUsecs();
+        map["evaluateUsecs"] = (double)usecs[EVALUATE];
+        map["evaluateCalls"] = (double)numCalls[EVALUATE];
+        map["timerUsecs"] = (double)usecs[TIMER];
+        map["timerCalls"] = (double)numCalls[TIMER];
+        map["eventHandlerUsecs"] = (double)usecs[EVENT_HANDLER];
+        map["eventHandlerCalls"] = (double)numCalls[EVENT_HANDLER];
+        map["entityMethodUsecs"] = (double)usecs[ENTITY_METHOD];
+        map["entityMethodCalls"] = (double)numCalls[ENTITY_METHOD];
+        map["timers"] = numTimers;
+        map["eventHandlers"] = numEventHandlers;
+        return map;
+    }
+};
+
+// by the URL of the script, an entity script separate from the engine that runs it
+using ScriptProfiles = QHash<QString, ScriptProfile>;
+
+#endif // hifi_ScriptProfile_h
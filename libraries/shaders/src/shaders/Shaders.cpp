@@ -96,7 +96,7 @@ static Binary loadSpirvResource(const std::string& path) {
         if (file.open(QFile::ReadOnly)) {
             QByteArray bytes = file.readAll();
             result.resize(bytes.size());
-            memcpy(bytes.data(), result.data(), bytes.size());
+            memcpy(result.data(), bytes.data(), bytes.size());
         }
     }
     return result;
@@ -107,8 +107,10 @@ DialectVariantSource loadDialectVariantSource(const std::string& basePath) {
     result.scribe = loadResource(basePath + "scribe");
     result.spirv = loadSpirvResource(basePath + "spirv");
     result.glsl = loadResource(basePath + "glsl");
-    String reflectionJson = loadResource(basePath + "json");
-    result.reflection.parse(reflectionJson);
+    if (!result.reflection.parseBinary(loadSpirvResource(basePath + "reflection"))) {
+        String reflectionJson = loadResource(basePath + "json");
+        result.reflection.parse(reflectionJson);
+    }
     return result;
 }
 
@@ -144,17 +146,24 @@ Source& Source::operator=(const Source& other) {
 
 const Source& Source::get(uint32_t shaderId) {
     static std::once_flag once;
-    static const std::unordered_map<uint32_t, Source::Pointer> shadersById;
     std::call_once(once, [] {
         initShadersResources();
-        auto& map = const_cast<std::unordered_map<uint32_t, Source::Pointer>&>(shadersById);
-        for (const auto& shaderId : allShaders()) {
-            map[shaderId] = loadSource(shaderId);
-        }
     });
-    const auto itr = shadersById.find(shaderId);
+
+    // the shaders are loaded the first time they are asked for, most of them never are in a session
+    static std::mutex mutex;
+    static std::unordered_map<uint32_t, Source::Pointer> shadersById;
     static const Source EMPTY_SHADER;
+    std::unique_lock<std::mutex> lock(mutex);
+    auto itr = shadersById.find(shaderId);
     if (itr == shadersById.end()) {
+        Source::Pointer source;
+        if (QFileInfo((std::string(":/shaders/") + std::to_string(shaderId) + std::string("/name")).c_str()).exists()) {
+            source = loadSource(shaderId);
+        }
+        itr = shadersById.insert({ shaderId, source }).first;
+    }
+    if (!itr->second) {
         return EMPTY_SHADER;
     }
     return *(itr->second);
@@ -314,6 +323,74 @@ void Reflection::parse(const std::string& jsonString) {
 
 }
 
+static const char REFLECTION_MAGIC[] = { 'H', 'F', 'R', 'F' };
+static const uint32_t REFLECTION_VERSION = 1;
+
+// reads what tools/shadergen.py writeBinaryReflection wrote
+class ReflectionReader {
+public:
+    ReflectionReader(const Binary& binary) : _binary(binary) {}
+
+    template <typename T>
+    bool read(T& value) {
+        if (_offset + sizeof(T) > _binary.size()) {
+            return false;
+        }
+        memcpy(&value, _binary.data() + _offset, sizeof(T));
+        _offset += sizeof(T);
+        return true;
+    }
+
+    bool read(Reflection::LocationMap& locations) {
+        uint32_t count;
+        if (!read(count)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            uint16_t nameLength;
+            if (!read(nameLength) || _offset + nameLength > _binary.size()) {
+                return false;
+            }
+            std::string name(reinterpret_cast<const char*>(_binary.data() + _offset), nameLength);
+            _offset += nameLength;
+            int32_t location;
+            if (!read(location)) {
+                return false;
+            }
+            locations[name] = location;
+        }
+        return true;
+    }
+
+private:
+    const Binary& _binary;
+    size_t _offset { 0 };
+};
+
+bool Reflection::parseBinary(const Binary& binary) {
+    if (binary.size() < sizeof(REFLECTION_MAGIC) || memcmp(binary.data(), REFLECTION_MAGIC, sizeof(REFLECTION_MAGIC)) != 0) {
+        return false;
+    }
+    ReflectionReader reader(binary);
+    char magic[sizeof(REFLECTION_MAGIC)];
+    uint32_t version;
+    if (!reader.read(magic) || !reader.read(version) || version != REFLECTION_VERSION) {
+        return false;
+    }
+
+    Reflection result;
+    if (!reader.read(result.inputs) || !reader.read(result.outputs) || !reader.read(result.textures) ||
+        !reader.read(result.uniformBuffers) || !reader.read(result.resourceBuffers)) {
+        throw std::runtime_error("Truncated binary shader reflection");
+    }
+    inputs = std::move(result.inputs);
+    outputs = std::move(result.outputs);
+    textures = std::move(result.textures);
+    uniformBuffers = std::move(result.uniformBuffers);
+    resourceBuffers = std::move(result.resourceBuffers);
+    updateValid();
+    return true;
+}
 
 static void mergeMap(Reflection::LocationMap& output, const Reflection::LocationMap& input) {
     for (const auto& entry : input) {
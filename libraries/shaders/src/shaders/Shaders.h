@@ -73,6 +73,8 @@ struct Reflection {
     using ValidSet = std::unordered_set<int32_t>;
 
     void parse(const std::string& json);
+    // the reflection that shadergen wrote from the JSON at build time, returns false if it isn't in that form
+    bool parseBinary(const Binary& binary);
     void merge(const Reflection& reflection);
 
     bool validInput(int32_t location) const { return validLocation(validInputs, location); }
@@ -122,7 +124,7 @@ struct DialectVariantSource {
     Binary spirv;
     // Regenerated GLSL from the optimized SPIRV
     String glsl;
-    // Shader reflection from the optimized SPIRV
+    // Shader reflection from the optimized SPIRV, from the binary index when the build made one
     Reflection reflection;
 
     bool valid() const { return !scribe.empty(); }
@@ -25,11 +25,67 @@
 
 #include <QBitArray>
 #include <QByteArray>
+#include <QtAlgorithms>
 
 #include "SharedUtil.h"
 
 #include "NumericalConstants.h"
 
+// An encoding starts with as many lead bits as it has bytes, all set but the last, and is followed by the bits of
+// its value.  The bits are in order from the most significant bit of each byte.
+namespace ByteCountCoding {
+    struct EncodedBits {
+        size_t numBytes;
+        int firstValueBit;
+        int endValueBit;
+    };
+
+    // where the value of the encoding at the start of a buffer is, a truncated encoding has no value bits and
+    // takes the whole buffer
+    inline EncodedBits findEncodedBits(const uint8_t* data, size_t size) {
+        size_t byte = 0;
+        while (byte < size && data[byte] == 0xff) {
+            byte++;
+        }
+        if (byte == size) {
+            return { size, 0, 0 };
+        }
+        int numLeadBits = (int)byte * BITS_IN_BYTE + (int)qCountLeadingZeroBits((quint8)~data[byte]) + 1;
+        if ((size_t)numLeadBits > size) {
+            return { size, 0, 0 };
+        }
+        return { (size_t)numLeadBits, numLeadBits, numLeadBits * BITS_IN_BYTE };
+    }
+
+    // calls f with the index in the value of each bit that is set, skipping the zero bytes
+    template<typename F> inline void forEachSetValueBit(const uint8_t* data, const EncodedBits& bits, F f) {
+        for (int byte = bits.firstValueBit / BITS_IN_BYTE; byte * BITS_IN_BYTE < bits.endValueBit; byte++) {
+            // the lead bits that share the first byte are masked out
+            int firstBitInByte = std::max(bits.firstValueBit - byte * BITS_IN_BYTE, 0);
+            uint8_t value = data[byte] & (uint8_t)(0xff >> firstBitInByte);
+            while (value) {
+                int bitInByte = (int)qCountLeadingZeroBits(value);
+                f(byte * BITS_IN_BYTE + bitInByte - bits.firstValueBit);
+                value &= (uint8_t)~(0x80 >> bitInByte);
+            }
+        }
+    }
+
+    // writes the lead bits of an encoding of numBytes into a zeroed buffer
+    inline void writeLeadBits(char* data, int numBytes) {
+        int numSetBits = numBytes - 1;
+        int byte = 0;
+        for (; numSetBits >= BITS_IN_BYTE; numSetBits -= BITS_IN_BYTE) {
+            data[byte++] = (char)0xff;
+        }
+        data[byte] |= (char)(0xff00 >> numSetBits);
+    }
+
+    inline void setBit(char* data, int bit) {
+        data[bit / BITS_IN_BYTE] |= (char)(0x80 >> (bit % BITS_IN_BYTE));
+    }
+}
+
 template<typename T> class ByteCountCoded {
 public:
     T data;
@@ -64,53 +120,24 @@ template<typename T> inline QByteArray& operator>>(QByteArray& in, ByteCountCode
 template<typename T> inline QByteArray ByteCountCoded<T>::encode() const {
     QByteArray output;
 
-    int totalBits = sizeof(data) * BITS_IN_BYTE;
-    int valueBits = totalBits;
-    bool firstValueFound = false;
-    T temp = data;
-    T lastBitMask = (T)(1) << (totalBits - 1);
-
-    // determine the number of bits that the value takes
-    for (int bitAt = 0; bitAt < totalBits; bitAt++) {
-        T bitValue = (temp & lastBitMask) == lastBitMask;
-        if (!firstValueFound) {
-            if (bitValue == 0) {
-                valueBits--;
-            } else {
-                firstValueFound = true;
-            }
-        }
-        temp = temp << 1;
-    }
-    
+    // the number of bits that the value takes
+    const int BITS_IN_QUINT64 = 64;
+    int valueBits = BITS_IN_QUINT64 - (int)qCountLeadingZeroBits((quint64)data);
+
     // calculate the number of total bytes, including our header
     // BITS_IN_BYTE-1 because we need to code the number of bytes in the header
     // + 1 because we always take at least 1 byte, even if number of bits is less than a bytes worth
     int numberOfBytes = (valueBits / (BITS_IN_BYTE - 1)) + 1; 
 
     output.fill(0, numberOfBytes);
-
-    // next pack the number of header bits in, the first N-1 to be set to 1, the last to be set to 0
-    for(int i = 0; i < numberOfBytes; i++) {
-        int outputIndex = i;
-        T bitValue = (i < (numberOfBytes - 1)  ? 1 : 0);
-        char original = output.at(outputIndex / BITS_IN_BYTE);
-        int shiftBy = BITS_IN_BYTE - ((outputIndex % BITS_IN_BYTE) + 1);
-        char thisBit = ( bitValue << shiftBy);
-        output[i / BITS_IN_BYTE] = (original | thisBit);
-    }
-
-    // finally pack the the actual bits from the bit array
-    temp = data;
-    for(int i = numberOfBytes; i < (numberOfBytes + valueBits); i++) {
-        int outputIndex = i;
-        T bitValue = (temp & 1);
-        char original = output.at(outputIndex / BITS_IN_BYTE);
-        int shiftBy = BITS_IN_BYTE - ((outputIndex % BITS_IN_BYTE) + 1);
-        char thisBit = ( bitValue << shiftBy);
-        output[i / BITS_IN_BYTE] = (original | thisBit);
-
-        temp = temp >> 1;
+    ByteCountCoding::writeLeadBits(output.data(), numberOfBytes);
+
+    // the value follows from its least significant bit, only its set bits are visited
+    quint64 remaining = data;
+    while (remaining) {
+        int bit = (int)qCountTrailingZeroBits(remaining);
+        ByteCountCoding::setBit(output.data(), numberOfBytes + bit);
+        remaining &= remaining - 1;
     }
     return output;
 }
@@ -121,57 +148,20 @@ template<typename T> inline size_t ByteCountCoded<T>::decode(const QByteArray& f
 
 template<typename T> inline size_t ByteCountCoded<T>::decode(const char* encodedBuffer, int encodedSize) {
     data = 0; // reset data
-    size_t bytesConsumed = 0;
-    int bitCount = BITS_IN_BYTE * encodedSize;
-
-    int encodedByteCount = 1; // there is at least 1 byte (after the leadBits)
-    int leadBits = 1; // there is always at least 1 lead bit
-    bool inLeadBits = true;
-    int bitAt = 0;
-    int expectedBitCount; // unknown at this point
-    int lastValueBit = 0;
-    T bitValue = 1;
-    
-    for(int byte = 0; byte < encodedSize; byte++) {
-        char originalByte = encodedBuffer[byte];
-        bytesConsumed++;
-        unsigned char maskBit = 128; // LEFT MOST BIT set
-        for(int bit = 0; bit < BITS_IN_BYTE; bit++) {
-            bool bitIsSet = originalByte & maskBit;
-            
-            // Processing of the lead bits
-            if (inLeadBits) {
-                if (bitIsSet) {
-                    encodedByteCount++;
-                    leadBits++;
-                } else {
-                    inLeadBits = false; // once we hit our first 0, we know we're out of the lead bits
-                    expectedBitCount = (encodedByteCount * BITS_IN_BYTE) - leadBits;
-                    lastValueBit = expectedBitCount + bitAt;
-
-                    // check to see if the remainder of our buffer is sufficient
-                    if (expectedBitCount > (bitCount - leadBits)) {
-                        break;
-                    }
-                }
-            } else {
-                if (bitAt > lastValueBit) {
-                    break;
-                }
-                
-                if(bitIsSet) {
-                    data += bitValue;
-                }
-                bitValue *= 2;
-            }
-            bitAt++;
-            maskBit = maskBit >> 1;
-        }
-        if (!inLeadBits && bitAt > lastValueBit) {
-            break;
-        }
+    if (encodedSize <= 0) {
+        return 0;
     }
-    return bytesConsumed;
+
+    const uint8_t* encodedBytes = reinterpret_cast<const uint8_t*>(encodedBuffer);
+    auto bits = ByteCountCoding::findEncodedBits(encodedBytes, (size_t)encodedSize);
+    const int totalBits = sizeof(data) * BITS_IN_BYTE;
+    ByteCountCoding::forEachSetValueBit(encodedBytes, bits, [&](int bit) {
+        // the bits past the size of T are dropped
+        if (bit < totalBits) {
+            data |= (T)1 << bit;
+        }
+    });
+    return bits.numBytes;
 }
 #endif // hifi_ByteCountCoding_h
 
@@ -231,6 +231,51 @@ int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& qu
     return 6;
 }
 
+static const float DELTA_QUANTIZATION_STEPS = 127.0f;
+
+static bool packVec3DeltaToThreeBytes(unsigned char* buffer, const glm::vec3& delta, float range) {
+    if (fabsf(delta.x) > range || fabsf(delta.y) > range || fabsf(delta.z) > range) {
+        return false;
+    }
+    for (int i = 0; i < 3; i++) {
+        buffer[i] = (unsigned char)(int8_t)roundf(delta[i] / range * DELTA_QUANTIZATION_STEPS);
+    }
+    return true;
+}
+
+static glm::vec3 unpackVec3DeltaFromThreeBytes(const unsigned char* buffer, float range) {
+    glm::vec3 delta;
+    for (int i = 0; i < 3; i++) {
+        delta[i] = (float)(int8_t)buffer[i] * (range / DELTA_QUANTIZATION_STEPS);
+    }
+    return delta;
+}
+
+int packOrientationQuatDeltaToThreeBytes(unsigned char* buffer, const glm::quat& reference, const glm::quat& quatInput, float range) {
+    glm::quat delta = glm::inverse(reference) * quatInput;
+    // q and -q are the same rotation, pick the one with the positive real part so that it can be dropped
+    if (delta.w < 0.0f) {
+        delta = -delta;
+    }
+    return packVec3DeltaToThreeBytes(buffer, glm::vec3(delta.x, delta.y, delta.z), range) ? 3 : 0;
+}
+
+int unpackOrientationQuatDeltaFromThreeBytes(const unsigned char* buffer, const glm::quat& reference, glm::quat& quatOutput, float range) {
+    glm::vec3 axis = unpackVec3DeltaFromThreeBytes(buffer, range);
+    float w = sqrtf(glm::max(0.0f, 1.0f - glm::dot(axis, axis)));
+    quatOutput = glm::normalize(reference * glm::quat(w, axis.x, axis.y, axis.z));
+    return 3;
+}
+
+int packFloatVec3DeltaToThreeBytes(unsigned char* buffer, const glm::vec3& reference, const glm::vec3& vecInput, float range) {
+    return packVec3DeltaToThreeBytes(buffer, vecInput - reference, range) ? 3 : 0;
+}
+
+int unpackFloatVec3DeltaFromThreeBytes(const unsigned char* buffer, const glm::vec3& reference, glm::vec3& vecOutput, float range) {
+    vecOutput = reference + unpackVec3DeltaFromThreeBytes(buffer, range);
+    return 3;
+}
+
 bool closeEnough(float a, float b, float relativeError) {
     assert(relativeError >= 0.0f);
     // NOTE: we add EPSILON to the denominator so we can avoid checking for division by zero.
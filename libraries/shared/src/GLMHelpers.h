@@ -118,6 +118,15 @@ int unpackOrientationQuatFromBytes(const unsigned char* buffer, glm::quat& quatO
 int packOrientationQuatToSixBytes(unsigned char* buffer, const glm::quat& quatInput);
 int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& quatOutput);
 
+// Deltas against a reference value that both ends already have. A rotation delta is packed as the vector part of
+// inverse(reference) * quatInput, a vector delta as vecInput - reference, each component quantized into a signed byte
+// over -range..range. The pack functions return 0 and write nothing if the delta is out of range, otherwise the
+// number of bytes written. The unpack functions apply a packed delta to the reference.
+int packOrientationQuatDeltaToThreeBytes(unsigned char* buffer, const glm::quat& reference, const glm::quat& quatInput, float range);
+int unpackOrientationQuatDeltaFromThreeBytes(const unsigned char* buffer, const glm::quat& reference, glm::quat& quatOutput, float range);
+int packFloatVec3DeltaToThreeBytes(unsigned char* buffer, const glm::vec3& reference, const glm::vec3& vecInput, float range);
+int unpackFloatVec3DeltaFromThreeBytes(const unsigned char* buffer, const glm::vec3& reference, glm::vec3& vecOutput, float range);
+
 // Ratios need the be highly accurate when less than 10, but not very accurate above 10, and they
 // are never greater than 1000 to 1, this allows us to encode each component in 16bits
 int packFloatRatioToTwoByte(unsigned char* buffer, float ratio);
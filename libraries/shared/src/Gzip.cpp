@@ -153,3 +153,110 @@ bool gzip(QByteArray source, QByteArray &destination, int compressionLevel) {
     deflateEnd(&strm);
     return status == Z_STREAM_END;
 }
+
+const int ZLIB_SIZE_HEADER_BYTES = 4;
+const int ZLIB_FLAGS_OFFSET = ZLIB_SIZE_HEADER_BYTES + 1;
+const unsigned char ZLIB_PRESET_DICTIONARY_FLAG = 0x20;
+
+// a corrupt size header shouldn't make us allocate more than any octree or entity message could hold
+const quint32 MAX_INFLATED_WITH_DICTIONARY_SIZE = 16 * 1024 * 1024;
+
+bool deflateWithDictionary(const unsigned char* source, int length, const QByteArray& dictionary,
+                           QByteArray& destination, int compressionLevel) {
+    destination.clear();
+
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+
+    int status = deflateInit(&strm, qMax(Z_DEFAULT_COMPRESSION, qMin(9, compressionLevel)));
+    if (status != Z_OK) {
+        return false;
+    }
+
+    status = deflateSetDictionary(&strm, (const Bytef*)dictionary.constData(), (uInt)dictionary.size());
+    if (status != Z_OK) {
+        deflateEnd(&strm);
+        return false;
+    }
+
+    destination.resize(ZLIB_SIZE_HEADER_BYTES + (int)deflateBound(&strm, (uLong)length));
+    unsigned char* out = (unsigned char*)destination.data();
+    out[0] = (length >> 24) & 0xff;
+    out[1] = (length >> 16) & 0xff;
+    out[2] = (length >> 8) & 0xff;
+    out[3] = length & 0xff;
+
+    strm.next_in = (Bytef*)source;
+    strm.avail_in = (uInt)length;
+    strm.next_out = out + ZLIB_SIZE_HEADER_BYTES;
+    strm.avail_out = (uInt)(destination.size() - ZLIB_SIZE_HEADER_BYTES);
+
+    status = deflate(&strm, Z_FINISH);
+    deflateEnd(&strm);
+
+    if (status != Z_STREAM_END) {
+        destination.clear();
+        return false;
+    }
+
+    destination.resize(ZLIB_SIZE_HEADER_BYTES + (int)strm.total_out);
+    return true;
+}
+
+bool inflateWithDictionary(const unsigned char* source, int length, const QByteArray& dictionary, QByteArray& destination) {
+    destination.clear();
+    if (length <= ZLIB_SIZE_HEADER_BYTES) {
+        return false;
+    }
+
+    quint32 expectedSize = ((quint32)source[0] << 24) | ((quint32)source[1] << 16) | ((quint32)source[2] << 8) | source[3];
+    if (expectedSize > MAX_INFLATED_WITH_DICTIONARY_SIZE) {
+        return false;
+    }
+
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.next_in = (Bytef*)source + ZLIB_SIZE_HEADER_BYTES;
+    strm.avail_in = (uInt)(length - ZLIB_SIZE_HEADER_BYTES);
+
+    int status = inflateInit(&strm);
+    if (status != Z_OK) {
+        return false;
+    }
+
+    destination.resize((int)expectedSize);
+    strm.next_out = (Bytef*)destination.data();
+    strm.avail_out = (uInt)expectedSize;
+
+    status = inflate(&strm, Z_FINISH);
+    if (status == Z_NEED_DICT) {
+        status = inflateSetDictionary(&strm, (const Bytef*)dictionary.constData(), (uInt)dictionary.size());
+        if (status == Z_OK) {
+            status = inflate(&strm, Z_FINISH);
+        }
+    }
+    inflateEnd(&strm);
+
+    if (status != Z_STREAM_END || strm.total_out != expectedSize) {
+        destination.clear();
+        return false;
+    }
+    return true;
+}
+
+bool inflateInto(const unsigned char* source, int length, unsigned char* destination, int destinationLength) {
+    if (length <= 0 || destinationLength < 0) {
+        return false;
+    }
+    uLongf inflatedLength = (uLongf)destinationLength;
+    int status = uncompress((Bytef*)destination, &inflatedLength, (const Bytef*)source, (uLong)length);
+    return status == Z_OK && inflatedLength == (uLongf)destinationLength;
+}
+
+bool needsDictionaryToInflate(const unsigned char* source, int length) {
+    return length > ZLIB_FLAGS_OFFSET && (source[ZLIB_FLAGS_OFFSET] & ZLIB_PRESET_DICTIONARY_FLAG);
+}
@@ -24,4 +24,18 @@ bool gzip(QByteArray source, QByteArray &destination, int compressionLevel = -1)
 
 bool gunzip(QByteArray source, QByteArray &destination);
 
+// zlib compression with a preset dictionary, framed like qCompress: the uncompressed size as a big endian
+// quint32 followed by the zlib stream, which flags that it needs the dictionary. Both ends must use the same dictionary.
+bool deflateWithDictionary(const unsigned char* source, int length, const QByteArray& dictionary,
+                           QByteArray& destination, int compressionLevel = -1);
+
+bool inflateWithDictionary(const unsigned char* source, int length, const QByteArray& dictionary, QByteArray& destination);
+
+// inflates a zlib stream, without the qCompress size header, into a buffer that must be exactly the size of the
+// inflated data
+bool inflateInto(const unsigned char* source, int length, unsigned char* destination, int destinationLength);
+
+// true if data framed like qCompress holds a zlib stream that was compressed with a preset dictionary
+bool needsDictionaryToInflate(const unsigned char* source, int length);
+
 #endif
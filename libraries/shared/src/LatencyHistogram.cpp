@@ -0,0 +1,71 @@
+//
+//  LatencyHistogram.cpp
+//  libraries/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "LatencyHistogram.h"
+
+void LatencyHistogram::record(quint64 usecs) {
+    // bucket 0 is under a microsecond, bucket N covers [2^(N - 1), 2^N) and the last bucket everything above
+    int bucket = 0;
+    while (usecs >> bucket && bucket < NUM_BUCKETS - 1) {
+        ++bucket;
+    }
+
+    _buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    _totalUsecs.fetch_add(usecs, std::memory_order_relaxed);
+
+    auto maxUsecs = _maxUsecs.load(std::memory_order_relaxed);
+    while (usecs > maxUsecs && !_maxUsecs.compare_exchange_weak(maxUsecs, usecs, std::memory_order_relaxed)) {}
+}
+
+uint32_t LatencyHistogram::getTotalCount() const {
+    uint32_t count = 0;
+    for (auto& bucket : _buckets) {
+        count += bucket.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+QString LatencyHistogram::getBucketName(int bucket) {
+    return bucket < NUM_BUCKETS - 1 ? QString("under %1us").arg(1 << bucket) : QString("over %1us").arg(1 << (bucket - 1));
+}
+
+QJsonObject LatencyHistogram::sample(uint32_t& count) {
+    QJsonObject bucketsObject;
+    count = 0;
+
+    for (int i = 0; i < NUM_BUCKETS; ++i) {
+        auto bucketCount = _buckets[i].exchange(0, std::memory_order_relaxed);
+        if (bucketCount > 0) {
+            // the index prefix keeps the buckets in order in the stats page
+            auto key = QString("%1_%2").arg(i, 2, 10, QChar('0')).arg(getBucketName(i).replace(' ', '_'));
+            bucketsObject[key] = (double)bucketCount;
+            count += bucketCount;
+        }
+    }
+
+    auto totalUsecs = _totalUsecs.exchange(0, std::memory_order_relaxed);
+    auto maxUsecs = _maxUsecs.exchange(0, std::memory_order_relaxed);
+
+    QJsonObject histogramObject;
+    if (count > 0) {
+        histogramObject["avg_usecs"] = (double)totalUsecs / count;
+        histogramObject["max_usecs"] = (double)maxUsecs;
+        histogramObject["buckets"] = bucketsObject;
+    }
+    return histogramObject;
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : _buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    _totalUsecs.store(0, std::memory_order_relaxed);
+    _maxUsecs.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,47 @@
+//
+//  LatencyHistogram.h
+//  libraries/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_LatencyHistogram_h
+#define hifi_LatencyHistogram_h
+
+#include <array>
+#include <atomic>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+// A histogram of durations, its buckets are powers of two of microseconds.
+//   Recording only does relaxed atomic increments, so any thread can record while another one reads.
+class LatencyHistogram {
+public:
+    static const int NUM_BUCKETS = 16;
+
+    void record(quint64 usecs);
+
+    uint32_t getCount(int bucket) const { return _buckets[bucket].load(std::memory_order_relaxed); }
+    uint32_t getTotalCount() const;
+    quint64 getTotalUsecs() const { return _totalUsecs.load(std::memory_order_relaxed); }
+    quint64 getMaxUsecs() const { return _maxUsecs.load(std::memory_order_relaxed); }
+
+    // "under 8us" and so on, the last bucket is "over 16384us"
+    static QString getBucketName(int bucket);
+
+    // the non-empty buckets as json, and how many durations went into them, then starts over
+    QJsonObject sample(uint32_t& count);
+
+    void reset();
+
+private:
+    std::array<std::atomic<uint32_t>, NUM_BUCKETS> _buckets {};
+    std::atomic<uint64_t> _totalUsecs { 0 };
+    std::atomic<uint64_t> _maxUsecs { 0 };
+};
+
+#endif // hifi_LatencyHistogram_h
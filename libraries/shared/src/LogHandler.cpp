@@ -22,16 +22,40 @@
 #include <QtCore/QDateTime>
 #include <QtCore/QDebug>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QStringList>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 
+#include "NumericalConstants.h"
+
 QMutex LogHandler::_mutex(QMutex::Recursive);
 
+// how long the writer waits for messages before it checks for the summaries of the suppressed ones
+static const int WRITER_WAIT_MSECS = 1000;
+
 LogHandler& LogHandler::getInstance() {
     static LogHandler staticInstance;
     return staticInstance;
 }
 
+LogHandler::LogHandler() :
+    _queueHead(&_queueStub),
+    _queueTail(&_queueStub)
+{
+}
+
+LogHandler::~LogHandler() {
+    {
+        std::unique_lock<std::mutex> lock(_wakeMutex);
+        _stopWriter = true;
+    }
+    _hasMessages.notify_one();
+    if (_writerThread.joinable()) {
+        _writerThread.join();
+    }
+    flushMessages();
+}
+
 const char* stringForLogType(LogMsgType msgType) {
     switch (msgType) {
         case LogInfo:
@@ -77,72 +101,275 @@ void LogHandler::setShouldDisplayMilliseconds(bool shouldDisplayMilliseconds) {
     _shouldDisplayMilliseconds = shouldDisplayMilliseconds;
 }
 
+void LogHandler::setMaxMessagesPerCategoryPerSecond(int maxMessagesPerCategoryPerSecond) {
+    _maxMessagesPerCategoryPerSecond = maxMessagesPerCategoryPerSecond;
+}
+
 
 void LogHandler::flushRepeatedMessages() {
-    QMutexLocker lock(&_mutex);
+    QStringList repeatLogMessages;
+    {
+        QMutexLocker lock(&_mutex);
 
-    // New repeat-suppress scheme:
-    for (int m = 0; m < (int)_repeatedMessageRecords.size(); ++m) {
-        int repeatCount = _repeatedMessageRecords[m].repeatCount;
-        if (repeatCount > 1) {
-            QString repeatLogMessage = QString().setNum(repeatCount) + " repeated log entries - Last entry: \"" 
+        // New repeat-suppress scheme:
+        for (int m = 0; m < (int)_repeatedMessageRecords.size(); ++m) {
+            int repeatCount = _repeatedMessageRecords[m].repeatCount;
+            if (repeatCount > 1) {
+                repeatLogMessages << QString().setNum(repeatCount) + " repeated log entries - Last entry: \""
                     + _repeatedMessageRecords[m].repeatString + "\"";
-            printMessage(LogSuppressed, QMessageLogContext(), repeatLogMessage);
-            _repeatedMessageRecords[m].repeatCount = 0;
-            _repeatedMessageRecords[m].repeatString = QString();
+                _repeatedMessageRecords[m].repeatCount = 0;
+                _repeatedMessageRecords[m].repeatString = QString();
+            }
         }
     }
+
+    // queued once _mutex is unlocked, the writer locks it to format the messages
+    for (const auto& repeatLogMessage : repeatLogMessages) {
+        queueMessage(LogSuppressed, QMessageLogContext(), repeatLogMessage);
+    }
 }
 
-QString LogHandler::printMessage(LogMsgType type, const QMessageLogContext& context, const QString& message) {
-    if (message.isEmpty()) {
-        return QString();
+QString LogHandler::formatMessage(LogMsgType type, qint64 time, size_t threadID, const char* category, const char* file,
+                                 const QString& message) {
+    QString targetName;
+    bool shouldOutputProcessID;
+    bool shouldOutputThreadID;
+    bool shouldDisplayMilliseconds;
+    {
+        QMutexLocker lock(&_mutex);
+        targetName = _targetName;
+        shouldOutputProcessID = _shouldOutputProcessID;
+        shouldOutputThreadID = _shouldOutputThreadID;
+        shouldDisplayMilliseconds = _shouldDisplayMilliseconds;
     }
-    QMutexLocker lock(&_mutex);
 
     // log prefix is in the following format
     // [TIMESTAMP] [DEBUG] [PID] [TID] [TARGET] logged string
 
     const QString* dateFormatPtr = &DATE_STRING_FORMAT;
-    if (_shouldDisplayMilliseconds) {
+    if (shouldDisplayMilliseconds) {
         dateFormatPtr = &DATE_STRING_FORMAT_WITH_MILLISECONDS;
     }
 
-    QString prefixString = QString("[%1] [%2] [%3]").arg(QDateTime::currentDateTime().toString(*dateFormatPtr),
-        stringForLogType(type), context.category);
+    QString prefixString = QString("[%1] [%2] [%3]").arg(QDateTime::fromMSecsSinceEpoch(time).toString(*dateFormatPtr),
+        stringForLogType(type), category);
 
-    if (_shouldOutputProcessID) {
+    if (shouldOutputProcessID) {
         prefixString.append(QString(" [%1]").arg(QCoreApplication::applicationPid()));
     }
 
-    if (_shouldOutputThreadID) {
-        size_t threadID = (size_t)QThread::currentThreadId();
+    if (shouldOutputThreadID) {
         prefixString.append(QString(" [%1]").arg(threadID));
     }
 
-    if (!_targetName.isEmpty()) {
-        prefixString.append(QString(" [%1]").arg(_targetName));
+    if (!targetName.isEmpty()) {
+        prefixString.append(QString(" [%1]").arg(targetName));
     }
 
     // for [qml] console.* messages include an abbreviated source filename
-    if (context.category && context.file && !strcmp("qml", context.category)) {
-        if (const char* basename = strrchr(context.file, '/')) {
+    if (category && file && !strcmp("qml", category)) {
+        if (const char* basename = strrchr(file, '/')) {
             prefixString.append(QString(" [%1]").arg(basename+1));
         }
     }
 
-    QString logMessage = QString("%1 %2\n").arg(prefixString, message.split('\n').join('\n' + prefixString + " "));
+    return QString("%1 %2\n").arg(prefixString, message.split('\n').join('\n' + prefixString + " "));
+}
+
+QString LogHandler::printMessage(LogMsgType type, const QMessageLogContext& context, const QString& message) {
+    if (message.isEmpty()) {
+        return QString();
+    }
+
+    QString logMessage = formatMessage(type, QDateTime::currentMSecsSinceEpoch(), (size_t)QThread::currentThreadId(),
+                                       context.category, context.file, message);
+
+    auto queuedMessage = new QueuedMessage();
+    queuedMessage->type = type;
+    queuedMessage->category = context.category;
+    queuedMessage->message = logMessage;
+    queuedMessage->isFormatted = true;
+    enqueueMessage(queuedMessage);
+
+    return logMessage;
+}
+
+void LogHandler::queueMessage(LogMsgType type, const QMessageLogContext& context, const QString& message) {
+    if (message.isEmpty()) {
+        return;
+    }
+
+    auto queuedMessage = new QueuedMessage();
+    queuedMessage->type = type;
+    queuedMessage->time = QDateTime::currentMSecsSinceEpoch();
+    queuedMessage->threadID = (size_t)QThread::currentThreadId();
+    queuedMessage->category = context.category;
+    queuedMessage->file = context.file;
+    queuedMessage->message = message;
+    enqueueMessage(queuedMessage);
+}
+
+void LogHandler::enqueueMessage(QueuedMessage* queuedMessage) {
+    std::call_once(_writerStarted, [this] {
+        _writerThread = std::thread([this] { runWriter(); });
+    });
+
+    bool isFatal = queuedMessage->type == LogFatal;
+    _numQueued++;
+    pushMessage(queuedMessage);
+
+    if (isFatal || _stopWriter) {
+        // the process ends right after a fatal message, and nothing writes the messages once the writer stopped
+        flushMessages();
+    } else if (_isWriterWaiting) {
+        {
+            std::unique_lock<std::mutex> lock(_wakeMutex);
+        }
+        _hasMessages.notify_one();
+    }
+}
+
+void LogHandler::pushMessage(QueuedMessage* queuedMessage) {
+    queuedMessage->next.store(nullptr, std::memory_order_relaxed);
+    QueuedMessage* previous = _queueHead.exchange(queuedMessage, std::memory_order_acq_rel);
+    previous->next.store(queuedMessage, std::memory_order_release);
+}
+
+LogHandler::QueuedMessage* LogHandler::popMessage() {
+    QueuedMessage* tail = _queueTail;
+    QueuedMessage* next = tail->next.load(std::memory_order_acquire);
+    if (tail == &_queueStub) {
+        if (!next) {
+            return nullptr;
+        }
+        _queueTail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next) {
+        _queueTail = next;
+        return tail;
+    }
+
+    if (tail != _queueHead.load(std::memory_order_acquire)) {
+        // a message is being pushed after this one
+        return nullptr;
+    }
+
+    // the stub goes back in so that the last message can be taken out
+    pushMessage(&_queueStub);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next) {
+        _queueTail = next;
+        return tail;
+    }
+    return nullptr;
+}
+
+void LogHandler::flushMessages() {
+    std::unique_lock<std::mutex> lock(_writeMutex);
+    writeQueuedMessages();
+}
+
+void LogHandler::runWriter() {
+    bool stop = false;
+    while (!stop) {
+        {
+            std::unique_lock<std::mutex> lock(_wakeMutex);
+            _isWriterWaiting = true;
+            _hasMessages.wait_for(lock, std::chrono::milliseconds(WRITER_WAIT_MSECS), [this] {
+                return _stopWriter || _numQueued > _numWritten;
+            });
+            _isWriterWaiting = false;
+            stop = _stopWriter;
+        }
 
-    fprintf(stdout, "%s", qPrintable(logMessage));
+        std::unique_lock<std::mutex> lock(_writeMutex);
+        writeQueuedMessages();
+        writeSuppressedSummaries(QDateTime::currentMSecsSinceEpoch(), stop);
+    }
+}
+
+void LogHandler::writeQueuedMessages() {
+    uint64_t numQueued = _numQueued;
+    if (_numWritten >= numQueued) {
+        return;
+    }
+
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+    while (_numWritten < numQueued) {
+        QueuedMessage* queuedMessage = popMessage();
+        if (!queuedMessage) {
+            // another thread is in the middle of pushing the next message
+            std::this_thread::yield();
+            continue;
+        }
+        writeMessage(queuedMessage, now);
+        delete queuedMessage;
+        _numWritten++;
+    }
+    fflush(stdout);
+}
+
+void LogHandler::writeMessage(QueuedMessage* queuedMessage, qint64 now) {
+    int maxMessagesPerSecond = _maxMessagesPerCategoryPerSecond;
+    if (maxMessagesPerSecond > 0 && (queuedMessage->type == LogDebug || queuedMessage->type == LogInfo)) {
+        auto& rate = _categoryRates[queuedMessage->category];
+        if (now - rate.windowStart >= (qint64)MSECS_PER_SECOND) {
+            if (rate.suppressed > 0) {
+                writeSuppressedSummary(queuedMessage->category, rate.suppressed, now);
+                rate.suppressed = 0;
+            }
+            rate.windowStart = now;
+            rate.count = 0;
+        }
+        if (++rate.count > maxMessagesPerSecond) {
+            rate.suppressed++;
+            return;
+        }
+    }
+
+    if (queuedMessage->isFormatted) {
+        writeString(queuedMessage->message);
+    } else {
+        writeString(formatMessage(queuedMessage->type, queuedMessage->time, queuedMessage->threadID,
+                                  queuedMessage->category.constData(), queuedMessage->file.constData(), queuedMessage->message));
+    }
+}
+
+void LogHandler::writeSuppressedSummaries(qint64 now, bool all) {
+    for (auto itr = _categoryRates.begin(); itr != _categoryRates.end();) {
+        auto& rate = itr.value();
+        bool hasWindowEnded = now - rate.windowStart >= (qint64)MSECS_PER_SECOND;
+        if (rate.suppressed > 0 && (all || hasWindowEnded)) {
+            writeSuppressedSummary(itr.key(), rate.suppressed, now);
+            rate.suppressed = 0;
+        }
+        if (hasWindowEnded && rate.suppressed == 0) {
+            itr = _categoryRates.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+}
+
+void LogHandler::writeSuppressedSummary(const QByteArray& category, int numSuppressed, qint64 now) {
+    QString summary = QString("%1 messages were suppressed in the last second").arg(numSuppressed);
+    writeString(formatMessage(LogSuppressed, now, 0, category.constData(), nullptr, summary));
+}
+
+void LogHandler::writeString(const QString& logMessage) {
+    QByteArray logBytes = logMessage.toLocal8Bit();
+    fwrite(logBytes.constData(), 1, logBytes.size(), stdout);
 #ifdef Q_OS_WIN
     // On windows, this will output log lines into the Visual Studio "output" tab
-    OutputDebugStringA(qPrintable(logMessage));
+    OutputDebugStringA(logBytes.constData());
 #endif
-    return logMessage;
 }
 
 void LogHandler::verboseMessageHandler(QtMsgType type, const QMessageLogContext& context, const QString& message) {
-    getInstance().printMessage((LogMsgType) type, context, message);
+    getInstance().queueMessage((LogMsgType) type, context, message);
 }
 
 void LogHandler::setupRepeatedMessageFlusher() {
@@ -166,16 +393,22 @@ int LogHandler::newRepeatedMessageID() {
 
 void LogHandler::printRepeatedMessage(int messageID, LogMsgType type, const QMessageLogContext& context,
                                       const QString& message) {
-    QMutexLocker lock(&_mutex);
-    if (messageID >= _currentMessageID) {
-        return;
+    bool isFirstRepeat = false;
+    {
+        QMutexLocker lock(&_mutex);
+        if (messageID >= _currentMessageID) {
+            return;
+        }
+
+        isFirstRepeat = _repeatedMessageRecords[messageID].repeatCount == 0;
+        if (!isFirstRepeat) {
+            _repeatedMessageRecords[messageID].repeatString = message;
+        }
+
+        ++_repeatedMessageRecords[messageID].repeatCount;
     }
 
-    if (_repeatedMessageRecords[messageID].repeatCount == 0) {
-        printMessage(type, context, message);
-    } else {
-        _repeatedMessageRecords[messageID].repeatString = message;
+    if (isFirstRepeat) {
+        queueMessage(type, context, message);
     }
- 
-    ++_repeatedMessageRecords[messageID].repeatCount;
 }
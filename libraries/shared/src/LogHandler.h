@@ -17,10 +17,16 @@
 #include <QString>
 #include <QRegExp>
 #include <QMutex>
+#include <QHash>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <memory>
 
 const int VERBOSE_LOG_INTERVAL_SECONDS = 5;
+const int DEFAULT_MAX_LOG_MESSAGES_PER_CATEGORY_PER_SECOND = 1000;
 
 enum LogMsgType {
     LogInfo = QtInfoMsg,
@@ -32,6 +38,11 @@ enum LogMsgType {
 };
 
 /// Handles custom message handling and sending of stats/logs to Logstash instance
+///
+/// The messages are written to stdout by a writer thread, so that the threads that log only pay for queueing them.
+/// The queue is lock-free for the threads that log, the messages of verboseMessageHandler are formatted by the
+/// writer thread, and the debug and info messages of a category past the per second limit are dropped and counted
+/// in a summary.  Fatal messages are written before they return.
 class LogHandler : public QObject {
     Q_OBJECT
 public:
@@ -45,8 +56,15 @@ public:
     void setShouldOutputThreadID(bool shouldOutputThreadID);
     void setShouldDisplayMilliseconds(bool shouldDisplayMilliseconds);
 
+    /// the debug and info messages of a category past this many in a second are suppressed, 0 means no limit
+    void setMaxMessagesPerCategoryPerSecond(int maxMessagesPerCategoryPerSecond);
+
+    /// formats the message and queues it to be written, for the message handlers that need the formatted message
     QString printMessage(LogMsgType type, const QMessageLogContext& context, const QString &message);
 
+    /// blocks until the messages queued so far were written
+    void flushMessages();
+
     /// a qtMessageHandler that can be hooked up to a target that links to Qt
     /// prints various process, message type, and time information
     static void verboseMessageHandler(QtMsgType type, const QMessageLogContext& context, const QString &message);
@@ -57,11 +75,45 @@ public:
     void setupRepeatedMessageFlusher();
 
 private:
-    LogHandler() = default;
-    ~LogHandler() = default;
+    struct QueuedMessage {
+        std::atomic<QueuedMessage*> next { nullptr };
+        LogMsgType type { LogDebug };
+        qint64 time { 0 };
+        size_t threadID { 0 };
+        QByteArray category;
+        QByteArray file;
+        QString message;
+        bool isFormatted { false };
+    };
+
+    struct CategoryRate {
+        qint64 windowStart { 0 };
+        int count { 0 };
+        int suppressed { 0 };
+    };
+
+    LogHandler();
+    ~LogHandler();
 
     void flushRepeatedMessages();
 
+    QString formatMessage(LogMsgType type, qint64 time, size_t threadID, const char* category, const char* file,
+                          const QString& message);
+
+    // queues the message to be formatted by the writer
+    void queueMessage(LogMsgType type, const QMessageLogContext& context, const QString& message);
+    void enqueueMessage(QueuedMessage* queuedMessage);
+    void pushMessage(QueuedMessage* queuedMessage);
+    QueuedMessage* popMessage();
+
+    void runWriter();
+    // the methods below are called with _writeMutex locked
+    void writeQueuedMessages();
+    void writeMessage(QueuedMessage* queuedMessage, qint64 now);
+    void writeSuppressedSummaries(qint64 now, bool all);
+    void writeSuppressedSummary(const QByteArray& category, int numSuppressed, qint64 now);
+    void writeString(const QString& logMessage);
+
     QString _targetName;
     bool _shouldOutputProcessID { false };
     bool _shouldOutputThreadID { false };
@@ -74,6 +126,28 @@ private:
     };
     std::vector<RepeatedMessageRecord> _repeatedMessageRecords;
     static QMutex _mutex;
+
+    // a multiple producer single consumer queue, the threads that log push at the head with an exchange and the one
+    // that holds _writeMutex pops at the tail
+    std::atomic<QueuedMessage*> _queueHead;
+    QueuedMessage* _queueTail;
+    QueuedMessage _queueStub;
+
+    std::atomic<uint64_t> _numQueued { 0 };
+    std::atomic<uint64_t> _numWritten { 0 };
+    std::mutex _writeMutex;
+
+    // the threads that log only lock _wakeMutex to wake the writer when it waits for messages
+    std::mutex _wakeMutex;
+    std::condition_variable _hasMessages;
+    std::atomic<bool> _isWriterWaiting { false };
+    std::atomic<bool> _stopWriter { false };
+    std::once_flag _writerStarted;
+    std::thread _writerThread;
+
+    std::atomic<int> _maxMessagesPerCategoryPerSecond { DEFAULT_MAX_LOG_MESSAGES_PER_CATEGORY_PER_SECOND };
+    // only used by the writer, with _writeMutex locked
+    QHash<QByteArray, CategoryRate> _categoryRates;
 };
 
 #define HIFI_FCDEBUG(category, message) \
@@ -11,6 +11,7 @@
 
 #include "PerfStat.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <map>
 #include <string>
@@ -79,32 +80,136 @@ void PerformanceTimerRecord::tallyResult(const quint64& now) {
 // PerformanceTimer
 // ----------------------------------------------------------------------------
 
+// The scopes a thread is in and the timings it recorded since they were last merged.  The other threads only
+// touch the timings, to merge them.
+class PerformanceTimer::ThreadRecords {
+public:
+    struct Accumulation {
+        quint64 elapsedUsecs { 0 };
+        quint64 count { 0 };
+    };
+
+    ThreadRecords() {
+        std::lock_guard<std::mutex> guard(_mutex);
+        _threadRecords.push_back(this);
+    }
+
+    ~ThreadRecords() {
+        std::lock_guard<std::mutex> guard(_mutex);
+        mergeLocked();
+        _threadRecords.erase(std::find(_threadRecords.begin(), _threadRecords.end(), this));
+    }
+
+    void accumulate(int scope, quint64 elapsedUsec) {
+        std::lock_guard<std::mutex> guard(accumulationsMutex);
+        if (scope >= (int)accumulations.size()) {
+            accumulations.resize(scope + 1);
+        }
+        Accumulation& accumulation = accumulations[scope];
+        accumulation.elapsedUsecs += elapsedUsec;
+        ++accumulation.count;
+    }
+
+    // with PerformanceTimer::_mutex locked
+    void mergeLocked() {
+        std::lock_guard<std::mutex> guard(accumulationsMutex);
+        for (int scope = 0; scope < (int)accumulations.size(); ++scope) {
+            Accumulation& accumulation = accumulations[scope];
+            if (accumulation.count > 0) {
+                _records[_scopeNames[scope]].accumulateResult(accumulation.elapsedUsecs, accumulation.count);
+                accumulation = Accumulation();
+            }
+        }
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> guard(accumulationsMutex);
+        accumulations.clear();
+    }
+
+    int currentScope { 0 };
+    // the scopes entered from each scope, by the address of their literal or by name
+    QHash<QPair<int, const char*>, int> literalScopes;
+    QHash<QPair<int, QString>, int> namedScopes;
+
+private:
+    // uncontended unless the records are being merged
+    std::mutex accumulationsMutex;
+    std::vector<Accumulation> accumulations;
+};
+
 std::atomic<bool> PerformanceTimer::_isActive(false);
 std::mutex PerformanceTimer::_mutex;
-QHash<QThread*, QString> PerformanceTimer::_fullNames;
+std::vector<QString> PerformanceTimer::_scopeNames { QString() };
+QHash<QPair<int, QString>, int> PerformanceTimer::_scopes;
+std::vector<PerformanceTimer::ThreadRecords*> PerformanceTimer::_threadRecords;
 QMap<QString, PerformanceTimerRecord> PerformanceTimer::_records;
 
+PerformanceTimer::PerformanceTimer(const char* name) {
+    if (_isActive) {
+        ThreadRecords& threadRecords = getThreadRecords();
+        QPair<int, const char*> key(threadRecords.currentScope, name);
+        auto itr = threadRecords.literalScopes.find(key);
+        if (itr == threadRecords.literalScopes.end()) {
+            itr = threadRecords.literalScopes.insert(key, internScope(key.first, QString(name)));
+        }
+        start(itr.value());
+    }
+}
+
 PerformanceTimer::PerformanceTimer(const QString& name) {
     if (_isActive) {
-        _name = name;
-        {
-            std::lock_guard<std::mutex> guard(_mutex);
-            QString& fullName = _fullNames[QThread::currentThread()];
-            fullName.append("/");
-            fullName.append(_name);
+        ThreadRecords& threadRecords = getThreadRecords();
+        QPair<int, QString> key(threadRecords.currentScope, name);
+        auto itr = threadRecords.namedScopes.find(key);
+        if (itr == threadRecords.namedScopes.end()) {
+            itr = threadRecords.namedScopes.insert(key, internScope(key.first, name));
         }
-        _start = usecTimestampNow();
+        start(itr.value());
     }
 }
 
 PerformanceTimer::~PerformanceTimer() {
-    if (_isActive && _start != 0) {
+    if (_start != 0) {
         quint64 elapsedUsec = (usecTimestampNow() - _start);
-        std::lock_guard<std::mutex> guard(_mutex);
-        QString& fullName = _fullNames[QThread::currentThread()];
-        PerformanceTimerRecord& namedRecord = _records[fullName];
-        namedRecord.accumulateResult(elapsedUsec);
-        fullName.resize(fullName.size() - (_name.size() + 1));
+        ThreadRecords& threadRecords = getThreadRecords();
+        int scope = threadRecords.currentScope;
+        threadRecords.currentScope = _parentScope;
+        if (_isActive) {
+            threadRecords.accumulate(scope, elapsedUsec);
+        }
+    }
+}
+
+void PerformanceTimer::start(int scope) {
+    ThreadRecords& threadRecords = getThreadRecords();
+    _parentScope = threadRecords.currentScope;
+    threadRecords.currentScope = scope;
+    _start = usecTimestampNow();
+}
+
+// static
+PerformanceTimer::ThreadRecords& PerformanceTimer::getThreadRecords() {
+    thread_local ThreadRecords threadRecords;
+    return threadRecords;
+}
+
+// static
+int PerformanceTimer::internScope(int parentScope, const QString& name) {
+    std::lock_guard<std::mutex> guard(_mutex);
+    QPair<int, QString> key(parentScope, name);
+    auto itr = _scopes.find(key);
+    if (itr == _scopes.end()) {
+        itr = _scopes.insert(key, (int)_scopeNames.size());
+        _scopeNames.push_back(_scopeNames[parentScope] + "/" + name);
+    }
+    return itr.value();
+}
+
+// static
+void PerformanceTimer::mergeThreadRecordsLocked() {
+    for (auto threadRecords : _threadRecords) {
+        threadRecords->mergeLocked();
     }
 }
 
@@ -115,8 +220,9 @@ bool PerformanceTimer::isActive() {
 
 // static
 QString PerformanceTimer::getContextName() {
+    int scope = getThreadRecords().currentScope;
     std::lock_guard<std::mutex> guard(_mutex);
-    return _fullNames[QThread::currentThread()];
+    return _scopeNames[scope];
 }
 
 // static
@@ -131,8 +237,11 @@ void PerformanceTimer::setActive(bool active) {
     if (active != _isActive) {
         _isActive.store(active);
         if (!active) {
+            // the scopes are kept, the threads still in one leave it as their timers end
             std::lock_guard<std::mutex> guard(_mutex);
-            _fullNames.clear();
+            for (auto threadRecords : _threadRecords) {
+                threadRecords->clear();
+            }
             _records.clear();
         }
 
@@ -143,12 +252,14 @@ void PerformanceTimer::setActive(bool active) {
 // static
 QMap<QString, PerformanceTimerRecord> PerformanceTimer::getAllTimerRecords() {
     std::lock_guard<std::mutex> guard(_mutex);
+    mergeThreadRecordsLocked();
     return _records;
 };
 
 // static
 void PerformanceTimer::tallyAllTimerRecords() {
     std::lock_guard<std::mutex> guard(_mutex);
+    mergeThreadRecordsLocked();
     QMap<QString, PerformanceTimerRecord>::iterator recordsItr = _records.begin();
     QMap<QString, PerformanceTimerRecord>::const_iterator recordsEnd = _records.end();
     quint64 now = usecTimestampNow();
@@ -165,6 +276,7 @@ void PerformanceTimer::tallyAllTimerRecords() {
 
 void PerformanceTimer::dumpAllTimerRecords() {
     std::lock_guard<std::mutex> guard(_mutex);
+    mergeThreadRecordsLocked();
     QMapIterator<QString, PerformanceTimerRecord> i(_records);
     while (i.hasNext()) {
         i.next();
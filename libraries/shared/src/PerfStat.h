@@ -23,6 +23,13 @@
 #include <cstring>
 #include <string>
 #include <map>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QMap>
+#include <QtCore/QPair>
+#include <QtCore/QString>
 
 using AtomicUIntStat = std::atomic<uintmax_t>;
 
@@ -57,7 +64,10 @@ class PerformanceTimerRecord {
 public:
     PerformanceTimerRecord() : _runningTotal(0), _lastTotal(0), _numAccumulations(0), _numTallies(0), _expiry(0) {}
 
-    void accumulateResult(const quint64& elapsed) { _runningTotal += elapsed; ++_numAccumulations; }
+    void accumulateResult(const quint64& elapsed, const quint64& count = 1) {
+        _runningTotal += elapsed;
+        _numAccumulations += count;
+    }
     void tallyResult(const quint64& now);
     bool isStale(const quint64& now) const { return now > _expiry; }
     quint64 getAverage() const { return (_numTallies == 0) ? 0 : _runningTotal / _numTallies; }
@@ -73,9 +83,15 @@ private:
     SimpleMovingAverage _movingAverage;
 };
 
+// Times a scope and records it under the names of the timers it is nested in, like "/idle/update/MyAvatar".
+//   The names are interned to scope IDs the first time a thread enters them, and the timings pile up in arrays of
+//   the thread they ran on, so a timed scope only reads the clock twice.  The records of the threads are merged
+//   into the named records when they are read or tallied.
 class PerformanceTimer {
 public:
 
+    // the name must outlive the timers, like a string literal does
+    PerformanceTimer(const char* name);
     PerformanceTimer(const QString& name);
     ~PerformanceTimer();
 
@@ -89,12 +105,22 @@ public:
     static void dumpAllTimerRecords();
 
 private:
+    class ThreadRecords;
+
+    void start(int scope);
+
+    static ThreadRecords& getThreadRecords();
+    static int internScope(int parentScope, const QString& name);
+    static void mergeThreadRecordsLocked();
+
     quint64 _start = 0;
-    QString _name;
+    int _parentScope = 0;
     static std::atomic<bool> _isActive;
 
-    static std::mutex _mutex;  // used to guard multi-threaded access to _fullNames and _records
-    static QHash<QThread*, QString> _fullNames;
+    static std::mutex _mutex;  // used to guard multi-threaded access to the scopes, the threads and _records
+    static std::vector<QString> _scopeNames;
+    static QHash<QPair<int, QString>, int> _scopes;
+    static std::vector<ThreadRecords*> _threadRecords;
     static QMap<QString, PerformanceTimerRecord> _records;
 };
 
@@ -65,6 +65,11 @@ namespace PrioritySortUtil {
             thing.setPriority(computePriority(thing));
             _vector.push_back(thing);
         }
+        // push with a priority the caller has already computed (e.g. cached from a previous sort)
+        void push(T thing, float priority) {
+            thing.setPriority(priority);
+            _vector.push_back(thing);
+        }
         void reserve(size_t num) {
             _vector.reserve(num);
         }
@@ -79,7 +84,25 @@ namespace PrioritySortUtil {
             return _vector;
         }
 
-    private:
+        // Sort assuming things were pushed in roughly the order of a previous sort: insertion sort is linear on
+        // nearly sorted input, so only the things whose priority changed rank are moved. When the order has
+        // changed too much for that to pay off, fall back to a full sort.
+        const std::vector<T>& getIncrementallySortedVector() {
+            const size_t MAX_MOVES_PER_THING = 8;
+            const size_t maxMoves = MAX_MOVES_PER_THING * _vector.size();
+            size_t numMoves = 0;
+            for (size_t i = 1; i < _vector.size(); ++i) {
+                size_t j = i;
+                while (j > 0 && _vector[j - 1].getPriority() < _vector[j].getPriority()) {
+                    std::swap(_vector[j - 1], _vector[j]);
+                    --j;
+                    if (++numMoves > maxMoves) {
+                        return getSortedVector();
+                    }
+                }
+            }
+            return _vector;
+        }
 
         float computePriority(const T& thing) const {
             float priority = std::numeric_limits<float>::min();
@@ -91,7 +114,20 @@ namespace PrioritySortUtil {
             return priority;
         }
 
-        float computePriority(const ConicalViewFrustum& view, const T& thing) const {
+        // same as computePriority(), for a thing the caller already knows to be outside of all of the views
+        float computeOutOfViewPriority(const T& thing) const {
+            float priority = std::numeric_limits<float>::min();
+
+            for (const auto& view : _views) {
+                priority = std::max(priority, computePriority(view, thing, true));
+            }
+
+            return priority;
+        }
+
+    private:
+
+        float computePriority(const ConicalViewFrustum& view, const T& thing, bool isOutOfView = false) const {
             // priority = weighted linear combination of multiple values:
             //   (a) angular size
             //   (b) proximity to center of view
@@ -115,7 +151,9 @@ namespace PrioritySortUtil {
             float priority = (_angularWeight * angularSize + _centerWeight * cosineAngle) * (age + 1.0f) + _ageWeight * age;
 
             // decrement priority of things outside keyhole
-            if (distance - radius > view.getRadius()) {
+            if (isOutOfView) {
+                priority += OUT_OF_VIEW_PENALTY;
+            } else if (distance - radius > view.getRadius()) {
                 if (!view.intersects(offset, distance, radius)) {
                     priority += OUT_OF_VIEW_PENALTY;
                 }
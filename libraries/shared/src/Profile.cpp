@@ -12,6 +12,7 @@
 Q_LOGGING_CATEGORY(trace_app, "trace.app")
 Q_LOGGING_CATEGORY(trace_app_detail, "trace.app.detail")
 Q_LOGGING_CATEGORY(trace_metadata, "trace.metadata")
+Q_LOGGING_CATEGORY(trace_mixer, "trace.mixer")
 Q_LOGGING_CATEGORY(trace_network, "trace.network")
 Q_LOGGING_CATEGORY(trace_picks, "trace.picks")
 Q_LOGGING_CATEGORY(trace_parse, "trace.parse")
@@ -27,6 +28,7 @@ Q_LOGGING_CATEGORY(trace_simulation, "trace.simulation")
 Q_LOGGING_CATEGORY(trace_simulation_detail, "trace.simulation.detail")
 Q_LOGGING_CATEGORY(trace_simulation_animation, "trace.simulation.animation")
 Q_LOGGING_CATEGORY(trace_simulation_animation_detail, "trace.simulation.animation.detail")
+Q_LOGGING_CATEGORY(trace_simulation_avatars, "trace.simulation.avatars")
 Q_LOGGING_CATEGORY(trace_simulation_physics, "trace.simulation.physics")
 Q_LOGGING_CATEGORY(trace_simulation_physics_detail, "trace.simulation.physics.detail")
 Q_LOGGING_CATEGORY(trace_startup, "trace.startup")
@@ -58,9 +60,13 @@ Duration::Duration(const QLoggingCategory& category,
                    const QVariantMap& baseArgs) :
     DurationBase(category, name) {
     if (tracingEnabled() && category.isDebugEnabled()) {
-        QVariantMap args = baseArgs;
-        args["nv_payload"] = QVariant::fromValue(payload);
-        tracing::traceEvent(_category, _name, tracing::DurationBegin, "", args);
+        if (baseArgs.empty()) {
+            tracing::traceDuration(_category, _name, tracing::DurationBegin, tracing::Tracer::now(), payload);
+        } else {
+            QVariantMap args = baseArgs;
+            args["nv_payload"] = QVariant::fromValue(payload);
+            tracing::traceEvent(_category, _name, tracing::DurationBegin, "", args);
+        }
 
 #if defined(NSIGHT_TRACING)
         nvtxEventAttributes_t eventAttrib{ 0 };
@@ -80,7 +86,7 @@ Duration::Duration(const QLoggingCategory& category,
 
 Duration::~Duration() {
     if (tracingEnabled() && _category.isDebugEnabled()) {
-        tracing::traceEvent(_category, _name, tracing::DurationEnd);
+        tracing::traceDuration(_category, _name, tracing::DurationEnd, tracing::Tracer::now());
 #ifdef NSIGHT_TRACING
         nvtxRangePop();
 #endif
@@ -122,8 +128,8 @@ ConditionalDuration::~ConditionalDuration() {
         auto endTime = tracing::Tracer::now();
         auto duration = endTime - _startTime;
         if (duration >= _minTime) {
-            tracing::traceEvent(_category, _startTime, _name, tracing::DurationBegin);
-            tracing::traceEvent(_category, endTime, _name, tracing::DurationEnd);
+            tracing::traceDuration(_category, _name, tracing::DurationBegin, _startTime);
+            tracing::traceDuration(_category, _name, tracing::DurationEnd, endTime);
         }
     }
 }
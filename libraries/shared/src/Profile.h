@@ -17,6 +17,7 @@
 Q_DECLARE_LOGGING_CATEGORY(trace_app)
 Q_DECLARE_LOGGING_CATEGORY(trace_app_detail)
 Q_DECLARE_LOGGING_CATEGORY(trace_metadata)
+Q_DECLARE_LOGGING_CATEGORY(trace_mixer)
 Q_DECLARE_LOGGING_CATEGORY(trace_network)
 Q_DECLARE_LOGGING_CATEGORY(trace_picks)
 Q_DECLARE_LOGGING_CATEGORY(trace_render)
@@ -31,6 +32,7 @@ Q_DECLARE_LOGGING_CATEGORY(trace_simulation)
 Q_DECLARE_LOGGING_CATEGORY(trace_simulation_detail)
 Q_DECLARE_LOGGING_CATEGORY(trace_simulation_animation)
 Q_DECLARE_LOGGING_CATEGORY(trace_simulation_animation_detail)
+Q_DECLARE_LOGGING_CATEGORY(trace_simulation_avatars)
 Q_DECLARE_LOGGING_CATEGORY(trace_simulation_physics)
 Q_DECLARE_LOGGING_CATEGORY(trace_simulation_physics_detail)
 Q_DECLARE_LOGGING_CATEGORY(trace_startup)
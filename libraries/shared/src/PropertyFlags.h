@@ -22,8 +22,9 @@
 #include <algorithm>
 #include <climits>
 
-#include <QBitArray>
 #include <QByteArray>
+#include <QVarLengthArray>
+#include <QtAlgorithms>
 
 #include "ByteCountCoding.h"
 #include "SharedLogging.h"
@@ -35,7 +36,7 @@ public:
             _maxFlag(INT_MIN), _minFlag(INT_MAX), _trailingFlipped(false), _encodedLength(0) { };
 
     inline PropertyFlags(const PropertyFlags& other) : 
-            _flags(other._flags), _maxFlag(other._maxFlag), _minFlag(other._minFlag), 
+            _words(other._words), _numBits(other._numBits), _maxFlag(other._maxFlag), _minFlag(other._minFlag), 
             _trailingFlipped(other._trailingFlipped), _encodedLength(0) {}
 
     inline PropertyFlags(Enum flag) : 
@@ -44,7 +45,7 @@ public:
     inline PropertyFlags(const QByteArray& fromEncoded) : 
             _maxFlag(INT_MIN), _minFlag(INT_MAX), _trailingFlipped(false), _encodedLength(0) { decode(fromEncoded); }
 
-    void clear() { _flags.clear(); _maxFlag = INT_MIN; _minFlag = INT_MAX; _trailingFlipped = false; _encodedLength = 0; }
+    void clear() { resizeBits(0); _maxFlag = INT_MIN; _minFlag = INT_MAX; _trailingFlipped = false; _encodedLength = 0; }
     bool isEmpty() const { return _maxFlag == INT_MIN && _minFlag == INT_MAX && _trailingFlipped == false && _encodedLength == 0; }
 
     Enum firstFlag() const { return (Enum)_minFlag; }
@@ -58,9 +59,9 @@ public:
 
     operator QByteArray() { return encode(); };
 
-    bool operator==(const PropertyFlags& other) const { return _flags == other._flags; }
-    bool operator!=(const PropertyFlags& other) const { return _flags != other._flags; }
-    bool operator!() const { return _flags.size() == 0; }
+    bool operator==(const PropertyFlags& other) const;
+    bool operator!=(const PropertyFlags& other) const { return !(*this == other); }
+    bool operator!() const { return _numBits == 0; }
 
     PropertyFlags& operator=(const PropertyFlags& other);
 
@@ -109,9 +110,24 @@ public:
 
 
 private:
+    // the flags are kept in words, enough of them for most enums fit without allocating
+    using Word = quint64;
+    static const int BITS_PER_WORD = 64;
+    static const int INLINE_WORDS = 4;
+
     void shrinkIfNeeded();
 
-    QBitArray _flags;
+    // like a QBitArray of _numBits bits, the bits past _numBits are always clear
+    void resizeBits(int numBits);
+    bool testBit(int bit) const { return _words[bit / BITS_PER_WORD] & ((Word)1 << (bit % BITS_PER_WORD)); }
+    void setBit(int bit, bool value);
+    template<typename Op> void combineBits(const PropertyFlags& other, Op op);
+
+    // calls f with each flag that is set from first to last, skipping over the clear words
+    template<typename F> void forEachFlag(int first, int last, F f) const;
+
+    QVarLengthArray<Word, INLINE_WORDS> _words;
+    int _numBits { 0 };
     int _maxFlag;
     int _minFlag;
     bool _trailingFlipped; /// are the trailing properties flipping in their state (e.g. assumed true, instead of false)
@@ -137,12 +153,12 @@ template<typename Enum> inline void PropertyFlags<Enum>::setHasProperty(Enum fla
     if (flag > _maxFlag) {
         if (value) {
             _maxFlag = flag;
-            _flags.resize(_maxFlag + 1);
+            resizeBits(_maxFlag + 1);
         } else {
             return; // bail early, we're setting a flag outside of our current _maxFlag to false, which is already the default
         }
     }
-    _flags.setBit(flag, value);
+    setBit(flag, value);
     
     if (flag == _maxFlag && !value) {
         shrinkIfNeeded();
@@ -153,7 +169,7 @@ template<typename Enum> inline bool PropertyFlags<Enum>::getHasProperty(Enum fla
     if (flag > _maxFlag) {
         return _trailingFlipped; // usually false
     }
-    return _flags.testBit(flag);
+    return testBit(flag);
 }
 
 const int BITS_PER_BYTE = 8;
@@ -170,27 +186,12 @@ template<typename Enum> inline QByteArray PropertyFlags<Enum>::encode() {
     int lengthInBytes = (_maxFlag / (BITS_PER_BYTE - 1)) + 1;
 
     output.fill(0, lengthInBytes);
+    ByteCountCoding::writeLeadBits(output.data(), lengthInBytes);
 
-    // next pack the number of header bits in, the first N-1 to be set to 1, the last to be set to 0
-    for(int i = 0; i < lengthInBytes; i++) {
-        int outputIndex = i;
-        int bitValue = (i < (lengthInBytes - 1)  ? 1 : 0);
-        char original = output.at(outputIndex / BITS_PER_BYTE);
-        int shiftBy = BITS_PER_BYTE - ((outputIndex % BITS_PER_BYTE) + 1);
-        char thisBit = ( bitValue << shiftBy);
-        output[i / BITS_PER_BYTE] = (original | thisBit);
-    }
-
-    // finally pack the the actual bits from the bit array
-    for(int i = lengthInBytes; i < (lengthInBytes + _maxFlag + 1); i++) {
-        int flagIndex = i - lengthInBytes;
-        int outputIndex = i;
-        int bitValue = ( _flags[flagIndex]  ? 1 : 0);
-        char original = output.at(outputIndex / BITS_PER_BYTE);
-        int shiftBy = BITS_PER_BYTE - ((outputIndex % BITS_PER_BYTE) + 1);
-        char thisBit = ( bitValue << shiftBy);
-        output[i / BITS_PER_BYTE] = (original | thisBit);
-    }
+    // the flags follow the lead bits, only the ones that are set are visited
+    forEachFlag(0, _maxFlag, [&](int flag) {
+        ByteCountCoding::setBit(output.data(), lengthInBytes + flag);
+    });
     
     _encodedLength = lengthInBytes;
     return output;
@@ -200,54 +201,19 @@ template<typename Enum>
 inline size_t PropertyFlags<Enum>::decode(const uint8_t* data, size_t size) {
     clear(); // we are cleared out!
 
-    size_t bytesConsumed = 0;
-    int bitCount = BITS_IN_BYTE * (int)size;
-
-    int encodedByteCount = 1; // there is at least 1 byte (after the leadBits)
-    int leadBits = 1; // there is always at least 1 lead bit
-    bool inLeadBits = true;
-    int bitAt = 0;
-    int expectedBitCount; // unknown at this point
-    int lastValueBit = 0;
-    for (unsigned int byte = 0; byte < size; byte++) {
-        char originalByte = data[byte];
-        bytesConsumed++;
-        unsigned char maskBit = 0x80; // LEFT MOST BIT set
-        for (int bit = 0; bit < BITS_IN_BYTE; bit++) {
-            bool bitIsSet = originalByte & maskBit;
-            // Processing of the lead bits
-            if (inLeadBits) {
-                if (bitIsSet) {
-                    encodedByteCount++;
-                    leadBits++;
-                } else {
-                    inLeadBits = false; // once we hit our first 0, we know we're out of the lead bits
-                    expectedBitCount = (encodedByteCount * BITS_IN_BYTE) - leadBits;
-                    lastValueBit = expectedBitCount + bitAt;
-
-                    // check to see if the remainder of our buffer is sufficient
-                    if (expectedBitCount > (bitCount - leadBits)) {
-                        break;
-                    }
-                }
-            } else {
-                if (bitAt > lastValueBit) {
-                    break;
-                }
-
-                if (bitIsSet) {
-                    setHasProperty(static_cast<Enum>(bitAt - leadBits), true);
-                }
-            }
-            bitAt++;
-            maskBit >>= 1;
-        }
-        if (!inLeadBits && bitAt > lastValueBit) {
-            break;
-        }
-    }
-    _encodedLength = (int)bytesConsumed;
-    return bytesConsumed;
+    auto bits = ByteCountCoding::findEncodedBits(data, size);
+
+    // the flags are set in order, so they only need the room for all of them once
+    resizeBits(bits.endValueBit - bits.firstValueBit);
+    ByteCountCoding::forEachSetValueBit(data, bits, [&](int flag) {
+        _minFlag = std::min(_minFlag, flag);
+        _maxFlag = flag;
+        setBit(flag, true);
+    });
+    resizeBits(std::max(_maxFlag + 1, 0));
+
+    _encodedLength = (int)bits.numBytes;
+    return bits.numBytes;
 }
 
 template<typename Enum> inline size_t PropertyFlags<Enum>::decode(const QByteArray& fromEncodedBytes) {
@@ -259,22 +225,27 @@ template<typename Enum> inline void PropertyFlags<Enum>::debugDumpBits() {
     qCDebug(shared) << "_maxFlag=" << _maxFlag;
     qCDebug(shared) << "_trailingFlipped=" << _trailingFlipped;
     QString bits;
-    for(int i = 0; i < _flags.size(); i++) {
-        bits += (_flags.at(i) ? "1" : "0");
+    for(int i = 0; i < _numBits; i++) {
+        bits += (testBit(i) ? "1" : "0");
     }
     qCDebug(shared) << "bits:" << bits;
 }
 
 
+template<typename Enum> inline bool PropertyFlags<Enum>::operator==(const PropertyFlags& other) const {
+    return _numBits == other._numBits && std::equal(_words.begin(), _words.end(), other._words.begin());
+}
+
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator=(const PropertyFlags& other) {
-    _flags = other._flags; 
+    _words = other._words; 
+    _numBits = other._numBits; 
     _maxFlag = other._maxFlag; 
     _minFlag = other._minFlag; 
     return *this; 
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator|=(const PropertyFlags& other) {
-    _flags |= other._flags; 
+    combineBits(other, [](Word a, Word b) { return a | b; }); 
     _maxFlag = std::max(_maxFlag, other._maxFlag); 
     _minFlag = std::min(_minFlag, other._minFlag); 
     return *this; 
@@ -282,44 +253,42 @@ template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operato
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator|=(Enum flag) {
     PropertyFlags other(flag); 
-    _flags |= other._flags; 
+    combineBits(other, [](Word a, Word b) { return a | b; }); 
     _maxFlag = std::max(_maxFlag, other._maxFlag); 
     _minFlag = std::min(_minFlag, other._minFlag); 
     return *this; 
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator&=(const PropertyFlags& other) {
-    _flags &= other._flags; 
+    combineBits(other, [](Word a, Word b) { return a & b; }); 
     shrinkIfNeeded(); 
     return *this; 
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator&=(Enum flag) {
     PropertyFlags other(flag); 
-    _flags &= other._flags; 
+    combineBits(other, [](Word a, Word b) { return a & b; }); 
     shrinkIfNeeded(); 
     return *this; 
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator^=(const PropertyFlags& other) {
-    _flags ^= other._flags; 
+    combineBits(other, [](Word a, Word b) { return a ^ b; }); 
     shrinkIfNeeded(); 
     return *this; 
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator^=(Enum flag) {
     PropertyFlags other(flag); 
-    _flags ^= other._flags; 
+    combineBits(other, [](Word a, Word b) { return a ^ b; }); 
     shrinkIfNeeded(); 
     return *this; 
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator+=(const PropertyFlags& other) {
-    for(int flag = (int)other.firstFlag(); flag <= (int)other.lastFlag(); flag++) {
-        if (other.getHasProperty((Enum)flag)) {
-            setHasProperty((Enum)flag, true);
-        }
-    }
+    other.forEachFlag((int)other.firstFlag(), (int)other.lastFlag(), [this](int flag) {
+        setHasProperty((Enum)flag, true);
+    });
     return *this; 
 }
 
@@ -329,11 +298,9 @@ template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operato
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator-=(const PropertyFlags& other) {
-    for(int flag = (int)other.firstFlag(); flag <= (int)other.lastFlag(); flag++) {
-        if (other.getHasProperty((Enum)flag)) {
-            setHasProperty((Enum)flag, false);
-        }
-    }
+    other.forEachFlag((int)other.firstFlag(), (int)other.lastFlag(), [this](int flag) {
+        setHasProperty((Enum)flag, false);
+    });
     return *this;
 }
 
@@ -343,11 +310,9 @@ template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operato
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator<<=(const PropertyFlags& other) {
-    for(int flag = (int)other.firstFlag(); flag <= (int)other.lastFlag(); flag++) {
-        if (other.getHasProperty((Enum)flag)) {
-            setHasProperty((Enum)flag, true);
-        }
-    }
+    other.forEachFlag((int)other.firstFlag(), (int)other.lastFlag(), [this](int flag) {
+        setHasProperty((Enum)flag, true);
+    });
     return *this; 
 }
 
@@ -433,21 +398,84 @@ template<typename Enum> inline PropertyFlags<Enum> PropertyFlags<Enum>::operator
 
 template<typename Enum> inline PropertyFlags<Enum> PropertyFlags<Enum>::operator~() const { 
     PropertyFlags result(*this); 
-    result._flags = ~_flags;
+    for (auto& word : result._words) {
+        word = ~word;
+    }
+    result.resizeBits(_numBits);
     result._trailingFlipped = !_trailingFlipped;
     return result; 
 }
 
 template<typename Enum> inline void PropertyFlags<Enum>::shrinkIfNeeded() {
+    if (_maxFlag < 0) {
+        return;
+    }
     int maxFlagWas = _maxFlag;
-    while (_maxFlag >= 0) {
-        if (_flags.testBit(_maxFlag)) {
-            break;
-        }
-        _maxFlag--;
+
+    // the highest flag that is still set at or below _maxFlag, from the word it is in down
+    int wordIndex = _maxFlag / BITS_PER_WORD;
+    int bitsAbove = BITS_PER_WORD - 1 - (_maxFlag % BITS_PER_WORD);
+    Word word = (_words[wordIndex] << bitsAbove) >> bitsAbove;
+    while (word == 0 && wordIndex > 0) {
+        word = _words[--wordIndex];
     }
+    _maxFlag = word ? wordIndex * BITS_PER_WORD + BITS_PER_WORD - 1 - (int)qCountLeadingZeroBits(word) : -1;
+
     if (maxFlagWas != _maxFlag) {
-        _flags.resize(_maxFlag + 1);
+        resizeBits(_maxFlag + 1);
+    }
+}
+
+template<typename Enum> inline void PropertyFlags<Enum>::resizeBits(int numBits) {
+    _words.resize((numBits + BITS_PER_WORD - 1) / BITS_PER_WORD);
+    // the words that were added are cleared along with the bits of the last one past numBits
+    for (int i = (_numBits + BITS_PER_WORD - 1) / BITS_PER_WORD; i < _words.size(); i++) {
+        _words[i] = 0;
+    }
+    if (numBits % BITS_PER_WORD != 0) {
+        _words[numBits / BITS_PER_WORD] &= ((Word)1 << (numBits % BITS_PER_WORD)) - 1;
+    }
+    _numBits = numBits;
+}
+
+template<typename Enum> inline void PropertyFlags<Enum>::setBit(int bit, bool value) {
+    Word mask = (Word)1 << (bit % BITS_PER_WORD);
+    if (value) {
+        _words[bit / BITS_PER_WORD] |= mask;
+    } else {
+        _words[bit / BITS_PER_WORD] &= ~mask;
+    }
+}
+
+// like the operators of QBitArray, the result is as long as the longest of the two, the missing bits taken as 0
+template<typename Enum> template<typename Op> inline void PropertyFlags<Enum>::combineBits(const PropertyFlags& other, Op op) {
+    if (other._numBits > _numBits) {
+        resizeBits(other._numBits);
+    }
+    for (int i = 0; i < _words.size(); i++) {
+        _words[i] = op(_words[i], i < other._words.size() ? other._words[i] : (Word)0);
+    }
+}
+
+template<typename Enum> template<typename F> inline void PropertyFlags<Enum>::forEachFlag(int first, int last, F f) const {
+    first = std::max(first, 0);
+    last = std::min(last, _numBits - 1);
+    if (first > last) {
+        return;
+    }
+    int lastWord = last / BITS_PER_WORD;
+    for (int wordIndex = first / BITS_PER_WORD; wordIndex <= lastWord && wordIndex < _words.size(); wordIndex++) {
+        Word word = _words[wordIndex];
+        if (wordIndex == first / BITS_PER_WORD) {
+            word &= ~(Word)0 << (first % BITS_PER_WORD);
+        }
+        if (wordIndex == lastWord) {
+            word &= ~(Word)0 >> (BITS_PER_WORD - 1 - (last % BITS_PER_WORD));
+        }
+        while (word) {
+            f(wordIndex * BITS_PER_WORD + (int)qCountTrailingZeroBits(word));
+            word &= word - 1;
+        }
     }
 }
 
@@ -25,6 +25,24 @@ template< class Radix2Scanner, typename BidiIterator >
 void radix2InplaceSort( BidiIterator from, BidiIterator to,
         Radix2Scanner const& scanner = Radix2Scanner() );
 
+/**
+ * A Radix2Scanner for unsigned integer keys, that sorts on their
+ * lowest numBits bits, the highest bit first.
+ */
+template< typename UInt >
+struct Radix2IntegerScanner {
+    typedef UInt state_type;
+
+    explicit Radix2IntegerScanner(int numBits = sizeof(UInt) * 8) :
+        _highestBit(UInt(1) << (numBits - 1)) { }
+
+    state_type initial_state() const { return _highestBit; }
+    bool advance(state_type& s) const { return (s >>= 1) != 0u; }
+    bool bit(UInt const& key, state_type s) const { return (key & s) != 0u; }
+
+    UInt _highestBit;
+};
+
 
 
 template< class Scanner, typename Iterator > 
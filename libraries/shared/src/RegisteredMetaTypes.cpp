@@ -22,6 +22,7 @@
 #include <QtGui/QVector3D>
 #include <QtGui/QQuaternion>
 #include <QtNetwork/QAbstractSocket>
+#include <QtScript/QScriptString>
 #include <QtScript/QScriptValue>
 #include <QtScript/QScriptValueIterator>
 #include <QJsonDocument>
@@ -45,6 +46,88 @@ int voidLambdaType = qRegisterMetaType<std::function<void()>>();
 int variantLambdaType = qRegisterMetaType<std::function<QVariant()>>();
 int stencilModeMetaTypeId = qRegisterMetaType<StencilMaskMode>();
 
+namespace {
+
+// The names of the properties of the glm values, interned in an engine, and the prototypes of the vectors in it.
+// A lookup by QScriptString doesn't convert and hash the name on each call, and the prototypes are only looked up
+// once per engine rather than once per value.
+class GLMScriptNames {
+public:
+    // the names of the engine, for the thread it runs on
+    static GLMScriptNames& get(QScriptEngine* engine);
+
+    QScriptString x, y, z, w;
+    QScriptString u, v;
+    QScriptString r, g, b;
+    QScriptString red, green, blue;
+    QScriptString length;
+    QScriptString mat4[4][4]; // by column, then row
+
+    QScriptValue vec2Prototype;
+    QScriptValue vec3Prototype;
+    QScriptValue vec3ColorPrototype;
+
+private:
+    void reset(QScriptEngine* engine);
+
+    QScriptEngine* _engine { nullptr };
+};
+
+GLMScriptNames& GLMScriptNames::get(QScriptEngine* engine) {
+    // each script engine runs on a thread of its own, so the names of a thread seldom change engines
+    thread_local GLMScriptNames names;
+
+    // the names of a deleted engine are invalid, even if a new engine has its address
+    if (names._engine != engine || !names.x.isValid()) {
+        names.reset(engine);
+    }
+    return names;
+}
+
+void GLMScriptNames::reset(QScriptEngine* engine) {
+    _engine = engine;
+    x = engine->toStringHandle("x");
+    y = engine->toStringHandle("y");
+    z = engine->toStringHandle("z");
+    w = engine->toStringHandle("w");
+    u = engine->toStringHandle("u");
+    v = engine->toStringHandle("v");
+    r = engine->toStringHandle("r");
+    g = engine->toStringHandle("g");
+    b = engine->toStringHandle("b");
+    red = engine->toStringHandle("red");
+    green = engine->toStringHandle("green");
+    blue = engine->toStringHandle("blue");
+    length = engine->toStringHandle("length");
+    for (int column = 0; column < 4; column++) {
+        for (int row = 0; row < 4; row++) {
+            mat4[column][row] = engine->toStringHandle(QString("r%1c%2").arg(row).arg(column));
+        }
+    }
+
+    vec2Prototype = QScriptValue();
+    vec3Prototype = QScriptValue();
+    vec3ColorPrototype = QScriptValue();
+}
+
+// the prototype in a global of the engine, defined by the script if the global isn't
+QScriptValue getPrototype(QScriptEngine* engine, QScriptValue& cached, const QString& name, const QString& definition) {
+    if (!cached.isValid()) {
+        cached = engine->globalObject().property(name);
+        if (!cached.property("defined").toBool()) {
+            cached = engine->evaluate(definition);
+        }
+    }
+    return cached;
+}
+
+// the numbers straight from the engine, anything else the way QVariant converts it
+float toFloat(const QScriptValue& value) {
+    return value.isNumber() ? (float)value.toNumber() : value.toVariant().toFloat();
+}
+
+}
+
 void registerMetaTypes(QScriptEngine* engine) {
     qScriptRegisterMetaType(engine, vec2ToScriptValue, vec2FromScriptValue);
     qScriptRegisterMetaType(engine, vec3ToScriptValue, vec3FromScriptValue);
@@ -75,47 +158,47 @@ void registerMetaTypes(QScriptEngine* engine) {
 }
 
 QScriptValue vec2ToScriptValue(QScriptEngine* engine, const glm::vec2& vec2) {
-    auto prototype = engine->globalObject().property("__hifi_vec2__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto& names = GLMScriptNames::get(engine);
+    auto prototype = getPrototype(engine, names.vec2Prototype, "__hifi_vec2__",
             "__hifi_vec2__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
             "1: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
             "u: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
             "v: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } }"
-            "})"
-        );
-    }
+            "})");
     QScriptValue value = engine->newObject();
-    value.setProperty("x", vec2.x);
-    value.setProperty("y", vec2.y);
+    value.setProperty(names.x, vec2.x);
+    value.setProperty(names.y, vec2.y);
     value.setPrototype(prototype);
     return value;
 }
 
 void vec2FromScriptValue(const QScriptValue& object, glm::vec2& vec2) {
     if (object.isNumber()) {
-        vec2 = glm::vec2(object.toVariant().toFloat());
+        vec2 = glm::vec2(toFloat(object));
     } else if (object.isArray()) {
-        QVariantList list = object.toVariant().toList();
-        if (list.length() == 2) {
-            vec2.x = list[0].toFloat();
-            vec2.y = list[1].toFloat();
+        auto& names = GLMScriptNames::get(object.engine());
+        if (object.property(names.length).toInt32() == 2) {
+            vec2.x = toFloat(object.property(0));
+            vec2.y = toFloat(object.property(1));
         }
-    } else {
-        QScriptValue x = object.property("x");
+    } else if (object.isObject()) {
+        auto& names = GLMScriptNames::get(object.engine());
+        QScriptValue x = object.property(names.x);
         if (!x.isValid()) {
-            x = object.property("u");
+            x = object.property(names.u);
         }
 
-        QScriptValue y = object.property("y");
+        QScriptValue y = object.property(names.y);
         if (!y.isValid()) {
-            y = object.property("v");
+            y = object.property(names.v);
         }
 
-        vec2.x = x.toVariant().toFloat();
-        vec2.y = y.toVariant().toFloat();
+        vec2.x = toFloat(x);
+        vec2.y = toFloat(y);
+    } else {
+        vec2 = glm::vec2(0.0f);
     }
 }
 
@@ -169,9 +252,8 @@ glm::vec2 vec2FromVariant(const QVariant &object) {
 }
 
 QScriptValue vec3ToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_vec3__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto& names = GLMScriptNames::get(engine);
+    auto prototype = getPrototype(engine, names.vec3Prototype, "__hifi_vec3__",
             "__hifi_vec3__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
@@ -183,21 +265,18 @@ QScriptValue vec3ToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
             "red: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
             "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
             "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
-            "})"
-        );
-    }
+            "})");
     QScriptValue value = engine->newObject();
-    value.setProperty("x", vec3.x);
-    value.setProperty("y", vec3.y);
-    value.setProperty("z", vec3.z);
+    value.setProperty(names.x, vec3.x);
+    value.setProperty(names.y, vec3.y);
+    value.setProperty(names.z, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
 
 QScriptValue vec3ColorToScriptValue(QScriptEngine* engine, const glm::vec3& vec3) {
-    auto prototype = engine->globalObject().property("__hifi_vec3_color__");
-    if (!prototype.property("defined").toBool()) {
-        prototype = engine->evaluate(
+    auto& names = GLMScriptNames::get(engine);
+    auto prototype = getPrototype(engine, names.vec3ColorPrototype, "__hifi_vec3_color__",
             "__hifi_vec3_color__ = Object.defineProperties({}, { "
             "defined: { value: true },"
             "0: { set: function(nv) { return this.red = nv; }, get: function() { return this.red; } },"
@@ -209,20 +288,18 @@ QScriptValue vec3ColorToScriptValue(QScriptEngine* engine, const glm::vec3& vec3
             "x: { set: function(nv) { return this.red = nv; }, get: function() { return this.red; } },"
             "y: { set: function(nv) { return this.green = nv; }, get: function() { return this.green; } },"
             "z: { set: function(nv) { return this.blue = nv; }, get: function() { return this.blue; } }"
-            "})"
-        );
-    }
+            "})");
     QScriptValue value = engine->newObject();
-    value.setProperty("red", vec3.x);
-    value.setProperty("green", vec3.y);
-    value.setProperty("blue", vec3.z);
+    value.setProperty(names.red, vec3.x);
+    value.setProperty(names.green, vec3.y);
+    value.setProperty(names.blue, vec3.z);
     value.setPrototype(prototype);
     return value;
 }
 
 void vec3FromScriptValue(const QScriptValue& object, glm::vec3& vec3) {
     if (object.isNumber()) {
-        vec3 = glm::vec3(object.toVariant().toFloat());
+        vec3 = glm::vec3(toFloat(object));
     } else if (object.isString()) {
         QColor qColor(object.toString());
         if (qColor.isValid()) {
@@ -231,40 +308,43 @@ void vec3FromScriptValue(const QScriptValue& object, glm::vec3& vec3) {
             vec3.z = qColor.blue();
         }
     } else if (object.isArray()) {
-        QVariantList list = object.toVariant().toList();
-        if (list.length() == 3) {
-            vec3.x = list[0].toFloat();
-            vec3.y = list[1].toFloat();
-            vec3.z = list[2].toFloat();
+        auto& names = GLMScriptNames::get(object.engine());
+        if (object.property(names.length).toInt32() == 3) {
+            vec3.x = toFloat(object.property(0));
+            vec3.y = toFloat(object.property(1));
+            vec3.z = toFloat(object.property(2));
         }
-    } else {
-        QScriptValue x = object.property("x");
+    } else if (object.isObject()) {
+        auto& names = GLMScriptNames::get(object.engine());
+        QScriptValue x = object.property(names.x);
         if (!x.isValid()) {
-            x = object.property("r");
+            x = object.property(names.r);
         }
         if (!x.isValid()) {
-            x = object.property("red");
+            x = object.property(names.red);
         }
 
-        QScriptValue y = object.property("y");
+        QScriptValue y = object.property(names.y);
         if (!y.isValid()) {
-            y = object.property("g");
+            y = object.property(names.g);
         }
         if (!y.isValid()) {
-            y = object.property("green");
+            y = object.property(names.green);
         }
 
-        QScriptValue z = object.property("z");
+        QScriptValue z = object.property(names.z);
         if (!z.isValid()) {
-            z = object.property("b");
+            z = object.property(names.b);
         }
         if (!z.isValid()) {
-            z = object.property("blue");
+            z = object.property(names.blue);
         }
 
-        vec3.x = x.toVariant().toFloat();
-        vec3.y = y.toVariant().toFloat();
-        vec3.z = z.toVariant().toFloat();
+        vec3.x = toFloat(x);
+        vec3.y = toFloat(y);
+        vec3.z = toFloat(z);
+    } else {
+        vec3 = glm::vec3(0.0f);
     }
 }
 
@@ -539,19 +619,25 @@ glm::u8vec3 u8vec3FromVariant(const QVariant& object) {
 }
 
 QScriptValue vec4toScriptValue(QScriptEngine* engine, const glm::vec4& vec4) {
+    auto& names = GLMScriptNames::get(engine);
     QScriptValue obj = engine->newObject();
-    obj.setProperty("x", vec4.x);
-    obj.setProperty("y", vec4.y);
-    obj.setProperty("z", vec4.z);
-    obj.setProperty("w", vec4.w);
+    obj.setProperty(names.x, vec4.x);
+    obj.setProperty(names.y, vec4.y);
+    obj.setProperty(names.z, vec4.z);
+    obj.setProperty(names.w, vec4.w);
     return obj;
 }
 
 void vec4FromScriptValue(const QScriptValue& object, glm::vec4& vec4) {
-    vec4.x = object.property("x").toVariant().toFloat();
-    vec4.y = object.property("y").toVariant().toFloat();
-    vec4.z = object.property("z").toVariant().toFloat();
-    vec4.w = object.property("w").toVariant().toFloat();
+    if (!object.isObject()) {
+        vec4 = glm::vec4(0.0f);
+        return;
+    }
+    auto& names = GLMScriptNames::get(object.engine());
+    vec4.x = toFloat(object.property(names.x));
+    vec4.y = toFloat(object.property(names.y));
+    vec4.z = toFloat(object.property(names.z));
+    vec4.w = toFloat(object.property(names.w));
 }
 
 QVariant vec4toVariant(const glm::vec4& vec4) {
@@ -605,43 +691,27 @@ glm::vec4 vec4FromVariant(const QVariant& object) {
 }
 
 QScriptValue mat4toScriptValue(QScriptEngine* engine, const glm::mat4& mat4) {
+    auto& names = GLMScriptNames::get(engine);
     QScriptValue obj = engine->newObject();
-    obj.setProperty("r0c0", mat4[0][0]);
-    obj.setProperty("r1c0", mat4[0][1]);
-    obj.setProperty("r2c0", mat4[0][2]);
-    obj.setProperty("r3c0", mat4[0][3]);
-    obj.setProperty("r0c1", mat4[1][0]);
-    obj.setProperty("r1c1", mat4[1][1]);
-    obj.setProperty("r2c1", mat4[1][2]);
-    obj.setProperty("r3c1", mat4[1][3]);
-    obj.setProperty("r0c2", mat4[2][0]);
-    obj.setProperty("r1c2", mat4[2][1]);
-    obj.setProperty("r2c2", mat4[2][2]);
-    obj.setProperty("r3c2", mat4[2][3]);
-    obj.setProperty("r0c3", mat4[3][0]);
-    obj.setProperty("r1c3", mat4[3][1]);
-    obj.setProperty("r2c3", mat4[3][2]);
-    obj.setProperty("r3c3", mat4[3][3]);
+    for (int column = 0; column < 4; column++) {
+        for (int row = 0; row < 4; row++) {
+            obj.setProperty(names.mat4[column][row], mat4[column][row]);
+        }
+    }
     return obj;
 }
 
 void mat4FromScriptValue(const QScriptValue& object, glm::mat4& mat4) {
-    mat4[0][0] = object.property("r0c0").toVariant().toFloat();
-    mat4[0][1] = object.property("r1c0").toVariant().toFloat();
-    mat4[0][2] = object.property("r2c0").toVariant().toFloat();
-    mat4[0][3] = object.property("r3c0").toVariant().toFloat();
-    mat4[1][0] = object.property("r0c1").toVariant().toFloat();
-    mat4[1][1] = object.property("r1c1").toVariant().toFloat();
-    mat4[1][2] = object.property("r2c1").toVariant().toFloat();
-    mat4[1][3] = object.property("r3c1").toVariant().toFloat();
-    mat4[2][0] = object.property("r0c2").toVariant().toFloat();
-    mat4[2][1] = object.property("r1c2").toVariant().toFloat();
-    mat4[2][2] = object.property("r2c2").toVariant().toFloat();
-    mat4[2][3] = object.property("r3c2").toVariant().toFloat();
-    mat4[3][0] = object.property("r0c3").toVariant().toFloat();
-    mat4[3][1] = object.property("r1c3").toVariant().toFloat();
-    mat4[3][2] = object.property("r2c3").toVariant().toFloat();
-    mat4[3][3] = object.property("r3c3").toVariant().toFloat();
+    if (!object.isObject()) {
+        mat4 = glm::mat4(glm::vec4(0.0f), glm::vec4(0.0f), glm::vec4(0.0f), glm::vec4(0.0f));
+        return;
+    }
+    auto& names = GLMScriptNames::get(object.engine());
+    for (int column = 0; column < 4; column++) {
+        for (int row = 0; row < 4; row++) {
+            mat4[column][row] = toFloat(object.property(names.mat4[column][row]));
+        }
+    }
 }
 
 QVariant mat4ToVariant(const glm::mat4& mat4) {
@@ -763,18 +833,24 @@ QScriptValue quatToScriptValue(QScriptEngine* engine, const glm::quat& quat) {
         // if quat contains a NaN don't try to convert it
         return obj;
     }
-    obj.setProperty("x", quat.x);
-    obj.setProperty("y", quat.y);
-    obj.setProperty("z", quat.z);
-    obj.setProperty("w", quat.w);
+    auto& names = GLMScriptNames::get(engine);
+    obj.setProperty(names.x, quat.x);
+    obj.setProperty(names.y, quat.y);
+    obj.setProperty(names.z, quat.z);
+    obj.setProperty(names.w, quat.w);
     return obj;
 }
 
 void quatFromScriptValue(const QScriptValue& object, glm::quat &quat) {
-    quat.x = object.property("x").toVariant().toFloat();
-    quat.y = object.property("y").toVariant().toFloat();
-    quat.z = object.property("z").toVariant().toFloat();
-    quat.w = object.property("w").toVariant().toFloat();
+    if (object.isObject()) {
+        auto& names = GLMScriptNames::get(object.engine());
+        quat.x = toFloat(object.property(names.x));
+        quat.y = toFloat(object.property(names.y));
+        quat.z = toFloat(object.property(names.z));
+        quat.w = toFloat(object.property(names.w));
+    } else {
+        quat = glm::quat(0.0f, 0.0f, 0.0f, 0.0f);
+    }
 
     // enforce normalized quaternion
     float length = glm::length(quat);
@@ -33,3 +33,18 @@ void ResourceRequestObserver::update(const QUrl& requestUrl,
     };
     emit resourceRequestEvent(data.toVariantMap());
 }
+
+/**jsdoc
+ * Information about a resource loading milestone.
+ * @typedef {object} ResourceRequestObserver.ResourceTiming
+ * @property {string} url - The URL of the resource.
+ * @property {string} event - The milestone reached.
+ * @property {number} elapsed - The time from the first request of the resource to the milestone, in ms.
+ */
+void ResourceRequestObserver::updateTiming(const QUrl& requestUrl, const QString& event, const qint64 elapsedMsecs) {
+    QJsonObject data { { "url", requestUrl.toString() },
+        { "event", event },
+        { "elapsed", elapsedMsecs }
+    };
+    emit resourceTimingEvent(data.toVariantMap());
+}
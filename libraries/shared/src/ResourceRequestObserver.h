@@ -31,6 +31,7 @@ class ResourceRequestObserver : public QObject, public Dependency {
 
 public:
     void update(const QUrl& requestUrl, const qint64 callerId = -1, const QString& extra = "");
+    void updateTiming(const QUrl& requestUrl, const QString& event, const qint64 elapsedMsecs);
 
 signals:
     /**jsdoc
@@ -58,4 +59,16 @@ signals:
      * Script.setTimeout(importEntities, 2000);
      */
     void resourceRequestEvent(QVariantMap result);
+
+    /**jsdoc
+     * Triggered when a resource reaches a loading milestone, such as the first mips of a texture being usable.
+     * @function ResourceRequestObserver.resourceTimingEvent
+     * @param {ResourceRequestObserver.ResourceTiming} timing - Information about the milestone.
+     * @returns {Signal}
+     * @example <caption>Report how long textures take to show their first mips.</caption>
+     * ResourceRequestObserver.resourceTimingEvent.connect(function (timing) {
+     *     print(timing.event + " " + timing.url + ": " + timing.elapsed + "ms");
+     * });
+     */
+    void resourceTimingEvent(QVariantMap timing);
 };
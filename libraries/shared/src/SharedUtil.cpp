@@ -133,6 +133,26 @@ quint64 usecTimestampNow(bool wantDebug) {
     return duration_cast<microseconds>(system_clock::now() - unixEpoch).count() + usecTimestampNowAdjust;
 }
 
+quint64 usecThreadCPUTime() {
+#ifdef Q_OS_WIN
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return 0;
+    }
+    // the times are in 100ns
+    auto toUsecs = [](const FILETIME& time) {
+        return (((quint64)time.dwHighDateTime << 32) | time.dwLowDateTime) / 10;
+    };
+    return toUsecs(kernelTime) + toUsecs(userTime);
+#else
+    timespec time;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+        return 0;
+    }
+    return (quint64)time.tv_sec * USECS_PER_SECOND + (quint64)time.tv_nsec / NSECS_PER_USEC;
+#endif
+}
+
 float secTimestampNow() {
     static const auto START_TIME = usecTimestampNow();
     const auto nowUsecs = usecTimestampNow() - START_TIME;
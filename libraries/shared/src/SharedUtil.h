@@ -88,6 +88,9 @@ const QByteArray HIGH_FIDELITY_USER_AGENT = "Mozilla/5.0 (HighFidelityInterface)
 quint64 usecTimestampNow(bool wantDebug = false);
 void usecTimestampNowForceClockSkew(qint64 clockSkew);
 
+// The time the calling thread has spent running, in usecs
+quint64 usecThreadCPUTime();
+
 inline bool afterUsecs(quint64& startUsecs, quint64 maxIntervalUecs) {
     auto now = usecTimestampNow();
     auto interval = now - startUsecs;
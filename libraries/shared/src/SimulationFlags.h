@@ -22,6 +22,9 @@ const uint8_t SCRIPT_POKE_SIMULATION_PRIORITY = SCRIPT_GRAB_SIMULATION_PRIORITY
 const uint8_t PERSONAL_SIMULATION_PRIORITY = SCRIPT_GRAB_SIMULATION_PRIORITY;
 const uint8_t AVATAR_ENTITY_SIMULATION_PRIORITY = PERSONAL_SIMULATION_PRIORITY;
 
+// an authoritative simulation (e.g. the physics of the entity-script-server) bids above everyone else
+const uint8_t AUTHORITATIVE_SIMULATION_PRIORITY = 255;
+
 
 namespace Simulation {
     const uint32_t DIRTY_POSITION = 0x0001;
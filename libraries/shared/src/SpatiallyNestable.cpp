@@ -78,6 +78,9 @@ void SpatiallyNestable::setParentID(const QUuid& parentID) {
             _parentKnowsMe = false;
         }
     });
+    if (parentChanged) {
+        _parentTransformGeneration++;
+    }
 
     if (parentChanged && success && parent) {
         parent->recalculateChildCauterization();
@@ -101,10 +104,36 @@ Transform SpatiallyNestable::getParentTransform(bool& success, int depth) const
         return result;
     }
     if (parent) {
+        bool canCache = _parentJointIndex == INVALID_JOINT_INDEX && !getScalesWithParent();
+        uint32_t generation = _parentTransformGeneration;
+        if (canCache) {
+            bool isCached = false;
+            _parentTransformCacheLock.withReadLock([&] {
+                if (_cachedParentTransformGeneration == generation && _cachedParent == parent.get()) {
+                    result = _cachedParentTransform;
+                    isCached = true;
+                }
+            });
+            if (isCached) {
+                return result;
+            }
+        }
+
         result = parent->getJointTransform(_parentJointIndex, success, depth + 1);
         if (getScalesWithParent()) {
             result.setScale(parent->scaleForChildren());
         }
+
+        if (canCache && success) {
+            _parentTransformCacheLock.withWriteLock([&] {
+                // don't keep it if an ancestor moved while it was computed
+                if (_parentTransformGeneration == generation) {
+                    _cachedParentTransformGeneration = generation;
+                    _cachedParent = parent.get();
+                    _cachedParentTransform = result;
+                }
+            });
+        }
     }
     return result;
 }
@@ -184,6 +213,7 @@ void SpatiallyNestable::forgetChild(SpatiallyNestablePointer newChild) const {
 
 void SpatiallyNestable::setParentJointIndex(quint16 parentJointIndex) {
     _parentJointIndex = parentJointIndex;
+    _parentTransformGeneration++;
     bool success = false;
     auto parent = getParentPointer(success);
     if (success && parent) {
@@ -1117,8 +1147,14 @@ void SpatiallyNestable::forEachDescendantTest(const ChildLambdaTest& actor) cons
 void SpatiallyNestable::locationChanged(bool tellPhysics, bool tellChildren) {
     if (tellChildren) {
         forEachChild([&](SpatiallyNestablePointer object) {
+            object->_parentTransformGeneration++;
             object->locationChanged(tellPhysics, tellChildren);
         });
+    } else {
+        // the children aren't told but the transforms they cached still depend on this one
+        forEachDescendant([&](SpatiallyNestablePointer object) {
+            object->_parentTransformGeneration++;
+        });
     }
 }
 
@@ -264,6 +264,15 @@ private:
     bool _isDead { false };
     bool _queryAACubeIsPuffed { false };
 
+    // The transform of the parent, reused until the generation is bumped by a change of the location of an ancestor
+    // or of the parenting.  Only kept for children which aren't attached to a joint or scaled with their parent,
+    // those can change without a call to locationChanged.
+    mutable std::atomic<uint32_t> _parentTransformGeneration { 1 };
+    mutable ReadWriteLockable _parentTransformCacheLock;
+    mutable uint32_t _cachedParentTransformGeneration { 0 };
+    mutable const SpatiallyNestable* _cachedParent { nullptr };
+    mutable Transform _cachedParentTransform;
+
     void breakParentingLoop() const;
 };
 
@@ -20,6 +20,9 @@
 #include <tbb/concurrent_unordered_set.h>
 #include <tbb/concurrent_vector.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_init.h>
 #include <tbb/blocked_range2d.h>
 
 #ifdef _WIN32
@@ -8,7 +8,9 @@
 
 #include "Trace.h"
 
+#include <algorithm>
 #include <chrono>
+#include <limits>
 
 #include <QtCore/QDebug>
 #include <QtCore/QCoreApplication>
@@ -36,6 +38,93 @@
 
 using namespace tracing;
 
+// a power of two, so that the ring index is a mask of the number of events written
+static const uint64_t EVENTS_PER_THREAD = 1 << 15;
+static const uint64_t EVENT_INDEX_MASK = EVENTS_PER_THREAD - 1;
+
+static std::atomic<uint32_t> nextTracerID { 0 };
+
+// The last events of one thread.  Only that thread writes them and only serialize reads them, which is done without
+// a lock by publishing the number of events written after each write.
+class Tracer::ThreadEvents {
+public:
+    ThreadEvents(int64_t threadID) : threadID(threadID), events(EVENTS_PER_THREAD) {}
+
+    const int64_t threadID;
+    std::vector<BinaryTraceEvent> events;
+    std::atomic<uint64_t> numWritten { 0 };
+    std::atomic<bool> isRetired { false };
+
+    // only used by serialize, under the threadEvents mutex
+    uint64_t numRead { 0 };
+
+    // only used by the thread that writes the events, so that the names are only interned once per thread
+    QHash<QString, uint32_t> nameIDs;
+};
+
+Tracer::Tracer() : _id(nextTracerID++) {
+}
+
+Tracer::ThreadEvents& Tracer::getThreadEvents() {
+    // retires the events of a thread when it ends, serialize drops them once they are read
+    struct Holder {
+        ~Holder() {
+            if (events) {
+                events->isRetired = true;
+            }
+        }
+        uint32_t tracerID { 0 };
+        std::shared_ptr<ThreadEvents> events;
+    };
+    thread_local Holder holder;
+
+    if (!holder.events || holder.tracerID != _id) {
+        if (holder.events) {
+            holder.events->isRetired = true;
+        }
+        holder.tracerID = _id;
+        holder.events = std::make_shared<ThreadEvents>(int64_t(QThread::currentThreadId()));
+        std::lock_guard<std::mutex> guard(_threadEventsMutex);
+        _threadEvents.push_back(holder.events);
+    }
+    return *holder.events;
+}
+
+uint32_t Tracer::internName(ThreadEvents& threadEvents, const QString& name) {
+    auto itr = threadEvents.nameIDs.constFind(name);
+    if (itr != threadEvents.nameIDs.constEnd()) {
+        return itr.value();
+    }
+
+    uint32_t nameID;
+    {
+        std::lock_guard<std::mutex> guard(_namesMutex);
+        auto globalItr = _nameIDs.constFind(name);
+        if (globalItr != _nameIDs.constEnd()) {
+            nameID = globalItr.value();
+        } else {
+            nameID = (uint32_t)_names.size();
+            _names.push_back(name);
+            _nameIDs.insert(name, nameID);
+        }
+    }
+    threadEvents.nameIDs.insert(name, nameID);
+    return nameID;
+}
+
+void Tracer::traceDuration(const QLoggingCategory& category, const QString& name, EventType type, int64_t timestamp,
+                           uint64_t payload) {
+    if (!_enabled) {
+        return;
+    }
+
+    auto& threadEvents = getThreadEvents();
+    uint64_t index = threadEvents.numWritten.load(std::memory_order_relaxed);
+    threadEvents.events[index & EVENT_INDEX_MASK] = { timestamp, payload, &category,
+                                                      internName(threadEvents, name), type };
+    threadEvents.numWritten.store(index + 1, std::memory_order_release);
+}
+
 bool tracing::enabled() {
     return DependencyManager::get<Tracer>()->isEnabled();
 }
@@ -48,6 +137,13 @@ void Tracer::startTracing() {
     }
 
     _events.clear();
+    {
+        // drop the events of the rings that were written before this trace
+        std::lock_guard<std::mutex> threadEventsGuard(_threadEventsMutex);
+        for (auto& threadEvents : _threadEvents) {
+            threadEvents->numRead = threadEvents->numWritten.load(std::memory_order_acquire);
+        }
+    }
     _enabled = true;
 }
 
@@ -105,39 +201,109 @@ void TraceEvent::writeJson(QTextStream& out) const {
 #endif
 }
 
-void Tracer::serialize(const QString& filename) {
-    QString fullPath = FileUtils::replaceDateTimeTokens(filename);
-    fullPath = FileUtils::computeDocumentPath(fullPath);
-    if (!FileUtils::canCreateFile(fullPath)) {
-        return;
-    }
-
+std::list<TraceEvent> Tracer::takeEvents(bool keepEvents, int64_t minTimestamp) {
     std::list<TraceEvent> currentEvents;
     {
         std::lock_guard<std::mutex> guard(_eventsMutex);
-        currentEvents.swap(_events);
+        if (keepEvents) {
+            for (const auto& event : _events) {
+                if (event.timestamp >= minTimestamp) {
+                    currentEvents.push_back(event);
+                }
+            }
+        } else {
+            currentEvents.swap(_events);
+        }
         for (auto& event : _metadataEvents) {
             currentEvents.push_back(event);
         }
     }
 
-    // If we can't open a temp file for writing, fail early
-    QByteArray data;
+    // Copy the rings while the threads keep writing to them, then drop what could have been overwritten during the copy.
+    auto processID = QCoreApplication::applicationPid();
+    std::vector<BinaryTraceEvent> binaryEvents;
+    std::vector<int64_t> binaryThreadIDs;
+    {
+        std::lock_guard<std::mutex> guard(_threadEventsMutex);
+        for (auto& threadEvents : _threadEvents) {
+            uint64_t end = threadEvents->numWritten.load(std::memory_order_acquire);
+            uint64_t begin = std::max(threadEvents->numRead, end > EVENTS_PER_THREAD ? end - EVENTS_PER_THREAD : 0);
+            size_t offset = binaryEvents.size();
+            for (uint64_t i = begin; i < end; i++) {
+                binaryEvents.push_back(threadEvents->events[i & EVENT_INDEX_MASK]);
+            }
+            uint64_t endAfterCopy = threadEvents->numWritten.load(std::memory_order_acquire);
+            if (endAfterCopy > EVENTS_PER_THREAD && endAfterCopy - EVENTS_PER_THREAD > begin) {
+                uint64_t numOverwritten = std::min(endAfterCopy - EVENTS_PER_THREAD, end) - begin;
+                binaryEvents.erase(binaryEvents.begin() + offset, binaryEvents.begin() + offset + numOverwritten);
+            }
+            binaryThreadIDs.resize(binaryEvents.size(), threadEvents->threadID);
+            if (!keepEvents) {
+                threadEvents->numRead = end;
+            }
+        }
+        if (!keepEvents) {
+            _threadEvents.erase(std::remove_if(_threadEvents.begin(), _threadEvents.end(),
+                [](const std::shared_ptr<ThreadEvents>& threadEvents) { return threadEvents->isRetired.load(); }),
+                _threadEvents.end());
+        }
+    }
     {
-        QTextStream out(&data);
-        out << "[\n";
-        bool first = true;
-        for (const auto& event : currentEvents) {
-            if (first) {
-                first = false;
-            } else {
-                out << ",\n";
+        std::lock_guard<std::mutex> guard(_namesMutex);
+        for (size_t i = 0; i < binaryEvents.size(); i++) {
+            const auto& event = binaryEvents[i];
+            if (event.timestamp < minTimestamp) {
+                continue;
+            }
+            QVariantMap args;
+            if (event.type == DurationBegin) {
+                args["nv_payload"] = QVariant::fromValue(event.payload);
             }
-            event.writeJson(out);
+            currentEvents.push_back({ "", _names[event.nameID], event.type, event.timestamp, processID,
+                                      binaryThreadIDs[i], *event.category, args, {} });
+        }
+    }
+    return currentEvents;
+}
+
+QByteArray Tracer::toJson(const std::list<TraceEvent>& events) {
+    QByteArray data;
+    QTextStream out(&data);
+    out << "[\n";
+    bool first = true;
+    for (const auto& event : events) {
+        if (first) {
+            first = false;
+        } else {
+            out << ",\n";
         }
-        out << "\n]";
+        event.writeJson(out);
+    }
+    out << "\n]";
+    out.flush();
+    return data;
+}
+
+void Tracer::setRollingWindow(int64_t windowUsecs) {
+    std::lock_guard<std::mutex> guard(_eventsMutex);
+    _rollingWindowUsecs = windowUsecs;
+}
+
+QByteArray Tracer::snapshot(int64_t windowUsecs) {
+    QByteArray compressed;
+    gzip(toJson(takeEvents(true, now() - windowUsecs)), compressed);
+    return compressed;
+}
+
+void Tracer::serialize(const QString& filename) {
+    QString fullPath = FileUtils::replaceDateTimeTokens(filename);
+    fullPath = FileUtils::computeDocumentPath(fullPath);
+    if (!FileUtils::canCreateFile(fullPath)) {
+        return;
     }
 
+    QByteArray data = toJson(takeEvents(false, std::numeric_limits<int64_t>::min()));
+
     if (fullPath.endsWith(".gz")) {
         QByteArray compressed;
         gzip(data, compressed);
@@ -220,6 +386,13 @@ void Tracer::traceEvent(const QLoggingCategory& category,
             args,
             extra
         });
+
+        // a trace that is always on only keeps the events of its window
+        if (_rollingWindowUsecs > 0) {
+            while (!_events.empty() && _events.front().timestamp < timestamp - _rollingWindowUsecs) {
+                _events.pop_front();
+            }
+        }
     }
 }
 
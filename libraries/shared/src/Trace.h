@@ -10,9 +10,13 @@
 #ifndef hifi_Trace_h
 #define hifi_Trace_h
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
+#include <vector>
 
+#include <QtCore/QHash>
 #include <QtCore/QString>
 #include <QtCore/QVariantMap>
 #include <QtCore/QHash>
@@ -76,9 +80,27 @@ struct TraceEvent {
     void writeJson(QTextStream& out) const;
 };
 
+// A duration event without strings or maps, which is only turned into a TraceEvent when the trace is serialized
+struct BinaryTraceEvent {
+    int64_t timestamp;
+    uint64_t payload;
+    const QLoggingCategory* category;
+    uint32_t nameID;
+    EventType type;
+};
+
 class Tracer : public Dependency {
 public:
+    Tracer();
+
     static int64_t now();
+
+    // The begin and end events of the durations, which are kept in a ring of the last events of each thread that only
+    // that thread writes to, so that they take no lock.  An event is lost when its thread's ring wraps before it is
+    // serialized.
+    void traceDuration(const QLoggingCategory& category, const QString& name, EventType type, int64_t timestamp,
+                       uint64_t payload = 0);
+
     void traceEvent(const QLoggingCategory& category, 
         const QString& name, EventType type,
         const QString& id = "", 
@@ -93,6 +115,12 @@ public:
     void startTracing();
     void stopTracing();
     void serialize(const QString& file);
+
+    // Keeps only the events of the last windowUsecs of a trace that is always on, 0 keeps them all until serialize
+    void setRollingWindow(int64_t windowUsecs);
+
+    // The gzipped JSON of the events of the last windowUsecs, which stay in the trace
+    QByteArray snapshot(int64_t windowUsecs);
     bool isEnabled() const { return _enabled; }
 
 private:
@@ -102,10 +130,28 @@ private:
         const QString& id = "",
         const QVariantMap& args = QVariantMap(), const QVariantMap& extra = QVariantMap());
 
-    bool _enabled { false };
+    class ThreadEvents;
+    ThreadEvents& getThreadEvents();
+    uint32_t internName(ThreadEvents& threadEvents, const QString& name);
+
+    // the events since the last time they were taken, or the ones since minTimestamp that are kept when keepEvents
+    std::list<TraceEvent> takeEvents(bool keepEvents, int64_t minTimestamp);
+    static QByteArray toJson(const std::list<TraceEvent>& events);
+
+    const uint32_t _id;
+    std::atomic<bool> _enabled { false };
     std::list<TraceEvent> _events;
     std::list<TraceEvent> _metadataEvents;
     std::mutex _eventsMutex;
+    int64_t _rollingWindowUsecs { 0 };
+
+    std::mutex _threadEventsMutex;
+    std::vector<std::shared_ptr<ThreadEvents>> _threadEvents;
+
+    // the names of the binary events, by their IDs
+    std::mutex _namesMutex;
+    QHash<QString, uint32_t> _nameIDs;
+    std::vector<QString> _names;
 };
 
 inline void traceEvent(const QLoggingCategory& category, int64_t timestamp, const QString& name, EventType type, const QString& id = "", const QVariantMap& args = {}, const QVariantMap& extra = {}) {
@@ -128,6 +174,16 @@ inline void traceEvent(const QLoggingCategory& category, const QString& name, Ev
     }
 }
 
+inline void traceDuration(const QLoggingCategory& category, const QString& name, EventType type, int64_t timestamp, uint64_t payload = 0) {
+    if (!DependencyManager::isSet<Tracer>()) {
+        return;
+    }
+    const auto& tracer = DependencyManager::get<Tracer>();
+    if (tracer) {
+        tracer->traceDuration(category, name, type, timestamp, payload);
+    }
+}
+
 inline void traceEvent(const QLoggingCategory& category, const QString& name, EventType type, int id, const QVariantMap& args = {}, const QVariantMap& extra = {}) {
     traceEvent(category, name, type, QString::number(id), args, extra);
 }
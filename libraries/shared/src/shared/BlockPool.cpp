@@ -0,0 +1,61 @@
+//
+//  BlockPool.cpp
+//  libraries/shared/src/shared
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BlockPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+BlockPool::BlockPool(size_t blockSize, size_t blocksPerSlab) :
+    // the blocks of a slab keep the alignment of the slab, which new[] aligns for any type
+    _blockSize((std::max(blockSize, sizeof(FreeBlock)) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1)),
+    _blocksPerSlab(std::max(blocksPerSlab, (size_t)1)) {
+}
+
+void* BlockPool::allocate() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (!_freeBlocks) {
+        std::unique_ptr<char[]> slab { new char[_blockSize * _blocksPerSlab] };
+        // threaded back to front so that the blocks are handed out in the order they are in the slab
+        for (size_t i = _blocksPerSlab; i > 0; --i) {
+            auto block = reinterpret_cast<FreeBlock*>(slab.get() + (i - 1) * _blockSize);
+            block->next = _freeBlocks;
+            _freeBlocks = block;
+        }
+        _slabs.push_back(std::move(slab));
+    }
+
+    FreeBlock* block = _freeBlocks;
+    _freeBlocks = block->next;
+    ++_numBlocks;
+    return block;
+}
+
+void BlockPool::release(void* block) {
+    if (!block) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(_mutex);
+    assert(_numBlocks > 0);
+    auto freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = _freeBlocks;
+    _freeBlocks = freeBlock;
+    --_numBlocks;
+}
+
+size_t BlockPool::getNumBlocks() const {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _numBlocks;
+}
+
+size_t BlockPool::getNumBytes() const {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _slabs.size() * _blocksPerSlab * _blockSize;
+}
@@ -0,0 +1,49 @@
+//
+//  BlockPool.h
+//  libraries/shared/src/shared
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BlockPool_h
+#define hifi_BlockPool_h
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Hands out blocks of one size from slabs of many blocks, for the small objects that are made and destroyed by the
+// million (like the elements of the octrees), so that they sit next to each other in memory and don't each cost a trip
+// to the heap.  The released blocks are reused but the slabs are only freed with the pool.
+class BlockPool {
+public:
+    BlockPool(size_t blockSize, size_t blocksPerSlab);
+
+    void* allocate();
+    void release(void* block);
+
+    size_t getBlockSize() const { return _blockSize; }
+    // the blocks handed out and not released
+    size_t getNumBlocks() const;
+    // the memory of the slabs, used or not
+    size_t getNumBytes() const;
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    const size_t _blockSize;
+    const size_t _blocksPerSlab;
+
+    mutable std::mutex _mutex;
+    std::vector<std::unique_ptr<char[]>> _slabs;
+    FreeBlock* _freeBlocks { nullptr };
+    size_t _numBlocks { 0 };
+};
+
+#endif // hifi_BlockPool_h
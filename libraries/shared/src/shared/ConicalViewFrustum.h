@@ -38,6 +38,8 @@ public:
     const glm::vec3& getPosition() const { return _position; }
     const glm::vec3& getDirection() const { return _direction; }
     float getAngle() const { return _angle; }
+    float getSinAngle() const { return _sinAngle; }
+    float getCosAngle() const { return _cosAngle; }
     float getRadius() const { return _radius; }
     float getFarClip() const { return _farClip; }
 
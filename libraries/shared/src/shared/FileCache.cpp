@@ -23,6 +23,7 @@
 
 #include "../PathUtils.h"
 #include "../NumericalConstants.h"
+#include "../Profile.h"
 
 #ifdef Q_OS_WIN
 #include <sys/utime.h>
@@ -87,6 +88,7 @@ FileCache::~FileCache() {
 }
 
 void FileCache::initialize() {
+    PROFILE_RANGE(startup, "FileCache::initialize");
     Lock lock(_mutex);
     if (_initialized) {
         qCWarning(file_cache) << "File cache already initialized";
@@ -118,6 +120,40 @@ void FileCache::initialize() {
     _initialized = true;
 }
 
+void FileCache::initializeAsync() {
+    {
+        Lock lock(_mutex);
+        if (_initialized || _initializing) {
+            qCWarning(file_cache) << "File cache already initialized";
+            return;
+        }
+        _initializing = true;
+    }
+
+    // the thread keeps the cache alive until it is done
+    auto self = shared_from_this();
+    std::thread([self] {
+        {
+            Lock lock(self->_mutex);
+            self->_initializingThread = std::this_thread::get_id();
+        }
+        self->initialize();
+        {
+            Lock lock(self->_mutex);
+            self->_initializing = false;
+            self->_initializingThread = std::thread::id();
+        }
+        self->_initializingDone.notify_all();
+    }).detach();
+}
+
+void FileCache::waitForInitialization(Lock& lock) {
+    if (_initializingThread == std::this_thread::get_id()) {
+        return;
+    }
+    _initializingDone.wait(lock, [this] { return !_initializing; });
+}
+
 std::unique_ptr<File> FileCache::createFile(Metadata&& metadata, const std::string& filepath) {
     return std::unique_ptr<File>(new cache::File(std::move(metadata), filepath));
 }
@@ -147,6 +183,7 @@ FilePointer FileCache::writeFile(const char* data, File::Metadata&& metadata, bo
 
 
     Lock lock(_mutex);
+    waitForInitialization(lock);
 
     if (!_initialized) {
         qCWarning(file_cache) << "File cache used before initialization";
@@ -183,6 +220,7 @@ FilePointer FileCache::writeFile(const char* data, File::Metadata&& metadata, bo
 
 FilePointer FileCache::getFile(const Key& key) {
     Lock lock(_mutex);
+    waitForInitialization(lock);
 
     FilePointer file;
     if (!_initialized) {
@@ -299,6 +337,7 @@ void FileCache::clean() {
 
 void FileCache::wipe() {
     Lock lock(_mutex);
+    waitForInitialization(lock);
     while (!_unusedFiles.empty()) {
         eject(*_unusedFiles.begin());
     }
@@ -11,12 +11,14 @@
 #define hifi_FileCache_h
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <cstddef>
 #include <map>
 #include <unordered_set>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 #include <QObject>
@@ -94,6 +96,8 @@ signals:
 public:
     /// must be called after construction to create the cache on the fs and restore persisted files
     virtual void initialize();
+    /// the same as initialize, on a worker thread, the cache waits for it to be done before it is used
+    void initializeAsync();
 
     // Add file to the cache and return the cache entry.  
     FilePointer writeFile(const char* data, Metadata&& metadata, bool overwrite = false);
@@ -123,6 +127,9 @@ private:
 
     size_t getOverbudgetAmount() const;
 
+    // with _mutex locked, waits for initializeAsync to be done unless it is the thread doing it
+    void waitForInitialization(Lock& lock);
+
     // FIXME it might be desirable to have the min free space variable be static so it can be
     // shared among multiple instances of FileCache
     std::atomic<size_t> _minFreeSpaceSize { DEFAULT_MIN_FREE_STORAGE_SPACE };
@@ -136,8 +143,11 @@ private:
     const std::string _dirname;
     const std::string _dirpath;
     bool _initialized { false };
+    bool _initializing { false };
+    std::thread::id _initializingThread;
 
     Mutex _mutex;
+    std::condition_variable_any _initializingDone;
     Map _files;
     Set _unusedFiles;
 };
@@ -0,0 +1,93 @@
+//
+//  FrameBudget.cpp
+//  libraries/shared/src/shared
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameBudget.h"
+
+#include <QtCore/QThread>
+
+#include "../Profile.h"
+#include "../SharedUtil.h"
+
+static const char* CATEGORY_NAMES[FrameBudget::NUM_CATEGORIES] = { "entityAdd", "resourceFinished", "scriptEvent" };
+
+void FrameBudget::beginFrame(uint64_t budgetUsecs) {
+    Q_ASSERT(isOnBudgetThread());
+    _frameExpiry = usecTimestampNow() + budgetUsecs;
+    _inFrame = true;
+}
+
+bool FrameBudget::hasTime() const {
+    if (!_inFrame || !isOnBudgetThread()) {
+        return true;
+    }
+    return usecTimestampNow() < _frameExpiry;
+}
+
+void FrameBudget::defer(Category category, QObject* context, Work work) {
+    {
+        std::unique_lock<std::mutex> lock(_deferredMutex);
+        _deferred.push_back({ category, context, work });
+    }
+    countDeferred(category);
+}
+
+void FrameBudget::countDeferred(Category category, int count) {
+    _deferredCounts[category] += count;
+    _frameDeferredCounts[category] += count;
+}
+
+void FrameBudget::runDeferred() {
+    Q_ASSERT(isOnBudgetThread());
+    std::vector<DeferredWork> deferred;
+    {
+        std::unique_lock<std::mutex> lock(_deferredMutex);
+        if (_deferred.empty()) {
+            return;
+        }
+        deferred.swap(_deferred);
+    }
+
+    PROFILE_RANGE_EX(app, "DeferredWork", 0xffff00ff, (uint64_t)deferred.size());
+    // the work deferred while this runs waits for the next frame, so a piece of work that defers itself can't
+    // hold up the frame
+    auto itr = deferred.begin();
+    do {
+        if (itr->context) {
+            itr->work();
+        }
+        ++itr;
+    } while (itr != deferred.end() && hasTime());
+
+    if (itr != deferred.end()) {
+        std::unique_lock<std::mutex> lock(_deferredMutex);
+        _deferred.insert(_deferred.begin(), std::make_move_iterator(itr), std::make_move_iterator(deferred.end()));
+    }
+}
+
+void FrameBudget::endFrame() {
+    Q_ASSERT(isOnBudgetThread());
+    _inFrame = false;
+
+    QVariantMap counts;
+    for (int i = 0; i < NUM_CATEGORIES; ++i) {
+        counts[CATEGORY_NAMES[i]] = _frameDeferredCounts[i].exchange(0);
+    }
+    counts["pending"] = (quint64)getNumDeferred();
+    PROFILE_COUNTER(app, "deferredWork", counts);
+}
+
+size_t FrameBudget::getNumDeferred() const {
+    std::unique_lock<std::mutex> lock(_deferredMutex);
+    return _deferred.size();
+}
+
+bool FrameBudget::isOnBudgetThread() const {
+    return QThread::currentThread() == thread();
+}
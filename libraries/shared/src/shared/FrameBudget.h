@@ -0,0 +1,88 @@
+//
+//  FrameBudget.h
+//  libraries/shared/src/shared
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_FrameBudget_h
+#define hifi_FrameBudget_h
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+
+#include "../DependencyManager.h"
+
+// The time the main thread can spend on work that may wait for the next frame, like adding the entities
+// that arrived to the scene, the finished signals of the resources and the script events.  The update of a
+// frame begins it, the deferrable work checks for the time that is left and defers what it couldn't do, and
+// the deferred work runs in the order it was deferred during the next frames.  At least one piece of work
+// runs per frame so that the deferred work always gets done, even when the frames are over budget.
+class FrameBudget : public QObject, public Dependency {
+    Q_OBJECT
+    SINGLETON_DEPENDENCY
+
+public:
+    enum Category {
+        ENTITY_ADD = 0,
+        RESOURCE_FINISHED,
+        SCRIPT_EVENT,
+
+        NUM_CATEGORIES
+    };
+
+    using Work = std::function<void()>;
+
+    // starts the budget of a frame, on the main thread
+    void beginFrame(uint64_t budgetUsecs);
+
+    // true while there is time left in the frame, and always off the main thread or outside of a frame
+    bool hasTime() const;
+
+    // queues the work for the next time the deferred work runs, from any thread.  The work is dropped if the
+    // context is destroyed before it runs.
+    void defer(Category category, QObject* context, Work work);
+
+    // counts the work that was left for the next frame without going through defer()
+    void countDeferred(Category category, int count = 1);
+
+    // runs the deferred work until the budget of the frame is spent, on the main thread
+    void runDeferred();
+
+    // ends the budget of the frame and traces how much was deferred in it
+    void endFrame();
+
+    // the work deferred since the start, per category
+    uint64_t getDeferredCount(Category category) const { return _deferredCounts[category]; }
+
+    size_t getNumDeferred() const;
+
+private:
+    struct DeferredWork {
+        Category category;
+        QPointer<QObject> context;
+        Work work;
+    };
+
+    bool isOnBudgetThread() const;
+
+    uint64_t _frameExpiry { 0 };
+    bool _inFrame { false };
+
+    mutable std::mutex _deferredMutex;
+    std::vector<DeferredWork> _deferred;
+
+    std::array<std::atomic<uint64_t>, NUM_CATEGORIES> _deferredCounts {};
+    std::array<std::atomic<int>, NUM_CATEGORIES> _frameDeferredCounts {};
+};
+
+#endif // hifi_FrameBudget_h
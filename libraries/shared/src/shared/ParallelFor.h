@@ -0,0 +1,42 @@
+//
+//  ParallelFor.h
+//  libraries/shared/src/shared
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ParallelFor_h
+#define hifi_ParallelFor_h
+
+#include <algorithm>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+// Splits [0, count) into one contiguous range per hardware thread, but no smaller than minCountPerRange, and calls
+// operation(begin, end) for each range concurrently, the first one on the calling thread. Returns once all are done.
+// Each call gets its own range, so the operation can set up per thread state, like a script engine, once per call.
+template <typename F>
+void parallelForRanges(int count, int minCountPerRange, const F& operation) {
+    int numRanges = std::min((int)std::thread::hardware_concurrency(), count / std::max(1, minCountPerRange));
+    numRanges = std::max(1, numRanges);
+
+    std::vector<std::thread> threads;
+    threads.reserve(numRanges - 1);
+    for (int i = 1; i < numRanges; ++i) {
+        threads.emplace_back([&operation, count, numRanges, i] {
+            operation((int)((int64_t)count * i / numRanges), (int)((int64_t)count * (i + 1) / numRanges));
+        });
+    }
+
+    operation(0, count / numRanges);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+#endif // hifi_ParallelFor_h
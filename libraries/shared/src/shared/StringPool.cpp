@@ -0,0 +1,58 @@
+//
+//  StringPool.cpp
+//  libraries/shared/src/shared
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "StringPool.h"
+
+#include <algorithm>
+
+static const int MIN_PRUNE_SIZE = 256;
+
+QString StringPool::intern(const QString& string) {
+    if (string.isEmpty()) {
+        return string;
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto itr = _strings.constFind(string);
+    if (itr != _strings.constEnd()) {
+        return *itr;
+    }
+
+    if (_strings.size() >= std::max(_pruneSize, MIN_PRUNE_SIZE)) {
+        prune();
+    }
+    return *_strings.insert(string);
+}
+
+int StringPool::getNumStrings() const {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _strings.size();
+}
+
+size_t StringPool::getNumBytes() const {
+    std::unique_lock<std::mutex> lock(_mutex);
+    size_t numBytes = 0;
+    for (const auto& string : _strings) {
+        numBytes += string.size() * sizeof(QChar);
+    }
+    return numBytes;
+}
+
+void StringPool::prune() {
+    for (auto itr = _strings.begin(); itr != _strings.end();) {
+        // nothing but the pool holds this one
+        if (itr->isDetached()) {
+            itr = _strings.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+    _pruneSize = 2 * _strings.size();
+}
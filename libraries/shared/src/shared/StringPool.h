@@ -0,0 +1,39 @@
+//
+//  StringPool.h
+//  libraries/shared/src/shared
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_StringPool_h
+#define hifi_StringPool_h
+
+#include <mutex>
+
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+// Shares the data of equal strings, for the values that many objects hold the same copy of (urls, scripts) but that
+// come from separate sources, like the entities read from the network.  The strings that only the pool still holds
+// are dropped once the pool has doubled in size since it last looked for them.
+class StringPool {
+public:
+    // a string equal to the one given that shares its data with the other strings interned equal to it
+    QString intern(const QString& string);
+
+    int getNumStrings() const;
+    // the memory of the characters of the strings in the pool
+    size_t getNumBytes() const;
+
+private:
+    void prune();
+
+    mutable std::mutex _mutex;
+    QSet<QString> _strings;
+    int _pruneSize { 0 };
+};
+
+#endif // hifi_StringPool_h
@@ -332,6 +332,15 @@ QObject* TabletScriptingInterface::getFlags() {
 static const char* TABLET_HOME_SOURCE_URL = "hifi/tablet/TabletHome.qml";
 static const char* VRMENU_SOURCE_URL = "hifi/tablet/TabletMenu.qml";
 
+// the apps of the tablet that are QML, most opened first, created once in the background so that opening them
+// the first time doesn't hitch
+static const QList<QUrl> TABLET_WARM_UP_SOURCE_URLS {
+    QUrl(VRMENU_SOURCE_URL),
+    QUrl("hifi/tablet/TabletAddressDialog.qml"),
+    QUrl("hifi/audio/Audio.qml"),
+    QUrl("hifi/tablet/TabletGeneralPreferences.qml"),
+};
+
 class TabletRootWindow : public QmlWindowClass {
     virtual QString qmlSource() const override { return "hifi/tablet/WindowRoot.qml"; }
 public:
@@ -520,6 +529,10 @@ void TabletProxy::setQmlTabletRoot(OffscreenQmlSurface* qmlOffscreenSurface) {
         // force to the tablet to go to the homescreen
         loadHomeScreen(true);
 
+        if (!_toolbarMode) {
+            _qmlOffscreenSurface->warmUp(TABLET_WARM_UP_SOURCE_URLS);
+        }
+
         QMetaObject::invokeMethod(_qmlTabletRoot, "setUsername", Q_ARG(const QVariant&, QVariant(getUsername())));
 
         // hook up username changed signal.
@@ -18,6 +18,8 @@
 
 #include <glm/gtx/quaternion.hpp>
 
+#include <TBBHelpers.h>
+
 using namespace workload;
 
 Space::Space() : Collection() {
@@ -90,11 +92,43 @@ void Space::processUpdates(const Transaction::Updates& transactions) {
     }
 }
 
+// the proxies are classified in chunks of this size across the tbb threads
+static const uint32_t CATEGORIZE_CHUNK_SIZE = 4096;
+
 void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     uint32_t numProxies = (uint32_t)_proxies.size();
+    uint32_t numChunks = (numProxies + CATEGORIZE_CHUNK_SIZE - 1) / CATEGORIZE_CHUNK_SIZE;
+    if (numChunks <= 1) {
+        categorizeProxies(0, numProxies, changes);
+        return;
+    }
+
+    // each chunk collects its own changes, concatenated in order so that they are the same as a single pass
+    if (_chunkChanges.size() < numChunks) {
+        _chunkChanges.resize(numChunks);
+    }
+    tbb::parallel_for(tbb::blocked_range<uint32_t>(0, numChunks), [&](const tbb::blocked_range<uint32_t>& range) {
+        for (uint32_t chunk = range.begin(); chunk != range.end(); ++chunk) {
+            uint32_t begin = chunk * CATEGORIZE_CHUNK_SIZE;
+            _chunkChanges[chunk].clear();
+            categorizeProxies(begin, std::min(begin + CATEGORIZE_CHUNK_SIZE, numProxies), _chunkChanges[chunk]);
+        }
+    });
+
+    size_t numChanges = changes.size();
+    for (uint32_t chunk = 0; chunk < numChunks; ++chunk) {
+        numChanges += _chunkChanges[chunk].size();
+    }
+    changes.reserve(numChanges);
+    for (uint32_t chunk = 0; chunk < numChunks; ++chunk) {
+        changes.insert(changes.end(), _chunkChanges[chunk].begin(), _chunkChanges[chunk].end());
+    }
+}
+
+void Space::categorizeProxies(uint32_t begin, uint32_t end, std::vector<Space::Change>& changes) {
     uint32_t numViews = (uint32_t)_views.size();
-    for (uint32_t i = 0; i < numProxies; ++i) {
+    for (uint32_t i = begin; i < end; ++i) {
         Proxy& proxy = _proxies[i];
         if (proxy.region < Region::INVALID) {
             glm::vec3 proxyCenter = glm::vec3(proxy.sphere);
@@ -60,12 +60,18 @@ private:
     void processRemoves(const Transaction::Removes& transactions);
     void processUpdates(const Transaction::Updates& transactions);
 
+    // classify the proxies in [begin, end) and append those that changed region, with the proxies locked
+    void categorizeProxies(uint32_t begin, uint32_t end, std::vector<Change>& changes);
+
     // The database of proxies is protected for editing by a mutex
     mutable std::mutex _proxiesMutex;
     Proxy::Vector _proxies;
     std::vector<Owner> _owners;
 
     Views _views;
+
+    // the changes of each chunk of proxies classified in parallel, kept to reuse their buffers
+    std::vector<std::vector<Change>> _chunkChanges;
 };
 
 using SpacePointer = std::shared_ptr<Space>;
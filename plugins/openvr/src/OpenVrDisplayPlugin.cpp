@@ -16,6 +16,8 @@
 #include <QtCore/QDateTime>
 
 #include <GLMHelpers.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
 
 #include <gl/Context.h>
 #include <gl/GLShaders.h>
@@ -155,6 +157,9 @@ struct Reprojection {
     mat4 reprojection;
 };
 
+// the frames composited but not yet picked up by the submit thread, when it doesn't reproject
+static const size_t MAX_QUEUED_FRAMES = 1;
+
 class OpenVrSubmitThread : public QThread, public Dependency {
 public:
     using Mutex = std::mutex;
@@ -165,7 +170,9 @@ public:
 
     OpenVrSubmitThread(OpenVrDisplayPlugin& plugin) : _plugin(plugin) { setObjectName("OpenVR Submit Thread"); }
 
-    void updateSource() {
+    // makes the latest of the queued frames the GPU finished current, true if it changed
+    bool updateSource() {
+        int numUpdated = 0;
         _plugin.withNonPresentThreadLock([&] {
             while (!_queue.empty()) {
                 auto& front = _queue.front();
@@ -183,8 +190,18 @@ public:
                 front.fence = 0;
                 _current = front;
                 _queue.pop();
+                ++numUpdated;
+            }
+            if (numUpdated > 0) {
+                _presented.notify_one();
             }
         });
+
+        // the frames that were replaced by a newer one before they could be submitted never reach the display
+        if (numUpdated > 1 && !_plugin._reprojectOnSubmit) {
+            _plugin._missedFrames += numUpdated - 1;
+        }
+        return numUpdated > 0;
     }
 
     GLuint _program{ 0 };
@@ -241,13 +258,29 @@ public:
         _canvas->doneCurrent();
         while (!_quit) {
             _canvas->makeCurrent();
-            updateSource();
-            if (!_current.texture) {
+            bool isNewFrame = updateSource();
+            if (!_current.texture || (!_plugin._reprojectOnSubmit && !isNewFrame)) {
                 _canvas->doneCurrent();
                 QThread::usleep(1);
                 continue;
             }
 
+            if (!_plugin._reprojectOnSubmit) {
+                // the compositor reprojects, so each frame is submitted once with the pose it was rendered for
+                vr::VRTextureWithPose_t texture;
+                texture.handle = (void*)(uintptr_t)_current.textureID;
+                texture.eType = vr::TextureType_OpenGL;
+                texture.eColorSpace = vr::ColorSpace_Auto;
+                texture.mDeviceToAbsoluteTracking = _current.vrPose;
+                vr::VRCompositor()->Submit(vr::Eye_Left, &texture, &OPENVR_TEXTURE_BOUNDS_LEFT, vr::Submit_TextureWithPose);
+                vr::VRCompositor()->Submit(vr::Eye_Right, &texture, &OPENVR_TEXTURE_BOUNDS_RIGHT, vr::Submit_TextureWithPose);
+                _plugin.recordSubmit(_current.renderPoseTime, _current.presentPoseTime);
+                _plugin._presentRate.increment();
+                _canvas->doneCurrent();
+                updatePoses();
+                continue;
+            }
+
             updateProgram();
             {
                 auto presentRotation = glm::mat3(_nextRender.poses[0]);
@@ -279,30 +312,9 @@ public:
                                        vr::ColorSpace_Auto };
                 vr::VRCompositor()->Submit(vr::Eye_Left, &texture, &leftBounds);
                 vr::VRCompositor()->Submit(vr::Eye_Right, &texture, &rightBounds);
+                _plugin.recordSubmit(_current.renderPoseTime, usecTimestampNow());
                 _plugin._presentRate.increment();
-                PoseData nextRender, nextSim;
-                nextRender.frameIndex = _plugin.presentCount();
-                vr::VRCompositor()->WaitGetPoses(nextRender.vrPoses, vr::k_unMaxTrackedDeviceCount, nextSim.vrPoses,
-                                                 vr::k_unMaxTrackedDeviceCount);
-
-                // Copy invalid poses in nextSim from nextRender
-                for (uint32_t i = 0; i < vr::k_unMaxTrackedDeviceCount; ++i) {
-                    if (!nextSim.vrPoses[i].bPoseIsValid) {
-                        nextSim.vrPoses[i] = nextRender.vrPoses[i];
-                    }
-                }
-
-                mat4 sensorResetMat;
-                _plugin.withNonPresentThreadLock([&] { sensorResetMat = _plugin._sensorResetMat; });
-
-                nextRender.update(sensorResetMat);
-                nextSim.update(sensorResetMat);
-                _plugin.withNonPresentThreadLock([&] {
-                    _nextRender = nextRender;
-                    _nextSim = nextSim;
-                    ++_presentCount;
-                    _presented.notify_one();
-                });
+                updatePoses();
 
                 ++globalColorBufferCount;
                 currentColorBuffer = globalColorBufferCount % COLOR_BUFFER_COUNT;
@@ -322,12 +334,45 @@ public:
         _canvas->moveToThread(_plugin.thread());
     }
 
+    void updatePoses() {
+        PoseData nextRender, nextSim;
+        nextRender.frameIndex = _plugin.presentCount();
+        vr::VRCompositor()->WaitGetPoses(nextRender.vrPoses, vr::k_unMaxTrackedDeviceCount, nextSim.vrPoses,
+                                         vr::k_unMaxTrackedDeviceCount);
+        nextRender.sampleTime = nextSim.sampleTime = usecTimestampNow();
+
+        // Copy invalid poses in nextSim from nextRender
+        for (uint32_t i = 0; i < vr::k_unMaxTrackedDeviceCount; ++i) {
+            if (!nextSim.vrPoses[i].bPoseIsValid) {
+                nextSim.vrPoses[i] = nextRender.vrPoses[i];
+            }
+        }
+
+        mat4 sensorResetMat;
+        _plugin.withNonPresentThreadLock([&] { sensorResetMat = _plugin._sensorResetMat; });
+
+        nextRender.update(sensorResetMat);
+        nextSim.update(sensorResetMat);
+        _plugin.withNonPresentThreadLock([&] {
+            _nextRender = nextRender;
+            _nextSim = nextSim;
+            ++_presentCount;
+            _presented.notify_one();
+        });
+    }
+
     void update(const CompositeInfo& newCompositeInfo) { _queue.push(newCompositeInfo); }
 
     void waitForPresent() {
         auto lastCount = _presentCount.load();
         Lock lock(_plugin._presentMutex);
-        _presented.wait(lock, [&]() -> bool { return _presentCount.load() > lastCount; });
+        if (_plugin._reprojectOnSubmit) {
+            _presented.wait(lock, [&]() -> bool { return _presentCount.load() > lastCount; });
+        } else {
+            // the present thread runs ahead of the compositor by up to the queued frames instead of waiting for
+            // the vsync
+            _presented.wait(lock, [&]() -> bool { return _queue.size() < MAX_QUEUED_FRAMES; });
+        }
         _nextSimPoseData = _nextSim;
         _nextRenderPoseData = _nextRender;
     }
@@ -440,12 +485,19 @@ bool OpenVrDisplayPlugin::internalActivate() {
     auto usingOpenVRForOculus = oculusViaOpenVR();
     _asyncReprojectionActive = (timing.m_nReprojectionFlags & VRCompositor_ReprojectionAsync) || usingOpenVRForOculus;
 
-    _threadedSubmit = !_asyncReprojectionActive;
+    _threadedSubmit = !usingOpenVRForOculus;
+    _reprojectOnSubmit = !_asyncReprojectionActive;
     if (usingOpenVRForOculus) {
         qDebug() << "Oculus active via OpenVR:  " << usingOpenVRForOculus;
     }
     qDebug() << "OpenVR Async Reprojection active:  " << _asyncReprojectionActive;
-    qDebug() << "OpenVR Threaded submit enabled:  " << _threadedSubmit;
+    qDebug() << "OpenVR Threaded submit enabled:  " << _threadedSubmit << "reprojecting:" << _reprojectOnSubmit;
+
+    // for the prediction of the late latched pose
+    float displayFrequency = _system->GetFloatTrackedDeviceProperty(vr::k_unTrackedDeviceIndex_Hmd, vr::Prop_DisplayFrequency_Float);
+    _frameDurationSecs = 1.0f / (displayFrequency > 0.0f ? displayFrequency : TARGET_RATE_OpenVr);
+    _vsyncToPhotonsSecs = _system->GetFloatTrackedDeviceProperty(vr::k_unTrackedDeviceIndex_Hmd,
+                                                                 vr::Prop_SecondsFromVsyncToPhotons_Float);
 
     _openVrDisplayActive = true;
     _system->GetRecommendedRenderTargetSize(&_renderTargetSize.x, &_renderTargetSize.y);
@@ -597,6 +649,7 @@ bool OpenVrDisplayPlugin::beginFrameRender(uint32_t frameIndex) {
     }
 
     _currentRenderFrameInfo.renderPose = nextSimPoseData.poses[vr::k_unTrackedDeviceIndex_Hmd];
+    _currentRenderFrameInfo.sensorSampleTime = (double)nextSimPoseData.sampleTime / USECS_PER_SECOND;
     bool keyboardVisible = isOpenVrKeyboardShown();
 
     std::array<mat4, 2> handPoses;
@@ -627,6 +680,9 @@ void OpenVrDisplayPlugin::compositeLayers() {
 
         auto& newComposite = _compositeInfos[_renderingIndex];
         newComposite.pose = _currentPresentFrameInfo.presentPose;
+        newComposite.vrPose = _presentVrPose;
+        newComposite.renderPoseTime = (uint64_t)(_currentPresentFrameInfo.sensorSampleTime * USECS_PER_SECOND);
+        newComposite.presentPoseTime = _presentPoseTime;
         _compositeFramebuffer->setRenderBuffer(0, newComposite.texture);
     }
 
@@ -664,18 +720,56 @@ void OpenVrDisplayPlugin::hmdPresent() {
         _visionSqueezeParametersBuffer.edit<VisionSqueezeParameters>()._hmdSensorMatrix = _currentPresentFrameInfo.presentPose;
 
         GLuint glTexId = getGLBackend()->getTextureID(_compositeFramebuffer->getRenderBuffer(0));
-        vr::Texture_t vrTexture{ (void*)(uintptr_t)glTexId, vr::TextureType_OpenGL, vr::ColorSpace_Auto };
-        vr::VRCompositor()->Submit(vr::Eye_Left, &vrTexture, &OPENVR_TEXTURE_BOUNDS_LEFT);
-        vr::VRCompositor()->Submit(vr::Eye_Right, &vrTexture, &OPENVR_TEXTURE_BOUNDS_RIGHT);
+        vr::VRTextureWithPose_t vrTexture;
+        vrTexture.handle = (void*)(uintptr_t)glTexId;
+        vrTexture.eType = vr::TextureType_OpenGL;
+        vrTexture.eColorSpace = vr::ColorSpace_Auto;
+        vrTexture.mDeviceToAbsoluteTracking = _presentVrPose;
+        vr::VRCompositor()->Submit(vr::Eye_Left, &vrTexture, &OPENVR_TEXTURE_BOUNDS_LEFT, vr::Submit_TextureWithPose);
+        vr::VRCompositor()->Submit(vr::Eye_Right, &vrTexture, &OPENVR_TEXTURE_BOUNDS_RIGHT, vr::Submit_TextureWithPose);
         vr::VRCompositor()->PostPresentHandoff();
+        recordSubmit((uint64_t)(_currentPresentFrameInfo.sensorSampleTime * USECS_PER_SECOND), _presentPoseTime);
         _presentRate.increment();
     }
 
+    recordFrameTiming();
+}
+
+void OpenVrDisplayPlugin::recordSubmit(uint64_t renderPoseTime, uint64_t presentPoseTime) {
+    static const float POSE_AGE_SMOOTHING = 0.1f;
+    uint64_t now = usecTimestampNow();
+    if (renderPoseTime > 0 && renderPoseTime < now) {
+        float renderPoseAge = (float)(now - renderPoseTime) / USECS_PER_MSEC;
+        _renderPoseAgeMsecs = glm::mix(_renderPoseAgeMsecs.load(), renderPoseAge, POSE_AGE_SMOOTHING);
+    }
+    if (presentPoseTime > 0 && presentPoseTime < now) {
+        float presentPoseAge = (float)(now - presentPoseTime) / USECS_PER_MSEC;
+        _presentPoseAgeMsecs = glm::mix(_presentPoseAgeMsecs.load(), presentPoseAge, POSE_AGE_SMOOTHING);
+    }
+}
+
+void OpenVrDisplayPlugin::recordFrameTiming() {
     vr::Compositor_FrameTiming frameTiming;
     memset(&frameTiming, 0, sizeof(vr::Compositor_FrameTiming));
     frameTiming.m_nSize = sizeof(vr::Compositor_FrameTiming);
     vr::VRCompositor()->GetFrameTiming(&frameTiming);
+
+    // the present thread can run ahead of the compositor, so the timing of a frame is only counted once
+    if (frameTiming.m_nFrameIndex == _lastFrameTimingIndex) {
+        return;
+    }
+    _lastFrameTimingIndex = frameTiming.m_nFrameIndex;
     _stutterRate.increment(frameTiming.m_nNumDroppedFrames);
+    _missedFrames += frameTiming.m_nNumMisPresented;
+}
+
+QJsonObject OpenVrDisplayPlugin::getHardwareStats() const {
+    QJsonObject hardwareStats;
+    hardwareStats["async_submit"] = _threadedSubmit && !_reprojectOnSubmit;
+    hardwareStats["app_dropped_frame_count"] = _missedFrames.load();
+    hardwareStats["render_pose_age_msecs"] = _renderPoseAgeMsecs.load();
+    hardwareStats["present_pose_age_msecs"] = _presentPoseAgeMsecs.load();
+    return hardwareStats;
 }
 
 void OpenVrDisplayPlugin::postPreview() {
@@ -686,6 +780,7 @@ void OpenVrDisplayPlugin::postPreview() {
     if (!_threadedSubmit) {
         vr::VRCompositor()->WaitGetPoses(nextRender.vrPoses, vr::k_unMaxTrackedDeviceCount, nextSim.vrPoses,
                                          vr::k_unMaxTrackedDeviceCount);
+        nextRender.sampleTime = nextSim.sampleTime = usecTimestampNow();
 
         glm::mat4 resetMat;
         withPresentThreadLock([&] { resetMat = _sensorResetMat; });
@@ -706,7 +801,31 @@ bool OpenVrDisplayPlugin::isHmdMounted() const {
 }
 
 void OpenVrDisplayPlugin::updatePresentPose() {
+    const auto& nextRenderHmdPose = _nextRenderPoseData.vrPoses[vr::k_unTrackedDeviceIndex_Hmd];
     _currentPresentFrameInfo.presentPose = _nextRenderPoseData.poses[vr::k_unTrackedDeviceIndex_Hmd];
+    _presentVrPose = nextRenderHmdPose.mDeviceToAbsoluteTracking;
+    _presentPoseTime = _nextRenderPoseData.sampleTime;
+
+    // late latch: this runs right before the frame executes on the GPU, and the correction of the view transform
+    // is made from this pose, so a pose predicted for when this frame reaches the display from now is fresher than
+    // the one WaitGetPoses returned at the end of the last frame
+    float secondsSinceLastVsync;
+    uint64_t frameCounter;
+    if (!_system->GetTimeSinceLastVsync(&secondsSinceLastVsync, &frameCounter)) {
+        return;
+    }
+    float secondsToPhotons = _frameDurationSecs - secondsSinceLastVsync + _vsyncToPhotonsSecs;
+    vr::TrackedDevicePose_t hmdPose;
+    _system->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, secondsToPhotons, &hmdPose, 1);
+    if (!hmdPose.bPoseIsValid || isBadPose(&hmdPose.mDeviceToAbsoluteTracking)) {
+        return;
+    }
+
+    mat4 sensorResetMat;
+    withPresentThreadLock([&] { sensorResetMat = _sensorResetMat; });
+    _currentPresentFrameInfo.presentPose = sensorResetMat * toGlm(hmdPose.mDeviceToAbsoluteTracking);
+    _presentVrPose = hmdPose.mDeviceToAbsoluteTracking;
+    _presentPoseTime = usecTimestampNow();
 }
 
 bool OpenVrDisplayPlugin::suppressKeyboard() {
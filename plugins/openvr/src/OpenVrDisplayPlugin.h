@@ -31,6 +31,9 @@ struct CompositeInfo {
     gpu::TexturePointer texture;
     uint32_t textureID { 0 };
     glm::mat4 pose;
+    vr::HmdMatrix34_t vrPose; // the pose without the sensor reset, that the compositor reprojects from
+    uint64_t renderPoseTime { 0 }; // when the poses were sampled, in usecs
+    uint64_t presentPoseTime { 0 };
     void* fence{ 0 };
 };
 
@@ -69,6 +72,8 @@ public:
 
     QRectF getPlayAreaRect() override;
 
+    QJsonObject getHardwareStats() const override;
+
     virtual StencilMaskMode getStencilMaskMode() const override { return StencilMaskMode::MESH; }
     virtual StencilMaskMeshOperator getStencilMaskMeshOperator() override;
 
@@ -89,12 +94,31 @@ protected:
     void postPreview() override;
 
 private:
+    // the age of the poses of a frame when it is submitted, and the missed frames of the compositor timing
+    void recordSubmit(uint64_t renderPoseTime, uint64_t presentPoseTime);
+    void recordFrameTiming();
+
     vr::IVRSystem* _system { nullptr };
     std::atomic<uint32_t> _keyboardSupressionCount{ 0 };
 
     vr::HmdMatrix34_t _lastGoodHMDPose;
     mat4 _sensorResetMat;
     bool _threadedSubmit { true };
+    // the submit thread reprojects the latest frame at every vsync itself when the compositor doesn't reproject
+    // asynchronously, otherwise it submits each new frame once with its pose and the present thread only waits
+    // for the queue of frames to drain
+    bool _reprojectOnSubmit { true };
+
+    // the pose latched right before the frame executes, for the compositor
+    vr::HmdMatrix34_t _presentVrPose;
+    uint64_t _presentPoseTime { 0 };
+    float _frameDurationSecs { 1.0f / TARGET_RATE_OpenVr };
+    float _vsyncToPhotonsSecs { 0.0f };
+
+    std::atomic<float> _renderPoseAgeMsecs { 0.0f };
+    std::atomic<float> _presentPoseAgeMsecs { 0.0f };
+    std::atomic<int> _missedFrames { 0 };
+    uint32_t _lastFrameTimingIndex { 0 };
 
     CompositeInfo::Array _compositeInfos;
     size_t _renderingIndex { 0 };
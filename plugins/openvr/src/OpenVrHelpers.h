@@ -66,6 +66,7 @@ inline vr::HmdMatrix34_t toOpenVr(const mat4& m) {
 
 struct PoseData {
     uint32_t frameIndex{ 0 };
+    uint64_t sampleTime{ 0 }; // when WaitGetPoses returned these, in usecs
     vr::TrackedDevicePose_t vrPoses[vr::k_unMaxTrackedDeviceCount];
     mat4 poses[vr::k_unMaxTrackedDeviceCount];
     vec3 linearVelocities[vr::k_unMaxTrackedDeviceCount];
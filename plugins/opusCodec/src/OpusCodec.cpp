@@ -0,0 +1,194 @@
+//
+//  OpusCodec.cpp
+//  plugins/opusCodec/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OpusCodec.h"
+
+#include <algorithm>
+
+#include <QtCore/QDebug>
+
+#include <opus/opus.h>
+
+#include <AudioConstants.h>
+
+const char* OpusCodec::NAME { "opus" };
+
+// the largest packet Opus makes for a frame
+static const int MAX_ENCODED_BYTES = 1275;
+
+static const int COMPLEXITY = 5;
+
+// the bitrate of a channel starts in the middle of its range, and drops quickly and climbs back slowly with the
+// network conditions
+static const int MIN_BITRATE_PER_CHANNEL = 12000;
+static const int START_BITRATE_PER_CHANNEL = 24000;
+static const int MAX_BITRATE_PER_CHANNEL = 32000;
+static const int BITRATE_STEP_UP = 2000;
+static const float BITRATE_STEP_DOWN = 0.75f;
+
+// more loss than this, or an RTT that grew this much over the lowest one, is taken for congestion
+static const float CONGESTED_LOSS_RATE = 0.05f;
+static const int CONGESTED_RTT_INCREASE_MSECS = 100;
+// the bitrate only climbs back with less loss than this
+static const float CLEAR_LOSS_RATE = 0.01f;
+
+// the redundancy is sized for a little more loss than was measured, and not for more than this
+static const int MAX_PACKET_LOSS_PERCENTAGE = 30;
+static const int PACKET_LOSS_PERCENTAGE_MARGIN = 2;
+
+void OpusCodec::init() {
+}
+
+void OpusCodec::deinit() {
+}
+
+bool OpusCodec::activate() {
+    CodecPlugin::activate();
+    return true;
+}
+
+void OpusCodec::deactivate() {
+    CodecPlugin::deactivate();
+}
+
+bool OpusCodec::isSupported() const {
+    return true;
+}
+
+class OpusAudioEncoder : public Encoder {
+public:
+    OpusAudioEncoder(int sampleRate, int numChannels) : _numChannels(numChannels) {
+        int error;
+        _encoder = opus_encoder_create(sampleRate, numChannels, OPUS_APPLICATION_VOIP, &error);
+        if (error != OPUS_OK) {
+            qWarning() << "Could not create an Opus encoder:" << opus_strerror(error);
+            _encoder = nullptr;
+            return;
+        }
+        opus_encoder_ctl(_encoder, OPUS_SET_COMPLEXITY(COMPLEXITY));
+        opus_encoder_ctl(_encoder, OPUS_SET_DTX(1));
+        opus_encoder_ctl(_encoder, OPUS_SET_INBAND_FEC(1));
+        opus_encoder_ctl(_encoder, OPUS_SET_PACKET_LOSS_PERC(PACKET_LOSS_PERCENTAGE_MARGIN));
+        opus_encoder_ctl(_encoder, OPUS_SET_BITRATE(_bitratePerChannel * _numChannels));
+    }
+
+    virtual ~OpusAudioEncoder() {
+        if (_encoder) {
+            opus_encoder_destroy(_encoder);
+        }
+    }
+
+    virtual void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) override {
+        if (!_encoder) {
+            encodedBuffer.clear();
+            return;
+        }
+        encodedBuffer.resize(MAX_ENCODED_BYTES);
+        int encodedBytes = opus_encode(_encoder, (const opus_int16*)decodedBuffer.constData(),
+                                       AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL,
+                                       (unsigned char*)encodedBuffer.data(), MAX_ENCODED_BYTES);
+        encodedBuffer.resize(std::max(encodedBytes, 0));
+    }
+
+    virtual void setNetworkConditions(float lossRate, int rttMsecs) override {
+        if (!_encoder) {
+            return;
+        }
+
+        if (rttMsecs > 0) {
+            _minRttMsecs = _minRttMsecs > 0 ? std::min(_minRttMsecs, rttMsecs) : rttMsecs;
+        }
+        bool isCongested = lossRate > CONGESTED_LOSS_RATE ||
+            (rttMsecs > 0 && rttMsecs > _minRttMsecs + CONGESTED_RTT_INCREASE_MSECS);
+
+        if (isCongested) {
+            _bitratePerChannel = std::max((int)(_bitratePerChannel * BITRATE_STEP_DOWN), MIN_BITRATE_PER_CHANNEL);
+        } else if (lossRate < CLEAR_LOSS_RATE) {
+            _bitratePerChannel = std::min(_bitratePerChannel + BITRATE_STEP_UP, MAX_BITRATE_PER_CHANNEL);
+        }
+        opus_encoder_ctl(_encoder, OPUS_SET_BITRATE(_bitratePerChannel * _numChannels));
+
+        int lossPercentage = std::min((int)(lossRate * 100.0f) + PACKET_LOSS_PERCENTAGE_MARGIN, MAX_PACKET_LOSS_PERCENTAGE);
+        opus_encoder_ctl(_encoder, OPUS_SET_PACKET_LOSS_PERC(lossPercentage));
+    }
+
+private:
+    OpusEncoder* _encoder { nullptr };
+    int _numChannels;
+    int _bitratePerChannel { START_BITRATE_PER_CHANNEL };
+    int _minRttMsecs { 0 };
+};
+
+class OpusAudioDecoder : public Decoder {
+public:
+    OpusAudioDecoder(int sampleRate, int numChannels) {
+        _decodedSize = AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL * sizeof(int16_t) * numChannels;
+
+        int error;
+        _decoder = opus_decoder_create(sampleRate, numChannels, &error);
+        if (error != OPUS_OK) {
+            qWarning() << "Could not create an Opus decoder:" << opus_strerror(error);
+            _decoder = nullptr;
+        }
+    }
+
+    virtual ~OpusAudioDecoder() {
+        if (_decoder) {
+            opus_decoder_destroy(_decoder);
+        }
+    }
+
+    virtual void decode(const QByteArray& encodedBuffer, QByteArray& decodedBuffer) override {
+        decode(encodedBuffer, decodedBuffer, false);
+    }
+
+    virtual void lostFrame(QByteArray& decodedBuffer) override {
+        // this performs packet loss concealment
+        decode(QByteArray(), decodedBuffer, false);
+    }
+
+    virtual void recoverFrame(const QByteArray& nextEncodedBuffer, QByteArray& decodedBuffer) override {
+        // the redundant data of the next frame, or packet loss concealment when it has none
+        decode(nextEncodedBuffer, decodedBuffer, true);
+    }
+
+private:
+    void decode(const QByteArray& encodedBuffer, QByteArray& decodedBuffer, bool useRedundantData) {
+        decodedBuffer.resize(_decodedSize);
+        int decodedSamples = -1;
+        if (_decoder) {
+            auto encodedData = encodedBuffer.isEmpty() ? nullptr : (const unsigned char*)encodedBuffer.constData();
+            decodedSamples = opus_decode(_decoder, encodedData, encodedBuffer.size(), (opus_int16*)decodedBuffer.data(),
+                                         AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL, useRedundantData ? 1 : 0);
+        }
+        if (decodedSamples != AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL) {
+            memset(decodedBuffer.data(), 0, _decodedSize);
+        }
+    }
+
+    OpusDecoder* _decoder { nullptr };
+    int _decodedSize;
+};
+
+Encoder* OpusCodec::createEncoder(int sampleRate, int numChannels) {
+    return new OpusAudioEncoder(sampleRate, numChannels);
+}
+
+Decoder* OpusCodec::createDecoder(int sampleRate, int numChannels) {
+    return new OpusAudioDecoder(sampleRate, numChannels);
+}
+
+void OpusCodec::releaseEncoder(Encoder* encoder) {
+    delete encoder;
+}
+
+void OpusCodec::releaseDecoder(Decoder* decoder) {
+    delete decoder;
+}
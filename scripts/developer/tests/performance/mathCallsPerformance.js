@@ -0,0 +1,67 @@
+//
+//  mathCallsPerformance.js
+//  scripts/developer/tests/performance
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Measures how many calls to the Vec3, Quat and Mat4 helpers a script makes per second.  Most of the time of a call
+//  is spent converting its arguments and its result between the script values and the glm types.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+var NUM_CALLS = 100000;
+var NUM_RUNS = 5;
+
+var benchmarks = {
+    "Vec3.sum": function () {
+        var sum = Vec3.ZERO;
+        var step = { x: 1, y: 2, z: 3 };
+        for (var i = 0; i < NUM_CALLS; i++) {
+            sum = Vec3.sum(sum, step);
+        }
+        return sum.x === NUM_CALLS;
+    },
+    "Vec3.multiplyQbyV": function () {
+        var rotation = Quat.fromPitchYawRollDegrees(0, 90, 0);
+        var vector = Vec3.UNIT_X;
+        for (var i = 0; i < NUM_CALLS; i++) {
+            vector = Vec3.multiplyQbyV(rotation, vector);
+        }
+        return Vec3.length(vector) > 0.99;
+    },
+    "Quat.multiply": function () {
+        var rotation = Quat.IDENTITY;
+        var step = Quat.fromPitchYawRollDegrees(1, 0, 0);
+        for (var i = 0; i < NUM_CALLS; i++) {
+            rotation = Quat.multiply(rotation, step);
+        }
+        return Math.abs(Quat.dot(rotation, rotation) - 1) < 0.01;
+    },
+    "Mat4.multiply": function () {
+        var matrix = Mat4.createFromRotAndTrans(Quat.IDENTITY, Vec3.ZERO);
+        var step = Mat4.createFromRotAndTrans(Quat.fromPitchYawRollDegrees(0, 1, 0), Vec3.UNIT_Y);
+        for (var i = 0; i < NUM_CALLS; i++) {
+            matrix = Mat4.multiply(matrix, step);
+        }
+        return Mat4.extractTranslation(matrix).y === NUM_CALLS;
+    }
+};
+
+function runBenchmark(name, benchmark) {
+    var best = 0;
+    var correct = true;
+    for (var run = 0; run < NUM_RUNS; run++) {
+        var start = Date.now();
+        correct = benchmark() && correct;
+        var elapsed = Math.max(1, Date.now() - start);
+        best = Math.max(best, NUM_CALLS * 1000 / elapsed);
+    }
+    print(name + ": " + Math.round(best) + " calls per second" + (correct ? "" : " (WRONG RESULT)"));
+}
+
+Object.keys(benchmarks).forEach(function (name) {
+    runBenchmark(name, benchmarks[name]);
+});
+Script.stop();
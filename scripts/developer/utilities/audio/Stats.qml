@@ -50,6 +50,7 @@ Column {
                     MovingValue { label: "Network (down)"; source: AudioStats.pingMs / 2; showGraphs: stats.showGraphs; decimals: 1 }
                     MovingValue { label: "Output Ring"; source: AudioStats.clientStream.unplayedMsMax; showGraphs: stats.showGraphs }
                     MovingValue { label: "Output Read"; source: AudioStats.outputUnplayedMsMax; showGraphs: stats.showGraphs }
+                    MovingValue { label: "Device Buffer"; source: AudioStats.deviceBufferMs; showGraphs: stats.showGraphs; decimals: 1 }
                     MovingValue { label: "TOTAL"; color: "black"; showGraphs: stats.showGraphs
                         source: AudioStats.inputReadMsMax +
                             AudioStats.inputUnplayedMsMax +
@@ -36,6 +36,7 @@ Rectangle {
                 "Blur Edge Sharpness:edgeSharpness:1.0:false",
                 "Blur Radius:blurRadius:15.0:true",
                 "Resolution Downscale:resolutionLevel:2:true",
+                "Temporal Blend:temporalBlend:1.0:false",
             ]
             ConfigSlider {
                 label: qsTr(modelData.split(":")[0])
@@ -55,6 +56,7 @@ Rectangle {
                     model: [
                         "horizonBased:horizonBased",
                         "jitterEnabled:jitterEnabled",
+                        "temporalEnabled:temporalEnabled",
                         "ditheringEnabled:ditheringEnabled",
                         "fetchMipsEnabled:fetchMipsEnabled",
                         "borderingEnabled:borderingEnabled"
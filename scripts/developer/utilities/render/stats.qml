@@ -97,6 +97,52 @@ Item {
             ]
         }
 
+        PlotPerf {
+            title: "Programs"
+            height: parent.evalEvenHeight()
+            object: stats.config
+            plots: [
+                {
+                    prop: "frameProgramBinaryHitCount",
+                    label: "Cached",
+                    color: "#1AC567"
+                },
+                {
+                    prop: "frameProgramBinaryMissCount",
+                    label: "Compiled",
+                    color: "#E2334D"
+                }
+            ]
+        }
+
+        PlotPerf {
+            title: "Scene Transactions"
+            height: parent.evalEvenHeight()
+            object: stats.config
+            plots: [
+                {
+                    prop: "transactionResetCount",
+                    label: "Resets",
+                    color: "#00B4EF"
+                },
+                {
+                    prop: "transactionUpdateCount",
+                    label: "Updates",
+                    color: "#1AC567"
+                },
+                {
+                    prop: "transactionCoalescedCount",
+                    label: "Coalesced",
+                    color: "#FED959"
+                },
+                {
+                    prop: "transactionPendingItemCount",
+                    label: "Pending",
+                    color: "#E2334D"
+                }
+            ]
+        }
+
         property var drawOpaqueConfig: Render.getConfig("RenderMainView.DrawOpaqueDeferred")
         property var drawTransparentConfig: Render.getConfig("RenderMainView.DrawTransparentDeferred")
         property var drawLightConfig: Render.getConfig("RenderMainView.DrawLight")
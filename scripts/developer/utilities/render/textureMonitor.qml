@@ -73,6 +73,40 @@ Item {
                 }
             ]
         }
+        PlotPerf {
+            title: "Sparse Residency"
+            height: parent.evalEvenHeight()
+            object: stats.config
+            valueScale: 1
+            valueUnit: ""
+            plots: [
+                {
+                    prop: "textureResourceCommittedPageCount",
+                    label: "Committed Pages",
+                    color: "#1FC6A6"
+                },
+                {
+                    prop: "textureEvictionRate",
+                    label: "Evictions/s",
+                    color: "#EF93D1"
+                }
+            ]
+        }
+        PlotPerf {
+            title: "Transfer Bandwidth"
+            height: parent.evalEvenHeight()
+            object: stats.config
+            valueScale: 1048576
+            valueUnit: "Mb/s"
+            valueNumDigits: "1"
+            plots: [
+                {
+                    prop: "textureTransferRate",
+                    label: "Uploaded",
+                    color: "#FF6309"
+                }
+            ]
+        }
     }
 
 }
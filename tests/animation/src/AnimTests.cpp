@@ -10,6 +10,7 @@
 #include "AnimTests.h"
 #include <AnimNodeLoader.h>
 #include <AnimClip.h>
+#include <AnimCompressedClip.h>
 #include <AnimBlendLinear.h>
 #include <AnimationLogging.h>
 #include <AnimVariant.h>
@@ -21,6 +22,8 @@
 #include <ResourceManager.h>
 #include <ResourceRequestObserver.h>
 #include <StatTracker.h>
+#include <SharedUtil.h>
+#include <GLMHelpers.h>
 #include <test-utils/QTestExtensions.h>
 
 QTEST_MAIN(AnimTests)
@@ -259,6 +262,48 @@ void AnimTests::testVariant() {
     QVERIFY(q.z == 4.0f);
 }
 
+void AnimTests::testVariantMapKeys() {
+    QVERIFY(AnimVariantMap::getKey("") == AnimVariantMap::INVALID_KEY);
+    QVERIFY(AnimVariantMap::findKey("testVariantMapKeysNeverSet") == AnimVariantMap::INVALID_KEY);
+
+    auto alphaKey = AnimVariantMap::getKey("testVariantMapKeysAlpha");
+    QVERIFY(alphaKey != AnimVariantMap::INVALID_KEY);
+    QVERIFY(AnimVariantMap::getKey("testVariantMapKeysAlpha") == alphaKey);
+    QVERIFY(AnimVariantMap::findKey("testVariantMapKeysAlpha") == alphaKey);
+    QVERIFY(AnimVariantMap::getKeyName(alphaKey) == "testVariantMapKeysAlpha");
+
+    AnimVariantMap vars;
+    QVERIFY(!vars.hasKey(alphaKey));
+    QVERIFY(vars.lookup(alphaKey, 0.5f) == 0.5f);
+
+    // set by name, looked up by key and the other way around
+    vars.set("testVariantMapKeysAlpha", 0.25f);
+    QVERIFY(vars.hasKey(alphaKey));
+    QVERIFY(vars.lookup(alphaKey, 0.5f) == 0.25f);
+    auto betaKey = AnimVariantMap::getKey("testVariantMapKeysBeta");
+    vars.set(betaKey, 3);
+    QVERIFY(vars.lookup("testVariantMapKeysBeta", 0) == 3);
+    QVERIFY(vars.toDebugMap().size() == 2);
+
+    AnimVariantMap other;
+    other.setTrigger("testVariantMapKeysGamma");
+    other.copyVariantsFrom(vars);
+    QVERIFY(other.lookup("testVariantMapKeysGamma", false));
+    QVERIFY(other.lookup(alphaKey, 0.5f) == 0.25f);
+    QVERIFY(other.lookup(betaKey, 0) == 3);
+
+    vars.unset("testVariantMapKeysAlpha");
+    QVERIFY(!vars.hasKey(alphaKey));
+    QVERIFY(vars.hasKey(betaKey));
+    QVERIFY(other.hasKey(alphaKey));
+
+    other.clearMap();
+    QVERIFY(!other.hasKey(betaKey));
+    QVERIFY(other.toDebugMap().empty());
+    other.set(betaKey, 4);
+    QVERIFY(other.lookup(betaKey, 0) == 4);
+}
+
 void AnimTests::testAccumulateTime() {
 
     float startFrame = 0.0f;
@@ -467,6 +512,110 @@ void AnimTests::testAnimPose() {
     QCOMPARE_WITH_ABS_ERROR(p.scale(), resultScale, TEST_EPSILON2);
 }
 
+static AnimPose randomPose() {
+    glm::vec3 scale(randFloatInRange(0.5f, 2.0f), randFloatInRange(0.5f, 2.0f), randFloatInRange(0.5f, 2.0f));
+    glm::quat rot = glm::normalize(glm::quat(randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f),
+                                             randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f)));
+    glm::vec3 trans(randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f));
+    return AnimPose(scale, rot, trans);
+}
+
+void AnimTests::testBlend() {
+    const size_t NUM_POSES = 100;
+    std::vector<AnimPose> poses[4];
+    for (auto& poseVec : poses) {
+        for (size_t i = 0; i < NUM_POSES; i++) {
+            poseVec.push_back(randomPose());
+        }
+    }
+    float alphas[4] = { 0.1f, 0.2f, 0.3f, 0.4f };
+    const float alpha = 0.3f;
+
+    std::vector<AnimPose> result(NUM_POSES);
+    ::blend(NUM_POSES, &poses[0][0], &poses[1][0], alpha, &result[0]);
+    for (size_t i = 0; i < NUM_POSES; i++) {
+        QCOMPARE_WITH_ABS_ERROR(result[i].scale(), lerp(poses[0][i].scale(), poses[1][i].scale(), alpha), TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(result[i].rot(), safeLerp(poses[0][i].rot(), poses[1][i].rot(), alpha), TEST_EPSILON);
+        QCOMPARE_WITH_ABS_ERROR(result[i].trans(), lerp(poses[0][i].trans(), poses[1][i].trans(), alpha), TEST_EPSILON);
+    }
+
+    ::blend3(NUM_POSES, &poses[0][0], &poses[1][0], &poses[2][0], alphas, &result[0]);
+    for (size_t i = 0; i < NUM_POSES; i++) {
+        glm::quat rot = safeLinearCombine3(poses[0][i].rot(), poses[1][i].rot(), poses[2][i].rot(), alphas);
+        QCOMPARE_WITH_ABS_ERROR(result[i].rot(), rot, TEST_EPSILON);
+        glm::vec3 trans = alphas[0] * poses[0][i].trans() + alphas[1] * poses[1][i].trans() + alphas[2] * poses[2][i].trans();
+        QCOMPARE_WITH_ABS_ERROR(result[i].trans(), trans, TEST_EPSILON);
+    }
+
+    ::blend4(NUM_POSES, &poses[0][0], &poses[1][0], &poses[2][0], &poses[3][0], alphas, &result[0]);
+    for (size_t i = 0; i < NUM_POSES; i++) {
+        glm::quat rot = safeLinearCombine4(poses[0][i].rot(), poses[1][i].rot(), poses[2][i].rot(), poses[3][i].rot(), alphas);
+        QCOMPARE_WITH_ABS_ERROR(result[i].rot(), rot, TEST_EPSILON);
+        glm::vec3 scale = alphas[0] * poses[0][i].scale() + alphas[1] * poses[1][i].scale() +
+            alphas[2] * poses[2][i].scale() + alphas[3] * poses[3][i].scale();
+        QCOMPARE_WITH_ABS_ERROR(result[i].scale(), scale, TEST_EPSILON);
+    }
+
+    // blending in place, as AnimInverseKinematics does
+    result = poses[1];
+    ::blend(NUM_POSES, &poses[0][0], &result[0], alpha, &result[0]);
+    for (size_t i = 0; i < NUM_POSES; i++) {
+        QCOMPARE_WITH_ABS_ERROR(result[i].rot(), safeLerp(poses[0][i].rot(), poses[1][i].rot(), alpha), TEST_EPSILON);
+    }
+
+    // the time of the blends of a few frames of a crowd of avatars
+    const int NUM_ITERATIONS = 10000;
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < NUM_ITERATIONS; i++) {
+        ::blend(NUM_POSES, &poses[0][0], &poses[1][0], alpha, &result[0]);
+    }
+    qint64 blendTime = timer.nsecsElapsed();
+    timer.restart();
+    for (int i = 0; i < NUM_ITERATIONS; i++) {
+        ::blend4(NUM_POSES, &poses[0][0], &poses[1][0], &poses[2][0], &poses[3][0], alphas, &result[0]);
+    }
+    qint64 blend4Time = timer.nsecsElapsed();
+    qDebug() << "blend of" << NUM_POSES << "poses:" << (float)blendTime / NUM_ITERATIONS << "ns,"
+             << "blend4:" << (float)blend4Time / NUM_ITERATIONS << "ns";
+}
+
+void AnimTests::testCompressedClip() {
+    // a joint that doesn't move, one that turns and slides at a constant rate and one that shakes every frame
+    const int NUM_FRAMES = 300;
+    std::vector<AnimPoseVec> frames(NUM_FRAMES);
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        float t = (float)i / (float)NUM_FRAMES;
+        frames[i].push_back(AnimPose(glm::vec3(1.0f), glm::angleAxis(0.5f, Vectors::UNIT_X), glm::vec3(0.0f, 1.0f, 0.0f)));
+        frames[i].push_back(AnimPose(glm::vec3(1.0f), glm::angleAxis(PI * t, Vectors::UNIT_Y), glm::vec3(t, 0.0f, 0.0f)));
+        frames[i].push_back(randomPose());
+    }
+
+    // the keys rebuild the frames within about a milliradian, or a thousandth of the largest value of a track
+    const float CLIP_EPSILON = 0.005f;
+    AnimCompressedClip clip(frames);
+    QCOMPARE(clip.getNumFrames(), NUM_FRAMES);
+    QCOMPARE(clip.getNumJoints(), 3);
+
+    AnimPoseVec poses;
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        clip.sampleFrame(i, poses);
+        for (size_t j = 0; j < poses.size(); j++) {
+            glm::quat rot = frames[i][j].rot();
+            if (glm::dot(poses[j].rot(), rot) < 0.0f) {
+                rot = -rot;
+            }
+            QCOMPARE_WITH_ABS_ERROR(poses[j].rot(), rot, CLIP_EPSILON);
+            QCOMPARE_WITH_ABS_ERROR(poses[j].trans(), frames[i][j].trans(), CLIP_EPSILON);
+            QCOMPARE_WITH_ABS_ERROR(poses[j].scale(), frames[i][j].scale(), CLIP_EPSILON);
+        }
+    }
+
+    // the keys of the first two joints take next to nothing, the last one keeps every frame
+    size_t rawSize = NUM_FRAMES * 3 * sizeof(AnimPose);
+    QVERIFY(clip.getByteSize() < rawSize / 2);
+}
+
 void AnimTests::testExpressionTokenizer() {
     QString str = "(10 +  x) >= 20.1 && (y != !z)";
     AnimExpression e("x");
@@ -25,8 +25,11 @@ private slots:
     void testClipEvaulateWithVars();
     void testLoader();
     void testVariant();
+    void testVariantMapKeys();
     void testAccumulateTime();
     void testAnimPose();
+    void testBlend();
+    void testCompressedClip();
     void testExpressionTokenizer();
     void testExpressionParser();
     void testExpressionEvaluator();
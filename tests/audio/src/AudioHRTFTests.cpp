@@ -0,0 +1,83 @@
+//
+//  AudioHRTFTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioHRTFTests.h"
+
+#include <AudioHRTF.h>
+
+QTEST_MAIN(AudioHRTFTests)
+
+static const int HRTF_DATASET_INDEX = 1;
+static const int NUM_BLOCKS = 4;
+static const float TOLERANCE = 1e-5f;
+
+static void fillBlock(int16_t* block, int seed) {
+    for (int i = 0; i < HRTF_BLOCK; i++) {
+        block[i] = (int16_t)(((i + 1) * 7919 * (seed + 1)) % 20000 - 10000);
+    }
+}
+
+static float maxDifference(const float* a, const float* b, int numSamples) {
+    float difference = 0.0f;
+    for (int i = 0; i < numSamples; i++) {
+        difference = std::max(difference, std::abs(a[i] - b[i]));
+    }
+    return difference;
+}
+
+void AudioHRTFTests::floatRenderMatchesInt16Render() {
+    AudioHRTF int16HRTF;
+    AudioHRTF floatHRTF;
+
+    for (int block = 0; block < NUM_BLOCKS; block++) {
+        int16_t input[HRTF_BLOCK];
+        float floatInput[HRTF_BLOCK];
+        float int16Output[2 * HRTF_BLOCK] = {};
+        float floatOutput[2 * HRTF_BLOCK] = {};
+
+        fillBlock(input, block);
+        for (int i = 0; i < HRTF_BLOCK; i++) {
+            floatInput[i] = input[i] * (1/32768.0f);
+        }
+
+        float azimuth = 0.25f * block;
+        int16HRTF.render(input, int16Output, HRTF_DATASET_INDEX, azimuth, 4.0f, 0.5f, HRTF_BLOCK);
+        floatHRTF.render(floatInput, floatOutput, HRTF_DATASET_INDEX, azimuth, 4.0f, 0.5f, HRTF_BLOCK);
+
+        QVERIFY(maxDifference(int16Output, floatOutput, 2 * HRTF_BLOCK) < TOLERANCE);
+    }
+}
+
+void AudioHRTFTests::sharedRenderMatchesRender() {
+    // a single source premixed into a shared render must match rendering it on its own
+    AudioHRTF sourceHRTF;
+    AudioHRTF premixedHRTF;
+    AudioHRTF sharedHRTF;
+
+    const float AZIMUTH = 0.7f;
+    const float DISTANCE = 5.0f;
+    const float GAIN = 0.5f;
+
+    for (int block = 0; block < NUM_BLOCKS; block++) {
+        int16_t input[HRTF_BLOCK];
+        float premix[HRTF_BLOCK] = {};
+        float output[2 * HRTF_BLOCK] = {};
+        float sharedOutput[2 * HRTF_BLOCK] = {};
+
+        fillBlock(input, block);
+
+        sourceHRTF.render(input, output, HRTF_DATASET_INDEX, AZIMUTH, DISTANCE, GAIN, HRTF_BLOCK);
+
+        premixedHRTF.premix(input, premix, AZIMUTH, DISTANCE, GAIN, HRTF_BLOCK);
+        sharedHRTF.render(premix, sharedOutput, HRTF_DATASET_INDEX, AZIMUTH, DISTANCE, 1.0f, HRTF_BLOCK);
+
+        QVERIFY(maxDifference(output, sharedOutput, 2 * HRTF_BLOCK) < TOLERANCE);
+    }
+}
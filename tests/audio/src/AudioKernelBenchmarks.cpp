@@ -0,0 +1,94 @@
+//
+//  AudioKernelBenchmarks.cpp
+//  tests/audio/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioKernelBenchmarks.h"
+
+#include <AudioHRTF.h>
+#include <AudioSRC.h>
+#include <AudioFOA.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <CPUDetect.h>
+#endif
+
+QTEST_MAIN(AudioKernelBenchmarks)
+
+static const int HRTF_DATASET_INDEX = 1;
+static const int NUM_SOURCES = 32;  // renders per benchmark iteration, roughly one busy listener
+
+static void fillBlock(int16_t* block, int numSamples) {
+    for (int i = 0; i < numSamples; i++) {
+        block[i] = (int16_t)(((i + 1) * 7919) % 20000 - 10000);
+    }
+}
+
+void AudioKernelBenchmarks::initTestCase() {
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    const char* backend = cpuSupportsAVX512() ? "AVX512" : (cpuSupportsAVX2() ? "AVX2" : "SSE");
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    const char* backend = "NEON";
+#else
+    const char* backend = "reference";
+#endif
+    qDebug() << "Audio kernel backend:" << backend;
+}
+
+void AudioKernelBenchmarks::benchmarkHRTF() {
+    AudioHRTF hrtfs[NUM_SOURCES];
+    int16_t input[HRTF_BLOCK];
+    float output[2 * HRTF_BLOCK];
+    fillBlock(input, HRTF_BLOCK);
+
+    int frame = 0;
+    QBENCHMARK {
+        memset(output, 0, sizeof(output));
+        for (int n = 0; n < NUM_SOURCES; n++) {
+            // keep the azimuth moving, so the parameter crossfades are exercised as well
+            float azimuth = 0.1f * (n + frame);
+            hrtfs[n].render(input, output, HRTF_DATASET_INDEX, azimuth, 4.0f, 0.5f, HRTF_BLOCK);
+        }
+        ++frame;
+    }
+}
+
+void AudioKernelBenchmarks::benchmarkSRC() {
+    const int NUM_CHANNELS = 2;
+    const int INPUT_FRAMES = 441;   // 10ms
+
+    AudioSRC src(44100, 48000, NUM_CHANNELS);
+    int16_t input[NUM_CHANNELS * INPUT_FRAMES];
+    int16_t output[NUM_CHANNELS * 2 * INPUT_FRAMES];
+    fillBlock(input, NUM_CHANNELS * INPUT_FRAMES);
+
+    QBENCHMARK {
+        for (int n = 0; n < NUM_SOURCES; n++) {
+            src.render(input, output, INPUT_FRAMES);
+        }
+    }
+}
+
+void AudioKernelBenchmarks::benchmarkFOA() {
+    const int NUM_CHANNELS = 4;
+
+    AudioFOA foa;
+    int16_t input[NUM_CHANNELS * FOA_BLOCK];
+    float output[2 * FOA_BLOCK];
+    fillBlock(input, NUM_CHANNELS * FOA_BLOCK);
+
+    int frame = 0;
+    QBENCHMARK {
+        memset(output, 0, sizeof(output));
+
+        // rotate about the vertical axis, so the soundfield rotation crossfades every block
+        float angle = 0.05f * frame;
+        foa.render(input, output, HRTF_DATASET_INDEX, cosf(angle), 0.0f, sinf(angle), 0.0f, 0.5f, FOA_BLOCK);
+        ++frame;
+    }
+}
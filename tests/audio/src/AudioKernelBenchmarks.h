@@ -0,0 +1,28 @@
+//
+//  AudioKernelBenchmarks.h
+//  tests/audio/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioKernelBenchmarks_h
+#define hifi_AudioKernelBenchmarks_h
+
+#include <QtTest/QtTest>
+
+// Throughput of the SIMD-dispatched audio kernels, measured through the public render() APIs.
+//   The kernel variant is picked at runtime (x86) or compile time (ARM), so the backend in use
+//   is logged to tell results from different machines apart.
+class AudioKernelBenchmarks : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void benchmarkHRTF();
+    void benchmarkSRC();
+    void benchmarkFOA();
+};
+
+#endif // hifi_AudioKernelBenchmarks_h
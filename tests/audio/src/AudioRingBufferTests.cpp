@@ -11,6 +11,10 @@
 
 #include "AudioRingBufferTests.h"
 
+#include <thread>
+
+#include <QMutex>
+
 #include "SharedUtil.h"
 
 // Adds an implicit cast to make sure that actual and expected are of the same type.
@@ -125,3 +129,119 @@ void AudioRingBufferTests::runAllTests() {
         assertBufferSize(ringBuffer, 0);
     }
 }
+
+void AudioRingBufferTests::lockFreeOverflowDropsNewest() {
+    int16_t writeData[200];
+    for (int i = 0; i < 200; i++) { writeData[i] = i; }
+    int16_t readData[200];
+
+    AudioRingBuffer ringBuffer(10, 10); // makes buffer of 100 int16_t samples
+    ringBuffer.setLockFree(true);
+
+    // write 110 samples, the last 10 are dropped instead of overwriting the first 10
+    QCOMPARE(ringBuffer.writeSamples(writeData, 100), 100);
+    QCOMPARE(ringBuffer.writeSamples(&writeData[100], 10), 0);
+    QCOMPARE(ringBuffer.getOverflowCount(), 1);
+    assertBufferSize(ringBuffer, 100);
+
+    QCOMPARE(ringBuffer.readSamples(readData, 100), 100);
+    for (int i = 0; i < 100; i++) {
+        QCOMPARE(readData[i], static_cast<int16_t>(i));
+    }
+
+    // drops requested by the writer are applied by the reader
+    ringBuffer.writeSamples(writeData, 20);
+    ringBuffer.dropOldestSamples(5);
+    assertBufferSize(ringBuffer, 20);
+    QCOMPARE(ringBuffer.readSamples(readData, 3), 3);
+    QCOMPARE(readData[0], static_cast<int16_t>(5));
+    assertBufferSize(ringBuffer, 12);
+}
+
+static const int CONTENTION_SAMPLES = 1000000;
+static const int CONTENTION_WRITE_SIZE = 240;   // one network frame of stereo samples
+static const int CONTENTION_READ_SIZE = 96;     // a device period
+
+// runs a producer thread against the calling (consumer) thread, returns false if the samples were not received in order
+template <typename Write, typename Read, typename Available>
+static bool runProducerConsumer(Write&& write, Read&& read, Available&& available, int sampleCapacity) {
+    std::thread producer([&] {
+        int16_t source[CONTENTION_WRITE_SIZE];
+        int numWritten = 0;
+        while (numWritten < CONTENTION_SAMPLES) {
+            int numSamples = std::min(CONTENTION_WRITE_SIZE, CONTENTION_SAMPLES - numWritten);
+            if (sampleCapacity - available() < numSamples) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (int i = 0; i < numSamples; i++) {
+                source[i] = (int16_t)(numWritten + i);
+            }
+            numWritten += write(source, numSamples);
+        }
+    });
+
+    bool inOrder = true;
+    int16_t destination[CONTENTION_READ_SIZE];
+    int numRead = 0;
+    while (numRead < CONTENTION_SAMPLES) {
+        int numSamples = read(destination, CONTENTION_READ_SIZE);
+        for (int i = 0; i < numSamples; i++) {
+            inOrder = inOrder && (destination[i] == (int16_t)(numRead + i));
+        }
+        numRead += numSamples;
+    }
+
+    producer.join();
+    return inOrder;
+}
+
+void AudioRingBufferTests::lockFreeProducerConsumer() {
+    AudioRingBuffer ringBuffer(CONTENTION_WRITE_SIZE, 10);
+    ringBuffer.setLockFree(true);
+
+    bool inOrder = runProducerConsumer(
+        [&](const int16_t* source, int numSamples) { return ringBuffer.writeSamples(source, numSamples); },
+        [&](int16_t* destination, int numSamples) { return ringBuffer.readSamples(destination, numSamples); },
+        [&] { return ringBuffer.samplesAvailable(); },
+        ringBuffer.getSampleCapacity());
+
+    QVERIFY(inOrder);
+    QCOMPARE(ringBuffer.getOverflowCount(), 0);
+}
+
+void AudioRingBufferTests::benchmarkLockFreeContention() {
+    AudioRingBuffer ringBuffer(CONTENTION_WRITE_SIZE, 10);
+    ringBuffer.setLockFree(true);
+
+    QBENCHMARK {
+        runProducerConsumer(
+            [&](const int16_t* source, int numSamples) { return ringBuffer.writeSamples(source, numSamples); },
+            [&](int16_t* destination, int numSamples) { return ringBuffer.readSamples(destination, numSamples); },
+            [&] { return ringBuffer.samplesAvailable(); },
+            ringBuffer.getSampleCapacity());
+    }
+}
+
+void AudioRingBufferTests::benchmarkMutexContention() {
+    // the same traffic through a default buffer guarded by a mutex, for comparison
+    AudioRingBuffer ringBuffer(CONTENTION_WRITE_SIZE, 10);
+    QMutex mutex;
+
+    QBENCHMARK {
+        runProducerConsumer(
+            [&](const int16_t* source, int numSamples) {
+                QMutexLocker lock(&mutex);
+                return ringBuffer.writeSamples(source, numSamples);
+            },
+            [&](int16_t* destination, int numSamples) {
+                QMutexLocker lock(&mutex);
+                return ringBuffer.readSamples(destination, numSamples);
+            },
+            [&] {
+                QMutexLocker lock(&mutex);
+                return ringBuffer.samplesAvailable();
+            },
+            ringBuffer.getSampleCapacity());
+    }
+}
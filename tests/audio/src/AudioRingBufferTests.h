@@ -21,6 +21,10 @@ class AudioRingBufferTests : public QObject {
     Q_OBJECT
 private slots:
     void runAllTests();
+    void lockFreeOverflowDropsNewest();
+    void lockFreeProducerConsumer();
+    void benchmarkLockFreeContention();
+    void benchmarkMutexContention();
 private:
     void assertBufferSize(const AudioRingBuffer& buffer, int samples);
 };
@@ -0,0 +1,94 @@
+//
+//  BufferArenaTests.cpp
+//  tests/gpu/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BufferArenaTests.h"
+
+#include <cstring>
+#include <vector>
+
+#include <gpu/BufferArena.h>
+
+QTEST_MAIN(BufferArenaTests)
+
+using namespace gpu;
+
+static const Size BLOCK_SIZE = 1024;
+
+void BufferArenaTests::testAllocate() {
+    BufferArena arena(BLOCK_SIZE);
+    const char first[] = "first";
+    const char second[] = "second";
+    auto firstAllocation = arena.allocate(sizeof(first), (const Byte*)first);
+    auto secondAllocation = arena.allocate(sizeof(second), (const Byte*)second);
+    QVERIFY(firstAllocation && secondAllocation);
+
+    // both share a block, at aligned offsets that don't overlap
+    QCOMPARE(firstAllocation->getBuffer(), secondAllocation->getBuffer());
+    QCOMPARE(firstAllocation->getOffset() % BufferArena::ALIGNMENT, (Size)0);
+    QCOMPARE(secondAllocation->getOffset() % BufferArena::ALIGNMENT, (Size)0);
+    QVERIFY(secondAllocation->getOffset() >= firstAllocation->getOffset() + firstAllocation->getSize() ||
+        firstAllocation->getOffset() >= secondAllocation->getOffset() + secondAllocation->getSize());
+
+    const Byte* data = firstAllocation->getBuffer()->getData();
+    QCOMPARE(memcmp(data + firstAllocation->getOffset(), first, sizeof(first)), 0);
+    QCOMPARE(memcmp(data + secondAllocation->getOffset(), second, sizeof(second)), 0);
+
+    auto stats = arena.getStats();
+    QCOMPARE(stats.numBlocks, 1);
+    QCOMPARE(stats.numAllocations, 2);
+    QCOMPARE(stats.blocksSize, BLOCK_SIZE);
+}
+
+void BufferArenaTests::testLargeData() {
+    BufferArena arena(BLOCK_SIZE);
+    std::vector<Byte> data(BLOCK_SIZE / 2);
+    QVERIFY(!arena.allocate(data.size(), data.data()));
+    QVERIFY(!arena.allocate(0, data.data()));
+    QCOMPARE(arena.getStats().numBlocks, 0);
+}
+
+void BufferArenaTests::testFreeMerges() {
+    BufferArena arena(BLOCK_SIZE);
+    const Size SIZE = BLOCK_SIZE / 8;
+    std::vector<BufferArena::AllocationPointer> allocations;
+    for (int i = 0; i < 8; ++i) {
+        allocations.push_back(arena.allocate(SIZE, nullptr));
+    }
+    QCOMPARE(arena.getStats().numBlocks, 1);
+
+    // the two ranges next to each other merge, and fit what neither could on its own
+    allocations[1].reset();
+    allocations[2].reset();
+    auto merged = arena.allocate(2 * SIZE, nullptr);
+    QCOMPARE(arena.getStats().numBlocks, 1);
+    QCOMPARE(merged->getOffset(), SIZE);
+}
+
+void BufferArenaTests::testReleaseEmptyBlocks() {
+    BufferArena arena(BLOCK_SIZE);
+    const Size SIZE = BLOCK_SIZE / 4;
+    std::vector<BufferArena::AllocationPointer> allocations;
+    for (int i = 0; i < 8; ++i) {
+        allocations.push_back(arena.allocate(SIZE, nullptr));
+    }
+    QCOMPARE(arena.getStats().numBlocks, 2);
+
+    // the block that empties out is released, the last one stays for what loads next
+    allocations.erase(allocations.begin(), allocations.begin() + 4);
+    QCOMPARE(arena.getStats().numBlocks, 1);
+    allocations.clear();
+    auto stats = arena.getStats();
+    QCOMPARE(stats.numBlocks, 1);
+    QCOMPARE(stats.numAllocations, 0);
+    QCOMPARE(stats.allocatedSize, (Size)0);
+
+    auto allocation = arena.allocate(BLOCK_SIZE / 4, nullptr);
+    QCOMPARE(allocation->getOffset(), (Size)0);
+}
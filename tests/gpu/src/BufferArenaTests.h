@@ -0,0 +1,25 @@
+//
+//  BufferArenaTests.h
+//  tests/gpu/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BufferArenaTests_h
+#define hifi_BufferArenaTests_h
+
+#include <QtTest/QtTest>
+
+class BufferArenaTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testAllocate();
+    void testLargeData();
+    void testFreeMerges();
+    void testReleaseEmptyBlocks();
+};
+
+#endif // hifi_BufferArenaTests_h
@@ -9,13 +9,17 @@
 #include "TextureTest.h"
 
 #include <iostream>
+#include <QtCore/QBuffer>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QTemporaryFile>
+#include <QtGui/QImage>
 
 #include <gpu/Forward.h>
 #include <gl/Config.h>
 #include <gl/GLHelpers.h>
 #include <gpu/gl/GLBackend.h>
 #include <NumericalConstants.h>
+#include <image/TextureProcessing.h>
 
 #include <quazip5/quazip.h>
 #include <quazip5/JlCompress.h>
@@ -27,6 +31,7 @@ QTEST_MAIN(TextureTest)
 
 #define LOAD_TEXTURE_COUNT 100
 #define FAIL_AFTER_SECONDS 30
+#define PROCESS_TEXTURE_SIZE 2048
 
 static const QString TEST_DATA("https://hifi-public.s3.amazonaws.com/austin/test_data/test_ktx.zip");
 static const QString TEST_DIR_NAME("{630b8f02-52af-4cdf-a896-24e472b94b28}");
@@ -301,3 +306,36 @@ void TextureTest::testTextureLoading() {
     }
     qDebug() << "Done";
 }
+
+void TextureTest::testTextureProcessing() {
+    // an unbaked albedo, noisy enough for the compressor to work on every block
+    QImage sourceImage(PROCESS_TEXTURE_SIZE, PROCESS_TEXTURE_SIZE, QImage::Format_RGB32);
+    for (int y = 0; y < PROCESS_TEXTURE_SIZE; ++y) {
+        QRgb* line = reinterpret_cast<QRgb*>(sourceImage.scanLine(y));
+        for (int x = 0; x < PROCESS_TEXTURE_SIZE; ++x) {
+            line[x] = qRgb(x & 0xFF, y & 0xFF, (x * y) & 0xFF);
+        }
+    }
+    QByteArray content;
+    {
+        QBuffer buffer(&content);
+        buffer.open(QIODevice::WriteOnly);
+        QVERIFY(sourceImage.save(&buffer, "PNG"));
+    }
+
+    QBENCHMARK {
+        QElapsedTimer timer;
+        timer.start();
+        auto device = std::make_shared<QBuffer>(&content);
+        device->open(QIODevice::ReadOnly);
+        auto texture = image::processImage(device, "benchmark.png", image::ColorChannel::NONE,
+                                           PROCESS_TEXTURE_SIZE * PROCESS_TEXTURE_SIZE, image::TextureUsage::ALBEDO_TEXTURE,
+                                           true, gpu::BackendTarget::GL45);
+        QVERIFY(texture);
+        QCOMPARE(texture->getWidth(), (uint16_t)PROCESS_TEXTURE_SIZE);
+
+        float megapixels = (float)(PROCESS_TEXTURE_SIZE * PROCESS_TEXTURE_SIZE) / 1.0e6f;
+        qDebug() << "Processed" << megapixels << "megapixels at" << megapixels * MSECS_PER_SECOND / std::max(timer.elapsed(), (qint64)1)
+                 << "megapixels per second";
+    }
+}
@@ -28,6 +28,7 @@ private slots:
     void initTestCase();
     void cleanupTestCase();
     void testTextureLoading();
+    void testTextureProcessing();
 
 
 private:
@@ -0,0 +1,125 @@
+//
+//  CongestionControlTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CongestionControlTests.h"
+
+#include <deque>
+#include <thread>
+
+#include <udt/BBRCC.h>
+#include <udt/TCPVegasCC.h>
+
+QTEST_MAIN(CongestionControlTests)
+
+using namespace udt;
+using namespace std::chrono;
+
+// the congestion controls time their adjustments with the real clock, so the link is simulated in real time
+static const double LINK_PACKETS_PER_SECOND = 5000.0;
+static const auto LINK_ONE_WAY_DELAY = milliseconds(25);
+static const auto RECEIVER_ACK_INTERVAL = microseconds(DEFAULT_SYN_INTERVAL);
+static const auto TRANSFER_DURATION = seconds(3);
+static const auto MEASUREMENT_DURATION = milliseconds(1500);
+
+// exposes the outputs of a congestion control the way Connection reads them
+template <typename CC>
+class TestCongestionControl : public CC {
+public:
+    TestCongestionControl() { this->setInitialSendSequenceNumber(SequenceNumber()); }
+
+    using CC::setSendCurrentSequenceNumber;
+
+    double getPacketSendPeriod() const { return this->_packetSendPeriod; }
+    int getCongestionWindowSize() const { return this->_congestionWindowSize; }
+};
+
+// Send as fast as the congestion control allows over a drop-free bottleneck link, with a receiver that
+// ACKs every SYN interval like Connection does. Returns the delivery rate over the end of the transfer.
+template <typename CC>
+double measureThroughput() {
+    TestCongestionControl<CC> congestionControl;
+
+    struct InFlightPacket {
+        SequenceNumber sequenceNumber;
+        p_high_resolution_clock::time_point arrivalTime; // at the receiver
+    };
+    std::deque<InFlightPacket> inFlight;
+
+    auto start = p_high_resolution_clock::now();
+    auto end = start + TRANSFER_DURATION;
+    auto measurementStart = end - MEASUREMENT_DURATION;
+
+    auto serviceTime = duration_cast<p_high_resolution_clock::duration>(duration<double>(1.0 / LINK_PACKETS_PER_SECOND));
+    auto bottleneckFreeTime = start;
+    auto nextSendTime = start;
+    auto nextACKTime = start + RECEIVER_ACK_INTERVAL;
+
+    SequenceNumber lastSent = SequenceNumber() - 1;
+    SequenceNumber lastACKed = lastSent;
+    int measuredPackets = 0;
+
+    for (auto now = start; now < end; now = p_high_resolution_clock::now()) {
+        // deliver the ACKs the receiver sent one link delay ago
+        while (nextACKTime + LINK_ONE_WAY_DELAY <= now) {
+            bool hasNewACK = false;
+            while (!inFlight.empty() && inFlight.front().arrivalTime <= nextACKTime) {
+                lastACKed = inFlight.front().sequenceNumber;
+                inFlight.pop_front();
+                hasNewACK = true;
+
+                if (nextACKTime + LINK_ONE_WAY_DELAY >= measurementStart) {
+                    ++measuredPackets;
+                }
+            }
+
+            if (hasNewACK) {
+                congestionControl.setSendCurrentSequenceNumber(lastSent);
+                congestionControl.onACK(lastACKed, now);
+            }
+
+            nextACKTime += RECEIVER_ACK_INTERVAL;
+        }
+
+        // send while the flow window and the pacing allow it
+        while (seqoff(lastACKed, lastSent) < congestionControl.getCongestionWindowSize() && nextSendTime <= now) {
+            ++lastSent;
+            congestionControl.setSendCurrentSequenceNumber(lastSent);
+            congestionControl.onPacketSent(MAX_PACKET_SIZE, lastSent, now);
+
+            bottleneckFreeTime = std::max(bottleneckFreeTime, now + LINK_ONE_WAY_DELAY) + serviceTime;
+            inFlight.push_back({ lastSent, bottleneckFreeTime });
+
+            auto sendPeriod = duration_cast<p_high_resolution_clock::duration>(
+                duration<double, std::micro>(congestionControl.getPacketSendPeriod()));
+            nextSendTime = std::max(nextSendTime + sendPeriod, now - milliseconds(1));
+        }
+
+        std::this_thread::sleep_for(microseconds(50));
+    }
+
+    return measuredPackets / duration<double>(MEASUREMENT_DURATION).count();
+}
+
+void CongestionControlTests::throughputTest() {
+    double vegasThroughput = measureThroughput<TCPVegasCC>();
+    double bbrThroughput = measureThroughput<BBRCC>();
+
+    qDebug() << "Link:" << LINK_PACKETS_PER_SECOND << "packets per second,"
+        << duration_cast<milliseconds>(LINK_ONE_WAY_DELAY * 2).count() << "ms RTT";
+    qDebug() << "TCPVegasCC:" << vegasThroughput << "packets per second";
+    qDebug() << "BBRCC:" << bbrThroughput << "packets per second";
+
+    QVERIFY(vegasThroughput > 0.0);
+    QVERIFY(bbrThroughput <= LINK_PACKETS_PER_SECOND * 1.05);
+
+    // once out of startup BBR should keep the bottleneck busy, and not do worse than Vegas on a loss-free link
+    QVERIFY(bbrThroughput >= LINK_PACKETS_PER_SECOND * 0.5);
+    QVERIFY(bbrThroughput >= vegasThroughput * 0.8);
+}
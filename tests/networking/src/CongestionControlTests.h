@@ -0,0 +1,25 @@
+//
+//  CongestionControlTests.h
+//  tests/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CongestionControlTests_h
+#define hifi_CongestionControlTests_h
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+class CongestionControlTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Compare the throughput of TCPVegasCC and BBRCC over a simulated bottleneck link
+    void throughputTest();
+};
+
+#endif // hifi_CongestionControlTests_h
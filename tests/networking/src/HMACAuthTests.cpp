@@ -0,0 +1,106 @@
+//
+//  HMACAuthTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "HMACAuthTests.h"
+
+#include <HMACAuth.h>
+#include <NumericalConstants.h>
+
+QTEST_MAIN(HMACAuthTests)
+
+Q_DECLARE_METATYPE(HMACAuth::AuthMethod)
+
+// the key and messages of the reference test vectors are the bytes 0, 1, 2...
+static QByteArray sequenceBytes(int size) {
+    QByteArray bytes(size, 0);
+    for (int i = 0; i < size; i++) {
+        bytes[i] = (char)i;
+    }
+    return bytes;
+}
+
+static QByteArray calculateHash(HMACAuth& auth, const QByteArray& data) {
+    HMACAuth::HMACHash hash;
+    if (!auth.calculateHash(hash, data.constData(), data.size())) {
+        return QByteArray();
+    }
+    return QByteArray((const char*)hash.data(), (int)hash.size());
+}
+
+void HMACAuthTests::sipHashVectorsTest() {
+    HMACAuth auth(HMACAuth::SIPHASH);
+    QByteArray key = sequenceBytes(16);
+    QVERIFY(auth.setKey(key.constData(), key.size()));
+
+    QCOMPARE(calculateHash(auth, sequenceBytes(0)).toHex(), QByteArray("a3817f04ba25a8e66df67214c7550293"));
+    QCOMPARE(calculateHash(auth, sequenceBytes(1)).toHex(), QByteArray("da87c1d86b99af44347659119b22fc45"));
+    QCOMPARE(calculateHash(auth, sequenceBytes(15)).toHex(), QByteArray("5493e99933b0a8117e08ec0f97cfc3d9"));
+    QCOMPARE(calculateHash(auth, sequenceBytes(63)).toHex(), QByteArray("5150d1772f50834a503e069a973fbd7c"));
+
+    // the key is 128 bits, like the connection secrets
+    QVERIFY(!auth.setKey(key.constData(), 8));
+}
+
+void HMACAuthTests::addDataTest() {
+    QByteArray data = sequenceBytes(100);
+    for (auto method : { HMACAuth::MD5, HMACAuth::SIPHASH }) {
+        HMACAuth auth(method);
+        QVERIFY(auth.setKey(QUuid::createUuid()));
+        QByteArray hash = calculateHash(auth, data);
+        QCOMPARE(hash.size(), 16);
+
+        QVERIFY(auth.addData(data.constData(), 30));
+        QVERIFY(auth.addData(data.constData() + 30, data.size() - 30));
+        HMACAuth::HMACHash result = auth.result();
+        QCOMPARE(QByteArray((const char*)result.data(), (int)result.size()), hash);
+    }
+}
+
+void HMACAuthTests::negotiateTest() {
+    quint8 methods = HMACAuth::getPacketAuthMethods();
+    QCOMPARE(HMACAuth::negotiatePacketAuthMethod(methods, methods), HMACAuth::SIPHASH);
+    // a node that didn't say what it can do
+    QCOMPARE(HMACAuth::negotiatePacketAuthMethod(methods, 0), HMACAuth::MD5);
+    QCOMPARE(HMACAuth::negotiatePacketAuthMethod(1 << HMACAuth::MD5, methods), HMACAuth::MD5);
+}
+
+void HMACAuthTests::packetRate_data() {
+    QTest::addColumn<HMACAuth::AuthMethod>("method");
+    QTest::addColumn<int>("packetSize");
+    for (int packetSize : { 64, 256, 1400 }) {
+        QTest::newRow(qPrintable(QString("MD5 %1 bytes").arg(packetSize))) << HMACAuth::MD5 << packetSize;
+        QTest::newRow(qPrintable(QString("SipHash %1 bytes").arg(packetSize))) << HMACAuth::SIPHASH << packetSize;
+    }
+}
+
+void HMACAuthTests::packetRate() {
+    QFETCH(HMACAuth::AuthMethod, method);
+    QFETCH(int, packetSize);
+
+    const int NUM_PACKETS = 200000;
+
+    HMACAuth auth(method);
+    QVERIFY(auth.setKey(QUuid::createUuid()));
+    QByteArray packet = sequenceBytes(packetSize);
+
+    QElapsedTimer timer;
+    HMACAuth::HMACHash hash;
+    int numSigned = 0;
+    timer.start();
+    for (int i = 0; i < NUM_PACKETS; i++) {
+        // every packet is different, like their sequence numbers
+        packet[0] = (char)i;
+        numSigned += auth.calculateHash(hash, packet.constData(), packet.size()) ? 1 : 0;
+    }
+    double seconds = timer.nsecsElapsed() / (double)NSECS_PER_SECOND;
+    QCOMPARE(numSigned, NUM_PACKETS);
+
+    qDebug() << QTest::currentDataTag() << ":" << NUM_PACKETS / seconds << "packets per second";
+}
@@ -0,0 +1,33 @@
+//
+//  HMACAuthTests.h
+//  tests/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_HMACAuthTests_h
+#define hifi_HMACAuthTests_h
+
+#include <QtTest/QtTest>
+
+class HMACAuthTests : public QObject {
+    Q_OBJECT
+private slots:
+    // SipHash-2-4 against the test vectors of its reference implementation
+    void sipHashVectorsTest();
+
+    // the incremental interface gives the same hashes as the one shot one
+    void addDataTest();
+
+    // the method picked for a connection
+    void negotiateTest();
+
+    // packets signed per second with each method, for the sizes of audio and avatar packets up to the MTU
+    void packetRate_data();
+    void packetRate();
+};
+
+#endif // hifi_HMACAuthTests_h
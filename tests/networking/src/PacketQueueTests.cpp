@@ -0,0 +1,71 @@
+//
+//  PacketQueueTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketQueueTests.h"
+
+#include <NLPacket.h>
+#include <NLPacketList.h>
+#include <udt/PacketQueue.h>
+
+QTEST_MAIN(PacketQueueTests)
+
+using namespace udt;
+
+static const int NUM_BULK_LISTS = 20;
+static const int NUM_BULK_LIST_PAYLOADS = 4;
+
+static std::unique_ptr<NLPacketList> createList(PacketType type, int numPayloads) {
+    auto packetList = NLPacketList::create(type, QByteArray(), true, true);
+    for (int i = 0; i < numPayloads; ++i) {
+        // a segment fills its own packet
+        packetList->startSegment();
+        packetList->write(QByteArray((int)packetList->getMaxSegmentSize(), 'x'));
+        packetList->endSegment();
+    }
+    packetList->closeCurrentPacket();
+    return packetList;
+}
+
+void PacketQueueTests::testPriorityWeightGoesAhead() {
+    PacketQueue queue;
+    for (int i = 0; i < NUM_BULK_LISTS; ++i) {
+        queue.queuePacketList(createList(PacketType::EntityData, NUM_BULK_LIST_PAYLOADS));
+    }
+
+    auto messagesList = createList(PacketType::MessagesData, 2);
+    int numMessagesPackets = (int)messagesList->getNumPackets();
+    messagesList->setPriorityWeight(PacketList::LATENCY_SENSITIVE_PRIORITY_WEIGHT);
+    queue.queuePacketList(std::move(messagesList));
+
+    // the bulk lists are visited one packet at a time, the messages list gets its packets together
+    int numTaken = 0;
+    int numMessagesPacketsTaken = 0;
+    while (numMessagesPacketsTaken < numMessagesPackets) {
+        auto packet = queue.takePacket();
+        QVERIFY(packet);
+        ++numTaken;
+        if (NLPacket::typeInHeader(*packet) == PacketType::MessagesData) {
+            ++numMessagesPacketsTaken;
+        }
+    }
+    QVERIFY(numTaken <= numMessagesPackets + 1);
+}
+
+void PacketQueueTests::testSameWeightInterleaves() {
+    PacketQueue queue;
+    queue.queuePacketList(createList(PacketType::EntityData, 2));
+    queue.queuePacketList(createList(PacketType::MessagesData, 2));
+
+    QCOMPARE(NLPacket::typeInHeader(*queue.takePacket()), PacketType::EntityData);
+    QCOMPARE(NLPacket::typeInHeader(*queue.takePacket()), PacketType::MessagesData);
+    QCOMPARE(NLPacket::typeInHeader(*queue.takePacket()), PacketType::EntityData);
+    QCOMPARE(NLPacket::typeInHeader(*queue.takePacket()), PacketType::MessagesData);
+    QVERIFY(queue.isEmpty());
+}
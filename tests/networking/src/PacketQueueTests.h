@@ -0,0 +1,27 @@
+//
+//  PacketQueueTests.h
+//  tests/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PacketQueueTests_h
+#define hifi_PacketQueueTests_h
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+class PacketQueueTests : public QObject {
+    Q_OBJECT
+private slots:
+    // a latency sensitive list is sent ahead of the bulk lists that were queued before it
+    void testPriorityWeightGoesAhead();
+    // the lists of the same weight are sent a packet each time around
+    void testSameWeightInterleaves();
+};
+
+#endif // hifi_PacketQueueTests_h
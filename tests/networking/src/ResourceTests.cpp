@@ -93,3 +93,55 @@ void ResourceTests::downloadAgain() {
 
     QVERIFY(resource->isLoaded());
 }
+
+static QSharedPointer<Resource> createPendingResource(const QString& url) {
+    auto pending = QSharedPointer<Resource>::create(QUrl(url));
+    pending->setSelf(pending);
+    return pending;
+}
+
+void ResourceTests::requestPriorities() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    sharedItems->clear();
+    sharedItems->setSchemeRequestLimit("http", 1);
+
+    QObject owner;
+    auto firstA = createPendingResource("http://a.example/first");
+    auto secondA = createPendingResource("http://a.example/second");
+    auto firstB = createPendingResource("http://b.example/first");
+    auto secondB = createPendingResource("http://b.example/second");
+    secondA->setLoadPriority(&owner, 1.0f);
+    secondB->setLoadPriority(&owner, 2.0f);
+
+    // each host takes a single request, the others wait
+    QVERIFY(sharedItems->appendRequest(firstA));
+    QVERIFY(!sharedItems->appendRequest(secondA));
+    QVERIFY(sharedItems->appendRequest(firstB));
+    QVERIFY(!sharedItems->appendRequest(secondB));
+    QCOMPARE(sharedItems->getLoadingRequestsCount(), 2u);
+    QCOMPARE(sharedItems->getPendingRequestsCount(), 2u);
+    QVERIFY(sharedItems->getHighestPendingRequest().isNull());
+
+    // a pending request moves with its priority, but still waits for its host
+    secondA->setLoadPriority(&owner, 3.0f);
+    sharedItems->removeRequest(firstB);
+    QCOMPARE(sharedItems->getHighestPendingRequest(), secondB);
+
+    bool foundA = false;
+    foreach (const auto& origin, sharedItems->getOriginStats()) {
+        if (origin.origin == "http://a.example") {
+            foundA = true;
+            QCOMPARE(origin.pending, 1u);
+            QCOMPARE(origin.loading, 1u);
+            QCOMPARE(origin.limit, 1u);
+        }
+    }
+    QVERIFY(foundA);
+
+    sharedItems->removeRequest(firstA);
+    QCOMPARE(sharedItems->getHighestPendingRequest(), secondA);
+    QCOMPARE(sharedItems->getPendingRequestsCount(), 0u);
+
+    sharedItems->setSchemeRequestLimit("http", sharedItems->getRequestLimit());
+    sharedItems->clear();
+}
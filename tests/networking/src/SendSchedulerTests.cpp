@@ -0,0 +1,92 @@
+//
+//  SendSchedulerTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SendSchedulerTests.h"
+
+#include <atomic>
+#include <thread>
+
+#include <udt/SendScheduler.h>
+
+QTEST_MAIN(SendSchedulerTests)
+
+using namespace udt;
+using namespace std::chrono;
+
+static const auto STEP_INTERVAL = milliseconds(10);
+static const auto SETTLE_TIME = milliseconds(100);
+
+void SendSchedulerTests::testStepsWhenDue() {
+    SendScheduler scheduler(2);
+    QCOMPARE(scheduler.numThreads(), 2);
+
+    // a queue that wants to be stepped three times, an interval apart
+    std::atomic<int> numSteps { 0 };
+    auto start = p_high_resolution_clock::now();
+    auto id = scheduler.add([&] {
+        if (++numSteps < 3) {
+            return p_high_resolution_clock::now() + STEP_INTERVAL;
+        }
+        return SendScheduler::never();
+    });
+
+    std::this_thread::sleep_for(2 * STEP_INTERVAL + SETTLE_TIME);
+    QCOMPARE(numSteps.load(), 3);
+    QVERIFY(p_high_resolution_clock::now() - start >= 2 * STEP_INTERVAL);
+
+    auto stats = scheduler.sampleStats();
+    QCOMPARE(stats.numThreads, 2);
+    QCOMPARE(stats.numSteps, (uint64_t)3);
+    QVERIFY(stats.maxLagUsecs >= stats.averageLagUsecs);
+
+    scheduler.remove(id);
+}
+
+void SendSchedulerTests::testWakeStepsAgain() {
+    SendScheduler scheduler(1);
+
+    std::atomic<int> numSteps { 0 };
+    auto id = scheduler.add([&] {
+        ++numSteps;
+        return SendScheduler::never();
+    });
+
+    std::this_thread::sleep_for(SETTLE_TIME);
+    QCOMPARE(numSteps.load(), 1);
+
+    scheduler.wake(id);
+    std::this_thread::sleep_for(SETTLE_TIME);
+    QCOMPARE(numSteps.load(), 2);
+
+    // once removed, waking it is ignored
+    scheduler.remove(id);
+    scheduler.wake(id);
+    std::this_thread::sleep_for(SETTLE_TIME);
+    QCOMPARE(numSteps.load(), 2);
+}
+
+void SendSchedulerTests::testRemoveWaitsForStep() {
+    SendScheduler scheduler(1);
+
+    std::atomic<bool> isStepping { false };
+    std::atomic<bool> hasStepped { false };
+    auto id = scheduler.add([&] {
+        isStepping = true;
+        std::this_thread::sleep_for(SETTLE_TIME);
+        hasStepped = true;
+        return SendScheduler::never();
+    });
+
+    while (!isStepping) {
+        std::this_thread::yield();
+    }
+    scheduler.remove(id);
+    QVERIFY(hasStepped);
+}
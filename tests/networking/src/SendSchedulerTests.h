@@ -0,0 +1,26 @@
+//
+//  SendSchedulerTests.h
+//  tests/networking/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SendSchedulerTests_h
+#define hifi_SendSchedulerTests_h
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+class SendSchedulerTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testStepsWhenDue();
+    void testWakeStepsAgain();
+    void testRemoveWaitsForStep();
+};
+
+#endif // hifi_SendSchedulerTests_h
@@ -12,7 +12,9 @@
 #include "SequenceNumberStatsTests.h"
 
 #include <limits>
+#include <random>
 
+#include <NumericalConstants.h>
 #include <SharedUtil.h>
 
 QTEST_MAIN(SequenceNumberStatsTests)
@@ -323,3 +325,38 @@ void SequenceNumberStatsTests::resyncTest() {
     }
     QCOMPARE_WITH_CAST(stats.getUnreasonable(), 0);
 }
+
+void SequenceNumberStatsTests::receiveRateBenchmark() {
+    const int NUM_PACKETS = 1000000;
+
+    // one packet in a hundred is lost and one in fifty is swapped with the next one, through a few rollovers
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::vector<quint16> arrivals;
+    arrivals.reserve(NUM_PACKETS);
+    for (int i = 0; i < NUM_PACKETS; i++) {
+        int chance = percent(generator);
+        if (chance == 0) {
+            continue;
+        }
+        arrivals.push_back((quint16)i);
+        if (chance <= 2 && arrivals.size() > 1) {
+            std::swap(arrivals[arrivals.size() - 1], arrivals[arrivals.size() - 2]);
+        }
+    }
+
+    SequenceNumberStats stats(0);
+    QElapsedTimer timer;
+    timer.start();
+    for (auto sequence : arrivals) {
+        stats.sequenceNumberReceived(sequence);
+    }
+    double seconds = timer.nsecsElapsed() / (double)NSECS_PER_SECOND;
+
+    QCOMPARE_WITH_CAST(stats.getReceived(), arrivals.size());
+    QCOMPARE_WITH_CAST(stats.getUnreasonable(), 0);
+    QVERIFY(stats.getLost() > 0 && stats.getRecovered() > 0);
+    QVERIFY(stats.getMissingSet().size() <= MAX_REASONABLE_SEQUENCE_GAP);
+
+    qDebug() << arrivals.size() / seconds << "packets accounted per second";
+}
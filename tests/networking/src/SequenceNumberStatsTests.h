@@ -25,6 +25,9 @@ private slots:
     void duplicateTest();
     void pruneTest();
     void resyncTest();
+
+    // packets accounted per second for a stream that loses and reorders some of them
+    void receiveRateBenchmark();
 };
 
 #endif // hifi_SequenceNumberStatsTests_h
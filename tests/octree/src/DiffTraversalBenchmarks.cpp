@@ -0,0 +1,128 @@
+//
+//  DiffTraversalBenchmarks.cpp
+//  tests/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DiffTraversalBenchmarks.h"
+
+#include <random>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <DiffTraversal.h>
+#include <ViewFrustum.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <CPUDetect.h>
+#endif
+
+QTEST_MAIN(DiffTraversalBenchmarks)
+
+static const int NUM_PARENTS = 4096;
+static const int NUM_PASSES = 200;
+
+// parents spread around the viewers at the sizes a traversal goes through, with all of their children present
+static std::vector<DiffTraversal::ChildCubes> createChildCubes() {
+    std::mt19937 generator(17);
+    std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+    std::uniform_int_distribution<int> level(0, 10);
+
+    std::vector<DiffTraversal::ChildCubes> parents(NUM_PARENTS);
+    for (auto& children : parents) {
+        float childScale = 512.0f / (float)(1 << level(generator));
+        glm::vec3 corner(position(generator), position(generator), position(generator));
+        for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+            glm::vec3 offset((i >> 2) & 1, (i >> 1) & 1, i & 1);
+            children.set(i, AACube(corner + offset * childScale, childScale));
+        }
+    }
+    return parents;
+}
+
+static DiffTraversal::View createView(int numFrustums) {
+    DiffTraversal::View view;
+    for (int i = 0; i < numFrustums; ++i) {
+        ViewFrustum viewFrustum;
+        viewFrustum.setProjection(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f));
+        viewFrustum.setPosition(glm::vec3(10.0f * i, 1.5f, -5.0f * i));
+        viewFrustum.setOrientation(glm::angleAxis(glm::radians(90.0f * i), glm::vec3(0.0f, 1.0f, 0.0f)));
+        viewFrustum.calculate();
+        view.viewFrustums.push_back(ConicalViewFrustum(viewFrustum));
+    }
+    return view;
+}
+
+static AACube childCube(const DiffTraversal::ChildCubes& children, int index) {
+    return AACube(glm::vec3(children.cornerX[index], children.cornerY[index], children.cornerZ[index]), children.scale[index]);
+}
+
+void DiffTraversalBenchmarks::initTestCase() {
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    const char* backend = cpuSupportsAVX2() ? "AVX2" : "reference";
+#else
+    const char* backend = "reference";
+#endif
+    qDebug() << "Child culling backend:" << backend;
+}
+
+void DiffTraversalBenchmarks::cullChildren_data() {
+    QTest::addColumn<int>("numFrustums");
+    QTest::newRow("1 frustum") << 1;
+    QTest::newRow("2 frustums") << 2;
+    QTest::newRow("4 frustums") << 4;
+}
+
+void DiffTraversalBenchmarks::cullChildren() {
+    QFETCH(int, numFrustums);
+
+    auto parents = createChildCubes();
+    auto view = createView(numFrustums);
+
+    // the batched tests round differently, only cubes right at the edge of a test may come out the other way
+    int numMismatches = 0;
+    int numInView = 0;
+    for (const auto& children : parents) {
+        uint8_t childrenToTraverse = view.getChildrenToTraverse(children);
+        for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+            bool inView = view.shouldTraverseCube(childCube(children, i));
+            numInView += inView ? 1 : 0;
+            numMismatches += (inView != (bool)(childrenToTraverse & (1 << i))) ? 1 : 0;
+        }
+    }
+    const int NUM_ELEMENTS = NUM_PARENTS * NUMBER_OF_CHILDREN;
+    QVERIFY(numInView > 0 && numInView < NUM_ELEMENTS);
+    QVERIFY(numMismatches * 1000 <= NUM_ELEMENTS);
+
+    QElapsedTimer timer;
+    int numVisited = 0;
+    timer.start();
+    for (int pass = 0; pass < NUM_PASSES; ++pass) {
+        for (const auto& children : parents) {
+            for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+                numVisited += view.shouldTraverseCube(childCube(children, i)) ? 1 : 0;
+            }
+        }
+    }
+    double singleSeconds = timer.nsecsElapsed() / (double)NSECS_PER_SECOND;
+
+    timer.restart();
+    for (int pass = 0; pass < NUM_PASSES; ++pass) {
+        for (const auto& children : parents) {
+            numVisited += (int)view.getChildrenToTraverse(children);
+        }
+    }
+    double batchedSeconds = timer.nsecsElapsed() / (double)NSECS_PER_SECOND;
+
+    // also keeps the timed loops from being optimized away
+    QVERIFY(numVisited > 0);
+
+    double numCulled = (double)NUM_PASSES * NUM_ELEMENTS;
+    qDebug() << numFrustums << "frustums:" << numCulled / singleSeconds << "elements per second a child at a time,"
+        << numCulled / batchedSeconds << "batched";
+}
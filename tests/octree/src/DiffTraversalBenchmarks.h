@@ -0,0 +1,26 @@
+//
+//  DiffTraversalBenchmarks.h
+//  tests/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DiffTraversalBenchmarks_h
+#define hifi_DiffTraversalBenchmarks_h
+
+#include <QtTest/QtTest>
+
+// Elements culled per second by DiffTraversal::View, a child at a time and all the children of an element at once,
+// for views with one or more frustums. The batched path is picked at runtime, the backend in use is logged.
+class DiffTraversalBenchmarks : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cullChildren_data();
+    void cullChildren();
+};
+
+#endif // hifi_DiffTraversalBenchmarks_h
@@ -0,0 +1,85 @@
+//
+//  DiffTraversalTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DiffTraversalTests.h"
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include <DiffTraversal.h>
+#include <EntityPriorityQueue.h>
+
+QTEST_MAIN(DiffTraversalTests)
+
+static QJsonArray parseRegions(const char* json) {
+    return QJsonDocument::fromJson(json).array();
+}
+
+void DiffTraversalTests::testQueryRegionsFromJSON() {
+    auto regions = DiffTraversal::QueryRegion::fromJSON(parseRegions(
+        "[ { \"center\": { \"x\": 1, \"y\": 2, \"z\": 3 }, \"radius\": 4 },"
+        "  { \"corner\": { \"x\": -1, \"y\": -1, \"z\": -1 }, \"dimensions\": { \"x\": 2, \"y\": 2, \"z\": 2 } },"
+        "  { \"radius\": 5 } ]"));
+
+    // the region that is neither a box nor a sphere is skipped
+    QCOMPARE((int)regions.size(), 2);
+    QVERIFY(regions[0].isSphere);
+    QCOMPARE(regions[0].center, glm::vec3(1.0f, 2.0f, 3.0f));
+    QCOMPARE(regions[0].radius, 4.0f);
+    QVERIFY(!regions[1].isSphere);
+    QCOMPARE(regions[1].box.getCorner(), glm::vec3(-1.0f));
+    QCOMPARE(regions[1].box.getDimensions(), glm::vec3(2.0f));
+
+    QVERIFY(regions[0].touches(AACube(glm::vec3(4.0f, 2.0f, 3.0f), 1.0f)));
+    QVERIFY(!regions[0].touches(AACube(glm::vec3(10.0f, 2.0f, 3.0f), 1.0f)));
+    QVERIFY(regions[1].touches(AACube(glm::vec3(0.5f), 1.0f)));
+    QVERIFY(!regions[1].touches(AACube(glm::vec3(2.0f), 1.0f)));
+}
+
+void DiffTraversalTests::testChildrenInRegions() {
+    // the children of a cube of size 2 at the origin
+    DiffTraversal::ChildCubes children;
+    for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+        glm::vec3 offset((i >> 2) & 1, (i >> 1) & 1, i & 1);
+        children.set(i, AACube(offset, 1.0f));
+    }
+
+    DiffTraversal::View view;
+    QCOMPARE(view.getChildrenToTraverse(children), children.existing);
+
+    // a small box in the child at (1, 1, 1) only
+    view.regions = DiffTraversal::QueryRegion::fromJSON(parseRegions(
+        "[ { \"corner\": { \"x\": 1.25, \"y\": 1.25, \"z\": 1.25 }, \"dimensions\": { \"x\": 0.5, \"y\": 0.5, \"z\": 0.5 } } ]"));
+    QCOMPARE((int)view.getChildrenToTraverse(children), 1 << 7);
+    for (int i = 0; i < NUMBER_OF_CHILDREN; ++i) {
+        glm::vec3 offset((i >> 2) & 1, (i >> 1) & 1, i & 1);
+        QCOMPARE(view.shouldTraverseCube(AACube(offset, 1.0f)), i == 7);
+    }
+
+    // a sphere around the origin touches the child at the origin only
+    view.regions = DiffTraversal::QueryRegion::fromJSON(parseRegions(
+        "[ { \"center\": { \"x\": -0.2, \"y\": -0.2, \"z\": -0.2 }, \"radius\": 0.5 } ]"));
+    QCOMPARE((int)view.getChildrenToTraverse(children), 1 << 0);
+}
+
+void DiffTraversalTests::testPriorityInRegions() {
+    DiffTraversal::View view;
+    QVERIFY(!view.usesRegions());
+    QCOMPARE(view.computePriority(EntityItemPointer()), PrioritizedEntity::DO_NOT_SEND);
+
+    DiffTraversal::View other;
+    QVERIFY(view.isVerySimilar(other));
+    other.regions = DiffTraversal::QueryRegion::fromJSON(parseRegions(
+        "[ { \"center\": { \"x\": 0, \"y\": 0, \"z\": 0 }, \"radius\": 1 } ]"));
+    QVERIFY(other.usesRegions());
+    QVERIFY(!view.isVerySimilar(other));
+    view.regions = other.regions;
+    QVERIFY(view.isVerySimilar(other));
+}
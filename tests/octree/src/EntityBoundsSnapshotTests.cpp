@@ -0,0 +1,174 @@
+//
+//  EntityBoundsSnapshotTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityBoundsSnapshotTests.h"
+
+#include <EntityBoundsSnapshot.h>
+#include <EntityItemProperties.h>
+#include <EntityTypes.h>
+
+QTEST_MAIN(EntityBoundsSnapshotTests)
+
+static const int GRID_SIZE = 12;
+static const float GRID_SPACING = 2.0f;
+
+// a grid of boxes of varying sizes, some of them overlapping their neighbors
+static QVector<EntityItemPointer> createEntities() {
+    QVector<EntityItemPointer> entities;
+    for (int x = 0; x < GRID_SIZE; ++x) {
+        for (int y = 0; y < GRID_SIZE; ++y) {
+            for (int z = 0; z < GRID_SIZE; ++z) {
+                EntityItemProperties properties;
+                properties.setType(EntityTypes::Box);
+                properties.setPosition(glm::vec3(x, y, z) * GRID_SPACING);
+                properties.setDimensions(glm::vec3(0.5f + (float)((x + y + z) % 5) * 0.5f));
+                entities.push_back(EntityTypes::constructEntityItem(EntityTypes::Box, QUuid::createUuid(), properties));
+            }
+        }
+    }
+    return entities;
+}
+
+static QSet<EntityItemID> toSet(const QVector<EntityItemPointer>& entities) {
+    QSet<EntityItemID> ids;
+    for (auto& entity : entities) {
+        ids.insert(entity->getEntityItemID());
+    }
+    return ids;
+}
+
+static QSet<EntityItemID> findInBox(const EntityBoundsSnapshotPointer& snapshot, const AABox& box) {
+    QSet<EntityItemID> ids;
+    snapshot->forEachEntityTouchingBox(box, [&](const EntityItemPointer& entity) {
+        ids.insert(entity->getEntityItemID());
+    });
+    return ids;
+}
+
+static QSet<EntityItemID> bruteForceInBox(const QVector<EntityItemPointer>& entities, const AABox& box) {
+    QSet<EntityItemID> ids;
+    for (auto& entity : entities) {
+        bool success;
+        if (entity->getAABox(success).touches(box) && success) {
+            ids.insert(entity->getEntityItemID());
+        }
+    }
+    return ids;
+}
+
+void EntityBoundsSnapshotTests::boxQueries() {
+    auto entities = createEntities();
+    auto snapshot = EntityBoundsSnapshot::build(entities);
+    QCOMPARE(snapshot->getNumEntities(), entities.size());
+
+    for (int i = 0; i < 50; ++i) {
+        AABox box(glm::vec3((float)(i % 7), (float)(i % 11), (float)(i % 5)) * GRID_SPACING, glm::vec3(1.0f + (float)(i % 9)));
+        QCOMPARE(findInBox(snapshot, box), bruteForceInBox(entities, box));
+    }
+
+    AABox everything(glm::vec3(-10.0f), glm::vec3(GRID_SIZE * GRID_SPACING + 20.0f));
+    QCOMPARE(findInBox(snapshot, everything), toSet(entities));
+    QVERIFY(findInBox(snapshot, AABox(glm::vec3(-100.0f), 1.0f)).isEmpty());
+}
+
+void EntityBoundsSnapshotTests::sphereQueries() {
+    auto entities = createEntities();
+    auto snapshot = EntityBoundsSnapshot::build(entities);
+
+    for (int i = 0; i < 50; ++i) {
+        glm::vec3 center = glm::vec3((float)(i % 13), (float)(i % 3), (float)(i % 7)) * GRID_SPACING;
+        float radius = 0.5f + (float)(i % 6);
+
+        QSet<EntityItemID> found;
+        snapshot->forEachEntityTouchingSphere(center, radius, [&](const EntityItemPointer& entity) {
+            found.insert(entity->getEntityItemID());
+        });
+
+        // the snapshot is a broadphase, it hands out at least every entity whose bounds overlap the sphere
+        for (auto& entity : entities) {
+            bool success;
+            glm::vec3 penetration;
+            if (entity->getAABox(success).findSpherePenetration(center, radius, penetration)) {
+                QVERIFY(found.contains(entity->getEntityItemID()));
+            }
+        }
+    }
+}
+
+void EntityBoundsSnapshotTests::rayQueries() {
+    auto entities = createEntities();
+    auto snapshot = EntityBoundsSnapshot::build(entities);
+
+    for (int i = 0; i < 50; ++i) {
+        glm::vec3 origin = glm::vec3(-5.0f, (float)(i % GRID_SIZE) * GRID_SPACING, (float)((i * 7) % GRID_SIZE) * GRID_SPACING);
+        glm::vec3 direction = glm::normalize(glm::vec3(1.0f, 0.01f * (float)(i % 5), -0.01f * (float)(i % 3)));
+
+        // closest hit of the bounds, found with the pruning the visitor return value allows
+        float closestDistance = FLT_MAX;
+        EntityItemID closestID;
+        snapshot->forEachEntityOnRay(origin, direction, FLT_MAX, [&](const EntityItemPointer& entity, float distance) {
+            if (distance < closestDistance) {
+                closestDistance = distance;
+                closestID = entity->getEntityItemID();
+            }
+            return closestDistance;
+        });
+
+        float expectedDistance = FLT_MAX;
+        for (auto& entity : entities) {
+            bool success;
+            AABox box = entity->getAABox(success);
+            float distance;
+            BoxFace face;
+            glm::vec3 normal;
+            if (box.findRayIntersection(origin, direction, 1.0f / direction, distance, face, normal)) {
+                expectedDistance = std::min(expectedDistance, distance);
+            }
+        }
+
+        QCOMPARE(closestID.isNull(), expectedDistance == FLT_MAX);
+        if (!closestID.isNull()) {
+            QVERIFY(fabsf(closestDistance - expectedDistance) < 0.001f);
+        }
+    }
+}
+
+void EntityBoundsSnapshotTests::update() {
+    auto entities = createEntities();
+    auto snapshot = EntityBoundsSnapshot::build(entities);
+
+    // moving one entity refits the hierarchy
+    EntityItemPointer moved = entities[0];
+    glm::vec3 farAway(1000.0f);
+    moved->setWorldPosition(farAway);
+    auto movedSnapshot = snapshot->update({ moved }, {});
+    QVERIFY(findInBox(movedSnapshot, AABox(farAway - glm::vec3(5.0f), 10.0f)).contains(moved->getEntityItemID()));
+    QVERIFY(!findInBox(movedSnapshot, AABox(glm::vec3(-1.0f), 2.0f)).contains(moved->getEntityItemID()));
+
+    // the old snapshot didn't change
+    QVERIFY(findInBox(snapshot, AABox(farAway - glm::vec3(5.0f), 10.0f)).isEmpty());
+
+    // removing and adding
+    EntityItemPointer removed = entities[1];
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setPosition(glm::vec3(-50.0f));
+    properties.setDimensions(glm::vec3(1.0f));
+    EntityItemPointer added = EntityTypes::constructEntityItem(EntityTypes::Box, QUuid::createUuid(), properties);
+
+    auto editedSnapshot = movedSnapshot->update({ added }, { removed->getEntityItemID() });
+    QCOMPARE(editedSnapshot->getNumEntities(), entities.size());
+
+    AABox everything(glm::vec3(-2000.0f), 4000.0f);
+    QSet<EntityItemID> expected = toSet(entities);
+    expected.remove(removed->getEntityItemID());
+    expected.insert(added->getEntityItemID());
+    QCOMPARE(findInBox(editedSnapshot, everything), expected);
+}
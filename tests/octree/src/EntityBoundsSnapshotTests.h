@@ -0,0 +1,26 @@
+//
+//  EntityBoundsSnapshotTests.h
+//  tests/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityBoundsSnapshotTests_h
+#define hifi_EntityBoundsSnapshotTests_h
+
+#include <QtTest/QtTest>
+
+class EntityBoundsSnapshotTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void boxQueries();
+    void sphereQueries();
+    void rayQueries();
+    void update();
+};
+
+#endif // hifi_EntityBoundsSnapshotTests_h
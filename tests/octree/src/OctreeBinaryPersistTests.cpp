@@ -0,0 +1,110 @@
+//
+//  OctreeBinaryPersistTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeBinaryPersistTests.h"
+
+#include <OctreeBinaryPersist.h>
+#include <OctreeDataUtils.h>
+
+QTEST_MAIN(OctreeBinaryPersistTests)
+
+using namespace OctreeUtils;
+
+// enough items of growing size to span several chunks
+static const int NUM_TEST_ITEMS = 500;
+
+static QByteArray testItem(int index) {
+    return QByteArray(index, (char)index);
+}
+
+static QByteArray writeTestData(const QUuid& id, int64_t dataVersion) {
+    BinaryPersistWriter writer(id, dataVersion, PacketType::EntityData);
+    for (int i = 0; i < NUM_TEST_ITEMS; ++i) {
+        writer.appendItem(testItem(i));
+    }
+    return writer.finish();
+}
+
+void OctreeBinaryPersistTests::roundTrip() {
+    QUuid id = QUuid::createUuid();
+    QByteArray data = writeTestData(id, 42);
+    QVERIFY(data.size() > BINARY_PERSIST_CHUNK_SIZE);
+    QVERIFY(isBinaryPersistData(data));
+
+    BinaryPersistReader reader(data.constData(), data.size());
+    QVERIFY(reader.isValid());
+    QCOMPARE(reader.getID(), id);
+    QCOMPARE(reader.getDataVersion(), (int64_t)42);
+    QCOMPARE(reader.getDataPacketType(), PacketType::EntityData);
+
+    int numItems = 0;
+    bool isComplete = reader.forEachItem([&](const char* itemData, int size) {
+        // stopping the visit on a mismatch fails the completeness check below
+        return QByteArray(itemData, size) == testItem(numItems++);
+    });
+    QVERIFY(isComplete);
+    QCOMPARE(numItems, NUM_TEST_ITEMS);
+
+    // the persist thread reads the id and version from the header alone
+    RawOctreeData info;
+    QVERIFY(info.readOctreeDataInfoFromData(data.left(BINARY_PERSIST_HEADER_SIZE)));
+    QCOMPARE(info.id, id);
+    QCOMPARE(info.dataVersion, (Version)42);
+}
+
+void OctreeBinaryPersistTests::truncatedData() {
+    QByteArray data = writeTestData(QUuid::createUuid(), 1);
+    data.chop(1);
+
+    BinaryPersistReader reader(data.constData(), data.size());
+    QVERIFY(reader.isValid());
+
+    int numItems = 0;
+    bool isComplete = reader.forEachItem([&](const char* itemData, int size) {
+        ++numItems;
+        return true;
+    });
+    QVERIFY(!isComplete);
+    QVERIFY(numItems < NUM_TEST_ITEMS);
+}
+
+void OctreeBinaryPersistTests::otherVersion() {
+    QByteArray data = writeTestData(QUuid::createUuid(), 1);
+
+    // the data packet version follows the magic, the format version and the data packet type
+    data[7] = (char)(versionForPacketType(PacketType::EntityData) + 1);
+
+    QVERIFY(isBinaryPersistData(data));
+    BinaryPersistReader reader(data.constData(), data.size());
+    QVERIFY(!reader.isValid());
+
+    RawOctreeData info;
+    QVERIFY(!info.readOctreeDataInfoFromData(data));
+}
+
+void OctreeBinaryPersistTests::journalRecords() {
+    QUuid id = QUuid::createUuid();
+    QByteArray snapshotData = writeTestData(id, 10);
+    BinaryPersistReader snapshot(snapshotData.constData(), snapshotData.size());
+
+    // left over from before the snapshot, then two records on top of it, one for other content and a torn one
+    QByteArray journalData;
+    journalData += toBinaryPersistJournalRecord(writeTestData(id, 9));
+    journalData += toBinaryPersistJournalRecord(writeTestData(id, 11));
+    journalData += toBinaryPersistJournalRecord(writeTestData(QUuid::createUuid(), 12));
+    journalData += toBinaryPersistJournalRecord(writeTestData(id, 13));
+    journalData += toBinaryPersistJournalRecord(writeTestData(id, 14)).chopped(1);
+
+    auto journal = readBinaryPersistJournal(journalData.constData(), journalData.size(), snapshot);
+    QCOMPARE((int)journal.size(), 2);
+    QCOMPARE(journal[0].getDataVersion(), (int64_t)11);
+    QCOMPARE(journal[1].getDataVersion(), (int64_t)13);
+    QVERIFY(journal[1].forEachItem([](const char* itemData, int size) { return true; }));
+}
@@ -0,0 +1,26 @@
+//
+//  OctreeBinaryPersistTests.h
+//  tests/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeBinaryPersistTests_h
+#define hifi_OctreeBinaryPersistTests_h
+
+#include <QtTest/QtTest>
+
+class OctreeBinaryPersistTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void roundTrip();
+    void truncatedData();
+    void otherVersion();
+    void journalRecords();
+};
+
+#endif // hifi_OctreeBinaryPersistTests_h
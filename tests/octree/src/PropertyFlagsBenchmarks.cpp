@@ -0,0 +1,115 @@
+//
+//  PropertyFlagsBenchmarks.cpp
+//  tests/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PropertyFlagsBenchmarks.h"
+
+#include <random>
+
+#include <ByteCountCoding.h>
+#include <EntityPropertyFlags.h>
+#include <NumericalConstants.h>
+
+QTEST_MAIN(PropertyFlagsBenchmarks)
+
+static const int NUM_FLAGS_SETS = 1024;
+static const int NUM_PASSES = 200;
+
+// sets of flags picked among the first numProperties entity properties
+static std::vector<EntityPropertyFlags> createFlagsSets(int numFlags, int numProperties) {
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<int> property(PROP_PAGED_PROPERTY + 1, numProperties - 1);
+
+    std::vector<EntityPropertyFlags> flagsSets(NUM_FLAGS_SETS);
+    for (auto& flags : flagsSets) {
+        for (int i = 0; i < numFlags; ++i) {
+            flags += (EntityPropertyList)property(generator);
+        }
+    }
+    return flagsSets;
+}
+
+void PropertyFlagsBenchmarks::encodeDecode_data() {
+    QTest::addColumn<int>("numFlags");
+    QTest::addColumn<int>("numProperties");
+    QTest::newRow("transform edit") << 4 << (int)PROP_VELOCITY;
+    QTest::newRow("typical edit") << 16 << (int)PROP_AFTER_LAST_ITEM;
+    QTest::newRow("all properties") << (int)PROP_AFTER_LAST_ITEM << (int)PROP_AFTER_LAST_ITEM;
+}
+
+void PropertyFlagsBenchmarks::encodeDecode() {
+    QFETCH(int, numFlags);
+    QFETCH(int, numProperties);
+
+    auto flagsSets = createFlagsSets(numFlags, numProperties);
+    for (auto& flags : flagsSets) {
+        EntityPropertyFlags decoded(flags.encode());
+        QCOMPARE(decoded, flags);
+    }
+
+    QElapsedTimer timer;
+    int numEncodedBytes = 0;
+    timer.start();
+    for (int pass = 0; pass < NUM_PASSES; ++pass) {
+        for (auto& flags : flagsSets) {
+            EntityPropertyFlags decoded;
+            numEncodedBytes += (int)decoded.decode(flags.encode());
+        }
+    }
+    double encodeSeconds = timer.nsecsElapsed() / (double)NSECS_PER_SECOND;
+
+    // what is left to send once the properties that were appended are taken out
+    EntityPropertyFlags requested;
+    for (int property = PROP_PAGED_PROPERTY + 1; property < numProperties; ++property) {
+        requested += (EntityPropertyList)property;
+    }
+    int numLeft = 0;
+    timer.restart();
+    for (int pass = 0; pass < NUM_PASSES; ++pass) {
+        for (const auto& flags : flagsSets) {
+            EntityPropertyFlags didntFit = requested;
+            didntFit -= flags;
+            numLeft += didntFit.getHasProperty(PROP_POSITION) ? 1 : 0;
+            numLeft += (didntFit & flags) == flags ? 1 : 0;
+        }
+    }
+    double combineSeconds = timer.nsecsElapsed() / (double)NSECS_PER_SECOND;
+
+    // also keeps the timed loops from being optimized away
+    QVERIFY(numEncodedBytes > 0 && numLeft >= 0);
+
+    double numSets = (double)NUM_PASSES * NUM_FLAGS_SETS;
+    qDebug() << numFlags << "flags:" << numSets / encodeSeconds << "encoded and decoded per second,"
+        << numSets / combineSeconds << "combined";
+}
+
+void PropertyFlagsBenchmarks::byteCountCoding() {
+    std::mt19937 generator(17);
+    std::vector<quint64> values(NUM_FLAGS_SETS);
+    for (auto& value : values) {
+        // the sizes and times that are sent, from a few bits to most of them
+        value = ((quint64)generator() << 32 | generator()) >> (generator() % 64);
+        ByteCountCoded<quint64> decoded(ByteCountCoded<quint64>(value).encode());
+        QCOMPARE(decoded.data, value);
+    }
+
+    QElapsedTimer timer;
+    quint64 sum = 0;
+    timer.start();
+    for (int pass = 0; pass < NUM_PASSES; ++pass) {
+        for (auto value : values) {
+            ByteCountCoded<quint64> decoded(ByteCountCoded<quint64>(value).encode());
+            sum += decoded.data;
+        }
+    }
+    double seconds = timer.nsecsElapsed() / (double)NSECS_PER_SECOND;
+    QVERIFY(sum != 0);
+
+    qDebug() << (double)NUM_PASSES * NUM_FLAGS_SETS / seconds << "ByteCountCoded<quint64> encoded and decoded per second";
+}
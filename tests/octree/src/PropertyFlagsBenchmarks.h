@@ -0,0 +1,26 @@
+//
+//  PropertyFlagsBenchmarks.h
+//  tests/octree/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PropertyFlagsBenchmarks_h
+#define hifi_PropertyFlagsBenchmarks_h
+
+#include <QtTest/QtTest>
+
+// EntityPropertyFlags encoded, decoded and combined per second, the way an entity server does for each entity it
+// sends, for edits of a few flags up to all of the entity properties.
+class PropertyFlagsBenchmarks : public QObject {
+    Q_OBJECT
+private slots:
+    void encodeDecode_data();
+    void encodeDecode();
+    void byteCountCoding();
+};
+
+#endif // hifi_PropertyFlagsBenchmarks_h
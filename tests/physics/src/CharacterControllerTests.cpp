@@ -0,0 +1,138 @@
+//
+//  CharacterControllerTests.cpp
+//  tests/physics/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "CharacterControllerTests.h"
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QElapsedTimer>
+
+#include <CharacterController.h>
+#include <PhysicsCollisionGroups.h>
+#include <PhysicsEngine.h>
+#include <PhysicsHelpers.h>
+#include <ThreadSafeDynamicsWorld.h>
+
+QTEST_MAIN(CharacterControllerTests)
+
+// a capsule hull, like the one of MyCharacterController
+class TestCharacterController : public CharacterController {
+public:
+    ~TestCharacterController() {
+        if (_rigidBody) {
+            removeFromWorld();
+            delete _rigidBody->getCollisionShape();
+            delete _rigidBody;
+            _rigidBody = nullptr;
+        }
+    }
+
+    void updateShapeIfNecessary() override {
+        if (!(_pendingFlags & PENDING_FLAG_UPDATE_SHAPE) || _rigidBody) {
+            return;
+        }
+        _pendingFlags &= ~PENDING_FLAG_UPDATE_SHAPE;
+
+        const int NUM_RINGS = 4;
+        const int NUM_POINTS_PER_RING = 8;
+        btConvexHullShape* shape = new btConvexHullShape();
+        for (float end : { -1.0f, 1.0f }) {
+            btVector3 center(0.0f, end * _halfHeight, 0.0f);
+            shape->addPoint(center + btVector3(0.0f, end * _radius, 0.0f), false);
+            for (int i = 0; i < NUM_RINGS; ++i) {
+                float elevation = (float)i / (float)NUM_RINGS * 0.5f * PI;
+                for (int j = 0; j < NUM_POINTS_PER_RING; ++j) {
+                    float azimuth = (float)j / (float)NUM_POINTS_PER_RING * TWO_PI;
+                    btVector3 direction(cosf(elevation) * cosf(azimuth), end * sinf(elevation), cosf(elevation) * sinf(azimuth));
+                    shape->addPoint(center + _radius * direction, false);
+                }
+            }
+        }
+        shape->recalcLocalAabb();
+
+        _rigidBody = new btRigidBody(1.0f, nullptr, shape, btVector3(1.0f, 1.0f, 1.0f));
+        _rigidBody->setSleepingThresholds(0.0f, 0.0f);
+        _rigidBody->setAngularFactor(0.0f);
+        _rigidBody->setWorldTransform(btTransform(_rotation, _position));
+        _rigidBody->setDamping(0.0f, 0.0f);
+    }
+
+    int32_t computeCollisionMask() const override { return BULLET_COLLISION_MASK_MY_AVATAR; }
+    void handleChangedCollisionMask() override { }
+
+protected:
+    void updateMassProperties() override { }
+};
+
+void CharacterControllerTests::benchmarkFloorQueries() {
+    auto physicsEngine = std::make_shared<PhysicsEngine>(glm::vec3(0.0f));
+    physicsEngine->init();
+    ThreadSafeDynamicsWorld* world = static_cast<ThreadSafeDynamicsWorld*>(physicsEngine->getDynamicsWorld());
+
+    btBoxShape floorShape(btVector3(100.0f, 0.5f, 100.0f));
+    btRigidBody floor(0.0f, nullptr, &floorShape);
+    floor.setWorldTransform(btTransform(btQuaternion::getIdentity(), btVector3(0.0f, -0.5f, 0.0f)));
+    world->addRigidBody(&floor, BULLET_COLLISION_GROUP_STATIC, BULLET_COLLISION_MASK_STATIC);
+
+    // boxes away from the character, they make the manifolds of the world outnumber those of the character
+    const int NUM_BOXES_PER_ROW = 20;
+    const float BOX_HALF_EXTENT = 0.25f;
+    btBoxShape boxShape(btVector3(BOX_HALF_EXTENT, BOX_HALF_EXTENT, BOX_HALF_EXTENT));
+    btVector3 boxInertia;
+    boxShape.calculateLocalInertia(1.0f, boxInertia);
+    std::vector<std::unique_ptr<btRigidBody>> boxes;
+    for (int i = 0; i < NUM_BOXES_PER_ROW; ++i) {
+        for (int j = 0; j < NUM_BOXES_PER_ROW; ++j) {
+            btVector3 position(10.0f + (float)i, BOX_HALF_EXTENT, 10.0f + (float)j);
+            boxes.emplace_back(new btRigidBody(1.0f, nullptr, &boxShape, boxInertia));
+            boxes.back()->setWorldTransform(btTransform(btQuaternion::getIdentity(), position));
+            world->addRigidBody(boxes.back().get(), BULLET_COLLISION_GROUP_DYNAMIC, BULLET_COLLISION_MASK_DYNAMIC);
+        }
+    }
+
+    // an avatar 1.8m tall standing still at the origin
+    TestCharacterController character;
+    const glm::vec3 AVATAR_DIMENSIONS(0.5f, 1.8f, 0.5f);
+    character.setLocalBoundingBox(-0.5f * AVATAR_DIMENSIONS, AVATAR_DIMENSIONS);
+    character.setPhysicsEngine(physicsEngine);
+    physicsEngine->setCharacterController(&character);
+    const glm::vec3 AVATAR_POSITION(0.0f, 0.5f * AVATAR_DIMENSIONS.y, 0.0f);
+
+    const int NUM_FRAMES = 900;
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < NUM_FRAMES; ++i) {
+        character.setPositionAndOrientation(AVATAR_POSITION, glm::quat());
+        character.preSimulation();
+        world->stepSimulationWithSubstepCallback(PHYSICS_ENGINE_FIXED_SUBSTEP, 1, PHYSICS_ENGINE_FIXED_SUBSTEP);
+        character.postSimulation();
+    }
+    float seconds = (float)timer.nsecsElapsed() / (float)NSECS_PER_SECOND;
+
+    const CharacterController::QueryStats& stats = character.getQueryStats();
+    uint32_t numQueries = stats.numRayTests + stats.numReusedRayTests;
+    qDebug() << "floor queries:" << numQueries << "in" << seconds << "seconds," << (float)numQueries / seconds << "per second";
+    qDebug() << "ray tests:" << stats.numRayTests << "reused:" << stats.numReusedRayTests
+        << "manifolds checked:" << stats.numManifolds << "of" << world->getDispatcher()->getNumManifolds() << "per substep";
+
+    QVERIFY(character.onGround());
+    // standing still, the floor scans of the substeps answer one another
+    QVERIFY(stats.numReusedRayTests > 0);
+    // only the manifold of the floor is checked, not those of the boxes
+    QVERIFY(stats.numManifolds <= (uint32_t)NUM_FRAMES);
+
+    physicsEngine->setCharacterController(nullptr);
+    character.removeFromWorld();
+    for (auto& box : boxes) {
+        world->removeRigidBody(box.get());
+    }
+    world->removeRigidBody(&floor);
+}
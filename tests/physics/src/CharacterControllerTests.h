@@ -0,0 +1,23 @@
+//
+//  CharacterControllerTests.h
+//  tests/physics/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_CharacterControllerTests_h
+#define hifi_CharacterControllerTests_h
+
+#include <QtTest/QtTest>
+
+class CharacterControllerTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void benchmarkFloorQueries();
+};
+
+#endif // hifi_CharacterControllerTests_h
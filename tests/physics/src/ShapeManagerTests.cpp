@@ -244,3 +244,29 @@ void ShapeManagerTests::addCompoundShape() {
     QCOMPARE(shapeManager.getNumShapes(), 0);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
 }
+
+void ShapeManagerTests::shapeCacheKeys() {
+    // two versions of the same model, one triangle of which has moved
+    ShapeInfo::PointCollection pointCollection;
+    pointCollection.push_back({ glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f) });
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_STATIC_MESH, glm::vec3(1.0f), "http://example.com/model.fbx");
+    info.setPointCollection(pointCollection);
+    info.getTriangleIndices() = { 0, 1, 2 };
+
+    pointCollection[0][2] = glm::vec3(0.0f, 0.5f, 0.0f);
+    ShapeInfo changedInfo;
+    changedInfo.setParams(SHAPE_TYPE_STATIC_MESH, glm::vec3(1.0f), "http://example.com/model.fbx");
+    changedInfo.setPointCollection(pointCollection);
+    changedInfo.getTriangleIndices() = { 0, 1, 2 };
+
+    // the session keys leave the points of meshes out, the keys of the shape cache don't
+    QCOMPARE(changedInfo.getHash(), info.getHash());
+    QVERIFY(CollisionShapeCache::getShapeKey(changedInfo) != CollisionShapeCache::getShapeKey(info));
+
+    ShapeInfo sameInfo;
+    sameInfo.setParams(SHAPE_TYPE_STATIC_MESH, glm::vec3(1.0f), "http://example.com/other.fbx");
+    sameInfo.setPointCollection(pointCollection);
+    sameInfo.getTriangleIndices() = { 0, 1, 2 };
+    QCOMPARE(CollisionShapeCache::getShapeKey(sameInfo), CollisionShapeCache::getShapeKey(changedInfo));
+}
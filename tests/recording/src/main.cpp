@@ -29,6 +29,7 @@
 
 #include <recording/Clip.h>
 #include <recording/Frame.h>
+#include <recording/impl/PointerClip.h>
 
 #include <SharedUtil.h>
 
@@ -101,6 +102,46 @@ void testFilePersist() {
     QVERIFY(readClip->duration() == 5.0f);
 }
 
+void testFileIndex() {
+    QTemporaryFile file;
+    QString fileName;
+    if (file.open()) {
+        fileName = file.fileName();
+        file.close();
+    }
+
+    const int NUM_FRAMES = 1000;
+    auto writeClip = Clip::newClip();
+    for (int i = 0; i < NUM_FRAMES; ++i) {
+        writeClip->addFrame(std::make_shared<Frame>(TEST_FRAME_TYPE, (float)i / 90.0f, QByteArray(i % 100, (char)i)));
+    }
+    Clip::toFile(fileName, writeClip);
+
+    auto verifyClip = [&](const Clip::Pointer& readClip) {
+        QVERIFY(readClip != Clip::Pointer());
+        QVERIFY(readClip->frameCount() == (size_t)NUM_FRAMES);
+        readClip->seek(5.0f);
+        writeClip->seek(5.0f);
+        QVERIFY(readClip->position() == writeClip->position());
+        for (auto readFrame = readClip->nextFrame(), writeFrame = writeClip->nextFrame(); readFrame || writeFrame;
+            readFrame = readClip->nextFrame(), writeFrame = writeClip->nextFrame()) {
+            QVERIFY(readFrame && writeFrame);
+            QVERIFY(readFrame->type == writeFrame->type);
+            QVERIFY(readFrame->timeOffset == writeFrame->timeOffset);
+            QVERIFY(readFrame->data == writeFrame->data);
+        }
+    };
+    verifyClip(Clip::fromFile(fileName));
+
+    // without the index the file reads as it was written before there was one
+    {
+        QFile indexedFile(fileName);
+        auto indexSize = (NUM_FRAMES + 2) * PointerClip::FRAME_INDEX_ENTRY_SIZE;
+        QVERIFY(indexedFile.resize(indexedFile.size() - indexSize));
+    }
+    verifyClip(Clip::fromFile(fileName));
+}
+
 void testClipOrdering() {
     auto writeClip = Clip::newClip();
     // simulate our of order addition of frames
@@ -124,5 +165,6 @@ int main(int, const char**) {
 
     testFrameTypeRegistration();
     testFilePersist();
+    testFileIndex();
     testClipOrdering();
 }
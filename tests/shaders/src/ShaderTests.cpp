@@ -514,3 +514,28 @@ void ShaderTests::testShaderLoad() {
 
     qDebug() << "Completed all shaders";
 }
+
+void ShaderTests::testBinaryReflection() {
+    // the reflection that shadergen wrote at build time has to agree with the JSON it was written from
+    for (auto shaderId : shader::allShaders()) {
+        const auto& shader = shader::Source::get(shaderId);
+        for (const auto& dialectEntry : shader.dialectSources) {
+            for (const auto& variantEntry : dialectEntry.second.variantSources) {
+                std::string basePath = std::string(":/shaders/") + std::to_string(shaderId) +
+                    shader::dialectPath(dialectEntry.first);
+                if (variantEntry.first == shader::Variant::Stereo) {
+                    basePath += "stereo/";
+                }
+                shader::Reflection jsonReflection;
+                jsonReflection.parse(FileUtils::readFile((basePath + "json").c_str()).toStdString());
+
+                const auto& reflection = variantEntry.second.reflection;
+                QVERIFY2(reflection.inputs == jsonReflection.inputs, shader.name.c_str());
+                QVERIFY2(reflection.outputs == jsonReflection.outputs, shader.name.c_str());
+                QVERIFY2(reflection.textures == jsonReflection.textures, shader.name.c_str());
+                QVERIFY2(reflection.uniformBuffers == jsonReflection.uniformBuffers, shader.name.c_str());
+                QVERIFY2(reflection.resourceBuffers == jsonReflection.resourceBuffers, shader.name.c_str());
+            }
+        }
+    }
+}
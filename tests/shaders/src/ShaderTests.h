@@ -21,6 +21,7 @@ private slots:
     void initTestCase();
     void cleanupTestCase();
     void testShaderLoad();
+    void testBinaryReflection();
 
 private:
     gl::OffscreenContext* _context{ nullptr };
@@ -0,0 +1,60 @@
+//
+//  BlockPoolTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BlockPoolTests.h"
+
+#include <vector>
+
+#include <shared/BlockPool.h>
+
+QTEST_MAIN(BlockPoolTests)
+
+void BlockPoolTests::testAllocatesFromSlabs() {
+    const size_t BLOCKS_PER_SLAB = 4;
+    BlockPool blockPool { 20, BLOCKS_PER_SLAB };
+    QVERIFY(blockPool.getBlockSize() >= 20);
+    QCOMPARE(blockPool.getBlockSize() % alignof(std::max_align_t), (size_t)0);
+
+    std::vector<char*> blocks;
+    for (size_t i = 0; i < BLOCKS_PER_SLAB; ++i) {
+        blocks.push_back(static_cast<char*>(blockPool.allocate()));
+    }
+    QCOMPARE(blockPool.getNumBlocks(), BLOCKS_PER_SLAB);
+    QCOMPARE(blockPool.getNumBytes(), BLOCKS_PER_SLAB * blockPool.getBlockSize());
+
+    // the blocks of a slab follow each other
+    for (size_t i = 1; i < BLOCKS_PER_SLAB; ++i) {
+        QCOMPARE((size_t)(blocks[i] - blocks[i - 1]), blockPool.getBlockSize());
+    }
+
+    blocks.push_back(static_cast<char*>(blockPool.allocate()));
+    QCOMPARE(blockPool.getNumBytes(), 2 * BLOCKS_PER_SLAB * blockPool.getBlockSize());
+
+    for (auto block : blocks) {
+        blockPool.release(block);
+    }
+    QCOMPARE(blockPool.getNumBlocks(), (size_t)0);
+}
+
+void BlockPoolTests::testReusesReleasedBlocks() {
+    BlockPool blockPool { 64, 8 };
+    void* first = blockPool.allocate();
+    void* second = blockPool.allocate();
+    blockPool.release(first);
+
+    QCOMPARE(blockPool.allocate(), first);
+    QCOMPARE(blockPool.getNumBlocks(), (size_t)2);
+    QCOMPARE(blockPool.getNumBytes(), 8 * blockPool.getBlockSize());
+
+    blockPool.release(first);
+    blockPool.release(second);
+    blockPool.release(nullptr);
+    QCOMPARE(blockPool.getNumBlocks(), (size_t)0);
+}
@@ -0,0 +1,23 @@
+//
+//  BlockPoolTests.h
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BlockPoolTests_h
+#define hifi_BlockPoolTests_h
+
+#include <QtTest/QtTest>
+
+class BlockPoolTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testAllocatesFromSlabs();
+    void testReusesReleasedBlocks();
+};
+
+#endif // hifi_BlockPoolTests_h
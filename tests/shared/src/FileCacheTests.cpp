@@ -145,6 +145,18 @@ void FileCacheTests::testFreeSpacePreservation() {
     }
 }
 
+void FileCacheTests::testInitializeAsync() {
+    // The files are restored on another thread, getting one waits for them
+    auto cache = std::make_shared<FileCache>(_testDir.path().toStdString(), "tmp");
+    cache->initializeAsync();
+    for (int i = 95; i < 100; ++i) {
+        std::string key = getFileKey(i);
+        auto file = cache->getFile(key);
+        QVERIFY(file.get());
+    }
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)5);
+}
+
 void FileCacheTests::testWipe() {
     // Reset the cache
     auto cache = makeFileCache(_testDir.path());
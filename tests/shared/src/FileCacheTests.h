@@ -19,6 +19,7 @@ private slots:
     void initTestCase();
     void testUnusedFiles();
     void testFreeSpacePreservation();
+    void testInitializeAsync();
     void cleanupTestCase();
     void testWipe();
 
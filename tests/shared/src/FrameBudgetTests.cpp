@@ -0,0 +1,95 @@
+//
+//  FrameBudgetTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameBudgetTests.h"
+
+#include <NumericalConstants.h>
+#include <shared/FrameBudget.h>
+
+QTEST_MAIN(FrameBudgetTests)
+
+static const uint64_t LONG_BUDGET = 10 * USECS_PER_SECOND;
+
+void FrameBudgetTests::testHasTime() {
+    FrameBudget frameBudget;
+    QVERIFY(frameBudget.hasTime());
+
+    frameBudget.beginFrame(LONG_BUDGET);
+    QVERIFY(frameBudget.hasTime());
+    frameBudget.endFrame();
+
+    frameBudget.beginFrame(0);
+    QVERIFY(!frameBudget.hasTime());
+    frameBudget.endFrame();
+
+    // outside of a frame nothing waits
+    QVERIFY(frameBudget.hasTime());
+}
+
+void FrameBudgetTests::testCarryOver() {
+    FrameBudget frameBudget;
+    QObject context;
+    QList<int> ran;
+    for (int i = 0; i < 3; ++i) {
+        frameBudget.defer(FrameBudget::SCRIPT_EVENT, &context, [&ran, i] { ran << i; });
+    }
+
+    // a frame with no time left still runs one piece of the work
+    frameBudget.beginFrame(0);
+    frameBudget.runDeferred();
+    frameBudget.endFrame();
+    QCOMPARE(ran, QList<int>({ 0 }));
+    QCOMPARE(frameBudget.getNumDeferred(), (size_t)2);
+
+    // the work deferred while deferred work runs waits for the next frame
+    frameBudget.defer(FrameBudget::SCRIPT_EVENT, &context, [&] {
+        frameBudget.defer(FrameBudget::SCRIPT_EVENT, &context, [&ran] { ran << 4; });
+        ran << 3;
+    });
+
+    frameBudget.beginFrame(LONG_BUDGET);
+    frameBudget.runDeferred();
+    frameBudget.endFrame();
+    QCOMPARE(ran, QList<int>({ 0, 1, 2, 3 }));
+
+    frameBudget.beginFrame(LONG_BUDGET);
+    frameBudget.runDeferred();
+    frameBudget.endFrame();
+    QCOMPARE(ran, QList<int>({ 0, 1, 2, 3, 4 }));
+    QCOMPARE(frameBudget.getNumDeferred(), (size_t)0);
+}
+
+void FrameBudgetTests::testDestroyedContext() {
+    FrameBudget frameBudget;
+    bool ran = false;
+    {
+        QObject context;
+        frameBudget.defer(FrameBudget::RESOURCE_FINISHED, &context, [&ran] { ran = true; });
+    }
+    frameBudget.runDeferred();
+    QVERIFY(!ran);
+    QCOMPARE(frameBudget.getNumDeferred(), (size_t)0);
+}
+
+void FrameBudgetTests::testDeferredCounts() {
+    FrameBudget frameBudget;
+    QObject context;
+    frameBudget.defer(FrameBudget::RESOURCE_FINISHED, &context, [] {});
+    frameBudget.countDeferred(FrameBudget::ENTITY_ADD, 5);
+    frameBudget.countDeferred(FrameBudget::ENTITY_ADD);
+
+    QCOMPARE(frameBudget.getDeferredCount(FrameBudget::ENTITY_ADD), (uint64_t)6);
+    QCOMPARE(frameBudget.getDeferredCount(FrameBudget::RESOURCE_FINISHED), (uint64_t)1);
+    QCOMPARE(frameBudget.getDeferredCount(FrameBudget::SCRIPT_EVENT), (uint64_t)0);
+
+    // running the work doesn't change how much was deferred
+    frameBudget.runDeferred();
+    QCOMPARE(frameBudget.getDeferredCount(FrameBudget::RESOURCE_FINISHED), (uint64_t)1);
+}
@@ -0,0 +1,25 @@
+//
+//  FrameBudgetTests.h
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_FrameBudgetTests_h
+#define hifi_FrameBudgetTests_h
+
+#include <QtTest/QtTest>
+
+class FrameBudgetTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testHasTime();
+    void testCarryOver();
+    void testDestroyedContext();
+    void testDeferredCounts();
+};
+
+#endif // hifi_FrameBudgetTests_h
@@ -105,6 +105,54 @@ void GLMHelpersTests::testSixByteOrientationCompression() {
     testQuatCompression(-(ROT_Z_30 * ROT_X_90 * ROT_Y_180));
 }
 
+void GLMHelpersTests::testDeltaCompression() {
+    const float ROTATION_RANGE = 0.0625f;
+    const float TRANSLATION_RANGE = 0.0635f;
+    // half a quantization step per component, times a little slack for the rotation product
+    const float MAX_ROTATION_ERROR = 2.0f * ROTATION_RANGE / 127.0f;
+    const float MAX_TRANSLATION_ERROR = 0.5f * TRANSLATION_RANGE / 127.0f + EPSILON;
+
+    const glm::quat ROT_X_90 = glm::angleAxis(PI / 2.0f, glm::vec3(1.0f, 0.0f, 0.0f));
+    const glm::quat SMALL_ROT = glm::angleAxis(PI / 60.0f, glm::normalize(glm::vec3(1.0f, 2.0f, -1.0f)));
+    const glm::quat LARGE_ROT = glm::angleAxis(PI / 6.0f, glm::vec3(0.0f, 1.0f, 0.0f));
+
+    uint8_t bytes[3];
+    glm::quat q;
+
+    // small deltas pack into three bytes, in either hemisphere
+    QCOMPARE(packOrientationQuatDeltaToThreeBytes(bytes, ROT_X_90, ROT_X_90 * SMALL_ROT, ROTATION_RANGE), 3);
+    unpackOrientationQuatDeltaFromThreeBytes(bytes, ROT_X_90, q, ROTATION_RANGE);
+    QCOMPARE_WITH_ABS_ERROR(fabsf(glm::dot(q, ROT_X_90 * SMALL_ROT)), 1.0f, MAX_ROTATION_ERROR);
+
+    QCOMPARE(packOrientationQuatDeltaToThreeBytes(bytes, ROT_X_90, -(ROT_X_90 * SMALL_ROT), ROTATION_RANGE), 3);
+    unpackOrientationQuatDeltaFromThreeBytes(bytes, ROT_X_90, q, ROTATION_RANGE);
+    QCOMPARE_WITH_ABS_ERROR(fabsf(glm::dot(q, ROT_X_90 * SMALL_ROT)), 1.0f, MAX_ROTATION_ERROR);
+
+    // large deltas are rejected
+    QCOMPARE(packOrientationQuatDeltaToThreeBytes(bytes, ROT_X_90, ROT_X_90 * LARGE_ROT, ROTATION_RANGE), 0);
+
+    // chained against the reconstructed value, quantization errors don't accumulate
+    glm::quat target = ROT_X_90;
+    glm::quat reconstructed = ROT_X_90;
+    for (int i = 0; i < 100; i++) {
+        target = target * SMALL_ROT;
+        QCOMPARE(packOrientationQuatDeltaToThreeBytes(bytes, reconstructed, target, ROTATION_RANGE), 3);
+        unpackOrientationQuatDeltaFromThreeBytes(bytes, reconstructed, reconstructed, ROTATION_RANGE);
+    }
+    QCOMPARE_WITH_ABS_ERROR(fabsf(glm::dot(reconstructed, target)), 1.0f, MAX_ROTATION_ERROR);
+
+    const glm::vec3 reference(0.1f, -0.2f, 0.3f);
+    const glm::vec3 offset(0.01f, -0.05f, 0.0003f);
+    glm::vec3 v;
+    QCOMPARE(packFloatVec3DeltaToThreeBytes(bytes, reference, reference + offset, TRANSLATION_RANGE), 3);
+    unpackFloatVec3DeltaFromThreeBytes(bytes, reference, v, TRANSLATION_RANGE);
+    QCOMPARE_WITH_ABS_ERROR(v.x, reference.x + offset.x, MAX_TRANSLATION_ERROR);
+    QCOMPARE_WITH_ABS_ERROR(v.y, reference.y + offset.y, MAX_TRANSLATION_ERROR);
+    QCOMPARE_WITH_ABS_ERROR(v.z, reference.z + offset.z, MAX_TRANSLATION_ERROR);
+
+    QCOMPARE(packFloatVec3DeltaToThreeBytes(bytes, reference, reference + glm::vec3(0.0f, 0.1f, 0.0f), TRANSLATION_RANGE), 0);
+}
+
 #define LOOPS 500000
 
 void GLMHelpersTests::testSimd() {
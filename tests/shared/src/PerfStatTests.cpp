@@ -0,0 +1,92 @@
+//
+//  PerfStatTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PerfStatTests.h"
+
+#include <thread>
+
+#include <PerfStat.h>
+
+QTEST_MAIN(PerfStatTests)
+
+void PerfStatTests::init() {
+    PerformanceTimer::setActive(true);
+}
+
+void PerfStatTests::cleanup() {
+    PerformanceTimer::setActive(false);
+}
+
+void PerfStatTests::testNestedScopes() {
+    {
+        PerformanceTimer outerTimer("outer");
+        {
+            PerformanceTimer innerTimer("inner");
+            QCOMPARE(PerformanceTimer::getContextName(), QString("/outer/inner"));
+        }
+        {
+            // the same scope, entered by name
+            PerformanceTimer innerTimer(QString("inner"));
+            QCOMPARE(PerformanceTimer::getContextName(), QString("/outer/inner"));
+        }
+        QCOMPARE(PerformanceTimer::getContextName(), QString("/outer"));
+    }
+    {
+        PerformanceTimer innerTimer("inner");
+    }
+    QCOMPARE(PerformanceTimer::getContextName(), QString());
+
+    PerformanceTimer::tallyAllTimerRecords();
+    auto records = PerformanceTimer::getAllTimerRecords();
+    QCOMPARE(records.size(), 3);
+    QCOMPARE(records.value("/outer").getCount(), (quint64)1);
+    QCOMPARE(records.value("/outer/inner").getCount(), (quint64)1);
+    QCOMPARE(records.value("/inner").getCount(), (quint64)1);
+}
+
+void PerfStatTests::testThreads() {
+    const int NUM_THREADS = 4;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([] {
+            PerformanceTimer outerTimer("thread");
+            PerformanceTimer innerTimer("work");
+        });
+    }
+    {
+        PerformanceTimer timer("thread");
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // the records of the threads that are gone were merged as they ended
+    auto records = PerformanceTimer::getAllTimerRecords();
+    QCOMPARE(records.size(), 2);
+    QVERIFY(records.contains("/thread"));
+    QVERIFY(records.contains("/thread/work"));
+}
+
+void PerfStatTests::testInactive() {
+    {
+        PerformanceTimer timer("dropped");
+        PerformanceTimer::setActive(false);
+    }
+    PerformanceTimer::setActive(true);
+    QCOMPARE(PerformanceTimer::getContextName(), QString());
+    QVERIFY(PerformanceTimer::getAllTimerRecords().isEmpty());
+
+    PerformanceTimer::setActive(false);
+    {
+        PerformanceTimer timer("ignored");
+    }
+    PerformanceTimer::setActive(true);
+    QVERIFY(PerformanceTimer::getAllTimerRecords().isEmpty());
+}
@@ -0,0 +1,26 @@
+//
+//  PerfStatTests.h
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PerfStatTests_h
+#define hifi_PerfStatTests_h
+
+#include <QtTest/QtTest>
+
+class PerfStatTests : public QObject {
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+    void testNestedScopes();
+    void testThreads();
+    void testInactive();
+};
+
+#endif // hifi_PerfStatTests_h
@@ -0,0 +1,150 @@
+//
+//  RegisteredMetaTypesTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "RegisteredMetaTypesTests.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <QtScript/QScriptEngine>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <RegisteredMetaTypes.h>
+
+QTEST_MAIN(RegisteredMetaTypesTests)
+
+static glm::vec3 evaluateVec3(QScriptEngine& engine, const QString& program) {
+    glm::vec3 vec3(-1.0f);
+    vec3FromScriptValue(engine.evaluate(program), vec3);
+    return vec3;
+}
+
+void RegisteredMetaTypesTests::testVec3RoundTrip() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    const glm::vec3 VEC3(1.0f, -2.5f, 3.25f);
+    QScriptValue value = vec3ToScriptValue(&engine, VEC3);
+    QCOMPARE(value.property("x").toNumber(), 1.0);
+    QCOMPARE(value.property("z").toNumber(), 3.25);
+
+    // the accessors of the prototype
+    engine.globalObject().setProperty("v", value);
+    QCOMPARE(engine.evaluate("v.g").toNumber(), -2.5);
+    QCOMPARE(engine.evaluate("v[2]").toNumber(), 3.25);
+
+    glm::vec3 vec3;
+    vec3FromScriptValue(value, vec3);
+    QCOMPARE(vec3, VEC3);
+
+    // the second value shares the prototype of the first
+    QScriptValue other = vec3ToScriptValue(&engine, VEC3);
+    QVERIFY(other.prototype().strictlyEquals(value.prototype()));
+}
+
+void RegisteredMetaTypesTests::testVec3Forms() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    QCOMPARE(evaluateVec3(engine, "2"), glm::vec3(2.0f));
+    QCOMPARE(evaluateVec3(engine, "[1, 2, 3]"), glm::vec3(1.0f, 2.0f, 3.0f));
+    QCOMPARE(evaluateVec3(engine, "({ red: 4, green: 5, blue: 6 })"), glm::vec3(4.0f, 5.0f, 6.0f));
+    QCOMPARE(evaluateVec3(engine, "({ r: 7, y: 8, blue: 9 })"), glm::vec3(7.0f, 8.0f, 9.0f));
+
+    // the values that aren't numbers convert the way they did through QVariant
+    QCOMPARE(evaluateVec3(engine, "({ x: '1.5', y: true })"), glm::vec3(1.5f, 1.0f, 0.0f));
+    QCOMPARE(evaluateVec3(engine, "({ x: 'one', y: undefined, z: {} })"), glm::vec3(0.0f));
+    QCOMPARE(evaluateVec3(engine, "undefined"), glm::vec3(0.0f));
+
+    // an array that isn't of 3 is left alone
+    QCOMPARE(evaluateVec3(engine, "[1, 2]"), glm::vec3(-1.0f));
+}
+
+void RegisteredMetaTypesTests::testQuat() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    glm::quat quat;
+    quatFromScriptValue(engine.evaluate("({ x: 0, y: 0, z: 2, w: 0 })"), quat);
+    QCOMPARE(quat, glm::quat(0.0f, 0.0f, 0.0f, 1.0f));
+
+    quatFromScriptValue(engine.evaluate("null"), quat);
+    QCOMPARE(quat, glm::quat());
+
+    const glm::quat ROTATION = glm::angleAxis(0.5f, glm::vec3(0.0f, 1.0f, 0.0f));
+    quatFromScriptValue(quatToScriptValue(&engine, ROTATION), quat);
+    QVERIFY(fabsf(glm::dot(quat, ROTATION)) > 0.99999f);
+}
+
+void RegisteredMetaTypesTests::testMat4RoundTrip() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    glm::mat4 mat4;
+    for (int column = 0; column < 4; column++) {
+        for (int row = 0; row < 4; row++) {
+            mat4[column][row] = (float)(column * 4 + row);
+        }
+    }
+    QScriptValue value = mat4toScriptValue(&engine, mat4);
+    QCOMPARE(value.property("r1c2").toNumber(), 9.0);
+
+    glm::mat4 result;
+    mat4FromScriptValue(value, result);
+    QCOMPARE(result, mat4);
+}
+
+void RegisteredMetaTypesTests::testEngineChanges() {
+    const glm::vec3 VEC3(1.0f, 2.0f, 3.0f);
+
+    // the names of one engine must not be used for another on the same thread
+    QScriptEngine first;
+    QScriptEngine second;
+    registerMetaTypes(&first);
+    registerMetaTypes(&second);
+    for (int i = 0; i < 3; i++) {
+        glm::vec3 vec3;
+        vec3FromScriptValue(vec3ToScriptValue(&first, VEC3), vec3);
+        QCOMPARE(vec3, VEC3);
+        vec3FromScriptValue(vec3ToScriptValue(&second, VEC3), vec3);
+        QCOMPARE(vec3, VEC3);
+    }
+
+    // nor the names of a deleted engine for a new one
+    for (int i = 0; i < 3; i++) {
+        auto engine = new QScriptEngine();
+        registerMetaTypes(engine);
+        QScriptValue value = vec3ToScriptValue(engine, VEC3);
+        engine->globalObject().setProperty("v", value);
+        QCOMPARE(engine->evaluate("v.b").toNumber(), 3.0);
+        glm::vec3 vec3;
+        vec3FromScriptValue(value, vec3);
+        QCOMPARE(vec3, VEC3);
+        delete engine;
+    }
+}
+
+void RegisteredMetaTypesTests::conversionPerf() {
+    QScriptEngine engine;
+    registerMetaTypes(&engine);
+
+    const int NUM_CONVERSIONS = 100000;
+    glm::vec3 last;
+    glm::quat quat;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < NUM_CONVERSIONS; i++) {
+        vec3FromScriptValue(vec3ToScriptValue(&engine, glm::vec3((float)i)), last);
+        quatFromScriptValue(quatToScriptValue(&engine, quat), quat);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+    qDebug() << "vec3 and quat round trips per second:" << (double)NUM_CONVERSIONS * 1.0e6 / (double)std::max((int64_t)1, (int64_t)elapsed.count());
+    QCOMPARE(last, glm::vec3((float)(NUM_CONVERSIONS - 1)));
+}
@@ -0,0 +1,27 @@
+//
+//  RegisteredMetaTypesTests.h
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_RegisteredMetaTypesTests_h
+#define hifi_RegisteredMetaTypesTests_h
+
+#include <QtTest/QtTest>
+
+class RegisteredMetaTypesTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testVec3RoundTrip();
+    void testVec3Forms();
+    void testQuat();
+    void testMat4RoundTrip();
+    void testEngineChanges();
+    void conversionPerf();
+};
+
+#endif // hifi_RegisteredMetaTypesTests_h
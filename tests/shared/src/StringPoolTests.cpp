@@ -0,0 +1,49 @@
+//
+//  StringPoolTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "StringPoolTests.h"
+
+#include <shared/StringPool.h>
+
+QTEST_MAIN(StringPoolTests)
+
+void StringPoolTests::testSharesEqualStrings() {
+    StringPool stringPool;
+
+    // built separately so that they don't share their data to begin with
+    QString first = QString("http://example.com/") + "script.js";
+    QString second = QString("http://example.com/") + "script.js";
+    QVERIFY(first.constData() != second.constData());
+
+    QString internedFirst = stringPool.intern(first);
+    QString internedSecond = stringPool.intern(second);
+    QCOMPARE(internedFirst, first);
+    QCOMPARE(internedSecond, second);
+    QVERIFY(internedFirst.constData() == internedSecond.constData());
+    QCOMPARE(stringPool.getNumStrings(), 1);
+    QCOMPARE(stringPool.getNumBytes(), (size_t)first.size() * sizeof(QChar));
+
+    QVERIFY(stringPool.intern(QString()).isEmpty());
+    QCOMPARE(stringPool.getNumStrings(), 1);
+}
+
+void StringPoolTests::testPrunesUnusedStrings() {
+    StringPool stringPool;
+
+    QString kept = stringPool.intern(QString("kept") + "string");
+    const int NUM_STRINGS = 1000;
+    for (int i = 0; i < NUM_STRINGS; ++i) {
+        stringPool.intern(QString::number(i));
+    }
+
+    // the strings nobody held were dropped along the way, the one we hold is still shared
+    QVERIFY(stringPool.getNumStrings() < NUM_STRINGS);
+    QVERIFY(stringPool.intern(QString("kept") + "string").constData() == kept.constData());
+}
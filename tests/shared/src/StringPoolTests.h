@@ -0,0 +1,23 @@
+//
+//  StringPoolTests.h
+//  tests/shared/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_StringPoolTests_h
+#define hifi_StringPoolTests_h
+
+#include <QtTest/QtTest>
+
+class StringPoolTests : public QObject {
+    Q_OBJECT
+private slots:
+    void testSharesEqualStrings();
+    void testPrunesUnusedStrings();
+};
+
+#endif // hifi_StringPoolTests_h
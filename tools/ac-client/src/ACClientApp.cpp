@@ -18,11 +18,15 @@
 
 #include <NetworkLogging.h>
 #include <NetworkingConstants.h>
+#include <NumericalConstants.h>
 #include <SharedLogging.h>
 #include <AddressManager.h>
 #include <DependencyManager.h>
 #include <SettingHandle.h>
 
+#include "LoadAgent.h"
+#include "LoadGenerator.h"
+
 ACClientApp::ACClientApp(int argc, char* argv[]) :
     QCoreApplication(argc, argv)
 {
@@ -47,6 +51,25 @@ ACClientApp::ACClientApp(int argc, char* argv[]) :
     const QCommandLineOption listenPortOption("listenPort", "listen port", QString::number(INVALID_PORT));
     parser.addOption(listenPortOption);
 
+    const QCommandLineOption loadOption("load", "run as one simulated agent of a load test");
+    parser.addOption(loadOption);
+
+    const QCommandLineOption agentsOption("agents", "run a load test with this many simulated agents", "count");
+    parser.addOption(agentsOption);
+
+    const QCommandLineOption agentIndexOption("agent-index", "index of the simulated agent in the load test", "index", "0");
+    parser.addOption(agentIndexOption);
+
+    const QCommandLineOption clipOption("clip", "recording the simulated agents replay", "path");
+    parser.addOption(clipOption);
+
+    const QCommandLineOption durationOption("duration", "seconds the simulated agents run for", "seconds", "60");
+    parser.addOption(durationOption);
+
+    const QCommandLineOption domainWebOption("domain-web", "domain-server web interface to get the mixer stats from",
+        "http://127.0.0.1:40100");
+    parser.addOption(domainWebOption);
+
     if (!parser.parse(QCoreApplication::arguments())) {
         qCritical() << parser.errorText() << endl;
         parser.showHelp();
@@ -81,6 +104,27 @@ ACClientApp::ACClientApp(int argc, char* argv[]) :
         qDebug() << "domain-server address is" << domainServerAddress;
     }
 
+    if (parser.isSet(agentsOption)) {
+        // each agent is a process of its own, running this same client with the load option
+        QStringList agentArguments;
+        agentArguments << "--load" << "-d" << domainServerAddress << "--duration" << parser.value(durationOption);
+        if (parser.isSet(clipOption)) {
+            agentArguments << "--clip" << parser.value(clipOption);
+        }
+        if (parser.isSet(authOption)) {
+            agentArguments << "-u" << parser.value(authOption);
+        }
+        if (_verbose) {
+            agentArguments << "-v";
+        }
+
+        _loadGenerator = new LoadGenerator(parser.value(agentsOption).toInt(), agentArguments,
+            QUrl(parser.value(domainWebOption)), this);
+        connect(_loadGenerator, &LoadGenerator::finished, this, [] { QCoreApplication::exit(0); });
+        _loadGenerator->start();
+        return;
+    }
+
     int listenPort = INVALID_PORT;
     if (parser.isSet(listenPortOption)) {
         listenPort = parser.value(listenPortOption).toInt();
@@ -127,8 +171,13 @@ ACClientApp::ACClientApp(int argc, char* argv[]) :
     connect(nodeList.data(), &NodeList::nodeKilled, this, &ACClientApp::nodeKilled);
     connect(nodeList.data(), &NodeList::nodeActivated, this, &ACClientApp::nodeActivated);
     connect(nodeList.data(), &NodeList::packetVersionMismatch, this, &ACClientApp::notifyPacketVersionMismatch);
-    nodeList->addSetOfNodeTypesToNodeInterestSet(NodeSet() << NodeType::AudioMixer << NodeType::AvatarMixer
-                                                 << NodeType::EntityServer << NodeType::AssetServer << NodeType::MessagesMixer);
+    if (parser.isSet(loadOption)) {
+        nodeList->addSetOfNodeTypesToNodeInterestSet(NodeSet() << NodeType::AudioMixer << NodeType::AvatarMixer
+                                                     << NodeType::EntityServer);
+    } else {
+        nodeList->addSetOfNodeTypesToNodeInterestSet(NodeSet() << NodeType::AudioMixer << NodeType::AvatarMixer
+                                                     << NodeType::EntityServer << NodeType::AssetServer << NodeType::MessagesMixer);
+    }
 
     if (_verbose) {
         QString username = accountManager->getAccountInfo().getUsername();
@@ -156,6 +205,14 @@ ACClientApp::ACClientApp(int argc, char* argv[]) :
 
     DependencyManager::get<AddressManager>()->handleLookupString(domainServerAddress, false);
 
+    if (parser.isSet(loadOption)) {
+        _loadAgent = new LoadAgent(parser.value(agentIndexOption).toInt(), parser.value(clipOption), this);
+        _loadAgent->start();
+
+        QTimer::singleShot(parser.value(durationOption).toInt() * (int)MSECS_PER_SECOND, this, [this] { finish(0); });
+        return;
+    }
+
     QTimer* doTimer = new QTimer(this);
     doTimer->setSingleShot(true);
     connect(doTimer, &QTimer::timeout, this, &ACClientApp::timedOut);
@@ -214,7 +271,8 @@ void ACClientApp::nodeActivated(SharedNodePointer node) {
         _sawMessagesMixer = true;
     }
 
-    if (_sawEntityServer && _sawAudioMixer && _sawAvatarMixer && _sawAssetServer && _sawMessagesMixer) {
+    // a simulated agent stays connected for the duration of the load test
+    if (!_loadAgent && _sawEntityServer && _sawAudioMixer && _sawAvatarMixer && _sawAssetServer && _sawMessagesMixer) {
         if (_verbose) {
             qDebug() << "success";
         }
@@ -272,6 +330,8 @@ void ACClientApp::finish(int exitCode) {
     // remove the NodeList from the DependencyManager
     DependencyManager::destroy<NodeList>();
 
-    printFailedServers();
+    if (!_loadAgent) {
+        printFailedServers();
+    }
     QCoreApplication::exit(exitCode);
 }
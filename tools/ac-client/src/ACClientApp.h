@@ -20,6 +20,8 @@
 #include <NetworkPeer.h>
 #include <NodeList.h>
 
+class LoadAgent;
+class LoadGenerator;
 
 class ACClientApp : public QCoreApplication {
     Q_OBJECT
@@ -50,6 +52,9 @@ private:
 
     QString _username;
     QString _password;
+
+    LoadAgent* _loadAgent { nullptr };
+    LoadGenerator* _loadGenerator { nullptr };
 };
 
 #endif //hifi_ACClientApp_h
@@ -0,0 +1,236 @@
+//
+//  LoadAgent.cpp
+//  tools/ac-client/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "LoadAgent.h"
+
+#include <iostream>
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include <AudioConstants.h>
+#include <AudioStreamStats.h>
+#include <AvatarHashMap.h>
+#include <GLMHelpers.h>
+#include <NumericalConstants.h>
+#include <ViewFrustum.h>
+#include <shared/ConicalViewFrustum.h>
+
+const QString LoadAgent::REPORT_PREFIX = "load-report ";
+
+static const int REPORT_INTERVAL_MSECS = 1000;
+static const int QUERY_INTERVAL_MSECS = 1000;
+
+// the agents are spread on a grid around the origin of the domain, each walking in its own circle
+static const int AGENTS_PER_ROW = 20;
+static const float AGENT_SPACING = 2.0f; // meters
+static const float WALK_RADIUS = 0.75f; // meters
+static const float WALK_PERIOD = 20.0f; // seconds
+
+static const float TONE_BASE_FREQUENCY = 200.0f; // hertz
+static const float TONE_AMPLITUDE = 3000.0f;
+
+LoadAgent::LoadAgent(int index, const QString& clipPath, QObject* parent) :
+    QObject(parent),
+    _index(index),
+    _origin((float)(index % AGENTS_PER_ROW) * AGENT_SPACING, 0.0f, (float)(index / AGENTS_PER_ROW) * AGENT_SPACING),
+    _avatar(std::make_shared<AvatarData>())
+{
+    _avatar->setDisplayName(QString("load-agent-%1").arg(index));
+    _avatar->setWorldPosition(_origin);
+
+    if (!clipPath.isEmpty()) {
+        _clip = recording::Clip::fromFile(clipPath);
+        if (!_clip || _clip->frameCount() == 0) {
+            qWarning() << "Could not load the recording" << clipPath << ", the agent will walk instead";
+            _clip.reset();
+        }
+    }
+
+    _avatarTimer.setTimerType(Qt::PreciseTimer);
+    _audioTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_avatarTimer, &QTimer::timeout, this, &LoadAgent::sendAvatarData);
+    connect(&_audioTimer, &QTimer::timeout, this, &LoadAgent::sendAudio);
+    connect(&_queryTimer, &QTimer::timeout, this, &LoadAgent::sendQueries);
+    connect(&_reportTimer, &QTimer::timeout, this, &LoadAgent::report);
+}
+
+void LoadAgent::start() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    connect(nodeList.data(), &NodeList::uuidChanged, this, [this](const QUuid& sessionUUID) {
+        _avatar->setSessionUUID(sessionUUID);
+    });
+
+    auto& packetReceiver = nodeList->getPacketReceiver();
+    packetReceiver.registerListener(PacketType::BulkAvatarData, this, "handleBulkAvatarData");
+    packetReceiver.registerListenerForTypes({ PacketType::MixedAudio, PacketType::SilentAudioFrame },
+        this, "handleMixedAudio");
+    packetReceiver.registerListener(PacketType::AudioStreamStats, this, "handleAudioStreamStats");
+
+    _elapsed.start();
+    _avatarTimer.start((int)MSECS_PER_SECOND / CLIENT_TO_AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND);
+    _audioTimer.start((int)AudioConstants::NETWORK_FRAME_MSECS);
+    _queryTimer.start(QUERY_INTERVAL_MSECS);
+    _reportTimer.start(REPORT_INTERVAL_MSECS);
+}
+
+void LoadAgent::updateMovement() {
+    if (_clip) {
+        static const recording::FrameType AVATAR_FRAME_TYPE = recording::Frame::registerFrameType(AvatarData::FRAME_NAME);
+
+        // the recording loops for as long as the agent runs
+        auto clipDuration = std::max(recording::Frame::secondsToFrameTime(_clip->duration()), (recording::Frame::Time)1);
+        auto clipTime = (recording::Frame::Time)(_elapsed.elapsed() % clipDuration);
+        if (clipTime < _clip->positionFrameTime()) {
+            _clip->seekFrameTime(0);
+        }
+        for (auto frame = _clip->peekFrame(); frame && frame->timeOffset <= clipTime; frame = _clip->peekFrame()) {
+            _clip->skipFrame();
+            if (frame->type == AVATAR_FRAME_TYPE) {
+                AvatarData::fromFrame(frame->data, *_avatar, false);
+                _avatar->setWorldPosition(_avatar->getWorldPosition() + _origin);
+            }
+        }
+        return;
+    }
+
+    float angle = TWO_PI * (float)_elapsed.elapsed() / (WALK_PERIOD * MSECS_PER_SECOND);
+    _avatar->setWorldPosition(_origin + WALK_RADIUS * glm::vec3(cosf(angle), 0.0f, sinf(angle)));
+    _avatar->setWorldOrientation(glm::angleAxis(-angle, Vectors::UNIT_Y));
+}
+
+void LoadAgent::sendAvatarData() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    if (!nodeList->soloNodeOfType(NodeType::AvatarMixer)) {
+        return;
+    }
+
+    updateMovement();
+    if (_avatar->getIdentityDataChanged()) {
+        _avatar->sendIdentityPacket();
+    }
+    _avatar->sendAvatarDataPacket();
+}
+
+void LoadAgent::sendAudio() {
+    auto nodeList = DependencyManager::get<NodeList>();
+    auto audioMixer = nodeList->soloNodeOfType(NodeType::AudioMixer);
+    if (!audioMixer || !audioMixer->getActiveSocket()) {
+        return;
+    }
+
+    // the mixer takes the PCM of the audio of a client that hasn't negotiated a codec
+    auto audioPacket = NLPacket::create(PacketType::MicrophoneAudioNoEcho);
+    audioPacket->writePrimitive(_outgoingAudioSequenceNumber++);
+    audioPacket->writeString(QString());
+    audioPacket->writePrimitive((quint8)0); // mono
+
+    glm::vec3 position = _avatar->getWorldPosition();
+    audioPacket->writePrimitive(position);
+    audioPacket->writePrimitive(_avatar->getWorldOrientation());
+    audioPacket->writePrimitive(position);
+    audioPacket->writePrimitive(glm::vec3(0.0f));
+
+    // each agent talks at its own pitch so that their streams don't mix into a single tone
+    float frequency = TONE_BASE_FREQUENCY + (float)(_index % AGENTS_PER_ROW) * 10.0f;
+    for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; ++i) {
+        float t = (float)_audioPhase++ / (float)AudioConstants::SAMPLE_RATE;
+        audioPacket->writePrimitive((int16_t)(TONE_AMPLITUDE * sinf(TWO_PI * frequency * t)));
+    }
+    _audioPhase %= AudioConstants::SAMPLE_RATE;
+
+    nodeList->sendUnreliablePacket(*audioPacket, *audioMixer);
+}
+
+void LoadAgent::sendQueries() {
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    ViewFrustum viewFrustum;
+    viewFrustum.setPosition(_avatar->getWorldPosition());
+    viewFrustum.setOrientation(_avatar->getWorldOrientation());
+    viewFrustum.setProjection(DEFAULT_FIELD_OF_VIEW_DEGREES, DEFAULT_ASPECT_RATIO, DEFAULT_NEAR_CLIP, DEFAULT_FAR_CLIP);
+    viewFrustum.calculate();
+    ConicalViewFrustums views { ConicalViewFrustum(viewFrustum) };
+
+    auto avatarQueryPacket = NLPacket::create(PacketType::AvatarQuery);
+    auto destinationBuffer = reinterpret_cast<unsigned char*>(avatarQueryPacket->getPayload());
+    unsigned char* bufferStart = destinationBuffer;
+    uint8_t numFrustums = (uint8_t)views.size();
+    memcpy(destinationBuffer, &numFrustums, sizeof(numFrustums));
+    destinationBuffer += sizeof(numFrustums);
+    for (const auto& view : views) {
+        destinationBuffer += view.serialize(destinationBuffer);
+    }
+    avatarQueryPacket->setPayloadSize(destinationBuffer - bufferStart);
+    nodeList->broadcastToNodes(std::move(avatarQueryPacket), NodeSet() << NodeType::AvatarMixer);
+
+    auto entityServer = nodeList->soloNodeOfType(NodeType::EntityServer);
+    if (entityServer && entityServer->getActiveSocket()) {
+        _entityQuery.setConicalViews(views);
+        auto entityQueryPacket = NLPacket::create(PacketType::EntityQuery);
+        auto packetData = reinterpret_cast<unsigned char*>(entityQueryPacket->getPayload());
+        entityQueryPacket->setPayloadSize(_entityQuery.getBroadcastData(packetData));
+        nodeList->sendUnreliablePacket(*entityQueryPacket, *entityServer);
+    }
+}
+
+void LoadAgent::report() {
+    auto nodeList = DependencyManager::get<NodeList>();
+
+    QJsonObject report;
+    report["agent"] = _index;
+    report["elapsed"] = (double)_elapsed.elapsed() / MSECS_PER_SECOND;
+
+    float inboundKbps = 0.0f;
+    float outboundKbps = 0.0f;
+    QJsonObject pings;
+    nodeList->eachNode([&](const SharedNodePointer& node) {
+        inboundKbps += node->getInboundKbps();
+        outboundKbps += node->getOutboundKbps();
+        pings[NodeType::getNodeTypeName(node->getType())] = node->getPingMs();
+    });
+    report["pingMs"] = pings;
+    report["inboundKbps"] = inboundKbps;
+    report["outboundKbps"] = outboundKbps;
+
+    report["audioUpstreamLoss"] = _upstreamAudioLossRate;
+    report["audioDownstreamLoss"] = _incomingAudioStats.getStats().getLostRate();
+    report["avatarPacketsPerSecond"] = _avatarPacketsReceived * (int)MSECS_PER_SECOND / REPORT_INTERVAL_MSECS;
+    _avatarPacketsReceived = 0;
+
+    std::cout << qPrintable(REPORT_PREFIX) << QJsonDocument(report).toJson(QJsonDocument::Compact).constData()
+        << std::endl;
+}
+
+void LoadAgent::handleBulkAvatarData(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
+    ++_avatarPacketsReceived;
+}
+
+void LoadAgent::handleMixedAudio(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
+    quint16 sequence;
+    message->readPrimitive(&sequence);
+    _incomingAudioStats.sequenceNumberReceived(sequence);
+}
+
+void LoadAgent::handleAudioStreamStats(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
+    quint8 appendFlag;
+    message->readPrimitive(&appendFlag);
+    quint16 numStreamStats;
+    message->readPrimitive(&numStreamStats);
+
+    AudioStreamStats streamStats;
+    for (quint16 i = 0; i < numStreamStats; i++) {
+        message->readPrimitive(&streamStats);
+        // the microphone stream of the agent is the one without an identifier, the others are injectors
+        if (streamStats._streamIdentifier.isNull()) {
+            _upstreamAudioLossRate = streamStats._packetStreamWindowStats.getLostRate();
+        }
+    }
+}
@@ -0,0 +1,74 @@
+//
+//  LoadAgent.h
+//  tools/ac-client/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_LoadAgent_h
+#define hifi_LoadAgent_h
+
+#include <memory>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+
+#include <AvatarData.h>
+#include <NodeList.h>
+#include <OctreeQuery.h>
+#include <ReceivedMessage.h>
+#include <SequenceNumberStats.h>
+#include <recording/Clip.h>
+
+// One simulated client of a load test, driven through the NodeList of the process.  It sends avatar data at the
+// rate of the interface, replaying the avatar frames of a recording when it is given one and walking in a circle
+// otherwise, a stream of PCM audio, and the avatar and entity queries of a view that follows the avatar.  Every
+// report interval it prints a line with its latency to the mixers, the loss of its audio in both directions and
+// its bandwidth, for the load generator that spawned it to aggregate.
+class LoadAgent : public QObject {
+    Q_OBJECT
+public:
+    static const QString REPORT_PREFIX;
+
+    LoadAgent(int index, const QString& clipPath, QObject* parent = nullptr);
+
+    void start();
+
+private slots:
+    void sendAvatarData();
+    void sendAudio();
+    void sendQueries();
+    void report();
+
+    void handleBulkAvatarData(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
+    void handleMixedAudio(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
+    void handleAudioStreamStats(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode);
+
+private:
+    void updateMovement();
+
+    int _index;
+    glm::vec3 _origin;
+    std::shared_ptr<AvatarData> _avatar;
+    recording::ClipPointer _clip;
+    QElapsedTimer _elapsed;
+
+    QTimer _avatarTimer;
+    QTimer _audioTimer;
+    QTimer _queryTimer;
+    QTimer _reportTimer;
+
+    OctreeQuery _entityQuery;
+    quint16 _outgoingAudioSequenceNumber { 0 };
+    int _audioPhase { 0 };
+
+    SequenceNumberStats _incomingAudioStats;
+    float _upstreamAudioLossRate { 0.0f };
+    int _avatarPacketsReceived { 0 };
+};
+
+#endif // hifi_LoadAgent_h
@@ -0,0 +1,207 @@
+//
+//  LoadGenerator.cpp
+//  tools/ac-client/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "LoadGenerator.h"
+
+#include <algorithm>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtNetwork/QNetworkReply>
+
+#include <NetworkAccessManager.h>
+
+#include "LoadAgent.h"
+
+static const int AGENT_LAUNCH_INTERVAL_MSECS = 100;
+static const int SUMMARY_INTERVAL_MSECS = 5000;
+
+// the parts of the stats of the mixers that tell how long their frames take
+static const QStringList AUDIO_MIXER_FRAME_STATS = { "avg_timing_stats", "trailing_mix_ratio", "throttling_ratio" };
+static const QStringList AVATAR_MIXER_FRAME_STATS = { "broadcast_loop_rate", "trailing_mix_ratio", "throttling_ratio",
+    "slaves_aggregate (per frame)" };
+
+LoadGenerator::LoadGenerator(int numAgents, const QStringList& agentArguments, const QUrl& domainWebURL, QObject* parent) :
+    QObject(parent),
+    _numAgents(numAgents),
+    _agentArguments(agentArguments),
+    _domainWebURL(domainWebURL),
+    _lastReports(numAgents)
+{
+    connect(&_launchTimer, &QTimer::timeout, this, &LoadGenerator::launchNextAgent);
+    connect(&_summaryTimer, &QTimer::timeout, this, &LoadGenerator::printSummary);
+    connect(&_summaryTimer, &QTimer::timeout, this, &LoadGenerator::requestMixerStats);
+}
+
+LoadGenerator::~LoadGenerator() {
+    for (auto agent : _agents) {
+        agent->disconnect(this);
+        agent->kill();
+        agent->waitForFinished();
+    }
+}
+
+void LoadGenerator::start() {
+    qDebug() << "Launching" << _numAgents << "agents";
+    _launchTimer.start(AGENT_LAUNCH_INTERVAL_MSECS);
+    _summaryTimer.start(SUMMARY_INTERVAL_MSECS);
+}
+
+void LoadGenerator::launchNextAgent() {
+    int index = _agents.size();
+    if (index >= _numAgents) {
+        _launchTimer.stop();
+        return;
+    }
+
+    auto agent = new QProcess(this);
+    agent->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    connect(agent, &QProcess::readyReadStandardOutput, this, [this, index] { readAgentOutput(index); });
+    connect(agent, static_cast<void (QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+        this, &LoadGenerator::agentFinished);
+    _agents.push_back(agent);
+    ++_numRunningAgents;
+
+    agent->start(QCoreApplication::applicationFilePath(),
+        QStringList(_agentArguments) << "--agent-index" << QString::number(index));
+}
+
+void LoadGenerator::readAgentOutput(int index) {
+    auto agent = _agents[index];
+    while (agent->canReadLine()) {
+        QString line = QString::fromUtf8(agent->readLine()).trimmed();
+        if (line.startsWith(LoadAgent::REPORT_PREFIX)) {
+            _lastReports[index] = QJsonDocument::fromJson(line.mid(LoadAgent::REPORT_PREFIX.length()).toUtf8()).object();
+        }
+    }
+}
+
+void LoadGenerator::agentFinished() {
+    if (--_numRunningAgents == 0 && _agents.size() == _numAgents) {
+        printSummary();
+        emit finished();
+    }
+}
+
+void LoadGenerator::printSummary() {
+    int numReporting = 0;
+    float sumInboundKbps = 0.0f;
+    float sumOutboundKbps = 0.0f;
+    float sumUpstreamLoss = 0.0f;
+    float maxUpstreamLoss = 0.0f;
+    float sumDownstreamLoss = 0.0f;
+    float maxDownstreamLoss = 0.0f;
+    int sumAvatarPacketsPerSecond = 0;
+    QMap<QString, int> sumPings;
+    QMap<QString, int> maxPings;
+    QMap<QString, int> numPings;
+
+    for (const auto& report : _lastReports) {
+        if (report.isEmpty()) {
+            continue;
+        }
+        ++numReporting;
+        sumInboundKbps += (float)report["inboundKbps"].toDouble();
+        sumOutboundKbps += (float)report["outboundKbps"].toDouble();
+        float upstreamLoss = (float)report["audioUpstreamLoss"].toDouble();
+        sumUpstreamLoss += upstreamLoss;
+        maxUpstreamLoss = std::max(maxUpstreamLoss, upstreamLoss);
+        float downstreamLoss = (float)report["audioDownstreamLoss"].toDouble();
+        sumDownstreamLoss += downstreamLoss;
+        maxDownstreamLoss = std::max(maxDownstreamLoss, downstreamLoss);
+        sumAvatarPacketsPerSecond += report["avatarPacketsPerSecond"].toInt();
+
+        auto pings = report["pingMs"].toObject();
+        for (auto ping = pings.begin(); ping != pings.end(); ++ping) {
+            int pingMs = ping.value().toInt();
+            sumPings[ping.key()] += pingMs;
+            maxPings[ping.key()] = std::max(maxPings.value(ping.key()), pingMs);
+            numPings[ping.key()]++;
+        }
+    }
+
+    QJsonObject summary;
+    summary["agentsRunning"] = _numRunningAgents;
+    summary["agentsReporting"] = numReporting;
+    summary["totalInboundKbps"] = sumInboundKbps;
+    summary["totalOutboundKbps"] = sumOutboundKbps;
+    if (numReporting > 0) {
+        summary["averageAudioUpstreamLoss"] = sumUpstreamLoss / numReporting;
+        summary["maxAudioUpstreamLoss"] = maxUpstreamLoss;
+        summary["averageAudioDownstreamLoss"] = sumDownstreamLoss / numReporting;
+        summary["maxAudioDownstreamLoss"] = maxDownstreamLoss;
+        summary["averageAvatarPacketsPerSecond"] = (float)sumAvatarPacketsPerSecond / numReporting;
+    }
+
+    QJsonObject pings;
+    for (auto sumPing = sumPings.begin(); sumPing != sumPings.end(); ++sumPing) {
+        QJsonObject ping;
+        ping["average"] = (float)sumPing.value() / numPings[sumPing.key()];
+        ping["max"] = maxPings[sumPing.key()];
+        pings[sumPing.key()] = ping;
+    }
+    summary["pingMs"] = pings;
+
+    QJsonObject mixers;
+    for (auto mixerStats = _mixerStats.begin(); mixerStats != _mixerStats.end(); ++mixerStats) {
+        mixers[mixerStats.key()] = mixerStats.value();
+    }
+    if (!mixers.isEmpty()) {
+        summary["mixers"] = mixers;
+    }
+
+    qDebug().noquote() << QJsonDocument(summary).toJson(QJsonDocument::Compact);
+}
+
+void LoadGenerator::requestMixerStats() {
+    if (!_domainWebURL.isValid()) {
+        return;
+    }
+
+    auto& networkAccessManager = NetworkAccessManager::getInstance();
+    QNetworkRequest nodesRequest(_domainWebURL.resolved(QUrl("/nodes.json")));
+    auto nodesReply = networkAccessManager.get(nodesRequest);
+    connect(nodesReply, &QNetworkReply::finished, this, [this, nodesReply] {
+        nodesReply->deleteLater();
+        if (nodesReply->error() != QNetworkReply::NoError) {
+            qWarning() << "Could not get the nodes of the domain:" << nodesReply->errorString();
+            return;
+        }
+
+        auto nodes = QJsonDocument::fromJson(nodesReply->readAll()).object()["nodes"].toArray();
+        for (const auto& nodeValue : nodes) {
+            auto node = nodeValue.toObject();
+            QString type = node["type"].toString();
+            if (type != "audio-mixer" && type != "avatar-mixer") {
+                continue;
+            }
+            QStringList frameStats = type == "audio-mixer" ? AUDIO_MIXER_FRAME_STATS : AVATAR_MIXER_FRAME_STATS;
+
+            QString uuid = node["uuid"].toString();
+            QNetworkRequest statsRequest(_domainWebURL.resolved(QUrl("/nodes/" + uuid + ".json")));
+            auto statsReply = NetworkAccessManager::getInstance().get(statsRequest);
+            connect(statsReply, &QNetworkReply::finished, this, [this, statsReply, type, uuid, frameStats] {
+                statsReply->deleteLater();
+                if (statsReply->error() != QNetworkReply::NoError) {
+                    return;
+                }
+                auto stats = QJsonDocument::fromJson(statsReply->readAll()).object();
+                QJsonObject mixerStats;
+                for (const auto& key : frameStats) {
+                    if (stats.contains(key)) {
+                        mixerStats[key] = stats[key];
+                    }
+                }
+                _mixerStats[type + " " + uuid] = mixerStats;
+            });
+        }
+    });
+}
@@ -0,0 +1,62 @@
+//
+//  LoadGenerator.h
+//  tools/ac-client/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_LoadGenerator_h
+#define hifi_LoadGenerator_h
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QProcess>
+#include <QtCore/QStringList>
+#include <QtCore/QTimer>
+#include <QtCore/QUrl>
+#include <QtCore/QVector>
+
+// Runs the agents of a load test, one ac-client process per agent since the NodeList of a process is a singleton.
+// The agents are launched a few at a time so that the domain isn't hit by all of the connections at once, and
+// their reports are aggregated into a summary that also has the frame times the mixers reported to the
+// domain-server, when its web interface is given.
+class LoadGenerator : public QObject {
+    Q_OBJECT
+public:
+    LoadGenerator(int numAgents, const QStringList& agentArguments, const QUrl& domainWebURL, QObject* parent = nullptr);
+    ~LoadGenerator();
+
+    void start();
+
+signals:
+    // every agent has exited
+    void finished();
+
+private slots:
+    void launchNextAgent();
+    void printSummary();
+    void requestMixerStats();
+
+private:
+    void readAgentOutput(int index);
+    void agentFinished();
+
+    int _numAgents;
+    QStringList _agentArguments;
+    QUrl _domainWebURL;
+
+    QVector<QProcess*> _agents;
+    QVector<QJsonObject> _lastReports;
+    int _numRunningAgents { 0 };
+
+    QMap<QString, QJsonObject> _mixerStats;
+
+    QTimer _launchTimer;
+    QTimer _summaryTimer;
+};
+
+#endif // hifi_LoadGenerator_h
@@ -0,0 +1,148 @@
+//
+//  FrameBenchmark.cpp
+//  tools/gpu-frame-player/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "FrameBenchmark.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMetaObject>
+
+#include <gpu/FrameIO.h>
+
+static QJsonObject readJsonFile(const QString& path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QJsonObject();
+    }
+    return QJsonDocument::fromJson(file.readAll()).object();
+}
+
+static bool writeJsonFile(const QString& path, const QJsonObject& object) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    return file.write(QJsonDocument(object).toJson()) >= 0;
+}
+
+FrameBenchmark::FrameBenchmark(const Options& options) : _options(options) {
+#ifdef USE_GL
+    _window.setSurfaceType(QSurface::OpenGLSurface);
+#else
+    _window.setSurfaceType(QSurface::VulkanSurface);
+#endif
+    _window.setGeometry(QRect(QPoint(), QSize(800, 600)));
+    _window.create();
+    _renderThread.initialize(&_window);
+}
+
+FrameBenchmark::~FrameBenchmark() {
+    _renderThread.terminate();
+}
+
+void FrameBenchmark::start() {
+    auto manifest = readJsonFile(_options.manifestPath);
+    _frames = manifest["frames"].toArray();
+    if (_frames.isEmpty()) {
+        qWarning() << "No frames to benchmark in" << _options.manifestPath;
+        ++_numErrors;
+        finish();
+        return;
+    }
+    if (!_options.baselinePath.isEmpty()) {
+        _baselines = readJsonFile(_options.baselinePath);
+    }
+    runNextFrame();
+}
+
+void FrameBenchmark::runNextFrame() {
+    while (_frameIndex < _frames.size()) {
+        auto frameEntry = _frames[_frameIndex++].toObject();
+        QString name = frameEntry["name"].toString();
+        QString path = QDir(_options.framesDirectory).filePath(frameEntry["file"].toString());
+        if (!QFile::exists(path)) {
+            qWarning() << "The frame" << name << "wasn't captured, no" << path;
+            ++_numErrors;
+            continue;
+        }
+
+        auto frame = gpu::readFrame(path.toStdString(), _renderThread._externalTexture);
+        if (!frame || !frame->framebuffer) {
+            qWarning() << "Could not read the frame" << name << "from" << path;
+            ++_numErrors;
+            continue;
+        }
+
+        qDebug() << "Benchmarking" << name;
+        _renderThread.submitBenchmark(frame, _options.iterations, [this, name](const RenderThread::BenchmarkResult& result) {
+            // the handler runs on the render thread
+            QMetaObject::invokeMethod(this, [this, name, result] { frameFinished(name, result); }, Qt::QueuedConnection);
+        });
+        return;
+    }
+    finish();
+}
+
+void FrameBenchmark::frameFinished(const QString& name, const RenderThread::BenchmarkResult& result) {
+    _renderer = QString::fromStdString(result.renderer);
+
+    QJsonObject frameResult;
+    frameResult["iterations"] = result.iterations;
+    frameResult["gpuTime"] = result.frameGPUTime;
+    frameResult["cpuTime"] = result.frameCPUTime;
+    QJsonArray batches;
+    for (size_t i = 0; i < result.batchNames.size(); ++i) {
+        QJsonObject batch;
+        batch["name"] = QString::fromStdString(result.batchNames[i]);
+        batch["gpuTime"] = result.batchGPUTimes[i];
+        batches.append(batch);
+    }
+    frameResult["batches"] = batches;
+    _results[name] = frameResult;
+
+    auto baseline = _baselines[_renderer].toObject()[name].toObject();
+    if (baseline.contains("gpuTime")) {
+        double baselineGPUTime = baseline["gpuTime"].toDouble();
+        bool isRegression = result.frameGPUTime > baselineGPUTime * (1.0 + _options.tolerance);
+        qDebug().noquote() << QString("%1: %2 ms on the GPU, %3 ms in the baseline%4").arg(name)
+            .arg(result.frameGPUTime, 0, 'f', 3).arg(baselineGPUTime, 0, 'f', 3).arg(isRegression ? ", REGRESSION" : "");
+        if (isRegression) {
+            ++_numRegressions;
+        }
+    } else {
+        qDebug().noquote() << QString("%1: %2 ms on the GPU, no baseline").arg(name).arg(result.frameGPUTime, 0, 'f', 3);
+    }
+
+    runNextFrame();
+}
+
+void FrameBenchmark::finish() {
+    if (!_options.outputPath.isEmpty()) {
+        QJsonObject output;
+        output[_renderer] = _results;
+        if (!writeJsonFile(_options.outputPath, output)) {
+            qWarning() << "Could not write the results to" << _options.outputPath;
+        }
+    }
+
+    if (_options.updateBaseline && !_options.baselinePath.isEmpty() && !_results.isEmpty()) {
+        _baselines[_renderer] = _results;
+        if (!writeJsonFile(_options.baselinePath, _baselines)) {
+            qWarning() << "Could not update the baselines in" << _options.baselinePath;
+        }
+    }
+
+    qDebug() << "Benchmarked" << _results.size() << "frames on" << _renderer << "," << _numRegressions << "regressions,"
+        << _numErrors << "errors";
+    int exitCode = (_numRegressions > 0 || _numErrors > 0) ? 1 : 0;
+    QMetaObject::invokeMethod(qApp, [exitCode] { QCoreApplication::exit(exitCode); }, Qt::QueuedConnection);
+}
@@ -0,0 +1,60 @@
+//
+//  FrameBenchmark.h
+//  tools/gpu-frame-player/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QObject>
+#include <QtGui/QWindow>
+
+#include "RenderThread.h"
+
+// Replays the captured frames listed in a benchmark manifest and compares their GPU times with the baselines of
+// the renderer they run on.  The window is never shown, the frames are rendered to their own framebuffers and
+// not presented.  The manifest is a JSON object with a "frames" array of { "name", "file" } objects, the files
+// relative to the frames directory.  The baselines are a JSON object of renderer names to the results of a
+// previous run on that renderer.
+class FrameBenchmark : public QObject {
+    Q_OBJECT
+public:
+    struct Options {
+        QString manifestPath;
+        QString framesDirectory;
+        QString baselinePath;
+        QString outputPath;
+        int iterations { 100 };
+        float tolerance { 0.1f }; // the fraction of the baseline a frame can be slower by
+        bool updateBaseline { false };
+    };
+
+    FrameBenchmark(const Options& options);
+    ~FrameBenchmark();
+
+    // posts the exit code of the application once the frames are done: 1 for a regression or an error
+    void start();
+
+private:
+    void runNextFrame();
+    void frameFinished(const QString& name, const RenderThread::BenchmarkResult& result);
+    void finish();
+
+    Options _options;
+    QWindow _window;
+    RenderThread _renderThread;
+
+    QJsonArray _frames;
+    int _frameIndex { 0 };
+    QString _renderer;
+    QJsonObject _results;
+    QJsonObject _baselines;
+    int _numRegressions { 0 };
+    int _numErrors { 0 };
+};
@@ -15,6 +15,11 @@ void RenderThread::submitFrame(const gpu::FramePointer& frame) {
     _pendingFrames.push(frame);
 }
 
+void RenderThread::submitBenchmark(const gpu::FramePointer& frame, int iterations, const BenchmarkHandler& handler) {
+    std::unique_lock<std::mutex> lock(_frameLock);
+    _pendingBenchmarks.push({ frame, iterations, handler });
+}
+
 void RenderThread::resize(const QSize& newSize) {
     std::unique_lock<std::mutex> lock(_frameLock);
     _pendingSize.push(newSize);
@@ -219,14 +224,111 @@ void RenderThread::renderFrame(gpu::FramePointer& frame) {
 #endif
 }
 
+void RenderThread::benchmarkFrame(const PendingBenchmark& benchmark) {
+    // the first replays fill the caches of the backend and the driver and aren't timed
+    static const int WARMUP_ITERATIONS = 5;
+
+    const auto& frame = benchmark.frame;
+    BenchmarkResult result;
+    result.iterations = benchmark.iterations;
+    for (const auto& batch : frame->batches) {
+        result.batchNames.push_back(batch->getName());
+    }
+    result.batchGPUTimes.assign(frame->batches.size(), 0.0);
+
+#ifdef USE_GL
+    _context.makeCurrent();
+    result.renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+#endif
+    _gpuContext->consumeFrameUpdates(frame);
+    _backend->setStereoState(frame->stereoState);
+
+    auto& glbackend = (gpu::gl::GLBackend&)(*_backend);
+    auto fbo = glbackend.getFramebufferID(frame->framebuffer);
+
+    for (int iteration = -WARMUP_ITERATIONS; iteration < benchmark.iterations; ++iteration) {
+        bool isTimed = iteration >= 0;
+        _backend->recycle();
+        _backend->syncCache();
+
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbo);
+        glClearDepth(0);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+
+        auto frameQuery = std::make_shared<gpu::Query>([&](const gpu::Query& query) {
+            if (isTimed) {
+                result.frameGPUTime += query.getGPUElapsedTime();
+                result.frameCPUTime += query.getBatchElapsedTime();
+            }
+        }, "benchmark::frame");
+        gpu::Queries batchQueries;
+        for (size_t i = 0; i < frame->batches.size(); ++i) {
+            batchQueries.push_back(std::make_shared<gpu::Query>([&, i](const gpu::Query& query) {
+                if (isTimed) {
+                    result.batchGPUTimes[i] += query.getGPUElapsedTime();
+                }
+            }, result.batchNames[i]));
+        }
+
+        _gpuContext->executeBatch("benchmark::begin", [&](gpu::Batch& batch) {
+            batch.beginQuery(frameQuery);
+        });
+        for (size_t i = 0; i < frame->batches.size(); ++i) {
+            _gpuContext->executeBatch("benchmark::beginBatch", [&](gpu::Batch& batch) {
+                batch.beginQuery(batchQueries[i]);
+            });
+            _backend->render(*frame->batches[i]);
+            _gpuContext->executeBatch("benchmark::endBatch", [&](gpu::Batch& batch) {
+                batch.endQuery(batchQueries[i]);
+            });
+        }
+        _gpuContext->executeBatch("benchmark::end", [&](gpu::Batch& batch) {
+            batch.endQuery(frameQuery);
+        });
+
+        // wait for the replay so that the results of all of the queries are available when they are pulled
+#ifdef USE_GL
+        glFinish();
+#endif
+        _gpuContext->executeBatch("benchmark::results", [&](gpu::Batch& batch) {
+            batch.getQuery(frameQuery);
+            for (const auto& batchQuery : batchQueries) {
+                batch.getQuery(batchQuery);
+            }
+        });
+    }
+
+#ifdef USE_GL
+    (void)CHECK_GL_ERROR();
+    _context.doneCurrent();
+#endif
+
+    if (benchmark.iterations > 0) {
+        result.frameGPUTime /= benchmark.iterations;
+        result.frameCPUTime /= benchmark.iterations;
+        for (auto& batchGPUTime : result.batchGPUTimes) {
+            batchGPUTime /= benchmark.iterations;
+        }
+    }
+    benchmark.handler(result);
+}
+
 bool RenderThread::process() {
     std::queue<gpu::FramePointer> pendingFrames;
     std::queue<QSize> pendingSize;
+    std::queue<PendingBenchmark> pendingBenchmarks;
 
     {
         std::unique_lock<std::mutex> lock(_frameLock);
         pendingFrames.swap(_pendingFrames);
         pendingSize.swap(_pendingSize);
+        pendingBenchmarks.swap(_pendingBenchmarks);
+    }
+
+    while (!pendingBenchmarks.empty()) {
+        benchmarkFrame(pendingBenchmarks.front());
+        pendingBenchmarks.pop();
     }
     
     while (!pendingFrames.empty()) {
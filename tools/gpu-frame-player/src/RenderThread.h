@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <QtCore/QElapsedTimer>
 
 #include <GenericThread.h>
@@ -67,4 +69,26 @@ public:
     void submitFrame(const gpu::FramePointer& frame);
     void initialize(QWindow* window);
     void renderFrame(gpu::FramePointer& frame);
+
+    // The average times of the replays of a frame, in milliseconds, measured with gpu::Query
+    struct BenchmarkResult {
+        std::string renderer;
+        std::vector<std::string> batchNames;
+        std::vector<double> batchGPUTimes;
+        double frameGPUTime { 0.0 };
+        double frameCPUTime { 0.0 };
+        int iterations { 0 };
+    };
+    using BenchmarkHandler = std::function<void(const BenchmarkResult&)>;
+
+    // replays the frame on the render thread without presenting it, and calls the handler there once it is done
+    void submitBenchmark(const gpu::FramePointer& frame, int iterations, const BenchmarkHandler& handler);
+
+    struct PendingBenchmark {
+        gpu::FramePointer frame;
+        int iterations;
+        BenchmarkHandler handler;
+    };
+    std::queue<PendingBenchmark> _pendingBenchmarks;
+    void benchmarkFrame(const PendingBenchmark& benchmark);
 };
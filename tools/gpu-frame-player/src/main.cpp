@@ -6,9 +6,12 @@
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
 //
 
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QFileInfo>
 #include <QtWidgets/QApplication>
 
 #include <shared/FileLogger.h>
+#include "FrameBenchmark.h"
 #include "PlayerWindow.h"
 
 Q_DECLARE_LOGGING_CATEGORY(gpu_player_logging)
@@ -28,6 +31,37 @@ int main(int argc, char** argv) {
     QApplication app(argc, argv);
     logger.reset(new FileLogger());
     setup();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("High Fidelity GPU frame player");
+    parser.addHelpOption();
+    const QCommandLineOption benchmarkOption("benchmark", "replay the frames of a benchmark manifest and exit", "manifest");
+    const QCommandLineOption framesOption("frames", "directory of the captured frames of the benchmark", "directory");
+    const QCommandLineOption baselineOption("baseline", "baselines to compare the benchmark with", "path");
+    const QCommandLineOption outputOption("output", "file to write the results of the benchmark to", "path");
+    const QCommandLineOption iterationsOption("iterations", "number of timed replays of each frame", "count", "100");
+    const QCommandLineOption toleranceOption("tolerance", "fraction of the baseline a frame can be slower by", "fraction", "0.1");
+    const QCommandLineOption updateBaselineOption("update-baseline", "store the results as the baseline of this renderer");
+    parser.addOptions({ benchmarkOption, framesOption, baselineOption, outputOption, iterationsOption, toleranceOption,
+        updateBaselineOption });
+    parser.process(app);
+
+    if (parser.isSet(benchmarkOption)) {
+        FrameBenchmark::Options options;
+        options.manifestPath = parser.value(benchmarkOption);
+        options.framesDirectory = parser.isSet(framesOption) ? parser.value(framesOption) :
+            QFileInfo(options.manifestPath).absolutePath();
+        options.baselinePath = parser.value(baselineOption);
+        options.outputPath = parser.value(outputOption);
+        options.iterations = parser.value(iterationsOption).toInt();
+        options.tolerance = parser.value(toleranceOption).toFloat();
+        options.updateBaseline = parser.isSet(updateBaselineOption);
+
+        FrameBenchmark benchmark(options);
+        benchmark.start();
+        return app.exec();
+    }
+
     PlayerWindow window;
     app.exec();
     return 0;
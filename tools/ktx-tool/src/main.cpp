@@ -16,6 +16,7 @@
 #include <QtCore/QLoggingCategory>
 
 #include <QtCore/QResource>
+#include <QtConcurrent/QtConcurrentMap>
 
 #include <QtGui/QResizeEvent>
 #include <QtGui/QWindow>
@@ -115,9 +116,15 @@ int main(int argc, char** argv) {
         if (!destFolder.exists() && !destFolder.mkpath(".")) {
             throw std::runtime_error("failed to create output directory");
         }
-        for (const auto ktxFile : SOURCE_FOLDER.entryInfoList(QStringList() << "*.ktx")) {
-            processKtxFile(ktxFile);
-        }
+        // the files are independent, convert them concurrently
+        auto ktxFiles = SOURCE_FOLDER.entryInfoList(QStringList() << "*.ktx");
+        QtConcurrent::blockingMap(ktxFiles, [](const QFileInfo& ktxFile) {
+            try {
+                processKtxFile(ktxFile);
+            } catch (const std::exception& e) {
+                qWarning() << ktxFile.absoluteFilePath() << e.what();
+            }
+        });
         qDebug() << "Done";
     }
 
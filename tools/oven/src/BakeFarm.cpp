@@ -0,0 +1,149 @@
+//
+//  BakeFarm.cpp
+//  tools/oven/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakeFarm.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+static const QString QUEUE_SUBDIR = "queue";
+static const QString INPUTS_SUBDIR = "inputs";
+static const QString CLAIMED_SUBDIR = "claimed";
+static const QString STORE_SUBDIR = "store";
+static const QString FAILED_SUBDIR = "failed";
+
+static const QString JOB_EXTENSION = ".json";
+static const QString ERRORS_EXTENSION = ".txt";
+
+static const QString JOB_INPUT_KEY = "input";
+static const QString JOB_TYPE_KEY = "type";
+
+BakeFarm::BakeFarm(const QString& path) : _root(path) {
+}
+
+bool BakeFarm::create() {
+    for (const auto& subdir : { QUEUE_SUBDIR, INPUTS_SUBDIR, CLAIMED_SUBDIR, STORE_SUBDIR, FAILED_SUBDIR }) {
+        if (!_root.mkpath(subdir)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BakeFarm::enqueue(const QString& inputPath, const QString& type, QString& errorOut) {
+    QFile inputFile { inputPath };
+    if (!inputFile.open(QIODevice::ReadOnly)) {
+        errorOut = "Could not open " + inputPath;
+        return false;
+    }
+    QCryptographicHash hash { QCryptographicHash::Sha256 };
+    if (!hash.addData(&inputFile)) {
+        errorOut = "Could not read " + inputPath;
+        return false;
+    }
+    inputFile.close();
+
+    QString key = hash.result().toHex() + "-" + type;
+    QString jobFileName = key + JOB_EXTENSION;
+    if (_root.exists(STORE_SUBDIR + "/" + key) || _root.exists(QUEUE_SUBDIR + "/" + jobFileName) ||
+        _root.exists(CLAIMED_SUBDIR + "/" + jobFileName)) {
+        return true;
+    }
+
+    // queueing it again is the way to retry a bake that failed
+    _root.remove(FAILED_SUBDIR + "/" + key + ERRORS_EXTENSION);
+
+    QDir inputDir { _root.filePath(INPUTS_SUBDIR + "/" + key) };
+    inputDir.removeRecursively();
+    QString inputName = QFileInfo(inputPath).fileName();
+    if (!inputDir.mkpath(".") || !QFile::copy(inputPath, inputDir.filePath(inputName))) {
+        errorOut = "Could not copy " + inputPath + " to the farm";
+        return false;
+    }
+
+    QJsonObject job;
+    job[JOB_INPUT_KEY] = INPUTS_SUBDIR + "/" + key + "/" + inputName;
+    job[JOB_TYPE_KEY] = type;
+
+    // written next to the queue and renamed into it, so that a worker never claims a partial job
+    QString partialJobPath = _root.filePath(INPUTS_SUBDIR + "/" + key + JOB_EXTENSION);
+    QFile jobFile { partialJobPath };
+    if (!jobFile.open(QIODevice::WriteOnly) || jobFile.write(QJsonDocument(job).toJson()) < 0) {
+        errorOut = "Could not write the job of " + inputPath;
+        return false;
+    }
+    jobFile.close();
+
+    if (!QFile::rename(partialJobPath, _root.filePath(QUEUE_SUBDIR + "/" + jobFileName))) {
+        QFile::remove(partialJobPath);
+        // another oven queued the same content in the meantime
+        if (!_root.exists(QUEUE_SUBDIR + "/" + jobFileName)) {
+            errorOut = "Could not queue the job of " + inputPath;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BakeFarm::claimJob(Job& jobOut) {
+    QDir queueDir { _root.filePath(QUEUE_SUBDIR) };
+    auto jobFileNames = queueDir.entryList({ "*" + JOB_EXTENSION }, QDir::Files, QDir::Time | QDir::Reversed);
+    for (const auto& jobFileName : jobFileNames) {
+        // only one of the workers that try to claim a job can rename it, the others move on to the next one
+        QString claimedPath = _root.filePath(CLAIMED_SUBDIR + "/" + jobFileName);
+        if (!QFile::rename(queueDir.filePath(jobFileName), claimedPath)) {
+            continue;
+        }
+
+        jobOut.key = jobFileName.left(jobFileName.length() - JOB_EXTENSION.length());
+
+        QFile jobFile { claimedPath };
+        QJsonObject job;
+        if (jobFile.open(QIODevice::ReadOnly)) {
+            job = QJsonDocument::fromJson(jobFile.readAll()).object();
+            jobFile.close();
+        }
+        jobOut.inputPath = job[JOB_INPUT_KEY].toString();
+        jobOut.type = job[JOB_TYPE_KEY].toString();
+        if (!jobOut.inputPath.isEmpty()) {
+            jobOut.inputPath = _root.filePath(jobOut.inputPath);
+        }
+        return true;
+    }
+    return false;
+}
+
+QString BakeFarm::getOutputPath(const Job& job) const {
+    return _root.filePath(STORE_SUBDIR + QString("/%1.partial-%2").arg(job.key).arg(QCoreApplication::applicationPid()));
+}
+
+void BakeFarm::finishJob(const Job& job, const QStringList& errors) {
+    QString outputPath = getOutputPath(job);
+    if (errors.isEmpty() && !QFile::rename(outputPath, _root.filePath(STORE_SUBDIR + "/" + job.key))) {
+        finishJob(job, { "Could not move the output of the bake to the store" });
+        return;
+    }
+
+    if (!errors.isEmpty()) {
+        QDir(outputPath).removeRecursively();
+        QFile errorFile { _root.filePath(FAILED_SUBDIR + "/" + job.key + ERRORS_EXTENSION) };
+        if (errorFile.open(QIODevice::WriteOnly)) {
+            errorFile.write(errors.join('\n').toUtf8());
+            errorFile.close();
+        }
+    }
+
+    _root.remove(CLAIMED_SUBDIR + "/" + job.key + JOB_EXTENSION);
+    QDir(_root.filePath(INPUTS_SUBDIR + "/" + job.key)).removeRecursively();
+}
@@ -0,0 +1,59 @@
+//
+//  BakeFarm.h
+//  tools/oven/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakeFarm_h
+#define hifi_BakeFarm_h
+
+#include <QtCore/QDir>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+// A queue of bakes shared by ovens through a folder, typically on a network share, so that any number of
+// workers can bake what the asset servers need and the same content is only baked once.
+//
+//   queue/<key>.json       the bakes waiting for a worker
+//   inputs/<key>/<name>    the files to bake, so the workers don't need access to where they came from
+//   claimed/<key>.json     the bakes being baked, a worker claims a bake by renaming it out of the queue
+//   store/<key>/           the output folders of the bakes that succeeded
+//   failed/<key>.txt       the errors of the bakes that failed
+//
+// A key is the SHA-256 of the content of the file in hex, a dash and the type of the bake.  An asset server
+// imports store/<key> as the output of the oven for the asset with that hash, so one farm folder should only
+// be used by ovens of the same version.
+class BakeFarm {
+public:
+    struct Job {
+        QString key;
+        QString inputPath;
+        QString type;
+    };
+
+    BakeFarm(const QString& path);
+
+    // makes the folders of the farm if they are missing
+    bool create();
+
+    // queues the bake of a local file, unless its content was already baked, queued or claimed as that type
+    bool enqueue(const QString& inputPath, const QString& type, QString& errorOut);
+
+    // moves the oldest bake of the queue to the claimed ones, false when there is nothing left to claim
+    bool claimJob(Job& jobOut);
+
+    // the folder a claimed bake writes its output into, the store only sees it once it is complete
+    QString getOutputPath(const Job& job) const;
+
+    // moves the output of a claimed bake to the store, or records its errors when there are any
+    void finishJob(const Job& job, const QStringList& errors);
+
+private:
+    QDir _root;
+};
+
+#endif // hifi_BakeFarm_h
@@ -30,6 +30,61 @@ BakerCLI::BakerCLI(OvenCLIApplication* parent) : QObject(parent) {
 }
 
 void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type) {
+    _outputPath = outputPath;
+    _baker = createBaker(inputUrl, outputPath, type);
+    if (!_baker) {
+        QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
+        return;
+    }
+
+    // invoke the bake method on the baker thread
+    QMetaObject::invokeMethod(_baker.get(), "bake");
+
+    // make sure we hear about the results of this baker when it is done
+    connect(_baker.get(), &Baker::finished, this, &BakerCLI::handleFinishedBaker);
+}
+
+void BakerCLI::queueFarmBake(const QString& inputPath, const QString& farmPath, const QString& type) {
+    BakeFarm farm { farmPath };
+    QString error;
+    if (!farm.create() || !farm.enqueue(inputPath, type, error)) {
+        qCWarning(model_baking) << "Failed to queue" << inputPath << "in the bake farm at" << farmPath << error;
+        QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
+        return;
+    }
+    QCoreApplication::exit(OVEN_STATUS_CODE_SUCCESS);
+}
+
+void BakerCLI::bakeFarm(const QString& farmPath) {
+    _farm.reset(new BakeFarm(farmPath));
+    if (!_farm->create()) {
+        qCWarning(model_baking) << "Could not create the bake farm at" << farmPath;
+        QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
+        return;
+    }
+    bakeNextFarmJob();
+}
+
+void BakerCLI::bakeNextFarmJob() {
+    while (_farm->claimJob(_farmJob)) {
+        qCDebug(model_baking) << "Claimed bake farm job" << _farmJob.key;
+        QString outputPath = _farm->getOutputPath(_farmJob);
+        QDir().mkpath(outputPath);
+        _baker = createBaker(QUrl::fromLocalFile(_farmJob.inputPath), outputPath, _farmJob.type);
+        if (!_baker) {
+            _farm->finishJob(_farmJob, { "Failed to determine baker type for " + _farmJob.type });
+            continue;
+        }
+        QMetaObject::invokeMethod(_baker.get(), "bake");
+        connect(_baker.get(), &Baker::finished, this, &BakerCLI::handleFinishedBaker);
+        return;
+    }
+    qCDebug(model_baking) << "The bake farm queue is empty.";
+    QCoreApplication::exit(OVEN_STATUS_CODE_SUCCESS);
+}
+
+std::unique_ptr<Baker> BakerCLI::createBaker(QUrl inputUrl, const QString& outputPath, const QString& type) {
+    std::unique_ptr<Baker> baker;
 
     // if the URL doesn't have a scheme, assume it is a local file
     if (inputUrl.scheme() != "http" && inputUrl.scheme() != "https" && inputUrl.scheme() != "ftp" && inputUrl.scheme() != "file") {
@@ -43,24 +98,22 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
     static const QString MATERIAL_EXTENSION { "material" };
     static const QString SCRIPT_EXTENSION { "js" };
 
-    _outputPath = outputPath;
-
     // create our appropiate baker
     if (type == MODEL_EXTENSION || type == FBX_EXTENSION) {
         QUrl bakeableModelURL = getBakeableModelURL(inputUrl);
         if (!bakeableModelURL.isEmpty()) {
-            _baker = getModelBaker(bakeableModelURL, outputPath);
-            if (_baker) {
-                _baker->moveToThread(Oven::instance().getNextWorkerThread());
+            baker = getModelBaker(bakeableModelURL, outputPath);
+            if (baker) {
+                baker->moveToThread(Oven::instance().getNextWorkerThread());
             }
         }
     } else if (type == SCRIPT_EXTENSION) {
         // FIXME: disabled for now because it breaks some scripts
-        //_baker = std::unique_ptr<Baker> { new JSBaker(inputUrl, outputPath) };
-        //_baker->moveToThread(Oven::instance().getNextWorkerThread());
+        //baker = std::unique_ptr<Baker> { new JSBaker(inputUrl, outputPath) };
+        //baker->moveToThread(Oven::instance().getNextWorkerThread());
     } else if (type == MATERIAL_EXTENSION) {
-        _baker = std::unique_ptr<Baker> { new MaterialBaker(inputUrl.toDisplayString(), true, outputPath) };
-        _baker->moveToThread(Oven::instance().getNextWorkerThread());
+        baker = std::unique_ptr<Baker> { new MaterialBaker(inputUrl.toDisplayString(), true, outputPath) };
+        baker->moveToThread(Oven::instance().getNextWorkerThread());
     } else {
         // If the type doesn't match the above, we assume we have a texture, and the type specified is the
         // texture usage type (albedo, cubemap, normals, etc.)
@@ -91,28 +144,33 @@ void BakerCLI::bakeFile(QUrl inputUrl, const QString& outputPath, const QString&
             auto it = STRING_TO_TEXTURE_USAGE_TYPE_MAP.find(type);
             if (it == STRING_TO_TEXTURE_USAGE_TYPE_MAP.end()) {
                 qCDebug(model_baking) << "Unknown texture usage type:" << type;
-                QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
+                return baker;
             }
-            _baker = std::unique_ptr<Baker> { new TextureBaker(inputUrl, it->second, outputPath) };
-            _baker->moveToThread(Oven::instance().getNextWorkerThread());
+            baker = std::unique_ptr<Baker> { new TextureBaker(inputUrl, it->second, outputPath) };
+            baker->moveToThread(Oven::instance().getNextWorkerThread());
         }
     }
 
-    if (!_baker) {
+    if (!baker) {
         qCDebug(model_baking) << "Failed to determine baker type for file" << inputUrl;
-        QCoreApplication::exit(OVEN_STATUS_CODE_FAIL);
-        return;
     }
-
-    // invoke the bake method on the baker thread
-    QMetaObject::invokeMethod(_baker.get(), "bake");
-
-    // make sure we hear about the results of this baker when it is done
-    connect(_baker.get(), &Baker::finished, this, &BakerCLI::handleFinishedBaker);
+    return baker;
 }
 
 void BakerCLI::handleFinishedBaker() {
     qCDebug(model_baking) << "Finished baking file.";
+    if (_farm) {
+        QStringList errors = _baker->getErrors();
+        if (_baker->wasAborted()) {
+            errors << "The bake was aborted";
+        }
+        _farm->finishJob(_farmJob, errors);
+        // the baker lives on a worker thread
+        _baker.release()->deleteLater();
+        bakeNextFarmJob();
+        return;
+    }
+
     int exitCode = OVEN_STATUS_CODE_SUCCESS;
     // Do we need this?
     if (_baker->wasAborted()) {
@@ -18,6 +18,7 @@
 
 #include <memory>
 
+#include "BakeFarm.h"
 #include "Baker.h"
 #include "OvenCLIApplication.h"
 
@@ -36,12 +37,24 @@ public:
 public slots:
     void bakeFile(QUrl inputUrl, const QString& outputPath, const QString& type = QString::null);
 
+    // adds a local file to the queue of a bake farm
+    void queueFarmBake(const QString& inputPath, const QString& farmPath, const QString& type);
+
+    // bakes the queue of a bake farm until it is empty
+    void bakeFarm(const QString& farmPath);
+
 private slots:
     void handleFinishedBaker();  
 
 private:
+    std::unique_ptr<Baker> createBaker(QUrl inputUrl, const QString& outputPath, const QString& type);
+    void bakeNextFarmJob();
+
     QDir _outputPath;
     std::unique_ptr<Baker> _baker;
+
+    std::unique_ptr<BakeFarm> _farm;
+    BakeFarm::Job _farmJob;
 };
 
 #endif // hifi_BakerCLI_h
@@ -25,17 +25,26 @@ static const QString CLI_INPUT_PARAMETER = "i";
 static const QString CLI_OUTPUT_PARAMETER = "o";
 static const QString CLI_TYPE_PARAMETER = "t";
 static const QString CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER = "disable-texture-compression";
+static const QString CLI_FARM_PARAMETER = "farm";
 
 QUrl OvenCLIApplication::_inputUrlParameter;
 QUrl OvenCLIApplication::_outputUrlParameter;
 QString OvenCLIApplication::_typeParameter;
+QString OvenCLIApplication::_farmPathParameter;
 
 OvenCLIApplication::OvenCLIApplication(int argc, char* argv[]) :
     QCoreApplication(argc, argv)
 {
     BakerCLI* cli = new BakerCLI(this);
-    QMetaObject::invokeMethod(cli, "bakeFile", Qt::QueuedConnection, Q_ARG(QUrl, _inputUrlParameter),
-                              Q_ARG(QString, _outputUrlParameter.toString()), Q_ARG(QString, _typeParameter));
+    if (_farmPathParameter.isEmpty()) {
+        QMetaObject::invokeMethod(cli, "bakeFile", Qt::QueuedConnection, Q_ARG(QUrl, _inputUrlParameter),
+                                  Q_ARG(QString, _outputUrlParameter.toString()), Q_ARG(QString, _typeParameter));
+    } else if (!_inputUrlParameter.isEmpty()) {
+        QMetaObject::invokeMethod(cli, "queueFarmBake", Qt::QueuedConnection, Q_ARG(QString, _inputUrlParameter.toString()),
+                                  Q_ARG(QString, _farmPathParameter), Q_ARG(QString, _typeParameter));
+    } else {
+        QMetaObject::invokeMethod(cli, "bakeFarm", Qt::QueuedConnection, Q_ARG(QString, _farmPathParameter));
+    }
 }
 
 void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
@@ -47,7 +56,8 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
         { CLI_INPUT_PARAMETER, "Path to file that you would like to bake.", "input" },
         { CLI_OUTPUT_PARAMETER, "Path to folder that will be used as output.", "output" },
         { CLI_TYPE_PARAMETER, "Type of asset. [model|material]"/*|js]"*/, "type" },
-        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." }
+        { CLI_DISABLE_TEXTURE_COMPRESSION_PARAMETER, "Disable texture compression." },
+        { CLI_FARM_PARAMETER, "Path to the folder of a bake farm. Queues the input in it, or without one bakes its queue until it is empty.", "farm" }
     });
 
     auto versionOption = parser.addVersionOption();
@@ -75,14 +85,18 @@ void OvenCLIApplication::parseCommandLine(int argc, char* argv[]) {
         Q_UNREACHABLE();
     }
 
-    if (!parser.isSet(CLI_INPUT_PARAMETER) || !parser.isSet(CLI_OUTPUT_PARAMETER)) {
+    if (parser.isSet(CLI_FARM_PARAMETER)) {
+        _farmPathParameter = QDir::fromNativeSeparators(parser.value(CLI_FARM_PARAMETER));
+    } else if (!parser.isSet(CLI_INPUT_PARAMETER) || !parser.isSet(CLI_OUTPUT_PARAMETER)) {
         std::cout << "Error: Input and Output not set" << std::endl; // Avoid Qt log spam
         QCoreApplication mockApp(argc, argv); // required for call to showHelp()
         parser.showHelp();
         Q_UNREACHABLE();
     }
 
-    _inputUrlParameter = QDir::fromNativeSeparators(parser.value(CLI_INPUT_PARAMETER));
+    if (parser.isSet(CLI_INPUT_PARAMETER)) {
+        _inputUrlParameter = QDir::fromNativeSeparators(parser.value(CLI_INPUT_PARAMETER));
+    }
     _outputUrlParameter = QDir::fromNativeSeparators(parser.value(CLI_OUTPUT_PARAMETER));
 
     _typeParameter = parser.isSet(CLI_TYPE_PARAMETER) ? parser.value(CLI_TYPE_PARAMETER) : QString::null;
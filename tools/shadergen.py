@@ -4,6 +4,7 @@ import sys
 import time
 import os
 import json
+import struct
 import argparse
 import concurrent
 from os.path import expanduser
@@ -161,6 +162,42 @@ def executeSubprocess(processArgs):
             processResult.stdout.decode('utf-8'),
             processResult.stderr.decode('utf-8')))
 
+# The reflection in the form the shaders library loads it, so that it doesn't have to parse the JSON of every shader
+# at runtime.  For each of the inputs, outputs, textures, uniform buffers and resource buffers: the number of entries,
+# then the length, name and location or binding of each one, all little endian.  Mirrors shader::Reflection::parse
+REFLECTION_MAGIC = b'HFRF'
+REFLECTION_VERSION = 1
+
+def writeBinaryReflection(jsonFile, binaryFile):
+    with open(jsonFile) as f:
+        root = json.load(f)
+
+    def locationMap(key, locationKey):
+        return { entry['name']: entry[locationKey] for entry in root.get(key, []) }
+
+    inputs = locationMap('inputs', 'location')
+    outputs = locationMap('outputs', 'location')
+    textures = locationMap('textures', 'binding')
+    uniformBuffers = locationMap('ubos', 'binding')
+    resourceBuffers = locationMap('ssbos', 'binding')
+    bufferTextures = [entry['name'] for entry in root.get('textures', []) if entry['type'] == 'samplerBuffer']
+    if bufferTextures and resourceBuffers:
+        raise RuntimeError('{} has both SSBOs and texture buffers defined'.format(jsonFile))
+    for name in bufferTextures:
+        resourceBuffers[name] = textures.pop(name)
+
+    output = bytearray(REFLECTION_MAGIC)
+    output += struct.pack('<I', REFLECTION_VERSION)
+    for locations in [inputs, outputs, textures, uniformBuffers, resourceBuffers]:
+        output += struct.pack('<I', len(locations))
+        for name, location in sorted(locations.items()):
+            encodedName = name.encode('utf-8')
+            output += struct.pack('<H', len(encodedName))
+            output += encodedName
+            output += struct.pack('<i', location)
+    with open(binaryFile, 'wb') as f:
+        f.write(output)
+
 folderMutex = Lock()
 
 def processCommand(line):
@@ -183,8 +220,9 @@ def processCommand(line):
     upoptSpirvFile = unoptGlslFile + '.spv'
     spirvFile = unoptGlslFile + '.opt.spv'
     reflectionFile  = unoptGlslFile + '.json'
+    binaryReflectionFile = unoptGlslFile + '.reflection'
     glslFile = unoptGlslFile + '.glsl'
-    outputFiles = [unoptGlslFile, spirvFile, reflectionFile, glslFile]
+    outputFiles = [unoptGlslFile, spirvFile, reflectionFile, binaryReflectionFile, glslFile]
 
     scribeOutputDir = os.path.abspath(os.path.join(unoptGlslFile, os.pardir))
 
@@ -224,6 +262,7 @@ def processCommand(line):
 
         # Generation JSON reflection
         executeSubprocess([spirvCrossExec, '--reflect', 'json', '--output', reflectionFile, spirvFile])
+        writeBinaryReflection(reflectionFile, binaryReflectionFile)
 
         # Generate the optimized GLSL output
         spirvCrossDialect = dialect
@@ -240,6 +279,7 @@ def processCommand(line):
         Path(spirvFile).touch()
         Path(glslFile).touch()
         Path(reflectionFile).touch()
+        Path(binaryReflectionFile).touch()
     return True
 
 
@@ -0,0 +1,102 @@
+//
+//  LinkEmulator.cpp
+//  tools/udt-test/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "LinkEmulator.h"
+
+#include <algorithm>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+static const int DELIVERY_INTERVAL_MSECS = 1;
+
+LinkEmulator::LinkEmulator(const Impairment& impairment, const HifiSockAddr& receiver, QObject* parent) :
+    QObject(parent),
+    _impairment(impairment),
+    _receiver(receiver)
+{
+    _socket.bind(QHostAddress::LocalHost);
+    connect(&_socket, &QUdpSocket::readyRead, this, &LinkEmulator::readPendingDatagrams);
+
+    _deliveryTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_deliveryTimer, &QTimer::timeout, this, &LinkEmulator::deliverDueDatagrams);
+    _deliveryTimer.start(DELIVERY_INTERVAL_MSECS);
+}
+
+void LinkEmulator::readPendingDatagrams() {
+    while (_socket.hasPendingDatagrams()) {
+        Datagram datagram;
+        datagram.data.resize(_socket.pendingDatagramSize());
+        QHostAddress senderAddress;
+        quint16 senderPort;
+        _socket.readDatagram(datagram.data.data(), datagram.data.size(), &senderAddress, &senderPort);
+
+        HifiSockAddr from(senderAddress, senderPort);
+        if (from == _receiver) {
+            if (_sender.isNull()) {
+                continue;
+            }
+            datagram.destination = _sender;
+            queue(_toSender, std::move(datagram));
+        } else {
+            if (_sender.isNull()) {
+                _sender = from;
+            }
+            datagram.destination = _receiver;
+            queue(_toReceiver, std::move(datagram));
+        }
+    }
+    deliverDueDatagrams();
+}
+
+void LinkEmulator::queue(Path& path, Datagram datagram) {
+    if (_distribution(_generator) < _impairment.loss) {
+        ++_stats.dropped;
+        return;
+    }
+
+    quint64 now = usecTimestampNow();
+    quint64 departureTime = now;
+    if (_impairment.bandwidthMbps > 0.0f) {
+        // the datagram leaves once the ones before it are through the link
+        quint64 startTime = std::max(now, path.linkFreeTime);
+        if (startTime - now > (quint64)_impairment.queueMsecs * USECS_PER_MSEC) {
+            ++_stats.overflowed;
+            return;
+        }
+        departureTime = startTime + (quint64)(datagram.data.size() * BITS_IN_BYTE / _impairment.bandwidthMbps);
+        path.linkFreeTime = departureTime;
+    }
+
+    float jitter = _impairment.jitterMsecs * (2.0f * _distribution(_generator) - 1.0f);
+    float delayMsecs = std::max(0.0f, _impairment.delayMsecs + jitter);
+    if (_distribution(_generator) < _impairment.reorder) {
+        // held back behind the next few datagrams
+        static const float REORDER_DELAY_MSECS = 5.0f;
+        delayMsecs += REORDER_DELAY_MSECS + 2.0f * _impairment.jitterMsecs;
+        ++_stats.reordered;
+    }
+
+    quint64 deliveryTime = departureTime + (quint64)(delayMsecs * USECS_PER_MSEC);
+    path.inFlight.emplace(deliveryTime, std::move(datagram));
+}
+
+void LinkEmulator::deliverDueDatagrams() {
+    quint64 now = usecTimestampNow();
+    for (auto path : { &_toReceiver, &_toSender }) {
+        auto& inFlight = path->inFlight;
+        while (!inFlight.empty() && inFlight.begin()->first <= now) {
+            const auto& datagram = inFlight.begin()->second;
+            _socket.writeDatagram(datagram.data, datagram.destination.getAddress(), datagram.destination.getPort());
+            ++_stats.forwarded;
+            inFlight.erase(inFlight.begin());
+        }
+    }
+}
@@ -0,0 +1,84 @@
+//
+//  LinkEmulator.h
+//  tools/udt-test/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_LinkEmulator_h
+#define hifi_LinkEmulator_h
+
+#include <map>
+#include <random>
+
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtNetwork/QUdpSocket>
+
+#include <HifiSockAddr.h>
+
+// A UDP relay that stands for the network between two sockets of the same process.  The datagrams it forwards,
+// in both directions, go through a link of limited bandwidth with a drop-tail queue, get delayed with jitter,
+// and are dropped or held back behind the ones that follow them at random.
+class LinkEmulator : public QObject {
+    Q_OBJECT
+public:
+    struct Impairment {
+        float loss { 0.0f }; // fraction of the datagrams dropped
+        float reorder { 0.0f }; // fraction of the datagrams held back behind the ones that follow them
+        int delayMsecs { 0 }; // one way
+        int jitterMsecs { 0 }; // the delay varies by up to this much either way
+        float bandwidthMbps { 0.0f }; // 0 for no limit
+        int queueMsecs { 100 }; // the datagrams that would wait longer than this for the link are dropped
+    };
+
+    struct Stats {
+        int forwarded { 0 };
+        int dropped { 0 };
+        int reordered { 0 };
+        int overflowed { 0 };
+    };
+
+    LinkEmulator(const Impairment& impairment, const HifiSockAddr& receiver, QObject* parent = nullptr);
+
+    quint16 localPort() const { return _socket.localPort(); }
+    const Stats& getStats() const { return _stats; }
+
+private slots:
+    void readPendingDatagrams();
+    void deliverDueDatagrams();
+
+private:
+    struct Datagram {
+        QByteArray data;
+        HifiSockAddr destination;
+    };
+
+    // one direction of the link
+    struct Path {
+        std::multimap<quint64, Datagram> inFlight; // by delivery time
+        quint64 linkFreeTime { 0 };
+    };
+
+    void queue(Path& path, Datagram datagram);
+
+    Impairment _impairment;
+    HifiSockAddr _receiver;
+    HifiSockAddr _sender; // the first socket to send something that isn't the receiver
+
+    QUdpSocket _socket;
+    QTimer _deliveryTimer;
+    Path _toReceiver;
+    Path _toSender;
+    Stats _stats;
+
+    std::mt19937 _generator { std::random_device()() };
+    std::uniform_real_distribution<float> _distribution { 0.0f, 1.0f };
+};
+
+#endif // hifi_LinkEmulator_h
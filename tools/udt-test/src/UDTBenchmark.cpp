@@ -0,0 +1,296 @@
+//
+//  UDTBenchmark.cpp
+//  tools/udt-test/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "UDTBenchmark.h"
+
+#include <algorithm>
+#include <ctime>
+
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+#include <udt/Packet.h>
+#include <udt/PacketList.h>
+
+static const int MAX_MESSAGES_IN_FLIGHT = 4;
+static const int UNRELIABLE_SEND_INTERVAL_MSECS = 1;
+static const int STATS_INTERVAL_MSECS = 100;
+
+static const double MEGABITS_PER_BYTE = BITS_IN_BYTE / 1000000.0;
+
+static QJsonObject distributionToJson(std::vector<double> samples) {
+    QJsonObject distribution;
+    if (samples.empty()) {
+        return distribution;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](double fraction) { return samples[(size_t)(fraction * (samples.size() - 1))]; };
+    distribution["min"] = samples.front();
+    distribution["p50"] = percentile(0.5);
+    distribution["p95"] = percentile(0.95);
+    distribution["p99"] = percentile(0.99);
+    distribution["max"] = samples.back();
+    distribution["samples"] = (int)samples.size();
+    return distribution;
+}
+
+UDTBenchmark::Scenario UDTBenchmark::Scenario::fromJson(const QJsonObject& object) {
+    Scenario scenario;
+    scenario.name = object["name"].toString();
+    scenario.traffic = object["traffic"].toString(scenario.traffic);
+    scenario.impairment.loss = (float)object["loss"].toDouble(scenario.impairment.loss);
+    scenario.impairment.reorder = (float)object["reorder"].toDouble(scenario.impairment.reorder);
+    scenario.impairment.delayMsecs = object["delay"].toInt(scenario.impairment.delayMsecs);
+    scenario.impairment.jitterMsecs = object["jitter"].toInt(scenario.impairment.jitterMsecs);
+    scenario.impairment.bandwidthMbps = (float)object["bandwidth"].toDouble(scenario.impairment.bandwidthMbps);
+    scenario.impairment.queueMsecs = object["queue"].toInt(scenario.impairment.queueMsecs);
+    scenario.unreliableRateMbps = (float)object["rate"].toDouble(scenario.unreliableRateMbps);
+    scenario.messageBytes = object["messageBytes"].toInt(scenario.messageBytes);
+    scenario.durationSecs = object["duration"].toInt(scenario.durationSecs);
+    if (scenario.name.isEmpty()) {
+        scenario.name = scenario.traffic;
+    }
+    return scenario;
+}
+
+QJsonObject UDTBenchmark::Scenario::toJson() const {
+    QJsonObject object;
+    object["name"] = name;
+    object["traffic"] = traffic;
+    object["loss"] = impairment.loss;
+    object["reorder"] = impairment.reorder;
+    object["delay"] = impairment.delayMsecs;
+    object["jitter"] = impairment.jitterMsecs;
+    object["bandwidth"] = impairment.bandwidthMbps;
+    object["queue"] = impairment.queueMsecs;
+    object["rate"] = unreliableRateMbps;
+    object["messageBytes"] = messageBytes;
+    object["duration"] = durationSecs;
+    return object;
+}
+
+UDTBenchmark::UDTBenchmark(const std::vector<Scenario>& scenarios, const QString& outputPath, QObject* parent) :
+    QObject(parent),
+    _scenarios(scenarios),
+    _outputPath(outputPath)
+{
+    _unreliableTimer.setTimerType(Qt::PreciseTimer);
+    connect(&_unreliableTimer, &QTimer::timeout, this, &UDTBenchmark::sendUnreliablePackets);
+    connect(&_statsTimer, &QTimer::timeout, this, &UDTBenchmark::sampleStats);
+}
+
+void UDTBenchmark::start() {
+    startScenario();
+}
+
+void UDTBenchmark::startScenario() {
+    if (_scenarioIndex >= _scenarios.size()) {
+        QJsonObject output;
+        output["scenarios"] = _results;
+        QByteArray json = QJsonDocument(output).toJson();
+        QFile outputFile(_outputPath);
+        if (_outputPath.isEmpty()) {
+            qDebug().noquote() << json;
+        } else if (!outputFile.open(QIODevice::WriteOnly) || outputFile.write(json) < 0) {
+            qCritical() << "Could not write the results of the benchmark to" << _outputPath;
+        }
+        emit finished();
+        return;
+    }
+
+    const auto& scenario = _scenarios[_scenarioIndex];
+    qDebug() << "Running" << scenario.name << "for" << scenario.durationSecs << "seconds";
+
+    _receiver.reset(new udt::Socket());
+    _receiver->bind(QHostAddress::LocalHost);
+    _receiver->setMessageHandler([this](std::unique_ptr<udt::Packet> packet) {
+        handleMessagePacket(std::move(packet));
+    });
+    _receiver->setPacketHandler([this](std::unique_ptr<udt::Packet> packet) {
+        handleUnreliablePacket(std::move(packet));
+    });
+    _receiver->setMessageFailureHandler([this](HifiSockAddr from, udt::Packet::MessageNumber messageNumber) {
+        _pendingMessageBytes.erase(messageNumber);
+    });
+
+    _link.reset(new LinkEmulator(scenario.impairment, HifiSockAddr(QHostAddress::LocalHost, _receiver->localPort())));
+    _target = HifiSockAddr(QHostAddress::LocalHost, _link->localPort());
+
+    _sender.reset(new udt::Socket());
+    _sender->bind(QHostAddress::LocalHost);
+
+    _messagesInFlight = 0;
+    _nextUnreliableSequence = 0;
+    _unreliableBytesDue = 0.0;
+    _unreliablePacketsSent = 0;
+    _pendingMessageBytes.clear();
+    _reliableBytesReceived = 0;
+    _messagesReceived = 0;
+    _unreliableBytesReceived = 0;
+    _unreliablePacketsReceived = 0;
+    _unreliablePacketsReordered = 0;
+    _highestUnreliableSequence = 0;
+    _latencyMsecs.clear();
+    _rttMsecs.clear();
+    _sentPackets = 0;
+    _retransmittedPackets = 0;
+
+    _elapsed.start();
+    _cpuStart = std::clock();
+
+    if (scenario.traffic == "reliable" || scenario.traffic == "mixed") {
+        for (int i = 0; i < MAX_MESSAGES_IN_FLIGHT; ++i) {
+            sendMessage();
+        }
+    }
+    if (scenario.traffic == "unreliable" || scenario.traffic == "mixed") {
+        _lastUnreliableSendTime = _elapsed.nsecsElapsed() / NSECS_PER_USEC;
+        _unreliableTimer.start(UNRELIABLE_SEND_INTERVAL_MSECS);
+    }
+    _statsTimer.start(STATS_INTERVAL_MSECS);
+
+    QTimer::singleShot(scenario.durationSecs * (int)MSECS_PER_SECOND, this, &UDTBenchmark::finishScenario);
+}
+
+void UDTBenchmark::sendMessage() {
+    const auto& scenario = _scenarios[_scenarioIndex];
+    auto packetList = udt::PacketList::create(PacketType::BulkAvatarData, QByteArray(), true, true);
+
+    int packetSize = udt::Packet::maxPayloadSize(true);
+    QByteArray packetData(packetSize, 0);
+    for (int bytesWritten = 0; bytesWritten < scenario.messageBytes; bytesWritten += packetSize) {
+        packetList->write(packetData.constData(), std::min(packetSize, scenario.messageBytes - bytesWritten));
+    }
+    packetList->closeCurrentPacket();
+
+    _sender->writePacketList(std::move(packetList), _target);
+    ++_messagesInFlight;
+}
+
+void UDTBenchmark::sendUnreliablePackets() {
+    const auto& scenario = _scenarios[_scenarioIndex];
+
+    // megabits per second are bits per microsecond
+    qint64 now = _elapsed.nsecsElapsed() / NSECS_PER_USEC;
+    _unreliableBytesDue += scenario.unreliableRateMbps * (now - _lastUnreliableSendTime) / BITS_IN_BYTE;
+    _lastUnreliableSendTime = now;
+
+    int payloadSize = udt::Packet::maxPayloadSize(false);
+    while (_unreliableBytesDue >= payloadSize) {
+        auto packet = udt::Packet::create(payloadSize, false);
+        packet->writePrimitive(_nextUnreliableSequence++);
+        packet->writePrimitive(usecTimestampNow());
+        packet->setPayloadSize(payloadSize);
+        _sender->writePacket(*packet, _target);
+
+        _unreliableBytesDue -= payloadSize;
+        ++_unreliablePacketsSent;
+    }
+}
+
+void UDTBenchmark::handleMessagePacket(std::unique_ptr<udt::Packet> packet) {
+    auto messageNumber = packet->getMessageNumber();
+    _pendingMessageBytes[messageNumber] += (int)packet->getPayloadSize();
+
+    auto position = packet->getPacketPosition();
+    if (position == udt::Packet::ONLY || position == udt::Packet::LAST) {
+        _reliableBytesReceived += _pendingMessageBytes[messageNumber];
+        _pendingMessageBytes.erase(messageNumber);
+        ++_messagesReceived;
+
+        // keep the pipe full for as long as the scenario runs
+        --_messagesInFlight;
+        if (_statsTimer.isActive()) {
+            sendMessage();
+        }
+    }
+}
+
+void UDTBenchmark::handleUnreliablePacket(std::unique_ptr<udt::Packet> packet) {
+    quint32 sequence;
+    quint64 sendTime;
+    packet->readPrimitive(&sequence);
+    packet->readPrimitive(&sendTime);
+
+    // both ends are in this process, so the latency is one way
+    _latencyMsecs.push_back((double)(usecTimestampNow() - sendTime) / USECS_PER_MSEC);
+    if (_unreliablePacketsReceived > 0 && sequence < _highestUnreliableSequence) {
+        ++_unreliablePacketsReordered;
+    }
+    _highestUnreliableSequence = std::max(_highestUnreliableSequence, sequence);
+    ++_unreliablePacketsReceived;
+    _unreliableBytesReceived += packet->getPayloadSize();
+}
+
+void UDTBenchmark::sampleStats() {
+    auto connections = _sender->getConnectionSockAddrs();
+    if (std::find(connections.begin(), connections.end(), _target) == connections.end()) {
+        return;
+    }
+
+    auto stats = _sender->sampleStatsForConnection(_target);
+    if (stats.rtt > 0) {
+        _rttMsecs.push_back((double)stats.rtt / USECS_PER_MSEC);
+    }
+    _sentPackets += stats.sentPackets;
+    _retransmittedPackets += stats.retransmittedPackets;
+}
+
+void UDTBenchmark::finishScenario() {
+    _unreliableTimer.stop();
+    _statsTimer.stop();
+    sampleStats();
+
+    double cpuSecs = (double)(std::clock() - _cpuStart) / CLOCKS_PER_SEC;
+    double elapsedSecs = (double)_elapsed.elapsed() / MSECS_PER_SECOND;
+    double megabitsReceived = (_reliableBytesReceived + _unreliableBytesReceived) * MEGABITS_PER_BYTE;
+
+    const auto& scenario = _scenarios[_scenarioIndex];
+    QJsonObject result;
+    result["scenario"] = scenario.toJson();
+    result["elapsedSecs"] = elapsedSecs;
+    result["goodputMbps"] = megabitsReceived / elapsedSecs;
+    result["reliableGoodputMbps"] = _reliableBytesReceived * MEGABITS_PER_BYTE / elapsedSecs;
+    result["messagesReceived"] = _messagesReceived;
+    result["rttMsecs"] = distributionToJson(_rttMsecs);
+    result["retransmitRatio"] = _sentPackets > 0 ? (double)_retransmittedPackets / _sentPackets : 0.0;
+    result["cpuSecsPerMegabit"] = megabitsReceived > 0.0 ? cpuSecs / megabitsReceived : 0.0;
+
+    if (_unreliablePacketsSent > 0) {
+        QJsonObject unreliable;
+        unreliable["sent"] = _unreliablePacketsSent;
+        unreliable["received"] = _unreliablePacketsReceived;
+        unreliable["lossRate"] = 1.0 - (double)_unreliablePacketsReceived / _unreliablePacketsSent;
+        unreliable["reorderRate"] = _unreliablePacketsReceived > 0 ?
+            (double)_unreliablePacketsReordered / _unreliablePacketsReceived : 0.0;
+        unreliable["latencyMsecs"] = distributionToJson(_latencyMsecs);
+        result["unreliable"] = unreliable;
+    }
+
+    const auto& linkStats = _link->getStats();
+    QJsonObject link;
+    link["forwarded"] = linkStats.forwarded;
+    link["dropped"] = linkStats.dropped;
+    link["reordered"] = linkStats.reordered;
+    link["overflowed"] = linkStats.overflowed;
+    result["link"] = link;
+
+    _results.append(result);
+
+    _sender.reset();
+    _link.reset();
+    _receiver.reset();
+
+    ++_scenarioIndex;
+    QTimer::singleShot(0, this, &UDTBenchmark::startScenario);
+}
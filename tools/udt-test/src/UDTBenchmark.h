@@ -0,0 +1,108 @@
+//
+//  UDTBenchmark.h
+//  tools/udt-test/src
+//
+//  Copyright 2019 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_UDTBenchmark_h
+#define hifi_UDTBenchmark_h
+
+#include <ctime>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+
+#include <udt/Socket.h>
+
+#include "LinkEmulator.h"
+
+// Runs scripted scenarios between a sending and a receiving udt::Socket of this process, connected through a
+// LinkEmulator, and reports each run as JSON: the goodput, the distribution of the RTT the sender measured and
+// of the latency of the unreliable packets, the ratio of retransmitted packets and the CPU time per megabit.
+// The traffic of a scenario is "reliable" (ordered PacketList messages, a few of them in flight), "unreliable"
+// (sequenced unreliable packets at a fixed rate) or "mixed" (both at once).
+class UDTBenchmark : public QObject {
+    Q_OBJECT
+public:
+    struct Scenario {
+        QString name;
+        QString traffic { "reliable" };
+        LinkEmulator::Impairment impairment;
+        float unreliableRateMbps { 5.0f };
+        int messageBytes { 1000000 };
+        int durationSecs { 10 };
+
+        static Scenario fromJson(const QJsonObject& object);
+        QJsonObject toJson() const;
+    };
+
+    UDTBenchmark(const std::vector<Scenario>& scenarios, const QString& outputPath, QObject* parent = nullptr);
+
+    void start();
+
+signals:
+    void finished();
+
+private slots:
+    void sendUnreliablePackets();
+    void sampleStats();
+    void finishScenario();
+
+private:
+    void startScenario();
+    void sendMessage();
+    void handleMessagePacket(std::unique_ptr<udt::Packet> packet);
+    void handleUnreliablePacket(std::unique_ptr<udt::Packet> packet);
+
+    std::vector<Scenario> _scenarios;
+    size_t _scenarioIndex { 0 };
+    QString _outputPath;
+    QJsonArray _results;
+
+    // the sockets and the link of the running scenario
+    std::unique_ptr<udt::Socket> _sender;
+    std::unique_ptr<udt::Socket> _receiver;
+    std::unique_ptr<LinkEmulator> _link;
+    HifiSockAddr _target;
+
+    QTimer _unreliableTimer;
+    QTimer _statsTimer;
+    QElapsedTimer _elapsed;
+    clock_t _cpuStart { 0 };
+
+    // sending side
+    int _messagesInFlight { 0 };
+    quint32 _nextUnreliableSequence { 0 };
+    double _unreliableBytesDue { 0.0 };
+    int _unreliablePacketsSent { 0 };
+    qint64 _lastUnreliableSendTime { 0 };
+
+    // receiving side
+    std::unordered_map<udt::Packet::MessageNumber, int> _pendingMessageBytes;
+    quint64 _reliableBytesReceived { 0 };
+    int _messagesReceived { 0 };
+    quint64 _unreliableBytesReceived { 0 };
+    int _unreliablePacketsReceived { 0 };
+    int _unreliablePacketsReordered { 0 };
+    quint32 _highestUnreliableSequence { 0 };
+    std::vector<double> _latencyMsecs;
+
+    // the samples of the connection stats of the sender
+    std::vector<double> _rttMsecs;
+    quint64 _sentPackets { 0 };
+    quint64 _retransmittedPackets { 0 };
+};
+
+#endif // hifi_UDTBenchmark_h
@@ -12,6 +12,9 @@
 #include "UDTTest.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
 
 #include <udt/Constants.h>
 #include <udt/Packet.h>
@@ -55,6 +58,37 @@ const QCommandLineOption MESSAGE_SEED {
 const QCommandLineOption STATS_INTERVAL {
     "stats-interval", "stats output interval (default is 100ms)", "milliseconds"
 };
+const QCommandLineOption BENCHMARK {
+    "benchmark", "run a benchmark between two local sockets through an emulated link, with reliable, unreliable or "
+    "mixed traffic", "traffic"
+};
+const QCommandLineOption BENCHMARK_SCENARIOS {
+    "scenarios", "run the benchmark scenarios of a JSON file instead of a single one", "file"
+};
+const QCommandLineOption BENCHMARK_LOSS {
+    "loss", "fraction of the packets the emulated link drops (default is 0)", "fraction"
+};
+const QCommandLineOption BENCHMARK_REORDER {
+    "reorder", "fraction of the packets the emulated link reorders (default is 0)", "fraction"
+};
+const QCommandLineOption BENCHMARK_DELAY {
+    "delay", "one way delay of the emulated link (default is 0)", "milliseconds"
+};
+const QCommandLineOption BENCHMARK_JITTER {
+    "jitter", "maximum jitter added to the delay of the emulated link (default is 0)", "milliseconds"
+};
+const QCommandLineOption BENCHMARK_BANDWIDTH {
+    "bandwidth", "bandwidth of the emulated link (default is unlimited)", "Mb/s"
+};
+const QCommandLineOption BENCHMARK_RATE {
+    "rate", "send rate of the unreliable traffic of the benchmark (default is 5)", "Mb/s"
+};
+const QCommandLineOption BENCHMARK_DURATION {
+    "duration", "duration of a benchmark scenario (default is 10)", "seconds"
+};
+const QCommandLineOption BENCHMARK_OUTPUT {
+    "output", "file the JSON results of the benchmark are written to (default is the log)", "file"
+};
 
 const QStringList CLIENT_STATS_TABLE_HEADERS {
     "Send (Mb/s)", "Est. Max (Mb/s)", "RTT (ms)", "CW (P)", "Period (us)",
@@ -70,6 +104,11 @@ UDTTest::UDTTest(int& argc, char** argv) :
     QCoreApplication(argc, argv)
 {
     parseArguments();
+
+    if (_argumentParser.isSet(BENCHMARK) || _argumentParser.isSet(BENCHMARK_SCENARIOS)) {
+        startBenchmark();
+        return;
+    }
     
     // randomize the seed for packet size randomization
     srand(time(NULL));
@@ -224,7 +263,9 @@ void UDTTest::parseArguments() {
     _argumentParser.addOptions({
         PORT_OPTION, TARGET_OPTION, PACKET_SIZE, MIN_PACKET_SIZE, MAX_PACKET_SIZE,
         MAX_SEND_BYTES, MAX_SEND_PACKETS, UNRELIABLE_PACKETS, ORDERED_PACKETS,
-        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL
+        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL, BENCHMARK, BENCHMARK_SCENARIOS, BENCHMARK_LOSS,
+        BENCHMARK_REORDER, BENCHMARK_DELAY, BENCHMARK_JITTER, BENCHMARK_BANDWIDTH, BENCHMARK_RATE,
+        BENCHMARK_DURATION, BENCHMARK_OUTPUT
     });
     
     if (!_argumentParser.parse(arguments())) {
@@ -239,6 +280,61 @@ void UDTTest::parseArguments() {
     }
 }
 
+void UDTTest::startBenchmark() {
+    std::vector<UDTBenchmark::Scenario> scenarios;
+
+    if (_argumentParser.isSet(BENCHMARK_SCENARIOS)) {
+        QFile scenariosFile { _argumentParser.value(BENCHMARK_SCENARIOS) };
+        if (!scenariosFile.open(QIODevice::ReadOnly)) {
+            qCritical() << "Could not open the benchmark scenarios" << scenariosFile.fileName();
+            QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+            return;
+        }
+        auto scenariosArray = QJsonDocument::fromJson(scenariosFile.readAll()).object()["scenarios"].toArray();
+        for (const auto& scenario : scenariosArray) {
+            scenarios.push_back(UDTBenchmark::Scenario::fromJson(scenario.toObject()));
+        }
+    } else {
+        UDTBenchmark::Scenario scenario;
+        scenario.traffic = _argumentParser.value(BENCHMARK);
+        scenario.name = scenario.traffic;
+        if (_argumentParser.isSet(BENCHMARK_LOSS)) {
+            scenario.impairment.loss = _argumentParser.value(BENCHMARK_LOSS).toFloat();
+        }
+        if (_argumentParser.isSet(BENCHMARK_REORDER)) {
+            scenario.impairment.reorder = _argumentParser.value(BENCHMARK_REORDER).toFloat();
+        }
+        if (_argumentParser.isSet(BENCHMARK_DELAY)) {
+            scenario.impairment.delayMsecs = _argumentParser.value(BENCHMARK_DELAY).toInt();
+        }
+        if (_argumentParser.isSet(BENCHMARK_JITTER)) {
+            scenario.impairment.jitterMsecs = _argumentParser.value(BENCHMARK_JITTER).toInt();
+        }
+        if (_argumentParser.isSet(BENCHMARK_BANDWIDTH)) {
+            scenario.impairment.bandwidthMbps = _argumentParser.value(BENCHMARK_BANDWIDTH).toFloat();
+        }
+        if (_argumentParser.isSet(BENCHMARK_RATE)) {
+            scenario.unreliableRateMbps = _argumentParser.value(BENCHMARK_RATE).toFloat();
+        }
+        if (_argumentParser.isSet(BENCHMARK_DURATION)) {
+            scenario.durationSecs = _argumentParser.value(BENCHMARK_DURATION).toInt();
+        }
+        scenarios.push_back(scenario);
+    }
+
+    for (const auto& scenario : scenarios) {
+        if (scenario.traffic != "reliable" && scenario.traffic != "unreliable" && scenario.traffic != "mixed") {
+            qCritical() << "The traffic of a benchmark is reliable, unreliable or mixed, not" << scenario.traffic;
+            QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
+            return;
+        }
+    }
+
+    _benchmark.reset(new UDTBenchmark(scenarios, _argumentParser.value(BENCHMARK_OUTPUT)));
+    connect(_benchmark.get(), &UDTBenchmark::finished, this, &QCoreApplication::quit, Qt::QueuedConnection);
+    QMetaObject::invokeMethod(_benchmark.get(), [this] { _benchmark->start(); }, Qt::QueuedConnection);
+}
+
 void UDTTest::sendInitialPackets() {
     static const int NUM_INITIAL_PACKETS = 500;
     
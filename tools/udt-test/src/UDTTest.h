@@ -15,6 +15,7 @@
 #define hifi_UDTTest_h
 
 
+#include <memory>
 #include <random>
 
 #include <QtCore/QCoreApplication>
@@ -25,6 +26,8 @@
 
 #include <ReceivedMessage.h>
 
+#include "UDTBenchmark.h"
+
 struct Message {
     udt::MessageNumber messageNumber;
     QByteArray data;
@@ -41,6 +44,7 @@ public slots:
     
 private:
     void parseArguments();
+    void startBenchmark(); // runs the benchmark scenarios instead of the send or receive test
     void handleMessage(std::unique_ptr<Message> message);
     
     void sendInitialPackets(); // fills the queue with packets to start
@@ -71,6 +75,8 @@ private:
     int _totalQueuedBytes { 0 }; // keeps track of the number of bytes we have already queued
     
     int _statsInterval { 100 }; // recording interval for stats in milliseconds
+
+    std::unique_ptr<UDTBenchmark> _benchmark;
 };
 
 #endif // hifi_UDTTest_h